@@ -145,7 +145,17 @@ typedef enum /*:int16_t*/
     cldnn_throttle_high
 } cldnn_throttle_mode_type;
 
+/// @brief OpenCL device types.
+typedef enum /*:int16_t*/
+{
+    cldnn_device_gpu,
+    cldnn_device_cpu,
+    cldnn_device_accelerator
+} cldnn_device_type;
+
 /// @brief Configuration parameters for created engine.
+/// @details device_type was appended after enable_memory_pool: binary layout of this structure changed and code passing it
+/// has to be rebuilt with this header (zero value selects GPU device, as before).
 typedef struct
 {
     uint32_t enable_profiling;                          ///< Enable per-primitive profiling.
@@ -159,6 +169,7 @@ typedef struct
     /*cldnn_priority_mode_type*/ int16_t priority_mode; ///< Priority mode (support of OpenCL priority hints in command queue).
     /*cldnn_throttle_mode_type*/ int16_t throttle_mode; ///< Throttle mode (support of throttle hints in command queue).
     uint32_t enable_memory_pool;                        ///< Enables memory usage optimization. memory objects will be reused when possible. 
+    /*cldnn_device_type*/ int16_t device_type;          ///< OpenCL device type the engine is created on. Vendor is checked only for GPU devices.
 }  cldnn_engine_configuration;
 
 /// @brief Information about the engine returned by cldnn_get_engine_info().
@@ -184,6 +195,22 @@ typedef struct
     uint8_t supports_imad;             ///< Does engine support int8 mad.
     uint8_t supports_immad;            ///< Does engine support int8 multi mad.
 }  cldnn_engine_info;
+
+/// @brief Compilation statistics of a single OpenCL program built by the engine, returned by cldnn_get_kernels_build_stats().
+/// @details Strings are stored in the names buffer passed to cldnn_get_kernels_build_stats(). Per-kernel source sizes
+/// are written to clDNN_build_stats.csv when sources dumping is enabled.
+typedef struct
+{
+    uint64_t bucket;                   ///< Offset (in chars) of the bucket key (build options and program labels) in the names buffer. The key is followed by '\0'.
+    uint64_t entry_points;             ///< Offset (in chars) of the entry points of the program in the names buffer. Each name is followed by '\0', empty name "\0" means end of the list.
+    uint32_t part;                     ///< Index of the part within the program bucket.
+    uint32_t kernels_count;            ///< Number of kernels (entry points) in the program.
+    uint64_t source_size;              ///< Size of the program source in bytes.
+    uint64_t jit_defines;              ///< Number of JIT definitions in the program source.
+    uint64_t build_time_us;            ///< Compilation time in microseconds.
+    uint64_t build_log_size;           ///< Size of the compiler log in bytes.
+    uint8_t succeeded;                 ///< Was the program built successfully.
+}  cldnn_kernels_build_info;
 /// @}
 
 /// @addtogroup c_network
@@ -213,7 +240,12 @@ typedef enum /*:int32_t*/
     cldnn_build_option_serialization,           ///< Specifies a name of files to which serialization should be dumped.
     cldnn_build_option_load_program,            ///< Specifies a name of load_program process.
     cldnn_build_option_learning_config,         ///< User defined learning parameters.
-    cldnn_build_option_detection_output_gpu     ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_detection_output_gpu,    ///< Run detection output layer always on GPU, regardless performance
+    cldnn_build_option_global_layout_assignment,///< Assign data layouts for the whole graph to minimize number of reorders.
+    cldnn_build_option_host_weights_reorder,    ///< Reorder weights to formats required by kernels on host during network build.
+    cldnn_build_option_updatable_data,          ///< Allow to update content of data primitives of a built network.
+    cldnn_build_option_lstm_sequence_fusion,    ///< Compute LSTM input GEMM for whole sequence and fuse recurrent GEMM with element-wise part.
+    cldnn_build_option_fuse_sibling_convolutions ///< Merge convolutions reading the same input into one convolution with crops of its output.
 } cldnn_build_option_type;
 
 /// @brief Tuning modes.
@@ -225,10 +257,14 @@ typedef enum /*:int32_t*/
 } cldnn_tuning_mode_type;
 
 /// @brief Tuning config.
+/// @details pruned_search and layer_time_budget_ms were appended after cache_file_path: code passing this struct
+/// has to be rebuilt with this header. Zero-initialized new fields keep the previous behavior (exhaustive search, no time limit).
 struct cldnn_tuning_config
 {
     const int32_t mode;             ///< #cldnn_tuning_mode_type.
     const char* cache_file_path;    ///< A path to the tuning cache file.
+    const int32_t pruned_search;            ///< Use pruned successive halving search instead of measuring all configurations (on-line tuning only, 0 - exhaustive search).
+    const uint32_t layer_time_budget_ms;    ///< On-line tuning time budget per layer in milliseconds, 0 means no limit.
 };
 
 /// @brief Learning params.
@@ -567,6 +603,19 @@ CLDNN_API int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cl
 /// @brief Returns max size of resources allocated using given engine
 CLDNN_API int64_t cldnn_get_max_used_device_memory_size(cldnn_engine engine, cldnn_status* status);
 
+/// @brief Returns compilation statistics of the most recent programs built by the engine.
+/// @details Statistics and names are taken from one snapshot. They are written only if both buffers are big enough,
+/// otherwise nothing is written and only the required sizes are returned. Programs may be built between two calls,
+/// so the call has to be repeated until the returned sizes fit the buffers.
+/// @param[in] stats Pointer to the array of @ref cldnn_kernels_build_info where information to be stored.
+/// @param[in] size Number of elements in the array of @ref cldnn_kernels_build_info.
+/// @param[in] names Pointer to user-allocated buffer to store bucket keys and entry points.
+/// @param[in] names_size Size (in chars) of the names buffer.
+/// @param[out] size_ret Number of elements of the snapshot.
+/// @param[out] names_size_ret Size (in chars) of the names of the snapshot.
+CLDNN_API void cldnn_get_kernels_build_stats(cldnn_engine engine, cldnn_kernels_build_info* stats, size_t size, char* names, size_t names_size,
+    size_t* size_ret, size_t* names_size_ret, cldnn_status* status);
+
 /// @addtogroup c_network
 /// @{
 
@@ -644,6 +693,13 @@ CLDNN_API                 void cldnn_release_network(cldnn_network network, cldn
 /// by calling this function before call to cldnn_execute_network().
 CLDNN_API                 void cldnn_set_network_input(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status);
 
+/// @brief Replaces content of @p data primitive of a network built with @p cldnn_build_option_updatable_data.
+/// @param[in] id Primitive @p id of @p data primitive defined in @p topology.
+/// @param[in] mem Memory object with new data which @p layout matches the layout of the @p data primitive.
+/// @details Build-time computations on the data (e.g. weights reorders) are replayed on new values, kernels are not recompiled.
+/// Content of the memory object given to the @p data primitive in @p topology is overwritten.
+CLDNN_API                 void cldnn_update_network_data(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status);
+
 /// @brief Sets learning rate for training primitives in network.
 /// @param[in] lr Learning rate.
 CLDNN_API void cldnn_set_learning_rate(cldnn_network network, float lr, cldnn_status* status);
@@ -666,6 +722,18 @@ CLDNN_API         cldnn_engine cldnn_get_network_engine(cldnn_network network, c
 /// @brief Returns @p program associated with the @p network.
 CLDNN_API        cldnn_program cldnn_get_network_program(cldnn_network network, cldnn_status* status);
 
+/// @brief Returns id of the @p network. Debug dumps (i.e. memory pool report) are named after it.
+CLDNN_API             uint32_t cldnn_get_network_id(cldnn_network network, cldnn_status* status);
+
+/// @brief Returns number of bytes which are not copied in the @p network thanks to in-place concatenations and crops.
+CLDNN_API               size_t cldnn_get_network_eliminated_copy_bytes(cldnn_network network, cldnn_status* status);
+
+/// @brief Returns number of primitives removed from the @p network as duplicates of other primitives.
+CLDNN_API               size_t cldnn_get_network_removed_duplicates(cldnn_network network, cldnn_status* status);
+
+/// @brief Returns number of bytes of outputs and constants of primitives removed from the @p network as duplicates.
+CLDNN_API               size_t cldnn_get_network_removed_duplicate_bytes(cldnn_network network, cldnn_status* status);
+
 /// @brief Returns names of network outputs.
 /// @details Function fills user provided buffer by primitive names. Each name is followed by '\0'.
 /// Empty name "\0\0" means end of data.
@@ -137,6 +137,11 @@ cldnn_activation_additional_params activation_params[3];
 cldnn_lstm_offset_order offset_order;
 /// @brief direction default = 0, bidirectional = 1.
 uint32_t direction;
+/// @brief Primitive id containing the previous value of the hidden data (Ht-1). Optional, requires @p recurrent.
+/// @details When specified, Ht-1*R^T is added to the input before element-wise operations, so the input contains only Xt*(W^T) + Wb.
+cldnn_primitive_id hidden;
+/// @brief Primitive id containing recurrent weight matrices for input, output, forget, and cell gates.
+cldnn_primitive_id recurrent;
 // NOT SUPPORTED YET
 // uint32_t output_sequence;
 CLDNN_END_PRIMITIVE_DESC(lstm_elt)
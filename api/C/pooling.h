@@ -42,7 +42,9 @@ typedef enum /*:int32_t*/
     /// @brief Maximum-pooling method with additional buffer to store argmax indices.
     cldnn_pooling_max_with_argmax,
     /// @brief Pooling with bilinear interpolation
-    cldnn_pooling_bilinear
+    cldnn_pooling_bilinear,
+    /// @brief ROI Align: average of bilinearly interpolated samples taken in each bin (ROI pooling only).
+    cldnn_pooling_roi_align
 } cldnn_pooling_mode;
 
 /// @brief Performs "pooling" operation which is a form of non-linear down-sampling.
@@ -47,6 +47,12 @@ extern "C" {
         uint32_t do_softmax;
     /// @brief Number of really used anchors
         uint32_t mask_size;
+    /// @brief Anchor (width, height) pairs in grid cells, for the anchors used by this layer (detection mode only).
+        cldnn_float_arr anchors;
+    /// @brief Detections with class probability not above this value are dropped (detection mode only).
+        float confidence_threshold;
+    /// @brief Capacity of the detection output, 0 keeps the regular tensor output.
+        uint32_t max_boxes;
     CLDNN_END_PRIMITIVE_DESC(region_yolo)
 
         CLDNN_DECLARE_PRIMITIVE_TYPE_ID(region_yolo);
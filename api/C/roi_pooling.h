@@ -44,6 +44,8 @@ float spatial_scale;
 
 /// @brief Group size as defined by PSRoIPooling when > 0, else if 0 means regular RoIPooling.
 int group_sz;
+/// @brief Number of samples per bin along each axis in roi_align mode, 0 means ceil(bin size).
+int sampling_ratio;
 CLDNN_END_PRIMITIVE_DESC(roi_pooling)
 
 CLDNN_DECLARE_PRIMITIVE_TYPE_ID(roi_pooling);
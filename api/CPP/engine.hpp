@@ -51,6 +51,14 @@ enum class throttle_mode_types : int16_t
     high = cldnn_throttle_high
 };
 
+/// @brief Defines available OpenCL device types
+enum class device_types : int16_t
+{
+    gpu = cldnn_device_gpu,
+    cpu = cldnn_device_cpu,
+    accelerator = cldnn_device_accelerator
+};
+
 /// @brief Configuration parameters for created engine.
 struct engine_configuration
 {
@@ -65,6 +73,7 @@ struct engine_configuration
     const priority_mode_types priority_mode;    ///< Priority mode (support of priority hints in command queue). If cl_khr_priority_hints extension is not supported by current OpenCL implementation, the value must be set to cldnn_priority_disabled.
     const throttle_mode_types throttle_mode;    ///< Placeholder for throttle mode (support of throttle hints in command queue). It has no effect for now and should be set to cldnn_throttle_disabled.
     bool enable_memory_pool;              ///< Enables memory usage optimization. memory objects will be reused when possible (switched off for older drivers then NEO).
+    const device_types device_type;             ///< OpenCL device type. Non-GPU devices (i.e. CPU runtime) are meant for host-side overhead measurements only.
 
     /// @brief Constructs engine configuration with specified options.
     /// @param profiling Enable per-primitive profiling.
@@ -83,7 +92,8 @@ struct engine_configuration
             const std::string& sources_dumps_dir = std::string(),
             priority_mode_types priority_mode = priority_mode_types::disabled,
             throttle_mode_types throttle_mode = throttle_mode_types::disabled,
-            bool memory_pool = true)
+            bool memory_pool = true,
+            device_types device_type = device_types::gpu)
         : enable_profiling(profiling)
         , meaningful_kernels_names(decorate_kernel_names)
         , dump_custom_program(dump_custom_program)
@@ -95,6 +105,7 @@ struct engine_configuration
         , priority_mode(priority_mode)
         , throttle_mode(throttle_mode)
         , enable_memory_pool(memory_pool)
+        , device_type(device_type)
     {}
 
     engine_configuration(const cldnn_engine_configuration& c_conf)
@@ -109,6 +120,7 @@ struct engine_configuration
         , priority_mode(static_cast<priority_mode_types>(c_conf.priority_mode))
         , throttle_mode(static_cast<throttle_mode_types>(c_conf.throttle_mode))
         , enable_memory_pool(c_conf.enable_memory_pool != 0)
+        , device_type(static_cast<device_types>(c_conf.device_type))
     {}
 
     /// @brief Implicit conversion to C API @ref ::cldnn_engine_configuration
@@ -125,7 +137,8 @@ struct engine_configuration
             sources_dumps_dir.c_str(),
             static_cast<int16_t>(priority_mode),
             static_cast<int16_t>(throttle_mode),
-            enable_memory_pool
+            enable_memory_pool,
+            static_cast<int16_t>(device_type)
         };
     }
 };
@@ -134,6 +147,21 @@ struct engine_configuration
 /// @details Look into @ref ::cldnn_engine_info for details.
 using engine_info = ::cldnn_engine_info;
 
+/// @brief Compilation statistics of a single OpenCL program built by the engine.
+/// @details Look into @ref ::cldnn_kernels_build_info for details.
+struct kernels_build_info
+{
+    std::string bucket;                     ///< Bucket key (build options and program labels).
+    std::vector<std::string> entry_points;  ///< Entry points of kernels in the program.
+    uint32_t part;                          ///< Index of the part within the program bucket.
+    uint32_t kernels_count;                 ///< Number of kernels (entry points) in the program.
+    uint64_t source_size;                   ///< Size of the program source in bytes.
+    uint64_t jit_defines;                   ///< Number of JIT definitions in the program source.
+    uint64_t build_time_us;                 ///< Compilation time in microseconds.
+    uint64_t build_log_size;                ///< Size of the compiler log in bytes.
+    bool succeeded;                         ///< Was the program built successfully.
+};
+
 /// @brief Represents clDNN engine object.
 struct engine
 {
@@ -224,6 +252,37 @@ struct engine
         });
     }
 
+    /// @brief Returns compilation statistics of the most recent programs built by the engine.
+    std::vector<kernels_build_info> get_kernels_build_stats() const
+    {
+        // programs may be built between the calls, so the query is repeated until the snapshot fits the buffers
+        std::vector<cldnn_kernels_build_info> stats;
+        std::vector<char> names;
+        size_t size_ret = 0;
+        size_t names_size_ret = 0;
+        do
+        {
+            stats.resize(size_ret);
+            names.resize(names_size_ret);
+            check_status<void>("get kernels build stats failed", [&](status_t* status)
+            {
+                cldnn_get_kernels_build_stats(_impl, stats.data(), stats.size(), names.data(), names.size(), &size_ret, &names_size_ret, status);
+            });
+        } while (size_ret > stats.size() || names_size_ret > names.size());
+
+        std::vector<kernels_build_info> result;
+        for (size_t i = 0; i < size_ret; i++)
+        {
+            const auto& info = stats[i];
+            std::vector<std::string> entry_points;
+            for (auto name = names.data() + info.entry_points; *name != 0; name += entry_points.back().size() + 1)
+                entry_points.emplace_back(name);
+            result.push_back({ names.data() + info.bucket, entry_points, info.part, info.kernels_count, info.source_size, info.jit_defines,
+                info.build_time_us, info.build_log_size, info.succeeded != 0 });
+        }
+        return result;
+    }
+
     /// @brief Returns type of the engine.
     engine_types get_type() const
     {
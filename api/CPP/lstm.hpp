@@ -191,6 +191,8 @@ struct lstm_gemm : public primitive_base<lstm_gemm, CLDNN_PRIMITIVE_DESC(lstm_ge
     /// @param input bias Primitive id containing bias data. Provide empty string if using lstm without bias.
     /// @param input hidden Primitive id containing hidden data. Provide empty string if using lstm without hidden values.
     /// @param direction default = 0, bidirectional = 1.
+    /// @details Without @p hidden, an input with sequence length (feature) greater than 1 is processed as a whole:
+    /// the output contains the input-to-hidden product for every time step.
     lstm_gemm(
         const primitive_id& id,
         const primitive_id& input,
@@ -269,6 +271,9 @@ struct lstm_elt : public primitive_base<lstm_elt, CLDNN_PRIMITIVE_DESC(lstm_elt)
     /// @param input_forget Provide 0 if using lstm without coupled input-forget gates.
     /// @param offset_order. Order of the concatenated weights, recurrent, and bias. ONNX default is iofz [input, output, forget, block].
     /// @param direction default = 0, bidirectional = 1.
+    /// @param output_padding Output padding.
+    /// @param hidden Primitive id containing the previous hidden data. Provide empty string if @p input already contains the recurrent term.
+    /// @param recurrent Primitive id containing recurrent data. Required if @p hidden is provided.
     lstm_elt(
         const primitive_id& id,
         const primitive_id& input,
@@ -279,7 +284,9 @@ struct lstm_elt : public primitive_base<lstm_elt, CLDNN_PRIMITIVE_DESC(lstm_elt)
         const std::vector<cldnn_activation_additional_params> activation_params = {},
         const cldnn_lstm_offset_order offset_order = cldnn_lstm_offset_order_iofz,
         const uint32_t direction = 0,
-        const padding& output_padding = padding()
+        const padding& output_padding = padding(),
+        const primitive_id& hidden = "",
+        const primitive_id& recurrent = ""
         )
         : primitive_base(id, {input}, output_padding)
         , cell(cell)
@@ -289,6 +296,8 @@ struct lstm_elt : public primitive_base<lstm_elt, CLDNN_PRIMITIVE_DESC(lstm_elt)
         , activation_params(activation_params)
         , offset_order(offset_order)
         , direction(direction)
+        , hidden(hidden)
+        , recurrent(recurrent)
     {
     }
 
@@ -302,6 +311,8 @@ struct lstm_elt : public primitive_base<lstm_elt, CLDNN_PRIMITIVE_DESC(lstm_elt)
 		, activation_params(dto->activation_params, std::end(dto->activation_params))
         , offset_order(dto->offset_order)
         , direction(dto->direction)
+        , hidden(dto->hidden)
+        , recurrent(dto->recurrent)
     {
     }
 
@@ -319,6 +330,10 @@ struct lstm_elt : public primitive_base<lstm_elt, CLDNN_PRIMITIVE_DESC(lstm_elt)
     cldnn_lstm_offset_order offset_order;
     /// @brief direction default = 0, bidirectional = 1.
     uint32_t direction;
+    /// @brief Primitive id containing the previous value of the hidden data. Its product with @p recurrent is added to the input.
+    primitive_id hidden;
+    /// @brief Primitive id containing recurrent data.
+    primitive_id recurrent;
 
 protected:
     std::vector<std::reference_wrapper<const primitive_id>> get_dependencies() const override
@@ -326,6 +341,10 @@ protected:
         std::vector<std::reference_wrapper<const primitive_id>> ret;
         if (!cell.empty())
             ret.push_back(cell);
+        if (!hidden.empty())
+            ret.push_back(hidden);
+        if (!recurrent.empty())
+            ret.push_back(recurrent);
         return ret;
     }
 
@@ -342,6 +361,8 @@ protected:
             std::copy_n(activation_params.begin(), 3, dto.activation_params);
         }
         dto.direction = direction;
+        dto.hidden = hidden.c_str();
+        dto.recurrent = recurrent.c_str();
     }
 };
 
@@ -118,12 +118,44 @@ struct network
         return check_status<cldnn_program>("get network program failed", [&](status_t* status) { return cldnn_get_network_program(_impl, status); });
     }
 
+    /// @brief Returns network id. Debug dumps (i.e. memory pool report) are named after it.
+    uint32_t get_id() const
+    {
+        return check_status<uint32_t>("get network id failed", [&](status_t* status) { return cldnn_get_network_id(_impl, status); });
+    }
+
+    /// @brief Returns number of bytes which are not copied thanks to in-place concatenations and crops.
+    size_t get_eliminated_copy_bytes() const
+    {
+        return check_status<size_t>("get eliminated copy bytes failed", [&](status_t* status) { return cldnn_get_network_eliminated_copy_bytes(_impl, status); });
+    }
+
+    /// @brief Returns number of primitives removed as duplicates of other primitives.
+    size_t get_removed_duplicates() const
+    {
+        return check_status<size_t>("get removed duplicates failed", [&](status_t* status) { return cldnn_get_network_removed_duplicates(_impl, status); });
+    }
+
+    /// @brief Returns number of bytes of outputs and constants of primitives removed as duplicates.
+    size_t get_removed_duplicate_bytes() const
+    {
+        return check_status<size_t>("get removed duplicate bytes failed", [&](status_t* status) { return cldnn_get_network_removed_duplicate_bytes(_impl, status); });
+    }
+
     /// @brief Provides @ref memory for @ref input_layout primitives defined by user in source @ref topology.
     void set_input_data(const primitive_id& id, const memory& mem) const
     {
         check_status<void>("set network input failed", [&](status_t* status) { cldnn_set_network_input(_impl, id.c_str(), mem.get(), status); });
     }
 
+    /// @brief Replaces content of @ref data primitive defined by user in source @ref topology.
+    /// @details Network has to be built with @ref build_option::updatable_data. Layout of @p mem has to match the layout
+    /// of the @ref data primitive. Weights reorders and other build-time computations on the data are replayed, compiled kernels are reused.
+    void update_data(const primitive_id& id, const memory& mem) const
+    {
+        check_status<void>("update network data failed", [&](status_t* status) { cldnn_update_network_data(_impl, id.c_str(), mem.get(), status); });
+    }
+
     /// @brief Sets learning rate for training primitives.
     void set_learning_rate(const float lr)
     {
@@ -40,7 +40,9 @@ enum class pooling_mode : int32_t
     /// @brief Maximum-pooling method with additional buffer to store argmax indices.
     max_with_argmax = cldnn_pooling_max_with_argmax,
     /// @brief Pooling with bilinear interpolation
-    bilinear = cldnn_pooling_bilinear
+    bilinear = cldnn_pooling_bilinear,
+    /// @brief ROI Align: average of bilinearly interpolated samples taken in each bin (ROI pooling only).
+    roi_align = cldnn_pooling_roi_align
 };
 
 /// @brief Performs "pooling" operation which is a form of non-linear down-sampling.
@@ -44,6 +44,21 @@ enum class build_option_type
     /// @brief Enable running detection output layer always on gpu, regardless performance
     detection_output_gpu = cldnn_build_option_detection_output_gpu,
 
+    /// @brief Enable data layout assignment for the whole graph instead of per-layer choice (default: false).
+    global_layout_assignment = cldnn_build_option_global_layout_assignment,
+
+    /// @brief Reorder weights on host instead of one-time GPU kernels (default: false).
+    host_weights_reorder = cldnn_build_option_host_weights_reorder,
+
+    /// @brief Allow to update content of data primitives of a built network (default: false).
+    updatable_data = cldnn_build_option_updatable_data,
+
+    /// @brief Compute input GEMM of LSTM for the whole sequence at once and fuse recurrent GEMM with element-wise part (default: true).
+    lstm_sequence_fusion = cldnn_build_option_lstm_sequence_fusion,
+
+    /// @brief Merge convolutions reading the same input into one convolution with crops of its output (default: false).
+    fuse_sibling_convolutions = cldnn_build_option_fuse_sibling_convolutions,
+
     /// @brief Enable debug mode (default: false).
     /// @details This option enforce all program primitives to be accessible as outputs.
     debug = cldnn_build_option_debug,
@@ -87,10 +102,16 @@ struct tuning_config_options
 {
     tuning_mode mode;
     std::string cache_file_path;
+    /// @brief Measure all configurations of all kernels (default) instead of pruned successive halving search (faster, may miss the best configuration).
+    bool exhaustive_search;
+    /// @brief On-line tuning time budget per layer in milliseconds, the fastest configuration found so far is used when exceeded (0 - no limit).
+    uint32_t layer_time_budget_ms;
 
     tuning_config_options() :
         mode(tuning_mode::tuning_disabled),
-        cache_file_path("")
+        cache_file_path(""),
+        exhaustive_search(true),
+        layer_time_budget_ms(0)
     {}
 };
 
@@ -118,6 +139,33 @@ struct build_option
     /// @brief Enable running detection output layer always on GPU, regardless performance (default: false).
     static std::shared_ptr<const build_option> detection_output_gpu(bool enable = false);
 
+    /// @brief Enable data layout assignment for the whole graph (default: false).
+    /// @details Formats of convolutions are chosen together with the reorders they require, so formats
+    /// are not switched back and forth between subsequent layers. Requires @ref optimize_data.
+    static std::shared_ptr<const build_option> global_layout_assignment(bool enable = false);
+
+    /// @brief Reorder weights to formats required by kernels on host during network build (default: false).
+    /// @details Weights reorders which are not supported on host (e.g. to images or Winograd domain) are still
+    /// executed as one-time GPU kernels.
+    static std::shared_ptr<const build_option> host_weights_reorder(bool enable = false);
+
+    /// @brief Allow to update content of data primitives of a built network with @ref network::update_data (default: false).
+    /// @details Original data and build-time computations on constants (weights reorders, constants propagation,
+    /// concatenation of weights of fused convolutions) are kept, so they can be replayed on new data without
+    /// rebuilding the program. Identical data primitives are not merged.
+    static std::shared_ptr<const build_option> updatable_data(bool enable = false);
+
+    /// @brief Compute input GEMM of LSTM for the whole sequence at once and fuse recurrent GEMM with element-wise part (default: true).
+    /// @details Applies to LSTM layers which inputs are consecutive parts of one tensor (e.g. outputs of @ref split along the sequence axis).
+    /// Otherwise LSTM is unrolled to separate GEMM and element-wise primitives for each time step.
+    static std::shared_ptr<const build_option> lstm_sequence_fusion(bool enable = true);
+
+    /// @brief Merge convolutions reading the same input into one convolution with crops of its output (default: false).
+    /// @details Crops are zero-copy only when the merged convolution runs in a plain format (bfyx, yxfb or byxf),
+    /// which is known after layouts are assigned, otherwise they copy their part of the output. Siblings which are
+    /// network outputs or are consumed only by a concatenation are not merged. Requires @ref optimize_data.
+    static std::shared_ptr<const build_option> fuse_sibling_convolutions(bool enable = false);
+
     /// @brief Enable debug mode (default: false).
     /// @details This option enforce all program primitives to be accessible as outputs.
     static std::shared_ptr<const build_option> debug(bool enable = false);
@@ -290,7 +338,7 @@ struct build_option_tuning_config : build_option
     /// @param tuning_config Configuration for the tuning.
     explicit build_option_tuning_config(const tuning_config_options& tuning_config) :
         config(tuning_config),
-        config_ref({ static_cast<int32_t>(config.mode), config.cache_file_path.c_str() })
+        config_ref({ static_cast<int32_t>(config.mode), config.cache_file_path.c_str(), !config.exhaustive_search, config.layer_time_budget_ms })
     {}
 
     /// @brief Constructs tuning config build option from C API @ref ::cldnn_build_option.
@@ -319,6 +367,8 @@ private:
         tuning_config_options result;
         result.mode = tuning_mode(refs->mode);
         result.cache_file_path = std::string(refs->cache_file_path);
+        result.exhaustive_search = refs->pruned_search == 0;
+        result.layer_time_budget_ms = refs->layer_time_budget_ms;
         return result;
     }
 };
@@ -478,6 +528,56 @@ namespace detail
             return std::make_shared<object_type>(option);
         }
     };
+    template<> struct build_option_traits<build_option_type::global_layout_assignment>
+    {
+        typedef build_option_bool<build_option_type::global_layout_assignment> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::global_layout_assignment(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_global_layout_assignment);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::host_weights_reorder>
+    {
+        typedef build_option_bool<build_option_type::host_weights_reorder> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::host_weights_reorder(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_host_weights_reorder);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::updatable_data>
+    {
+        typedef build_option_bool<build_option_type::updatable_data> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::updatable_data(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_updatable_data);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::lstm_sequence_fusion>
+    {
+        typedef build_option_bool<build_option_type::lstm_sequence_fusion> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::lstm_sequence_fusion(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_lstm_sequence_fusion);
+            return std::make_shared<object_type>(option);
+        }
+    };
+    template<> struct build_option_traits<build_option_type::fuse_sibling_convolutions>
+    {
+        typedef build_option_bool<build_option_type::fuse_sibling_convolutions> object_type;
+        static std::shared_ptr<const build_option> make_default() { return build_option::fuse_sibling_convolutions(); }
+        static std::shared_ptr<const build_option> make_option(const cldnn_build_option& option)
+        {
+            assert(option.type == cldnn_build_option_fuse_sibling_convolutions);
+            return std::make_shared<object_type>(option);
+        }
+    };
     template<> struct build_option_traits<build_option_type::debug>
     {
         typedef build_option_bool<build_option_type::debug> object_type;
@@ -568,6 +668,31 @@ inline std::shared_ptr<const build_option> build_option::detection_output_gpu(bo
     return std::make_shared<build_option_bool<build_option_type::detection_output_gpu>>(enable);
 }
 
+inline std::shared_ptr<const build_option> build_option::global_layout_assignment(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::global_layout_assignment>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::host_weights_reorder(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::host_weights_reorder>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::updatable_data(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::updatable_data>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::lstm_sequence_fusion(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::lstm_sequence_fusion>>(enable);
+}
+
+inline std::shared_ptr<const build_option> build_option::fuse_sibling_convolutions(bool enable)
+{
+    return std::make_shared<build_option_bool<build_option_type::fuse_sibling_convolutions>>(enable);
+}
+
 inline std::shared_ptr<const build_option> build_option::debug(bool enable)
 {
     return std::make_shared<build_option_bool<build_option_type::debug>>(enable);
@@ -691,6 +816,16 @@ private:
             return detail::build_option_traits<build_option_type::optimize_data>::make_option(option);
         case cldnn_build_option_detection_output_gpu:
             return detail::build_option_traits<build_option_type::detection_output_gpu>::make_option(option);
+        case cldnn_build_option_global_layout_assignment:
+            return detail::build_option_traits<build_option_type::global_layout_assignment>::make_option(option);
+        case cldnn_build_option_host_weights_reorder:
+            return detail::build_option_traits<build_option_type::host_weights_reorder>::make_option(option);
+        case cldnn_build_option_updatable_data:
+            return detail::build_option_traits<build_option_type::updatable_data>::make_option(option);
+        case cldnn_build_option_lstm_sequence_fusion:
+            return detail::build_option_traits<build_option_type::lstm_sequence_fusion>::make_option(option);
+        case cldnn_build_option_fuse_sibling_convolutions:
+            return detail::build_option_traits<build_option_type::fuse_sibling_convolutions>::make_option(option);
         case cldnn_build_option_debug:
             return detail::build_option_traits<build_option_type::debug>::make_option(option);
         case cldnn_build_option_outputs:
@@ -56,6 +56,40 @@ namespace cldnn
             , num(num)
             , mask_size(mask_size)
             , do_softmax(do_softmax)
+            , confidence_threshold(0.f)
+            , max_boxes(0)
+        {}
+
+        /// @brief Constructs region_yolo primitive which also decodes the boxes (detection mode).
+        /// @details Output has the layout of @ref detection_output: one row of [image_id, label, confidence, xmin, ymin, xmax, ymax]
+        /// for every class of every box with probability above @p confidence_threshold, in normalized coordinates.
+        /// Rows are not ordered and not suppressed (no NMS). Unused rows have image_id -1, detections beyond @p max_boxes are dropped.
+        /// @param anchors Anchor (width, height) pairs in grid cells (pixel anchors divided by the stride of the layer),
+        /// num pairs when @p do_softmax is set, else mask_size pairs.
+        /// @param confidence_threshold Minimal class probability (objectness * class score) of a detection.
+        /// @param max_boxes Number of rows of the output.
+        region_yolo(
+            const primitive_id& id,
+            const primitive_id& input,
+            const uint32_t coords,
+            const uint32_t classes,
+            const uint32_t num,
+            const uint32_t mask_size,
+            const bool do_softmax,
+            const std::vector<float>& anchors,
+            const float confidence_threshold,
+            const uint32_t max_boxes,
+            const padding& output_padding = padding()
+        )
+            :primitive_base(id, { input }, output_padding)
+            , coords(coords)
+            , classes(classes)
+            , num(num)
+            , mask_size(mask_size)
+            , do_softmax(do_softmax)
+            , anchors(anchors)
+            , confidence_threshold(confidence_threshold)
+            , max_boxes(max_boxes)
         {}
 
         /// @brief Constructs a copy from C API @CLDNN_PRIMITIVE_DESC{region_yolo}
@@ -66,6 +100,9 @@ namespace cldnn
             , num(dto->num)
             , mask_size(dto->mask_size)
             , do_softmax(dto->do_softmax != 0)
+            , anchors(dto->anchors.data, dto->anchors.data + dto->anchors.size)
+            , confidence_threshold(dto->confidence_threshold)
+            , max_boxes(dto->max_boxes)
         {}
 
         /// @brief Defines a scope of a region yolo normalization
@@ -76,6 +113,12 @@ namespace cldnn
         uint32_t num;
         uint32_t mask_size;
         bool do_softmax;
+        /// @brief Anchor (width, height) pairs in grid cells (detection mode only).
+        std::vector<float> anchors;
+        /// @brief Minimal class probability of a detection (detection mode only).
+        float confidence_threshold;
+        /// @brief Number of rows of the detection output, 0 keeps the regular tensor output.
+        uint32_t max_boxes;
 
 
     private:
@@ -86,6 +129,9 @@ namespace cldnn
             dto.num = num;
             dto.mask_size = mask_size;
             dto.do_softmax = do_softmax;
+            dto.anchors = { anchors.data(), anchors.size() };
+            dto.confidence_threshold = confidence_threshold;
+            dto.max_boxes = max_boxes;
         }
     };
     /// @}
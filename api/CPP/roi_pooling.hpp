@@ -43,7 +43,8 @@ struct roi_pooling : public primitive_base<roi_pooling, CLDNN_PRIMITIVE_DESC(roi
         int pooled_height,
         float spatial_scale,
         int group_sz = 0,
-        const padding& output_padding = padding()
+        const padding& output_padding = padding(),
+        int sampling_ratio = 0
         )
         : primitive_base(id, {input_data, input_rois}, output_padding)
         , mode(mode)
@@ -51,6 +52,7 @@ struct roi_pooling : public primitive_base<roi_pooling, CLDNN_PRIMITIVE_DESC(roi
         , pooled_height(pooled_height)
         , spatial_scale(spatial_scale)
         , group_sz(group_sz)
+        , sampling_ratio(sampling_ratio)
     {}
 
     roi_pooling(const dto* dto)
@@ -60,6 +62,7 @@ struct roi_pooling : public primitive_base<roi_pooling, CLDNN_PRIMITIVE_DESC(roi
         , pooled_height(dto->pooled_height)
         , spatial_scale(dto->spatial_scale)
         , group_sz(dto->group_sz)
+        , sampling_ratio(dto->sampling_ratio)
     {}
 
     pooling_mode mode;
@@ -67,6 +70,7 @@ struct roi_pooling : public primitive_base<roi_pooling, CLDNN_PRIMITIVE_DESC(roi
     int pooled_height;
     float spatial_scale;
     int group_sz;
+    int sampling_ratio;
 
 protected:
     void update_dto(dto& dto) const override
@@ -76,6 +80,7 @@ protected:
         dto.pooled_height = pooled_height;
         dto.spatial_scale = spatial_scale;
         dto.group_sz = group_sz;
+        dto.sampling_ratio = sampling_ratio;
     }
 };
 
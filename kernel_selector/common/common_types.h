@@ -65,7 +65,8 @@ namespace kernel_selector
         BROADCAST,
         GEMM,
         INDEX_SELECT,
- 		DETECTION_OUTPUT    
+ 		DETECTION_OUTPUT,
+        FUSED_OPS
 	};
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -135,7 +136,8 @@ namespace kernel_selector
         MAX,
         AVG,
         MAX_WITH_ARGMAX,
-        BILINEAR
+        BILINEAR,
+        ROI_ALIGN
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -248,6 +250,16 @@ namespace kernel_selector
         ASSIGN
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FusedOpType
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    enum class FusedOpType
+    {
+        ACTIVATION,
+        SCALE,
+        ELTWISE,
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // EltwiseInputMode
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
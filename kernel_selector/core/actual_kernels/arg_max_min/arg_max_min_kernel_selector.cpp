@@ -18,6 +18,7 @@
 #include "arg_max_min_kernel_gpu_ref.h"
 #include "arg_max_min_kernel_opt.h"
 #include "arg_max_min_kernel_axis.h"
+#include "arg_max_min_kernel_top_k.h"
 
 namespace kernel_selector {
 
@@ -26,6 +27,7 @@ namespace kernel_selector {
 		Attach<ArgMaxMinKernelGPURef>();
         //Attach<ArgMaxMinKernelOpt>(); not yet implemented
         Attach<ArgMaxMinKernelAxis>();
+        Attach<ArgMaxMinKernelTopK>();
     }
 
 	KernelsData arg_max_min_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
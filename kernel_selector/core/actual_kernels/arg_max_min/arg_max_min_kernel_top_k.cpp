@@ -0,0 +1,149 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "arg_max_min_kernel_top_k.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // below this K the single pass per K of the other kernels is cheaper than sorting
+        const uint32_t top_k_threshold = 16;
+        const size_t max_lws = 256;
+
+        size_t GetValuesNum(const arg_max_min_params& params)
+        {
+            const auto& input = params.inputs[0];
+            switch (params.argMaxMinAxis)
+            {
+            case ArgMaxMinAxis::BATCH:      return input.Batch().v;
+            case ArgMaxMinAxis::FEATURE:    return input.Feature().v;
+            case ArgMaxMinAxis::Y:          return input.Y().v;
+            case ArgMaxMinAxis::X:          return input.X().v;
+            default:                        return input.Feature().v * input.Y().v * input.X().v;
+            }
+        }
+
+        size_t GetSetsNum(const arg_max_min_params& params)
+        {
+            return params.inputs[0].LogicalSize() / GetValuesNum(params);
+        }
+
+        size_t RoundUpToPowerOfTwo(size_t v)
+        {
+            size_t p = 1;
+            while (p < v)
+                p *= 2;
+            return p;
+        }
+
+        // number of (float value, uint index) pairs sorted at once
+        size_t GetSortSize(const arg_max_min_params& params)
+        {
+            size_t capacity = 1;
+            while (capacity * 2 * (sizeof(float) + sizeof(uint32_t)) <= params.engineInfo.maxLocalMemSize)
+                capacity *= 2;
+
+            return std::min(capacity, RoundUpToPowerOfTwo(GetValuesNum(params)));
+        }
+
+        // each work-item compares and exchanges at least one pair per sorting step
+        size_t GetLocalSize(const arg_max_min_params& params)
+        {
+            const size_t pairs = std::max<size_t>(GetSortSize(params) / 2, 1);
+            return std::min(pairs, std::min(max_lws, params.engineInfo.maxWorkGroupSize));
+        }
+    }
+
+    ParamsKey ArgMaxMinKernelTopK::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::F32);  //We support only f32, look into arg_max_min.hpp for more informations.
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableArgMaxMinAxis(ArgMaxMinAxis::XYF);
+        k.EnableArgMaxMinAxis(ArgMaxMinAxis::BATCH);
+        k.EnableArgMaxMinAxis(ArgMaxMinAxis::X);
+        k.EnableArgMaxMinAxis(ArgMaxMinAxis::Y);
+        k.EnableArgMaxMinAxis(ArgMaxMinAxis::FEATURE);
+        k.EnableDifferentTypes();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ArgMaxMinKernelTopK::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!ArgMaxMinKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const arg_max_min_params& params = static_cast<const arg_max_min_params&>(p);
+
+        if (params.topK == 0 || params.topK > GetValuesNum(params))
+        {
+            return false;
+        }
+
+        // every merge pass has to bring in at least as many new values as it keeps
+        const size_t sort_size = GetSortSize(params);
+        return sort_size >= GetValuesNum(params) || 2 * params.topK <= sort_size;
+    }
+
+    JitConstants ArgMaxMinKernelTopK::GetJitConstants(const arg_max_min_params& params) const
+    {
+        auto jit = ArgMaxMinKernelBase::GetJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("SORT_SIZE", GetSortSize(params)),
+            MakeJitConstant("VALUES_NUM", GetValuesNum(params)),
+            MakeJitConstant("LWS", GetLocalSize(params)),
+        });
+
+        return jit;
+    }
+
+    ArgMaxMinKernelBase::DispatchData ArgMaxMinKernelTopK::SetDefault(const arg_max_min_params& params) const
+    {
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        // one work-group per reduced set
+        kd.lws0 = GetLocalSize(params);
+        kd.lws1 = 1;
+        kd.lws2 = 1;
+
+        kd.gws0 = kd.lws0 * GetSetsNum(params);
+        kd.gws1 = 1;
+        kd.gws2 = 1;
+
+        return kd;
+    }
+
+    KernelsData ArgMaxMinKernelTopK::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const arg_max_min_params& orgParams = static_cast<const arg_max_min_params&>(params);
+
+        return GetCommonKernelsData(params, options, orgParams.topK >= top_k_threshold ? FORCE_PRIORITY_7 : DONT_USE_IF_HAVE_SOMETHING_ELSE);
+    }
+}
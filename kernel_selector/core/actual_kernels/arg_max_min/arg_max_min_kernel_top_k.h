@@ -0,0 +1,37 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "arg_max_min_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Top-K by bitonic sort of (value, index) pairs in local memory: one work-group per reduced set, sets bigger
+    // than the local buffer are merged chunk by chunk with the best TOP_K pairs kept at the front of the buffer.
+    class ArgMaxMinKernelTopK : public ArgMaxMinKernelBase
+    {
+    public:
+        ArgMaxMinKernelTopK() : ArgMaxMinKernelBase("arg_max_min_top_k") {}
+        virtual ~ArgMaxMinKernelTopK() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        virtual bool Validate(const Params& p, const optional_params& o) const override;
+        virtual JitConstants GetJitConstants(const arg_max_min_params& params) const override;
+        virtual DispatchData SetDefault(const arg_max_min_params& params) const override;
+    };
+}
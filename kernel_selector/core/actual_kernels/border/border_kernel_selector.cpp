@@ -15,12 +15,14 @@
 
 #include "border_kernel_selector.h"
 #include "border_kernel_ref.h"
+#include "border_kernel_vectorized.h"
 
 namespace kernel_selector 
 {
     border_kernel_selector::border_kernel_selector()
     {
         Attach<BorderKernelRef>();
+        Attach<BorderKernelVectorized>();
     }
 
     KernelsData border_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -20,13 +20,13 @@
 
 namespace kernel_selector 
 {
-    JitConstants BroadcastKernelBase::GetJitConstants(const broadcast_params& params)
+    JitConstants BroadcastKernelBase::GetJitConstants(const broadcast_params& params) const
     {
         JitConstants jit = MakeBaseParamsJitConstants(params);
         return jit;
     }
 
-    BroadcastKernelBase::DispatchData BroadcastKernelBase::SetDefault(const broadcast_params& params)
+    BroadcastKernelBase::DispatchData BroadcastKernelBase::SetDefault(const broadcast_params& params) const
     {
         const auto& output = params.output;
 
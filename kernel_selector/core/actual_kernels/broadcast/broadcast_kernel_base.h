@@ -53,8 +53,8 @@ namespace kernel_selector
         using DispatchData = CommonDispatchData;
 
     protected:
-        static JitConstants GetJitConstants(const broadcast_params& params);
-        static DispatchData SetDefault(const broadcast_params& params);
+        virtual JitConstants GetJitConstants(const broadcast_params& params) const;
+        virtual DispatchData SetDefault(const broadcast_params& params) const;
         KernelsData GetCommonKernelsData(const Params& params, const optional_params&, float estimated_time) const;
     };
 }
@@ -15,12 +15,14 @@
 
 #include "broadcast_kernel_selector.h"
 #include "broadcast_kernel_ref.h"
+#include "broadcast_kernel_vectorized.h"
 
 namespace kernel_selector 
 {
     broadcast_kernel_selector::broadcast_kernel_selector()
     {
         Attach<BroadcastKernelRef>();
+        Attach<BroadcastKernelVectorized>();
     }
 
     KernelsData broadcast_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -0,0 +1,81 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "broadcast_kernel_vectorized.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+
+namespace kernel_selector
+{
+    static const size_t vec_size = 8;
+
+    ParamsKey BroadcastKernelVectorized::GetSupportedKey() const
+    {
+        ParamsKey k;
+
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::UINT8);
+
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::UINT8);
+
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+
+        return k;
+    }
+
+    JitConstants BroadcastKernelVectorized::GetJitConstants(const broadcast_params& params) const
+    {
+        JitConstants jit = BroadcastKernelBase::GetJitConstants(params);
+        jit.AddConstant(MakeJitConstant("VEC_SIZE", vec_size));
+        return jit;
+    }
+
+    BroadcastKernelBase::DispatchData BroadcastKernelVectorized::SetDefault(const broadcast_params& params) const
+    {
+        const auto& output = params.output;
+
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        std::vector<size_t> global{CeilDiv(output.X().v, vec_size), output.Y().v, output.Batch().v * output.Feature().v};
+        const auto& local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    KernelsData BroadcastKernelVectorized::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_7);
+    }
+}
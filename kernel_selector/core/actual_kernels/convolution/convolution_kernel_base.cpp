@@ -248,6 +248,8 @@ namespace kernel_selector
         auto& kernel = kd.kernels[0];
         FillCLKernelData(kernel, runInfo, params.engineInfo, finalKernelName, jit, entryPoint, exeMode, true, !newParams.bias.empty(), 1, newParams.int8_quantization, newParams.output_calibration);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::SPLIT, 0 });
+        const auto fusedOpsArgs = GetFusedOpsArgsDesc(newParams);
+        kernel.arguments.insert(kernel.arguments.end(), fusedOpsArgs.begin(), fusedOpsArgs.end());
 
         kd.estimatedTime = runInfo.effiency;
         kd.autoTuneIndex = autoTuneIndex;
@@ -40,6 +40,7 @@ namespace kernel_selector {
         k.EnableNonBiasTerm();
         k.EnableBatching();
         k.EnableSplitSupport();
+        k.EnableFusedOps();
         k.EnableDepthwiseSeparableOpt();
         return k;
     }
@@ -38,6 +38,7 @@ namespace kernel_selector
         k.EnableNonBiasTerm();
         k.EnableBatching();
         k.EnableSplitSupport();
+        k.EnableFusedOps();
         return k;
     }
 
@@ -67,6 +67,7 @@ namespace kernel_selector
         k.EnableNonBiasTerm();
         k.EnableBatching();
         k.EnableSplitSupport();
+        k.EnableFusedOps();
         k.EnableDilation();
         k.EnableTranspose();
         return k;
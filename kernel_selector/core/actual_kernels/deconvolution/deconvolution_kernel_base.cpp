@@ -41,7 +41,7 @@ namespace kernel_selector
         return s.str();
     }
 
-    JitConstants DeconvolutionKernelBase::GetJitConstants(const deconvolution_params& dp) const
+    JitConstants DeconvolutionKernelBase::GetJitConstants(const deconvolution_params& dp, const DispatchData&) const
     {
         JitConstants jit = WeightBiasKernelBase::GetJitConstants(dp);
         const auto& padding = dp.padding;
@@ -63,7 +63,7 @@ namespace kernel_selector
         return jit;
     }
 
-    DeconvolutionKernelBase::DispatchData DeconvolutionKernelBase::SetDefault(const deconvolution_params& params) const
+    DeconvolutionKernelBase::DispatchData DeconvolutionKernelBase::SetDefault(const deconvolution_params& params, int) const
     {
         auto batch_size = params.output.Batch().v;
         auto output_features = params.output.Feature().v;
@@ -87,27 +87,35 @@ namespace kernel_selector
         return kd;
     }
 
-    KernelsData DeconvolutionKernelBase::GetKernelsData(const Params& params, const optional_params& options) const
+    std::vector<WeightsLayout> DeconvolutionKernelBase::GetSupportedWeightLayouts(const deconvolution_params&) const
     {
-        assert(params.GetType() == KernelType::DECONVOLUTION);
-
-        const deconvolution_params& orgParams = static_cast<const deconvolution_params&>(params);
-
-        const std::vector<WeightsLayout> weightsLayouts = {
+        return {
             WeightsLayout::oiyx,
             WeightsLayout::iyxo,
             WeightsLayout::yxio,
             WeightsLayout::oyxi
         };
+    }
+
+    KernelsData DeconvolutionKernelBase::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, -1);
+    }
+
+    KernelsData DeconvolutionKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, int autoTuneIndex) const
+    {
+        assert(params.GetType() == KernelType::DECONVOLUTION);
+
+        const deconvolution_params& orgParams = static_cast<const deconvolution_params&>(params);
 
-        DispatchData runInfo = SetDefault(orgParams);
+        DispatchData runInfo = SetDefault(orgParams, autoTuneIndex);
         KernelData kd = KernelData::Default<deconvolution_params>(params);
         deconvolution_params& newParams = *static_cast<deconvolution_params*>(kd.params.get());
 
         bool succeed = UpdateWeightsParams(
             newParams,
             options,
-            weightsLayouts,
+            GetSupportedWeightLayouts(orgParams),
             kd.weightsReorderParams);
 
         if (!succeed)
@@ -115,7 +123,7 @@ namespace kernel_selector
             return{};
         }
 
-        auto cldnn_jit = GetJitConstants(newParams);
+        auto cldnn_jit = GetJitConstants(newParams, runInfo);
         auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
         auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
 
@@ -126,6 +134,7 @@ namespace kernel_selector
             kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 1 });
 
         kd.estimatedTime = runInfo.effiency;
+        kd.autoTuneIndex = autoTuneIndex;
 
         return{ kd };
     }
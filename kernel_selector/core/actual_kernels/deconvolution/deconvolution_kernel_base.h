@@ -79,11 +79,17 @@ namespace kernel_selector
         using WeightBiasKernelBase::WeightBiasKernelBase;
         virtual ~DeconvolutionKernelBase() {}
 
-        using DispatchData = CommonDispatchData;
+        struct DispatchData : public CommonDispatchData
+        {
+            size_t ofmBlock = 1;
+            size_t xBlock = 1;
+        };
     
     protected:
         virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const;
-        virtual JitConstants GetJitConstants(const deconvolution_params& params) const;
-        virtual DispatchData SetDefault(const deconvolution_params& params) const;
+        virtual JitConstants GetJitConstants(const deconvolution_params& params, const DispatchData& kd) const;
+        virtual DispatchData SetDefault(const deconvolution_params& params, int autoTuneIndex = -1) const;
+        virtual std::vector<WeightsLayout> GetSupportedWeightLayouts(const deconvolution_params& params) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& options, int autoTuneIndex) const;
     };
 }
\ No newline at end of file
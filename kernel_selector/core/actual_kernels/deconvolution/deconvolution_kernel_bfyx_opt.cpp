@@ -42,7 +42,7 @@ namespace kernel_selector
         return k;
     }
 
-    CommonDispatchData DeconvolutionKernel_bfyx_opt::SetDefault(const deconvolution_params& params) const
+    DeconvolutionKernelBase::DispatchData DeconvolutionKernel_bfyx_opt::SetDefault(const deconvolution_params& params, int) const
     {
         DispatchData kd;
 
@@ -29,6 +29,6 @@ namespace kernel_selector {
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
-        CommonDispatchData SetDefault(const deconvolution_params& params) const override;
+        DispatchData SetDefault(const deconvolution_params& params, int autoTuneIndex = -1) const override;
     };
 }
\ No newline at end of file
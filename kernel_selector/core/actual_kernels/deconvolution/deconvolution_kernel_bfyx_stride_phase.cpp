@@ -0,0 +1,201 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "deconvolution_kernel_bfyx_stride_phase.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector 
+{
+    namespace
+    {
+        // outputs of one stride phase along x
+        size_t GetPhaseWidth(const deconvolution_params& params)
+        {
+            return CeilDiv(params.output.X().v, params.stride.x);
+        }
+    }
+
+    DeconvolutionKernel_bfyx_stride_phase::DeconvolutionKernel_bfyx_stride_phase() : DeconvolutionKernelBase("deconvolution_gpu_bfyx_stride_phase")
+    {
+        // Generate the dispatch options to the auto-tuner.
+        const std::vector<size_t> ofmBlockSizes = { 1, 2, 4, 8 };
+        const std::vector<size_t> xBlockSizes = { 1, 2, 4, 8 };
+
+        for (auto ofmBlock : ofmBlockSizes)
+        {
+            for (auto xBlock : xBlockSizes)
+            {
+                autoTuneOptions.emplace_back(AutoTuneOption{ ofmBlock, xBlock });
+            }
+        }
+    }
+
+    ParamsKey DeconvolutionKernel_bfyx_stride_phase::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBiasPerFeature();
+        k.EnableNonBiasTerm();
+        k.EnableBatching();
+        k.EnableSplitSupport();
+        return k;
+    }
+
+    bool DeconvolutionKernel_bfyx_stride_phase::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!DeconvolutionKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const deconvolution_params&>(p);
+
+        // blocks of the same phase are contiguous only in unit-dilation input
+        return params.dilation.x == 1 && params.dilation.y == 1;
+    }
+
+    bool DeconvolutionKernel_bfyx_stride_phase::IsOptionSupported(const deconvolution_params& params, const AutoTuneOption& option) const
+    {
+        // a work-item never covers output features of two splits
+        if (params.weights.OFM().v % option.ofmBlock != 0)
+            return false;
+
+        // blocks wider than the phase would only compute outputs that are dropped
+        return option.xBlock == 1 || GetPhaseWidth(params) >= option.xBlock;
+    }
+
+    DeconvolutionKernel_bfyx_stride_phase::AutoTuneOption DeconvolutionKernel_bfyx_stride_phase::GetAutoTuneOptions(const deconvolution_params& params, int autoTuneIndex) const
+    {
+        if ((autoTuneIndex >= 0) && (autoTuneIndex < (int)autoTuneOptions.size()))
+        {
+            return autoTuneOptions[autoTuneIndex];
+        }
+
+        // Heuristic: the widest feature block that divides the output features and 4 outputs along x,
+        // which keeps 32 accumulators per work-item at most.
+        AutoTuneOption option = { 1, 1 };
+        for (size_t ofmBlock : { 8, 4, 2 })
+        {
+            if (params.weights.OFM().v % ofmBlock == 0)
+            {
+                option.ofmBlock = ofmBlock;
+                break;
+            }
+        }
+
+        const size_t phaseWidth = GetPhaseWidth(params);
+        option.xBlock = phaseWidth >= 16 ? 4 : phaseWidth >= 4 ? 2 : 1;
+
+        return option;
+    }
+
+    DeconvolutionKernelBase::DispatchData DeconvolutionKernel_bfyx_stride_phase::SetDefault(const deconvolution_params& params, int autoTuneIndex) const
+    {
+        const auto option = GetAutoTuneOptions(params, autoTuneIndex);
+        const auto& out = params.output;
+
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+        kd.ofmBlock = option.ofmBlock;
+        kd.xBlock = option.xBlock;
+
+        std::vector<size_t> global = {
+            params.stride.x * CeilDiv(GetPhaseWidth(params), option.xBlock),
+            out.Y().v,
+            out.Batch().v * (params.weights.OFM().v / option.ofmBlock)
+        };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        kd.effiency = FORCE_PRIORITY_4;
+
+        return kd;
+    }
+
+    JitConstants DeconvolutionKernel_bfyx_stride_phase::GetJitConstants(const deconvolution_params& params, const DispatchData& kd) const
+    {
+        auto jit = DeconvolutionKernelBase::GetJitConstants(params, kd);
+
+        jit.AddConstants({
+            MakeJitConstant("OFM_BLOCK", kd.ofmBlock),
+            MakeJitConstant("X_BLOCK", kd.xBlock),
+            MakeJitConstant("OFM_BLOCKS_NUM", params.weights.OFM().v / kd.ofmBlock),
+            MakeJitConstant("X_BLOCKS_NUM", CeilDiv(GetPhaseWidth(params), kd.xBlock)),
+        });
+
+        return jit;
+    }
+
+    KernelsData DeconvolutionKernel_bfyx_stride_phase::GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const auto& prim_params = static_cast<const deconvolution_params&>(params);
+        if (!IsOptionSupported(prim_params, GetAutoTuneOptions(prim_params, autoTuneIndex)))
+        {
+            return{};
+        }
+
+        return GetCommonKernelsData(params, options, autoTuneIndex);
+    }
+
+    KernelsData DeconvolutionKernel_bfyx_stride_phase::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetTunedKernelsDataByIndex(params, options, -1);
+    }
+
+    KernelsData DeconvolutionKernel_bfyx_stride_phase::GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        KernelsData res = {};
+
+        for (size_t i = 0; i < autoTuneOptions.size(); i++)
+        {
+            KernelsData kd = GetTunedKernelsDataByIndex(params, options, (int)i);
+            if (!kd.empty())
+            {
+                res.emplace_back(kd[0]);
+            }
+        }
+
+        return res;
+    }
+}
@@ -0,0 +1,54 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "deconvolution_kernel_base.h"
+
+namespace kernel_selector {
+
+    // Strided deconvolution computed as STRIDE_X * STRIDE_Y dense convolutions, one per output stride phase.
+    // Work-item accumulates X_BLOCK outputs of a phase for OFM_BLOCK output features in registers.
+    class DeconvolutionKernel_bfyx_stride_phase : public DeconvolutionKernelBase
+    {
+    public:
+        DeconvolutionKernel_bfyx_stride_phase();
+        virtual ~DeconvolutionKernel_bfyx_stride_phase() {}
+
+        virtual ParamsKey GetSupportedKey() const override;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual KernelsData GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const override;
+        virtual KernelsData GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex) const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        DispatchData SetDefault(const deconvolution_params& params, int autoTuneIndex = -1) const override;
+        JitConstants GetJitConstants(const deconvolution_params& params, const DispatchData& kd) const override;
+        std::vector<WeightsLayout> GetSupportedWeightLayouts(const deconvolution_params&) const override { return{ WeightsLayout::yxio }; }
+
+    private:
+        struct AutoTuneOption
+        {
+            size_t ofmBlock;
+            size_t xBlock;
+        };
+
+        AutoTuneOption GetAutoTuneOptions(const deconvolution_params& params, int autoTuneIndex) const;
+        bool IsOptionSupported(const deconvolution_params& params, const AutoTuneOption& option) const;
+
+        std::vector<AutoTuneOption> autoTuneOptions = {};
+    };
+}
@@ -42,12 +42,13 @@ namespace kernel_selector
         k.EnableSplitSupport();
         k.EnableDepthwiseSeparableOpt();
         k.EnableGradient();
+        k.DisableTuning();
         return k;
     }
 
-    CommonDispatchData DeconvolutionKernelRef::SetDefault(const deconvolution_params& params) const
+    DeconvolutionKernelBase::DispatchData DeconvolutionKernelRef::SetDefault(const deconvolution_params& params, int autoTuneIndex) const
     {
-        CommonDispatchData runInfo = DeconvolutionKernelBase::SetDefault(params);
+        DispatchData runInfo = DeconvolutionKernelBase::SetDefault(params, autoTuneIndex);
 
         if (params.output.Feature().v * params.output.Batch().v <= 16)
         {
@@ -64,9 +65,9 @@ namespace kernel_selector
         return runInfo;
     }
 
-    JitConstants DeconvolutionKernelRef::GetJitConstants(const deconvolution_params& params) const
+    JitConstants DeconvolutionKernelRef::GetJitConstants(const deconvolution_params& params, const DispatchData& kd) const
     {
-        auto jit = DeconvolutionKernelBase::GetJitConstants(params);
+        auto jit = DeconvolutionKernelBase::GetJitConstants(params, kd);
 
         if (params.output.Feature().v * params.output.Batch().v <= 16)
             jit.AddConstant(MakeJitConstant("DIM_ORDER_XYBF", 1));
@@ -29,7 +29,7 @@ namespace kernel_selector {
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
-        CommonDispatchData SetDefault(const deconvolution_params& params) const override;
-        JitConstants GetJitConstants(const deconvolution_params& params) const override;
+        DispatchData SetDefault(const deconvolution_params& params, int autoTuneIndex = -1) const override;
+        JitConstants GetJitConstants(const deconvolution_params& params, const DispatchData& kd) const override;
     };
 }
\ No newline at end of file
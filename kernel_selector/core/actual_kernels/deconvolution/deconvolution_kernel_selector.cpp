@@ -17,6 +17,7 @@
 #include "deconvolution_kernel_selector.h"
 #include "deconvolution_kernel_ref.h"
 #include "deconvolution_kernel_bfyx_opt.h"
+#include "deconvolution_kernel_bfyx_stride_phase.h"
  
 namespace kernel_selector 
 {
@@ -24,10 +25,11 @@ namespace kernel_selector
     {
         Attach<DeconvolutionKernelRef>();
         Attach<DeconvolutionKernel_bfyx_opt>();
+        Attach<DeconvolutionKernel_bfyx_stride_phase>();
     }
 
     KernelsData deconvolution_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
     {
-        return GetNaiveBestKernel(params, options, KernelType::DECONVOLUTION);
+        return GetAutoTuneBestKernel(params, options, KernelType::DECONVOLUTION);
     }
 }
\ No newline at end of file
@@ -41,6 +41,7 @@ namespace kernel_selector
 		k.EnableTensorPitches();
 		k.EnableBatching();
         k.EnableNonBiasTerm();
+        k.EnableDifferentTypes();
 		return k;
 	}
 
@@ -69,6 +70,8 @@ namespace kernel_selector
 		kd.lws0 = local[0];
 		kd.lws1 = local[1];
 		kd.lws2 = 1;
+
+		kd.effiency = FORCE_PRIORITY_9;
 		return kd;
 
 	}
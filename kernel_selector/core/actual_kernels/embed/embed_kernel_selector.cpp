@@ -16,12 +16,14 @@
 
 #include "embed_kernel_selector.h"
 #include "embed_kernel_ref.h"
+#include "embed_kernel_vectorized.h"
 
 namespace kernel_selector {
 
     embed_kernel_selector::embed_kernel_selector()
     {
         Attach<EmbedKernelRef>();
+        Attach<EmbedKernelVectorized>();
     }
 
     KernelsData embed_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -0,0 +1,72 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "embed_kernel_vectorized.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    static const size_t vec_size = 8;
+
+    ParamsKey EmbedKernelVectorized::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputWeightsType(WeightsType::F16);
+        k.EnableInputWeightsType(WeightsType::F32);
+        k.EnableAllInputLayout();
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableBiasPerOutput();
+        k.EnableBiasPerFeature();
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableNonBiasTerm();
+        k.EnableDifferentTypes();
+        return k;
+    }
+
+    JitConstants EmbedKernelVectorized::GetJitConstants(const embed_params& params) const
+    {
+        JitConstants jit = EmbedKernelRef::GetJitConstants(params);
+        jit.AddConstant(MakeJitConstant("VEC_SIZE", vec_size));
+
+        return jit;
+    }
+
+    // Work-item copies VEC_SIZE consecutive values of the looked-up embedding row.
+    EmbedKernelRef::DispatchData EmbedKernelVectorized::SetDefault(const embed_params& params) const
+    {
+        DispatchData kd;
+        std::vector<size_t> global = { CeilDiv(params.weights.OFM().v, vec_size), params.inputs[0].X().v, params.inputs[0].Batch().v };
+        std::vector<size_t> local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        kd.effiency = FORCE_PRIORITY_7;
+        return kd;
+    }
+}
@@ -0,0 +1,37 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "embed_kernel_ref.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // EmbedKernelVectorized
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class EmbedKernelVectorized : public EmbedKernelRef
+    {
+    public:
+        EmbedKernelVectorized() : EmbedKernelRef("embed_vectorized") {}
+        virtual ~EmbedKernelVectorized() {}
+
+        virtual ParamsKey GetSupportedKey() const override;
+    protected:
+        virtual JitConstants GetJitConstants(const embed_params& params) const override;
+        virtual DispatchData SetDefault(const embed_params& params) const override;
+    };
+}
@@ -28,7 +28,22 @@ namespace kernel_selector
         cldnnJit.AddConstant(MakeJitConstant("BATCHES_PER_WORK_ITEM", batches_per_work_item));             // how many batches will a single work item compute
         cldnnJit.AddConstant(MakeJitConstant("OUTPUT_ELEMENTS_COUNT", params.output.LogicalSize() / params.output.Batch().v));
 
+        // fused operations are applied to blocks of 8 or 16 consecutive batches
+        cldnnJit.Merge(MakeFusedOpsBatchVectorJitConstants(params, 8));
+        cldnnJit.Merge(MakeFusedOpsBatchVectorJitConstants(params, 16));
+
         return cldnnJit;
     }
 
+    bool FullyConnectedBlockKernelBase::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!FullyConnectedKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const fully_connected_params&>(p);
+        return FusedOpsSupportBatchVectors(params);
+    }
+
 }
\ No newline at end of file
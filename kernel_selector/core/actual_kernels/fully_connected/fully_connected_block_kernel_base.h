@@ -28,6 +28,7 @@ namespace kernel_selector
 
     protected:
         JitConstants GetJitConstants(const fully_connected_params& params, const DispatchData& kd) const override;
+        bool Validate(const Params& p, const optional_params& o) const override;
 
         // how many batches will a single work item compute
         static size_t GetBatchesPerWorkItem(const fully_connected_params& params)
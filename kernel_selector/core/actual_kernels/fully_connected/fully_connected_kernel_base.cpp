@@ -124,6 +124,8 @@ namespace kernel_selector
 
         auto& kernel = kd.kernels[0];
         FillCLKernelData(kernel, *runInfo.get(), params.engineInfo, kernelName, jit, entry_point, exeMode, true, !orgParams.bias.empty(), 1, newParams.int8_quantization, newParams.output_calibration);
+        const auto fusedOpsArgs = GetFusedOpsArgsDesc(newParams);
+        kernel.arguments.insert(kernel.arguments.end(), fusedOpsArgs.begin(), fusedOpsArgs.end());
 
         kd.estimatedTime = estimated_time;
         kd.autoTuneIndex = autoTuneIndex;
@@ -34,6 +34,7 @@ namespace kernel_selector
         k.EnableBiasPerFeature();
         k.EnableNonBiasTerm();
         k.EnableSubGroup();
+        k.EnableFusedOps();
         return k;
     }
 
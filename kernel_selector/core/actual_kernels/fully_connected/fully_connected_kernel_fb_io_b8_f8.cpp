@@ -33,6 +33,7 @@ namespace kernel_selector
         k.EnableBiasPerFeature();
         k.EnableNonBiasTerm();
         k.EnableSubGroup();
+        k.EnableFusedOps();
         return k;
     }
 
@@ -0,0 +1,83 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "fused_ops_kernel_ref.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    ParamsKey FusedOpsKernelRef::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableOutputLayout(DataLayout::fb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::yxfb);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bf8_xy16);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableFusedOps();
+        return k;
+    }
+
+    KernelsData FusedOpsKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::FUSED_OPS);
+        const fused_ops_params& orgParams = static_cast<const fused_ops_params&>(params);
+
+        if (orgParams.fusedOps.empty() || options.GetType() != KernelType::FUSED_OPS)
+        {
+            return{};
+        }
+
+        const auto& output = orgParams.output;
+        DispatchData runInfo;
+        runInfo.fp16UnitUsed = output.GetDType() == Datatype::F16;
+
+        std::vector<size_t> global = { output.X().v * output.Y().v, output.Feature().v, output.Batch().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        KernelData kd = KernelData::Default<fused_ops_params>(params);
+
+        auto cldnn_jit = MakeBaseParamsJitConstants(orgParams);
+        auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+        auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = kd.kernels[0];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point, DEFAULT, false, false, 0);
+        auto fusedArgs = GetFusedOpsArgsDesc(orgParams);
+        kernel.arguments.insert(kernel.arguments.end(), fusedArgs.begin(), fusedArgs.end());
+
+        kd.estimatedTime = DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,54 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "common_kernel_base.h"
+#include "kernel_selector_params.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // fused_ops_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Fused operations (base_params::fusedOps) applied in place to the output of a layer whose kernel does not support them.
+    struct fused_ops_params : public base_params
+    {
+        fused_ops_params() : base_params(KernelType::FUSED_OPS) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // fused_ops_optional_params
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    struct fused_ops_optional_params : optional_params
+    {
+        fused_ops_optional_params() : optional_params(KernelType::FUSED_OPS) {}
+    };
+
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // FusedOpsKernelRef
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class FusedOpsKernelRef : public common_kernel_base
+    {
+    public:
+        FusedOpsKernelRef() : common_kernel_base("fused_ops_ref") {}
+        virtual ~FusedOpsKernelRef() {}
+
+        using DispatchData = CommonDispatchData;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+    };
+}
@@ -14,15 +14,18 @@
 // limitations under the License.
 */
 
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
+#include "fused_ops_kernel_selector.h"
+#include "fused_ops_kernel_ref.h"
+
+namespace kernel_selector
 {
-    // KBL GT3e
-    void tuning_cache_48(tuning_data& td)
+    fused_ops_kernel_selector::fused_ops_kernel_selector()
+    {
+        Attach<FusedOpsKernelRef>();
+    }
+
+    KernelsData fused_ops_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
     {
-        tuning_cache_48_1(td);
-        tuning_cache_48_2(td);
-        tuning_cache_48_3(td);
+        return GetNaiveBestKernel(params, options, KernelType::FUSED_OPS);
     }
-}
\ No newline at end of file
+}
@@ -14,15 +14,24 @@
 // limitations under the License.
 */
 
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
+#pragma once
+
+#include "kernel_selector.h"
+
+namespace kernel_selector
 {
-    // SKL GT4e
-    void tuning_cache_72(tuning_data& td)
+    class fused_ops_kernel_selector : public kernel_selector_base
     {
-        tuning_cache_72_1(td);
-        tuning_cache_72_2(td);
-        tuning_cache_72_3(td);
-    }
-}
\ No newline at end of file
+    public:
+        static fused_ops_kernel_selector &Instance() {
+            static fused_ops_kernel_selector instance_;
+            return instance_;
+        }
+
+        fused_ops_kernel_selector();
+
+        virtual ~fused_ops_kernel_selector() {}
+
+        virtual KernelsData GetBestKernels(const Params& params, const optional_params& options) const override;
+    };
+}
@@ -21,7 +21,7 @@
 
 namespace kernel_selector
 {
-    JitConstants GemmKernelBase::GetJitConstants(const gemm_params& params) const
+    JitConstants GemmKernelBase::GetJitConstants(const gemm_params& params, const DispatchData&) const
     {
         JitConstants jit = MakeBaseParamsJitConstants(params);
 
@@ -46,7 +46,7 @@ namespace kernel_selector
         return jit;
     }
 
-    GemmKernelBase::DispatchData GemmKernelBase::SetDefault(const gemm_params& params) const
+    GemmKernelBase::DispatchData GemmKernelBase::SetDefault(const gemm_params& params, int) const
     {
         const auto& output = params.output;
 
@@ -75,16 +75,21 @@ namespace kernel_selector
         return kd;
     }
 
-    KernelsData GemmKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
+    KernelsData GemmKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time, int autoTuneIndex) const
     {
         assert(params.GetType() == KernelType::GEMM);
 
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
         const auto& prim_params = static_cast<const gemm_params&>(params);
 
-        auto run_info = SetDefault(prim_params);
+        auto run_info = SetDefault(prim_params, autoTuneIndex);
         KernelData k_data = KernelData::Default<gemm_params>(params);
 
-        auto cldnn_jit = GetJitConstants(prim_params);
+        auto cldnn_jit = GetJitConstants(prim_params, run_info);
         auto entry_point = GetEntryPoint(kernelName, prim_params.layerID, options);
         auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
 
@@ -92,6 +97,7 @@ namespace kernel_selector
         FillCLKernelData(kernel, run_info, params.engineInfo, kernelName, jit, entry_point, DEFAULT, false, false, (uint32_t)prim_params.inputs.size());
 
         k_data.estimatedTime = estimated_time;
+        k_data.autoTuneIndex = autoTuneIndex;
 
         return { k_data };
     }
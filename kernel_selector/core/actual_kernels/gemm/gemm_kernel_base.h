@@ -52,18 +52,26 @@ namespace kernel_selector
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-    // BorderKernelBase
+    // GemmKernelBase
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     class GemmKernelBase : public common_kernel_base
     {
     public:
         using common_kernel_base::common_kernel_base;
 
-        using DispatchData = CommonDispatchData;
+        struct DispatchData : public CommonDispatchData
+        {
+            // tiling used by optimized kernels
+            size_t tileM = 1;
+            size_t tileN = 1;
+            size_t tileK = 1;
+            size_t blockM = 1;
+            size_t blockN = 1;
+        };
 
     protected:
-        JitConstants GetJitConstants(const gemm_params& params) const;
-        DispatchData SetDefault(const gemm_params& params) const;
-        KernelsData GetCommonKernelsData(const Params& params, const optional_params&, float estimated_time) const;
+        virtual JitConstants GetJitConstants(const gemm_params& params, const DispatchData& kd) const;
+        virtual DispatchData SetDefault(const gemm_params& params, int autoTuneIndex = -1) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params&, float estimated_time, int autoTuneIndex = -1) const;
     };
 }
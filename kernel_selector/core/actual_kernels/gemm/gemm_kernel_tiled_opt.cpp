@@ -0,0 +1,261 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "gemm_kernel_tiled_opt.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        struct gemm_sizes
+        {
+            size_t M;
+            size_t N;
+            size_t K;
+        };
+
+        gemm_sizes GetGemmSizes(const gemm_params& params)
+        {
+            const auto& input0 = params.inputs[0];
+            const auto& input1 = params.inputs[1];
+            return {
+                params.transpose_input1 ? input0.X().v : input0.Y().v,
+                params.transpose_input2 ? input1.Y().v : input1.X().v,
+                params.transpose_input1 ? input0.Y().v : input0.X().v,
+            };
+        }
+
+        // widest vector which does not cross rows of the input and fits the tile
+        size_t GetVectorSize(const DataTensor& input, size_t tile_extent)
+        {
+            for (size_t vec : { 4, 2 })
+            {
+                if (input.X().v % vec == 0 && input.Y().pitch % vec == 0 && tile_extent % vec == 0)
+                    return vec;
+            }
+            return 1;
+        }
+
+        size_t GetLocalMemSize(const EngineInfo& engine_info)
+        {
+            return engine_info.maxLocalMemSize ? static_cast<size_t>(engine_info.maxLocalMemSize) : 32 * 1024;
+        }
+    }
+
+    GemmKernelTiledOpt::GemmKernelTiledOpt() : GemmKernelBase("gemm_tiled_opt")
+    {
+        // Generate the dispatch options to the auto-tuner.
+        std::vector<size_t> tileSizes = { 16, 32, 64 };
+        std::vector<size_t> tileKSizes = { 8, 16, 32 };
+        std::vector<size_t> blockSizes = { 1, 2, 4, 8 };
+        const size_t minWorkGroupSize = 16;
+        const size_t maxWorkGroupSize = 256;
+        const size_t maxBlockSize = 32;
+
+        for (auto tileM : tileSizes)
+        {
+            for (auto tileN : tileSizes)
+            {
+                for (auto tileK : tileKSizes)
+                {
+                    for (auto blockM : blockSizes)
+                    {
+                        for (auto blockN : blockSizes)
+                        {
+                            const size_t workGroupSize = (tileM / blockM) * (tileN / blockN);
+                            if (blockM * blockN <= maxBlockSize &&
+                                workGroupSize >= minWorkGroupSize && workGroupSize <= maxWorkGroupSize)
+                            {
+                                autoTuneOptions.emplace_back(AutoTuneOption{ tileM, tileN, tileK, blockM, blockN });
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    ParamsKey GemmKernelTiledOpt::GetSupportedKey() const
+    {
+        ParamsKey k;
+
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+
+        return k;
+    }
+
+    bool GemmKernelTiledOpt::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!Parent::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const gemm_params&>(p);
+        if (params.inputs.size() < 2)
+        {
+            return false;
+        }
+
+        // inputs are staged in local memory as they are, so all of them have to be of the same type
+        for (const auto& input : params.inputs)
+        {
+            if (input.GetDType() != params.inputs[0].GetDType() || input.GetLayout() != DataLayout::bfyx)
+                return false;
+        }
+
+        return true;
+    }
+
+    bool GemmKernelTiledOpt::IsOptionSupported(const gemm_params& params, const AutoTuneOption& option) const
+    {
+        const size_t workGroupSize = (option.tileM / option.blockM) * (option.tileN / option.blockN);
+        const size_t elementSize = BytesPerElement(params.inputs[0].GetDType());
+        const size_t localMemSize = (option.tileM * (option.tileK + 1) + option.tileK * (option.tileN + 1)) * elementSize;
+
+        if (params.engineInfo.maxWorkGroupSize && workGroupSize > params.engineInfo.maxWorkGroupSize)
+            return false;
+
+        return localMemSize <= GetLocalMemSize(params.engineInfo);
+    }
+
+    GemmKernelTiledOpt::AutoTuneOption GemmKernelTiledOpt::GetAutoTuneOptions(const gemm_params& params, int autoTuneIndex) const
+    {
+        if ((autoTuneIndex >= 0) && (autoTuneIndex < (int)autoTuneOptions.size()))
+        {
+            return autoTuneOptions[autoTuneIndex];
+        }
+
+        // Heuristic: large tiles with 4x4 register blocks for big matrices, smaller ones
+        // when one of the dimensions would leave most of the work-group idle.
+        const auto sizes = GetGemmSizes(params);
+        AutoTuneOption option = { 16, 16, 16, 2, 2 };
+        if (sizes.M >= 64 && sizes.N >= 64)
+        {
+            option = { 64, 64, 16, 4, 4 };
+        }
+        else if (sizes.M >= 32 && sizes.N >= 32)
+        {
+            option = { 32, 32, 16, 4, 4 };
+        }
+
+        if (!IsOptionSupported(params, option))
+        {
+            option = { 16, 16, 16, 2, 2 };
+        }
+
+        return option;
+    }
+
+    GemmKernelBase::DispatchData GemmKernelTiledOpt::SetDefault(const gemm_params& params, int autoTuneIndex) const
+    {
+        const auto sizes = GetGemmSizes(params);
+        const auto option = GetAutoTuneOptions(params, autoTuneIndex);
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        kd.tileM = option.tileM;
+        kd.tileN = option.tileN;
+        kd.tileK = option.tileK;
+        kd.blockM = option.blockM;
+        kd.blockN = option.blockN;
+
+        kd.lws0 = option.tileN / option.blockN;
+        kd.lws1 = option.tileM / option.blockM;
+        kd.lws2 = 1;
+
+        kd.gws0 = Align(sizes.N, option.tileN) / option.blockN;
+        kd.gws1 = Align(sizes.M, option.tileM) / option.blockM;
+        kd.gws2 = params.output.Batch().v;
+
+        return kd;
+    }
+
+    JitConstants GemmKernelTiledOpt::GetJitConstants(const gemm_params& params, const DispatchData& kd) const
+    {
+        JitConstants jit = Parent::GetJitConstants(params, kd);
+
+        const auto sizes = GetGemmSizes(params);
+        jit.AddConstants({
+            MakeJitConstant("MATRIX_M", sizes.M),
+            MakeJitConstant("MATRIX_N", sizes.N),
+            MakeJitConstant("MATRIX_K", sizes.K),
+            MakeJitConstant("TILE_M", kd.tileM),
+            MakeJitConstant("TILE_N", kd.tileN),
+            MakeJitConstant("TILE_K", kd.tileK),
+            MakeJitConstant("BLOCK_M", kd.blockM),
+            MakeJitConstant("BLOCK_N", kd.blockN),
+            // rows of input0 are along K, or along M when transposed; rows of input1 are along N, or along K when transposed
+            MakeJitConstant("VEC_SIZE_A", GetVectorSize(params.inputs[0], params.transpose_input1 ? kd.tileM : kd.tileK)),
+            MakeJitConstant("VEC_SIZE_B", GetVectorSize(params.inputs[1], params.transpose_input2 ? kd.tileK : kd.tileN)),
+        });
+
+        return jit;
+    }
+
+    KernelsData GemmKernelTiledOpt::GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const auto& prim_params = static_cast<const gemm_params&>(params);
+        if (!IsOptionSupported(prim_params, GetAutoTuneOptions(prim_params, autoTuneIndex)))
+        {
+            return{};
+        }
+
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_3, autoTuneIndex);
+    }
+
+    KernelsData GemmKernelTiledOpt::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetTunedKernelsDataByIndex(params, options, -1);
+    }
+
+    KernelsData GemmKernelTiledOpt::GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        KernelsData res = {};
+
+        for (size_t i = 0; i < autoTuneOptions.size(); i++)
+        {
+            KernelsData kd = GetTunedKernelsDataByIndex(params, options, (int)i);
+            if (!kd.empty())
+            {
+                res.emplace_back(kd[0]);
+            }
+        }
+
+        return res;
+    }
+}
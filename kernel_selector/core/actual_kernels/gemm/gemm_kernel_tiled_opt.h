@@ -0,0 +1,56 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "gemm_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Work-group computes TILE_M x TILE_N output tile from input tiles staged in local memory,
+    // each work-item accumulates BLOCK_M x BLOCK_N block of it in registers.
+    class GemmKernelTiledOpt : public GemmKernelBase
+    {
+    public:
+        using Parent = GemmKernelBase;
+        GemmKernelTiledOpt();
+
+        KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        KernelsData GetKernelsDataForAutoTune(const Params& params, const optional_params& options) const override;
+        KernelsData GetTunedKernelsDataByIndex(const Params& params, const optional_params& options, int autoTuneIndex) const override;
+        ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const gemm_params& params, const DispatchData& kd) const override;
+        DispatchData SetDefault(const gemm_params& params, int autoTuneIndex = -1) const override;
+
+    private:
+        struct AutoTuneOption
+        {
+            size_t tileM;
+            size_t tileN;
+            size_t tileK;
+            size_t blockM;
+            size_t blockN;
+        };
+
+        AutoTuneOption GetAutoTuneOptions(const gemm_params& params, int autoTuneIndex) const;
+        bool IsOptionSupported(const gemm_params& params, const AutoTuneOption& option) const;
+
+        std::vector<AutoTuneOption> autoTuneOptions = {};
+    };
+}
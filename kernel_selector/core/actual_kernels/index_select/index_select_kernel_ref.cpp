@@ -26,6 +26,7 @@ namespace kernel_selector
         k.EnableInputDataType(Datatype::INT8);
         k.EnableInputDataType(Datatype::UINT8);
         k.EnableInputDataType(Datatype::INT32);
+        k.EnableInputDataType(Datatype::INT64);
 
         k.EnableOutputDataType(Datatype::F32);
         k.EnableOutputDataType(Datatype::F16);
@@ -0,0 +1,156 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "index_select_kernel_rows.h"
+
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+
+namespace kernel_selector
+{
+    namespace
+    {
+        const size_t vec_size = 8;
+
+        struct RowsInfo
+        {
+            size_t rowSize;     // contiguous elements selected by one index
+            size_t axisSize;    // input size along the selection axis
+            size_t outerSize;   // number of row blocks outside the selection axis
+        };
+
+        RowsInfo GetRowsInfo(const index_select_params& params)
+        {
+            const auto& input = params.inputs[0];
+            switch (params.axis)
+            {
+            case IndexSelectAxis::BATCH:
+                return { input.Feature().v * input.Y().v * input.X().v, input.Batch().v, 1 };
+            case IndexSelectAxis::FEATURE:
+                return { input.Y().v * input.X().v, input.Feature().v, input.Batch().v };
+            default:
+                return { input.X().v, input.Y().v, input.Batch().v * input.Feature().v };
+            }
+        }
+
+        size_t GetSelectedNum(const index_select_params& params)
+        {
+            return params.reverse ? GetRowsInfo(params).axisSize : params.inputs[1].X().v;
+        }
+    }
+
+    ParamsKey IndexSelectKernelRows::GetSupportedKey() const
+    {
+        ParamsKey k;
+
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::UINT8);
+        k.EnableInputDataType(Datatype::INT32);
+        k.EnableInputDataType(Datatype::INT64);
+
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::UINT8);
+        k.EnableOutputDataType(Datatype::INT32);
+
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+
+        k.EnableBatching();
+
+        k.EnableIndexSelectAxis(IndexSelectAxis::BATCH);
+        k.EnableIndexSelectAxis(IndexSelectAxis::FEATURE);
+        k.EnableIndexSelectAxis(IndexSelectAxis::Y);
+
+        // indices have their own type
+        k.EnableDifferentTypes();
+
+        return k;
+    }
+
+    bool IndexSelectKernelRows::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!IndexSelectKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const index_select_params& params = static_cast<const index_select_params&>(p);
+        const auto& input = params.inputs[0];
+        const auto& output = params.output;
+
+        // rows are copied as they are or converted from fp16 to fp32 on store
+        if (input.GetDType() != output.GetDType() &&
+            !(input.GetDType() == Datatype::F16 && output.GetDType() == Datatype::F32))
+        {
+            return false;
+        }
+
+        if (input.PitchesDifferFromLogicalDims() || output.PitchesDifferFromLogicalDims() ||
+            input.GetFirstElementOffset() != 0 || output.GetFirstElementOffset() != 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    KernelsData IndexSelectKernelRows::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        const auto& prim_params = static_cast<const index_select_params&>(params); // NOLINT(cppcoreguidelines-pro-type-static-cast-downcast)
+        const auto rows = GetRowsInfo(prim_params);
+
+        DispatchData run_info;
+        run_info.fp16UnitUsed = prim_params.inputs[0].GetDType() == Datatype::F16;
+
+        std::vector<size_t> global = { CeilDiv(rows.rowSize, vec_size), GetSelectedNum(prim_params), rows.outerSize };
+        const auto& local = GetOptimalLocalWorkGroupSizes(global);
+
+        run_info.gws0 = global[0];
+        run_info.gws1 = global[1];
+        run_info.gws2 = global[2];
+
+        run_info.lws0 = local[0];
+        run_info.lws1 = local[1];
+        run_info.lws2 = local[2];
+
+        KernelData k_data = KernelData::Default<index_select_params>(params);
+
+        auto cldnn_jit = GetJitConstants(prim_params);
+        cldnn_jit.AddConstants({
+            MakeJitConstant("ROW_SIZE",     rows.rowSize),
+            MakeJitConstant("AXIS_SIZE",    rows.axisSize),
+            MakeJitConstant("SELECTED_NUM", GetSelectedNum(prim_params)),
+            MakeJitConstant("VEC_SIZE",     vec_size),
+        });
+        auto entry_point = GetEntryPoint(kernelName, prim_params.layerID, options);
+        auto jit         = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = k_data.kernels[0];
+        FillCLKernelData(kernel, run_info, params.engineInfo, kernelName, jit, entry_point, DEFAULT, false, false, (uint32_t)prim_params.inputs.size());
+
+        k_data.estimatedTime = FORCE_PRIORITY_7;
+
+        return {k_data};
+    }
+}
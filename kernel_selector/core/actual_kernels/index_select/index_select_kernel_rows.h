@@ -0,0 +1,35 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "index_select_kernel_base.h"
+
+
+namespace kernel_selector
+{
+    // Selection along batch, feature or y of a bfyx tensor without padding copies whole contiguous rows
+    // (f*y*x, y*x or x elements): work-items of a row copy it with vector loads and stores.
+    class IndexSelectKernelRows : public IndexSelectKernelBase
+    {
+    public:
+        IndexSelectKernelRows() : IndexSelectKernelBase("index_select_gpu_rows") {}
+
+        KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+    };
+}
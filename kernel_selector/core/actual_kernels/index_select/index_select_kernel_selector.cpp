@@ -15,12 +15,14 @@
 
 #include "index_select_kernel_selector.h"
 #include "index_select_kernel_ref.h"
+#include "index_select_kernel_rows.h"
 
 namespace kernel_selector 
 {
     index_select_kernel_selector::index_select_kernel_selector()
     {
         Attach<IndexSelectKernelRef>();
+        Attach<IndexSelectKernelRows>();
     }
 
     KernelsData index_select_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -32,6 +32,14 @@ namespace kernel_selector
                 MakeJitConstant("CELL_DIRECTION", params.cell_direction)
             });
         }
+        if (params.has_hidden) {
+            jit.AddConstants({
+                MakeJitConstant("HIDDEN_TERM", true),
+                MakeJitConstant("HIDDEN", params.hidden),
+                MakeJitConstant("RECURRENT", params.recurrent),
+                MakeJitConstant("HIDDEN_DIRECTION", params.hidden_direction)
+            });
+        }
         if (params.clip > 0) {
             std::string psclip = toCodeString(params.clip);
             std::string nsclip = toCodeString(-params.clip);
@@ -57,7 +65,28 @@ namespace kernel_selector
         return jit;
     }
 
-    KernelsData LSTMEltKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    LSTMEltKernelBase::DispatchData LSTMEltKernelBase::SetDefault(const lstm_elt_params& params) const
+    {
+        const auto& out = params.output;
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        std::vector<size_t> global = { out.X().v, out.Batch().v, 1 };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    KernelsData LSTMEltKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
     {
         if (!Validate(params, options))
         {
@@ -68,28 +97,32 @@ namespace kernel_selector
 
         KernelData kd = KernelData::Default<lstm_elt_params>(params, orgParams.inputs.size());
 
-        float effiency = FORCE_PRIORITY_1;
         const auto& input = orgParams.inputs[0];
 
         auto newParams = orgParams;
         newParams.inputs.resize(1);
         newParams.inputs[0] = input;
-        auto out = newParams.output;
+        auto runInfo = SetDefault(newParams);
 
         auto& kernel = kd.kernels[0];
         auto cldnnJit = GetJitConstants(newParams);
         auto entryPoint = GetEntryPoint(kernelName, newParams.layerID, options);
         auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
 
-        kernel.workGroups.global = { out.X().v, out.Batch().v, 1 };
+        kernel.workGroups.global = { runInfo.gws0, runInfo.gws1, runInfo.gws2 };
+        kernel.workGroups.local = { runInfo.lws0, runInfo.lws1, runInfo.lws2 };
         kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
         kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
         if (orgParams.has_cell) {
             kernel.arguments.push_back({ ArgumentDescriptor::Types::CELL, 0 });
         }
+        if (orgParams.has_hidden) {
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::HIDDEN, 0 });
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::RECURRENT, 0 });
+        }
 
-        kd.estimatedTime = effiency;
+        kd.estimatedTime = estimated_time;
 
         return{ kd };
     }
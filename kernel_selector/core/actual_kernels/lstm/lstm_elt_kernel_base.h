@@ -38,6 +38,10 @@ namespace kernel_selector
 
         DataTensor cell;
         bool has_cell = false;
+        DataTensor hidden;
+        DataTensor recurrent;
+        bool has_hidden = false;
+        uint32_t hidden_direction = 0;
         order_type gate_order = offset_iofz;
         float clip = 0;
         bool input_forget = false;
@@ -67,6 +71,12 @@ namespace kernel_selector
             has_cell = true;
         }
 
+        void SetHidden(const DataTensor& h, const DataTensor& r) {
+            hidden = h;
+            recurrent = r;
+            has_hidden = true;
+        }
+
         virtual ParamsKey GetParamsKey() const override
         {
             ParamsKey k = base_params::GetParamsKey();
@@ -74,6 +84,10 @@ namespace kernel_selector
             {
                 k.EnableLSTMEltCell();
             }
+            if (has_hidden)
+            {
+                k.EnableLSTMEltHidden();
+            }
             return k;
         }
     };
@@ -100,7 +114,8 @@ namespace kernel_selector
 
     protected:
         virtual JitConstants GetJitConstants(const lstm_elt_params& params) const;
-        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams) const;
+        virtual DispatchData SetDefault(const lstm_elt_params& params) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams, float estimated_time) const;
 
         bool Validate(const Params& p, const optional_params&) const override
         {
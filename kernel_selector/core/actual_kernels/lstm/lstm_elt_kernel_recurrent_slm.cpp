@@ -0,0 +1,99 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_elt_kernel_recurrent_slm.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector {
+
+    static const size_t lws_max = 64;
+
+    ParamsKey LSTMEltKernelRecurrentSLM::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableLSTMEltCell();
+        k.EnableLSTMEltHidden();
+        return k;
+    }
+
+    bool LSTMEltKernelRecurrentSLM::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!LSTMEltKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const lstm_elt_params&>(p);
+        if (!params.has_hidden)
+        {
+            return false;
+        }
+
+        // rows of recurrent weights are read with vector loads, hidden state has to fit in local memory
+        const auto& recurrent = params.recurrent;
+        const size_t hidden_size = params.hidden.X().v;
+        const size_t slm_size = hidden_size * sizeof(float);
+        const size_t slm_limit = params.engineInfo.maxLocalMemSize ? params.engineInfo.maxLocalMemSize : 32 * 1024;
+        if (recurrent.X().pitch != 1 || recurrent.X().pad.Total() != 0 ||
+            recurrent.GetDType() != params.inputs[0].GetDType() ||
+            slm_size > slm_limit / 2)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    LSTMEltKernelBase::DispatchData LSTMEltKernelRecurrentSLM::SetDefault(const lstm_elt_params& params) const
+    {
+        const auto& out = params.output;
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        kd.lws0 = std::min(lws_max, Align(out.X().v, 8));
+        kd.lws1 = 1;
+        kd.lws2 = 1;
+
+        kd.gws0 = Align(out.X().v, kd.lws0);
+        kd.gws1 = out.Batch().v;
+        kd.gws2 = 1;
+
+        return kd;
+    }
+
+    JitConstants LSTMEltKernelRecurrentSLM::GetJitConstants(const lstm_elt_params& params) const
+    {
+        auto jit = LSTMEltKernelBase::GetJitConstants(params);
+        jit.AddConstant(MakeJitConstant("LWS", SetDefault(params).lws0));
+        return jit;
+    }
+
+    KernelsData LSTMEltKernelRecurrentSLM::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_1);
+    }
+}
@@ -0,0 +1,39 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "lstm_elt_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Recurrent GEMM fused with element-wise part of an LSTM time step. The hidden state of a batch is kept in
+    // local memory and shared by all work-items of a work-group.
+    class LSTMEltKernelRecurrentSLM : public LSTMEltKernelBase
+    {
+    public:
+        LSTMEltKernelRecurrentSLM() : LSTMEltKernelBase("lstm_elt_gpu_bfyx_recurrent_slm") {}
+        virtual ~LSTMEltKernelRecurrentSLM() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const lstm_elt_params& params) const override;
+        DispatchData SetDefault(const lstm_elt_params& params) const override;
+    };
+}
@@ -33,11 +33,12 @@ namespace kernel_selector {
         k.EnableTensorPitches();
         k.EnableBatching();
         k.EnableLSTMEltCell();
+        k.EnableLSTMEltHidden();
         return k;
     }
 
     KernelsData LSTMEltKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
     }
 }
\ No newline at end of file
@@ -16,12 +16,14 @@
 
 #include "lstm_elt_kernel_selector.h"
 #include "lstm_elt_kernel_ref.h"
+#include "lstm_elt_kernel_recurrent_slm.h"
 
 namespace kernel_selector
 {
     lstm_elt_kernel_selector::lstm_elt_kernel_selector()
     {
         Attach<LSTMEltKernelRef>();
+        Attach<LSTMEltKernelRecurrentSLM>();
     }
 
     KernelsData lstm_elt_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -44,7 +44,29 @@ namespace kernel_selector
         return jit;
     }
 
-    KernelsData LSTMGemmKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options) const
+    LSTMGemmKernelBase::DispatchData LSTMGemmKernelBase::SetDefault(const lstm_gemm_params& params) const
+    {
+        const auto& out = params.output;
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        // without hidden, all time steps of the input sequence are computed at once
+        std::vector<size_t> global = { out.X().v, out.Batch().v, params.inputs[0].Feature().v };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    KernelsData LSTMGemmKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
     {
         if (!Validate(params,  options))
         {
@@ -55,20 +77,20 @@ namespace kernel_selector
 
         KernelData kd = KernelData::Default<lstm_gemm_params>(params, orgParams.inputs.size());
 
-        float effiency = FORCE_PRIORITY_1;
         const auto& input = orgParams.inputs[0];
 
         auto newParams = orgParams;
         newParams.inputs.resize(1);
         newParams.inputs[0] = input;
-        auto out = newParams.output;
+        auto runInfo = SetDefault(newParams);
         //TODO: reorder weights if needed
         auto& kernel = kd.kernels[0];
         auto cldnnJit = GetJitConstants(newParams);
         auto entryPoint = GetEntryPoint(kernelName, newParams.layerID, options);
         auto jit = CreateJit(kernelName, cldnnJit, entryPoint);
 
-        kernel.workGroups.global = { out.X().v, out.Batch().v, 1 };
+        kernel.workGroups.global = { runInfo.gws0, runInfo.gws1, runInfo.gws2 };
+        kernel.workGroups.local = { runInfo.lws0, runInfo.lws1, runInfo.lws2 };
         kernel.kernelString = GetKernelString(kernelName, jit, entryPoint, params.engineInfo);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 0 });
         kernel.arguments.push_back({ ArgumentDescriptor::Types::OUTPUT, 0 });
@@ -81,7 +103,7 @@ namespace kernel_selector
             kernel.arguments.push_back({ ArgumentDescriptor::Types::BIAS, 0 });
         }
 
-        kd.estimatedTime = effiency;
+        kd.estimatedTime = estimated_time;
 
         return{ kd };
     }
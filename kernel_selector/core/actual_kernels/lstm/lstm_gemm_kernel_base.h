@@ -88,7 +88,8 @@ namespace kernel_selector
 
     protected:
         virtual JitConstants GetJitConstants(const lstm_gemm_params& params) const;
-        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams) const;
+        virtual DispatchData SetDefault(const lstm_gemm_params& params) const;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& optParams, float estimated_time) const;
 
         bool Validate(const Params& p, const optional_params&) const override
         {
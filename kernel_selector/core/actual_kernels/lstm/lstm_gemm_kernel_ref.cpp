@@ -39,6 +39,6 @@ namespace kernel_selector {
 
     KernelsData LSTMGemmKernelRef::GetKernelsData(const Params& params, const optional_params& options) const
     {
-        return GetCommonKernelsData(params, options);
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_9);
     }
 }
\ No newline at end of file
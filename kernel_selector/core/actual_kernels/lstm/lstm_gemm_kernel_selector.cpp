@@ -16,12 +16,14 @@
 
 #include "lstm_gemm_kernel_selector.h"
 #include "lstm_gemm_kernel_ref.h"
+#include "lstm_gemm_kernel_seq_tiled.h"
 
 namespace kernel_selector
 {
     lstm_gemm_kernel_selector::lstm_gemm_kernel_selector()
     {
         Attach<LSTMGemmKernelRef>();
+        Attach<LSTMGemmKernelSeqTiled>();
     }
 
     KernelsData lstm_gemm_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -0,0 +1,91 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "lstm_gemm_kernel_seq_tiled.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector {
+
+    static const size_t tile_size = 16;
+
+    ParamsKey LSTMGemmKernelSeqTiled::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableDifferentTypes();
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableLSTMGEMMBias();
+        return k;
+    }
+
+    bool LSTMGemmKernelSeqTiled::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!LSTMGemmKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        // tiles pay off only when there are enough rows to share loaded weights
+        const auto& params = static_cast<const lstm_gemm_params&>(p);
+        const auto& input = params.inputs[0];
+        if (params.hasHidden || input.Batch().v * input.Feature().v < tile_size / 2)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    LSTMGemmKernelBase::DispatchData LSTMGemmKernelSeqTiled::SetDefault(const lstm_gemm_params& params) const
+    {
+        const auto& input = params.inputs[0];
+
+        DispatchData kd;
+        kd.fp16UnitUsed = input.GetDType() == Datatype::F16;
+
+        kd.gws0 = Align(params.output.X().v, tile_size);
+        kd.gws1 = Align(input.Batch().v * input.Feature().v, tile_size);
+        kd.gws2 = 1;
+
+        kd.lws0 = tile_size;
+        kd.lws1 = tile_size;
+        kd.lws2 = 1;
+
+        return kd;
+    }
+
+    JitConstants LSTMGemmKernelSeqTiled::GetJitConstants(const lstm_gemm_params& params) const
+    {
+        auto jit = LSTMGemmKernelBase::GetJitConstants(params);
+        jit.AddConstant(MakeJitConstant("TILE_SIZE", tile_size));
+        return jit;
+    }
+
+    KernelsData LSTMGemmKernelSeqTiled::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_1);
+    }
+}
@@ -0,0 +1,39 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "lstm_gemm_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Input-to-hidden GEMM of a whole sequence (no hidden term): rows of all batches and time steps are multiplied
+    // by weights in tiles staged through local memory.
+    class LSTMGemmKernelSeqTiled : public LSTMGemmKernelBase
+    {
+    public:
+        LSTMGemmKernelSeqTiled() : LSTMGemmKernelBase("lstm_gemm_gpu_bfyx_seq_tiled") {}
+        virtual ~LSTMGemmKernelSeqTiled() {}
+
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const lstm_gemm_params& params) const override;
+        DispatchData SetDefault(const lstm_gemm_params& params) const override;
+    };
+}
@@ -0,0 +1,81 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "normalize_kernel_across_spatial_opt.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    // below this size the serial loop of the reference kernel is cheaper than a work-group reduction
+    static const size_t large_normalized_size_threshold = 256;
+
+    static size_t GetNormalizedSize(const normalize_params& params)
+    {
+        const auto& input = params.inputs[0];
+        return input.Feature().v * input.Y().v * input.X().v;
+    }
+
+    ParamsKey NormalizeKernelAcrossSpatialOpt::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableNormalizeMode(NormalizeMode::ACROSS_SPATIAL);
+        return k;
+    }
+
+    JitConstants NormalizeKernelAcrossSpatialOpt::GetJitConstants(const normalize_params& params) const
+    {
+        auto jit = NormalizeKernelBase::GetJitConstants(params);
+
+        jit.AddConstant(MakeJitConstant("LWS", GetReductionWorkGroupSize(params.engineInfo, GetNormalizedSize(params))));
+
+        return jit;
+    }
+
+    NormalizeKernelBase::DispatchData NormalizeKernelAcrossSpatialOpt::SetDefault(const normalize_params& params) const
+    {
+        DispatchData kd;
+
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        // one work-group per batch, the whole f*y*x volume is reduced in local memory
+        kd.lws0 = GetReductionWorkGroupSize(params.engineInfo, GetNormalizedSize(params));
+        kd.lws1 = 1;
+        kd.lws2 = 1;
+
+        kd.gws0 = kd.lws0;
+        kd.gws1 = 1;
+        kd.gws2 = params.output.Batch().v;
+
+        return kd;
+    }
+
+    KernelsData NormalizeKernelAcrossSpatialOpt::GetKernelsData(const Params& params, const optional_params& optParams) const
+    {
+        const normalize_params& orgParams = static_cast<const normalize_params&>(params);
+        const float estimated_time = GetNormalizedSize(orgParams) >= large_normalized_size_threshold ? FORCE_PRIORITY_7 : DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return GetCommonKernelsData(params, optParams, estimated_time);
+    }
+}
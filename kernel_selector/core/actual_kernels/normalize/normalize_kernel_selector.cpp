@@ -17,6 +17,7 @@
 #include "normalize_kernel_selector.h"
 #include "normalize_kernel_within_spatial_ref.h"
 #include "normalize_kernel_across_spatial_ref.h"
+#include "normalize_kernel_across_spatial_opt.h"
  
 namespace kernel_selector 
 {
@@ -24,6 +25,7 @@ namespace kernel_selector
     {
         Attach<NormalizeKernelWithinSpatialRef>();
         Attach<NormalizeKernelAcrossSpatialRef>();
+        Attach<NormalizeKernelAcrossSpatialOpt>();
     }
 
     KernelsData normalize_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
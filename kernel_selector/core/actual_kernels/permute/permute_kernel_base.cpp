@@ -0,0 +1,119 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_base.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        // dimension with the smallest pitch among these which are not of size 1
+        size_t GetInnermost(const size_t (&sizes)[4], const size_t (&pitches)[4])
+        {
+            size_t innermost = 0;
+            for (size_t d = 1; d < 4; d++)
+            {
+                if (sizes[d] > 1 && (sizes[innermost] == 1 || pitches[d] < pitches[innermost]))
+                    innermost = d;
+            }
+            return innermost;
+        }
+    }
+
+    PermuteKernelBase::PermuteGeometry PermuteKernelBase::GetGeometry(const permute_params& params)
+    {
+        const auto in_dims = params.inputs[0].GetDims();
+        const auto out_dims = params.output.GetDims();
+
+        PermuteGeometry geometry;
+        for (size_t d = 0; d < 4; d++)
+        {
+            geometry.sizes[d] = in_dims[d].v;
+            geometry.inPitches[d] = in_dims[d].pitch;
+        }
+        // output dimension i takes coordinate of input dimension order[i]
+        for (size_t i = 0; i < 4; i++)
+        {
+            geometry.outPitches[params.order[i]] = out_dims[i].pitch;
+        }
+
+        geometry.inInnermost = GetInnermost(geometry.sizes, geometry.inPitches);
+        geometry.outInnermost = GetInnermost(geometry.sizes, geometry.outPitches);
+        return geometry;
+    }
+
+    bool PermuteKernelBase::Validate(const Params& p, const optional_params& o) const
+    {
+        if (p.GetType() != KernelType::PERMUTE ||
+            o.GetType() != KernelType::PERMUTE)
+        {
+            return false;
+        }
+
+        const auto& params = static_cast<const permute_params&>(p);
+        const auto& input = params.inputs[0];
+        const auto& output = params.output;
+        if (!input.SimpleLayout() || !output.SimpleLayout() ||
+            input.GetDims().size() != 4 || output.GetDims().size() != 4 || params.order.size() != 4 ||
+            input.GetDType() != output.GetDType())
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    JitConstants PermuteKernelBase::GetJitConstants(const permute_params& params) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+
+        const auto geometry = GetGeometry(params);
+        for (size_t d = 0; d < 4; d++)
+        {
+            jit.AddConstants({
+                MakeJitConstant("SIZE_" + std::to_string(d), geometry.sizes[d]),
+                MakeJitConstant("IN_PITCH_" + std::to_string(d), geometry.inPitches[d]),
+                MakeJitConstant("OUT_PITCH_" + std::to_string(d), geometry.outPitches[d]),
+            });
+        }
+
+        return jit;
+    }
+
+    KernelsData PermuteKernelBase::GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const
+    {
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        KernelData kd = KernelData::Default<permute_params>(params);
+        permute_params& newParams = *static_cast<permute_params*>(kd.params.get());
+
+        auto runInfo = SetDefault(newParams);
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        auto cldnn_jit = GetJitConstants(newParams);
+        std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = kd.kernels[0];
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+
+        kd.estimatedTime = estimated_time;
+
+        return{ kd };
+    }
+}
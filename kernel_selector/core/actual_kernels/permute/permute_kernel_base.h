@@ -0,0 +1,53 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "permute_kernel_ref.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // PermuteKernelBase
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Base of permute kernels specialized by permutation pattern. Everything is expressed in dimensions of the input:
+    // element at input coordinates idx is written at OUTPUT_OFFSET + sum(idx[d] * OUT_PITCH_d).
+    class PermuteKernelBase : public common_kernel_base
+    {
+    public:
+        using common_kernel_base::common_kernel_base;
+        virtual ~PermuteKernelBase() {}
+
+        using DispatchData = CommonDispatchData;
+
+        struct PermuteGeometry
+        {
+            size_t sizes[4];
+            size_t inPitches[4];
+            size_t outPitches[4];
+            size_t inInnermost;     // input dimension contiguous in input
+            size_t outInnermost;    // input dimension contiguous in output
+        };
+
+        static PermuteGeometry GetGeometry(const permute_params& params);
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        virtual JitConstants GetJitConstants(const permute_params& params) const;
+        virtual DispatchData SetDefault(const permute_params& params) const = 0;
+        KernelsData GetCommonKernelsData(const Params& params, const optional_params& options, float estimated_time) const;
+    };
+}
@@ -16,12 +16,16 @@
 
 #include "permute_kernel_selector.h"
 #include "permute_kernel_ref.h"
+#include "permute_kernel_tiled_transpose.h"
+#include "permute_kernel_vectorized.h"
  
 namespace kernel_selector {
 
     permute_kernel_selector::permute_kernel_selector()
     {
         Attach<PermuteKernelRef>();
+        Attach<PermuteKernelTiledTranspose>();
+        Attach<PermuteKernelVectorized>();
     }
 
     KernelsData permute_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -0,0 +1,119 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_tiled_transpose.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    static const size_t tile_size = 32;
+    static const size_t tile_rows = 8;
+
+    ParamsKey PermuteKernelTiledTranspose::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::INT32);
+        k.EnableInputDataType(Datatype::INT64);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::INT32);
+        k.EnableOutputDataType(Datatype::INT64);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::yxfb);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::yxfb);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool PermuteKernelTiledTranspose::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!PermuteKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const auto geometry = GetGeometry(static_cast<const permute_params&>(p));
+        return geometry.inInnermost != geometry.outInnermost;
+    }
+
+    PermuteKernelBase::DispatchData PermuteKernelTiledTranspose::SetDefault(const permute_params& params) const
+    {
+        const auto geometry = GetGeometry(params);
+        const size_t in_innermost = geometry.inInnermost;
+        const size_t out_innermost = geometry.outInnermost;
+
+        size_t others = 1;
+        for (size_t d = 0; d < 4; d++)
+        {
+            if (d != in_innermost && d != out_innermost)
+                others *= geometry.sizes[d];
+        }
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        kd.gws0 = Align(geometry.sizes[in_innermost], tile_size);
+        kd.gws1 = CeilDiv(geometry.sizes[out_innermost], tile_size) * tile_rows;
+        kd.gws2 = others;
+
+        kd.lws0 = tile_size;
+        kd.lws1 = tile_rows;
+        kd.lws2 = 1;
+
+        return kd;
+    }
+
+    JitConstants PermuteKernelTiledTranspose::GetJitConstants(const permute_params& params) const
+    {
+        auto jit = PermuteKernelBase::GetJitConstants(params);
+
+        const auto geometry = GetGeometry(params);
+        std::vector<size_t> others;
+        for (size_t d = 0; d < 4; d++)
+        {
+            if (d != geometry.inInnermost && d != geometry.outInnermost)
+                others.push_back(d);
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("DIM_IN_INNERMOST", geometry.inInnermost),
+            MakeJitConstant("DIM_OUT_INNERMOST", geometry.outInnermost),
+            MakeJitConstant("DIM_OTHER0", others[0]),
+            MakeJitConstant("DIM_OTHER1", others[1]),
+            MakeJitConstant("TILE_SIZE", tile_size),
+            MakeJitConstant("TILE_ROWS", tile_rows),
+        });
+
+        return jit;
+    }
+
+    KernelsData PermuteKernelTiledTranspose::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_1);
+    }
+}
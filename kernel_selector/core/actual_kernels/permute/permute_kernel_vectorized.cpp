@@ -0,0 +1,139 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "permute_kernel_vectorized.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        size_t GetVectorSize(const permute_params& params)
+        {
+            const auto geometry = PermuteKernelBase::GetGeometry(params);
+            const size_t row = geometry.sizes[geometry.inInnermost];
+            for (size_t vec : { 8, 4, 2 })
+            {
+                if (row % vec == 0)
+                    return vec;
+            }
+            return 1;
+        }
+    }
+
+    ParamsKey PermuteKernelVectorized::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::INT32);
+        k.EnableInputDataType(Datatype::INT64);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::INT32);
+        k.EnableOutputDataType(Datatype::INT64);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::yxfb);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::yxfb);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool PermuteKernelVectorized::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!PermuteKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        // activation functions are defined for scalars
+        const auto& params = static_cast<const permute_params&>(p);
+        if (params.activation.function != ActivationFunction::NONE)
+        {
+            return false;
+        }
+
+        const auto geometry = GetGeometry(params);
+        return geometry.inInnermost == geometry.outInnermost &&
+               geometry.inPitches[geometry.inInnermost] == 1 && geometry.outPitches[geometry.outInnermost] == 1;
+    }
+
+    PermuteKernelBase::DispatchData PermuteKernelVectorized::SetDefault(const permute_params& params) const
+    {
+        const auto geometry = GetGeometry(params);
+        const size_t innermost = geometry.inInnermost;
+
+        std::vector<size_t> others;
+        for (size_t d = 0; d < 4; d++)
+        {
+            if (d != innermost)
+                others.push_back(geometry.sizes[d]);
+        }
+
+        DispatchData kd;
+        kd.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        std::vector<size_t> global = { geometry.sizes[innermost] / GetVectorSize(params), others[0], others[1] * others[2] };
+        const auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    JitConstants PermuteKernelVectorized::GetJitConstants(const permute_params& params) const
+    {
+        auto jit = PermuteKernelBase::GetJitConstants(params);
+
+        const auto geometry = GetGeometry(params);
+        std::vector<size_t> others;
+        for (size_t d = 0; d < 4; d++)
+        {
+            if (d != geometry.inInnermost)
+                others.push_back(d);
+        }
+
+        jit.AddConstants({
+            MakeJitConstant("DIM_INNERMOST", geometry.inInnermost),
+            MakeJitConstant("DIM_OTHER0", others[0]),
+            MakeJitConstant("DIM_OTHER1", others[1]),
+            MakeJitConstant("DIM_OTHER2", others[2]),
+            MakeJitConstant("VEC_SIZE", GetVectorSize(params)),
+        });
+
+        return jit;
+    }
+
+    KernelsData PermuteKernelVectorized::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options, FORCE_PRIORITY_1);
+    }
+}
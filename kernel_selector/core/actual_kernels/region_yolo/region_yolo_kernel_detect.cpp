@@ -0,0 +1,115 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "region_yolo_kernel_detect.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    ParamsKey RegionYoloKernelDetect::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool RegionYoloKernelDetect::Validate(const Params& p, const optional_params&) const
+    {
+        const region_yolo_params& params = static_cast<const region_yolo_params&>(p);
+        const size_t anchors = params.do_softmax ? params.num : params.mask_size;
+
+        return params.max_boxes > 0 &&
+               params.coords == 4 &&
+               params.anchors.size() == 2 * anchors &&
+               params.inputs[0].Feature().v == anchors * (params.coords + params.classes + 1);
+    }
+
+    JitConstants RegionYoloKernelDetect::GetJitConstants(const region_yolo_params& ry) const
+    {
+        JitConstants jit = MakeBaseParamsJitConstants(ry);
+
+        jit.AddConstants({
+            MakeJitConstant("COORDS", ry.coords),
+            MakeJitConstant("CLASSES", ry.classes),
+            MakeJitConstant("ANCHORS_NUM", ry.anchors.size() / 2),
+            MakeJitConstant("ANCHORS", ry.anchors),
+            MakeJitConstant("DO_SOFTMAX", ry.do_softmax),
+            MakeJitConstant("CONFIDENCE_THRESHOLD", ry.confidence_threshold),
+            MakeJitConstant("MAX_BOXES", ry.max_boxes),
+        });
+
+        return jit;
+    }
+
+    KernelsData RegionYoloKernelDetect::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::REGION_YOLO);
+        const region_yolo_params& orgParams = static_cast<const region_yolo_params&>(params);
+
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
+        KernelData kd = KernelData::Default<region_yolo_params>(params, 2);
+        kd.internalBufferSizes.push_back(sizeof(int32_t));
+
+        const auto& input = orgParams.inputs[0];
+        for (size_t i = 0; i < kd.kernels.size(); i++)
+        {
+            const bool clear = i == 0;
+
+            DispatchData runInfo;
+            runInfo.fp16UnitUsed = input.GetDType() == Datatype::F16;
+
+            // clear: a work-item per output row; detect: a work-item per cell, anchor and image
+            std::vector<size_t> global = clear ? std::vector<size_t>{ orgParams.max_boxes, 1, 1 }
+                                               : std::vector<size_t>{ input.X().v * input.Y().v, orgParams.anchors.size() / 2, input.Batch().v };
+            auto local = GetOptimalLocalWorkGroupSizes(global);
+
+            runInfo.gws0 = global[0];
+            runInfo.gws1 = global[1];
+            runInfo.gws2 = global[2];
+
+            runInfo.lws0 = local[0];
+            runInfo.lws1 = local[1];
+            runInfo.lws2 = local[2];
+
+            auto cldnn_jit = GetJitConstants(orgParams);
+            cldnn_jit.AddConstant(MakeJitConstant("CLEAR_OUTPUT", clear));
+
+            auto entry_point = GetEntryPoint(kernelName, orgParams.layerID, options);
+            auto jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+            auto& kernel = kd.kernels[i];
+            FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+            kernel.arguments.push_back({ ArgumentDescriptor::Types::INTERNAL_BUFFER, 0 });
+        }
+
+        kd.estimatedTime = FORCE_PRIORITY_9;
+
+        return{ kd };
+    }
+}
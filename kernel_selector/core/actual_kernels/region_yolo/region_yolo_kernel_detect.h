@@ -0,0 +1,43 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "region_yolo_kernel_ref.h"
+
+namespace kernel_selector
+{
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // RegionYoloKernelDetect
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Detection mode (max_boxes > 0): activations, box decoding and thresholding in one pass over the input. The first
+    // kernel marks all output rows unused and resets the row counter (internal buffer), the second one appends the
+    // detections with an atomic increment of the counter.
+    class RegionYoloKernelDetect : public common_kernel_base
+    {
+    public:
+        RegionYoloKernelDetect() : common_kernel_base("region_yolo_gpu_detect") {}
+        virtual ~RegionYoloKernelDetect() {}
+
+        using DispatchData = CommonDispatchData;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const region_yolo_params& params) const;
+    };
+}
@@ -35,6 +35,12 @@ namespace kernel_selector
         return k;
     }
 
+    bool RegionYoloKernelRef::Validate(const Params& p, const optional_params&) const
+    {
+        // detection mode is served by RegionYoloKernelDetect
+        return static_cast<const region_yolo_params&>(p).max_boxes == 0;
+    }
+
     JitConstants RegionYoloKernelRef::GetJitConstants(const region_yolo_params& ry) const
     {
         JitConstants jit = MakeBaseParamsJitConstants(ry);
@@ -84,6 +90,11 @@ namespace kernel_selector
         assert(params.GetType() == KernelType::REGION_YOLO);
         const region_yolo_params& orgParams = static_cast<const region_yolo_params&>(params);
 
+        if (!Validate(params, options))
+        {
+            return{};
+        }
+
         DispatchData runInfo = SetDefault(orgParams);
         KernelData kd = KernelData::Default<region_yolo_params>(params);
 
@@ -33,6 +33,9 @@ namespace kernel_selector
         uint32_t num;
         uint32_t mask_size;
         bool do_softmax;
+        std::vector<float> anchors;
+        float confidence_threshold = 0.f;
+        uint32_t max_boxes = 0;
 
         virtual ParamsKey GetParamsKey() const
         {
@@ -64,6 +67,7 @@ namespace kernel_selector
 
 
     protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
         virtual JitConstants GetJitConstants(const region_yolo_params& params) const;
     };
 }
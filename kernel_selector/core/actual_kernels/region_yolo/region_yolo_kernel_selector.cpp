@@ -16,12 +16,14 @@
 
 #include "region_yolo_kernel_selector.h"
 #include "region_yolo_kernel_ref.h"
+#include "region_yolo_kernel_detect.h"
 
 namespace kernel_selector {
 
     region_yolo_kernel_selector::region_yolo_kernel_selector()
     {
         Attach<RegionYoloKernelRef>();
+        Attach<RegionYoloKernelDetect>();
     }
 
     KernelsData region_yolo_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -20,6 +20,8 @@
 #include "reorder_from_winograd_2x3_kernel.h"
 #include "reorder_to_winograd_2x3_kernel.h"
 #include "reorder_kernel_to_yxfb_batched.h"
+#include "reorder_kernel_tiled_transpose.h"
+#include "reorder_kernel_vectorized.h"
 
 namespace kernel_selector {
 
@@ -29,7 +31,9 @@ namespace kernel_selector {
         Attach<ReorderKernelFastBatch1>();
         Attach<ReorderFromWinograd2x3Kernel>();
         Attach<ReorderToWinograd2x3Kernel>();
+        Attach<ReorderKernelTiledTranspose>();
         Attach<ReorderKernel_to_yxfb_batched>();
+        Attach<ReorderKernelVectorized>();
     }
 
     KernelsData reorder_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -0,0 +1,166 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "reorder_kernel_tiled_transpose.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    namespace
+    {
+        const size_t tile_size = 32;
+        const size_t tile_rows = 8;
+
+        // dimensions of the tile: batch, feature and flattened y*x
+        enum TileDim { DIM_BATCH = 0, DIM_FEATURE = 1, DIM_SPATIAL = 2, DIM_UNSUPPORTED = -1 };
+
+        int GetInnermostDim(DataLayout l)
+        {
+            switch (l)
+            {
+            case DataLayout::bfyx:
+                return DIM_SPATIAL;
+            case DataLayout::byxf:
+            case DataLayout::byxf_af32:
+            case DataLayout::fs_bs_yx_bsv4_fsv32:
+                return DIM_FEATURE;
+            case DataLayout::yxfb:
+            case DataLayout::fyxb:
+                return DIM_BATCH;
+            default:
+                return DIM_UNSUPPORTED;
+            }
+        }
+
+        size_t GetDimSize(const DataTensor& t, int dim)
+        {
+            switch (dim)
+            {
+            case DIM_BATCH:     return t.Batch().v;
+            case DIM_FEATURE:   return t.Feature().v;
+            default:            return t.X().v * t.Y().v;
+            }
+        }
+    }
+
+    ParamsKey ReorderKernelTiledTranspose::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::UINT8);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::UINT8);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableDifferentTypes();
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::yxfb);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableInputLayout(DataLayout::byxf_af32);
+        k.EnableInputLayout(DataLayout::fs_bs_yx_bsv4_fsv32);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::yxfb);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::byxf_af32);
+        k.EnableOutputLayout(DataLayout::fs_bs_yx_bsv4_fsv32);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ReorderKernelTiledTranspose::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!ReorderKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const reorder_params& params = static_cast<const reorder_params&>(p);
+        const auto& input = params.inputs[0];
+        const auto& output = params.output;
+
+        // no reshape - the tile is addressed with the same coordinates on both sides
+        if (input.Batch().v != output.Batch().v ||
+            input.Feature().v != output.Feature().v ||
+            input.Y().v != output.Y().v ||
+            input.X().v != output.X().v)
+        {
+            return false;
+        }
+
+        const int in_innermost = GetInnermostDim(input.GetLayout());
+        const int out_innermost = GetInnermostDim(output.GetLayout());
+        if (in_innermost == DIM_UNSUPPORTED || out_innermost == DIM_UNSUPPORTED || in_innermost == out_innermost)
+        {
+            return false;
+        }
+
+        // degenerated tiles are better served by the element-wise kernels
+        return GetDimSize(input, in_innermost) > 1 && GetDimSize(input, out_innermost) > 1;
+    }
+
+    ReorderKernelBase::DispatchData ReorderKernelTiledTranspose::SetDefault(const reorder_params& params) const
+    {
+        const auto& input = params.inputs[0];
+        const int in_innermost = GetInnermostDim(input.GetLayout());
+        const int out_innermost = GetInnermostDim(params.output.GetLayout());
+        const int other = DIM_BATCH + DIM_FEATURE + DIM_SPATIAL - in_innermost - out_innermost;
+
+        DispatchData kd;
+
+        kd.gws0 = Align(GetDimSize(input, in_innermost), tile_size);
+        kd.gws1 = CeilDiv(GetDimSize(input, out_innermost), tile_size) * tile_rows;
+        kd.gws2 = GetDimSize(input, other);
+
+        kd.lws0 = tile_size;
+        kd.lws1 = tile_rows;
+        kd.lws2 = 1;
+
+        return kd;
+    }
+
+    JitConstants ReorderKernelTiledTranspose::GetJitConstants(const reorder_params& params) const
+    {
+        auto jit = ReorderKernelBase::GetJitConstants(params);
+
+        const int in_innermost = GetInnermostDim(params.inputs[0].GetLayout());
+        const int out_innermost = GetInnermostDim(params.output.GetLayout());
+
+        jit.AddConstants({
+            MakeJitConstant("DIM_IN_INNERMOST", in_innermost),
+            MakeJitConstant("DIM_OUT_INNERMOST", out_innermost),
+            MakeJitConstant("TILE_SIZE", tile_size),
+            MakeJitConstant("TILE_ROWS", tile_rows),
+        });
+
+        return jit;
+    }
+
+    KernelsData ReorderKernelTiledTranspose::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::REORDER);
+
+        const reorder_params& orgParams = static_cast<const reorder_params&>(params);
+
+        return GetCommonKernelsData(orgParams, options, FORCE_PRIORITY_1);
+    }
+}
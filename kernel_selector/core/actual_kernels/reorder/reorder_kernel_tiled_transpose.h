@@ -0,0 +1,40 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "reorder_kernel_base.h"
+
+namespace kernel_selector
+{
+    // Reorders between layouts with different innermost dimension (e.g. bfyx <-> byxf, bfyx <-> yxfb,
+    // bfyx <-> byxf_af32 / fs_bs_yx_bsv4_fsv32): blocks are transposed through local memory, so both
+    // reads and writes are coalesced. Type conversion and mean subtraction are applied on the way.
+    class ReorderKernelTiledTranspose : public ReorderKernelBase
+    {
+    public:
+        ReorderKernelTiledTranspose() : ReorderKernelBase("reorder_data_tiled_transpose") {}
+        virtual ~ReorderKernelTiledTranspose() {}
+
+        virtual ParamsKey GetSupportedKey() const override;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+
+    protected:
+        virtual JitConstants GetJitConstants(const reorder_params& params) const override;
+        virtual DispatchData SetDefault(const reorder_params& arg) const override;
+        bool Validate(const Params& p, const optional_params& o) const override;
+    };
+}
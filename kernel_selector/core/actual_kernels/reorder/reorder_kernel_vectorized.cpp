@@ -0,0 +1,117 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "reorder_kernel_vectorized.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    static const size_t vec_size = 8;
+
+    ParamsKey ReorderKernelVectorized::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::UINT8);
+        k.EnableInputDataType(Datatype::INT8);
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::UINT8);
+        k.EnableOutputDataType(Datatype::INT8);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableDifferentTypes();
+        k.EnableInputLayout(DataLayout::bf);
+        k.EnableInputLayout(DataLayout::fb);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableInputLayout(DataLayout::yxfb);
+        k.EnableInputLayout(DataLayout::byxf);
+        k.EnableInputLayout(DataLayout::fyxb);
+        k.EnableOutputLayout(DataLayout::bf);
+        k.EnableOutputLayout(DataLayout::fb);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::yxfb);
+        k.EnableOutputLayout(DataLayout::byxf);
+        k.EnableOutputLayout(DataLayout::fyxb);
+        k.EnableBatching();
+        return k;
+    }
+
+    bool ReorderKernelVectorized::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!ReorderKernelBase::Validate(p, o))
+        {
+            return false;
+        }
+
+        const reorder_params& params = static_cast<const reorder_params&>(p);
+        const auto& input = params.inputs[0];
+        const auto& output = params.output;
+
+        // both buffers are walked linearly, so element i of the input has to be element i of the output
+        if (input.GetLayout() != output.GetLayout() || !input.SameDimsSizes(output))
+        {
+            return false;
+        }
+
+        if (input.PitchesDifferFromLogicalDims() || output.PitchesDifferFromLogicalDims() ||
+            input.GetFirstElementOffset() != 0 || output.GetFirstElementOffset() != 0)
+        {
+            return false;
+        }
+
+        return true;
+    }
+
+    ReorderKernelBase::DispatchData ReorderKernelVectorized::SetDefault(const reorder_params& params) const
+    {
+        DispatchData kd;
+
+        std::vector<size_t> global = { CeilDiv(params.inputs[0].LogicalSize(), vec_size), 1, 1 };
+        auto local = GetOptimalLocalWorkGroupSizes(global);
+
+        kd.gws0 = global[0];
+        kd.gws1 = global[1];
+        kd.gws2 = global[2];
+
+        kd.lws0 = local[0];
+        kd.lws1 = local[1];
+        kd.lws2 = local[2];
+
+        return kd;
+    }
+
+    JitConstants ReorderKernelVectorized::GetJitConstants(const reorder_params& params) const
+    {
+        auto jit = ReorderKernelBase::GetJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("ELEMENTS_COUNT", params.inputs[0].LogicalSize()),
+            MakeJitConstant("VEC_SIZE", vec_size),
+        });
+
+        return jit;
+    }
+
+    KernelsData ReorderKernelVectorized::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::REORDER);
+
+        const reorder_params& orgParams = static_cast<const reorder_params&>(params);
+
+        return GetCommonKernelsData(orgParams, options, FORCE_PRIORITY_4);
+    }
+}
@@ -0,0 +1,96 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "roi_pooling_kernel_opt.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector {
+
+    namespace
+    {
+        // windows above this many elements are pooled straight from global memory
+        size_t GetWindowCapacity(const EngineInfo& engineInfo)
+        {
+            const size_t localMemSize = engineInfo.maxLocalMemSize ? static_cast<size_t>(engineInfo.maxLocalMemSize) : 32 * 1024;
+            return std::min<size_t>(4096, localMemSize / sizeof(float) / 2);
+        }
+    }
+
+    ParamsKey ROIPoolingKernelOpt::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::brfyx);
+        k.EnablePoolType(PoolType::MAX);
+        k.EnablePoolType(PoolType::AVG);
+        k.EnablePoolType(PoolType::ROI_ALIGN);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        k.EnableDifferentTypes();
+        return k;
+    }
+
+    bool ROIPoolingKernelOpt::Validate(const Params& p, const optional_params& o) const
+    {
+        if (!ROIPoolingKernelRef::Validate(p, o))
+        {
+            return false;
+        }
+
+        const roi_pooling_params& params = static_cast<const roi_pooling_params&>(p);
+
+        // with PS ROI pooling every bin reads a different channel, so there is no common window
+        return params.groupSize == 0;
+    }
+
+    ROIPoolingKernelOpt::DispatchData ROIPoolingKernelOpt::SetDefault(const roi_pooling_params& params) const
+    {
+        DispatchData kd;
+
+        kd.fp16UnitUsed = (params.inputs[0].GetDType() == Datatype::F16);
+
+        const size_t lws = GetReductionWorkGroupSize(params.engineInfo, params.pooledWidth * params.pooledHeight);
+
+        kd.gws0 = lws;
+        kd.gws1 = params.inputs[1].Batch().v;
+        kd.gws2 = params.output.Feature().v;
+
+        kd.lws0 = lws;
+        kd.lws1 = 1;
+        kd.lws2 = 1;
+
+        kd.effiency = FORCE_PRIORITY_7;
+
+        return kd;
+    }
+
+    JitConstants ROIPoolingKernelOpt::GetJitConstants(const roi_pooling_params& params) const
+    {
+        JitConstants jit = ROIPoolingKernelRef::GetJitConstants(params);
+
+        jit.AddConstants({
+            MakeJitConstant("LWS", GetReductionWorkGroupSize(params.engineInfo, params.pooledWidth * params.pooledHeight)),
+            MakeJitConstant("WINDOW_CAPACITY", GetWindowCapacity(params.engineInfo)),
+        });
+
+        return jit;
+    }
+}
@@ -0,0 +1,38 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "roi_pooling_kernel_ref.h"
+
+namespace kernel_selector
+{
+    // Work-group per ROI and channel: the ROI's feature window is staged in local memory by the whole
+    // work-group, then work-items pool the output bins from it.
+    class ROIPoolingKernelOpt : public ROIPoolingKernelRef
+    {
+    public:
+        ROIPoolingKernelOpt() : ROIPoolingKernelRef("roi_pooling_opt") {}
+        virtual ~ROIPoolingKernelOpt() {}
+
+        virtual ParamsKey GetSupportedKey() const override;
+
+    protected:
+        bool Validate(const Params& p, const optional_params& o) const override;
+        JitConstants GetJitConstants(const roi_pooling_params& params) const override;
+        DispatchData SetDefault(const roi_pooling_params& params) const override;
+    };
+}
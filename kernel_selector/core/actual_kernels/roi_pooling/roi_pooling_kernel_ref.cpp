@@ -30,6 +30,7 @@ namespace kernel_selector {
         k.EnablePoolType(PoolType::MAX);
         k.EnablePoolType(PoolType::AVG);
         k.EnablePoolType(PoolType::BILINEAR);
+        k.EnablePoolType(PoolType::ROI_ALIGN);
         k.EnableTensorOffset();
         k.EnableTensorPitches();
         k.EnableBatching();
@@ -37,9 +38,9 @@ namespace kernel_selector {
         return k;
     }
 
-    static ROIPoolingKernelRef::DispatchData SetDefault(const roi_pooling_params& params)
+    ROIPoolingKernelRef::DispatchData ROIPoolingKernelRef::SetDefault(const roi_pooling_params& params) const
     {
-        ROIPoolingKernelRef::DispatchData kd;
+        DispatchData kd;
 
         kd.fp16UnitUsed = (params.inputs[0].GetDType() == Datatype::F16);
 
@@ -57,6 +58,8 @@ namespace kernel_selector {
         kd.lws1 = 1;
         kd.lws2 = 1;
 
+        kd.effiency = FORCE_PRIORITY_9;
+
         return kd;
     }
 
@@ -69,6 +72,7 @@ namespace kernel_selector {
             MakeJitConstant("POOLED_WIDTH",      rp.pooledWidth),
             MakeJitConstant("SPATIAL_SCALE",     rp.spatialScale),
             MakeJitConstant("GROUP_SIZE",        rp.groupSize),
+            MakeJitConstant("SAMPLING_RATIO",    rp.samplingRatio),
             MakeJitConstant(toString(rp.mode) + "_POOLING", 1),
         });
 
@@ -84,7 +88,7 @@ namespace kernel_selector {
         assert(params.GetType() == KernelType::ROI_POOLING);
         const roi_pooling_params& orgParams = static_cast<const roi_pooling_params&>(params);
 
-        if (orgParams.activation.function != ActivationFunction::NONE)
+        if (orgParams.activation.function != ActivationFunction::NONE || !Validate(params, options))
         {
             return{};
         }
@@ -100,7 +104,7 @@ namespace kernel_selector {
         FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
         kernel.arguments.push_back({ ArgumentDescriptor::Types::INPUT, 1 });
 
-        kd.estimatedTime = FORCE_PRIORITY_9;
+        kd.estimatedTime = runInfo.effiency;
 
         return{ kd };
     }
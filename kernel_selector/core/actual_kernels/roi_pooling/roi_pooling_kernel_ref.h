@@ -31,11 +31,14 @@ namespace kernel_selector
         size_t      pooledWidth = 0;
         size_t      pooledHeight = 0;
         size_t      groupSize = 0;
+        size_t      samplingRatio = 0;
         float       spatialScale = 1.f;
 
         virtual ParamsKey GetParamsKey() const
         {
-            return base_params::GetParamsKey();
+            ParamsKey k = base_params::GetParamsKey();
+            k.EnablePoolType(mode);
+            return k;
         }
     };
 
@@ -62,6 +65,9 @@ namespace kernel_selector
         virtual ParamsKey GetSupportedKey() const override;
 
     protected:
-        JitConstants GetJitConstants(const roi_pooling_params& params) const;
+        ROIPoolingKernelRef(const std::string& name) : common_kernel_base(name) {}
+
+        virtual JitConstants GetJitConstants(const roi_pooling_params& params) const;
+        virtual DispatchData SetDefault(const roi_pooling_params& params) const;
     };
 }
\ No newline at end of file
@@ -16,12 +16,14 @@
 
 #include "roi_pooling_kernel_selector.h"
 #include "roi_pooling_kernel_ref.h"
+#include "roi_pooling_kernel_opt.h"
  
 namespace kernel_selector 
 {
     roi_pooling_kernel_selector::roi_pooling_kernel_selector()
     {
         Attach<ROIPoolingKernelRef>();
+        Attach<ROIPoolingKernelOpt>();
     }
 
     KernelsData roi_pooling_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
@@ -47,8 +47,8 @@ namespace kernel_selector
 
         kd.normIndex = 0;
 
-        // We have two units of data per work item in current implementation.
-        auto local_mem_per_wi = 2 * (kd.fp16UnitUsed ? sizeof(short) : sizeof(float));
+        // Reductions accumulate in float local memory, also for fp16 data.
+        auto local_mem_per_wi = 2 * sizeof(float);
         // Combining device execution and local memory restrictions to compute maximum possible LWS.
         auto max_lws = std::min(params.engineInfo.maxWorkGroupSize, params.engineInfo.maxLocalMemSize / local_mem_per_wi);
 
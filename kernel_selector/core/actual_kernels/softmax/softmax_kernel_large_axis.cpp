@@ -0,0 +1,74 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "softmax_kernel_large_axis.h"
+#include "kernel_selector_utils.h"
+
+namespace kernel_selector
+{
+    // below this size the class axis fits the private memory of the items class kernels
+    static const size_t large_axis_threshold = 1024;
+
+    ParamsKey SoftmaxKernelLargeAxis::GetSupportedKey() const
+    {
+        return GetDefaultSupportedKey();
+    }
+
+    SoftmaxKernelLargeAxis::Parent::DispatchData SoftmaxKernelLargeAxis::SetDefault(const softmax_params& params, const optional_params& optParams) const
+    {
+        auto runInfo = Parent::SetDefault(params, optParams);
+        auto& input = params.inputs[0];
+
+        size_t item_class_count = 0;
+        switch (params.dim)
+        {
+        case SoftmaxDim::X:
+            item_class_count = input.X().v;
+            break;
+        case SoftmaxDim::Y:
+            item_class_count = input.Y().v;
+            break;
+        case SoftmaxDim::FEATURE:
+            item_class_count = input.Feature().v;
+            break;
+        default:
+            break;
+        }
+
+        const auto global = GetSoftmaxDimGlobalSizes(params.dim, params.output);
+        assert(global.size() == 3);
+
+        runInfo.dataSetSize = item_class_count;
+        runInfo.dataSetsCount = global[0] * global[1] * global[2];
+
+        runInfo.lws0 = GetReductionWorkGroupSize(params.engineInfo, item_class_count);
+        runInfo.lws1 = 1;
+        runInfo.lws2 = 1;
+
+        runInfo.gws0 = global[0] * runInfo.lws0;
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.effiency = item_class_count >= large_axis_threshold ? FORCE_PRIORITY_5 : DONT_USE_IF_HAVE_SOMETHING_ELSE;
+
+        return runInfo;
+    }
+
+    KernelsData SoftmaxKernelLargeAxis::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        return GetCommonKernelsData(params, options);
+    }
+}
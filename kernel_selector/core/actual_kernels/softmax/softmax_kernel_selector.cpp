@@ -19,6 +19,7 @@
 #include "softmax_kernel_bf.h"
 #include "softmax_kernel_fb.h"
 #include "softmax_kernel_items_class_optimized.h"
+#include "softmax_kernel_large_axis.h"
 
 namespace kernel_selector {
 
@@ -28,6 +29,7 @@ namespace kernel_selector {
         Attach<SoftmaxKernel_bf>();
         Attach<SoftmaxKernel_fb>();
         Attach<SoftmaxKerneItemsClassOptimized>();
+        Attach<SoftmaxKernelLargeAxis>();
     }
 
     KernelsData softmax_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
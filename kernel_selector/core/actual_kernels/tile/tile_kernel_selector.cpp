@@ -16,12 +16,14 @@
 
 #include "tile_kernel_selector.h"
 #include "tile_kernel_ref.h"
+#include "tile_kernel_vectorized.h"
  
 namespace kernel_selector {
 
     tile_kernel_selector::tile_kernel_selector()
     {
         Attach<TileKernelRef>();
+        Attach<TileKernelVectorized>();
     }
 
     KernelsData tile_kernel_selector::GetBestKernels(const Params& params, const optional_params& options) const
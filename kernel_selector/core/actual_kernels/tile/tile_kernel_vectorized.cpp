@@ -0,0 +1,90 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "tile_kernel_vectorized.h"
+#include "kernel_selector_utils.h"
+#include "common_tools.h"
+
+namespace kernel_selector
+{
+    static const size_t vec_size = 8;
+
+    ParamsKey TileKernelVectorized::GetSupportedKey() const
+    {
+        ParamsKey k;
+        k.EnableInputDataType(Datatype::F16);
+        k.EnableInputDataType(Datatype::F32);
+        k.EnableOutputDataType(Datatype::F16);
+        k.EnableOutputDataType(Datatype::F32);
+        k.EnableInputLayout(DataLayout::bfyx);
+        k.EnableOutputLayout(DataLayout::bfyx);
+        k.EnableTensorOffset();
+        k.EnableTensorPitches();
+        k.EnableBatching();
+        return k;
+    }
+
+    CommonDispatchData TileKernelVectorized::SetDefault(const tile_params& params, const optional_params&) const
+    {
+        const auto& output = params.output;
+
+        CommonDispatchData runInfo;
+
+        std::vector<size_t> global{CeilDiv(output.X().v, vec_size), output.Y().v, output.Batch().v * output.Feature().v};
+        const auto& local = GetOptimalLocalWorkGroupSizes(global);
+
+        runInfo.gws0 = global[0];
+        runInfo.gws1 = global[1];
+        runInfo.gws2 = global[2];
+
+        runInfo.lws0 = local[0];
+        runInfo.lws1 = local[1];
+        runInfo.lws2 = local[2];
+
+        runInfo.fp16UnitUsed = params.inputs[0].GetDType() == Datatype::F16;
+
+        return runInfo;
+    }
+
+    JitConstants TileKernelVectorized::GetJitConstants(const tile_params& params) const
+    {
+        // output sizes are the input sizes multiplied by the tiles along the axis, so no tile specific constants needed
+        JitConstants jit = MakeBaseParamsJitConstants(params);
+        jit.AddConstant(MakeJitConstant("VEC_SIZE", vec_size));
+        return jit;
+    }
+
+    KernelsData TileKernelVectorized::GetKernelsData(const Params& params, const optional_params& options) const
+    {
+        assert(params.GetType() == KernelType::TILE);
+
+        KernelData kd = KernelData::Default<tile_params>(params);
+        tile_params& newParams = *static_cast<tile_params*>(kd.params.get());
+
+        auto runInfo = SetDefault(newParams, options);
+        auto entry_point = GetEntryPoint(kernelName, newParams.layerID, options);
+        auto cldnn_jit = GetJitConstants(newParams);
+        std::string jit = CreateJit(kernelName, cldnn_jit, entry_point);
+
+        auto& kernel = kd.kernels[0];
+
+        FillCLKernelData(kernel, runInfo, params.engineInfo, kernelName, jit, entry_point);
+
+        kd.estimatedTime = FORCE_PRIORITY_7;
+
+        return{ kd };
+    }
+}
@@ -0,0 +1,36 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include "tile_kernel_ref.h"
+
+namespace kernel_selector
+{
+    // Tile as a broadcast of the input to the output sizes: each work-item writes VEC_SIZE consecutive elements
+    // of an output row with vector stores.
+    class TileKernelVectorized : public common_kernel_base
+    {
+    public:
+        TileKernelVectorized() : common_kernel_base("tile_gpu_vectorized") {}
+        virtual ~TileKernelVectorized() {}
+
+        virtual JitConstants GetJitConstants(const tile_params& params) const;
+        virtual CommonDispatchData SetDefault(const tile_params& params, const optional_params&) const;
+        virtual KernelsData GetKernelsData(const Params& params, const optional_params& options) const override;
+        virtual ParamsKey GetSupportedKey() const override;
+    };
+}
@@ -19,6 +19,7 @@
 #include <iostream>
 #include <sstream>
 #include <fstream>
+#include <cmath>
 
  
 namespace kernel_selector 
@@ -27,6 +28,30 @@ namespace kernel_selector
     {
         std::lock_guard<std::mutex> lock(mutex);
 
+        // Binary tuning database (see cache/tuning_cache_db_gen.py) is memory-mapped and used directly
+        auto binaryCache = onlineBinaryCache.find(tuningFilePath);
+        if (binaryCache == onlineBinaryCache.end() &&
+            onlineCache.find(tuningFilePath) == onlineCache.end() &&
+            tuning_cache_db::is_tuning_cache_db(tuningFilePath))
+        {
+            if (tuningMode != TuningMode::TUNING_USE_CACHE)
+            {
+                throw std::runtime_error("Tuning file: " + tuningFilePath + " is a read-only binary tuning database. It can be used only in USE_CACHE mode.");
+            }
+
+            auto db = tuning_cache_db::load(tuningFilePath);
+            if (!db->has_section(compute_units_count))
+            {
+                throw std::runtime_error("Tuning file: " + tuningFilePath + " doesn't contain data for " + std::to_string(compute_units_count) + " compute units.");
+            }
+            binaryCache = onlineBinaryCache.emplace(tuningFilePath, db).first;
+        }
+
+        if (binaryCache != onlineBinaryCache.end())
+        {
+            return binaryCache->second->find(compute_units_count, std::stoull(hash));
+        }
+
         //First, check if the tuning file has been already loaded to cache
         auto const& tuningFileCache = onlineCache.find(tuningFilePath);
         if (tuningFileCache == onlineCache.end())
@@ -137,22 +162,42 @@ namespace kernel_selector
         cachedKernelsFile.close();
     }
 
-    std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const uint32_t computeUnitsCount, const std::string& hash)
+    void AutoTuner::StoreTunedShape(const KernelType kType, const std::vector<size_t>& shape, const std::string& implementationName, const int tuneIndex)
     {
-        auto const& deviceCache = auto_tuner_offline::get_instance(computeUnitsCount)->get_tuning_data();
-        if (deviceCache.td.empty())
-        {
-            return std::make_pair("", 0);
-        }
-        auto const& deviceCacheData = deviceCache.td;
-        auto const& hashData = deviceCacheData.find(hash);
-        if (hashData == deviceCacheData.end())
-        {
-            return std::make_pair("", 0);
-        }
-        else
+        std::lock_guard<std::mutex> lock(mutex);
+        tunedShapes.push_back({ kType, shape, implementationName, tuneIndex });
+    }
+
+    std::tuple<std::string, int> AutoTuner::FindNearestTunedShape(const KernelType kType, const std::vector<size_t>& shape)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+
+        // distance is a sum of log2 ratios of dimensions, so 2x larger tensor along one axis is as far as 2x smaller one
+        const tuned_shape* nearest = nullptr;
+        double nearestDistance = 0.0;
+        for (const auto& tuned : tunedShapes)
         {
-            return hashData->second;
+            if (tuned.kType != kType || tuned.shape.size() != shape.size())
+                continue;
+
+            double distance = 0.0;
+            for (size_t i = 0; i < shape.size(); i++)
+                distance += std::abs(std::log2(static_cast<double>(tuned.shape[i] + 1)) - std::log2(static_cast<double>(shape[i] + 1)));
+
+            if (nearest == nullptr || distance < nearestDistance)
+            {
+                nearest = &tuned;
+                nearestDistance = distance;
+            }
         }
+
+        if (nearest == nullptr)
+            return std::make_tuple("", 0);
+        return std::make_tuple(nearest->implementationName, nearest->tuneIndex);
+    }
+
+    std::tuple<std::string, int> AutoTuner::LoadKernelOffline(const uint32_t computeUnitsCount, const std::string& hash)
+    {
+        return auto_tuner_offline::get_instance()->find(computeUnitsCount, hash);
     }
 }
@@ -19,7 +19,10 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <memory>
+#include <vector>
 #include "kernel_selector_common.h"
+#include "tuning_cache_db.h"
 
 namespace kernel_selector 
 {
@@ -35,30 +38,46 @@ namespace kernel_selector
         std::tuple<std::string, int> LoadKernelOnline(const TuningMode tuningMode, const std::string& tuningFilePath, const uint32_t compute_units_count, const std::string& driverVersion, const std::string& hostVersion, const std::string& hash);
         void StoreKernel(const std::string& tuningFilePath, const std::string& hash, const std::string& implementationName, const int tuneIndex);
         std::tuple<std::string, int> LoadKernelOffline(const uint32_t compute_units_count, const std::string& hash);
+        // Remembers config tuned for given layer shape, so it can seed tuning of layers with similar shapes.
+        void StoreTunedShape(const KernelType kType, const std::vector<size_t>& shape, const std::string& implementationName, const int tuneIndex);
+        // Returns (implementation name, tuning index) tuned for the nearest shape of the same kernel type, or empty name if there is none.
+        std::tuple<std::string, int> FindNearestTunedShape(const KernelType kType, const std::vector<size_t>& shape);
 
     private:    
         std::map<std::string, tuning_data> onlineCache; // Tuning file name -> kernel/config per hash (hash -> [implementation name, tuning index])
+        std::map<std::string, std::shared_ptr<tuning_cache_db>> onlineBinaryCache; // Tuning file name -> memory-mapped binary tuning database
+        struct tuned_shape
+        {
+            KernelType kType;
+            std::vector<size_t> shape;
+            std::string implementationName;
+            int tuneIndex;
+        };
+        std::vector<tuned_shape> tunedShapes; // Layers tuned on-line by this process
         std::mutex mutex; // Mutex to synchronize cache updates
         
         /*
             The offline cache contains for each hash (that is based on the node params) the best kernel/config per device id.
             This cache can be ignored by setting ENABLE_OFFLINE_TUNING_CACHE to 0 in kernel_selector.cpp (in this case the default path will be chosen).
+            The cache is stored in binary tuning database (cache/tuning_cache.db) with a section per compute units count.
             Follow these steps in order to change the data inside this cache:
-            1. Find the proper device ID entry.
-               For example: 0x193B for SKL GT4. 
-               This device ID is also written in the cache file that is generated in the on-line mode.
+            1. Generate tuning file in the on-line mode (TUNING_TUNE_AND_CACHE) on the target device.
+               The compute units count of the device is written in the first line of this file.
             2. Find the hash of the node you want to change.
                This hash can be obtained by:
                std::string hash = std::to_string(create_hash(params.to_string()));
-            3. Change the kernel name and/or config index.
+            3. Change the kernel name and/or config index in the tuning file.
                For example:
-               { "17001023283013862129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) }
+               17001023283013862129 convolution_gpu_bfyx_os_iyx_osv16 203
                Means:
                For hash 17001023283013862129 the best kernel name is convolution_gpu_bfyx_os_iyx_osv16 and the config index is 203.
                If the config index is -1, it means that this is the default config for this kernel.
                If there are more configs (for example for convolution_gpu_bfyx_os_iyx_osv16 kernel) you need to find the proper config index.
                For example, for the convolution_gpu_bfyx_os_iyx_osv16 kernel you need to take a look in the constructor (ConvolutionKernel_bfyx_os_iyx_osv16::ConvolutionKernel_bfyx_os_iyx_osv16) – 
                this is the index in the autoTuneOptions array.
+            4. Merge the tuning file into the database (entries of the tuning file replace the ones in the database):
+               python cache/tuning_cache_db_gen.py -online <tuning file> -db cache/tuning_cache.db -out_db cache/tuning_cache.db
+            The same tool converts tuning files to binary databases which can be used in TUNING_USE_CACHE mode instead of text files.
         */
     };
 }
\ No newline at end of file
@@ -18,26 +18,40 @@
 #include "auto_tuner_offline.h"
 namespace kernel_selector 
 {
+    namespace
+    {
+        alignas(8) const unsigned char tuning_cache_db_data[] =
+        {
+            #include "ks_tuning_cache_db.inc"
+        };
+    }
+
     std::shared_ptr<auto_tuner_offline> auto_tuner_offline::instance = 0;
     std::mutex auto_tuner_offline::mutex;
 
-    auto_tuner_offline::auto_tuner_offline(const uint32_t compute_units_count)
+    auto_tuner_offline::auto_tuner_offline()
+        : db(tuning_cache_db_data, sizeof(tuning_cache_db_data))
     {
-        uint32_t temp_compute_units_count = compute_units_count;
-        // TODO: this is temporary solution of cases where user has non-tuned configuration. needs to implement better logic
-        // i.e. create table with number of eu's configuration that will point to common cache.
-        if (sku_cache_fillers.find(compute_units_count) == sku_cache_fillers.end())
-            temp_compute_units_count = 24;
-        sku_cache_fillers.at(temp_compute_units_count)(t_data);
     }
 
-    std::shared_ptr<auto_tuner_offline> auto_tuner_offline::get_instance(const uint32_t computeUnitsCount)
+    std::shared_ptr<auto_tuner_offline> auto_tuner_offline::get_instance()
     {
         std::lock_guard<std::mutex> lock(mutex);
         if (instance == nullptr)
         {
-            instance = std::make_shared<auto_tuner_offline>(auto_tuner_offline(computeUnitsCount));
+            instance.reset(new auto_tuner_offline());
         }
         return instance;
     }
+
+    std::tuple<std::string, int> auto_tuner_offline::find(uint32_t computeUnitsCount, const std::string& hash) const
+    {
+        uint32_t compute_units_count = computeUnitsCount;
+        if (!db.has_section(compute_units_count))
+        {
+            auto alias = sku_aliases.find(compute_units_count);
+            compute_units_count = alias != sku_aliases.end() ? alias->second : default_compute_units_count;
+        }
+        return db.find(compute_units_count, std::stoull(hash));
+    }
 }
\ No newline at end of file
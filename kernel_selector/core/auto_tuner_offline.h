@@ -18,57 +18,38 @@
 
 #include <string>
 #include <mutex>
+#include <map>
+#include <memory>
+#include <tuple>
 #include "auto_tuner.h"
+#include "tuning_cache_db.h"
 #include "kernel_selector_common.h"
 
 namespace kernel_selector 
 {
-    //72 compute units GT4e
-    void tuning_cache_72(tuning_data&);
-    void tuning_cache_72_1(tuning_data&);
-    void tuning_cache_72_2(tuning_data&);
-    void tuning_cache_72_3(tuning_data&);
-    //24 Compute units GT2
-    void tuning_cache_24(tuning_data&);
-    void tuning_cache_24_1(tuning_data&);
-    void tuning_cache_24_2(tuning_data&);
-    void tuning_cache_24_3(tuning_data&);
-    //48 Compute units GT3e 
-    void tuning_cache_48(tuning_data&);
-    void tuning_cache_48_1(tuning_data&);
-    void tuning_cache_48_2(tuning_data&);
-    void tuning_cache_48_3(tuning_data&);
-    //64 Compute units ICL GT2
-    void tuning_cache_64(tuning_data&);
-    void tuning_cache_64_1(tuning_data&);
-    //APL 
-    void tuning_cache_18(tuning_data&);
-    //APL E3930.
-    void tuning_cache_12(tuning_data&);
-
+    // Offline tuning cache embedded into the library. Data is kept in binary tuning database generated at build time
+    // from cache/tuning_cache.db (see cache/tuning_cache_db_gen.py), with one section per compute units count:
+    // 72 - GT4e, 48 - GT3e, 24 - GT2, 64 - ICL GT2, 18 - APL.
     class auto_tuner_offline
     {
     private:
         static std::shared_ptr<auto_tuner_offline> instance;
         static std::mutex mutex;
-        auto_tuner_offline() = delete;
-        // this is singleton implementation, if called twice with different parameter, 
-        // second call param will be ignored
-        auto_tuner_offline(const uint32_t computeUnitsCount);
-        tuning_data t_data;
+        auto_tuner_offline();
+        tuning_cache_db db;
 
-        const std::map<uint32_t, void(*)(tuning_data&)> sku_cache_fillers
+        // compute units count without its own section -> section which should be used instead
+        const std::map<uint32_t, uint32_t> sku_aliases
         {
-            { 72 , tuning_cache_72 },
-            { 24 , tuning_cache_24 },
-            { 48 , tuning_cache_48 },
-            { 64 , tuning_cache_64 },
-            { 18 , tuning_cache_18 },
-            { 12 , tuning_cache_18 },
+            { 12, 18 }, // APL E3930
         };
+        // TODO: this is temporary solution of cases where user has non-tuned configuration. needs to implement better logic
+        // i.e. create table with number of eu's configuration that will point to common cache.
+        static const uint32_t default_compute_units_count = 24;
 
     public:
-        static std::shared_ptr<auto_tuner_offline> get_instance(const uint32_t computeUnitsCount);
-        tuning_data get_tuning_data() const { return t_data; }
+        static std::shared_ptr<auto_tuner_offline> get_instance();
+        // Returns (kernel name, tune index) for given hash, or empty kernel name if hash is not present in the cache.
+        std::tuple<std::string, int> find(uint32_t computeUnitsCount, const std::string& hash) const;
    };
 }
\ No newline at end of file
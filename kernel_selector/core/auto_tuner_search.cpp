@@ -0,0 +1,182 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "auto_tuner_search.h"
+#include <algorithm>
+#include <chrono>
+#include <numeric>
+
+namespace kernel_selector
+{
+    const size_t AutoTuneSearch::minSurvivors;
+    const uint32_t AutoTuneSearch::exhaustiveRuns;
+    const uint32_t AutoTuneSearch::maxRuns;
+    const size_t AutoTuneSearch::reductionFactor;
+    const size_t AutoTuneSearch::measureBatchSize;
+
+    AutoTuneSearch::AutoTuneSearch(bool exhaustive, uint32_t timeBudgetMs, uint32_t computeUnitsCount)
+        : exhaustive(exhaustive)
+        , timeBudgetMs(timeBudgetMs)
+        , computeUnitsCount(computeUnitsCount)
+    {}
+
+    float AutoTuneSearch::EstimateOccupancy(const KernelData& kernelData, uint32_t computeUnitsCount)
+    {
+        if (kernelData.kernels.empty() || computeUnitsCount == 0)
+            return 1.0f;
+
+        const auto& workGroups = kernelData.kernels[0].workGroups;
+        size_t groups = 1;
+        for (size_t i = 0; i < workGroups.global.size(); i++)
+        {
+            const size_t local = (i < workGroups.local.size() && workGroups.local[i] != 0) ? workGroups.local[i] : 1;
+            groups *= (workGroups.global[i] + local - 1) / local;
+        }
+        if (groups == 0)
+            return 0.0f;
+
+        const size_t waves = (groups + computeUnitsCount - 1) / computeUnitsCount;
+        return static_cast<float>(groups) / static_cast<float>(waves * computeUnitsCount);
+    }
+
+    size_t AutoTuneSearch::Prune(std::vector<TuningCandidate>& candidates) const
+    {
+        if (candidates.size() <= minSurvivors)
+            return 0;
+
+        std::vector<float> occupancy(candidates.size());
+        for (size_t i = 0; i < candidates.size(); i++)
+            occupancy[i] = EstimateOccupancy(candidates[i].kernelData, computeUnitsCount);
+        const float threshold = 0.5f * *std::max_element(occupancy.begin(), occupancy.end());
+
+        std::vector<size_t> order(candidates.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return occupancy[a] > occupancy[b]; });
+
+        std::vector<bool> keep(candidates.size());
+        for (size_t i = 0; i < candidates.size(); i++)
+            keep[i] = candidates[i].seed || occupancy[i] >= threshold;
+        for (size_t i = 0; i < minSurvivors; i++)
+            keep[order[i]] = true;
+
+        std::vector<TuningCandidate> kept;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if (keep[i])
+                kept.push_back(std::move(candidates[i]));
+        }
+        const size_t pruned = candidates.size() - kept.size();
+        candidates = std::move(kept);
+        return pruned;
+    }
+
+    int AutoTuneSearch::Run(std::vector<TuningCandidate>& candidates, const TuningRunner& runner, TuningSearchStats& stats) const
+    {
+        using clock = std::chrono::high_resolution_clock;
+        const auto start = clock::now();
+        auto budget_exceeded = [&]()
+        {
+            return timeBudgetMs != 0 && clock::now() - start >= std::chrono::milliseconds(timeBudgetMs);
+        };
+        auto finish = [&](int best)
+        {
+            stats.tuningTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start).count();
+            if (best >= 0)
+                stats.bestRunTime = candidates[best].kernelData.runTime;
+            return best;
+        };
+
+        stats.candidates = candidates.size();
+        if (candidates.empty())
+            return finish(-1);
+
+        if (!exhaustive)
+            stats.pruned = Prune(candidates);
+
+        // returns false when the budget was exceeded before all given candidates were measured
+        // (at least one batch is always measured, so there is a config to return)
+        auto measure = [&](const std::vector<size_t>& indices, uint32_t runs)
+        {
+            for (size_t first = 0; first < indices.size(); first += measureBatchSize)
+            {
+                if (stats.kernelRuns != 0 && budget_exceeded())
+                {
+                    stats.budgetExceeded = true;
+                    return false;
+                }
+
+                const std::vector<size_t> batch(indices.begin() + first, indices.begin() + std::min(first + measureBatchSize, indices.size()));
+                const auto runTimes = runner(batch, runs);
+                for (size_t i = 0; i < batch.size(); i++)
+                    candidates[batch[i]].kernelData.runTime = runTimes[i];
+                stats.kernelRuns += batch.size() * runs;
+                if (first == 0)
+                    stats.rounds++;
+            }
+            return true;
+        };
+        auto faster = [&](size_t a, size_t b) { return candidates[a].kernelData.runTime < candidates[b].kernelData.runTime; };
+
+        std::vector<size_t> survivors(candidates.size());
+        std::iota(survivors.begin(), survivors.end(), 0);
+
+        if (exhaustive)
+        {
+            measure(survivors, exhaustiveRuns);
+            return finish(static_cast<int>(*std::min_element(survivors.begin(), survivors.end(), faster)));
+        }
+
+        // seeds are measured precisely first, their time is the reference for early termination
+        std::vector<size_t> seeds;
+        for (size_t i = 0; i < candidates.size(); i++)
+        {
+            if (candidates[i].seed)
+                seeds.push_back(i);
+        }
+        int best = -1;
+        uint64_t reference = std::numeric_limits<uint64_t>::max();
+        if (!seeds.empty())
+        {
+            measure(seeds, maxRuns);
+            best = static_cast<int>(*std::min_element(seeds.begin(), seeds.end(), faster));
+            reference = candidates[best].kernelData.runTime;
+        }
+
+        uint32_t runs = 1;
+        while (true)
+        {
+            // candidates not measured in an interrupted round keep their time from the previous one (or max if none)
+            const bool completed = measure(survivors, runs);
+            std::stable_sort(survivors.begin(), survivors.end(), faster);
+            best = static_cast<int>(survivors[0]);
+            if (!completed)
+                break;
+
+            size_t keep = (survivors.size() + reductionFactor - 1) / reductionFactor;
+            while (keep > 1 && reference != std::numeric_limits<uint64_t>::max() &&
+                   candidates[survivors[keep - 1]].kernelData.runTime > 2 * reference)
+                keep--;
+            if (keep == survivors.size())
+                break;
+            survivors.resize(keep);
+            if (survivors.size() == 1)
+                break;
+            runs = std::min(runs * 2, maxRuns);
+        }
+
+        return finish(best);
+    }
+}
@@ -0,0 +1,86 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <functional>
+#include <limits>
+#include <string>
+#include <vector>
+#include "kernel_selector_common.h"
+
+namespace kernel_selector
+{
+    struct TuningCandidate
+    {
+        KernelData kernelData;
+        std::string implementationName;
+        bool seed = false;  // config chosen for the nearest already tuned shape - never pruned by the occupancy model
+    };
+
+    struct TuningSearchStats
+    {
+        size_t candidates = 0;          // configs of all implementations
+        size_t pruned = 0;              // configs dropped by the occupancy model
+        size_t kernelRuns = 0;          // kernel executions in all rounds
+        size_t rounds = 0;
+        bool budgetExceeded = false;
+        uint64_t tuningTimeUs = 0;
+        uint64_t bestRunTime = std::numeric_limits<uint64_t>::max();
+    };
+
+    // Executes given candidates (indices into candidates vector) runs times each and returns their average run times in nanoseconds.
+    using TuningRunner = std::function<std::vector<uint64_t>(const std::vector<size_t>& indices, uint32_t runs)>;
+
+    /*
+        On-line tuning search.
+        Exhaustive search measures every config of every implementation (3 runs each).
+        Pruned search:
+        1. Drops configs whose analytical occupancy (utilization of compute units by work-groups over all waves) is below
+           half of the best one. At least minSurvivors best configs are kept.
+        2. Successive halving - all remaining configs are measured with a single run, the fastest quarter survives
+           and is measured again with doubled number of runs, until one config is left. Configs slower than twice
+           the seed (config of the nearest already tuned shape) are dropped early.
+           For N configs it is ~1.8N kernel runs and ~1.3N compilations, exhaustive search takes 3N runs and N compilations.
+        3. When the time budget is exceeded, the fastest config measured so far is returned. Candidates are measured
+           in batches of measureBatchSize and the budget is checked before each batch, so a single round of a large
+           search space doesn't overrun it (it applies to exhaustive search as well).
+    */
+    class AutoTuneSearch
+    {
+    public:
+        AutoTuneSearch(bool exhaustive, uint32_t timeBudgetMs, uint32_t computeUnitsCount);
+
+        // Returns index of the fastest candidate (candidates run times are updated), or -1 if there are no candidates.
+        int Run(std::vector<TuningCandidate>& candidates, const TuningRunner& runner, TuningSearchStats& stats) const;
+
+        // Fraction of compute units kept busy by the work-groups of the first kernel, averaged over all waves.
+        static float EstimateOccupancy(const KernelData& kernelData, uint32_t computeUnitsCount);
+
+        static const size_t minSurvivors = 8;
+        static const uint32_t exhaustiveRuns = 3;
+        static const uint32_t maxRuns = 4;
+        static const size_t reductionFactor = 4;
+        static const size_t measureBatchSize = 16;
+
+    private:
+        size_t Prune(std::vector<TuningCandidate>& candidates) const;
+
+        bool exhaustive;
+        uint32_t timeBudgetMs;
+        uint32_t computeUnitsCount;
+    };
+}
@@ -1,3176 +0,0 @@
-/*
-// Copyright (c) 2018 Intel Corporation
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-//
-//      http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-*/
-
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
-{
-    //LP
-    void tuning_cache_18(tuning_data& td)
-    {
-        td.td.insert({
-            { "14650567822254940018", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15726902746983125797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "5211831143687501130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 316) },
-            { "1398177377739338750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7693459946348737411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "12494969618927201911", std::make_tuple("fully_connected_gpu_yxfb_ref", 0) },
-            { "6324565723045697080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "2057158988261512114", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5758133252959371492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1934379409955686502", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3438116423688595487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1026) },
-            { "15331103261044247142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 943) },
-            { "18008552719153887303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "16234606052818596502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 99) },
-            { "12932635875905153141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "8922929126299811091", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "12245096462203481681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "12085348936192462321", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14878347463243157447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "7474592508575297101", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "7807983899017500046", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "1081962464388501987", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13681462437496627948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "17310332946322628458", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9243949750444156746", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17001502418583498926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "7953255701516490034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 61) },
-            { "1230262279011217327", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4282661608732125403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 732) },
-            { "9389555743403158574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7139714914586273766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "7370273921473161914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12590922530749026871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "4185398348055518182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "5303970743736042689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11507538232733291666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 224) },
-            { "10046663998164493552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "16992405636352406660", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13434576226708227155", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 801) },
-            { "14136097914489095982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "13105192484434299621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9423958333298993923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "14412158605670555579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "8576733135863336233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "3511588484597779204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "14353390922580547467", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "7994179151788368291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "8971115542951085891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "17179609670678746034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13268525255152984893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 939) },
-            { "1383899865465106141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11717348577195224554", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "135072053401934228", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10555597973766215754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "14799579913711096584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12813978452097969536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "11669828823444745889", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3128856679264648666", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15696910741835640150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "11806402239500046867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 373) },
-            { "10320711719466983961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "4958835037528182801", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3727142736386026852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "9213563311267466388", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2618108630886857741", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9367157746678824712", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14424566003632608852", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18268811652302076976", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9100044555742394133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 171) },
-            { "15790005937034794347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "13898284586432291433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3106911159524421371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "792684262493086891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14885031472057965707", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8398910340371320955", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10264913782610095832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "13898821685774165645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "14211903923555028634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "17912189681971987483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "15284262113150488297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "12068974703657294908", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "16988275131627316108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "17983556812075120553", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "2581414750854621875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "2964705957088952872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "6114147683777615071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 988) },
-            { "12894625941923144893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "12129572274423886770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "6341197991729122563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 175) },
-            { "3285520504090196295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "3796274347773622633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "12214162812589030126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "7311120574972466702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16811402686462277562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1123) },
-            { "15493488989417521388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1112) },
-            { "18133334552107213128", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 0) },
-            { "17342198739672369885", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15351724241036614758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "6631816968511312100", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13603318842632052764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "2727219457659794468", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8101977280003030465", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12782191856884962803", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2704063557078535883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "1559798212423183813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 274) },
-            { "11814740669468421049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 121) },
-            { "18270587701371596297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "4759671642533786591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "18232278892738147217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "7727001441358508665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "3106591708459602370", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 942) },
-            { "2161052921317193579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14883438809987378616", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7590767013583950613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "16370218798911151331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "10014448860206587805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5687802882700097624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1054) },
-            { "1143214652021653634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 224) },
-            { "641417817126876622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13558618754911056302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "3909551222373722085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "5592556538784745960", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6623182990939010641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11175955260573469979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 104) },
-            { "15410074937424854348", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "89439319782574517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 653) },
-            { "11398019086259011063", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1116274074896622552", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11107930597263802755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "2100891581797371600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3522383297921565178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "18233660940545931789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "15426960908024585800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1287490919205560806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "9285566577169147378", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10572945270796129630", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "288853243482418538", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2421404763191415191", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2103882464623009432", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "5448537627319798272", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11657946392097042544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "2920322372993101148", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16076153317792960383", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "761169277744593430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 105) },
-            { "385046297070779752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "7407975398526425554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "534032316469702287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 740) },
-            { "6681818065741882453", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13468713306678453952", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2806529556090896246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "15720507574336564201", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9533360488591027707", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "14082448162400225052", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17726079670612220433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11334122788337402526", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13558687084677943158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "6297802534570892679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "7187734276051878356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7868973874302246233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2814805887448339818", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "3002986032379998259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "5597908143491399643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "17209528805596238905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2968094709908141988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 396) },
-            { "12796777049340516563", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "1126499865206906037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "5538883245745495145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "14070988879848388270", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "12421707187947291166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5385316497510064491", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "8300655194765375060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "11130439225010714550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "13503688893307029975", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16044646335477470657", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9406763539724266157", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "3438296636411972401", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10987953316324712538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "13104509059416300615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 296) },
-            { "1208161922424418734", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12793908914872030220", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2566302789609970663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 815) },
-            { "10765280349477640969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "17596685300497748803", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16103943009195163681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "15249442550355454201", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7964396197946740183", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "17823133607491820214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "15522785615618973614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "8761283252495354972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "11897113890115321056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "12949204491386872217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "8133587696326295326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1036010477232750453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "724953082687879224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "182115051096556835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "11723735945517472199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 668) },
-            { "265124365266629363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 246) },
-            { "18269685060032395235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "5010119207726811326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3976736548270395981", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "1628593159980574595", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "187352687850707150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13450061819089402572", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "953306082374100275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "7393601059996816014", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12136029303893296753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 501) },
-            { "13410850301164057911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "12977678792503377525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10280619408766255552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "6928835003016610382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1000) },
-            { "10425889533411573166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16995873636564597028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "13364676690016875118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "7009735776703529573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 968) },
-            { "7354234812009979811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "14757749560543979231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "3336076058264596420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7209217811135076623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12071914115316550349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7903891232234389925", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7650375560336513366", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "13649894122307008732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "10607904718265020949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "10404725818204494388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16327433707667075261", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10128120599276549920", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "863952266514375915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "10544411879329675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "8203171222962341018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17796310681498690253", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "12908594497114706897", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "13781423818051299677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "4717620775314557374", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4764776977138392550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "12801481303602178879", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9216608098626790565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "1028160614515220430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 216) },
-            { "9589942627115344216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 851) },
-            { "17790026124881397912", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "10279778381617181802", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13853056718266488510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1091) },
-            { "4299492266819967844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "2490155559809645659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "15190508870639648203", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3883845471211207871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 646) },
-            { "7995820969034996638", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "15271783562528081169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "742689192890486807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13853630125050609175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "14711697456265712456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "2221145174704245189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13038533272699602337", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "6345550009198921347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "3715177305271762194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "9270950131920019932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14150012830816329527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15817443774186015593", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15126660425728872065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "14484890926084856480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "15488550074426713959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "592245952014430043", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "2116913943188857359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "6860503758000008398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 832) },
-            { "16027853590391209100", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14088382963493477342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "9019388470685749691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "5078905972285278557", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1500571771538985941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "11158789938857558596", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "14387756025635589673", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "4085907608404305515", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3782239800777370325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "9481675228591993785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "16511393582666965704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "11970881115757095265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "11810221946429451169", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "14691372262153587653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1059) },
-            { "1306339989221885682", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "994489782629179836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "318377908569897093", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3281207855459771997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "3819990462129075757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "12512751736409465214", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2030309697153345387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "12534001599784153836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "12181607120522804433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "7806129039150321333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13477416097954638887", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "13489318651148001664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17306482303091342504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "7744787957569714828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "16667887002111125871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3499243120652875549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "3062101811226530720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "10672380526821947133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "18037918102910297531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "10816637153861630723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "6614833247756539341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "4347816192417741558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "5042176052323856983", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18400379759523099542", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2095802691829304676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "2173720698351153121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "7130694811424715594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "17638692805430115529", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4056971751486746551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7549378486471456156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 200) },
-            { "13025361884606488732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1299545313185409227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "6942049339361951275", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "3001615302961701154", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4994591211723226974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "3621424752591567930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17381516856910544374", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "4670443882075998209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "6634330132674952638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "9819596940685093690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "7164580481046523192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "840202264034382558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 843) },
-            { "10784073615329190425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "15881381297320383917", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "4623542918584461522", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9868561386826862471", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "1450888744802985214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "12051595062513871723", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "4216958486055161753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17881905640473324965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7056030150365552588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "9860570706348640782", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8159303545761286685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "17542176922797334839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "5197105253412476591", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17729546848373991614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "875296362957469305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11754316727756881612", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2287356884312581209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13754408679115174221", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10892456883214928095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 565) },
-            { "12601126285773042005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "17791024851737594885", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "2524029454785583409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "5482851829165191681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 644) },
-            { "8236018377815149638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "2044363708106765326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "488298169768725160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "2984726467649419856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "17163158934005653629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 505) },
-            { "7172604084103519563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "15112599407339712681", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "17928043901784474130", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "2915165824085219545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "15447513376965243034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 57) },
-            { "875400109066360897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "1418595171949196661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "16611452077660879545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "16431165572426232677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 434) },
-            { "12015336418727455195", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "13613399861925108148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 501) },
-            { "13059207969254830451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "6644418194983229139", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4795705973706796563", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "2625969259447793593", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10016815108730511683", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10090923790949378407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2527189070714658176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "13611054146745413536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2777318471329665162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "1354647381212852890", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "11192356850081328892", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3633858263279042265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "15805087418686802636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "9205978149692979955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "30229601562833524", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17839839336294937155", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4867937397499803072", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6075691042233712335", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11031358859656806724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "16884228931101540030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "2373860353284525265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "12802517759474139810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "1518270620354036926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "10323345824599612614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12278364834477923930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5039037192630609823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3835286851569826052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7875724726741958520", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "3441335188113424896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "6067904130482758510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "528295119724008711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 508) },
-            { "17208186152576814861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 700) },
-            { "9328223957245552723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "577182964135927041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 35) },
-            { "8040001390872143271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3160543867929843861", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "586947787345351152", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1122856374602590533", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15287650965861631130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15123868617509445149", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "16542318967217020315", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7808544677773370430", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7969441643457570812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "8907982643256296667", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "5479761740065152589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "3114869763557037270", std::make_tuple("fully_connected_gpu_bfyx_ref", 2) },
-            { "2294026590516781945", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1249137685908951501", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2940027113687311893", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15943141845766932879", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "17775705003104146872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "403634422724914329", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "18154019240019929225", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9319254979377483709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4424217045094988504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "6800893510381991731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "18436249934780056991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8931169575495985034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "10916647716124396856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "8296551195150971668", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "3974589991022739479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 363) },
-            { "9120377367517042357", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "6817494598328071314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "14289048840489035546", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8951040603784899163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14046114605615338907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "11626402549863483301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "8057302050645780813", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "6711878663358611849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "7076937538747704750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "17891499682354369344", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "537074122417021898", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13993548620104010490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "16781127329510211966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15239764240622554314", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 0) },
-            { "15746620724134970969", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15163327502374403643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "15728009639807698634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "4436244774193918646", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "2683507674615735878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "10795104632256101599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "2909728331855309274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "13002363400738122017", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "11007944497812650617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15695415285791951018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14011124615649605281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "16245760498096322525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "4124478505694604763", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "17219920118109316867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "17353894529222574441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 551) },
-            { "15349944413643626251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "5608133987357542077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "17739868787095417856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 431) },
-            { "9226912483632588371", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9057036344533510776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "797387385159110695", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13951781924205611716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "2781309272856442321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3863816884636503247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4400247897123856252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "2235210915304938149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15890473622821659630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "2638131332283395057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6678796313875454849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4542143431130171516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "17995371099806008878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "4750755523645265967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6854611304056079417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "11709992724966310174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "11988546375476924356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "14671212883301405408", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14444475853714164129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "17830290099875088207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11771014003680394135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "11988285441493553006", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10408322429232132983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "16577611471466452776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "726985753660756762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "16172528828198474326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8127190765748950828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 644) },
-            { "15470013032930986062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 482) },
-            { "11878734040194151073", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7817036102984218692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "14046990030104971367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "18059267466971880386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "12864558900883069118", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13793441296561946357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "12391792381149655331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5211191663202250117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "2893564501191050837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "7706714181281908433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9824678205469832038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "7603319690872333930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "11315238071192463859", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8619526128410675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1112) },
-            { "4897991181236908768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11530101016435264783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "9794456440994218671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "2653651564133701304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "4190912926126844643", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "17006133396401462698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "12516911293946682547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            });
-        td.td.insert({
-            { "18245935804520236353", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14406070210216948643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "4885944395876887711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "7692849839965441330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "18202222342562516071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "8616686489737649890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 190) },
-            { "3106922888635965020", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8995598177504756805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 855) },
-            { "3063055767192991776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "4220826666482500445", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "17108987360340581555", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "9541630719145326121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "12843671306854567956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "509781001842353609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "14823616678465136590", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "12644942072153919043", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8739347545059610410", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2371412124305478965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12790570304622911607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1028) },
-            { "7351733901977025859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "18128162750557822655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 110) },
-            { "16710010075465723498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "6650607472019166205", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "8916983923551808409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "15188570678726970998", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16871004845988227014", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "8857763129101380288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "7430073011895298582", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7181154048972884375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18357544235608006954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "16084700435355748612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "8818070832398055086", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15831600396403741571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8075180350084516696", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14898892437285105327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "10022487076451608714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 695) },
-            { "17921973525603585874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11311859068168414878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "10509933181132310969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11682323163346544125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "15773157615731010456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 529) },
-            { "18126685473408206840", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "16720108310653948550", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15223164574152266895", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8881135571874888085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "10308113903347312964", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5091558853871982858", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5738835498104275267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "10930640103080573253", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "5609922876429907954", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15800447082078291243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "14184895905338394239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "13842309033760176194", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2133849627845285277", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "4801117903303888658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "10890975553758439233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "3646228701104397128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "13145474177271090694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2995134938466176198", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12134858519320245809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18235209540858013173", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "11083993858285515074", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "13710319251108632115", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "15494543914974994991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4479979951990338510", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "1920042803083729276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "16589607587365212240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7678457226823073886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 187) },
-            { "3934290309368153435", std::make_tuple("fully_connected_gpu_bf_io_gemm", 0) },
-            { "10151922632636937118", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12566041126392848976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "14956246091163580499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 480) },
-            { "9028970753877215614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 861) },
-            { "7005509036795164602", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9918371346247634545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "3814584042139408454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "12177387334053203378", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5485749317130402302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "13471752029049484143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7368916076070115064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "1044978617045366709", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "14621327324047759584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "8961138963663532667", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9316082753126682958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9058996149754556268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 673) },
-            { "7880845322716481548", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "14990645740260870030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 938) },
-            { "6219075471508685758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16208488491972128275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 814) },
-            { "6329618009202266591", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10486348549691280032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "11872943152839631823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 655) },
-            { "8560635685184432720", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3873183249402084406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11418379777288974452", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5469227748156438008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "394778201589371681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13699740641705514374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16955653765071712611", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1875764913306932583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "18423051691107460439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "7082007579524697455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "3806761527342944195", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16243196137456624852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7683334381958571864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "2406816735581074778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11856266545854830143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16881283637687482989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "8762901342272872498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 62) },
-            { "13602140021189675477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "282274448389888221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 659) },
-            { "15641537661939240413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1116) },
-            { "14896875712028630045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1057) },
-            { "12427258337646070422", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16131448347558322280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "677249604491773387", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16710651492402564794", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9525853014023664813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "11169292427557543138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "7338229552985076723", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18137106379929135901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "13121297281694293907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "10499265278415026816", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11062100629646715785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "579781312141502576", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7962991673727743706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 766) },
-            { "15908673392788376468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "9462315044265139531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "397770940444464146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "15814015810740458605", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "10290107543739998181", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "4142978475842207311", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12190841837604350271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "1778345646142852816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1697248235682953135", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3041752019114501584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "13698389420396031586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "12517838703662330663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 15) },
-            { "5319668297345215520", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6213386558868267629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "9513032457323269513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "15851356529373376076", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 403) },
-            { "1212319037405620223", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1972879521448306536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1115) },
-            { "12626014184575881530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "3138374672801504481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "14680730265621679042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "10118395047539851751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13954821927253849036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "7852144838267007144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "14335423820860953927", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11690334177981352452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 13) },
-            { "12213354854947437262", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "11829442945690098558", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8609939102588915855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "9076758673133996959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "16036386660666696362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "13609660900720370993", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1318571118468536310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "7264274394359484318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "9213886570531053949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 801) },
-            { "18186615266760475767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "9152451371616153112", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6843617687528352801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "11113256687741667688", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13776178598632392721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "3374410641320310726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "8594644182487917002", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "7009873605945341897", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10001963042016663554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "8792010676469476740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13282951481330978659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "15471470494305051299", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17427036330773218054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 291) },
-            { "3534971503826416049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 736) },
-            { "11066913713501760080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "2379484884827231127", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "17536308070854915513", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "3644282167178264526", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14204609663091442879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "10782611933832492335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "1059505639883914386", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "13804221028705631415", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10724501418439612080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "9373353053843326128", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "17123463568694499533", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7852745450437172519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "17408275657360833363", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "8689206546467098603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "3800011935243649447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "7481256533438761028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "16146350476627599543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "1841155673858789206", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "16067605128297748820", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18084635102736402756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "15003778740401601065", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2283157145557154450", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "3463959257726925426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "2908249767551054613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "8767817856303586064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "11020315012951440351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "7877332346656934022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "12141300895511301068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 908) },
-            { "14826791706471872785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2242915551775617989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "9798585825695496550", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6101196122606108273", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12971822824884826169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15006321421735686121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13488495920546871271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "13163146272900339330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16711955423531846725", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "14729854278671832528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 236) },
-            { "2683304757433993300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "1474271081523145413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15192024816519005250", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "13025323039227543550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 988) },
-            { "8258382025812748961", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11686670048744589243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "314054598858070952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15809639778580769565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "4202645222013675478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "8913823292181409151", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "15839295895890205274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "11565861421381730304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "805221045541170643", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10650698451740924172", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "490233152678323691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "14089893422771228191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 52) },
-            { "12680339228267704518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 120) },
-            { "14230493618724018658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3860667078458481972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "804195263636995800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10682300249493137042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "18012549942299450620", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15217183882858251099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "5275016494706355806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2567046336192437734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "5927467766675317093", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "13852065717057446998", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15378025640603637387", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11529876081402974396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "8268533335852735248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "116291934148608396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "16949056117405140365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1071) },
-            { "8251544171504007740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6419580456182610836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 465) },
-            { "5834245904292669645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "8132521728369930959", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8124736388338424498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "2780423409483867058", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "12098146032672599222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 667) },
-            { "4747159205186229582", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15967614281807823696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "13486084204140096478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14716719350966652036", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6821855018718422278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "17599383258252980421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16683485007140805060", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "3286629188347536485", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "18275601715050791851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13272818502368975319", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7800015766976654402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13835908664998757647", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "12394049027081208902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5245308722062496788", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 316) },
-            { "5754844816339228920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "10797908931694274013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "13054405729329143152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "1563987925712579649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "8260130048649729185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5303170164698694791", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "12541834857357563605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 884) },
-            { "7134654288295280046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "14429081455612806819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "16749148369456398030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "7279393739634103483", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "5622089373755094139", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14151747022287993729", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14025496192869856801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "10436819182310112786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "2294800960010879540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "11855070245618904113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 943) },
-            { "11243840588602365090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "1939140810847988694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12028665820838352309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "419783127503173016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 185) },
-            { "15947699374684516369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11936419502418995274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "2934519615045138808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 948) },
-            { "6293403765897901528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5390559917122707732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "9195732599757736182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "11873734271080160669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 190) },
-            { "3499106702307464480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "8881150100883636392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4156384238797998294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "6343888265369366589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "2369451367723962073", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5594180958505308003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "10170577772376890221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "543472136359161929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1115) },
-            { "1791615587935799399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "10483664832302187567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 774) },
-            { "7715649642603303319", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10626341369865893888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17556238490521153146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 468) },
-            { "2912098199463107173", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12242618640422208652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "8317673282128335201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "10989937450490049763", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "4927360358387344983", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13816104794723484993", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "1104489643524273315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 130) },
-            { "14805540705424073865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 614) },
-            { "18142462471803295391", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11327097771110264965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "142329025839464842", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "9257078583742821465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "4865023158176874622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "3212789693085089063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "4716188972902735458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 678) },
-            { "17490471699618303993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "3239033622277917802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "15094664469997373662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "14959566236432790882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "1458615259705605525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "7937870623766562191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "6727930402459775131", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2349007644347065353", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7565221050911842393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 110) },
-            { "17053671692908867872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 341) },
-            { "16362857896338778056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "16694984452720336415", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "9381304526221508530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14554225625951128811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "12860222041026638681", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "709835724029986012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 565) },
-            { "7604075520418038662", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13890118723041457532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "4703107905652287491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2543995971214089085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "12514693341682532560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "15386715291503303766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "4750894407873652809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 346) },
-            { "11198908896401597838", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15451919862187018297", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "13436376034548670107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 360) },
-            { "5374969798377773063", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "11330591026581463934", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1596353239542510685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 360) },
-            { "3167336012388169649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "2802810524370514276", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12118387933632797428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4133424990380177132", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "12174571114411168588", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "10179916356323479080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5926747396493954633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "4628748977913534701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "2362092095402043749", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18375125668176498051", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11560634267092054110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "13809330759308309353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "9891428775774615719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "7578177053220150569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "2089730611490367290", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1077773457856682663", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17343050785312683560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "15065925414996398951", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "597073780328219388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5873257164958285393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "3950738240651133849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 736) },
-            { "14026570177552137240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10565371760124443824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "4278280309700908015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "1561225943337590599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 518) },
-            { "17248756229500447131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "381149736509958403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "4474697990228400564", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14068780861332616363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "745009493367761775", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1316444335300814745", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "13893808009363736870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2668729552208169959", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8071957466247137919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "16386955278777720573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 848) },
-            { "9723314434598141024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "9314293064351558241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "9321208819255762521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "3880189981766119529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "12052207771201936228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18218755616248669884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "10900880512948479338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "11031625790234068916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "9731370183088819573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "1616603916015535857", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "4674416595144505741", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9144487908815767824", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "8176012042686275874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6548949901446632697", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2296581485980163665", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "872401732136570312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "14670068483447729857", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "14764715930784496165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "17517495652165026573", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "15884763176333003771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "13973179950424276578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "15428591250165788477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "3988024997010367546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "18184621367843960190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "9488453013746383896", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4236174000795439083", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15914512645931208899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "16158139166784964096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "6767159196241633301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "9421643783312790618", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5056859994174498686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8790625191540101806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "6642767323474835034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "3491333679577961640", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15984885011101717258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1115) },
-            { "3336303478756453360", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1096671695414716274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "13775529405693629438", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6391847213494189692", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3325727286860556323", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17084977396231597605", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3928266232090746643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5364060938737428149", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "4465701487417893814", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17770104464900126615", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18118237182023167949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "530491406341772040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13330734840729670622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5782934278345953016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "3255465741612432300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 814) },
-            { "2710485608298356329", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17808913959977434594", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3833510944499257797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "10991423760161409883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "11327228813412934262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "15975964562807570772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 740) },
-            { "1604661321386793876", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "16934879647229234163", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7969848911698660033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "6988492019664525206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "16173557782125372935", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "879939701282942121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 918) },
-            { "10892706534058849825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "12917241193304093727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "16120988958246503683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1017) },
-            { "11726298758004767743", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7958443549125799229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "9660812093766156608", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "1907439276166837309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9796621763733208035", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "6232363902828992968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "5124080536266387783", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "16998508915819714690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "13663893159182636270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "2582625260054352916", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5334566325056222430", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13338594271376045657", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17465517455679097501", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "15059549186302099880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3860603464276263676", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2856601829807186494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "1095495157025479260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "2597453794298356435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "18299254635579957284", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "6848989271874647093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "826850797666395121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1403617451623027879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 297) },
-            { "2321767794934000238", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "4126895998426674411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "15781622938833984014", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7351401242363888463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8337820318779061494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "360872770877634346", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5656623709782744241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "4673127824919879657", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "12956726277674279950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "7026575758396092435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "10792503079194374004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 174) },
-            { "13497225521878034159", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11215217005872946038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "12293786134765875615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4720851194954041037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "472454322186482185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "10722677916294015259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "7824524940405130010", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12232696287029987946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 914) },
-            { "5406129421969383274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "6574971185849732667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "12727541507197887360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "4957638663977636791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "846088275031979661", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "9153779186876518773", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11706378390483804857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "5714365398623475983", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            });
-        td.td.insert({
-            { "5195511638783481084", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "5941092474669713339", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13526488884846845330", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2659031931257084418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "6708349666663292171", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "14767888121198814523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 128) },
-            { "8272823732258536202", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14331658870024759698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "10432365444137108781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1063) },
-            { "7546586420552408243", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "2877521658768725103", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13830605041347009953", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17434429579652310107", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6980201892073961793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "8794896449397768269", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "951747146164097188", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "2597523728660247862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 618) },
-            { "8376077531098664520", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11609821372586026178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17316626950179740845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 561) },
-            { "8975333906619899020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13189392239349392492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 662) },
-            { "6769243149577568817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "7056293586529818253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12707946849050970702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "11308583200952256245", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9594594523961285945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "15192230303376521834", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16717713360264747483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "475043738497218394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "11110173861174257158", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6780215829176686721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 363) },
-            { "13869716373706247686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9323825370872655346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "10774528268153772208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "1353170363915443814", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1419073145594317633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "9545968464906009869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1902656726461670148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1116) },
-            { "17006095064160484022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 810) },
-            { "14472187692485966933", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2575631797904040925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "8780604510524622314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "16925721317097534009", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5751283221740229986", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "13550435052563656432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "18218631037214746168", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1045854873741563331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11115684531624462986", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4617809377006148936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "6997971129340865650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "2930898141522848681", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6303682540621797774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "16117738994809548007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "4408772370026995920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "7060804814325505165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1774158624592967937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "123251351612308092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "1718634913016284523", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3101087806792514129", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14230385851791760020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 507) },
-            { "11430400968543668873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "7843508201826629532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "1984152634309440563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3017891343734146267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 102) },
-            { "2038505773698938555", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "13483175684542464385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "17713034180977313726", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7561096442572829049", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1801731858063091191", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16772854836230971016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 302) },
-            { "18122858611264877646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8458082326743351141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11634932044447867039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "8153567933591966877", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2715447739580688669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "17377315194963069204", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "7924408980408826942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15767973630744679517", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "959260710517842876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6192955702438301372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "17243648226968859637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "9192665896782282996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "14916625550370402883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "12604104383683210104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "3217246278485567748", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13011676362747785816", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17793292063552633023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "12014527187730671229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "1999979442136861875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "14910223536998380801", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "15914107501176673997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "5824801192141531089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "3277243911383750280", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16761856644242716357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 482) },
-            { "10681768474583067517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "9631545863582097486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "1040030752340209480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "7688176479120305539", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3499109651698979012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "10556089809203693400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "4880150897829846031", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9840495023131952174", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "954796765467489259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "13810995219720233595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "6578908625437515675", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "1375156980278317418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4750513665628842598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "11254635684957519432", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "16692569816843207989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "16566214123371867456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9287404618748313247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "16402312692470500253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10880081193716628051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "9942726414918759892", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12351866693978844266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "5192552432194195116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17089801601582809764", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "693883892843558363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "1594612401422787491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16403423801823379909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "989564341557094953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 69) },
-            { "2458592904274981909", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "15678385128478075284", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6483208845600234755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 200) },
-            { "16487774205195979355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "12181889163404078773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "10865695385270390803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 644) },
-            { "8797843396807284399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 716) },
-            { "12558716383635737426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16384186388687043048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "2968031010495399536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17829148383265978140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "12223993560805441284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8421388456873652700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 267) },
-            { "7143510787416483146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "13144385730409574259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "6003409324516527726", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1071007164550012186", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "794499287296495726", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "1152691534728260611", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7777333052643961206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "16511749893955141055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12370729327673204804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "5381578460674280089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "1336940384521633733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "17423645390621980919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "14283458015244508428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5326247361632903583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8708643228914766202", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11446745541571732900", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9835739612255048978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 377) },
-            { "3308770992373192529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "11992625045241269569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "7469127846325904854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "12617625046664709483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1021) },
-            { "2659712601063515059", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "17906607354577138153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "2632535010129224704", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15924583510704449214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "14421898375873029115", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "10037086825900566930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "8130920994920685157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "15101680837342453931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "14811022197918391667", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11759426200341586247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 121) },
-            { "13247725847475539658", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4285475880886685878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14487842225000203929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "18135307303959376082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9437794960375526230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "13224814158106791463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9232653317479846765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "5311718276151327830", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9439431829175743345", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16135569134646688251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "4793007249026943006", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15160738482264643601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "15201438563802430490", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "8045367391487213749", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "1089679781525023551", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10415046594066474634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "12159582810513550491", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18253784177599134876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "11939914680143672459", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "11239541755868028928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "5592526760253524303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "17193614571243427089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16336482874764861478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3388752887767453958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16081386644309102158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12675313398314286884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "12339692995143159283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3180320769716158201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "18416908414174464784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "13932662890258900896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "8170998059688907013", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6911215749850066204", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "4362304842016958728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "18271689282126907793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "14821616804286068969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "7264756313770306662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17917978116807564183", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16395067736440127496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "9780938731831129283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2008424849669196225", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12794369485239257709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2007192658799516915", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "9131183544020825260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "13374993751390784382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "17224181038411430675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "7398196853452900099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "10309504812060596568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "1572991986657256775", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "1345101751956733589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "14668725050395069435", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "11823205954749139338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6964383468476265892", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3199841714087553410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "631489011812924153", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "669771152920944125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14152716242882609401", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14902389080201926109", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14810839157236175179", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3362190082518348071", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13723543003759101485", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13642146548740074992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "11022847760121601465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "8787816339967963727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "2530317332900569142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "9277610800970567810", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7915318733663535312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "10879218241103462088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4660288622381620227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "1103204698908514224", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17900257435531434807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8207349115037232863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12790788016297794214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "12672995204641007004", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15486917753097743853", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8642107585829380438", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16117448559783537844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "2307310127637739872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "4513063773753763458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 908) },
-            { "4850497746076450913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3226193790517362610", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "8650948093564284852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 269) },
-            { "13735180250757239202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "5807196005360653656", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16043683538361975370", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14603590053512154268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "14045927407431718832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "11241838709529552265", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6129602738379919488", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8096131027165540886", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4353842547963164546", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16731107540370927220", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "9748307611165615848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "142270860894725256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "5179760459095053114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "1089944493540593798", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "190530884420224257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "1997392406402548974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "2321148334382088982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "17854578307286932628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12478309735214802531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 191) },
-            { "17039993918927377002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "17329287216741045059", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "1107027047188366075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 918) },
-            { "13990028451169604107", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2738256633362038820", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14006248791647711759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "10647227605517025377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "822162932339827810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 539) },
-            { "4492332228252010118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "861419637283812778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "17651821953342321913", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6020017927557041768", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2198278382394812839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "3573490922300056520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "6065819201836017182", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16053585286807864356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "8285478622349266483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "11910735867274493498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "16436006771518788093", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "16293465561256937726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10437367877444543776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4163359403543480821", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "11305232900158601613", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "276407276027553756", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13761566845514364807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "14546281065004619074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "4135003545872878882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "9525535670799618110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 646) },
-            { "5682190700442712936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "10971070835319242371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 841) },
-            { "11055049031355432623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11318913630213187720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "10642327923162019888", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2651385050387738902", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6712698149192186833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1832310305089212990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 740) },
-            { "15035800097152337587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7712831597869354170", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12806934028210472719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 567) },
-            { "1074748462756364699", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "6714886136800883594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "16397733032387984819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "17252449599613270108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "17515064188391421150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2762489653422414995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5242271874488296527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3699344686791530101", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2418288192668085805", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10632020369698615114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "4958222070605478947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "10136369729388564720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "13713501506522022845", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4856470441452830056", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13786357802945430475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "10084794570892043447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "11637325834858582585", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5141753233513623264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 816) },
-            { "9416186718345824095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14614844213016502202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "13597240991532942069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1057) },
-            { "14558572801374416278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "2171768477223405739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "13754540732991287617", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "17833517350994024381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "8990561333549136048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "708452703070938673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "8497468192424557348", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "2572395498687401679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1092) },
-            { "621915374938805401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "6146876760962332928", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "60509335250891515", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4304041922043496030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "6767245864232675168", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "755414184406250882", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8323445733669842657", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10049571207493913006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "14792528369891965810", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16574710115918192418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "5349415632630235233", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "4429109491655891299", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2878824076934639346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "18393312550272875456", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10978173291465325823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "11473442921040533207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "10171373375072694210", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "2114599010013594942", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6688522645556262131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "17870874477143985774", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3737552767159920174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "10751536136794650334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13800387305792597325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "16431857516454692096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 185) },
-            { "16862145184923128012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "15082818876354718849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "17788367809717898285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "18068050257421269408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15914058104244750036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "11795826875463204296", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9524303276541517389", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15322019609805777935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "15649927926091502215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 62) },
-            { "15247381586316467097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "70580716590540876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "598390166442977699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 540) },
-            { "4217179485243909459", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6288489890578212082", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12473600360154597915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "7242013296950669829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "10532183096485321729", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12247991248100147706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "1452597292381229708", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15555083739490354527", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "9584652777232392944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 655) },
-            { "1867337342417952506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "6942016672941874829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "9194788897910888066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "8264178890341675354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1000) },
-            { "244921290040927639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "5019077257951332016", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16969463538496570528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1173986078589662704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "16698547937652264447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "6362428985273506890", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "17377293745073971167", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "15490478608105402679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11198301748997371475", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3316798708399098230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "11267742746905371769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "220326805056361171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14420809655798184553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "3782315919331102574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "10783981060353445280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 62) },
-            { "706049518431331645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17774424004510360936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "18125732229366977468", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "14686278683380845546", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "2929190644951986399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11640225461345567929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "1954052357826969119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "8700574100180128776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "15989894214714907271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14872992823083730615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2114232149447438823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "17636500109629107732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 346) },
-            { "8769060267707904998", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10546430708947911124", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12501619443242354860", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11087413527078604815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3706994659266083979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "8295126647635181949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17243576882981097341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "8701248964531180496", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16723478941106779069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "17546566148752689536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "13357365044448426880", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7148542290597073512", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "49948277487706148", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "10576856554114055028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10309083227104422150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "3750338655074082587", std::make_tuple("fully_connected_gpu_yxfb_ref", 1) },
-            { "5951936376654416075", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "4141005390823981166", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10591379189397010097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 988) },
-            { "16945184617367657570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "3723613341885592267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "17092525789052598917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 122) },
-            { "9616636708366808604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4980217316169616839", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10019470094545733255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10196332102593337214", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3499645386058307669", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4792351255949877935", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5585398540591396124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "18062849937960759210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "13787436604877398090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "12914986936318857086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "7179714714302073459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14616969385577243225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "2108296560864415762", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9426665763007611385", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11645116728396933125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14681717813022425567", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5308128387928804050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 736) },
-            { "6719302427415173754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "15430549683839591544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 700) },
-            { "5214654427283761256", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9065894438656900887", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3236003754884728510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 681) },
-            { "11597391933877736800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12151068022697708126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "16958329690837977102", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3217574161785059951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "2438374917504708831", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12255528292506999241", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10947686124973711385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "11147816119060617810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "18005721959893562716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "8002233052700666718", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "9428176632140441528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6131481289104111211", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2728938624042183713", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14213516751025324346", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10729288973933590396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "14274685812676150168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "3737576893817599311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "16441830491664937048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "8127570953237266335", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 3) },
-            { "17011363406405852347", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17009318615658405230", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "1885075753696445410", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11604111639041106489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "11619548409913646265", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "18356980026934328781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "10416622008071151225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "3524531620118359828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 902) },
-            { "9404953235624894187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 109) },
-            { "7000486794832106857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "12655099960717366198", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3024402899381804809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16266491618150971928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 360) },
-            { "13296242326766100583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "1334070221835422461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15961487889420208188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "1760391741350091665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "1704404203639481753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15193403354218116460", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14906458674793172507", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "1351033666248868977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "5498839261395459224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1207026216972160297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "14719421757340260468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 200) },
-            { "10679760989906275129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "1478419046264331178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "2344498602308448450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            });
-        td.td.insert({
-            { "9763310312421884308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "6093575518270471235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "6673966852801136416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "7998930863626763670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13608239208821071914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "8866716292621164810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "5240181393417899912", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "10112032316939871435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 44) },
-            { "4818231379191523896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "3240102173773280414", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "2128612971571865547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "713121569924250372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13809898858049445969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "17746215841755337461", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13358283026528078900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "8275277322582733101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13569941893504840630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "5963901433137582265", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6171845068913882721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "15924916465272239832", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16683169947375504066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "9173631510896381179", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6458124573210430792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16947969669087411530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "17802514063213000148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "12589440296742583335", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "18432787283148809023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "15464327246951632247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "16014822406751503249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "10783630257421062891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "16037141448095945650", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15602863681196390535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "14973431782875808802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3032921857841371728", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "11077876432364512822", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 3) },
-            { "5240706676373148280", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8444259010311137762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "5848293219267886434", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "16773645387243701837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "1779941298820543013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "16247399911710810038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12134712464763856064", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "1497127399271219422", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12397280593466519809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "6104380778870471127", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "3286330985102373533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "12218337369633748663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "938222258370511187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "10308431308942416781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "6585223640997887253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3033264172690274208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "14147460733160099960", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13762042713029963144", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16295660312557315941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "17742192339816511494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "17087740929472936216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 482) },
-            { "16601702334097258697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "17791773192152464021", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16816222375242496370", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "14733510474010040334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12564687330941036772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 643) },
-            { "15882969506682501496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "10471519687597963116", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5485971317082563152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "4238885454989272754", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14397348576352573007", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4229105529069729944", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16833026567865627676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "5295693108687178880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12962558681443556219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "9182897385081081193", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "1545105800386716684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "3603187029740446600", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8578747191812631883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "5120466856097219243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15548971488532746290", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10791067159964399241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "5097818987523855112", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7958459862276998225", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16884396694505987920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "15991460001131903561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13468081302022888489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "16896833230469488924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "6777045876155144709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 875) },
-            { "3234107167862677811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "17700958439420868719", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12992061224471212714", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14389915292223442327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "17832542092610191859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 528) },
-            { "69439315851965666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "2627779045483019709", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16729849855476690294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "13733327241591630239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 11) },
-            { "14985236276429954162", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14050124896329573468", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6090625728451718945", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "14057348639391787117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "2609454334520044465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "12160764253455777655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 984) },
-            { "14458851250685872417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "6729785110495533200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "787203599734115483", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "4772696293208603817", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10861525139715322534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "5093049998173715787", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3122997634505472500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "423221712829930726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "17915846724151945664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13954144830230671601", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13237050834496100264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "16610284927818475574", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18199526506796726885", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11582534256623549131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "17370051888730874220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "13621339501067135142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "13973028408397200796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 431) },
-            { "14251848023416168295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "16446533347502650316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "153117141968471446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "689445825453914111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3830703844770425343", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3571959174116404960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "11120846960057008937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 516) },
-            { "12693511427898130707", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9101018613418825655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "1451466106918423837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "1103228955716492167", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12352923639732112511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 75) },
-            { "17037416417174266088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "5629373398445592781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "8929453032482114162", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "13485300684443803732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "12976499206227689731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "14515066741400300669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "16531824466148265247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "14746359019867963124", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3012566432840424198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "17147293671640396193", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "9480653639044390919", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12741457056869452536", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2969389503332309296", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6509758095668864050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "6407471972820516685", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "18043340998699622388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "16108759090923335184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4355933224673863178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13092232276822302626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "12011982029561277581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "5103094815475470596", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16307464696265537356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "4967444801764057340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "16783619135298589974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "6040286126398028933", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "7375461241315602473", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "3892679716763161057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1411786954276574458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "9263063714383940562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 815) },
-            { "13102754309439605192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "5524218746051008792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 844) },
-            { "6928136130626403937", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9761573038170759563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 316) },
-            { "6334639534663495263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "7966454753124154534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "10306542963828398049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "3963106895592011725", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12107262410635772120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "929378940515745198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "5627834277145735283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "11956435900037329302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "5389189982064081933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "9767294641786972359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15511138074959300404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6181651715051152713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "14763982961176216679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "14907097142953816744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13300022131572486202", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6418327009347170687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "1192279884248226739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "156456996459945842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 814) },
-            { "4165036357594592683", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15897477855246170861", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16789245987103323406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3448477246688526708", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17977676737774695825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5352861363832390974", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "875142032423622622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "16924006268301179157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "9741607635826869269", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10071449674652717890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "9299299311101549958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "17301887391757619741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "11147573971701279689", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 268) },
-            { "4809191606466167229", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "3291180926381314705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "14316077757957132678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "6109013751635776331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "7940369586324090841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "11069983292783104310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "4481903208484313806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4014667229872705228", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18136135457402651842", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "4197617702037834389", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 296) },
-            { "17222005830854879661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "4701832665603867798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "1138439260035360722", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6931953332823066530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "13472532612464340803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "2324120381399737261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 267) },
-            { "5235375820995365354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "10995907213890714701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "9502195532658935521", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "580936360000782237", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "3106710091841093202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 991) },
-            { "12090536142661253835", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "14352796912241296357", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "16765994345605657100", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9475130054420979752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "8860443174052454332", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14487682847898298214", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "8712136292276123857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "4366168099274266975", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "654122557966242717", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9967101735808367971", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "18132952464279667664", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14744368497944610864", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8507854696766492454", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16911450336605071390", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "438528596970898721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "3036512701943687724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "13654816209891478730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "5353552956675518468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "425744529089575241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "9274179337770060652", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6193161166790398003", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16312223896859176991", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16286085532892593349", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "11718418772370938734", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14363654136811880073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "7786866732196451977", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "11455518069358829249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14171139920084409181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5504757952698692953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "15548847099740441551", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "4889188980319017094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "12929981792125924963", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "11857037689248685487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "15591167992985613695", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13314092088416047551", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "16800575429414554907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 448) },
-            { "7799984350284425885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "5600807544955072308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "14221578799010900252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "13484950419220835364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "6557428245898292304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "5157249499936659040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "5088898934670078153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1152693503778768433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "4104562704039821482", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "3159681096461848644", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "9585113116232600562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1890739204389692970", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 754) },
-            { "6856130385095139346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1124) },
-            { "17104611871050967957", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "5644068493155655611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8709632541892447149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2172121470071868949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16235115911229280717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "16509472637458153234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "16820082917500285799", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15329680728165965773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1092) },
-            { "17882819773586674851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "9987415314864002460", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13972357557211413688", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5940337324384948573", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2552187713769926425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "17525531790109748810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "8757900457181374694", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11932770338770247767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 438) },
-            { "7162575953766465459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "5219399418946822456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16561224775421968533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "11636129433022017868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 600) },
-            { "14559308665571750465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4499586349553581439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "17364712285968437405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1018) },
-            { "18103534417093702556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14133958262039763609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "5083163738120585821", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "5649082203775427830", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5291011077679733990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "383721620126444793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11756881293845417212", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "17994361454416813294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "17549411807772646930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "2649192407401044065", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1941341635794709702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "16108573960501496757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2721793280965260548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "12164298124869114517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 216) },
-            { "4584970211859494304", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14281201038135286621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "4264284648458489052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "6988674007771237080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11800783548769329949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "8656468860180713379", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2066731703492755469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "11772741918108731396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 905) },
-            { "10990741293315393791", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15187035463799513424", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "7575634241190730697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "3067806959725855130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "12946540633035976364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "6553736978928374036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "4862529593282936100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "9175450649281374948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 860) },
-            { "2842103889477438816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "2173867324489962689", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9988801796928462423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "3870539490799697188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "17854208422879910606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5077214229434392730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "8303211644727914658", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "6318228858846223186", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8614534946699754256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "15485701086886851362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "17021925795809437171", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5047419871737940985", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "4161612746310931789", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1587501521145162454", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8913950860101596091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "8856888761246057127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "481328129206881674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "10486000767830001094", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "4118073384938355655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 678) },
-            { "6981537186704688907", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9728611486592854529", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "789359733867650915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17264608538692763688", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1653274345637156919", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "5801429077171542466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 485) },
-            { "9378269524012289175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "1075027491444288875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2912858944747613525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "10930115765550856328", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13119479079474639169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "632116056424249698", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15109847707903824859", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "5415319660821122528", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "10702234389482091891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12415368596357091523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "17392594284473856393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "949330876419581703", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "7314288062932060863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "18377298651236993830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "4640028527711211109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "12725675221990905186", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6670327979947471550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 163) },
-            { "2702144517025248597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5581428998642936688", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6902644989079870993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "13540002981450186147", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "13093429681061786539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "7208008921815475393", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15997754881872769378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "15417738436777481469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "2722124265986526212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1116) },
-            { "11992353959766718397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 551) },
-            { "3759057398165607194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "15689502054035168040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "11913020016435860608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4916769804113823482", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15154700439767512396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "17975017633455909321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "18121198117765854866", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9714764457768279762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "11025471731438443683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 536) },
-            { "11052732052072367261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "13026555349791486777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17281202179589913619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "7104756264011682902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12700372241799686527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16190949264253468961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "16579057939215877904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 311) },
-            { "17764033613416389758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13046322179198317310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "15354185859262170540", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12676167240795292217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16383540667048742064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "287386909600391846", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "956022649859563080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "6062246008880097669", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "2534408579674556441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "2730604806511016352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "17806712457019493207", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "15914342421266687768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13455881643467418059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11104393974242049153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1573498199681662714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "17421991623849671076", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4232250144427804891", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "4492673409319122180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7460672405409009037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "16541722316343690197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 517) },
-            { "13404888565084206853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "8788703258318141635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "8751016391945753900", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3159147743553063163", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2497756607567197523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "8069537351442302814", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1819720745131968914", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14389719202147508599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 715) },
-            { "428659495445490820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 175) },
-            { "4161001033681779582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 716) },
-            { "1120455113299469776", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "15688186132508213638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "13078401519973360182", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13161997040644039778", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15399245700982979379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "16105073808368936420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12026482841341343242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "10173283505468233128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "12380856644683171627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "16986610822918634530", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "1003101267609305257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "9305861997313663528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3134489458855347772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "14217181622713951411", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6620782733027313312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "593712935037568960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "14912119584313592912", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17026284168840448378", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1541754036637209097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "1202292109713947702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12259844988981080505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11528310408333718862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "1471837664358450291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "178353385245384751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14667209474639064623", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14091610802555875119", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8651641584737798174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "17024388383581997032", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6340128090694375876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4274801141127703532", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3154539627593235077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1123) },
-            { "6571438978296387721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "2305461098719675735", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17705807503894740726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1920070013712913772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "17824431042110985323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "4290840152278060614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13248567106128518549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "11622925573287101001", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6788311046557489996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "17599396373608265826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "16469788155263456039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7585785802379042424", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "4678607855896512523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13312514874803986753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "14381420852659789698", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1889171157980977747", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7881579844586294503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "15069906408448814772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "6949539207944972855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10522649794540845800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "15117880293418979489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "16706244336960642883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5912303851874077576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "10055549084854766170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "5648658688155716974", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12523676912856063091", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17446505012657609153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "739676584505475609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "13478984039708550410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1054) },
-            { "13320675959188615441", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5336120047683197088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1082574490068006980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "4553409514380460123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "13124342334495538095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "216603198215625772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13902214851539825156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15675968397825708285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "40704767167309552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "969746749329671447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "17015791782274123780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "11443268857010762276", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17370158297470557151", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7084646429975006971", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "5673972310424776040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9148379585489720669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 862) },
-            { "15031155621982459860", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3509487327001107638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12081835728078383819", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "12947341728489226671", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4408600136502382976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "570683988452622223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "6142707387281700290", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15209909241815414156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "529543453251381109", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5132761922124425835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1022) },
-            { "11292995457386147494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            });
-        td.td.insert({
-            { "10157866834809927320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "9383182168277796969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5277400567128489977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "12962552332511702682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "18221867262301937903", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16294825599850364701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "14043770215999952932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17419874083634480896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "15315327794058441258", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16567638487719493784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "16094174852600023296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "7454366978268164047", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11834683513280095384", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "10302338806536775954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "15962137123591591534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "6149673627320838019", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "1470933384474984858", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "3662747857062156477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "4815047491742617397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "10887835418423052188", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7878605163588288309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "18136765667969393174", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "937159502066696999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "12022152681602871455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "16985912104363932350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 505) },
-            { "3087801652564627458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 814) },
-            { "15643135666029727865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9530116228032101908", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15235409162483701027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "4476928353532757380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "970768445746568749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "16833854122884184025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "856877003890134554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "75742659105146536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6008613375871089139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "54019631544204590", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2832268621630415376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "4615708568396290002", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7843498978148810586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "15295951849706930711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "8463615810239412362", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "435888248913413834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "1082586642383386489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "6726099352298108756", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13676654389512816868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "2162882863309264684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "6450532136308941035", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "5680236635030250712", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15411474884532403722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 404) },
-            { "13176385389367548697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11661208196482963286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "3752171257634205726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "1435153323458789173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14841539539334726292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "17015328096102652908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8061914949376516780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "17442105631503326136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "14599780481362761532", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14947798627499698329", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2526832080529662683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "787363431787954804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "13855438905855887272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 517) },
-            { "6204725118764552662", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15650839696475698676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "12277470820821378855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "8528750110601691390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "14462438074931673266", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "7862815466573236157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 875) },
-            { "10702465758376061967", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5572956736535433608", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "18017913952946745878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4840004190985490064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9641089659148164809", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4160656836528944651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 750) },
-            { "1982176363226079588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 612) },
-            { "1938086876393565238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "16609136488331186895", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "17035903590837750750", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "4228437925117070319", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "6820284286806022849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14923692894655929923", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "14749947225382670869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2816353973187452604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8655315308767111198", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "3503893875515897267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1099) },
-            { "18426893729833771809", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7974670633697926450", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "10178951466584845110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "13883044928774243663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "10085059621136526248", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4086556132337751931", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11627532066884923848", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15963038745470172423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "1076005730007872492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "7431849514656037251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "12348135936862667024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "1622880009460832832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 680) },
-            { "4569338575782832784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4226968857681929488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "7605139219344415117", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16230621843665445228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5770286476124511234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14930789530046665855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1071) },
-            { "5953754321266570854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3854114166348568039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "16011429608661242565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "13327653786981478088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "17948637243158994878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13680926356824317761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 429) },
-            { "18174857480705846286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "9942099207256025216", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2598267743388306204", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9275303306340702111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13702692566238948173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14532519639619315651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "10295330953350618042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 0) },
-            { "5079055505117153635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1044) },
-            { "2438261005924916746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "14962768577232034246", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "9631481972809246378", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15048584393463312977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "12725647706191463348", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12228610148087508521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "10861769381993948050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3337625924046561031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "7113777272518482528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "6882621854468565774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "18034648276860485300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "15602218079503030465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16865879032845300007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4239133538073498792", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12972798847556569913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "8203550467004532364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "17422822627612865758", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "9999553425206328238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "4773123925616969670", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9191832520273617003", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7638626850074132214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "7667898603371717971", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5312140481706133684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "7532088618116521936", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8728178019712933221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1054) },
-            { "11919129623429545762", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15110359240685619357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "13191096881934434519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 740) },
-            { "10267260789603562117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1000) },
-            { "15225354446874994535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "5352061583962489055", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "77073286362822723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "522181557896569275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "10308175009371219583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "8943913562339525413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "11461581290174106570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "15320845027635796583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11655994466278963438", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "503369896500284129", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "15308578014507211237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "3216877571075556066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "991586070509079617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2265784112305305260", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8329846097322076175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "2129726780118554358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11587239927319376658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "15824189967727245909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4191326605459754690", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12319073009094248232", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 236) },
-            { "13369603621524676979", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18419183012101393192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "3215659303601163167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "659846949368492111", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14759179293743468995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "16582132711225619740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 200) },
-            { "4915831715914920982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17856816245251319111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 938) },
-            { "10727592780669452048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15899192375330393731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "2012181953284568566", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "3341302541468955849", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11465965972527519631", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "10706267011822108376", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "2622434279674583815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8464582977975377118", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "3621930417735246405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "4561874206785244358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "7802311886554362782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "6438522646185979880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "10109431802089940590", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "941829593638869991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "15129834325410878425", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2451712485584835395", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5779388310240896974", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15106614232165315070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "11690533591656807605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3041612155708729812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "8059328623525062913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7171904645566467208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "15901675909820977223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "16489624657475712467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 800) },
-            { "14359530849521980269", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "4999505377862312410", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "10414903047695486119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 675) },
-            { "5495776091407365966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7372956570616880244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "9700808806849459216", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3792945601873900927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "8140094412609934765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "11929531534620071758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 988) },
-            { "11955992313739654625", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "6370189612027110022", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18092842590142527927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "2903605246599054308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 250) },
-            { "12040626513219974957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "14312549767853703411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "13324157125165576832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 676) },
-            { "291868903926685441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "952318454591754214", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "12757611260347801001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "8615481457481938667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 50) },
-            { "6307939332939714967", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12229574562535756991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4282198629458668761", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17050675313067213312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1044) },
-            { "10628725059172743408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "9514210061704584354", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7223801044761006523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "938848188161536107", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "10218763091060511457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "12355112948013108181", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12353956380178079089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13951717514084457087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "4444730303823507621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7866128397931438774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "6423785822515265784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5495063314176654751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1172103288112689821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "14431607479949498164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7732899312577293959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "16504962609450876148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "11868551452004726281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "12987636957813312667", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15114370307779942381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "10869005786136023160", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "11706446082856895571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4062706195708729345", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "7243917162812988891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4652136280940317116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13503608041359512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5601435819039968726", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "10292243973236220688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "8025053805734757314", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "2891736961665476908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "15161053469199826008", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9372916528346260712", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4892959859293355837", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9485825829394109934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "10128390168715530898", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "9642229389394495047", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "6343396486660315308", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3477539135137665170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "17658152048177750315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "15993427814066246646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "13820498543284008286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "487214150851213303", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15078590909693331731", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4447065688824381344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "13644681270630373984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "4381329435655511217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1364546124782880196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "15450609897480659306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "10237524128771958432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8108843303778211282", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "7662200927459001757", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "6139574161497189424", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1643241486250690844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "5749536453225343663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "4806571630436601566", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "8241070786700614317", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "5287076386757143976", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10968768803038046390", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5796500397424307442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "10893432143734884603", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3265415000818832667", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16768797136991242472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "8873614802459592665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 363) },
-            { "8270591002934311024", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "17951403431757222177", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "13851240591038949807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4137755981477177003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "5589350202160007768", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6302958994152837045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "6084775920382972735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1018) },
-            { "6087091876057515304", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13646974121952099172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13926122593957480821", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "905780459938651623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "5381354625969068789", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9399994156762372761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "3070859615622845671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "7545013298074733778", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4282668574670785584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9529614587861271730", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "7977195117668583981", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "13439896617880328331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "743941460026466526", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "12954154886708228545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "15293727142789007900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8434794604559592624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "8107447526839063293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 124) },
-            { "13403161389559730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "16767392067294252396", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "775538461106687677", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "18210370419559876426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "10894058425957901202", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15579919505002150556", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14999920879568237166", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "8747430148550634190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14131851237755716991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12198263593657033426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "12985650543127289023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "2929715823970060874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "12894240573737168362", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "973966345068677905", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7465681710653503161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "4664983769199548480", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "9939234037869927090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "7606728651572102823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "4084026445911476156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "5170245731599664670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12308359047798183133", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9069334144391048686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 856) },
-            { "13418701036204748812", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13320828013530046693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "14483314305369207554", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "14435120971846098308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 567) },
-            { "10492056481694320580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "3007637520820789085", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3889519976910355277", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "15829095120243431195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4456004887590847716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "8079376692609682448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 716) },
-            { "9043982883185435219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "3003526572122876385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "12024143207855886580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "17174919737114915467", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10811837819834149164", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11583985978586657985", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "1900375942069325499", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7474639594232203854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15489746763312425915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15628121900226431719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "5912451559447635837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5221320470007950766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "6263019986730305851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "7881187047171099732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2452226948562393335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "1838534101161814609", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5843679089588930933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "10412588668458621135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 13) },
-            { "2669822154816760632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "517997325935712670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "11828175723996627443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "4550028191070279999", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5762290464889692462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "5393510569127725391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "17525564757769958678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "15488340031228619748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "2040762223425679479", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "1760690277175249985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "11092828091552833150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "10110395703775498948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 765) },
-            { "3216793152416217495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9454512817077883797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "13251091004269229867", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13938466156916423478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "16347412180100581330", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5643908654122573882", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10090036431487700311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "738850098651678143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 889) },
-            { "2554991397391195611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2204178900998688268", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8671491767142900139", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11850332373794932468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "3831261590121101287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "4099859307693687554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "1040650352205493707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "11583017348580874022", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17907223570737272640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 384) },
-            { "5898740235388207878", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17634966178519099371", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "1701609125136907870", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12194037100109755112", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "10424278617647597641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6996376303337512293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "4640696923527766618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "11185156002426041243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "12892693137085610062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "7024495439434892956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "18180655791734632264", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4644580321919256401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "8100595788531468781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 383) },
-            { "181006047500375768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "14571022040013651253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5115134711994944288", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16474284418841532356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14762599606783897222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "17106086048442658788", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17216583849049249733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "13132804928635689780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "7575675354187625951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3105425187506203551", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "1698321314111848001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "6664482192233202590", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12545558125736154584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "16559140502701231107", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "15823825508128158158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8526484907799590618", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17825280904760131680", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14054116974002669018", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15197248015210313435", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16075006181495932250", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6669808855737023569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "17025268985366223779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 224) },
-            { "649203303142950236", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "13800760323805415740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6195916781434462809", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11359409533744011242", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18109284647478027063", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5582896843095691256", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3332334993503432420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 716) },
-            { "5994204139128667921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "9759380701896779097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "6233612563637601101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "12675840135830047968", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4992668316921598993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "11086699387784339943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3349519148124496343", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "2128376438627103433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "52089503050497755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "16936366288366370882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7132328255408635227", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2862999234347597091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "14835309921389262864", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "11499219760597131534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "3432296808755992670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12822126914959112382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "913496537924971856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "8402692278765063674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "3221469860582147955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12773693193167844110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "16491532291908469567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "13328449155966085543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "17515573322312447679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "6355395905401306995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "628191607060767879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 95) },
-            { "10554266898346470422", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14335074487552883436", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10294185397756053636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "13814086981499638596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1098) },
-            { "15979956159651515122", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3109104171383198425", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "541817615957967731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "2809950092498355574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "2294318010381635693", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15847413004526420496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 310) },
-            { "12992194515157698316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "16364494883229084045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 311) },
-            { "5584432943673435454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "11862259122805366807", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "3643250372952944907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "16293101831324587788", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1051506168926530904", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "6656593119788274992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "12946531140050029900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 337) },
-            { "18150429561058646714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15677717057398875599", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18259656768460999562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 339) },
-            { "14103112843209793966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "11149782181562145291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11999246609107242706", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14540578324750869319", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3930314908786112883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2571882179292959757", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5172712078329324967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "17829047941256922307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 873) },
-            { "12515465135362865565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "8195881973746570408", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "9133263538092913983", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8906588133431586825", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4672441137336208890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18140951659547259039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "3220280315905987373", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "10328182165125764988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "17738299860390552088", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5582450255753679095", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "3192332625020432602", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "9062774198518904260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5497751772699578150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15277856047844308598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16913004986170202203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "3392693938352572136", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            });
-        td.td.insert({
-            { "3120553928584920777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "15052577143485630617", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "14808895254077106198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17285815901490707654", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9553032671453999824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 186) },
-            { "4800587664660105589", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "8048617952947915835", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4560479630843098090", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8527193566719173253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "548663565933738403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "13071545223094862275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "1569043950563130463", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6214194654733781771", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "59739211822469868", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "11901740241052104941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "380316849107383484", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15374625876485618845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "11825293922127550847", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2797723586312707948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "3759515057574218101", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17889864541794448203", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11428599290755097395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "3635446784873718932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "14038261392627717712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "11559360678008060513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "2525260242689556544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "8479958930889587809", std::make_tuple("fully_connected_gpu_yxfb_ref", 1) },
-            { "3116068331849795558", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "852092858392507925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16463823433924519300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1116) },
-            { "7353563160591978243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "8451212914744825089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "15857087373591747006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "712165731154577189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "1652781065871883392", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17006655627343469372", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3036808833459559381", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "10670103699537731664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11164519756679631743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "14491949194619001237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "14174888981602932979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "578703329577922869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1028) },
-            { "10000618285883395700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "16706121580364790904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15381833359831622179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "12493863403516600413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12935563359569230797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "7000524935770116969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "1532263118203058517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 267) },
-            { "18077281411861416889", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "1485662490111767875", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "12990527753120735255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8306337702797456793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11872464450773754851", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "7025975403069487257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "877436308867220589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3797957937905580811", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10384537928514123040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "9447458159095730492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16475247464223458061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18173314625562011976", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11670430946096342056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "5040730152867713388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "584086621952390547", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16025442470600124062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "5941852872160795604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4356817283284529593", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12667014405537239093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "3689722043202617487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "1473214668483422172", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9803492989444302959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "15669490019428002270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1092) },
-            { "7271236108345900406", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12609361477548272638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "10025839973092358719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "7211355951470869591", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13308187548669026714", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "14695781272831602408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "17490188677223978661", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12553441041059632729", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8500148569566077929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "998876398773540321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4428101657497677982", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11931568365395665142", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9280431727790048190", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7875272450497189442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "10899110544832584656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "5419775002149092646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "14385185911482960528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "157805434489791310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1030) },
-            { "9707630588260222630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "17542414935564676110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "11649407835105973949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "16218339663410630711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12641170321047008726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "5020788604681810984", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13970935346154374605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "4544242784357021697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4112696777811320312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "2355214244972870639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "2345023488044002149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "3179874645565098825", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "7869916853707978306", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3480732841490521799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 128) },
-            { "18424400171776141118", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13454265023861566476", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9695024256541464964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "12788968383428254917", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3526580286148537369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6071668124835539929", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4754967381316623440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6025872155179042054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "4342360467977736802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16758962840329202004", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "18251360413872841969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "1361159591875955678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "2613462626256090659", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "11031569203645035546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "9429695343610239088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 905) },
-            { "14289082888174784976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "5933743119393822386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "10730222715353420212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "11951606039079763598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "13893789954946953427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "1663285216972929652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "17477062954520561609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "8253823502854784432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "6323026044750482867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "3141886504884887200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "8490260671996115530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "16033512206711124104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "13961773444580398856", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10387844339156517393", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7603872175048237237", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11724225282274130518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "16352331970945217438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 736) },
-            { "5864250949922222051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 319) },
-            { "12988961529988078346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "18386376129938707290", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16071723603031305677", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4437258459981739942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "13933912937625580405", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "5853697372844744672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "5570311824197099845", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "7689320135952025041", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "6491244517639245276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "17564338309805484464", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4766071144928072260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "9091110033424983286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "9354818521586974021", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12985942652866621579", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "10967218651864700933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "7334966010680206302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17947818179123182001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "13190888313721073437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15078262396281327048", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7947870656736319919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "9090828337597312855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3150231129728961455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "1008476023750261156", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "11528417522960871233", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7121708962074176240", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "17101789600628162503", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5893940382830835820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "583303098958523195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "14813178380338948912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "7349880498513046830", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13115589642140732066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "11744368351982723504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "7394217382008802567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "9454954846682513038", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16683089431066989909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6290317420155851465", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "11948858355027908365", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6114241186364821679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2937907409658060025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "17025182465337728023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4084106758501882407", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "3985659568982275663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1123) },
-            { "8655883535274781128", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12461575861709234385", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11768117585574496387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "9438739171104456179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "1742897526168249500", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8792202318168046223", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11490143853656040028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "4491380839102267034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2967481531952454828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "10256831975351722184", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "3788462090984291082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "8106738346643994005", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9500850790449116723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 758) },
-            { "10979362792894404338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3141773224039276177", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "16588325081458426169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17647962002015093887", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "12782932626966309185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "1706927777850488363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1372939511728986224", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "17877776363798202236", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9056038338958199256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "7708321360699824256", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15713964605078748923", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18172711677056449158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "1218323229202187514", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3102816736961785641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "16863960779539003201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "4073467095502162430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "5688478347124565305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "8921636651939679647", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "388828310152538138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "10292349730148518173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13708979487306970634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "4196367396954155354", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7649413902932043811", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3926585856863002495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "8501145642605270365", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13170441257780067955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2983038203471784211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "12480527132372884168", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17640725195881101275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11716771904412649891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 438) },
-            { "1436052878894538927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "7918742312252115870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 279) },
-            { "1626430741965136732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16267682394077585279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 538) },
-            { "13709111882513486557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "11469881811044037340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "9099720270958987421", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "4983880246908724272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "9657324846330221372", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8860815977851486767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "16426179645101678763", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "16206791915939407806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "1033385936344875354", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16744011463988595802", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11060822686394981344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "4897448054295474302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12031180482028822765", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16789135236017252073", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6942622405269419082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "6181308879301978465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "15860915170591763391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7447163906170805189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "6312971928547466668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "5524215233998361104", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "8032685176029570383", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "9947449295659685973", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12937333118472722002", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10023279637210292010", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1115) },
-            { "13183380647506951324", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18203935818408469865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 653) },
-            { "2623687018437195679", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "17723621158215826108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "3273748387141431306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 93) },
-            { "18094205332383644037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "16547425454653232058", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2857337999074313592", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "654821507679356726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "15026219694198820614", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4533786844080178561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "5440983284868981549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8532217744217419503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "6522575549211855712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "15675903059949404837", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "8567667881970262923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "7322472892320910654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "13139625572508441980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "8965747921518186477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 419) },
-            { "13210604117940125947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "4505008254511324231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "10635659193402005820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "10917498758625273194", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12581879452540858313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "4082229510324076196", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3037042229494600258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "8036474422877454869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15011504472108164173", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "603883331897298932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "3017411837779243878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10398572248321217585", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "10747988576436391912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "8791285622784082122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "2041212737963974230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "916389941321470163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "6580334406272192111", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "14343008518525689150", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7472330881076141262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13575423234109624706", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "9954050478761346921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 610) },
-            { "7072606962946873975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "12408889192918919210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4622514167765722873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 15) },
-            { "13184662326021747000", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "5835634465164771899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "15778834188130183853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "994182747184593564", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "11207257238719531888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9692654253261175490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "5629670679897666607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "5762878778443755104", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "2150326211917340956", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "939718260623752240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11459784003592366395", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "7581174843529024536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "15879172437519876393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1201692134690347847", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "15916505622570323098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "10135458965276110244", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "11820789223587555410", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "15466940145773097237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "9839670675413379092", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15392077168521832549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "296142385116663420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "14258499419905714808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "15859493313686060349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "17444003685761357480", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5840254078917931433", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4991419288164762786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "7104309382120208659", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2477849395789783501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "5331173521406046122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 646) },
-            { "14553856088069405595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "13379165253894817165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "4871907623235871050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "9440117898128288296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "11632275875447013409", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4865102850562917067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "386749666417295495", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11834361584875491425", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "1497560475414454618", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3746573775462003750", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16264774056719724826", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15799159401545270696", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3599823735065658574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "10536316961655703500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "13447028922679236865", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "6133592828563353516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 310) },
-            { "9452470718398027950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1031) },
-            { "13512863534076172940", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12978370505631031751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "1434535531617424039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "16986358655784856534", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15661322183507404821", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7941729567451949422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "10488269059469838160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 908) },
-            { "12696412964119109465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "12776081190690731910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "14994322266840011040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11275109735493317886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "11806105193035393795", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13131740479277027362", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "1996860183441418841", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "706370730287471796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "4006884370026272807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5519535335798045279", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8141428150264829362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "4803370483104261655", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9269175963143039426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "15178921033274918199", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "192209423643075326", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7570346182940928159", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1251525426317284548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 23) },
-            { "1509728225855233852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "12643423612381102003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 830) },
-            { "8540111719936129376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "5429130923188159806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "9849272539053219052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "5522698342845820411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "3691705516240577130", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17010172246526353957", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9928406318940388716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "9999955037598579164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "6403698142681887543", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5795073619189010837", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15118142492742177336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "3895088069642140043", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "14447191095937730964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "2124033349728954551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "16522364268583242080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4239415134522959352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "5658664813683907476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13738760763969959522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "272730229972987861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "4237276338897143680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "17961702508543961900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "16152775342222431281", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16425665058951535484", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "10787747981914307179", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11703557271443535142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "8640150341228170279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "2096779676054335057", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11975047184326016230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8482147530539941792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "4734389463002799056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "4129722446574108695", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9795194069954915563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16681690088928624738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "16567486018945740036", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "6664432489777052771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "8006738296385794413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "12809199739984715013", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "9366201112659847392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "577844026691991089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8866736221671835567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "13839116996827687373", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5095827462645341808", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "54975980454651672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "18277685132620834972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "4914435717288687793", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6584960721513702502", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12393385058735194260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "4465781406991476376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "4135068756462147853", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10808909442136736629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "6904130543085920483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "11450378244355788918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "8618835732380720921", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "2251029128552117936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "17724604495865223459", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2226745622763268469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "7307271009495440764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "138379779469699309", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10912495395422146386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "11239754372812258455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9519623751582710696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 439) },
-            { "5041111302824362529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "12489973984967168447", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16442107352245114876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "17318287523550546026", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7199295899520406795", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16461809076899645037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 9) },
-            { "3682813162987778705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "5876880412336151866", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "16430562172386510259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5831419373611158773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "2261453441277654139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "4398371999113956082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "7106362077449435105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "4635570915184713874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6048964584602891448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "1551596771935253711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9522661528867955338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5740738339752793113", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9220830217525628783", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3372770576629463160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "15702382940521972117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "2052712465925238009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 813) },
-            { "12864204111424196179", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5637480705139132901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "4079026972040047969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "3603706453982734995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 573) },
-            { "1643122514049603104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4138968242532400395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16666792471632326054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8220168481755031959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "3430266954211750407", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "13760645810144930270", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12207503176295152756", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "1788455099959676873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "2140514316203117958", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "38736266675995457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "5339985303398206057", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "4161141078006269526", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17443356777503458523", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6410682026872155392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "13713406612642090169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "16409729623371222748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "1155389358857780776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "2231648183489019418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 814) },
-            { "4056979460327024961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "13459514533473657102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "6181272224000872375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12625112690264223217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17109520309574369561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12952980509662451384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "5805383505505929391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "9606639214735570069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "10169992769527680821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 700) },
-            { "4338023436590582323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "16705621644424684055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "15334195300678132907", std::make_tuple("fully_connected_gpu_bf_io_gemm", 0) },
-            { "4625107584562815965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "11848462434662954749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "13352000946213986936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "17759505449240263390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "4026686872534942904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "5183231560876991543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "3391032227732782982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "7177837234452118325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "14578867494693499627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "9410978119783758141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "3304589333915676807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11728824117049687850", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "708747442142592697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17798636687709019154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "15959543980008442942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "16781187505186394353", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7183578232279711009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "12635265188475834607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            });
-        td.td.insert({
-            { "2800949804770763798", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1882052795393187384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "9726913113016874092", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9048522050692986204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 371) },
-            { "15133468875250992696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10429613013253088132", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8083672466967374860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "9882204352209412039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14104238386345631681", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 0) },
-            { "15047676717402283805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11324851661119942609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "15796677813117622429", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3429844423226609965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8843585527713905568", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10293186062391000719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 7) },
-            { "2986189945936592561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "16921939234324970069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "7900926714874404219", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10512507780534402341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1022) },
-            { "3755253206085028904", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7524311370696987092", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "14991602704357959545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "10728212277329722684", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16758697697363920520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "7272538316511343863", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4403753181729432604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "12365282242489300092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "6205240287062600210", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9869959062341950047", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "11265472910579659280", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1540041682425757361", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12068797674575015662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "14418429155823196539", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15529757761327002288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "11727227430687227444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "12309132521191764927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "1056009037551688122", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3711525118850629466", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15352245788978088971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "8819268903800581706", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17201365233492366678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "7457899998356343871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "731825454731954517", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12972634653821069685", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "751912075185318190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "883436333317162926", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12024817951074673335", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9101903304994333336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "10573920781439771673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 300) },
-            { "7840653268996892538", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4738743763536059708", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14077148976508649021", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13590444711975157776", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4479117540570599742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10923480230259977438", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "1914964404168211864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9040046051053703359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3218248162832023196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "11830297960718214360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "4325081100430903742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3202085450628781999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "16027456210394993913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "142486914279119363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "10128143628088846123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "2732519635571994212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "8984436655107983227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "10722782762733112118", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12730339458081890990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "4531222427159927606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12668149981216388765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "12087141795291232248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "5659168916726488798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "18431306649860116380", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10682918518101379579", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "1822096761703761792", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "474139120607442270", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "5334190564423375247", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "760687670112194844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "13178480813522103091", std::make_tuple("fully_connected_gpu_bf_io_gemm", 0) },
-            { "17382660912493284320", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5558136691773431495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "6863331059471727622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "941626985322260281", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "101401523793806394", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12557015880639217508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1091) },
-            { "5763440554939527411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "6635217802203685464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "14352303529756685990", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16882092367103683293", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3272017687600371031", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18424912460022156378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "16770615142634470903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "1752185056297124917", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13317417676446624018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "11883485911218628865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 302) },
-            { "7700321970687976931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "9423854233835016530", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "721174714308243785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "10548792624072794724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "2608363732937932266", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "946479876892100082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17809920600993699808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5334291640387922287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "4894227264080887361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "12238674883388043717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "6733731409232284409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1109) },
-            { "14502856487639608696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "13538051178827008933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 107) },
-            { "15759530339367380982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4903592553439092472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "11163107409437069532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "12179581684777023804", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16129296588866116913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "16065744898134487748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "2543041530639980505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "9751582946441607796", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9785114056964539323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "7500192998744460131", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "9622546530872848323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "17154337492545826355", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9404677451270692749", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12388375914105990324", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14811603003184578943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17522452942286240233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "18082422341304348326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "17224104246148265328", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "9477562342190423343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1100) },
-            { "5003718302026277632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13204120207726209723", std::make_tuple("fully_connected_gpu_bf_io_gemm", 0) },
-            { "12112853999307505628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2440366541074371090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9101334153142718004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15619086801947147359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 764) },
-            { "18180820925685532104", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14122213471825630433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13253775441326432265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "4013707396889204359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-        });
-    }
-}
\ No newline at end of file
@@ -1,3855 +0,0 @@
-/*
-// Copyright (c) 2018 Intel Corporation
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-//
-//      http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-*/
-
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
-{
-    //gt2 b1 b16
-    void tuning_cache_24_1(tuning_data& td)
-    {
-        td.td.insert({
-            { "3963106895592011725", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4915831715914920982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "3759057398165607194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "6670327979947471550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "17793292063552633023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "18271689282126907793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1063) },
-            { "5951936376654416075", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "956022649859563080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8460847842045253466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 13) },
-            { "6585223640997887253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10784073615329190425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "3621930417735246405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1016) },
-            { "2623687018437195679", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9562291747339451180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "9152451371616153112", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17377293745073971167", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3689722043202617487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "15522785615618973614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15351724241036614758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 166) },
-            { "16626226341188424071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "4542143431130171516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "11430400968543668873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "16312223896859176991", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1779941298820543013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "1096671695414716274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "10173283505468233128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 341) },
-            { "9367157746678824712", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11932770338770247767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 435) },
-            { "14738573151275130683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 997) },
-            { "1938086876393565238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "6772239376357727149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 470) },
-            { "13550435052563656432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "9323825370872655346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "8819268903800581706", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10058165874008941852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 948) },
-            { "12277470820821378855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7394217382008802567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11066913713501760080", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14947798627499698329", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18245935804520236353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "11703557271443535142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "4408600136502382976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "7524311370696987092", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "1143214652021653634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "9101018613418825655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "381149736509958403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "6767245864232675168", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8260130048649729185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "16234606052818596502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 466) },
-            { "1207026216972160297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1078) },
-            { "6553736978928374036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "9514210061704584354", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8376077531098664520", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7474639594232203854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "3041752019114501584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "9780938731831129283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11115684531624462986", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "15591167992985613695", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6531171505861182429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 758) },
-            { "17353894529222574441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "4381329435655511217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "14418429155823196539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "13597240991532942069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1051) },
-            { "9979259596137305973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "877436308867220589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6407471972820516685", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "12929981792125924963", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "13484950419220835364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16474284418841532356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4750755523645265967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12181607120522804433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 311) },
-            { "59739211822469868", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "13973179950424276578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 809) },
-            { "4013707396889204359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "15860915170591763391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "2973436171295280783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "18202222342562516071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "1306339989221885682", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16117738994809548007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2324120381399737261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 522) },
-            { "16683089431066989909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12874626654611400042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "18424400171776141118", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15334195300678132907", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "8866736221671835567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16294825599850364701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "797387385159110695", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1478419046264331178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "14872992823083730615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "593712935037568960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10290107543739998181", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "17306482303091342504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "14006248791647711759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "2108296560864415762", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11275109735493317886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "15908673392788376468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "1403617451623027879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "5876880412336151866", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "15315327794058441258", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6821855018718422278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "16190949264253468961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15661322183507404821", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1742897526168249500", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "875296362957469305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9287404618748313247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12164298124869114517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "5172712078329324967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "13842309033760176194", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15823825508128158158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15451919862187018297", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "1604661321386793876", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "7549378486471456156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11267742746905371769", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12675313398314286884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12380856644683171627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "1643241486250690844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "10377729875228238588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "13002363400738122017", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "5326247361632903583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17252449599613270108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "17087740929472936216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "14898892437285105327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "11878734040194151073", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5245308722062496788", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "7271236108345900406", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14359530849521980269", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "12112853999307505628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2543041530639980505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11318913630213187720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "10237524128771958432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2908249767551054613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "38736266675995457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "4652136280940317116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1103204698908514224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "11806402239500046867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "11077876432364512822", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "875142032423622622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 542) },
-            { "9553032671453999824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 941) },
-            { "1559798212423183813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "12242618640422208652", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10971070835319242371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4738743763536059708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 511) },
-            { "8971115542951085891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "7279393739634103483", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13926122593957480821", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "16383540667048742064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9399994156762372761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "5629373398445592781", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3835286851569826052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11619548409913646265", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10112032316939871435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "1003101267609305257", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16206791915939407806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "4236174000795439083", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3524531620118359828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "1154228007901031779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "7570346182940928159", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8275277322582733101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "16783619135298589974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "13898821685774165645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "3273748387141431306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 808) },
-            { "11507538232733291666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "8104309105061227444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "13132804928635689780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13384754476437374504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "9933958860597451711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "12643423612381102003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 831) },
-            { "16816222375242496370", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "265124365266629363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "10554266898346470422", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14578291812739325465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "123251351612308092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "9285566577169147378", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3109104171383198425", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "296142385116663420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "10990741293315393791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "14026570177552137240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14462438074931673266", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "6996376303337512293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "7998930863626763670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11327228813412934262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "11850332373794932468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "15374625876485618845", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6981537186704688907", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15851356529373376076", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3291180926381314705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "6204725118764552662", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10293186062391000719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "709835724029986012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "2659712601063515059", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10791067159964399241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "8965747921518186477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "11022847760121601465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "17839839336294937155", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3199841714087553410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "13046322179198317310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "15308578014507211237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "8124736388338424498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "14990645740260870030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 941) },
-            { "13224814158106791463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8241070786700614317", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6623182990939010641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17796310681498690253", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9410978119783758141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6635217802203685464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "15381833359831622179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "12680339228267704518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 540) },
-            { "8071957466247137919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "10292243973236220688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "2423754482456771339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17994361454416813294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "9173631510896381179", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "423221712829930726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "397770940444464146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "14152716242882609401", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12297371032753209816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "9263063714383940562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "879939701282942121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "12014527187730671229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "13248567106128518549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14923692894655929923", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "10783981060353445280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 57) },
-            { "4099859307693687554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "11897113890115321056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "939718260623752240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13119479079474639169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "1056009037551688122", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8264178890341675354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "11754316727756881612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "10968768803038046390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "1081962464388501987", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13739257060165119132", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "12985650543127289023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "14974730512607138726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "16236397968499692493", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11855070245618904113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 525) },
-            { "17829148383265978140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "10279778381617181802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "7688176479120305539", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7009735776703529573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12516911293946682547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 246) },
-            { "509781001842353609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "9182897385081081193", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "761169277744593430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "7472330881076141262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17222005830854879661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "3480732841490521799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "18400379759523099542", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4085450203909854919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "583303098958523195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "12843671306854567956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "4991419288164762786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "12557015880639217508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "12990341489637414845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "4640028527711211109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "16692569816843207989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "10987953316324712538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "9660812093766156608", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4456004887590847716", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3063055767192991776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "13642146548740074992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "14650567822254940018", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3930314908786112883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11031625790234068916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "14057348639391787117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "9259437778054905599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "15790005937034794347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "4958222070605478947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "15392077168521832549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "14491949194619001237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "659150305191479097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6820284286806022849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10702234389482091891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "10196332102593337214", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10989937450490049763", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "12517838703662330663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "15488550074426713959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1099) },
-            { "8133587696326295326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "11147816119060617810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 875) },
-            { "10264913782610095832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "7824524940405130010", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5311718276151327830", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9213563311267466388", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5103094815475470596", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16352331970945217438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "17094948685292534952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "7975810844103449438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "4479117540570599742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5057534502588100071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "6048964584602891448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "1077773457856682663", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4992668316921598993", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16833854122884184025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17006655627343469372", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6458124573210430792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "16945184617367657570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "18133334552107213128", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "6323026044750482867", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16969463538496570528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "12427258337646070422", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16589607587365212240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8881150100883636392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "10573920781439771673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 680) },
-            { "6025872155179042054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "75742659105146536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16711955423531846725", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "8560635685184432720", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8906588133431586825", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1051506168926530904", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "6232363902828992968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5584432943673435454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "6040286126398028933", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5592556538784745960", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17106086048442658788", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3140230065585683313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 997) },
-            { "9404953235624894187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 845) },
-            { "5336120047683197088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1908809004094565452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 142) },
-            { "4865023158176874622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "18084635102736402756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "15026219694198820614", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10642327923162019888", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3895088069642140043", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "3277243911383750280", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1500571771538985941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "11873734271080160669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "13816104794723484993", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "13189392239349392492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "8708643228914766202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "2651385050387738902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "10890975553758439233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10728212277329722684", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1036010477232750453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "9604982746455852556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "12090536142661253835", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "4437258459981739942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "13312514874803986753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13583166868754499339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "6263019986730305851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "10384537928514123040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5688478347124565305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12809199739984715013", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "17423645390621980919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "1616603916015535857", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "15947699374684516369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4073467095502162430", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4465781406991476376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "12672995204641007004", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14559308665571750465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15466940145773097237", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17790026124881397912", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "9389555743403158574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16336482874764861478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18136135457402651842", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15962137123591591534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "16025442470600124062", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13436376034548670107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 373) },
-            { "17281202179589913619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "10109431802089940590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "16833026567865627676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "11716771904412649891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 435) },
-            { "16998508915819714690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "4660288622381620227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "17316626950179740845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 948) },
-            { "878892264408839067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "4897991181236908768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11113256687741667688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "11956435900037329302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "6233612563637601101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "18232278892738147217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "3272017687600371031", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13890118723041457532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "5953754321266570854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15118142492742177336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "10302338806536775954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "13990028451169604107", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12956726277674279950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "4999505377862312410", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "5524218746051008792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "14670068483447729857", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "8707189142909022305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 986) },
-            { "14532844474906286088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "913496537924971856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "10492056481694320580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7076937538747704750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "2669822154816760632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            { "8107447526839063293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "2044363708106765326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17808913959977434594", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8762901342272872498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "17658152048177750315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "13853056718266488510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13300022131572486202", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16403423801823379909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 94) },
-            { "7009873605945341897", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9191832520273617003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "5079055505117153635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "11810221946429451169", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "9810904714798127155", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4086556132337751931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "13059207969254830451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "17343050785312683560", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13723543003759101485", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6854611304056079417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "14281201038135286621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "12860222041026638681", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14363654136811880073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8176012042686275874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 265) },
-            { "3304589333915676807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13464226348405628455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "3432296808755992670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3782315919331102574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11706378390483804857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "4026686872534942904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "15322019609805777935", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17881905640473324965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9824678205469832038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "1316444335300814745", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "6391847213494189692", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11609821372586026178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "852092858392507925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16108573960501496757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13713406612642090169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "8153567933591966877", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2732519635571994212", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4161001033681779582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "2909728331855309274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "17854578307286932628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15511138074959300404", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3430266954211750407", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "9642229389394495047", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "18140951659547259039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6711878663358611849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "6149673627320838019", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "13951717514084457087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12232696287029987946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 165) },
-            { "8061914949376516780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "3526580286148537369", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1098) },
-            { "5912451559447635837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "10025839973092358719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "12214162812589030126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "17050675313067213312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "6329618009202266591", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1838534101161814609", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4806571630436601566", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "10178951466584845110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "13139625572508441980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "17208186152576814861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "16266491618150971928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 373) },
-            { "18173314625562011976", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17024388383581997032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "5353552956675518468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "13698389420396031586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "2710485608298356329", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5485749317130402302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "13468713306678453952", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "360872770877634346", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2242915551775617989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "5749536453225343663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "2497756607567197523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "4355933224673863178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3438116423688595487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "3682813162987778705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "13709111882513486557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "17556238490521153146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "272730229972987861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "6642767323474835034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "11284755586130392759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "1361159591875955678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5763440554939527411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "8295126647635181949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8306337702797456793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "5115661026367632863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 765) },
-            { "17001502418583498926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "2572395498687401679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "2052712465925238009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "17638692805430115529", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4085907608404305515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "2727219457659794468", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12773693193167844110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "14630499010941056793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "16744011463988595802", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6942049339361951275", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "9275303306340702111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3033264172690274208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "13102754309439605192", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14695781272831602408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "9798585825695496550", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11443268857010762276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 235) },
-            { "4674416595144505741", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18269685060032395235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "8751016391945753900", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13237050834496100264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "9522661528867955338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12696412964119109465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "388828310152538138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "8656468860180713379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "4867937397499803072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "18377298651236993830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "16108759090923335184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            });
-        td.td.insert({
-            { "6578908625437515675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "5504757952698692953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 658) },
-            { "11461581290174106570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4112696777811320312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "17015791782274123780", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11465965972527519631", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17977676737774695825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4163359403543480821", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "13328449155966085543", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5390559917122707732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 57) },
-            { "153117141968471446", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9257078583742821465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "10084794570892043447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6171845068913882721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "16076153317792960383", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12962552332511702682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10000618285883395700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "18172711677056449158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "6062246008880097669", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "178353385245384751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13192808619929896995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "2451712485584835395", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12523676912856063091", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8818070832398055086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "16131448347558322280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "13054405729329143152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3138374672801504481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "13702692566238948173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17301887391757619741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "12782191856884962803", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4670443882075998209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "17515573322312447679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2968031010495399536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10323345824599612614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10555597973766215754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "598390166442977699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "5659168916726488798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "14811022197918391667", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6882621854468565774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "6146876760962332928", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16779678846332091086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "1152693503778768433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "9594594523961285945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 927) },
-            { "13115589642140732066", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6093575518270471235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "16426179645101678763", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5419041493176804960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "9192665896782282996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "18233660940545931789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "16129296588866116913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "8108843303778211282", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3892679716763161057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6644418194983229139", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11086699387784339943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7843498978148810586", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3007637520820789085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "16865879032845300007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "10482582307328548806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 379) },
-            { "14841539539334726292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 171) },
-            { "13713501506522022845", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11992353959766718397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "5522698342845820411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "6688522645556262131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "4818231379191523896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "1364546124782880196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "2440366541074371090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "15485701086886851362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 923) },
-            { "54019631544204590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "15847413004526420496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "4366168099274266975", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4424217045094988504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "13951781924205611716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "11582534256623549131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "1832310305089212990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "11599932445375240727", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13459514533473657102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "425744529089575241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "7024495439434892956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "5415319660821122528", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "3653156933813711765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "5740738339752793113", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12545558125736154584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 571) },
-            { "805221045541170643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "8006738296385794413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "17377315194963069204", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "276407276027553756", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16720108310653948550", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "1819720745131968914", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7264756313770306662", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16467987800266816984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 216) },
-            { "9529614587861271730", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7130694811424715594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7869916853707978306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "11636129433022017868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "713121569924250372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "5334566325056222430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "1138439260035360722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "953306082374100275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "14431607479949498164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "6830387121684699972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "6355395905401306995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2128376438627103433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1116274074896622552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "11169292427557543138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "12935563359569230797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "13761566845514364807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "11723735945517472199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "17847109385592002207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "4957638663977636791", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6133592828563353516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 191) },
-            { "7311120574972466702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16053585286807864356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "846088275031979661", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5495063314176654751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7962991673727743706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "13200151444914751729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 547) },
-            { "16370218798911151331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "13538051178827008933", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18077281411861416889", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5448537627319798272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "282274448389888221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "18203935818408469865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "522181557896569275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "11052732052072367261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17154337492545826355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "5843679089588930933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 146) },
-            { "17877776363798202236", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5381578460674280089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10320711719466983961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3491333679577961640", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15490478608105402679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15123868617509445149", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "17775705003104146872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "16789135236017252073", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10509933181132310969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16955653765071712611", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5275016494706355806", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8860815977851486767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "861419637283812778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "14353390922580547467", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "9028970753877215614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "6341197991729122563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "12707946849050970702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "158222105675022402", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17833517350994024381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "6681818065741882453", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7727001441358508665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "15579919505002150556", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11077503608116183709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "12247991248100147706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "7875724726741958520", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "9513032457323269513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "288853243482418538", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18062849937960759210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "16863960779539003201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "16491532291908469567", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5179760459095053114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "1155389358857780776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "12365282242489300092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 45) },
-            { "15619086801947147359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "14749947225382670869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "4800587664660105589", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "17382660912493284320", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "9100044555742394133", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4488336106517889531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "3003526572122876385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "2525260242689556544", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17465517455679097501", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "10892706534058849825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 288) },
-            { "3218248162832023196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "13404888565084206853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "15126660425728872065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7025975403069487257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "1471837664358450291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2438374917504708831", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "52089503050497755", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2597453794298356435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "17525531790109748810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "2915165824085219545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "17050143605017295447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5047419871737940985", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "751912075185318190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "16362139250976572928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "3831261590121101287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "8961138963663532667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "4014667229872705228", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12796777049340516563", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11254635684957519432", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "156456996459945842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 435) },
-            { "8881135571874888085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "14133958262039763609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "17243648226968859637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "11185156002426041243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "9354818521586974021", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14878347463243157447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5115134711994944288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "3934290309368153435", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "1473214668483422172", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2502125887857336825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "15669490019428002270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "1334070221835422461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1996860183441418841", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14599780481362761532", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5831419373611158773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "5141753233513623264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15217183882858251099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "2809950092498355574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1056) },
-            { "10436819182310112786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "13497225521878034159", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14038261392627717712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "4135003545872878882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "18273537339378756543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "6067904130482758510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "5170245731599664670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "12022152681602871455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "5801429077171542466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "11686670048744589243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14025496192869856801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "10880081193716628051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "15767973630744679517", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2862999234347597091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "8258382025812748961", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13954144830230671601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14763982961176216679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "3974589991022739479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "8618835732380720921", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3599823735065658574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "14484890926084856480", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7565221050911842393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "5848293219267886434", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 536) },
-            { "9321208819255762521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "3192332625020432602", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2040762223425679479", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "1939140810847988694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6614833247756539341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "16103943009195163681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "13320828013530046693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 42) },
-            { "13613399861925108148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "15628121900226431719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5608133987357542077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "15884763176333003771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "9882204352209412039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2622434279674583815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2065752819810364738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "14420809655798184553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "789359733867650915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2100891581797371600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "11311859068168414878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "4703107905652287491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15378025640603637387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "15192024816519005250", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "16683485007140805060", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "16541722316343690197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 504) },
-            { "7179714714302073459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "16430562172386510259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10294185397756053636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "14068780861332616363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "10414903047695486119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 680) },
-            { "13800387305792597325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1035) },
-            { "6129602738379919488", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6438522646185979880", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14077148976508649021", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12081835728078383819", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "5524215233998361104", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10647227605517025377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 508) },
-            { "18005721959893562716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 171) },
-            { "1545105800386716684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "16582132711225619740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "17599383258252980421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "3392693938352572136", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13410850301164057911", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15993427814066246646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6181308879301978465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "16758697697363920520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "2969389503332309296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "2893564501191050837", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5673972310424776040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2986189945936592561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "5629670679897666607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1028) },
-            { "5656623709782744241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "16761856644242716357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 843) },
-            { "7000486794832106857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "18137106379929135901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "11814740669468421049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "641417817126876622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12190841837604350271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "13814086981499638596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "16547425454653232058", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1663285216972929652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "12812685418923919055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 11) },
-            { "4082229510324076196", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15650839696475698676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "1594612401422787491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5597908143491399643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "13540002981450186147", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "12098146032672599222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "12976499206227689731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "6418327009347170687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "16067605128297748820", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16036386660666696362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "291868903926685441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4499586349553581439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "5637480705139132901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "17089801601582809764", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4474697990228400564", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13681462437496627948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "10556089809203693400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "1882052795393187384", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6471563320494376693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "6904130543085920483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13439896617880328331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "18043340998699622388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1653274345637156919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "941626985322260281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "54975980454651672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "4553409514380460123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "4750894407873652809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "11459784003592366395", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12085348936192462321", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18268811652302076976", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4161612746310931789", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1701609125136907870", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10967218651864700933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12421707187947291166", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "12040626513219974957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "11559360678008060513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "706049518431331645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2294026590516781945", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13176385389367548697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "244921290040927639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12617625046664709483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "11149782181562145291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16230621843665445228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16461809076899645037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 9) },
-            { "5933743119393822386", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2171768477223405739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "13455881643467418059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7351401242363888463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6087091876057515304", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9133263538092913983", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13933912937625580405", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "2597523728660247862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 538) },
-            { "8788703258318141635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8140094412609934765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "12668149981216388765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "3349519148124496343", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "6443517114667332732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 548) },
-            { "13898284586432291433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3215659303601163167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "12278364834477923930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9840495023131952174", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12971822824884826169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15287650965861631130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16172528828198474326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11913020016435860608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "17700958439420868719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "9438739171104456179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "8990561333549136048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "6075691042233712335", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11951606039079763598", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2937907409658060025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3102816736961785641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 997) },
-            { "15962533525948221648", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1024) },
-            { "1451466106918423837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "13607830451968188080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 172) },
-            { "1774158624592967937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "16208488491972128275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 809) },
-            { "14224121742920800990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "5912303851874077576", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13972357557211413688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "14230385851791760020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "9274179337770060652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "10085059621136526248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "4569338575782832784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15163327502374403643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 175) },
-            { "2526832080529662683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "8141428150264829362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "3032921857841371728", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16706121580364790904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10591379189397010097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 613) },
-            { "6942622405269419082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3750338655074082587", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "7777333052643961206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1028) },
-            { "5159470523468873105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 175) },
-            { "9216608098626790565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "17856816245251319111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 939) },
-            { "10295330953350618042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "5219399418946822456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3120553928584920777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "18012549942299450620", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2140514316203117958", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3001615302961701154", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1028160614515220430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "8025053805734757314", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2251029128552117936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14104238386345631681", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10670103699537731664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 235) },
-            { "14711697456265712456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "5622089373755094139", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2730604806511016352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 524) },
-            { "15640202505592598653", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14046114605615338907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "14103112843209793966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "16853250891250756537", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "5132761922124425835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "13865227850818392065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 429) },
-            { "18092842590142527927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "18423051691107460439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "6982733543386888622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "11883485911218628865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1041) },
-            { "14335074487552883436", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2940027113687311893", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3217246278485567748", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8739347545059610410", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17824431042110985323", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13093429681061786539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "10424278617647597641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1652781065871883392", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9988801796928462423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "5221320470007950766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "13184662326021747000", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "12069726772532946193", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "10046663998164493552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2571882179292959757", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17309326904418811234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 948) },
-            { "17791773192152464021", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17427036330773218054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "7918742312252115870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "2797723586312707948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "4505008254511324231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "5609922876429907954", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14546281065004619074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16043683538361975370", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "822162932339827810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "5805383505505929391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "18432787283148809023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17832542092610191859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "1706927777850488363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "8709632541892447149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14381420852659789698", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "14792528369891965810", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16489624657475712467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "11709992724966310174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "17542414935564676110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "8253823502854784432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8268533335852735248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "4795705973706796563", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "9525853014023664813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "5319668297345215520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "4229105529069729944", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14686278683380845546", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "4544242784357021697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3087801652564627458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 60) },
-            { "12218337369633748663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "2857337999074313592", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "9928406318940388716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "17596685300497748803", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17035903590837750750", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "89439319782574517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "318377908569897093", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12011982029561277581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "7941729567451949422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "8728178019712933221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "6290317420155851465", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "15702382940521972117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "5240181393417899912", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "16245760498096322525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "3067806959725855130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "3633858263279042265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "6491244517639245276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "2096779676054335057", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18174857480705846286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "6302958994152837045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "7915318733663535312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "7104756264011682902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9707630588260222630", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4282198629458668761", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12309132521191764927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10157866834809927320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "12609361477548272638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "17522452942286240233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14994322266840011040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2261453441277654139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "1573498199681662714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "17542176922797334839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7744787957569714828", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14733510474010040334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10408322429232132983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "14088382963493477342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "12515465135362865565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "3796274347773622633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10679760989906275129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "14719421757340260468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "6181651715051152713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "8701248964531180496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14691372262153587653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "5120466856097219243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9481675228591993785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "11682323163346544125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "17006133396401462698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            });
-        td.td.insert({
-            { "16609136488331186895", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4265693151382066296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "1474271081523145413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8300655194765375060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "7875272450497189442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "15470013032930986062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "1540041682425757361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1078) },
-            { "13708979487306970634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "17912189681971987483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15641537661939240413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5219048275475447369", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "10690972785852373520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "2355214244972870639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "6008613375871089139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "16446533347502650316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "16037141448095945650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "2281119269283845320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "8929453032482114162", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "12892693137085610062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "6631816968511312100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "17193614571243427089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8843585527713905568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9213886570531053949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "7881187047171099732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8127190765748950828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 265) },
-            { "5419775002149092646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15997754881872769378", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "700717277178942679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14553856088069405595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 360) },
-            { "8616686489737649890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 942) },
-            { "7807983899017500046", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "2038505773698938555", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "3889519976910355277", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "17825280904760131680", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7370273921473161914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "16559140502701231107", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11473442921040533207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "11215217005872946038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3706994659266083979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 547) },
-            { "3797957937905580811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "482564204402769504", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1089679781525023551", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2307310127637739872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "12793908914872030220", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7272538316511343863", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4642234334824303290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "15882969506682501496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "16884396694505987920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "17713034180977313726", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11670430946096342056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "17421991623849671076", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7903891232234389925", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14907097142953816744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17599396373608265826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "4142978475842207311", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2721793280965260548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "12245096462203481681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "12988961529988078346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "7430073011895298582", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2842103889477438816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "17104611871050967957", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "706370730287471796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "879896719155824868", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5157249499936659040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "40704767167309552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "15494543914974994991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13489318651148001664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1760690277175249985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7000524935770116969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "17310332946322628458", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13191096881934434519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "13855438905855887272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 511) },
-            { "12478309735214802531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 567) },
-            { "2235210915304938149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9373353053843326128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "13654816209891478730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "11207257238719531888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7808544677773370430", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12134712464763856064", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "18136765667969393174", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13546876216568825877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 622) },
-            { "8434794604559592624", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14046990030104971367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "3499109651698979012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 373) },
-            { "16431165572426232677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "18251360413872841969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1062) },
-            { "1103228955716492167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "3336303478756453360", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "994489782629179836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "8207349115037232863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "10267260789603562117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "12129572274423886770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "481328129206881674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "1561225943337590599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 506) },
-            { "8100595788531468781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "4232250144427804891", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "192209423643075326", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2534408579674556441", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8203550467004532364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "5796500397424307442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "9462315044265139531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5643908654122573882", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4840004190985490064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2738256633362038820", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10118395047539851751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "792684262493086891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13131740479277027362", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "16896833230469488924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "13477416097954638887", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "12952980509662451384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "4764776977138392550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "13753473508578037346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "3012566432840424198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "14759179293743468995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "10869005786136023160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "18386376129938707290", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11327097771110264965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "8916983923551808409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "15331103261044247142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 940) },
-            { "10309504812060596568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "2490155559809645659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "13603318842632052764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 390) },
-            { "1059505639883914386", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3106710091841093202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "17802514063213000148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "7958459862276998225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "4747159205186229582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "4196367396954155354", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15897477855246170861", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1999979442136861875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 59) },
-            { "13644681270630373984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "17723621158215826108", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8501145642605270365", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6324565723045697080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "4220826666482500445", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "989564341557094953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "5927467766675317093", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "7545013298074733778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "16947969669087411530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "1107027047188366075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "4716188972902735458", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2007192658799516915", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "11772741918108731396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "17392594284473856393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12461575861709234385", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4766071144928072260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4561874206785244358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4673127824919879657", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3332334993503432420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "5893940382830835820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11198908896401597838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "6419580456182610836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "18384657372655350144", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18150429561058646714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "10917498758625273194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "2345023488044002149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15778834188130183853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 548) },
-            { "2638131332283395057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7575634241190730697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "4282661608732125403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "14100870590396726248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "6634330132674952638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "2133849627845285277", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "2653651564133701304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1098) },
-            { "13071545223094862275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "3062101811226530720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 677) },
-            { "7211355951470869591", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12644942072153919043", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "577182964135927041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "9868561386826862471", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "8479958930889587809", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "8578747191812631883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13283842370311517843", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "10900880512948479338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "949330876419581703", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "18210370419559876426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "5835634465164771899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "8671491767142900139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "1791615587935799399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "863952266514375915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "5091558853871982858", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "4885944395876887711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4239415134522959352", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17995371099806008878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "13272818502368975319", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "969746749329671447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "11243840588602365090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "16884228931101540030", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9631481972809246378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "6181272224000872375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8780604510524622314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "9819596940685093690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "9762182215179534181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "6860503758000008398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "654821507679356726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "18259656768460999562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "3880189981766119529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "12693511427898130707", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6204183474669103812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "13775529405693629438", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18419183012101393192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "17285815901490707654", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "1201692134690347847", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "5485971317082563152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "3737552767159920174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3746573775462003750", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14150012830816329527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11632275875447013409", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5824801192141531089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "5409924335138540834", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18125732229366977468", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9723314434598141024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "13835908664998757647", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "16731107540370927220", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8482147530539941792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "17829047941256922307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "11829442945690098558", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2816353973187452604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10727592780669452048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "12355112948013108181", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18118237182023167949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "2968094709908141988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "7969848911698660033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "7590767013583950613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "6345550009198921347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "15881381297320383917", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9421643783312790618", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3285520504090196295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "5334291640387922287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "3134489458855347772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "5687802882700097624", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7605139219344415117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "10548792624072794724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "5303170164698694791", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "6980201892073961793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "954796765467489259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "10892456883214928095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 943) },
-            { "15759530339367380982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "7500192998744460131", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "3755253206085028904", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3498490999014554104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "16561224775421968533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "16264774056719724826", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14912119584313592912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "13611054146745413536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1622880009460832832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "15688186132508213638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "407189201971322683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 23) },
-            { "16985912104363932350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "10499265278415026816", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8285478622349266483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 137) },
-            { "9714764457768279762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "3909551222373722085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "13379165253894817165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "14136097914489095982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "15781622938833984014", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12160764253455777655", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "941829593638869991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "8127570953237266335", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 5) },
-            { "5865480930796299143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "7072606962946873975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "287386909600391846", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "755414184406250882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "1076005730007872492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3037042229494600258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5594180958505308003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "17101789600628162503", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17303408650780384587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "5766507688771440170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 878) },
-            { "16504962609450876148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "11175955260573469979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 490) },
-            { "15595549493819416194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 106) },
-            { "2231648183489019418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "18253784177599134876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 938) },
-            { "2344498602308448450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "15197248015210313435", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12601126285773042005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "10607904718265020949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18277685132620834972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 278) },
-            { "5582896843095691256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "5782934278345953016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "6139574161497189424", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15450609897480659306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "9454954846682513038", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2305461098719675735", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4185398348055518182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "659846949368492111", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17798636687709019154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5754844816339228920", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12223993560805441284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12655099960717366198", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8132521728369930959", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4481903208484313806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "7143510787416483146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "4285475880886685878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3325727286860556323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "12136029303893296753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "15349944413643626251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "7199295899520406795", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8321769923556905957", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6090625728451718945", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "181006047500375768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "13472532612464340803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "2806529556090896246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "4801117903303888658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "9524303276541517389", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10398572248321217585", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6410682026872155392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "17163158934005653629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "17419874083634480896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "12541834857357563605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "18337160891834020517", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5585398540591396124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "1372939511728986224", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16601702334097258697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7134654288295280046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 438) },
-            { "3715177305271762194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "13358283026528078900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "17882819773586674851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17900257435531434807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11455843788148231615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "14744368497944610864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "7334966010680206302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5601435819039968726", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15891662883560480723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "2095802691829304676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "8296551195150971668", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15948383678216076358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "15430549683839591544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "2995134938466176198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "4408772370026995920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "1452597292381229708", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12788968383428254917", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9065894438656900887", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10792503079194374004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14335423820860953927", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5093049998173715787", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11771014003680394135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6656593119788274992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "10433541468308381909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16348402367953880206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9057036344533510776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14217181622713951411", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15293727142789007900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "11469881811044037340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "17422822627612865758", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "7164580481046523192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "16818714747882774917", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13268525255152984893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 940) },
-            { "3221221905804708596", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14472187692485966933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "2659031931257084418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "16469788155263456039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15447513376965243034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "12914986936318857086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "13210604117940125947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "11192356850081328892", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "8451212914744825089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 732) },
-            { "4640696923527766618", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12141300895511301068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "16611452077660879545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11622925573287101001", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4983880246908724272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 348) },
-            { "3621424752591567930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13253775441326432265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1123) },
-            { "14762599606783897222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "3448477246688526708", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11830297960718214360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "3800011935243649447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "14716719350966652036", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10848277915422577656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "11726298758004767743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "1332624116953483870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "15831600396403741571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9796621763733208035", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "6902644989079870993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "490233152678323691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "7354234812009979811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 860) },
-            { "77073286362822723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "3723613341885592267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "12353956380178079089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8995598177504756805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9270950131920019932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "5287076386757143976", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17434429579652310107", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5211191663202250117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "9849272539053219052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "14389915292223442327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 164) },
-            { "14821616804286068969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16011429608661242565", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11728824117049687850", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17025268985366223779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "17947818179123182001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "16758962840329202004", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7817036102984218692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "916389941321470163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "14729854278671832528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "10861525139715322534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "10412588668458621135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 42) },
-            { "3234107167862677811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "4239133538073498792", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7786866732196451977", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "17546566148752689536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12992194515157698316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "16509472637458153234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "13558618754911056302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "17009318615658405230", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "15984885011101717258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "5040730152867713388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7431849514656037251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "12730339458081890990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11062100629646715785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10328182165125764988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "17370051888730874220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "7460672405409009037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "8913950860101596091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "11868551452004726281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "8939683514448064461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6483208845600234755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7881579844586294503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "8650948093564284852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9519623751582710696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 439) },
-            { "10795104632256101599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "15352245788978088971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "9226443907548972870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15114370307779942381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "2543995971214089085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 622) },
-            { "15417738436777481469", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8057302050645780813", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10308175009371219583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "14681717813022425567", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10650698451740924172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "12635265188475834607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "8032685176029570383", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6205240287062600210", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2012181953284568566", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "4197617702037834389", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1091) },
-            { "380316849107383484", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6769243149577568817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "1104489643524273315", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13787436604877398090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "419783127503173016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "1450888744802985214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "5873257164958285393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "15354185859262170540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "13699740641705514374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8507854696766492454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "1071007164550012186", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "8769060267707904998", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12626014184575881530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "14221578799010900252", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14902389080201926109", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15110359240685619357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "15548971488532746290", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2322559721899919275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "2683507674615735878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11292995457386147494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "157805434489791310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "3644282167178264526", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3643250372952944907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "13026555349791486777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "580936360000782237", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "16881283637687482989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "11529876081402974396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "9058996149754556268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "18037918102910297531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "2802810524370514276", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1509728225855233852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14885109535362957947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 592) },
-            { "5078905972285278557", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5312140481706133684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "6214194654733781771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "9381304526221508530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "2704063557078535883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "14621327324047759584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "12790788016297794214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "15426960908024585800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11528417522960871233", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4342360467977736802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15094664469997373662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8790625191540101806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3362190082518348071", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "534032316469702287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "17738299860390552088", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17006095064160484022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "9631545863582097486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "12534001599784153836", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18180820925685532104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1100) },
-            { "14258499419905714808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "7852144838267007144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16894871557229780934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "5469227748156438008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "16710651492402564794", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18375125668176498051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "724953082687879224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "11901740241052104941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "8101977280003030465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "15399245700982979379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "530491406341772040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7026575758396092435", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            });
-        td.td.insert({
-            { "5197105253412476591", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16463823433924519300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "8464582977975377118", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "15129834325410878425", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "628191607060767879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 91) },
-            { "9763310312421884308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15011504472108164173", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15739274921308457528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "1033385936344875354", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11398019086259011063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "15720507574336564201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "8121179472578287280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 379) },
-            { "8787816339967963727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 997) },
-            { "15320845027635796583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2618108630886857741", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13374993751390784382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "9311802150474489673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 548) },
-            { "2150326211917340956", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11107930597263802755", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11936419502418995274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 844) },
-            { "13204120207726209723", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "17225578855755054959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "8146945902795164796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "6678796313875454849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16811402686462277562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13025323039227543550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "8797843396807284399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1890739204389692970", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "17318287523550546026", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2129726780118554358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7852745450437172519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "3603706453982734995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 553) },
-            { "578703329577922869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 190) },
-            { "10309083227104422150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 892) },
-            { "1941341635794709702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "6988674007771237080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14515066741400300669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "7606728651572102823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "12319073009094248232", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4347816192417741558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "2124033349728954551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "3159147743553063163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "11583017348580874022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1019) },
-            { "10049571207493913006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15856268902838573812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9040046051053703359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14352303529756685990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "9447458159095730492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6343396486660315308", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "386749666417295495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "4560479630843098090", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17809920600993699808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15824189967727245909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7947870656736319919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 59) },
-            { "872401732136570312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12494969618927201911", std::make_tuple("fully_connected_gpu_yxfb_ref", 1) },
-            { "6370189612027110022", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12308359047798183133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "14089893422771228191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4492673409319122180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "2194607895573544953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "13786357802945430475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1099) },
-            { "6065819201836017182", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15675968397825708285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "14823616678465136590", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3286629188347536485", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "3281207855459771997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "8402692278765063674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "14487682847898298214", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "17788367809717898285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "654122557966242717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "18128162750557822655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 851) },
-            { "17243576882981097341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "9366201112659847392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "7162575953766465459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "15890473622821659630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "1934379409955686502", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4304041922043496030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5406129421969383274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14746359019867963124", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2349007644347065353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "16749148369456398030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "14667209474639064623", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4701832665603867798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "8083672466967374860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "12408889192918919210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "2371412124305478965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10522649794540845800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "7966454753124154534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8079376692609682448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "12667014405537239093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "4237276338897143680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "3159681096461848644", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 311) },
-            { "472454322186482185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "13893789954946953427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 610) },
-            { "6714886136800883594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "11655994466278963438", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1698321314111848001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "428659495445490820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "1411786954276574458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "16295660312557315941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "4428101657497677982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 873) },
-            { "4584970211859494304", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12179581684777023804", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12949204491386872217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "13178480813522103091", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "15101680837342453931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "5644068493155655611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12553441041059632729", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5019077257951332016", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7351733901977025859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4479979951990338510", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13991205023798493715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "17108987360340581555", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "17915846724151945664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "6114147683777615071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "11530101016435264783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "14352796912241296357", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "12725647706191463348", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13608239208821071914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "6303682540621797774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "529543453251381109", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1410630713443793537", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11462462742322068863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "7546586420552408243", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "5589350202160007768", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5570311824197099845", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "14174888981602932979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5420766967862917815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "1541754036637209097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14211903923555028634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1056) },
-            { "879005904827468163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 13) },
-            { "7862815466573236157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14289048840489035546", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4862529593282936100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "7304346312452588844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "9942726414918759892", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2379484884827231127", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "3928266232090746643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "5095827462645341808", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7732899312577293959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12972634653821069685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "15471470494305051299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "7802311886554362782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "1375156980278317418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1249137685908951501", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8757900457181374694", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9226912483632588371", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3691705516240577130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "17564338309805484464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 898) },
-            { "16936366288366370882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "72444706264681262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9220830217525628783", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16705621644424684055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "15411474884532403722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "11718418772370938734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 90) },
-            { "10429613013253088132", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10110395703775498948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "7720939595094113814", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "2458592904274981909", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "6571438978296387721", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14991602704357959545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9437794960375526230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 656) },
-            { "7353563160591978243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "7457899998356343871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "7678457226823073886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 191) },
-            { "5385316497510064491", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "7757331094141318304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 969) },
-            { "5192552432194195116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4299492266819967844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "905780459938651623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "6928835003016610382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "16781127329510211966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10405183426600618231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12894240573737168362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "15277856047844308598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10136369729388564720", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12087141795291232248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "4161141078006269526", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7662200927459001757", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9269175963143039426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "6719302427415173754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "3255465741612432300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "13314092088416047551", std::make_tuple("fully_connected_gpu_yxfb_ref", 1) },
-            { "18356980026934328781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 658) },
-            { "4191326605459754690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "6522575549211855712", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "689445825453914111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16522364268583242080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "4550028191070279999", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4274801141127703532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "15609627722687211129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "14406070210216948643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "16442107352245114876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15649927926091502215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 435) },
-            { "12415368596357091523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "13649894122307008732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "18372284940315010254", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "11929531534620071758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 990) },
-            { "15975964562807570772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "17774424004510360936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "18068050257421269408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "3128856679264648666", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4160656836528944651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "5235375820995365354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "4084106758501882407", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "9475130054420979752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18310667924071639899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "5592428580503282095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "929378940515745198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4476928353532757380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "12174571114411168588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "3830703844770425343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "2632535010129224704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "12348135936862667024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "14397348576352573007", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8500148569566077929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "11806105193035393795", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1172103288112689821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "10916647716124396856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "9761573038170759563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "11856266545854830143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4967444801764057340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 985) },
-            { "2287356884312581209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5277400567128489977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "5627834277145735283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4062706195708729345", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "8329846097322076175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "15239764240622554314", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "5864250949922222051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "10090923790949378407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16402312692470500253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15901675909820977223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "5041111302824362529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "5183231560876991543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "9194788897910888066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "69439315851965666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "11455518069358829249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "14429081455612806819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "12493863403516600413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "7937870623766562191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12558716383635737426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "7575675354187625951", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16146350476627599543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "13503608041359512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14213516751025324346", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1435153323458789173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "787363431787954804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "18109284647478027063", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11970881115757095265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "11717348577195224554", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10995907213890714701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "9860570706348640782", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6574971185849732667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 304) },
-            { "3511588484597779204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "17443356777503458523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10628725059172743408", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11992625045241269569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "13663893159182636270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2418288192668085805", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4720851194954041037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "6580334406272192111", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "17739868787095417856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5795073619189010837", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9148379585489720669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 484) },
-            { "14962768577232034246", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "5077214229434392730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "13324157125165576832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "2702144517025248597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4994591211723226974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 724) },
-            { "7806129039150321333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5352861363832390974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "11070620435959083971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4217179485243909459", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12255528292506999241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "14603590053512154268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "8526484907799590618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "16431857516454692096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "13810995219720233595", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7172604084103519563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "7148542290597073512", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14011124615649605281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "15689502054035168040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "2527189070714658176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "13869716373706247686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10887835418423052188", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14767888121198814523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "12581879452540858313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "2903605246599054308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "18218631037214746168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "16173557782125372935", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3106922888635965020", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11834683513280095384", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5994204139128667921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "14251848023416168295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "13447028922679236865", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11060822686394981344", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7638626850074132214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5334190564423375247", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1434535531617424039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "17123463568694499533", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4623542918584461522", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "2370837049876630969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "2406816735581074778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7712831597869354170", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8048617952947915835", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17123153447808465303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "6780215829176686721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "649203303142950236", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 3) },
-            { "220326805056361171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "11092828091552833150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "475043738497218394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "9428176632140441528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "13327653786981478088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "8075180350084516696", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6729785110495533200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1063) },
-            { "15464327246951632247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "9759380701896779097", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6213386558868267629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12246408434917478929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "2582625260054352916", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2103882464623009432", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "11490143853656040028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13852065717057446998", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18199526506796726885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "6293403765897901528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17248756229500447131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "10978173291465325823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13104509059416300615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "2172121470071868949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15916505622570323098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9048522050692986204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "8873614802459592665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "10632020369698615114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "2198278382394812839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "1697248235682953135", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9622546530872848323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "6351347283201596793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 849) },
-            { "16094174852600023296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "2566302789609970663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 58) },
-            { "570683988452622223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "17729546848373991614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8594644182487917002", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3150231129728961455", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12159582810513550491", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2552187713769926425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3036808833459559381", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13105192484434299621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3985659568982275663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "3499243120652875549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "10058614204420018541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "17870874477143985774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "3002986032379998259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "3122997634505472500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "11649407835105973949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "142486914279119363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 188) },
-            { "5381354625969068789", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5779388310240896974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "10483664832302187567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "10947686124973711385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 435) },
-            { "13793441296561946357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "18034648276860485300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8906185843274300447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5762290464889692462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "1436052878894538927", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3752171257634205726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "16290626406346691996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "5482851829165191681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "13418701036204748812", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "435888248913413834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "14070988879848388270", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "13317417676446624018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "14385185911482960528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "12894625941923144893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "4226968857681929488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "15602863681196390535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 246) },
-            { "14810839157236175179", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7866128397931438774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "7398196853452900099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "4793007249026943006", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5519535335798045279", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "116291934148608396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "13973028408397200796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "11446745541571732900", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "13163146272900339330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "13932662890258900896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5331173521406046122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "6767159196241633301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 986) },
-            { "2452226948562393335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 54) },
-            { "13503688893307029975", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11163107409437069532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8272823732258536202", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12293786134765875615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "15284262113150488297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "3792945601873900927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "10700011669103135203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "3883845471211207871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "12813978452097969536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "1954052357826969119", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8655883535274781128", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5948701218437980356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12388375914105990324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "1383899865465106141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11324851661119942609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "10682918518101379579", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "1801731858063091191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "8195881973746570408", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10797908931694274013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "9785114056964539323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "8323445733669842657", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17517495652165026573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "6343888265369366589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 693) },
-            { "15247381586316467097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1095495157025479260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4149728557142033774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 946) },
-            { "7368916076070115064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "488298169768725160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "190530884420224257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "6848989271874647093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "3860603464276263676", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9019388470685749691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "9954050478761346921", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8337820318779061494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "3180320769716158201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 862) },
-            { "16071723603031305677", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7187734276051878356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7877332346656934022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "11661208196482963286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "14906458674793172507", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "3167336012388169649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "1532263118203058517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "3388752887767453958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12954154886708228545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16286085532892593349", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1907439276166837309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1889171157980977747", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15857087373591747006", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4894227264080887361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "16044646335477470657", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5389189982064081933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 943) },
-            { "4202645222013675478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5807196005360653656", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10001963042016663554", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3036512701943687724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "804195263636995800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14435120971846098308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 568) },
-            { "15156525717629023944", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4892959859293355837", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9404677451270692749", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12962558681443556219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "30229601562833524", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9839670675413379092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "6949539207944972855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9416186718345824095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "16706244336960642883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16710010075465723498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "1572991986657256775", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "5495776091407365966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10023279637210292010", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "14131851237755716991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3179874645565098825", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5088898934670078153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3355259926747524578", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14554225625951128811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "14959566236432790882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "994182747184593564", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "11756881293845417212", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "2030309697153345387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "3429844423226609965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18424912460022156378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "3926585856863002495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "15963038745470172423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "9069334144391048686", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17928043901784474130", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9421927854269492263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            { "7924408980408826942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "5020788604681810984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 511) },
-            { "15914512645931208899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13762042713029963144", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11919129623429545762", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4871907623235871050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "16820082917500285799", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3563614453014995411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "11825293922127550847", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1628593159980574595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "11428599290755097395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "8528750110601691390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "15696910741835640150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "14910223536998380801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "15410074937424854348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 846) },
-            { "2627779045483019709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 93) },
-            { "2265784112305305260", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9454512817077883797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "385046297070779752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "16995873636564597028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "11528310408333718862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "12394049027081208902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17026284168840448378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "15713964605078748923", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13733327241591630239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 761) },
-            });
-        td.td.insert({
-            { "10774528268153772208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "15160738482264643601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "10169992769527680821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "6620782733027313312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "10930115765550856328", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "12228963567837353733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "3727142736386026852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "3041612155708729812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11239754372812258455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "4338023436590582323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "3106591708459602370", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 564) },
-            { "12238674883388043717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "14043770215999952932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14274685812676150168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "14826791706471872785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12987636957813312667", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10416622008071151225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "10729288973933590396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3600066510593746268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "10306542963828398049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2912858944747613525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "9751582946441607796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "17224181038411430675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "5097818987523855112", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6777045876155144709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "7177837234452118325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 418) },
-            { "16327433707667075261", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7994179151788368291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            });
-        td.td.insert({
-            { "15154700439767512396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "738850098651678143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4356817283284529593", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4278280309700908015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14916625550370402883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "12107262410635772120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "4021558014531645922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "3236003754884728510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1048) },
-            { "12908594497114706897", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2057158988261512114", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4165036357594592683", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4927360358387344983", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5658664813683907476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "9562527071055150197", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2162882863309264684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "13078401519973360182", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17778091287904736965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12375919467924385618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12577421746159122264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "6288489890578212082", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10864011008000364415", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3160543867929843861", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "517997325935712670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "13830605041347009953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "5295693108687178880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8059328623525062913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9208964785762052001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "1587501521145162454", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14544219140091420262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3141886504884887200", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18142462471803295391", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4056971751486746551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "18270587701371596297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "14316077757957132678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "18417288692814472127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "8975333906619899020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16033512206711124104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7292351660229751817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "8943913562339525413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "11706446082856895571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "5572956736535433608", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15899192375330393731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "1419073145594317633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "8651641584737798174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "1778345646142852816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5941298590926032148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "2929190644951986399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8421388456873652700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2394023805427701338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "8303211644727914658", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9423854233835016530", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15069906408448814772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "13450061819089402572", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2242829490403202087", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9277176009071334860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "1843555260471832708", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13352000946213986936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "187352687850707150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7307271009495440764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "12900949103593247293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "12992061224471212714", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10930640103080573253", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "3872151366780051246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4006884370026272807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18017913952946745878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10753540518493641553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "16182470664818268848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9076758673133996959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "6726099352298108756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "2339864165283480961", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1760391741350091665", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11627532066884923848", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13183380647506951324", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13190888313721073437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12194037100109755112", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12134858519320245809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9426665763007611385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "10179916356323479080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13483175684542464385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "12118387933632797428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13853630125050609175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "11848462434662954749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "7953255701516490034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 774) },
-            { "6071668124835539929", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5649082203775427830", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10294610483561043024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "16800575429414554907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 882) },
-            { "4803370483104261655", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17649961873981897621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "15322609677356616580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "13328911884191551889", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15155676074658242659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "9378269524012289175", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15914058104244750036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "584086621952390547", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12370729327673204804", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11356842300444410831", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 659) },
-            { "7104309382120208659", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3239033622277917802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "18180655791734632264", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17635171685500922207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "12207503176295152756", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14349625788399542568", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "726985753660756762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "7870154008378361670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "4133424990380177132", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "6556424924189200804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "7706714181281908433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7995820969034996638", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "8045367391487213749", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8689206546467098603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "10404725818204494388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3216793152416217495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8791285622784082122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "7454366978268164047", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1569043950563130463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16839741351990811959", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5012013738970489338", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15289152041466330689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4447065688824381344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "4861982518177129729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "1718634913016284523", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1470933384474984858", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17515064188391421150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3463959257726925426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "6664432489777052771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "3870539490799697188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "13471752029049484143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7531346828150129063", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15065925414996398951", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1040030752340209480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "15047676717402283805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "3806131437010910920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12198263593657033426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "11939914680143672459", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "7106362077449435105", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5600807544955072308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "16924006268301179157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "13754408679115174221", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2939605281692583169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "5770286476124511234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2296581485980163665", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15133468875250992696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11031569203645035546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13809330759308309353", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4792351255949877935", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11690334177981352452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 700) },
-            { "3646228701104397128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "12776081190690731910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "1345101751956733589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "84595904778810418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "4834446692898125871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11565861421381730304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1048) },
-            { "3118602494449249177", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "16913004986170202203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16120988958246503683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "13883044928774243663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "16437124655147660375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "1018687388655376483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3501667344669686338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6407471972820516685", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "13553263424160050064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "17975017633455909321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "12026482841341343242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "11893541520830049036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "383721620126444793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14050124896329573468", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5649150695527000655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "11666250400445971335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "16577611471466452776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "49948277487706148", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17214254645087272557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "11759426200341586247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1) },
-            { "7578177053220150569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "12978370505631031751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "9175450649281374948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 106) },
-            { "12676167240795292217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4279062247055842367", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17252589865292797082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "7181154048972884375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4091702228990140696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7913076120244203725", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9407646138658641974", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1632416005093914709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "8614534946699754256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "12972798847556569913", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16694984452720336415", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "6791806088355877039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10488269059469838160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "12831123539633580270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11421180829679625737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "16925721317097534009", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12864558900883069118", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18218755616248669884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "2983038203471784211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "4678607855896512523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12977678792503377525", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8809017515482311843", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1036) },
-            { "17442105631503326136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "5385316497510064491", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "17342198739672369885", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7015738038963065110", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11657946392097042544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "18059267466971880386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "6310724136390087834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "11132679855317294753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4889188980319017094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "338716975932676215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "2226745622763268469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "7432142107544210174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "5242271874488296527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2530317332900569142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "2936333406928424760", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4129722446574108695", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16986610822918634530", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14115742296883450319", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "597650904461183283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "4461989328775275994", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12397280593466519809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "17672785701483179117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "59356084516953804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "4615708568396290002", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17705807503894740726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15746620724134970969", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6254141935545262078", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17854208422879910606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12495003066477974474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "5352061583962489055", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1218323229202187514", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7481256533438761028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "12319073009094248232", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10865695385270390803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 266) },
-            { "3711525118850629466", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7693459946348737411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "1680468564927032670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6323083153920795679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "946479876892100082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13472577372534605883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3244675355773468991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "16992405636352406660", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7689320135952025041", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18381791065890314250", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1841155673858789206", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "6942016672941874829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9440117898128288296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11324651029379152442", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12531580106484042446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "394778201589371681", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17830290099875088207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16384186388687043048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "1359720957005310113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "7843508201826629532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "5720964268093705079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "16588325081458426169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3782239800777370325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "6391201577234440562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "378801963103874857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "15817443774186015593", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12589440296742583335", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4156384238797998294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "10787747981914307179", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "2964705957088952872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "2283157145557154450", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14483314305369207554", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9695024256541464964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "3017411837779243878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15914342421266687768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1920070013712913772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "4141005390823981166", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "1186545671730357033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "15820359925623438341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "708452703070938673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "15065019229949449623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7977195117668583981", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7770000755097925765", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16729849855476690294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "9390478179772073718", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14151747022287993729", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12822126914959112382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "12802517759474139810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "9741607635826869269", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11799179287124317845", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17025324057045572535", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12990527753120735255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4046830923427667342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "7940369586324090841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2934519615045138808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "18067291256808591467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "3833510944499257797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "18035673326929466074", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2273992727647793692", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "677249604491773387", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13357365044448426880", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10090923790949378407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6142707387281700290", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10486000767830001094", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14045927407431718832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "17742192339816511494", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1152691534728260611", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6217542346826403576", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2242602888499888844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "5680236635030250712", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5159738930501638535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "4664983769199548480", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15675903059949404837", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18431306649860116380", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10894058425957901202", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15271783562528081169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7581174843529024536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "17084977396231597605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8541982562061181756", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13735180250757239202", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7375461241315602473", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9062774198518904260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8640150341228170279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10437367877444543776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9954050478761346921", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13960388312976163971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "12510951219501865365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "13804221028705631415", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1208161922424418734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "14230493618724018658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12339692995143159283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17329287216741045059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3499645386058307669", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16542318967217020315", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2421404763191415191", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8712136292276123857", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10576856554114055028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3240102173773280414", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9099720270958987421", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11277866878590984477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "17640725195881101275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3563872903821081702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8155268141318893606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13038533272699602337", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8317673282128335201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "1822096761703761792", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15031155621982459860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "9601412379897937608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "4533786844080178561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3816674884393241704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "5040095338370816349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "11857037689248685487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "16765994345605657100", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16958329690837977102", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "875400109066360897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14098811155652990436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "15363606233048272809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3220280315905987373", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "15548847099740441551", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7056293586529818253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1788455099959676873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "8857763129101380288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "12051595062513871723", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17025182465337728023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "2967481531952454828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "4135068756462147853", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9692654253261175490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "10837496380266058422", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17174919737114915467", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13025361884606488732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1920042803083729276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "2527276292172180386", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13006774775034887171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "16587061389996963349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "12071914115316550349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "17318287523550546026", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2762489653422414995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5955575949957198434", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12024817951074673335", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4865102850562917067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 478) },
-            { "16158139166784964096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "6300691162962736560", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "632116056424249698", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12522495848240087966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4754967381316623440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7565867291827884997", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17891499682354369344", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2111669705686676421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "17364712285968437405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "12700372241799686527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11083993858285515074", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "12501619443242354860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "18215430801133520364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7338229552985076723", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1458615259705605525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "12068797674575015662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "2832268621630415376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17961702508543961900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "273242667845386507", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "12015336418727455195", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5600128039063009632", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9737565171095493297", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3350601287664242323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "7005509036795164602", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16768797136991242472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "11560634267092054110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16949056117405140365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "2114599010013594942", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1230262279011217327", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2369451367723962073", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10899110544832584656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "15412447128995361859", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12259844988981080505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11120846960057008937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "9580986168276580598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3538679039078582272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "3622409603053918029", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4672441137336208890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3868149953087814447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4571404165794634411", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4974320417566990034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "12946531140050029900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13565691057064774487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "15106614232165315070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3774285301357006334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2930898141522848681", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9144487908815767824", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6114241186364821679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2878824076934639346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "4773123925616969670", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10019470094545733255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11359409533744011242", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9999425239167488495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9525535670799618110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "17724604495865223459", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "345043289576587800", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14466032674083938714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2438261005924916746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "12024143207855886580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "7322472892320910654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "5738835498104275267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "14956246091163580499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "14808895254077106198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8519354640245415816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8761283252495354972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15489746763312425915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8002233052700666718", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "7264274394359484318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "15161053469199826008", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4325081100430903742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5083163738120585821", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "17490471699618303993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "4387041763614917736", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3101087806792514129", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9043982883185435219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "18094205332383644037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "973966345068677905", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14973431782875808802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10280619408766255552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "10171373375072694210", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3571959174116404960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12727541507197887360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "10811837819834149164", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "721174714308243785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2321148334382088982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10100237101982273901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "9803492989444302959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "17889864541794448203", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6307939332939714967", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16888412539296862194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "13621339501067135142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7119182041840303390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4644580321919256401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "3568514382399560386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "1885075753696445410", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11845189428639322474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "2173720698351153121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "8690196189594920365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "4444730303823507621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1485662490111767875", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "10128390168715530898", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "18186615266760475767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "13161997040644039778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17021925795809437171", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10816637153861630723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "11727227430687227444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16293465561256937726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9119618606914671839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7840653268996892538", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12003323477818208825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "9131235538209388787", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "8921636651939679647", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "5592526760253524303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 48) },
-            { "3337625924046561031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "9835739612255048978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "7900926714874404219", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "883436333317162926", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12348602762263193288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "1318571118468536310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "15602218079503030465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6195916781434462809", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15035800097152337587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "150132162949295379", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15488340031228619748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11999246609107242706", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1914964404168211864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8398910340371320955", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7474592508575297101", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            });
-        td.td.insert({
-            { "16487774205195979355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "16027853590391209100", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13602140021189675477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "18393312550272875456", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12352923639732112511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 79) },
-            { "742689192890486807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11604794601689380990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "5754396201681434378", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11241838709529552265", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7603319690872333930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "15943141845766932879", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4933831571091731212", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3429844423226609965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11807282628372660280", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15822546325822628634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "4916769804113823482", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "10626341369865893888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6156831095718536092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "952318454591754214", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "14147460733160099960", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14578867494693499627", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3541538046227217664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5393510569127725391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "17948637243158994878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7465681710653503161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "9452470718398027950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "17344974951998490453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "14031009077471784948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10771803503544737080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "3854114166348568039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "10292349730148518173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 694) },
-            { "12757611260347801001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "17921973525603585874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10292585962794261197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "592245952014430043", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "10706267011822108376", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9809458159478958866", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "11872943152839631823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "16364494883229084045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "3266557807508325807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "15924916465272239832", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10783630257421062891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4759671642533786591", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1497560475414454618", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5374969798377773063", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "4079026972040047969", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9947449295659685973", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13710319251108632115", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4914435717288687793", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12309955719964788034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "15078168059698267650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "16117448559783537844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "14614844213016502202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "11031358859656806724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "16386955278777720573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "18302892230881285207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12514693341682532560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "9120377367517042357", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6318228858846223186", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9372916528346260712", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16425665058951535484", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "6911215749850066204", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "9942099207256025216", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14447191095937730964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "5568753513029409478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "9714508918051740792", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17370158297470557151", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17711453305763476458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "7880845322716481548", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4264284648458489052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "8540111719936129376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "11007944497812650617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9406763539724266157", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4290840152278060614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8787438180071123604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1704404203639481753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2008424849669196225", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10471519687597963116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15690161340392005765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "13488495920546871271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 851) },
-            { "959260710517842876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15078590909693331731", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10425889533411573166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6928136130626403937", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3141773224039276177", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12494969618927201911", std::make_tuple("fully_connected_gpu_yxfb_ref", 0) },
-            { "15117880293418979489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "6964383468476265892", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16409729623371222748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "7969441643457570812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "938222258370511187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "5922142661777925178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12712071520541638451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "994842991399671507", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17806712457019493207", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "10730222715353420212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "5321698540631249776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "1596353239542510685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "4124478505694604763", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3398322619007806698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "4429109491655891299", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6297802534570892679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "11265472910579659280", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15678385128478075284", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5538883245745495145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "8860443174052454332", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13575423234109624706", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "9533360488591027707", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "15809639778580769565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3374410641320310726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "2920840796593281126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16065744898134487748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "3409043224171087168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "14114380593731243715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1038) },
-            { "1418595171949196661", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15187035463799513424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12480527132372884168", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "9152433123828445089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1202292109713947702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16772854836230971016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 674) },
-            { "13646974121952099172", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14424566003632608852", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1905758333157310570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "15048584393463312977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "18132952464279667664", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "60267878504897170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "8236018377815149638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "863057075064640334", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "9305861997313663528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13820498543284008286", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1351033666248868977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "1867337342417952506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "1497127399271219422", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "11942736969933408358", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18184621367843960190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4734389463002799056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6733731409232284409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "5911282942658469852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3017891343734146267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "13092232276822302626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "14123081378489325832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "3154539627593235077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "12801481303602178879", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "579781312141502576", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5214654427283761256", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12625112690264223217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9441060601228656341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7548031489690889629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "14159596290442764023", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3070859615622845671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "14054116974002669018", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "14487842225000203929", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17585206779958265260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "4819131094439732065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "331661172067077796", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11988546375476924356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "5195511638783481084", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "7692849839965441330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "15859493313686060349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "15726902746983125797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "7274179284676568361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "15493488989417521388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "1008476023750261156", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10923480230259977438", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13425251102263428554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "18103534417093702556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "8036474422877454869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7208008921815475393", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9616636708366808604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1040650352205493707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "18135307303959376082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14082448162400225052", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11800783548769329949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10308431308942416781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "8251544171504007740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12177387334053203378", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2321767794934000238", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "13144385730409574259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "11756650366229979428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6931953332823066530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "13124342334495538095", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8444259010311137762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "7397341452130124383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "13815395589135469450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5840254078917931433", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15799159401545270696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4435224497850514394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17636500109629107732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "15961487889420208188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "15530407024531326375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "16770615142634470903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "9101903304994333336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "18275601715050791851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "787203599734115483", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "6856130385095139346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "16767392067294252396", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4903592553439092472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "13369603621524676979", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9468684953949274635", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16698547937652264447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "4118073384938355655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "5308128387928804050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11055049031355432623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10682300249493137042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "13781423818051299677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "17224104246148265328", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3308770992373192529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "7650375560336513366", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "8543619733732987550", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15223164574152266895", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9195732599757736182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "9056038338958199256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16667887002111125871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16717713360264747483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13738760763969959522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9205978149692979955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14362876471450307424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7868973874302246233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "142329025839464842", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12253049204822930675", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5349415632630235233", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2727175120437582536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "631489011812924153", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14331658870024759698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "10808909442136736629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "16081386644309102158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5044721291675005144", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15914107501176673997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "9314293064351558241", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9299299311101549958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "142270860894725256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "13483088320871913126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3699344686791530101", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9767294641786972359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4104562704039821482", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2204178900998688268", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13833960927635646899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1082586642383386489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "73865742350616903", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11451740938287179908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "13893808009363736870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5364060938737428149", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "8532217744217419503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "1982176363226079588", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12641170321047008726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7669403041163460089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "13734043898517059207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6817494598328071314", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13800760323805415740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7585184325339753737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "9243949750444156746", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9545968464906009869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16748662918272106932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11828175723996627443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "1390379098099686972", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5339985303398206057", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "669771152920944125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6673966852801136416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "70580716590540876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9429695343610239088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "15201438563802430490", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "9488453013746383896", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "314054598858070952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6203765709597125063", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7060804814325505165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2581414750854621875", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16882092367103683293", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16911464046178654033", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16341722570340169855", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17791024851737594885", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4190912926126844643", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17037416417174266088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4880150897829846031", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3976736548270395981", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "7235358742317442134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "3105425187506203551", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9111988592015450418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "3806761527342944195", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8490260671996115530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "14122213471825630433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11305232900158601613", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6603778920476932267", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11640225461345567929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "9480653639044390919", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7349880498513046830", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17037462814585846902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "13011676362747785816", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16566214123371867456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10218763091060511457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "1074748462756364699", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "11418379777288974452", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2783577080556699089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8913823292181409151", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "16075006181495932250", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13468081302022888489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "12473600360154597915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "2920322372993101148", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8922929126299811091", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15814015810740458605", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9869959062341950047", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2294800960010879540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "13485300684443803732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 985) },
-            { "15991460001131903561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6648876837655776653", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17281826959243966826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "135072053401934228", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2477849395789783501", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17109520309574369561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10128120599276549920", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8431759922045602848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10751536136794650334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14502856487639608696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4959403414256988744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "6423785822515265784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "826850797666395121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8700574100180128776", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12068974703657294908", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1122856374602590533", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13308187548669026714", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15192230303376521834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 846) },
-            { "11955992313739654625", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "15188570678726970998", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4718716595177056289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "2728938624042183713", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15190508870639648203", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6398819277350155011", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "8170998059688907013", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17377315194963069204", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "7974670633697926450", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6193161166790398003", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15773157615731010456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4772696293208603817", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9423958333298993923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "15829095120243431195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "856877003890134554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "778476198101178556", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11130439225010714550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "9794456440994218671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 264) },
-            { "1563987925712579649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15178921033274918199", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10879218241103462088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "852015206582470545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "3779229442395464456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16393176054374397767", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9193880745263317167", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4436244774193918646", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "16789245987103323406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12076058470574246054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "8505040075968411726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18122858611264877646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7715649642603303319", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4138968242532400395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9939234037869927090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "6104380778870471127", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9383182168277796969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "6584960721513702502", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12947341728489226671", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10130171279527667782", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10861769381993948050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17726079670612220433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10785966734346479177", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "18416908414174464784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "10316451248440741901", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2817919813339364130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13330734840729670622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17216583849049249733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "17907223570737272640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 383) },
-            { "9530116228032101908", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3603187029740446600", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5758133252959371492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "875296362957469305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "537074122417021898", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3202085450628781999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "15231987838322151865", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6988492019664525206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "7107677063657303327", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18221867262301937903", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5269172622193124300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "2921118493468368908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3501882025888946886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "8792010676469476740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15879172437519876393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7171904645566467208", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16522364268583242080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "11669828823444745889", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "16293101831324587788", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12868739680413736657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "3221469860582147955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16395067736440127496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1251525426317284548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "5941092474669713339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "4465701487417893814", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7800015766976654402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1752185056297124917", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "13486084204140096478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9502195532658935521", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14680730265621679042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 758) },
-            { "11198301748997371475", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7393601059996816014", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16610284927818475574", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3573490922300056520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "16944335478353845609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "6548949901446632697", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13856271274572142709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13526488884846845330", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16616945998593626851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4403753181729432604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "3820661057776133570", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14985236276429954162", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8096131027165540886", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9232653317479846765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "5042176052323856983", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5303970743736042689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1984152634309440563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6577505360421510286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "14025235562200209723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "10722782762733112118", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3116068331849795558", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "60509335250891515", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14389719202147508599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "10170577772376890221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "11020315012951440351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "8767817856303586064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "17219920118109316867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "10893432143734884603", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4353842547963164546", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10090036431487700311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "9328223957245552723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "2173867324489962689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2912098199463107173", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7232326270078161768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "14805540705424073865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13590444711975157776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "543472136359161929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1044978617045366709", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "11337525286386930242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "5440983284868981549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10724501418439612080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14795618530175274538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "8792202318168046223", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4056979460327024961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "3477539135137665170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "938848188161536107", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "4455369117448405874", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16871004845988227014", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18235209540858013173", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6428098122005804378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "11834361584875491425", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "7082007579524697455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "3522383297921565178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "10135458965276110244", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10544034939133448916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5291011077679733990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7056030150365552588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "16235115911229280717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "14026537760442360645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "101401523793806394", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14204609663091442879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "13902214851539825156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16361932270527364507", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10055549084854766170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "10151922632636937118", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9891428775774615719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "14206076551739831333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "818998169319147148", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5582450255753679095", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16139615240471264488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "15003778740401601065", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17039993918927377002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 429) },
-            { "2362092095402043749", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10991423760161409883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "3860667078458481972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4849343880559509889", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14668725050395069435", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "4523064418696274869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "15728009639807698634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "2968439898708528834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "6713985030102340818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7369903937189508744", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "6509758095668864050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8859895010324601937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "12782932626966309185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "13839116996827687373", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1287490919205560806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "528295119724008711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "15209909241815414156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 552) },
-            { "8561261337239934159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "7585785802379042424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4848143712599565301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "8270591002934311024", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12995903177757437362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "5963901433137582265", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7602222004475424358", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4228437925117070319", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2856601829807186494", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16000753982895054944", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16934879647229234163", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11724225282274130518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "4238885454989272754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "14999920879568237166", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            });
-        td.td.insert({
-            { "6334639534663495263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "6863331059471727622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "13448845356783404653", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12946540633035976364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "17764033613416389758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1192279884248226739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "10883992248631603006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "15959543980008442942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "3873183249402084406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13809898858049445969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "13434576226708227155", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "14885031472057965707", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "216603198215625772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "7532088618116521936", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11666226259183201584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7075659071934895087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "15757308772667178999", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17053671692908867872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7649413902932043811", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12421204749289937399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "2041212737963974230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3950738240651133849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "9999553425206328238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17515847111676784130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "8130920994920685157", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7755177205197405275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "17228810554159747400", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3503893875515897267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "2294318010381635693", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6843617687528352801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4856470441452830056", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15968821946892330559", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "11450378244355788918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "13145474177271090694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15967614281807823696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13474805373264874144", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7372956570616880244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "15839295895890205274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "2373860353284525265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "17917978116807564183", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1902656726461670148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "13512863534076172940", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11164519756679631743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1551596771935253711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2066731703492755469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "3190494353583341446", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7243917162812988891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16574710115918192418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "11147573971701279689", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "4491380839102267034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6651389480007764007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "13296242326766100583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "16084700435355748612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "2866656294663853474", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10308113903347312964", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1711220333751274603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "6484375582324852109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "14001406016806064079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "6101196122606108273", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7314288062932060863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "15112599407339712681", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12489973984967168447", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12790570304622911607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "7875724726741958520", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "1353170363915443814", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "745009493367761775", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3499106702307464480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "3056212889689424946", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13251091004269229867", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4362304842016958728", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17823133607491820214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16911450336605071390", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1520529227443340435", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9500850790449116723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "15428591250165788477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "15727611564408173858", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9671459469252116568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "17011363406405852347", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6669808855737023569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "182115051096556835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "6328802691680458752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12590922530749026871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "17512961503976896701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "4804533178560338520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "8108933468437926367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10187930930336324253", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "16988275131627316108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "3399406641489305996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "9918371346247634545", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10486348549691280032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "348058686961206025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "18427056032084727710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "3316798708399098230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "760687670112194844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "5003718302026277632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "9702618600245321109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "8803037667261582905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11931568365395665142", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1120455113299469776", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "10765280349477640969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3286330985102373533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "4815047491742617397", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16247399911710810038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2863465257341735941", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8527193566719173253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5074273865983613482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "1930929857644673460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7624476043779763605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "2814805887448339818", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "226601879759378771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "998876398773540321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5926747396493954633", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13454265023861566476", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5008350851224686853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "1425953627379976115", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17634966178519099371", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9485825829394109934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15486917753097743853", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15739278428190392018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "10480527638577674825", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "467975197394411990", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3438296636411972401", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1045854873741563331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17408275657360833363", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10709828018763273371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12794369485239257709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17147293671640396193", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "10546430708947911124", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7878605163588288309", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 89) },
-            { "10512507780534402341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "3814584042139408454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "16723478941106779069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "12391792381149655331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13954821927253849036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "490931535580183607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14835309921389262864", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14343008518525689150", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14289082888174784976", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13247725847475539658", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16238415425814188039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "6294240435687565243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "3534971503826416049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "2613462626256090659", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "5648658688155716974", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8984436655107983227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "2777318471329665162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7799984350284425885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "4635570915184713874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4531222427159927606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1644335606100150388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "621915374938805401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "17015328096102652908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7780140599533242850", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15800447082078291243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 665) },
-            { "12467673564660108244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "7201521533301617290", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10509933181132310969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3391032227732782982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "17908444616754154471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5898740235388207878", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4466647043226271996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "13938466156916423478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "9340159617983543624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11499219760597131534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "15529757761327002288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "12932635875905153141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "15109847707903824859", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17525564757769958678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "10883341041912056319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "1245259979364728404", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7869779894480025247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14034525799882831106", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12564687330941036772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "9728611486592854529", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5118467701668427545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "9987415314864002460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "13585163747565192884", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3385797925880519845", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14985755375924972050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "3106922888635965020", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14126906427006602775", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4914474312076193952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8203171222962341018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12871555773123368130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "7407975398526425554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "16511749893955141055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "739676584505475609", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5498839261395459224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2567046336192437734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "7139714914586273766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "10014448860206587805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17951403431757222177", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "10330180429524641331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15586047342916704364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "2770397466252831892", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "11795826875463204296", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14540578324750869319", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15989894214714907271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "474139120607442270", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15589007878875898942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "2826762745628486040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "7132328255408635227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "3441335188113424896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "11806402239500046867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "8439950151963452285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10432365444137108781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "13121297281694293907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "7708321360699824256", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13477548641580029772", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13961773444580398856", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10178145641713631806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "8463615810239412362", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1270307036687208396", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14813178380338948912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "16567638487719493784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 609) },
-            { "18357544235608006954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "17444003685761357480", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "586947787345351152", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7683334381958571864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "15193403354218116460", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8931169575495985034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12166852830214895457", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8907982643256296667", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9920155432685318259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "12279771749366327372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "6997971129340865650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "2116913943188857359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "14248239982355212178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "12937333118472722002", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3224352307778512793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4378422094110940766", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2649192407401044065", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12864204111424196179", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13760645810144930270", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16681690088928624738", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2149582237161177965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "16677044352793659175", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4708035980731751007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "2715447739580688669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "15235409162483701027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "6557428245898292304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13364676690016875118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "5056859994174498686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5834245904292669645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "12165079289914715018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "9955939178447682108", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11705756153433897198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12806934028210472719", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10681768474583067517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "597073780328219388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11104393974242049153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "13609660900720370993", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16432425079146486467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "12004552919019936392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "4084026445911476156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "5657471280535146301", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13754540732991287617", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "11744368351982723504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2668729552208169959", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15838113905712517735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "16666792471632326054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10387844339156517393", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2984726467649419856", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14799579913711096584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3515437649977762166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2188101366183302888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17092525789052598917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "3725013268198063198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10544411879329675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 765) },
-            { "3635446784873718932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15052577143485630617", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "87031578643428011", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14616969385577243225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "9280431727790048190", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9277610800970567810", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16105073808368936420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4121109463284708890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "15796677813117622429", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18436249934780056991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5965451243366505522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1170380397764345558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "15805087418686802636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "12058759356433220258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "693883892843558363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "6800893510381991731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "8747430148550634190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13170441257780067955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17207560805775399864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9584652777232392944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "13338594271376045657", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10128143628088846123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "13403161389559730", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7223801044761006523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8837721075413149240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12741457056869452536", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1900375942069325499", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8609939102588915855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "10914921540144371519", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7242013296950669829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "403634422724914329", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "16781187505186394353", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12725675221990905186", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15555083739490354527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11110173861174257158", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7330202944390548890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "951747146164097188", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16728762255357411770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "18253784177599134876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 562) },
-            { "6845814820599174031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "15225354446874994535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "15295951849706930711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "4450409744922989123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "5184121466994451498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12055647521556218046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "3863816884636503247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10415046594066474634", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2609454334520044465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "12065769091972094756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "16441830491664937048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "1126499865206906037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "743941460026466526", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "10722677916294015259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15249442550355454201", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5740745357953479527", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13993548620104010490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "138379779469699309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9657324846330221372", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5497751772699578150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10071449674652717890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12936220888307335332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "11910735867274493498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "2439993891369206440", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13302687772426736346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "14283458015244508428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "3011188207492335920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14764715930784496165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6650607472019166205", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17647962002015093887", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17381516856910544374", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "11988285441493553006", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4897448054295474302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15059549186302099880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "11158789938857558596", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18008552719153887303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "11330591026581463934", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7916244303189113815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4890043345392707202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "9813748068195103720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "17746215841755337461", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "438528596970898721", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9131183544020825260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12229574562535756991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11975047184326016230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15677717057398875599", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12512751736409465214", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "708747442142592697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2161052921317193579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8409488188696700816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9700808806849459216", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14263790627243107300", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3383222668132648804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "2575631797904040925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "6143200133853000387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "11872464450773754851", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "16436006771518788093", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "9101334153142718004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5145853681977610916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "10570285542015420072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "15216108478837665623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "5374664689223295796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "768720470104458759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "4850497746076450913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11025471731438443683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 47) },
-            { "3212789693085089063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "9250410390663336388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5509395737020858006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "731825454731954517", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7700321970687976931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "5853697372844744672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "11936530628363072904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13264617841270329349", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13676654389512816868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4398371999113956082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "603883331897298932", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "991586070509079617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14532519639619315651", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4513063773753763458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 198) },
-            { "16773645387243701837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "13320675959188615441", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15980348884716629349", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11583985978586657985", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "13094402291968806996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "8040001390872143271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1075027491444288875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "12028665820838352309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1997392406402548974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "6020017927557041768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9731370183088819573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "12213354854947437262", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11604111639041106489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "3341302541468955849", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5550969016335082071", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1591199515536783245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "3177304125602972370", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "9795194069954915563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9999955037598579164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "6870942166356599956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "14116800584981026541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "13912843078550000960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "11637325834858582585", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16683169947375504066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "5245526691775741296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18267428053198215471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "14171139920084409181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3780320160034246719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "4717620775314557374", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6222595759158615206", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14398854364550406668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "3662747857062156477", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11820789223587555410", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4980217316169616839", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14079654309452583394", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6708349666663292171", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "12193395770362986433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "14757749560543979231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "6403698142681887543", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16347412180100581330", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4628748977913534701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "9316082753126682958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17170858505976681742", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7818381040882768404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "7121708962074176240", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2722124265986526212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "3788462090984291082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "2683304757433993300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7469127846325904854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "16135569134646688251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "905526102343710614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "4098191685457418125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "11690533591656807605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "712165731154577189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "3226193790517362610", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14403132596827435096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "8655315308767111198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6340128090694375876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16014822406751503249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "16218339663410630711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10256831975351722184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10133054058562198093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12417253210787537988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "3336076058264596420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12181889163404078773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "6109013751635776331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11862259122805366807", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "18299254635579957284", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1963081583851864291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16566128345135114558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "10645625090439446714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18082422341304348326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "1212319037405620223", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9589942627115344216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "12755692101476964677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5156033406916344703", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5479761740065152589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "12054200116003751590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "7333511810266504718", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "4400247897123856252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "17010172246526353957", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7603872175048237237", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13478984039708550410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "14117801387057507639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "17983556812075120553", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10532183096485321729", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16567486018945740036", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "970768445746568749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "16292848987976256449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "14421898375873029115", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8069537351442302814", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 266) },
-            { "10447947790216991304", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7667898603371717971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "18121198117765854866", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "7209217811135076623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6712698149192186833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11334122788337402526", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "16910952799476896905", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "4492332228252010118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "7183578232279711009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "17238880534517721334", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "11263540528012919947", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5115007207028125638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9153779186876518773", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18126685473408206840", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "17209528805596238905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4252157815622916471", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13814086981499638596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "17536308070854915513", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16579057939215877904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "5735608687257018419", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "3737576893817599311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "16531824466148265247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            });
-        td.td.insert({
-            { "15643135666029727865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14558572801374416278", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8642107585829380438", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15082818876354718849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "12675840135830047968", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "851057218719456209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "17179609670678746034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16661843849495077745", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "5459463503840817402", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5682190700442712936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "4958835037528182801", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1875764913306932583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "10912495395422146386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "17310409067211414565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "2780423409483867058", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17759505449240263390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "12866217660635921034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11645116728396933125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1089944493540593798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1092) },
-            { "7650862961269327235", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12353956380178079089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13776178598632392721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "8866716292621164810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "10782611933832492335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "17770104464900126615", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14912119584313592912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "937159502066696999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "5124080536266387783", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8746621720912032145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "14091610802555875119", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17922279129043570176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "7084646429975006971", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12031180482028822765", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2891736961665476908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "1643122514049603104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "2221145174704245189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7964396197946740183", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 904) },
-            { "11315238071192463859", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3673781117412048086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "16152775342222431281", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "5751283221740229986", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8615481457481938667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 803) },
-            { "8619526128410675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5762878778443755104", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "14444475853714164129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "840202264034382558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "775538461106687677", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "8257103926661643451", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15386715291503303766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "5941852872160795604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11308583200952256245", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13970935346154374605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "10016815108730511683", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9585113116232600562", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14811603003184578943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9541630719145326121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "7113777272518482528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "5429130923188159806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "3114869763557037270", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "577844026691991089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2524029454785583409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "13558656230312558247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "6084775920382972735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "11239541755868028928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "9090828337597312855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3219408878901707426", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6003409324516527726", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17549411807772646930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "11069983292783104310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "10635659193402005820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "12151068022697708126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14896875712028630045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "2089730611490367290", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5940337324384948573", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15695415285791951018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10979362792894404338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18426893729833771809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1354647381212852890", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7958443549125799229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "1237262535285717993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "9222744127882324405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "4346591404756288097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1173986078589662704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "2114232149447438823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8159303545761286685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4216958486055161753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9319254979377483709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17046662043776372746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "15528692642731712121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "15924583510704449214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17446505012657609153", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16362857896338778056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "10565371760124443824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "11948858355027908365", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4622514167765722873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "794499287296495726", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4773077837537775324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "16986358655784856534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 724) },
-            { "18313088176414428990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "1336940384521633733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "8794896449397768269", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8856888761246057127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "9643408025778914022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "4126895998426674411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "8567667881970262923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "1398177377739338750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "2608363732937932266", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17651821953342321913", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5714365398623475983", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6362428985273506890", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15979956159651515122", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18255227391100087860", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11587239927319376658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "10141927023849730720", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13835908664998757647", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "733956743303342862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "9737833587413114584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17152614235879767116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "14930789530046665855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "2625969259447793593", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5539793555189956907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "1309867416606346543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "1367483816197881270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9477562342190423343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11087413527078604815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16243196137456624852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "142650579335909103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "503369896500284129", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7561096442572829049", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2877521658768725103", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4769003637955328938", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7604075520418038662", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6131481289104111211", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8220168481755031959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "17704040183891532914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "16862145184923128012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "10022487076451608714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "6290584630172122012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "15078262396281327048", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15636128989267984459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "15770767768674603174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "17490188677223978661", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12917241193304093727", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17489680436564779197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15329680728165965773", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5060012838564094182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "1171681987783013074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "17906607354577138153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "17477062954520561609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "11823205954749139338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13851240591038949807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4137755981477177003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "8497468192424557348", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14184895905338394239", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1237920404306733800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12046017161414846599", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10106454449619141260", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9641089659148164809", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6450532136308941035", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "11626398907755088688", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10747988576436391912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "3988024997010367546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "16921939234324970069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "15901724303713479611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "10037086825900566930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "8951040603784899163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "6727930402459775131", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1952863937205473292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13919204232414535363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "4809191606466167229", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1518270620354036926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "6664482192233202590", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3759515057574218101", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13558687084677943158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "12985942652866621579", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "2781309272856442321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9726913113016874092", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15497797842820949408", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14412158605670555579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 153) },
-            { "548663565933738403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "14883438809987378616", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17201365233492366678", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5211831143687501130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "13282951481330978659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "9091110033424983286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12604104383683210104", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17264608538692763688", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6788311046557489996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "16267682394077585279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 754) },
-            { "13569941893504840630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1124) },
-            { "5039037192630609823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1082574490068006980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "2598267743388306204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "3819990462129075757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "18041177945345031826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "12351866693978844266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "9967101735808367971", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17264010982688979937", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13104509059416300615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "14671212883301405408", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14571022040013651253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3039528482572243879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "8458082326743351141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "2128612971571865547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "290134020607738418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7846384623429362522", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2929715823970060874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "16475247464223458061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3265415000818832667", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15779837958180258409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "10672380526821947133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "1299545313185409227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "11597391933877736800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6219075471508685758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9542325095876448686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13596876807637507229", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3216877571075556066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "5558136691773431495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "13611054146745413536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8354579049246302728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "8576733135863336233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16490405739040977260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "12450814729547235386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "2800949804770763798", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3217574161785059951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "5581428998642936688", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7450417963648518926", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9748307611165615848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1972879521448306536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "14387756025635589673", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16027456210394993913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "12566041126392848976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "14458851250685872417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "6192955702438301372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "7447163906170805189", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3106911159524421371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "13680926356824317761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "9040145293899470160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14312549767853703411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "11768117585574496387", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14766477690417085350", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15006321421735686121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18154019240019929225", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3034482898462686729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "11841034668170849494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "10536316961655703500", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4617809377006148936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "16397733032387984819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "9439431829175743345", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4625107584562815965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "12052207771201936228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1626430741965136732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "8106738346643994005", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12393385058735194260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3024402899381804809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10702465758376061967", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2554991397391195611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11634932044447867039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "487214150851213303", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1157947252370351851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5010119207726811326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "11626402549863483301", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7954972694876158422", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12228610148087508521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "671453551040072499", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4313392430539923574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "5240706676373148280", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3372770576629463160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "16307464696265537356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "805131056816361237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "5346898505346646714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "3017824560305532066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "85050336704401597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4282668574670785584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10572945270796129630", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "6312971928547466668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "1617135706549276688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "16511393582666965704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "3509487327001107638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "541817615957967731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "4750513665628842598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "15578456771467281881", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2495655464941634884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "9606639214735570069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            });
-    }
-}
\ No newline at end of file
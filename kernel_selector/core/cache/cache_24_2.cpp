@@ -1,4083 +0,0 @@
-/*
-// Copyright (c) 2018 Intel Corporation
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-//
-//      http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-*/
-
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
-{
-    //gt2 b32 b64
-    void tuning_cache_24_2(tuning_data& td)
-    {
-        
-        td.td.insert({
-            { "13851025202247070979", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13781423818051299677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "11604794601689380990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "4531222427159927606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12590922530749026871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "18381791065890314250", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4282668574670785584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18161786710055240343", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6832967250168141428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11705756153433897198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10544034939133448916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "994842991399671507", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9657324846330221372", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10480527638577674825", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11679235499894668689", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12617736879671137111", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16768797136991242472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "5738835498104275267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "14916625550370402883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4723919313760470311", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16105073808368936420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17906607354577138153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "8686733586982652897", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17436550598696178210", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "348058686961206025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "18393312550272875456", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9328585005923667676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "12469992822259989528", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17397600088595751782", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17085927772068621152", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12024143207855886580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "1281190653081960886", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15548854462657362014", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "10751536136794650334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16432425079146486467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "775538461106687677", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "4815047491742617397", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16711142379173254655", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12703696322769371912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "13830605041347009953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "11690334177981352452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 700) },
-            { "15646081020506130125", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11055049031355432623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1208161922424418734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "17408275657360833363", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10151922632636937118", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6193161166790398003", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5754396201681434378", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6776601719651959634", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "760687670112194844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "18333355024265557430", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17921973525603585874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11828175723996627443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "3217574161785059951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12351866693978844266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "3536359641225772698", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15363606233048272809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6859143702528475520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "8458082326743351141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "3477539135137665170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "12546446257192651407", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4856470441452830056", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1425953627379976115", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12913866095318048752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3582256192870592087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "8585205898894363799", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16270745071180354612", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4916769804113823482", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "6962062962411903140", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4492332228252010118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "10005348255972308430", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9974905660671605427", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17344974951998490453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "8250212706222997384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "3541538046227217664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6438721407426283362", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18433141005552346566", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "215512025430490450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "5977875644245993099", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7602222004475424358", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4780291919667721265", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15135644084742750702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16214394186337220006", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15488340031228619748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "403634422724914329", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "3463959257726925426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "18416908414174464784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "5727758374304309350", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9832505855130134649", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15690161340392005765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "4734389463002799056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "7949069388917479511", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8974851555526896131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "14307705501349750896", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15871357525719630224", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9674248159643501374", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11807282628372660280", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4056979460327024961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "3731224822876468602", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "11893541520830049036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "1843555260471832708", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13009381943944182288", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17908444616754154471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "3648713169465596196", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3779229442395464456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7561096442572829049", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9891428775774615719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "4261192887643002603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "17045386022302353268", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2290965424106255219", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11537166370263116277", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "6418500550523945192", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "577844026691991089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11087413527078604815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8450272092307894299", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5802466130040230797", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6950586691727980329", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6445721440921372329", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16901594465545439334", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "18033349045324117723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "13851240591038949807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10996596479775375564", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "15188273255634848057", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1135062632388082485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "142329025839464842", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4863644213728386734", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5941298590926032148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "13426254939418471242", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7132328255408635227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "6208201398783088425", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16362857896338778056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "16385915289511951113", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9532499374173117612", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "10816637153861630723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "11857037689248685487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "15989894214714907271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9899211365930959346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "402932154499003993", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7393551951402219833", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3814584042139408454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13954821927253849036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "14242202444788213591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "5155616842071169667", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13810735868750326592", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 925) },
-            { "4021045600853993587", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12397280593466519809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 340) },
-            { "9101334153142718004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "417352773179383568", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4137738705782981426", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6726099352298108756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "14263605862840500474", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10387844339156517393", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5680236635030250712", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1841155673858789206", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "6403698142681887543", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11787674847611032323", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18239740525818575112", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9999955037598579164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "13170441257780067955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "17536591931934691648", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17051718450741106678", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10681768474583067517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "18215430801133520364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1786105567361070086", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14044732537191084187", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14165325329016075285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "7897973318803646560", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6097086855988597139", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3713558537660711857", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5355283113999405036", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2457671437276780303", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7822463130304602936", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13111122805945249561", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5938850739683493929", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2835909063063272102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "4261215727469154244", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8096131027165540886", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6490907666077364481", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16161974964662774501", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6772954924703365345", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11921652085115182024", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6788311046557489996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "9737565171095493297", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15059549186302099880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "1920070013712913772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "7338932272767555117", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17152614235879767116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "3212789693085089063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "5668538167635622474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "8857763129101380288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9099056013518879466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "8459380583159325597", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3220280315905987373", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "14771341796915983228", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "1520529227443340435", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3106911159524421371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "4574541202890196191", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9603926867418680768", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12864558900883069118", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11241838709529552265", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15799159401545270696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4142555169083069413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11152334947349565403", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9835739612255048978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "3358616456137155015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5922142661777925178", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10278515360013727367", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7571716782558859443", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7540655869186258692", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6115915509370042166", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "12676167240795292217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13575423234109624706", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "16015963261509760799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "4436244774193918646", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "1237262535285717993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "7894230717547658326", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12933785392937626017", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13247725847475539658", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "712495040970043706", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11719957578496407410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "6538526180355194359", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15295951849706930711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "6427979320488981912", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12721294268595880422", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16293465561256937726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3806806400778685133", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11104393974242049153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7532088618116521936", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10570285542015420072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "14528180674573671874", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6344600111737335616", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6331794802915121861", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5600128039063009632", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16158139166784964096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8879618489623984140", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3216793152416217495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14263790627243107300", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "467975197394411990", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18186615266760475767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "4252157815622916471", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17676344219475515993", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2283020548041814543", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8203171222962341018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8004244584949995244", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7027962921778599989", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2727175120437582536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9195732599757736182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "6712698149192186833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14288463473159113326", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10762489947656697207", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15956352026642286295", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15678385128478075284", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9787359208094141129", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "12370729327673204804", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7977195117668583981", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9378269524012289175", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14206076551739831333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16996895381161031110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "15412447128995361859", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4466647043226271996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "888110783182849535", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8527193566719173253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11806402239500046867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "12977678792503377525", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5519781859090160931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1033) },
-            { "5317076157086789437", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "18249888571553409563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17549411807772646930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5584145249514762750", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17975017633455909321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "6703148006012061136", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10463632805036507382", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2608363732937932266", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4039483032571506874", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "671453551040072499", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9401409770128851474", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13912728810446567016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "15449774545834423274", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "12051595062513871723", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16455941573984854254", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6469277112054008613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "7624476043779763605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "10706267011822108376", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2907572047024872990", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8700574100180128776", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16531824466148265247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            { "5224252360611200472", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5042176052323856983", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6862489207967519978", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5149303626508247520", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17082268616134506581", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5242271874488296527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8463615810239412362", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12566041126392848976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "3217674729821898463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "17546090415334871175", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "937159502066696999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9375272277044782377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "17891499682354369344", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5257134257307295031", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15817443774186015593", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9293682866734263821", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5735608687257018419", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "9105127035114339269", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17037416417174266088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2915777749501772828", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3286250915720444467", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6557428245898292304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "5041922366297242362", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17489680436564779197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15199604820473713622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "5955575949957198434", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "998876398773540321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9869959062341950047", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6400660469217490279", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6902485831441844789", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6156831095718536092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "10706180189726741161", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17996535939348094624", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17945600479510493949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 108) },
-            { "12015336418727455195", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15190508870639648203", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6713985030102340818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "16573597215928075233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "378292944207609677", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14807466024030301968", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16800575429414554907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 882) },
-            { "6820224292713065232", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17025324057045572535", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2973337989445169388", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2135164671985938807", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6822432085522584060", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8469874583725132145", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "1930929857644673460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "4429109491655891299", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15971340431600153619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13993548620104010490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13077012961563218195", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12259611546528256409", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3154539627593235077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "10883992248631603006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "13680926356824317761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "9987415314864002460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "7719954202744123391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "5079381702867378605", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10528894716283673051", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12052207771201936228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18120079746729314878", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13705072264927031658", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12450814729547235386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "8865700182878875593", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5104519293341299859", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4672441137336208890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11910735867274493498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "8860443174052454332", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "740260423018155343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "3346891393420268502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "3935750066315595083", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14149210193687890597", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17965267346493659374", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4740585760177040164", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9584652777232392944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "11342135956789192833", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13338594271376045657", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9319064434175105168", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17705992851440826353", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8108933468437926367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1042605521041579458", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "975943900172381326", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1345101751956733589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5576296603250158603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4491380839102267034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1353170363915443814", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10090923790949378407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5214654427283761256", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18218755616248669884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5145853681977610916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "3226193790517362610", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8614375489387596119", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2780423409483867058", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3615052707933370958", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15865753975271064117", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2673903488704336606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6260684231055362504", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13325762052023866627", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10745099399736462076", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17766628441954343001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "4513063773753763458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 198) },
-            { "14126906427006602775", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4805402210873641704", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7869779894480025247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "968105804060326332", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1697260854781788314", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9017605508157213607", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14883438809987378616", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10882719585803523032", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10425889533411573166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12878346173547852969", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7650862961269327235", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12680688623162482255", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7715649642603303319", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15201438563802430490", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "6450532136308941035", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "8638074773026771425", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17966898762317477857", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5924271203978892761", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2119566651547512543", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5568753513029409478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "16386955278777720573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "465567788283624320", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10538010212480716275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3135889221160961020", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16238415425814188039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "144634005596305959", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 2) },
-            { "13962325395021860937", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2219693989290882970", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14942858162799632403", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11184290482439221741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13130001092233798285", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7992077349568239994", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16883372966656079608", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16839741351990811959", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1367483816197881270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17228615388053183744", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17264671167892237524", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "1920042803083729276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "5596408142536691534", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16033512206711124104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "9277610800970567810", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6931062623510631425", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17647962002015093887", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9162862507585693061", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4773077837537775324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7305582749708309904", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15800554162607246964", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10187930930336324253", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "10183537720515608", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8541982562061181756", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8890400423799565844", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5895417825685090256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "6791806088355877039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4804533178560338520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "10850369799801518638", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8113660920207936963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2814805887448339818", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "15275978123703636572", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "17214254645087272557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "12421204749289937399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "12327057172281102984", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11910900938442124765", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15497263259976427714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "18357544235608006954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "4325081100430903742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7916244303189113815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15757308772667178999", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2945245652128285151", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "9062781751511609244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 805) },
-            { "9079676771143357396", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12714892326998505133", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7171904645566467208", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6318214731544748245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 265) },
-            { "9280431727790048190", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8803037667261582905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12185561188335760786", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "16566128345135114558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "5115298857582076692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "7242013296950669829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "7649413902932043811", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17682152011630274259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "1170380397764345558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "794499287296495726", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18279416225045612845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "2506424495656099512", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14466032674083938714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1531349457115735845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "2909347733581487795", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "805131056816361237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "10546430708947911124", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16709930291825881111", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7946262362930618714", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2431241169199693527", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2598267743388306204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "7878605163588288309", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 89) },
-            { "4759671642533786591", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8575833423399668525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "2685061316482503878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "15035800097152337587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7105279481103494151", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "6744692937598310090", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15656706773401161497", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18126685473408206840", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "5465400164581117113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "12494969618927201911", std::make_tuple("fully_connected_gpu_yxfb_ref", 0) },
-            { "10783630257421062891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "13308187548669026714", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12755692101476964677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "16742058312847401360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5284456216115118110", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18101509783610609787", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6464050901421037006", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            });
-        td.td.insert({
-            { "6509271384550125629", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3374410641320310726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "15249442550355454201", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11624226818593966530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "1788455099959676873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "16677044352793659175", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6081038474197004540", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3220756134650041028", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11196245220967135443", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12512751736409465214", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13467831091041327178", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18253299978538051201", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16339187733937346919", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5940337324384948573", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1040650352205493707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "15838113905712517735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13120262386070281193", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14571022040013651253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2129742884686884642", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2934519615045138808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "9312974578711092131", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5312269140190538942", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3571330754519284334", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13842149852156451845", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1868805550246252143", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7954972694876158422", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9692654253261175490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "15529757761327002288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "4635570915184713874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14248622935809594779", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9178915201681884122", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6143200133853000387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "2781309272856442321", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12567935463143860469", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "17386047378634216634", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3980835859526174461", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8075261051536686307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "11031358859656806724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "7243917162812988891", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12054200116003751590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "14985755375924972050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "14712972289919865502", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3074436655804078403", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16013560489115457872", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1470933384474984858", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4533786844080178561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "1704404203639481753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4850497746076450913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9485825829394109934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15115780248032030963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6631103268546309714", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3724572174214794659", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3364141707903132298", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6328802691680458752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5593329151028712439", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15112599407339712681", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "497488185553682238", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16341131728764501904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "8768300687476117215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "249639220178603842", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11305232900158601613", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1786732163438555728", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9153779186876518773", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7667898603371717971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "490931535580183607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "6051877311645456194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10617442099961865960", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12362290144183018227", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5150256051921098637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "16335738565228204503", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3287181725010492879", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16075006181495932250", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14805540705424073865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18103534417093702556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "3427691447288240419", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10294610483561043024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "16393176054374397767", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18187345248160481425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "16661843849495077745", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "6439316331231400868", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8444259010311137762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "14731054961557547253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "990199360818917334", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18035673326929466074", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3286330985102373533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "6654167459904026563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18235209540858013173", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1902656726461670148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "11545529736818363243", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5854093367753757010", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3398322619007806698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "7958443549125799229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "12867177334690636800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "1309867416606346543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "1463649546800120847", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12600479027568241746", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7974670633697926450", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15589007878875898942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "778476198101178556", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14387756025635589673", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13079058582191027406", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "6214677989814002369", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7307271009495440764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "1082586642383386489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "8321204816277460837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15488532485794545310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "16052741298509954954", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16541970206584576833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15739756988784344130", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15914058104244750036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "7880845322716481548", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9277176009071334860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "3438296636411972401", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16293101831324587788", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17764795635957985989", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2936333406928424760", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17636500109629107732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "10812324504777808014", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "302694026179841870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "16135569134646688251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "621915374938805401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13488495920546871271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 851) },
-            { "13042938686374926241", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13158449455164143947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "12221101678609734421", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8099100633390626027", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7780336054545552428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10432365444137108781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "2800949804770763798", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8174833187387604731", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10560559646371329711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 377) },
-            { "16589848737162195829", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18279927175542031567", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14363025045807200040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "4880150897829846031", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7581174843529024536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "14808079119439455357", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15101834579076569231", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7400937639903461446", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3914143598803149415", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12550985938092975889", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10128143628088846123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "8767817856303586064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "2670216237572554944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "973966345068677905", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13618411266808159341", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13472577372534605883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12745552951204330052", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17361714725103230834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 528) },
-            { "9996142812492415452", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4353583636655606632", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14614844213016502202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "18359731130169236059", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1644335606100150388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "743941460026466526", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "9942099207256025216", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9726913113016874092", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16361932270527364507", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14517191894006411358", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9285202897230250613", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "294153950488131608", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8846314870152404018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15438470456977849772", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1089944493540593798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1092) },
-            { "11031569203645035546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "10069896554844445748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "6104380778870471127", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15052577143485630617", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "13636407347458845915", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15811723176266128065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "10572380563704942622", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "11669828823444745889", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "16341700680310033430", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 1) },
-            { "13621339501067135142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "6769524481210107636", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "18431306649860116380", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12788611449571149037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "9306120768594851497", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13609660900720370993", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9263784636194609884", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10693837788817206459", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15886016297043613632", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15178921033274918199", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2034811390140488812", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10232809153913700925", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17039993918927377002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 429) },
-            { "10704906466618081803", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12309955719964788034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "9463256538942644563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11888011890096886932", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1898243736289257252", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5319459637051859849", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12637509262827320678", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5853697372844744672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "14568618538516685994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "5770286476124511234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10330180429524641331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6334639534663495263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "2328919599530851492", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3349468433721705582", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5714365398623475983", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16934879647229234163", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4098191685457418125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "3940619509778739158", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13022797264172398260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "17010172246526353957", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15522099459864628246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "3531786338249174486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "6845814820599174031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "15796677813117622429", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4342446399224806160", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1325669650629605592", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15678768217453692725", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15227189929676013024", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9237587440336828595", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1680468564927032670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15267084369543546013", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4740864135937875560", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4839205075057964902", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "738850098651678143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17266121859044814533", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9526266653688168429", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9062774198518904260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4400247897123856252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "10893628699015898230", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11845189428639322474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "7669403041163460089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "3056212889689424946", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5840254078917931433", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17826868890632814593", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8466986812935642059", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "12264240305528403865", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13914239937595549448", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4416793079965040181", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "462240909302334133", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9162469583721135043", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13101474064130881526", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12081698011407453832", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4282756088824939292", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11315238071192463859", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16511749893955141055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "6669808855737023569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "10782611933832492335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "16384186388687043048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "17490188677223978661", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1198893312653197535", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13075579052866074866", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3370082268529091875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "14887465694301281952", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10782169939706303899", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "11606895513516475339", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4628748977913534701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12473600360154597915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "16768497046700403748", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "430132942408244070", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18121198117765854866", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "7203620615363933078", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "7826406759309418010", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1919535500129437217", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "167635075964111628", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8652128863605749877", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8115522418294960470", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3830842631023415233", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17811558714592064184", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12003323477818208825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "1626430741965136732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "14699357144600604190", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13408839571805750778", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3211829722778368758", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9406763539724266157", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16870036853278751563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3391032227732782982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "12256193738921380409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "17053671692908867872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7578177053220150569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4280250278457269231", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2931988747601319855", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8898095926967052382", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3118602494449249177", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "15833461718320604065", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15078168059698267650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "2269140636553245446", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4290840152278060614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9363988379673156863", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14808759315730413993", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12992061224471212714", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16582761411084080015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4461989328775275994", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15493488989417521388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "17970424536559595893", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12725675221990905186", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10701208905236219083", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4752129805031267391", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10100237101982273901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "6131481289104111211", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "378801963103874857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "5422432655714154738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12978370505631031751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12681408370704556588", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13302687772426736346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "9073757008455674094", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10014448860206587805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "762634810164167963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8353259929933281349", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "69832608384091511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14020956765444878761", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9120377367517042357", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15968821946892330559", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "1752185056297124917", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "6863331059471727622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "3265415000818832667", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15959543980008442942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "9091110033424983286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "4124478505694604763", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12137340921829511472", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16620268338434572068", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6102330514901613158", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9737833587413114584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10006197783106691106", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "15726902746983125797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "14337168375989245254", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "708201295462256406", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "7407975398526425554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "16312739695844838884", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17188004018198554470", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "142650579335909103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "9101903304994333336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "7121708962074176240", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12268912077694742671", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17536482873064844308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "17109520309574369561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10997156099709436375", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16441830491664937048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "16944335478353845609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "5526223938481098693", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16666792471632326054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17209528805596238905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8094920912208664820", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15879385408480411034", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2530317332900569142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "17724604495865223459", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17479773641824222843", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "14264584839702225855", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7082007579524697455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4633923265089466898", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "1933147648540963732", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6926590672771069689", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17446505012657609153", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1237920404306733800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10899110544832584656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "7469107606686458209", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7720153213673170931", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12864204111424196179", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15814015810740458605", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16988275131627316108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "9767294641786972359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13809046727894108358", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14944590179685661287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13883044928774243663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "11298854310398101852", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17672785701483179117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "6921081008428242060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "8170998059688907013", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13289438471364352634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "9456645866001656225", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1718634913016284523", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6022695488769618639", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12213908871711628660", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12577421746159122264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "3574585436812909168", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11666250400445971335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "4772696293208603817", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12514693341682532560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "7868973874302246233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14791575777969587370", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1173986078589662704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "11455055202624479980", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14120569486714455490", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13636859714649629789", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "101401523793806394", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7498614018449036163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "15597317305719116351", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16117448559783537844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "9477562342190423343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "9694701402170070080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13943983517468412332", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13183380647506951324", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18270587701371596297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "15924583510704449214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "9120374653477510318", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1044978617045366709", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "16027853590391209100", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13576010631084066792", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7465681710653503161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "11153522012082333137", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17248329632819747646", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12334522314915706512", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14065215389112262561", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5401380444992462053", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8300290944865904942", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10996429218747311159", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9059418187274548462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "15530407024531326375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "9542325095876448686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15428591250165788477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "18122858611264877646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9588943054777767098", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "12353956380178079089", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7332664632757815486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "15231987838322151865", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11626402549863483301", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6673966852801136416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "10722677916294015259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9951951467222189282", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1387945708447092123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "5671289201458690944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7450417963648518926", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6312971928547466668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "1173136780324694038", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13387545865482261974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 805) },
-            { "11871319147579477936", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2173720698351153121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12213354854947437262", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16588325081458426169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16469493066700118274", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13119040261291835298", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12616205756849913359", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4010419602093863685", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8163000689380461611", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17158401628206867933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14365232561737454031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "4500107195684703428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14343008518525689150", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1075027491444288875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "970768445746568749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "2321767794934000238", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "7211179360844946434", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 905) },
-            { "9468684953949274635", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2930898141522848681", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1142968634734769401", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15159534367247036982", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18131954418490925431", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5602377914578322577", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16781187505186394353", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15695415285791951018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16772854836230971016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 674) },
-            { "16409729623371222748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "4121109463284708890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "8267783192628619295", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2111669705686676421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "17077815973022307612", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9775648000771985077", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3321251856445833973", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13161997040644039778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12757611260347801001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "7986797517722531256", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6109013751635776331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "8092673566670222445", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4141005390823981166", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "18243724217479803107", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16986358655784856534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 724) },
-            { "12248852114219058572", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 905) },
-            { "18132952464279667664", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2162882863309264684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "13282951481330978659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "14675165976583799157", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3837190939606792435", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 1) },
-            { "11975047184326016230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10785252006948647963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15958886009743157242", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1218323229202187514", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10720769054729185991", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9423854233835016530", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "3141886504884887200", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6558436237075337721", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "5010119207726811326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "10939522663236304689", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14362876471450307424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16949056117405140365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13456967132681889167", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11612044653200304877", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4776685525963461501", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15728009639807698634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "1895560603400089814", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11948858355027908365", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7541325258238317885", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "688897645422834994", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7333511810266504718", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "8125500765566111746", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "863057075064640334", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "73865742350616903", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9250030880535336888", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11908169713247209976", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7493567975736494003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "13207134083675064956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "952318454591754214", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "16292848987976256449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "1527126728636583082", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4391695940614024479", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17012832508134584917", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            });
-        td.td.insert({
-            { "14697908554930995949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "14258941821319200170", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "867868384380428650", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3647203315640064927", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11587239927319376658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "2367452220382767844", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2770397466252831892", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "8614534946699754256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2807516818436584831", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "3515437649977762166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17764033613416389758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17777248703109395158", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5592526760253524303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 48) },
-            { "13633048912926365931", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9205978149692979955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16925721317097534009", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3364467044587904559", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9452470718398027950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "18148431787172327554", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1485662490111767875", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "959260710517842876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14171139920084409181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6114241186364821679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14764715930784496165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15003778740401601065", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15666720796968090760", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "13862199647000195451", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14689423748560749566", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "9190054801124577726", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4818598834950786080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3894121333485095575", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5436553435132026991", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4444730303823507621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12526988667216482085", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3870539490799697188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "4588117321438490483", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4834446692898125871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14058311587429063829", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3423717644513543253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10524079700393212963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6875055157295709098", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14749758365915995876", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3573490922300056520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11226912053840621089", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16958329690837977102", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11179211757115972103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 482) },
-            { "2968439898708528834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "708747442142592697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5931972000452008090", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1336940384521633733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "9542795021683486547", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15578456771467281881", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14742998604680438008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "11612209645710419427", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11759426200341586247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1) },
-            { "8456185296386225533", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7178866013527118649", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3503893875515897267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "4023281997496669037", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12411075288896909468", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6286349307417232815", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10531218595816974659", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9654944848074437064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1089) },
-            { "17868834743037242721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17207560805775399864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10070051133200561606", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18027243127893440568", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13598062803968442253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12417253210787537988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7208008921815475393", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7397376454528841634", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3924212595662208655", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2939605281692583169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "16653412888821076903", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15805087418686802636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "1972879521448306536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "10055549084854766170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "14311888412221174224", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1498389965422474930", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12339692995143159283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4849343880559509889", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2296581485980163665", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15438530452161762045", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "8837721075413149240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6126579157025017808", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10995886682834858002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "11685571068419983048", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18186612931984342471", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "632116056424249698", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10486348549691280032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "530973311459168543", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11277866878590984477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "7206226541369793931", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9562527071055150197", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5852569526295779497", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9433162648796382333", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6988492019664525206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "15078262396281327048", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16111630594575598044", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13200834963067135502", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "741727668385951462", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11359409533744011242", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17092525789052598917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "16535378085465418910", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15770767768674603174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7247475218645942682", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1141277975467180549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "12181889163404078773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "3934090072734175564", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14769111376729628572", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13124342334495538095", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10184417796355593956", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4079026972040047969", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17848582668902427291", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12455871938978342189", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16585502133291740543", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "223412492545617963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17640725195881101275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18322435770607273817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5349415632630235233", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11596971301790598405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "17195293614280872622", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4982549855424649217", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "2191416057399400794", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5539793555189956907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "8931469268093714938", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "951747146164097188", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17983556812075120553", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2542112741645712811", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 1) },
-            { "5497751772699578150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8317673282128335201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "1662588605309237309", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14646141746558153748", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3221469860582147955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "252188028702250668", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17635171685500922207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "10322427853063201289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "18432421400879260832", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "7612288596055048389", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16992405636352406660", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6014752258124559691", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11822555173696078282", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2531597468539205600", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4708035980731751007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "4006884370026272807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9165817820007469505", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18093895673012393740", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1171681987783013074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "42935035304560876", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2744566213784972700", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9815961128076948768", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "5834825835421819800", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12727541507197887360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "5328004363712610999", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11824946481875102910", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9523941899498458600", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9999553425206328238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "10914921540144371519", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9545968464906009869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8780671766122887951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "9659837320293869285", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7600034850149968684", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15581997249051127645", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "1787152688807233651", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9309173544512377803", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8257103926661643451", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2715447739580688669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "8260073247636023575", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13124659308711651699", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15612334131144235342", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3635446784873718932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "269167598200943915", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "314054598858070952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1802510952374368682", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7469127846325904854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "8106738346643994005", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15337841577110104431", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7590390572139249734", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14918482938530107806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2783577080556699089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16888412539296862194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "5449117614287394433", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18017913952946745878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8999570321113443117", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16347412180100581330", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3463206409786541741", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1354199155380786906", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3894130445933963911", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1634884284544380004", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12818786388125465101", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14847662630748580880", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10961696014697611547", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "13493119419114659706", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12776081190690731910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "7440953406601377619", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7650375560336513366", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "14403132596827435096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "18135307303959376082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2116913943188857359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "11120846960057008937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "3019864917236424168", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3806761527342944195", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11254744277059719812", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3011188207492335920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "16120120950870908964", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7349880498513046830", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13144385730409574259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "16548491024653039967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "15188570678726970998", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "8609939102588915855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "12926382190254407283", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3859139031732555228", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8792202318168046223", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1518270620354036926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "447943521999310356", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14043064718932538557", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16475247464223458061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13006774775034887171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "60267878504897170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "7565867291827884997", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15106614232165315070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "2369451367723962073", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2114599010013594942", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7815650257256675477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "17617204422090117691", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5003718302026277632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "12896226291465522304", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11317843493537672866", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11972290239275366299", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9735280865199145311", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3172518362830684966", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12933253554354951910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "8527055001340219573", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10565371760124443824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "637115537820955017", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15303251546207338960", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15961487889420208188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "6511742759171254447", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16924006268301179157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "3699344686791530101", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4138968242532400395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5330130011321223525", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2477849395789783501", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16667887002111125871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8532217744217419503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12319073009094248232", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13833960927635646899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12825407709419526493", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6294240435687565243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "12379166764490359144", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13676654389512816868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6118737381591369532", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12793347723828876280", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11263540528012919947", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14544219140091420262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1157069349112113377", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13861223834466385546", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3385797925880519845", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7432142107544210174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "548663565933738403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "15398380328746287438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "5291817530552764387", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3231651468686543808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 528) },
-            { "1088710562928089772", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9414927552739380436", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7565006185780806333", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "1497560475414454618", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "768820004084041271", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14346466672686303107", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14416897092729861207", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18209930746627816139", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13531892014108749846", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7463517383354309469", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17030051116023319382", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11497761673211348612", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10555835101752189454", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4644580321919256401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "11971736882960844905", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14175962333785791005", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12131461096501477069", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8640150341228170279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10488269059469838160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "7264274394359484318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "12771841901357553928", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14813178380338948912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "2576773809294607971", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6685985905221810743", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2487679091192300910", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2863465257341735941", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5374664689223295796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "6141193842171342687", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "844576097677576405", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "290134020607738418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6692085187697087807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "17634966178519099371", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6101196122606108273", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17224655686568797096", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14116800584981026541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "9500850790449116723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "17651477639302255490", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3017824560305532066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "4651261398203912503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "1638858323987412931", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "577842450575835175", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3156783219125679946", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9131183544020825260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "17587625589456309495", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17133376737554844449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "10055247339012492459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "18164706399147697716", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "3819990462129075757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7927587739463421727", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11732321796147239597", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11795826875463204296", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15747571668131081693", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "574869992355132069", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11724225282274130518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "3061372669831947873", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4190912926126844643", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11759322316883943989", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14280056365441354869", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6123707371654753818", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8039645104667120991", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3863816884636503247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2295659951331099829", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11585430081839020501", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11079061135559995449", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15192022454507415969", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2014114949154914483", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "18427056032084727710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "9434143681116089888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16096353398003405565", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2789901295967374316", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9439431829175743345", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11694428890484758107", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8542782888102516498", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "946479876892100082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13734043898517059207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6664482192233202590", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6267138247577676996", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13199672084171648305", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10923480230259977438", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15181987458871339815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "8710469645764612897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 371) },
-            { "10672380526821947133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "10626018319543075871", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11086464266772450142", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2085467192625870436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "12287667143602938393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "8155268141318893606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2668729552208169959", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17763347648779573375", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11356842300444410831", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 659) },
-            { "12712071520541638451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "18244966393978155130", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3114210363452108737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14339479547451422762", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16674633029045714564", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "17054207561525574617", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "900243696733233996", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16084700435355748612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "4298242568890525997", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11823205954749139338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15421280195211166867", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13957350536347764705", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2803569867265035123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "6340128090694375876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4999171487916568471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7748514992101811029", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11892455357792445192", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7762916621662364082", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17462996923473002801", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7201521533301617290", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6288489890578212082", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10645625090439446714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4169042131399110713", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14884315147107686805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6307939332939714967", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17277917672233464304", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2204178900998688268", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16789245987103323406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15727611564408173858", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5159738930501638535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "10179916356323479080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15757351352532908153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "14283458015244508428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "486816652607164926", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1310498917952637709", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14553577436929219470", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7233783054884565746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "5124080536266387783", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6548949901446632697", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3534971503826416049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "11800783548769329949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "9814647153117279415", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14122213471825630433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7755177205197405275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "15317946705199574301", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8210092359850191682", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1784892318069674949", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8398910340371320955", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5965451243366505522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3160543867929843861", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14770895149190975433", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6816632607384969096", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2817919813339364130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10128120599276549920", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6253009218981124949", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5720964268093705079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "1379758215293949563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15209909241815414156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 552) },
-            { "12686330321897091505", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11337525286386930242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "9169935203300589222", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10019470094545733255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5507373575763339429", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "6910589963488897537", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16567486018945740036", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4889188980319017094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "10292349730148518173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 694) },
-            { "3034482898462686729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "1161304401293419103", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11856815095538913065", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7995820969034996638", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "1497127399271219422", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "4445913285957791409", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1643122514049603104", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "75120034961995929", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "123026136670202868", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3444250649099578792", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15863531785836309247", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17015328096102652908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16681690088928624738", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7979265448683159733", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8792010676469476740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8302886228681027388", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6479042072492268780", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15531306520021286502", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15065925414996398951", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15813044197987178947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "12430677767405883160", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12177387334053203378", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "742689192890486807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "787203599734115483", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "12768933181342249823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "14963614790718019676", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12275528180752359999", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10576856554114055028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2226745622763268469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "7603319690872333930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12867038076564517306", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2728938624042183713", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14262482011051329729", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1798440805196304745", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17377315194963069204", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "16513038896689318072", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15464554714318666871", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5751283221740229986", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4792351255949877935", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4242173940230902960", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5525691792821548743", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3988024997010367546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "7972861956906521660", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16728762255357411770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "14670339865153970893", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7861119251077361882", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11421180829679625737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "12004628115138530335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "14526262781657292025", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13051390418571971928", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15487730714504758208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "1711220333751274603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "12393385058735194260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9871407256481442790", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6808843088626121909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4251673416603443503", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6250785177115691293", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10532183096485321729", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6484375582324852109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "563440246018637010", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9909564412554801760", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14085753024976995311", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16182470664818268848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5266313052389515491", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3114869763557037270", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "7792512829747836997", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8505040075968411726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12850195004093999773", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11279789373735965856", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16561618767117193109", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11451740938287179908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "14025235562200209723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "3571959174116404960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "1427040855295681285", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7614673554809134631", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7628077869220463202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "5245526691775741296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15859493313686060349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "15551338663759394064", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7056293586529818253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            });
-        td.td.insert({
-            { "12871555773123368130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "17876939980356283351", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14968401410355925289", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12407890437443790515", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15271783562528081169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7861234698413147249", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14034525799882831106", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13434576226708227155", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "14031009077471784948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15967614281807823696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11738360883999461965", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1658174263018326745", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "697333686114567307", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13025361884606488732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "522313477023837056", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14273849038400888518", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3101087806792514129", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17737878867906137388", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "14757749560543979231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "15858356755924943957", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5705056256080522960", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "636447309806530300", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10309986238001994183", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15693204620575485046", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4995051972576749717", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9412392168031560549", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5649150695527000655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "13082313288887957490", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16610284927818475574", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17917978116807564183", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7106362077449435105", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11334122788337402526", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "12065769091972094756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "17580363505072477558", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "6934915634718835911", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15594673952484539994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "6055793483770886264", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8519354640245415816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "108442764389420633", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13187657215288939912", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8619526128410675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2447893458816856522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2644054989263429508", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9521715904587435700", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4936961129835214448", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16209868158768307271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "14193777296032212476", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6664432489777052771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12179968379663737450", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16014822406751503249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "17264608538692763688", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9314293064351558241", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4090512597925170883", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2777318471329665162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "8613740762403897614", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14808895254077106198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10465119306486335226", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4116610956045302817", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12960590161485806657", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6723804327185132790", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "10811224523636009881", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7552544688541855979", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8561261337239934159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "5184121466994451498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16307464696265537356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "2819475920524949313", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14501815053459103515", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18161971781834208343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "9518071423184197213", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17487594336237597163", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10113696658040720628", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6624079551747071383", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3449007266907948591", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5656320098721954644", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5109636469531439569", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3658599312236344017", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9305861997313663528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16579057939215877904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "16428789154716792138", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1390379098099686972", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9065137335863605013", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17019474731460049248", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6808980404170272597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "15457040168177954463", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13398986810666238552", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8976966933427522253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "187352687850707150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11988546375476924356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "3509487327001107638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "151851883170419907", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3080612075440389053", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13526488884846845330", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16617569629839911513", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2527018855890902975", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12641170321047008726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "9280279544075738476", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7213383384662748578", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "568191462231494113", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13182623473102074079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "7683334381958571864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "13835859040765465258", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9184275066167601343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "12866217660635921034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14184895905338394239", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13058026769607428653", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7226002258982605405", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "12375919467924385618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "17893696934478535385", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9955816463820554626", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9606639214735570069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "6715523440337925186", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5179013491581036103", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12782932626966309185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "14230493618724018658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17491825380936802930", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1117729599102132243", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "16210934187492210542", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7274647463152753603", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7900926714874404219", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11010673493295430801", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7364084475361144967", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5751553671208192963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5269172622193124300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "10982526068861394162", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14359026450472189405", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "3107655421406621915", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12004552919019936392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "12311849904266608701", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11280672272221124024", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9541630719145326121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "3383222668132648804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "18008552719153887303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "5106072383853469966", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16563030700888982979", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17538518333907257868", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13902214851539825156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1594829714229111215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "14461365896122393071", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14445031303145992349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "16912738776771289379", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "860852602930021016", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15800447082078291243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 665) },
-            { "8611873585228858719", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3366647240745174769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "14331658870024759698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "2575631797904040925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "12989677691575632174", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3117673619907511009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "959666756751640874", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "731825454731954517", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9736684300833719045", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7425369489110576363", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5926747396493954633", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12850044341631872743", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10864011008000364415", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2242602888499888844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "17036482252028102703", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 51) },
-            { "15586047342916704364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "9366100787108468082", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6666210546769702280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "2753393184265405425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "60509335250891515", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15669242195570440840", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4121535611334103359", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2450251936650841836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "14963449045970262346", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5464801565268066541", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7075659071934895087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "15138641310139776109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "13155570698198686211", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13590444711975157776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "264466528528245004", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "537074122417021898", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13637537549252005181", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8117638644045799192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "12829916847670789556", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11299021927882809469", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11096750581455917678", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14483314305369207554", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15949311219856917559", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "16129682385980878760", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "592245952014430043", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "2147896649835170790", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17480277135590489472", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15223779293313750042", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13264617841270329349", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2060161076370553192", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7953255701516490034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 774) },
-            { "6846760451124717672", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3872151366780051246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6556424924189200804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "6713554643048248003", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12984970933638742657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "5898740235388207878", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3797986765970777456", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17342758321852264926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "8431759922045602848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "2581014920570427861", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10635659193402005820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "6677367803113594603", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11939914680143672459", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "14885031472057965707", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12165079289914715018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "1330337530094825121", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9906138392975645747", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16955829428734830876", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15974208269240775349", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1235864574444794315", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8921636651939679647", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "2706024586717944825", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6911215749850066204", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "13598984763955239116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1098) },
-            { "6880746917399866285", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3622778166646258015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15998609626878578708", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "10117092543913369513", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15187035463799513424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4133424990380177132", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "5393510569127725391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "9641089659148164809", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "12071914115316550349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "4727628999533330347", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6128157319666849074", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "848735117501914374", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "816527348871309530", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6800893510381991731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "6210866413385292851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "12624762527234542946", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "518733575377143679", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1270307036687208396", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5541365322085427177", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4633763257197651352", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "501138469231848694", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3567607339495161307", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8794896449397768269", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12531880391016521628", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11682041005124075890", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9778670810863940690", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9116620473576064051", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1734769856106746136", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "938848188161536107", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "7104309382120208659", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8409488188696700816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14304497513584420080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15617599138946168772", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13962189339706230770", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16404362308829952450", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16128152634974034731", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1982176363226079588", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "361497145093734608", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1596353239542510685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "11693134363909241514", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14819324687394700033", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13145474177271090694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15489746763312425915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3285968426413869315", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16522364268583242080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "9488453013746383896", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2527276292172180386", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "677249604491773387", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4291531885506213180", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2048528188026477374", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14151747022287993729", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4240975186599864955", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5538883245745495145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13530377297525480029", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11988285441493553006", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4683320313995550908", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4165926748138587705", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16851716501872033211", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 2) },
-            { "11148428797294511280", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "5050273611519516510", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13668940862847596363", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "11563334365673075610", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13040213971461407125", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7800015766976654402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10544411879329675593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 765) },
-            { "8941904405273405481", std::make_tuple("fully_connected_gpu_fb_io_b8_f8_vload", 0) },
-            { "14349625788399542568", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13507437548205340054", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9383182168277796969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "2609454334520044465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "3244675355773468991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "14616413139039308367", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "13854845390344305906", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8956566633622104099", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "10404725818204494388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6232452664016831516", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4398371999113956082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "1122856374602590533", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5924698731432597368", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "17616719165728687438", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5498839261395459224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9372916528346260712", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7113777272518482528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "7375461241315602473", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16516262096533373158", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2133236128630074068", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4278280309700908015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "12476381811279163147", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4883588237027084166", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10626341369865893888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12816344078518706065", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16910952799476896905", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1354647381212852890", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8567667881970262923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "8655739705298627602", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18180655791734632264", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17399728556634171321", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3738514326459749974", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7454366978268164047", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12118387933632797428", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6550549654706796887", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3224352307778512793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15449715596597016714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11775265110573621330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "13723434004563378589", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4021558014531645922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "1018687388655376483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17310409067211414565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "17987739992848266169", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6792281830591233968", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13585916416233680276", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5942742563827424666", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12068974703657294908", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13486084204140096478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6870942166356599956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "10308113903347312964", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10717031088082350652", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8260024340787818709", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12134858519320245809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8494725779002762049", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8177017967170389275", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15483343060578660278", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10174346112533671798", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11727227430687227444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4885504197789468842", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5020763861388859254", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12026482841341343242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "12384317536636082264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 49) },
-            { "14054116974002669018", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "2625969259447793593", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3835387982926010630", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7369109502608631066", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10979362792894404338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7824075236081312706", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17638753020411096694", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2759142157812694203", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10071449674652717890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5649082203775427830", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14215394208930955062", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16161112020028389294", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14091610802555875119", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17830290099875088207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7818381040882768404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "14469011068777098822", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "8069537351442302814", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 266) },
-            { "10577357333308653027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "597073780328219388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15879172437519876393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "9207799012657103903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "2149299205144202701", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6942606834115081953", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5421397731090158382", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10309586646776223605", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3820661057776133570", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16290551573997593168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "11051684565403294370", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11208625628954179200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5516518048239364231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "16950925976172895196", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16995444341569389342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 341) },
-            { "10588059104387338398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 57) },
-            { "4046830923427667342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "8497468192424557348", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2199167704280374654", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9999543693712389402", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10572945270796129630", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "7051238664181857633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "9436893310034662243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12995903177757437362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "13767500791267563349", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15310474203328198827", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11872943152839631823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "15048584393463312977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "11070968498963106073", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "7168028033666253263", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7412772553395852003", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8021915447462898777", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10833423331830484028", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8717456809499914445", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4897448054295474302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18384215264061386089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "10771803503544737080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "17364712285968437405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "5721096633060535553", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "1458615259705605525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "16027456210394993913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "2882493407831196579", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "2149582237161177965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "12480527132372884168", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "14117801387057507639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "2583562092192709891", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4848143712599565301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "4126895998426674411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4571404165794634411", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17713666626443142908", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6467251764899975676", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "230697511447695268", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6959692641873234850", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6469003096932778978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "5339985303398206057", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "10803929517111130153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "7084646429975006971", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4914435717288687793", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6203765709597125063", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11361202190524990711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 882) },
-            { "7104266560248570112", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9504349455215835807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "1454014148777456006", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14689812157592240007", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5008541841892687897", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6391201577234440562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "3780320160034246719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "13731797251725972855", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7107677063657303327", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5632958791318880428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8439950151963452285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "4387041763614917736", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "149810021216592597", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "10865695385270390803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 266) },
-            { "3372770576629463160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "18059267466971880386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "8506271633579173639", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12762301414049772746", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15418732002117930760", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "603883331897298932", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1338581414403268264", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2603233376890892194", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12656228464579497510", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3986429358782189117", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3499106702307464480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "7223737889890738294", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6388086351909447495", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11291868421122092629", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13485300684443803732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 985) },
-            { "6992073477131490452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "18184621367843960190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6613116267521819997", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "10525462454857911293", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15235409162483701027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "13326339730522937517", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10090036431487700311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "345043289576587800", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10406201782146034797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "11070446574652704629", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6018481198468872040", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16247399911710810038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13368203360773949292", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4455369117448405874", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14236681916032484600", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4678607855896512523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3350601287664242323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "14147460733160099960", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3965327578193694832", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5429130923188159806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "16616945998593626851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16626502801066228405", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12625112690264223217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10722782762733112118", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14930789530046665855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "1186545671730357033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "1875764913306932583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2554991397391195611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2282123636764935353", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6371463287631658789", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12193395770362986433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "2737064424879246276", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5012013738970489338", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15710826363434377015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16889886654893884746", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4329042569031331949", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5420215220876162902", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "824911124897042617", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4208702365182336507", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13092232276822302626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "5963901433137582265", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16527840366172690992", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17147293671640396193", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "415232223198122046", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "768720470104458759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "1984152634309440563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5546447512898130524", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14671212883301405408", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6964383468476265892", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15643135666029727865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7100056605355325582", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8611710048909301596", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16895523130717954500", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "70580716590540876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            });
-        td.td.insert({
-            { "9222744127882324405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "5250257911846706612", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9096495972770198040", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16936968151775497887", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11666226259183201584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15980348884716629349", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14082448162400225052", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14385148066232093878", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9714508918051740792", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7964396197946740183", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 904) },
-            { "8655315308767111198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4732226322522411018", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "4723643671527109645", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4615766471724791034", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1398177377739338750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10034575179959785704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "1584906448442153128", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17264010982688979937", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10514865654990433040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "11411413051626428349", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2412846055735335136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "14686272582436109012", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1973819632224480598", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12011606174372081253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12287827551127082597", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10308431308942416781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "1775515808301276388", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2356785927637873692", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3976736548270395981", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "331661172067077796", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8809438390805488749", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7678226048807568024", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17430994325635361377", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15641322340289892344", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3225866261943242708", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2102169562353089558", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6997971129340865650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "726985753660756762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "6764038061921866053", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13809330759308309353", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13357365044448426880", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7692849839965441330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "16252420150239789472", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14558572801374416278", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9695024256541464964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "8645965165922150743", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12198263593657033426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "3904383357046705799", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11313025178951972247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2095245727814188300", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11979032916453246611", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4805194563120934409", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18094592431313771787", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8010456208258134834", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12093737479877309006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "11565861421381730304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1048) },
-            { "6843617687528352801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3950738240651133849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "818998169319147148", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4664983769199548480", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16016396784190934729", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16723478941106779069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "16921939234324970069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "3833510944499257797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "4113061482402915179", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10811837819834149164", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17021925795809437171", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5445584581720919223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "11516184047320372729", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17559750858236255044", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4171374172427814762", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9794456440994218671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 264) },
-            { "85050336704401597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "1563987925712579649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "8372855367097191197", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8866716292621164810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "9272405129875537865", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3216877571075556066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "1045854873741563331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10512507780534402341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "1591199515536783245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "2613462626256090659", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "14281801257982447624", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16247799703932868151", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7287107719392705356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 756) },
-            { "9492026326463873766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7830644361525332797", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12536364199388193516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "5074273865983613482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "12058759356433220258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "8015885733173521367", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10262850086265676378", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16644952765107909604", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8219179055259247644", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2844794465598309010", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12831123539633580270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4903592553439092472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "3024402899381804809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17585206779958265260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "8726274320876550785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "182115051096556835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "579781312141502576", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10613621801998459768", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "560996739186313493", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "47872288115972996", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "712165731154577189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "15281554100135159550", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "11583985978586657985", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "9193880745263317167", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11239541755868028928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "3793265335909270748", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11002875874008272679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "17201365233492366678", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3337625924046561031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "9870432551513415176", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13970935346154374605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "967141158966448909", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5385316497510064491", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "14612206111651511130", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13009612703754510124", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2884499360870038648", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16966477504105790279", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3039528482572243879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "4129722446574108695", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13218298785325404589", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14114380593731243715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1038) },
-            { "7615563770941714046", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15322609677356616580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "18029396837690671545", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3889456478817717702", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7241156141838776126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10437367877444543776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "17961793197503317952", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9418041909134721047", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12439827609628473238", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4346591404756288097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17969195175890497912", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4683575221310726091", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15555083739490354527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14098811155652990436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "18426893729833771809", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1617135706549276688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "17252589865292797082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "10232429887105708502", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "11560634267092054110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "10016815108730511683", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17734480671864478402", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18041177945345031826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "9502195532658935521", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16729849855476690294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "16003914811215141863", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7378840969627751667", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7706714181281908433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8159303545761286685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "11411580529501121244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "18152894191323920027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "7693459946348737411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "11880337915508207160", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2314579504260247470", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12669783714916998842", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9748307611165615848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15193403354218116460", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15979956159651515122", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15774073623451382326", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13621771094745539509", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "576164857039495839", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "757225477250808939", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10271261715175176019", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17711453305763476458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "16974981142389546385", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10991423760161409883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "1208665743495618456", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17618727959983224888", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2562815925396318565", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14795618530175274538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "13815395589135469450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5479761740065152589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11999246609107242706", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15924916465272239832", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2629918844315184499", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3442845193734599342", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2920322372993101148", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13011676362747785816", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16188473537674428539", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7210854698870587826", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3336076058264596420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4988480452582288323", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9947449295659685973", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1646638859396929303", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9079203986633151014", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12489973984967168447", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3737576893817599311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "2008424849669196225", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17255805293355120219", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2321773209766424929", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9495192057713157041", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6428098122005804378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "15991460001131903561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "745009493367761775", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3406812365298442897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "14066675688397331406", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7447163906170805189", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3396731547696204011", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10217182484138821482", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "883436333317162926", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12184235281888559274", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14025678657541870252", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4356817283284529593", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1068155851494601726", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10598099730944525581", std::make_tuple("fully_connected_gpu_fb_io_b8_f8_vload", 0) },
-            { "5056859994174498686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17490471699618303993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "1120455113299469776", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "10396788403466463989", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10447947790216991304", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12972798847556569913", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13814086981499638596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "708452703070938673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "17081449111821382308", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7708321360699824256", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3725013268198063198", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6142707387281700290", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5312413491828906254", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13766070202060785219", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10318417166945621015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16184142990117192433", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16577611471466452776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1095959046309466012", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16871004845988227014", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17179609670678746034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "875296362957469305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14651159827389223108", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9576962489937466093", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "11418379777288974452", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9099720270958987421", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8040001390872143271", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11319799002723299753", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13094402291968806996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "541817615957967731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "932195814187889636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "14799012895945855878", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3673781117412048086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "2283157145557154450", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7330202944390548890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10868287582480518153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "14956246091163580499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "14199158130218117084", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8618627241234406784", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7232326270078161768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "3932617680771387232", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18080788888293706149", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15154700439767512396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "7843508201826629532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12903015669020591018", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1963081583851864291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2683304757433993300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16911464046178654033", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5313382805395362669", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3680396164645753224", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10656486867659934705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "7274179284676568361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "15497797842820949408", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9601412379897937608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "13509275050322423832", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4802009650745059499", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7604075520418038662", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11175936010605958812", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6126073246053235472", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16271675466919087248", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18199824206329982249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "8059328623525062913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5550969016335082071", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8615481457481938667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 803) },
-            { "11498084465186986412", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12867590715338247144", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11614353411428360211", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14912119584313592912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "16397733032387984819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "6214624887470295152", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15534876725099279666", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4353842547963164546", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10135458965276110244", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14026537760442360645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "1450861513159359637", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7837876599690110056", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1703738105910059846", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5046089607609787258", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3211956138512889433", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4313392430539923574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "12675840135830047968", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13668072006310741601", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7840653268996892538", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7799984350284425885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "8856888761246057127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "2740885908397449753", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12510951219501865365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "1854612313463195535", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "3711525118850629466", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1318571118468536310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12600707101000510621", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5940007433515335594", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5509395737020858006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "16081386644309102158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3603187029740446600", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9533360488591027707", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "15136770992109675092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "12604104383683210104", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12305397676800089268", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14487842225000203929", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2826762745628486040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "13483175684542464385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "11841034668170849494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "11872464450773754851", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "4216366893358625960", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "1944461047787586724", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5352061583962489055", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6512987867462549101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "8975333906619899020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15006321421735686121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8540111719936129376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "12031180482028822765", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5886032409392368342", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5364060938737428149", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "5440983284868981549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9043982883185435219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "7155796826953849982", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1635121016109328853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "5558136691773431495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "3239033622277917802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "9299299311101549958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8651641584737798174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "12051398350382954787", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15528692642731712121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "6107700818115209289", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18337762134908554532", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6784853321527374515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12024817951074673335", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9763754389347695094", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11265472910579659280", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6300691162962736560", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7441188930428385142", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3662747857062156477", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2180039710632160943", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4803370483104261655", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8185193068790365354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "12937333118472722002", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11658751382892761740", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11324651029379152442", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "693883892843558363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "7056030150365552588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "487214150851213303", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10894058425957901202", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10509933181132310969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2495655464941634884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "789202969657820559", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5099947445888268507", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "5657471280535146301", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6931953332823066530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "10702465758376061967", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16436006771518788093", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 0) },
-            { "155962454315573087", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11657946392097042544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "13553263424160050064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "16101625311127899143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10130171279527667782", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2877521658768725103", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "838726445796308454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "905526102343710614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "2042946928570163140", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14680730265621679042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 758) },
-            { "13512863534076172940", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16243196137456624852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "4438526427135833402", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14585000863294748739", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5950285227163574810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 528) },
-            { "2762489653422414995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15308196586729169691", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8913823292181409151", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "142270860894725256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "4937688558707451907", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10956668791040094584", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6578517057140155080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2215570184121152738", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14458851250685872417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "14398854364550406668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10316451248440741901", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "584086621952390547", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6367371992814643260", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4802014352392262053", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16139615240471264488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "7405315582091905378", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16882092367103683293", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12166852830214895457", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8954488655859677891", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17084977396231597605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5346898505346646714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "10789133352712755945", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18253784177599134876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 562) },
-            { "11731277083374465361", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9127827617126714860", std::make_tuple("fully_connected_gpu_fb_io_b8_f8_vload", 1) },
-            { "9811086682271990794", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10486000767830001094", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12686015414958770329", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17649961873981897621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8952733400567254769", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5295693108687178880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "1771347579022727189", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8325903548627432", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9999425239167488495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17958575161092859465", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2161052921317193579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "216603198215625772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "2912098199463107173", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1587501521145162454", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15822546325822628634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "9649445293567537596", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6744044115114192916", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17219920118109316867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "14123081378489325832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "9482749589540764069", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6603778920476932267", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8976238022515713641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14840851809642905875", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15131258379753113816", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4118073384938355655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "10292585962794261197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "5941095082097535176", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11936530628363072904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3631332752661975859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3219408878901707426", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18091349188280218186", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10820312036555742020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "16490405739040977260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "17377204616846724192", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7998455776901877973", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4562591438007476419", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11113125355390956764", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18040183500393090505", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16316483048621486077", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10280619408766255552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "4279062247055842367", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16267531927647687641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "8036474422877454869", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6699877220571254719", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9834941975457910988", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15449650271741732512", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17170858505976681742", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16364494883229084045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "8690196189594920365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "15225354446874994535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "14789782064157699768", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6290584630172122012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "208915399644127739", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14985236276429954162", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5156033406916344703", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8859895010324601937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "14135593723444205032", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7105219760750474587", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4656068024153891922", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16567638487719493784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 609) },
-            { "11637325834858582585", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "401304652492444430", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2920840796593281126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7700321970687976931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "18226737525116147628", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10358170616931426647", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17040537179740138304", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10912495395422146386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "225809055928705881", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "15206249797344242666", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13646974121952099172", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "84595904778810418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "12713821004129672990", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11706446082856895571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "15223164574152266895", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8787438180071123604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1880137091477870982", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4717620775314557374", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7913076120244203725", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13326492157370934949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9182260316973872633", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6888842613779488104", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12267555886404772991", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14421898375873029115", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13291402786934990349", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8900977003907025003", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2581414750854621875", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1044889231088602677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14312549767853703411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "6817494598328071314", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8809017515482311843", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1036) },
-            { "14041970415787494000", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12985942652866621579", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "3022939690177474442", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2031558560788449957", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12487879163561616870", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13821224753538037982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "11007175027950132719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 7) },
-            { "17321934232458063571", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2609346307827449622", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            });
-        td.td.insert({
-            { "14502856487639608696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1905758333157310570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2247717767819293683", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13960388312976163971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "17041468169694105561", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "57372993988016244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "4731836216299455047", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5047972486012090625", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "8746621720912032145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "10041205516209288381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "1298596164164324360", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12501619443242354860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "17329287216741045059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12259844988981080505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13527018660229167386", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1580344438642032807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12868739680413736657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 970) },
-            { "7280502812960451465", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17258128299721452811", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14248239982355212178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "7870154008378361670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "4216958486055161753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1867337342417952506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "15155676074658242659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "15409184364121627414", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12879367655655932174", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "528295119724008711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "13077917010686381919", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13839116996827687373", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2967481531952454828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "3117175697326325371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 505) },
-            { "8362179886017398479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "11931568365395665142", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14412158605670555579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 153) },
-            { "7008873036126556197", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14896875712028630045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "2761862049452027986", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17854208422879910606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8470959792634864749", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8907982643256296667", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6934241437968723825", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "14132543442791497311", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10471519687597963116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10148067979123062638", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18087356517015630281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "6856130385095139346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "9440117898128288296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6071668124835539929", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2949545414911764346", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12643643553436503069", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4154830034576950123", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15675903059949404837", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16851082749395991194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "3049097498155857895", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7585785802379042424", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12822126914959112382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "5578991261564497604", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11069983292783104310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "7119182041840303390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15997145184054496085", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10141558851476164734", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11942424927004660476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7590734607006912544", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8791285622784082122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "11376953876369788199", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "8731079912830889828", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17990326690659802090", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13856271274572142709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8733371726903473932", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12194037100109755112", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1251525426317284548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "11007944497812650617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4135975804549022456", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9076758673133996959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "3001162215282339268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "6981294059746462667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "17381516856910544374", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "17762455138615317884", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9813748068195103720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "7603872175048237237", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13468081302022888489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "3962138884698789654", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7814543122045448412", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7548031489690889629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "12818012741490629493", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "13961773444580398856", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16000753982895054944", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9170163372548895531", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3171354702636014224", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5672464491301994292", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6825390996679224270", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "897253033961107413", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "512446355173752600", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13648761167622654288", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "10760094119259477688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "4165019140664090799", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17935612508319394087", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "877901260688090160", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17525564757769958678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "17800115051456107658", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4615708568396290002", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6509758095668864050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13611054146745413536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4974320417566990034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "12348602762263193288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "7349168847581850619", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8161520217142313996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "12068797674575015662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "12107262410635772120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "10747101719272611563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5832851215142537445", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9332701118402940384", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5795524493577277985", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14973431782875808802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16426655160932259558", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14331554754171207866", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3928356751040028375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3451309062150982886", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12389854459474697184", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "13078401519973360182", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13565691057064774487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "3815222814331650224", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4201057957682777280", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14835309921389262864", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14943031375539993004", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14204609663091442879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "5968129546023764583", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15109847707903824859", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1287490919205560806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "5321698540631249776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "17759505449240263390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "16898785030254336705", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18385086614524985975", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17444003685761357480", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18302892230881285207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1952863937205473292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "5595779343671478945", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9967101735808367971", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14324166291904435508", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7689320135952025041", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5682190700442712936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "9955939178447682108", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11158789938857558596", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14447191095937730964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "18080848057281093190", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18071280811713424504", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2394023805427701338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "1154763947184432124", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9827177798112814604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "4089043893927493060", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4433497906256257606", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "10751633292301177132", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13809898858049445969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12229574562535756991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14345755557418971954", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3202085450628781999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "4156384238797998294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "5834245904292669645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "5008350851224686853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "13760645810144930270", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15486917753097743853", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7099035779223341587", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10879218241103462088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15635250842093678965", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10419440621736450993", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12961109385388101976", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "13558656230312558247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "2847490224869294354", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9954050478761346921", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7600296832974673294", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15082818876354718849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "4894469114343061704", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16989896550094613437", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "2984726467649419856", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1778345646142852816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13121297281694293907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "1008476023750261156", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6388117241933586388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10645057595080511813", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9702618600245321109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "16065744898134487748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "5062815196458225737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "426827405952656362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "2917999294360728537", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5648658688155716974", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11761545976388416063", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12352923639732112511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 79) },
-            { "10178145641713631806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17228810554159747400", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14754849694687093032", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10002044609138970243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "3102538312627892960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "4435224497850514394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8078028207842958010", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17907223570737272640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 383) },
-            { "2964705957088952872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "6341363789473021047", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16765994345605657100", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "10022487076451608714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "7902473777019759045", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17096735128393723245", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17498483343394902796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "6260115080574637314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3010520839193613803", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7451154080124553318", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1040411949730118556", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3141773224039276177", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15820005010263193043", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4980217316169616839", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7923576965630818418", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2321148334382088982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10128390168715530898", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "1641111108888949123", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13234055353608734080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1223196405651730260", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13478984039708550410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "3217295012596892181", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16606674008248299103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "9731370183088819573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "17025182465337728023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "7172357320005702833", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2066731703492755469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "13585163747565192884", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5112480593385320005", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9711184878666366204", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2578325663193624576", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2524029454785583409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "17806712457019493207", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "13020331397245585657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "15047676717402283805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "13325287783358291692", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15866935886105967122", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "15474155528481683394", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "10753540518493641553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "9078447949109922472", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4450409744922989123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "7372956570616880244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "3868149953087814447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14540578324750869319", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17052161869014993719", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "721174714308243785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "14817801788424046035", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3286496836813087881", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7482459536338668149", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16794854619854992714", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10558609844937234631", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16235115911229280717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "13193898459027972719", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1148949417144436507", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5602328731722824868", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10015368609444108372", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11799180632798787251", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14766694310604777253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2832268621630415376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "2273992727647793692", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7338229552985076723", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2439993891369206440", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "101387140804297623", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9530116228032101908", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15031155621982459860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "16304192736281226143", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "15104727000375811836", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2058364830449635556", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6648876837655776653", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1914964404168211864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13454265023861566476", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6799631962511042762", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9162359935098885411", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15148442194461613102", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 2) },
-            { "913861052717410566", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5958300749101873980", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13369603621524676979", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18436249934780056991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3429844423226609965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17318287523550546026", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7933217973342728190", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4861982518177129729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "9659814105483633858", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10724501418439612080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "16218339663410630711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2114232149447438823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11564071490267241224", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13820498543284008286", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10981374120597916521", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1551596771935253711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1418595171949196661", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2089730611490367290", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12741457056869452536", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4670487436469119872", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9169324504353459004", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10325138269934303618", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8490260671996115530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "1192279884248226739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "17011363406405852347", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7126667413990834481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "9452094307760005150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2840794055129352139", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8251544171504007740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "474139120607442270", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3987482581128838173", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3501882025888946886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "1117836569328440439", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13702254392810961772", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12780116250427776647", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7737977992444172757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "7095629088416100928", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3155353791103196186", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7992444232916226938", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15932838442166411183", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17889864541794448203", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12028665820838352309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13328583512713703122", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9580986168276580598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7926989875988735079", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12877601016766418505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17961702508543961900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "14050124896329573468", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16574710115918192418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12107079280128343726", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "994252691216116396", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4084026445911476156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "10785966734346479177", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "7777279468029216688", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11109044986816563101", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "396580837423299119", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6756771670011959646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "981803877097233095", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "12477315042623518609", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12892265081710606252", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3782308167335660154", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "87031578643428011", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12308956927236847009", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6458189051305803360", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6323083153920795679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "11330591026581463934", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6159729136505378486", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2856601829807186494", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3409043224171087168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "5209144536543011657", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14281154151197472605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "143667964449473415", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6721354194352192662", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16271970578584267980", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8079914471491171372", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1539677456611270609", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10861769381993948050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "10009796094612770326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "3856976081672275637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "17192352762166764393", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14931590390643373866", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12561177248542630652", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14971506154649368216", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "12917241193304093727", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8584375748627260395", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1419073145594317633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "3646228701104397128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "15783429395177379897", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11782188262748842182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "17726079670612220433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "6318228858846223186", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9152433123828445089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15128816312559638985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "18067291256808591467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5337351591182109481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 131) },
-            { "8931169575495985034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "14216513246096503793", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13123709697607309884", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11073090858361674041", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9119618606914671839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10747688146893187959", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11563892089503603030", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "5551484040302194648", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7183578232279711009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "503369896500284129", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3419536918610303807", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "1212319037405620223", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15596408854298291433", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2016932800158392200", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15705908639736679687", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5919454297699648428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11500205299047837289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "5643920882179676695", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6398819277350155011", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "17542035367134614728", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9426665763007611385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "8712136292276123857", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16828388628569377322", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14801210545983960599", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3341302541468955849", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16267682394077585279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 754) },
-            { "2052010432187897741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "835053793432636355", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3266557807508325807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "13512059751838488458", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12002302929446578025", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5735703235236456131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "9728611486592854529", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5040095338370816349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "13803790014241837327", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6254141935545262078", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "104765009188090817", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "856877003890134554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10504318542015227515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "14667793472412360981", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15773157615731010456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15060535689318007173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "2206771663823062080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "3501667344669686338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15070618248849566698", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4744578087509837185", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18417830391649460864", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9441060601228656341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5774841809066688068", std::make_tuple("fully_connected_gpu_fb_io_b8_f8_vload", 1) },
-            { "12790570304622911607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 928) },
-            { "5115007207028125638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12947341728489226671", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13412516623201653283", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3782239800777370325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "17224104246148265328", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14827882251752394500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "7223801044761006523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15367649112776077240", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15216108478837665623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "5567628205735744449", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "359617184733439511", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6948455759869670955", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11110173861174257158", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1692473411043262397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "11164519756679631743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17439276474731842060", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17770104464900126615", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6727930402459775131", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9616636708366808604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17822988909419777692", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13541382855330226000", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7585184325339753737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "12801481303602178879", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2878824076934639346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "2705031521944165712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "16773645387243701837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "9589942627115344216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "7273427309587902237", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1126499865206906037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "1114679698826953542", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4264284648458489052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "13776178598632392721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "3106922888635965020", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10774872391768741315", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "543472136359161929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "14811603003184578943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8527069404111265568", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "7209217811135076623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12585864429067596351", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16425665058951535484", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "12279771749366327372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "12589440296742583335", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "12146979849998627283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3163833930628348446", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12495003066477974474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "6310724136390087834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "5032841266226405428", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12810833895438895155", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14999920879568237166", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9939234037869927090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "276313536076170391", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2920017342405650206", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15117880293418979489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "15746620724134970969", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1054954263090546905", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "968092788032627444", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1157947252370351851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "14444475853714164129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "14289082888174784976", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14446688005815492020", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16770615142634470903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "8556125699591344922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "4104562704039821482", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "18275601715050791851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "875400109066360897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "6733731409232284409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "14389719202147508599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "15329680728165965773", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15739278428190392018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "9208964785762052001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "6883767567034259453", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12946540633035976364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "14074996784220709246", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3748621266324665764", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "2469579114592379040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3742751561273931407", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "2561508262445368003", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14316077757957132678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "7134419022268272901", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12308895602001600327", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1359720957005310113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "16549854027697846882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "4056971751486746551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "15295172519920136220", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13477548641580029772", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15820359925623438341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            });
-        td.td.insert({
-            { "12241130380766920378", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8951040603784899163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11083993858285515074", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "17769159396346490074", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2905979727479716212", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3244803973821375252", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1997392406402548974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "4137755981477177003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "8095675456938934982", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10171373375072694210", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16911450336605071390", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15112393534380347357", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7605652809856543211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "7940369586324090841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "12923298574715329852", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8407012082034007985", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10808909442136736629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "9119268982510599778", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13569453018083742128", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12234313962656804631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "14677968346503677769", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8543619733732987550", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11020315012951440351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "17725637691681205907", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4617809377006148936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "10194187012252949909", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4521622755195947253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "394778201589371681", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12391792381149655331", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10178171262128338408", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3308770992373192529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "5740745357953479527", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10133054058562198093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2242829490403202087", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "3325575565536567070", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15222260213708019662", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6167369758442930886", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13425251102263428554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "9480653639044390919", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3911736807429733938", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7369903937189508744", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "7770000755097925765", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11155444222714959508", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "10076885835791159907", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "16788162879714733906", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17216583849049249733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "2221145174704245189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5762631094740444698", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14366395926517590797", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5017701748886087836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "2722124265986526212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "7742126547476513275", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18129795023552968695", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11698754846673268046", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1152691534728260611", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4925720860007127584", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9827201026276954165", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3805667660217578518", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14868677663932902695", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "824380206255396866", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13390197134230598693", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17833304859352483840", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "1099404514975797315", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13104509059416300615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 301) },
-            { "2147962310424425158", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3343020946662226400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "11730276873446857018", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8553491894663686698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "15206381185687737007", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9920155432685318259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13471752029049484143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15525903155475629518", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13754408679115174221", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2567046336192437734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "18408107772851888061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5118467701668427545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14318347197994059448", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13991572769793610416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "4439786737038041995", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6284333183047854748", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8131879590716437354", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6805188858008657978", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17746215841755337461", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "135072053401934228", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15006204461468698734", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "15636128989267984459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "1157388265135592238", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5941852872160795604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1466455001976212160", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11436473937404565094", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15681189418847392587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6525496212688896740", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17948637243158994878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7535571298845832061", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8537824547722216155", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18417288692814472127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "4830454154838353056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "12887076860522920405", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10547134120307382906", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4283886984540574108", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16532743776403877084", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11086471945045031067", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16739031949237426992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "9232653317479846765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4465701487417893814", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9423958333298993923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "5581428998642936688", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16788715253205076219", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "9617316303048974588", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16683169947375504066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "15599983560500910839", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4299773714254046691", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "130427456111826171", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3766048787611884529", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2895819653081408358", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10254566865260697753", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6059368508708501002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 371) },
-            { "17167229341919111718", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10007925729029867733", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2173867324489962689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8978764053524288494", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9175450649281374948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 106) },
-            { "6970636030494405299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "9900658671239107502", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17342198739672369885", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17651821953342321913", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9453100135791813000", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17433340097721474017", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7235358742317442134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "12564687330941036772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "5240706676373148280", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16566214123371867456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17583785768334531086", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3499645386058307669", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12531580106484042446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "17292751972745231011", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1123577455191848310", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3928596145340765666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "18082422341304348326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "10099598062509781441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "13738760763969959522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3759515057574218101", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11862259122805366807", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "12700372241799686527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10626281431800814406", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8881906040469243354", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16837963510205857013", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1413558157882728476", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2923543983518895756", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14578867494693499627", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10816702874143297564", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11756650366229979428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5924341622384096919", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10324485383646920518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "3957253946857103590", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8943651590146149679", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17043601935017365442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "13767985623872409391", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2983038203471784211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "4773123925616969670", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4890043345392707202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "11942019076226205097", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "383721620126444793", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16223356735957394429", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1040030752340209480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "241656278218999298", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6070612528095353265", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10783046011829953095", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14244689429217411113", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6944031900067948180", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3177304125602972370", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "16717713360264747483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "231083216612056805", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9429695343610239088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 152) },
-            { "7839141505912665157", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "12076058470574246054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "10930640103080573253", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "11417406326478154077", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13365950526881732374", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7474592508575297101", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1108229954015380813", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11724732387425614709", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6651389480007764007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "16870110185980402237", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8220168481755031959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "13938466156916423478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "517997325935712670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "17567012866823126402", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14417401878572618236", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13223232888554043645", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10709828018763273371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "14424566003632608852", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3096280563014331836", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3017891343734146267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "14774814395786139876", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15050884844653850678", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6584960721513702502", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9918371346247634545", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15670767419106537809", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3948843501884284998", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13352000946213986936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "10787747981914307179", std::make_tuple("convolution_gpu_bfyx_1x1", 0) },
-            { "6362428985273506890", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14616969385577243225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "880603384896315783", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9795194069954915563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6730447536124542965", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4927360358387344983", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8183383667948205424", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10815244730103375973", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16597170760061556882", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16569637518948306471", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3602929955785812025", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3622409603053918029", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10429104188258277773", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3399406641489305996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "6818140422066151642", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15311930929656759371", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15915715422308762909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "5884951148427535208", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8093401822846123153", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9111988592015450418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "9655242408142699694", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10226095100825845185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "15985980444340490463", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12207503176295152756", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13602140021189675477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "2343310394723780653", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11861634536583463947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "15602218079503030465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8933701347987963693", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7393601059996816014", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "1304921846760027440", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1299545313185409227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "2621495864635590903", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8494385862885499798", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13701870576531008278", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5638640164891118162", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13520876347177213888", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "13853630125050609175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "4306052436602921234", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11289650463922092775", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "991586070509079617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "377219085802486361", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17211590259060346125", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4367991456894497706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 99) },
-            { "13448845356783404653", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7767103488808670253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11450378244355788918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "9671459469252116568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "852015206582470545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "8509024280905303927", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13966416504547680082", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16913004986170202203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8130920994920685157", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3058716597925544041", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11690533591656807605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9144487908815767824", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16587061389996963349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "14001406016806064079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "15012885932988454455", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13683623172740048376", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2438261005924916746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4754967381316623440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6461637373691101671", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15720012960520885263", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4779919236230154165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7969441643457570812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "12151068022697708126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17515847111676784130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "5195511638783481084", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "3788462090984291082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "3369689552455141157", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4718716595177056289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "5274929595362413625", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9696168324381001582", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12055647521556218046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "9738776059655610885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "15677717057398875599", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17718424965214606218", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7060804814325505165", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4622514167765722873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "6084775920382972735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "921209976738626097", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "840202264034382558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "13296242326766100583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "16341722570340169855", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3176785355296130660", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11300415556407923335", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4072951883124129646", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8000679297338683619", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15897457705071738591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "6945787904293959477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "727216855315869048", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "669771152920944125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7260204889552803221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "360064276184684693", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5758133252959371492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "886880682650879171", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15269988216002549857", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10272016038525930672", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11799179287124317845", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5596441339918073261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "10106454449619141260", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5291011077679733990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "3701838669605585798", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9940761514291929473", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14115742296883450319", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12741762570001404232", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14034402827496819479", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12294364015803004575", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "150132162949295379", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7863319552895863063", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1250095876638711647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "18373951194274306895", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11088324811742486481", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9243949750444156746", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8689206546467098603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13403161389559730", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4833749391314748606", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "13409744191227471760", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17817043205731836063", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13919204232414535363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "3116068331849795558", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10256831975351722184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16120988958246503683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "9541996065561509160", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "273242667845386507", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "586947787345351152", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3121704239277217273", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12990527753120735255", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7395419333138772074", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14910911338105922048", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15325852281951905610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 803) },
-            { "1299760574827253811", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5303970743736042689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1569043950563130463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8555049634736330391", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16502045034098739466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "2737352811173555281", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4030004320208162301", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4403753181729432604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "7444165397413360181", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12467673564660108244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "12253049204822930675", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12714814165247623529", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3792276488551864121", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16425374300157280628", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15298221796479574600", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "49948277487706148", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4098581145478965082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "4750513665628842598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "4914474312076193952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13586735166545634506", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2782970766870172398", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17140702790441856730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 722) },
-            { "17037462814585846902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "18142462471803295391", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3534874664568214253", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7823257556787476006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "12374775091628199854", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7846384623429362522", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5788018146987909930", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13364676690016875118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "17742192339816511494", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "166091609652531090", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7843180034077880658", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "382811963722907674", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2188101366183302888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8642107585829380438", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10009559358571629502", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10399620940700804517", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5308128387928804050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9643408025778914022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "8323669961818535927", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2058172559199858297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 752) },
-            { "13717351126657739994", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7322472892320910654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "2173163618947713953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "6219075471508685758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7779562434199107586", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1375084615110147615", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11194372303922533529", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "13754540732991287617", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5359510718430377298", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5285172225938230524", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "826850797666395121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3316798708399098230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "8732952254407298868", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1245259979364728404", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7139714914586273766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "13038533272699602337", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17181874388601550941", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9090828337597312855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10049294964307823692", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4561778392194061215", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1448440012428740463", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4824040283449153298", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "2148877522799179369", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13320675959188615441", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3101885395179993708", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9399511839804500548", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10775271979871646995", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9161616741940575576", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5578850952665051661", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9319254979377483709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1336739931702966228", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "415826393421796195", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5374969798377773063", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "15640466585550013905", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17955326503130437346", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13330734840729670622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "748236447365453504", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3735753364888836383", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7329924387620542330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "3067930325929862490", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1202292109713947702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4773482308451190487", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12032580551021546487", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11645116728396933125", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8265982881100325775", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16395067736440127496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "3112648799276134590", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14830991971271385876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "17823133607491820214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "3105425187506203551", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15526021915035861514", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14173531787508017136", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "7565348337952384040", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16195893521207315456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "4099828484175044842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "8348997431940166878", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "7346046748383284270", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2057158988261512114", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7397341452130124383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "11198301748997371475", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9569522500959727054", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15829095120243431195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7481256533438761028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "13700014916680753395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14263055580023018733", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14916236722843741326", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9390478179772073718", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3308955824300750921", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10612739622648878242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "11744368351982723504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10878198256414940305", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2459018025887933198", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12745631396795162505", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8876704486585503280", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15973363403733281926", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5083163738120585821", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "16374675547140209181", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6136232084354304563", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "6195916781434462809", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11557032521956761994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "17712558058168648648", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "11015074526119891710", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7005509036795164602", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1900375942069325499", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14807357397951247957", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5899560521070338192", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1822096761703761792", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15161053469199826008", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7314288062932060863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "4625107584562815965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "11634932044447867039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "17778091287904736965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3522383297921565178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "3684792790546138809", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12046017161414846599", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6546440095044731932", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3735605582512535278", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17088011073114549679", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5600807544955072308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "2314805462821790774", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17439102502195540957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "9590161922224578217", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15133468875250992696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "2319519208813614116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "2553539191926275121", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12900949103593247293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "9700808806849459216", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3563872903821081702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15600841108426475615", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16242136888057221574", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15765592038173567297", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16601230690171340432", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13634686998599681086", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11499219760597131534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "6577505360421510286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "467070383257529689", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2421404763191415191", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16748662918272106932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3365786526859737112", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16738951239219589307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "4769003637955328938", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "597650904461183283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "15065019229949449623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11267495078361954131", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            });
-        td.td.insert({
-            { "15914107501176673997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "16961326251624610778", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11626398907755088688", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12522495848240087966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9316082753126682958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "480310470450900836", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2373860353284525265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "17107083637007906184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3873183249402084406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3242391637018676328", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11834361584875491425", std::make_tuple("convolution_gpu_bfyx_1x1", 1) },
-            { "9534041402131086717", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "856949500975232838", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "13912843078550000960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "9647916259092117712", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8002233052700666718", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "12619739385084492771", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12210280332071091209", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "6317575981520135028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15293835051273372438", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7788374869410867297", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10477588607457125173", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18313088176414428990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "7817691489550523328", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6182829358839578529", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13320473279945887641", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2866656294663853474", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3538679039078582272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "7889602687414497280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "7724125714360985807", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10879171754021534649", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3190494353583341446", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2501411300945696806", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15217573782563469232", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2026622899016787854", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "17442105631503326136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "15943141845766932879", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13464697394408238115", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "488798544312719183", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12710794174926396540", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13156052826121673994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "6423785822515265784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6423354409210936959", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13569941893504840630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1124) },
-            { "18221867262301937903", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "9291397338108903174", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1786821683911142459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "16511393582666965704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "16253244737884854313", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13323186744342557015", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15078590909693331731", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13777174566683935109", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9589361786336650748", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15625374380046476173", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4897690791599638716", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9177211394807412309", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8723078862651154959", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "739676584505475609", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4523064418696274869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "4701235352806075765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "6363788325163726004", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2172999245833525797", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6820134899097582639", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "7292351660229751817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 234) },
-            { "16725049805030712400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1308980444055174254", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11597391933877736800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3017411837779243878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12722153168975105360", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12121204870979363096", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17272600601478967434", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "1351033666248868977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "14553813154800569861", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "2722062599746670336", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12331134162344797761", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2816339200381598722", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6650607472019166205", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17512961503976896701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "10632933069865171963", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12228610148087508521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "15897300973213364823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "8339704352841356825", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13835908664998757647", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "13558687084677943158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "12623375499927200341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "10765280349477640969", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13234872695521811652", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12303905514885913537", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6407471972820516685", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "4755225554035527185", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10133398220120888583", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13474805373264874144", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5941092474669713339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "2921118493468368908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6756679359093569015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "14188157670969097508", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "18299254635579957284", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16542318967217020315", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12053562297742437099", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12806934028210472719", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17704040183891532914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "10837496380266058422", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6942016672941874829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "14799579913711096584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13735180250757239202", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10065714384927707796", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9589718307719207394", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11175353869874626110", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10718764522366711114", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "4430932059574900921", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2041212737963974230", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6963293142152132518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "5582450255753679095", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15542520725696027828", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13596876807637507229", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8045367391487213749", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11270855425262923989", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4135068756462147853", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10730222715353420212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "1973051991518953158", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5723759573058003971", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9525535670799618110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "6003409324516527726", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15192230303376521834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 846) },
-            { "11262989876326061679", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1507504848332592003", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16698547937652264447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "8577875628223148806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "11627532066884923848", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3236003754884728510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1048) },
-            { "12458921031453334451", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15604634351310647589", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17046662043776372746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "8984436655107983227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "13369751385866224286", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12908594497114706897", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7139719632093090046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "466744273945239777", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5788323787676797805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "13483088320871913126", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11971853138084108953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "10682300249493137042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "2917735110073643952", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10141927023849730720", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "362823013207940830", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10893432143734884603", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16437093737761968743", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "3101748967012684440", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1582751548472076534", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15809639778580769565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9741607635826869269", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16767392067294252396", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13501352378461071771", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4685236901551256966", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4378422094110940766", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14532519639619315651", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "138379779469699309", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2929715823970060874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15289152041466330689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9967611023372430532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2929190644951986399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3441335188113424896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4256155212405177844", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18075395502550596586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "6887205509732544213", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12013818650853034767", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8935522915553126640", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5044721291675005144", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "4422642146063042868", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14835641172229643545", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7289535479247584635", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5258372022038629529", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13149617013851130587", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9538863363710651909", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8065866013404161366", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14116275901314596944", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16862145184923128012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "4228437925117070319", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16072525303202287969", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9629460794894999510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "9340159617983543624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5576305720733717044", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16780457022162749898", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "411016281538345537", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18083803358410976976", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5479590921345335946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "17536308070854915513", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5568728266639058524", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "14091543526898531200", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11820789223587555410", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8193369947544085921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "7065244994574625911", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8922929126299811091", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15988378956341507229", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8943913562339525413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "7008509833947166548", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13893808009363736870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "136349424199140459", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16152775342222431281", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "10952045211444638649", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13123561937554734618", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12344689711325644622", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12023260267201191955", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "601430670855155006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "11130439225010714550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "14045927407431718832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "15901724303713479611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5564881878876582769", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1197281505560782577", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "10424643336435622408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "8421388456873652700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12181310683533105454", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "17806747473167329833", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3784684114139223050", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16437124655147660375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10431728173806991521", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16633540487930201533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "9642965664913867675", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3533556385636018581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "14897384423894125457", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4091702228990140696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10218763091060511457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "12936220888307335332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "12787837386653002743", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3047407458812880288", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6249875772709398338", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2399313178951511557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "11224051407822914513", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18255227391100087860", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5552699731399195573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4104679489383377966", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6871131333562410117", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7263796835299019284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7015738038963065110", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8616584380583931648", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7343590049199309046", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9144269202766996508", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17791024851737594885", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "13328911884191551889", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "16434358667865869005", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18094205332383644037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "1129349074674368869", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6602394091385112575", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6839795451275143093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "7162155897369277782", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15848096609835347542", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "5995121118186531621", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "11025471731438443683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 47) },
-            { "18214716801063702171", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2339864165283480961", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11052275099129482401", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4865102850562917067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 478) },
-            { "393387269914864557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "4714289593698160876", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14892045745899927762", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18029395208219861440", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15779837958180258409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "11012427206693842637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13450061819089402572", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12802517759474139810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "14758040027936817208", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14097394936362526559", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10747988576436391912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "8747430148550634190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12388894315292201102", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3240102173773280414", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "5857101685300045443", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "16632786413927045192", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5884802375772043861", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2955459120402821540", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12027202455592387086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "15839295895890205274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "15899192375330393731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 427) },
-            { "9026883911202247185", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16814025114202322376", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3319827933068341610", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17477062954520561609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "8784358107340738205", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4674504221851042542", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12932635875905153141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "17413191440314817117", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5658664813683907476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "10896935976330351144", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14159596290442764023", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6709883527730513363", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4165036357594592683", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15141893564826036993", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9135116285263927211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "2908156087871187676", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "698274493570551388", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9407646138658641974", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9922764846020092836", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8365255170846178102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "338716975932676215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "3070859615622845671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "14616801816838734032", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7531346828150129063", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10170577772376890221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "15228390729175722409", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "18435632962969462312", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13978649386370395620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "15397084091361096354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "18154019240019929225", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14909506411483112959", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7715937239456300593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "1921500066107090648", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12767065362702304803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "7859659993155959174", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8576733135863336233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15386715291503303766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "13571587312517912280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "6928136130626403937", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6192955702438301372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "1290180607037086383", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15504618703544589723", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11311839946200066200", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17370158297470557151", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6222595759158615206", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8262469434265124590", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "166437837813304707", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15352064186447212862", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3816674884393241704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "9585113116232600562", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14908477489231326997", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11768117585574496387", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1230262279011217327", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "657356383636782030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "17705807503894740726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2891736961665476908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "16094455700371652312", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4447065688824381344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "11002165738333323413", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "875146113874776902", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6020017927557041768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7875724726741958520", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "3861351835305151926", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "9890700023578477203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16828961272295386615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "3774285301357006334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "938222258370511187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "2227700097134029783", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "132437164570900392", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17789969008677638142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "11604111639041106489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "8205640825965213946", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "11848462434662954749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "4306881509708040723", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15612797125081819500", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13797759143769042759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "15217077412685024074", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17178308105985812083", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11132679855317294753", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13076935351221777993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "3301356450249305137", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4947788161154370784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3854114166348568039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "2064464435352777854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4049224463072418218", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5642822685234782052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "2208765794404376467", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6280726148869856021", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "733956743303342862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "10415046594066474634", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3976197003067656339", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2714322766616035858", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4362304842016958728", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1074748462756364699", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "5060012838564094182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "17174919737114915467", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14001048251986195179", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13927671398099556854", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "7181154048972884375", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "119047044057950958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1885075753696445410", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11640225461345567929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "5572956736535433608", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17466963970980708210", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15167962750603978874", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5293502980575652171", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3059575629482816852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 905) },
-            { "334703311738467111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4972952621622984792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "11308583200952256245", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1556975727728498645", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15609860394182767048", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "15069906408448814772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "4597873630741623918", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "904355798061005466", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13094289895577333088", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "234288286732396704", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10880830033700542216", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15576534481170615301", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8303211644727914658", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "11955992313739654625", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "7804715870037416579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13367787254519749641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14823789570149356458", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13800760323805415740", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8779960552750034544", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17281826959243966826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "14752182392048929103", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6217542346826403576", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "14113320831418478396", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9435086287598656868", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3067001341355453846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "15424646499666127616", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16953093098789113080", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9803492989444302959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "14510495923021693109", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5459463503840817402", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17893181511546734799", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4958835037528182801", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "7752913515036871482", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14079654309452583394", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15548847099740441551", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "2263637493894079492", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5211831143687501130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "18267428053198215471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16487774205195979355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "12794369485239257709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9131235538209388787", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "17951403431757222177", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 2) },
-            { "7585777271711713778", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5897564616927353003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "11738780323979052397", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "598214270378842167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "4959403414256988744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10883341041912056319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "720558977788683564", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1216021647922150199", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5606914392662771013", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13710319251108632115", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "15715029280006557222", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14315760630997175346", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10536316961655703500", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5583453364991774426", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "248133885018839814", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12808456612606675259", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9809458159478958866", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "5039037192630609823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3571030800252732358", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "4238885454989272754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "6709083009339039603", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17515064188391421150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16986610822918634530", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "3568514382399560386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "4933831571091731212", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8399668174006528237", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7398158542592530232", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9250410390663336388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16000428520749664687", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14971270053929063630", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3652414035262499383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 350) },
-            { "7780140599533242850", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5911282942658469852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2362092095402043749", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5157949342388119167", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11891319657803057127", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "8638227907054657946", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6297802534570892679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "10718639465064821919", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16371608027363202992", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "226601879759378771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "2797436491596125131", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "1632416005093914709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "17238880534517721334", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "10037086825900566930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "15914342421266687768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12946531140050029900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5762878778443755104", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "4819131094439732065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "7317391511452227268", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "438528596970898721", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9056038338958199256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "8063236641629084352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "4241055784642339756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9812438080378091263", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11157773554806649837", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16459072408799224894", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "8236018377815149638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "9982350570959875159", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16956263773967652552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "2164314506903530487", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14766477690417085350", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "8270591002934311024", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "6708349666663292171", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "18424611729838147994", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15476491807306982382", std::make_tuple("fully_connected_gpu_fb_io_block_fp16", 0) },
-            { "3806131437010910920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "11942736969933408358", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2571289358202565251", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "14668725050395069435", std::make_tuple("fully_connected_gpu_bs_f_bsv16_af8_vload", 1) },
-            { "188830358699960789", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "16813995580382709489", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "12988253829685880778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "5577571901049952658", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9663847096617096629", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "6935581283700404601", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "11973034261101454380", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "185782385623159958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            });
-        td.td.insert({
-            { "8354579049246302728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "9040145293899470160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "2294318010381635693", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17270057383792994793", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "5928392400230917930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4627958043707973483", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 1) },
-            { "8735534480653818425", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "15226556774612169126", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "1082574490068006980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "1760391741350091665", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2128612971571865547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4809191606466167229", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15816807118780455948", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10225565543636007389", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2649192407401044065", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2294800960010879540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "631489011812924153", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "17434141039341226796", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "9328223957245552723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15750539817895707253", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 0) },
-            { "9515771738501683", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13251091004269229867", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3860667078458481972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14497254583210965214", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "3377052601059116318", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "17922279129043570176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "16836088134347394854", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "2449586975250543578", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "10211403590176354415", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "4602232889230956461", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "13804221028705631415", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8761283252495354972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13190888313721073437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11147573971701279689", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "4776446300552810228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2412069259085234287", std::make_tuple("convolution_gpu_yxfb_yxio_b16", 2) },
-            { "59356084516953804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 596) },
-            { "851057218719456209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "16694984452720336415", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            });
-    }
-}
\ No newline at end of file
@@ -1,6732 +0,0 @@
-/*
-// Copyright (c) 2018 Intel Corporation
-//
-// Licensed under the Apache License, Version 2.0 (the "License");
-// you may not use this file except in compliance with the License.
-// You may obtain a copy of the License at
-//
-//      http://www.apache.org/licenses/LICENSE-2.0
-//
-// Unless required by applicable law or agreed to in writing, software
-// distributed under the License is distributed on an "AS IS" BASIS,
-// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
-// See the License for the specific language governing permissions and
-// limitations under the License.
-*/
-
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
-{
-    // GT3e b2 b4 b8 b10(50%)
-    void tuning_cache_48_3(tuning_data& td)
-    {
-        td.td.insert({
-            { "14421061973479991516", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "18076121920579110076", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "16998662249038174039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1094) },
-            { "1240102354814495870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "707979507145930311", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14795626641169374231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "8512711227383782401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "4738743763536059708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6578804773136886939", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18180491232489548313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "3572202652824023801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1031) },
-            { "17546566148752689536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "3816979903860227798", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4790960977352818689", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "4868400250190558111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6631816968511312100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3509502334639215181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "3697631094971930011", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1467428583618467133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "9335016444137172241", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12255528292506999241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "8127853538569353431", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "1484007449719260391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "9056812077282494074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "7127306913758514626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "14630499010941056793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10209532888121442060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "17354626928258309128", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1569111625440278287", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "213518984547400496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "384240534894352154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1102) },
-            { "4732699611696731044", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15739274921308457528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "7059729537732609153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 858) },
-            { "15743461017318513847", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 42) },
-            { "2778141440914991349", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4588420324030315321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "885661562948597780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15687441275464931484", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15094664469997373662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "5358925179582853152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 186) },
-            { "3610579553304450107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "3047710665820732705", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8363432163596927598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "11758765408733113291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "5050495757462452653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8399477322910720113", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8921169563466511475", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "3727142736386026852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "12571532345206950176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "9552615241912277692", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16628180201355989101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 884) },
-            { "17808913959977434594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "7000486794832106857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "286393043958202995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "6258191734224827354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 653) },
-            { "18043745678739016406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "17946191056428828467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "6263019986730305851", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9546990560009724329", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "16462602383546733062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1035) },
-            { "1350953652678789564", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "330278641539729021", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5912451559447635837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "1774158624592967937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16985912104363932350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "2908856453997530641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "17059095074211347838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "14668529234172928874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "16863960779539003201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "14346703182362139650", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5522698342845820411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "10114123606924808948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "14515066741400300669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "5280450544965361875", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15025260753866131193", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "604467633591545941", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1500571771538985941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "7256947320128669983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "16256970928603738516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16426179645101678763", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "10269005969451576527", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 246) },
-            { "6745633232989303110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "12364947728685604753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "12173409033330010794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "419783127503173016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 564) },
-            { "11128727891847758901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "1093840152689636371", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9714770878761308566", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15083602050538795803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "7527121935101118719", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5116562847410288642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "5385395378424322451", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11602830611894444581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5589350202160007768", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16761856644242716357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 469) },
-            { "2096167792705935744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3433877094202077256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "12610004507393467447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15939740070666326125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "8422541638844255768", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13082713280504953535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8961544327690568390", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11883632480024839484", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5769404877199637961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3296059171653513862", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9968496035529786888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "3664842151999943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11539652577193034099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 300) },
-            { "2524233418633897945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "3743573500773847162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 506) },
-            { "12541834857357563605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "3813463368918975003", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7530197659550301431", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9700098364581157575", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4269447138276727632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "1061595672605627170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "7569785094993085356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11504777464995699839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "8224143262995973449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1501328995320618233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "12069726772532946193", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "16197538586133639338", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "237384442106085756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "15972830392998437739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "15421166985948480394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "6794427012971589670", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2420425134749678611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "8050798452111667069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5824801192141531089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "3668065353749623655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1022) },
-            { "4251588408225461731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "11113256687741667688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16582132711225619740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "16957170318200599740", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12644942072153919043", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "17715478364817621621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2854124603710900850", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "9380980604821454646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1879844536951785808", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1086052166358768751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "861813331533609605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "17434429579652310107", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14011124615649605281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16440449399643706863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11733721371402545268", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "15816540550252147706", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8285478622349266483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 914) },
-            { "13979227237506927267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "10492401059875127091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "12992194515157698316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "15891662883560480723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "4600698444492242585", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "7157064096682175957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "14221578799010900252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "9213886570531053949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 429) },
-            { "1285313118947640320", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15430549683839591544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "15858485865603722138", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2116524516810466877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "12182468247297592907", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6949539207944972855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5582107298039488951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "11773726534842908728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 187) },
-            { "14385185911482960528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "8844619836383523698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "14548629377527143409", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13366059704398720237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "18349087959351486710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "15868648764972133201", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "15322019609805777935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "4451257789691974239", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1480287432874335824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "13657522194775317201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "8032685176029570383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "4334698056820320220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "15378707205730840765", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5977248663249062384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3170785962566427770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2710485608298356329", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2585176064846114298", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18337975902615310907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "6768322540857745605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "13657774210341324470", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3072535365860940873", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14230197617570499447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "10049329759351957685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "10305912614137623024", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3896848534552901221", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7405835196787288054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "7020655100877544328", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13174363822969694054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "13232269620066140073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "13608239208821071914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "17026284168840448378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7866128397931438774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "8264178890341675354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1033) },
-            { "10317038568333963064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 694) },
-            { "2180753144963020203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15271492161940795681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "13272818502368975319", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12281346074445607180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "570683988452622223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "8451179695288093195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "2085738943081638802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15563546888345388359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8525389694584008001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "2481005139798378616", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1062) },
-            { "574359978358296617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15764181772410734606", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9217386935739152562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "12161602271403760008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "9758907700230386910", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8707189142909022305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1375259485223819020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9053383117071470496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "6261121070004228939", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1112828128944231163", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5843679089588930933", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11083777913844441475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "1923745286075356181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "3827177373408316820", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5488168361113140102", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7982628452987720190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8140242320379485952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "15615172858007002100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "1653274345637156919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15210302033167762581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "17392347485675658099", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6574971185849732667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "4202645222013675478", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "1231806423322813287", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "166267183356660549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8281212003098870446", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14650273075211365393", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6928835003016610382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "12012860334670244716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "15646774522467486699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "15126660425728872065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 200) },
-            { "18265901700619296616", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1653438360841004980", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "6103824715103416420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15409755591665753258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "16946947983339327902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6431838057506760173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "14705457019471647279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "6801897580177846120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "8656468860180713379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 472) },
-            { "16801553481899627402", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "5339358831190803597", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11732742421854164761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6854611304056079417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "14568560907026487922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "4184442166820068862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "17967188184891337660", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16108759090923335184", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5109770354438894645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4691552892932405676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "7331552952865138030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "3332334993503432420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "1422402723172447295", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14292252222828824305", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18180820925685532104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "16695020005258780885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "6129884455218252024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "13772598362521854438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "9940908487812223059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4753055238892504599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "15803050672115583478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3154903035376733831", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9191832520273617003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "15778834188130183853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "7557446085365037177", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 686) },
-            { "6213353364768643062", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4035015193331696438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "4368522743441422202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "10308175009371219583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "15974241934088373021", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "17254775053427612466", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "447683677378974131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "14244966672894707129", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7946776740333736799", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15496355513574200965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "9239048433297419320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12971833748980664090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            { "1810943242998123550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "9767355861002822967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14211903923555028634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "13713406612642090169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "14923692894655929923", std::make_tuple("fully_connected_gpu_bf_io_gemm", 0) },
-            { "11805311302922325617", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9788704336046308724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "15383553612351941890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16590030963319267708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "10797908931694274013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "14150012830816329527", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6739799137687789012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1094) },
-            { "5389189982064081933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 846) },
-            { "17442035600389810700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10890975553758439233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15713964605078748923", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12409554044517232554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            { "9796347091019799053", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 99) },
-            { "17508987219281192918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "8670512344429807851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "13951781924205611716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "17596685300497748803", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "13206826317378863148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13727585908419292912", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6443517114667332732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "6996679663761370444", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13915749401892931804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "16596028606733932975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "4198666727524342442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "16125365972873290572", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "9040046051053703359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "11918018989601427118", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6714886136800883594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "7312862821818362095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "8357109553923988018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8730097760819044515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "6218328594667952152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3939977982577786175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "14991602704357959545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13814086981499638596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "16146350476627599543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "18112958483003382733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "8507854696766492454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "5556023021504556658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "17740553615487239243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8684867236134349888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 193) },
-            { "13607830451968188080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "18235067315439611192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "13603318842632052764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 380) },
-            { "17243576882981097341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "4965629769516591986", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "13537323999534292650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "6233612563637601101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "10173283505468233128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "3214253333840552610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6478054912653910426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "2458592904274981909", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "9154705094446538279", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "15916505622570323098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "6008613375871089139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 755) },
-            { "6513705142577622089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "1766961036311612128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2862999234347597091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "977617597166653416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17182558720652199559", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "17854138024884397413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "8426489532875918560", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17869697579874327192", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10928995765778560784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "770376597027620107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "17683350638672326642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "17790954200356837750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "10482582307328548806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 3) },
-            { "14349335089732252796", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11033507346101404633", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "13775529405693629438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "9459869325970475576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "2542506456395240890", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4499586349553581439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "16067605128297748820", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "16510194749934323304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "12952160708294444403", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11541706477255587105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "1059505639883914386", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1771663698943903325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 175) },
-            { "17771487895874668302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "8762901342272872498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "412314676462573090", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7367814057959247537", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8728178019712933221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "1192709652314183388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12427490329663434604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "13170031087212196468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "8140094412609934765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "12381377111003298809", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1760690277175249985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "16710651492402564794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "13447028922679236865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "18026468427978643933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "17285699593273891901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "1471837664358450291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9963817056423168830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "13388424034634316547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 715) },
-            { "2780358937598873103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "587350550384936211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12534001599784153836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "12626014184575881530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "4082046235109198108", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2317476796706098254", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1561225943337590599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "14296771090926462138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "10853161782230763798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8390953788659916133", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2310549887200001260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4854802313728023001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 621) },
-            { "11264412030568042996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "18277685132620834972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "5906083739416582743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8707484843981694525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1021) },
-            { "2947753291378607664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "17585852525746136080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "2303141161423252932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "14039055710777697188", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3919577663893354177", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16578265652036967656", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7958459862276998225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "5643908654122573882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 562) },
-            { "6678796313875454849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9259437778054905599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "7272538316511343863", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12245096462203481681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 511) },
-            { "1465692634334679413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13439272015824246074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "15781220232431782560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2590380836212070761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10437861085319472289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "707449835235490641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11473442921040533207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "14667209474639064623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "15984373369388044924", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1486768204660092247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8360628955300060520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "12808154347573074859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "1131384986902172221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "5831419373611158773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11051434650031832658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3623695848220673001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "2172636954267255416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9631481972809246378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "14522844693999581518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 750) },
-            { "12136458184046915563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13115589642140732066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "2654793073145467058", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1967810052096853804", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "14068780861332616363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "6796998865297819946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "3314459110790355757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "13193571607788569533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15197248015210313435", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15911434513425038508", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4534480875955599254", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11253790393313445931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "7472330881076141262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2044363708106765326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "11338906515425639970", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "789359733867650915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "16173557782125372935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "14133509766683767462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15411474884532403722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "1116274074896622552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "7995002764260542332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15380105196319354141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 481) },
-            { "17732250360268013336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 563) },
-            { "1622731194539871461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6623182990939010641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7918742312252115870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "12990341489637414845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "15115440616185035720", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4927139127938739019", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13131740479277027362", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "1081962464388501987", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 873) },
-            { "15882969506682501496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "1362239912535573615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 219) },
-            { "2230884858122788172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12771805545455650546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "2007192658799516915", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "6489645404977288242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "4229105529069729944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "8241070786700614317", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10743138314323119696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18136135457402651842", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "768765852586619095", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16396393355098283060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12392988351482826871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15399245700982979379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10485534959656860449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "13083981648347252910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 511) },
-            { "2248628426797793532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "2498920887656279332", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12864338805958186191", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5124645583449732785", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15024023281204917061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11331539079347079374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "11857822504978122919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "10309504812060596568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "11665313746896806563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "14911763273270477925", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2096021095904820251", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "12010294231983179604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "7877256119877423528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 489) },
-            { "18243018097656671503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 142) },
-            { "8061914949376516780", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11314436000791223218", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "9516102312850256675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "14188045559946481097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            });
-        td.td.insert({
-            { "2418288192668085805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15669490019428002270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 986) },
-            { "3215659303601163167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "14261214737408786954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 621) },
-            { "7336911146060959485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "5796500397424307442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "1364546124782880196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "11062100629646715785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "11234976958917093838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "7058458405375602606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "13654408396081513312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "1593086572473375988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "13387766889016280910", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5966963943739041502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "13267743753217317315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "16431857516454692096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 185) },
-            { "15914512645931208899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16103653667647559851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "17025997656996518171", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10935410906182995784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15749335301736571135", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6362453779168658462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 273) },
-            { "481328129206881674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "14541063954080306476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "13210604117940125947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 120) },
-            { "11058082057683584650", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6750269489578112382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17774979615691038302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "156456996459945842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 801) },
-            { "3219239043521617253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10973647655853229395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "1521992965089360209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4145496852718466030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2317409971670298599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 501) },
-            { "10966081583785531511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13745327504866194229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "390943380079040179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "2999825793036702585", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4692951005189464579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "14152716242882609401", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9905716283229191208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "4860019935631927113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "1835975757316320402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18265020664540913473", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1444256562477852389", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "8510044123592842725", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "10689303050557631712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "390219891876240081", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7072606962946873975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "10838972820886273680", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15682441855379046778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 130) },
-            { "16833854122884184025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12014527187730671229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "9525853014023664813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "14719871224178118299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14880517974968280393", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10990741293315393791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "9696588462876533517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 974) },
-            { "11964639701912187118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "10429613013253088132", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3831261590121101287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "12190841837604350271", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4254313567858225805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "1190134214210434381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "2894138412746654795", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "11378458002317912396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "18337160891834020517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 151) },
-            { "16446533347502650316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "12584692605608021657", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "907233163535348999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11510063368067539341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "3164513064874019611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5298952273692538291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "8382509515623938786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "14013561425708390846", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7801270668419570665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "11188849626443657384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13296566345005640760", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 715) },
-            { "4165920860392215245", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7905503566052181015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "15872143905824807656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "10983344268706058114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "5553176511624221429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "16033144151193421543", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2571882179292959757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "13810716860158972470", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 276) },
-            { "17222005830854879661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 5) },
-            { "16264774056719724826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "1919460437053604108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "12767115494378788592", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 756) },
-            { "13642146548740074992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "9861846661532177405", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7419990519344756626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1070) },
-            { "13660573428614001128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2305706332728008948", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2704063557078535883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "1104489643524273315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "6620782733027313312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 5) },
-            { "4607013085883384144", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2721793280965260548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "9486447779233331380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "12096396455109952715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "15509845164085518352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6525052296614701517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "13709111882513486557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 617) },
-            { "12277470820821378855", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "3475757648408068589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 748) },
-            { "14599150265057284139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "7678168522030142454", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8799427328659766574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15384168056682476462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "1801066876009461857", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13787155972060672772", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4974435385259831818", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16108573960501496757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15184258464890250739", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7550660458541314838", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11367813096511965002", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "9928406318940388716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "11393439616752806572", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3752171257634205726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "13733327241591630239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 752) },
-            { "838825600917352376", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9383222411929463824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "3192518239721798250", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12478914547444399288", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12609361477548272638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "10036998353100219512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "17525531790109748810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "5334566325056222430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "17248756229500447131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13212959214376905822", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "1724898827344855006", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10890538764006500546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "12978004383198641522", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "13991205023798493715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "11175955260573469979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "18166732758694978380", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7727871584058599163", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6171845068913882721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5331173521406046122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "14113510820933411052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "1107027047188366075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 422) },
-            { "6897348673467297407", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "15191864907092681849", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6090625728451718945", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "16569200335969311660", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "11642941943446484202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 516) },
-            { "12825029449351875037", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12818953631784587919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "9654726486719966937", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10158890414412187141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "18140951659547259039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "8367989677286805427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "15953607231296296913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9255337426504113924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "6762862978340755053", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8374345306483326015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "10386584706491193379", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18067353229273804720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "3588791913550955553", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "5047419871737940985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "6078344073564209080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "1172103288112689821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 941) },
-            { "15492793021506324472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "4967444801764057340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "9604982746455852556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "801486567558674495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "15652392678782222737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5570311824197099845", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3701795558556637835", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8369833730195120673", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7103345484511147373", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4412343276595791077", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1596472719837608525", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "475043738497218394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 518) },
-            { "15636407980943172317", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2816982827037092536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "3469963495451100978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "9386678255270055573", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "172584114180442549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "3828569468687251275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1403617451623027879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "18273537339378756543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "5513667102916409932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8104309105061227444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "15112118829970177073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 371) },
-            { "5097818987523855112", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8566695253227825439", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "654821507679356726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "13002723770137829128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8511244943596227719", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1745930004673880589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3603706453982734995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 551) },
-            { "12707748441880165396", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3277243911383750280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "8402692278765063674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "3835286851569826052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6848989271874647093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "15952399564161253450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "12063837066704136739", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12782191856884962803", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1330842758352650583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "4007319206075386920", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1592619919721912789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "984472462878596435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 48) },
-            { "813347941036099284", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "7398196853452900099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "15091825614924466766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "2379484884827231127", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "3436433254188539886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "17997314629342774968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "7334966010680206302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3524702814173574637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "340606466693982406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "544003022213487787", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "11632275875447013409", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6948696390129114563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "4563529605364580848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 131) },
-            { "2124776616364429517", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2946926779445063554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "11240189248024145687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "4494583230309471319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "12218337369633748663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "8104609318998060422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "12707946849050970702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "16587078304821304948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "237302155033013557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "13810995219720233595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "15299926486228458704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "10548792624072794724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "11031625790234068916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "10879183694331631189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15675968397825708285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "3745433390861789238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "6275903692904946376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "1540041682425757361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "572265264921910408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "4867937397499803072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "276407276027553756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "3747518910079195578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 103) },
-            { "15198419554644505600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17073183514200378702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 667) },
-            { "8611417708673038653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "8375778282166369933", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6831045740006076251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "4274801141127703532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "6577754887650563753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "11775667915453535428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "8898910394425958745", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15781622938833984014", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "8035084960535483680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "3498490999014554104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "6065819201836017182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "17870874477143985774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "7873648177300629037", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18134140047840716203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 192) },
-            { "12046638414686283134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10008202802779981732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "954347958041231578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "5871082277006078841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 893) },
-            { "6137405768481559638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "1411786954276574458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "9105388853296359769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6580334406272192111", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "11795686089670429481", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9437794960375526230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "13436376034548670107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "4224423702382859092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "2270733937722366926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "5646139101524964833", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "3239100076064406977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3730238135300250205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5219399418946822456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7227174766917523481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "17772882818194611202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "18375125668176498051", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16091165907421819456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7726714223809300966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13926730608213207277", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11533151357949131860", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14805212478405698245", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2738256633362038820", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9468314291932574827", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 732) },
-            { "8324250071425605671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6579950270997373448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "4381329435655511217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "1426606766274640878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "5953754321266570854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "14827538610133799379", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4920194716156732643", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9740466267717175474", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6755802278188792577", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "4417341352109525283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "8442368383427915597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11311859068168414878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "4437258459981739942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1042) },
-            { "3693042354944382600", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12390011660072693092", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12112853999307505628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12425310792514818973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14792528369891965810", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10058165874008941852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "17331582127656317117", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13492216433886201174", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2338535084014610258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16611452077660879545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "724953082687879224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "954796765467489259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "4396653960950462197", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5825664545247017348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "3087801652564627458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "4624363818743696582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 941) },
-            { "152263592822875549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17015791782274123780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "16831114690704826637", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "17350963651826443169", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7277156316894715321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "9714764457768279762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17559685912375493682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 92) },
-            { "9083686317073801642", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "311101627084421734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "3362190082518348071", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15349944413643626251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10405183426600618231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "15609627722687211129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "14962768577232034246", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "11077876432364512822", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "10322586483496198615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7154364270315480182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "9947693652506812817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "13593258537178247801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "16758962840329202004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "1077224320045437593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 832) },
-            { "9481675228591993785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "2999633429402781278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "2184670359551186734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "17798626036576472760", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 545) },
-            { "14705509109623500235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 276) },
-            { "11318913630213187720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "8079376692609682448", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4585891362157592384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "5748047690737461635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "173772845058977237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 512) },
-            { "6899658518070473523", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9455406830371528486", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3027775502561362722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "3909551222373722085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 44) },
-            { "1006828591724642933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "6767159196241633301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "17281202179589913619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "12136625628940225638", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14253275166085865948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "9875997976286355123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "14017025411515888007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 674) },
-            { "12022152681602871455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14077148976508649021", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "13140254055376365092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17224181038411430675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "4476218615403440835", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11465965972527519631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8045697952241865861", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8109572327736409899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "10085059621136526248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12325592439309417414", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "18280672126778847258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "5406129421969383274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "5469227748156438008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "14725765847498813247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "2014911634432127630", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9835338452418388180", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16912035321030511639", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5701438170070600512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "1499841226042523429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "9823752892549805496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "7915318733663535312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "9101571410887509600", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3499243120652875549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8083672466967374860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "14974730512607138726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "16820082917500285799", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9410125656044318792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "1818433662409886324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15381833359831622179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "2827850900421982274", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11507538232733291666", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "536646811796032046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "18167100055915766856", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14184440545916228597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9068406831482072377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "16190949264253468961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "475665035119038846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "4172485608495372888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "13696782397412896129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6056291179600370019", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "14492935486352505845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4316519748653705692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "12246408434917478929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "16453041919970581620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "14696479950182046016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "1925626127045202964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "16614170159588864300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "7185832253431234935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14004715832115880216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "7157531901512507924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "14681705641267917886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5192552432194195116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4872433441839808585", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "8006738296385794413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "6067904130482758510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13503688893307029975", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "6914775146138105785", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12085348936192462321", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6942622405269419082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "2451712485584835395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "9305957796037500628", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4040607776348275579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7757331094141318304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "7088331918128954410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "9377779605078400305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "4476928353532757380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "1332624116953483870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "6740545361286720494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "17306482303091342504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "15490478608105402679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "9548658329589481069", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13459514533473657102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "5280182001774668876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1142725391726703078", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7876355212013100281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "14435120971846098308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 562) },
-            { "3563614453014995411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "13119479079474639169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "11077503608116183709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "2363414141971004557", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9019451572520595738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2111049986724040641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "6610054713068442549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "13163026305514410688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "6232363902828992968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "6711878663358611849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "6419580456182610836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "7338578624767544128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "5805383505505929391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "13491221531603384511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "12038525298168664305", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1015184966858657992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "11022847760121601465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "3281207855459771997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "7807983899017500046", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "4010329161090285019", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 834) },
-            { "9133263538092913983", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6722358544720547260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "5553779954745929430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13869716373706247686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "169973842603492802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14203061085285979556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5361028467247182860", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11630475290242283451", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16768470780681544910", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14553856088069405595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "7480968533463196410", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13818587810073749596", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12700051513124813499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "18386376129938707290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "861419637283812778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "11333068902248367382", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13219865669259079983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "9700592037514669700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10105539975183207700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "4239415134522959352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "9553032671453999824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 95) },
-            { "12170874893413205000", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "2096779676054335057", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8325686349100774855", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8413117662038329068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2904162348196990593", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17542176922797334839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "3527012447011885981", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "5230406405159608187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "8779947213821605681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "12985650543127289023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "7505966294864890221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "1213958002895787672", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "380316849107383484", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8575296926578119953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "17641033958594901664", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17087740929472936216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 94) },
-            { "9105431502075531641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17163158934005653629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 428) },
-            { "10794662801660960189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "14579042972443651846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "13403617010417893318", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "18242682488017822077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "6149261133858739754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "4185398348055518182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 420) },
-            { "13088023076667575514", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "14910223536998380801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 42) },
-            { "14277843123789500234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "1370827524176794227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            });
-        td.td.insert({
-            { "12293705794290797805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "3034947396960425753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "11680829908738480957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "316225690176910392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "787363431787954804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "17236135174912837061", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6851536988434597530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6612643056203714506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "3446991010350155849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15071888879264671307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 104) },
-            { "1228256819256996416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "17118569850095586049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "16201999154635899927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "6235096928786525260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 337) },
-            { "11493371521058673700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "7179714714302073459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "3106710091841093202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "699127221549844251", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7998930863626763670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "11129224786768161139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "4631772220201098020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7536287105029319189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1054) },
-            { "10412748832841674068", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7385295618478993079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5934841294975212773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "14815498807515058447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 278) },
-            { "13773898185415904435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "16997897512818072938", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "6769243149577568817", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "2995134938466176198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6214194654733781771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "13358283026528078900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "11956435900037329302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "12201437677145858979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "16067821671414842756", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11191071895289217783", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6542417269641204414", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "9226443907548972870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6948606378949354116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "4652308622880770983", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3285688984628545255", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "17396226612787250663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4695182996147218495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "17235360775064303316", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14906458674793172507", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6402941068107243403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12166710900466116000", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17358006976602795707", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14359530849521980269", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5680888227752935228", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "13288543822410746011", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1603703756241612948", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18133334552107213128", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "18084635102736402756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "2820364088001594654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 573) },
-            { "14513925709624513868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "13244693761392741931", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "916389941321470163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "12211848608269437730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2806529556090896246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "1706927777850488363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "1898912620350738645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5849577829817109757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "12811104880512633036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "10736915975072972467", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15047163348308549816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6673690359191617215", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "14274685812676150168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "14335074487552883436", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13019190248083899887", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "123251351612308092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "9318652504803279936", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2345023488044002149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 668) },
-            { "9692949270906064580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6489074577147494118", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8271034912009744989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "6882621854468565774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "2248754661513284642", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6865406633958213363", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14600118619533737293", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "863952266514375915", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 517) },
-            { "13014443130752087867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "3730207439375250056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "17113350507039887381", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6604223938357238686", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2817383483458239293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 677) },
-            { "17692144048680858991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15178327647765537565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 666) },
-            { "7544565739420583104", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8529571293598502239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "3106591708459602370", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 95) },
-            { "16328232350072955252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "13583166868754499339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "14746900092090885770", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1200162031019105686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "4510003738155830628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8057302050645780813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "9389555743403158574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6784146431605417954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "2502125887857336825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "6114147683777615071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "14084855778741260863", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9883719542550391149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "6999530153839596796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "13412296930014397060", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2062195022363480864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10806992251978564302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9352385417006844121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1078) },
-            { "4890932609897686394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "877436308867220589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9796621763733208035", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "484412270668341493", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15662207751131195569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "3336303478756453360", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15183511809138557392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "5733530388090903847", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9574931298183748343", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10995907213890714701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8751367574402839332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 677) },
-            { "18259787991864449280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "1801731858063091191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "6373173636869473046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6012477132351580695", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "16367495521884864886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "13095408117538194584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 108) },
-            { "3020115657931277672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "4941660917457387098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "2903605246599054308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "2238901105639912692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "1671347101986657824", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12274268980330855890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "17079309368548171402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12793908914872030220", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4684985181211883028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "9882204352209412039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14600700464602327710", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1682486914760867977", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5013936351898884291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "8292979162428130363", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2564518461717467683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "13613948678997524330", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12956726277674279950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "919788620883613958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 464) },
-            { "18060514966005474708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "13044020050176766314", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10720782649044333851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "77073286362822723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "1966540437574889257", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3715177305271762194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "16076153317792960383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "12960666483922103702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2552187713769926425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "2264520082689779253", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "6220616397859143111", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10857084376518292379", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15487686565734149288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "6647969101146756031", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12301464827222654105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "5807196005360653656", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8560635685184432720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "9694891301950867606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "13345599888287912619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2511072616914149110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "15890749658785957481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "14386256118128644729", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7806837641999814363", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12962558681443556219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5164372816534616260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "3706994659266083979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "12672995204641007004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "751912075185318190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "14895352662503433583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "3889688816787688160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "16499919609457089685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "11825209936640729550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "4366168099274266975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 172) },
-            { "11962541545116807979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 382) },
-            { "17939745299931100048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 318) },
-            { "2543995971214089085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "11583791752668920812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "14116682822622440033", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15178012823756517910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "14276876004054588508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "15470013032930986062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "7627882727285402176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "14912119584313592912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "1504867045084152953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8488789346759658706", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2446257282140830646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "17310332946322628458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "14905705901815863508", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1553825475921110392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7335403151694644211", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2310159350914289605", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3782315919331102574", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "14128599551956588603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "16614678178197571772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "16805562203348924108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9354818521586974021", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3759057398165607194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13739257060165119132", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "2423754482456771339", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "13565027847255501776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16609136488331186895", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16364899406120840449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 398) },
-            { "17128760774072077101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9358401110755269308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8703758535351908295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "10136297272678091418", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "13065517911798224579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 377) },
-            { "7722090560547236852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2370837049876630969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "9454512817077883797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "1962479636209947761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1052) },
-            { "16392283136103456949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "4438055737691342460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2520734476651273971", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8569122574675372789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4505008254511324231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "8159489372517869446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 892) },
-            { "11599990834682830362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "17825953644228876369", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8885012252853227025", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8484526109354576450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "17096175733187202673", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9596656797750683465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12883021432082543848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16731107540370927220", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7504074736798125353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "17184638213817814424", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "18268811652302076976", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13681462437496627948", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "11091771531609585709", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2599817012641445801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1052) },
-            { "15921072201288695017", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "11258182961445417799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "6214312494103149808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "1673458534805854479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "10944997349682267106", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "14103112843209793966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "2887152687927903549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "2638131332283395057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13017541921351620667", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17626938391567407401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "517802466588815950", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2079476232214121671", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2225233951957105071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "5644068493155655611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5352861363832390974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "16035563519857925932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "14767888121198814523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "8525704362451630717", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "12022980249970038824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 368) },
-            { "1478419046264331178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "5656623709782744241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "17230103497915224469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "17666004363345457085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "6224167817672480442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12144421857685107073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "6581494673640781863", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5461649843950745696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3718980061704064547", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "712420402191459810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "2968094709908141988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 3) },
-            { "11757919563609176713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "7808544677773370430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "15997231252708686870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12924910330295852704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "7499082230554771515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 43) },
-            { "4702017956226464806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "10532500300200244159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "11298638173197050575", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 942) },
-            { "5675497261720118479", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17658152048177750315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "8787816339967963727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "13845827017732177448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14854353557342075292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "8948718883406304307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "10647227605517025377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "7510055418609679364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "2821441037530057414", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "13524128602135083081", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "9707630588260222630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "9181466280310872332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "11148502358361704423", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7959969582538910953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "6613282637922219205", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17739868787095417856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "5609922876429907954", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12028030221272546172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2371412124305478965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12954154886708228545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "4995510103045767117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "14707884854112495064", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7323343770209750835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3292879092145281224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "15592248516895826924", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9400558994532871122", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "15875968032394961531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17006133396401462698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "4073467095502162430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "16044646335477470657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14376192291828307385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "6323026044750482867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "5094419710576598497", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "14599780481362761532", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13085261987388297912", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7463657272687673896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 99) },
-            { "3789890554711038921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3643250372952944907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12070592804878487941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "1208483520611545642", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "879005904827468163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 763) },
-            { "3217246278485567748", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2652267888871336297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "5507708258753405429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "9475812329914836280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10025893052937028511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "15221712686851573528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10892456883214928095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 93) },
-            { "4338023436590582323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "3703292222363446463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 762) },
-            { "9608148784787572220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "4036143655651874318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "7371339724529362579", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16847817828600381030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "15334769670416409064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "3910549475873353422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 380) },
-            { "291868903926685441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13762814538289753428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "12725647706191463348", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16070611944881238498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 884) },
-            { "9910414853336797922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15180747404865201068", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 0) },
-            { "11060822686394981344", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18146184020578260553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 302) },
-            { "5319668297345215520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "13328449155966085543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4129586781834275070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "16783619135298589974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "9649533822873928984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "9593975471009029134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10572208209982879914", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4999505377862312410", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "16124702296533772526", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "6341197991729122563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "14558850297291634005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "1254745727978231148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13283018618260255620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "7720939595094113814", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "16992620579546408448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "2030309697153345387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "13352151930345854198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 275) },
-            { "2690771087990667627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "9257078583742821465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "1208243889917809864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "7494124707566708728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "13564654155363057485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "15160322051545035612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8451212914744825089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8929453032482114162", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "1036010477232750453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "7473012539094225392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "16896863928108200897", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8176012042686275874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 863) },
-            { "11648841195768568983", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13831458435772917577", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9514210061704584354", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15378025640603637387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "16852207712205172744", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15132518566122695317", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "1168311873250200110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3541828356667081528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9524663472084054050", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16403423801823379909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "7431237779891953779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "3430266954211750407", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "9197931868200777891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 997) },
-            { "2344498602308448450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "9451273689649467046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "6878922067845522655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "17242820574559628535", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15452996816194024433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "70244312667395170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11919129623429545762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "17795358440179122086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "8263822658108674162", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12860222041026638681", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2152903140704848574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "6735135795253013220", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18092842590142527927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "5215755301612973095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "4122312805832663323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11619548409913646265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "2108296560864415762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "13026555349791486777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "912423125050985716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "17281198415161259885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2110090486638190463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            { "3240428557350945267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "13491655481292956895", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2343921093633784755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "3148053731303748054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16404059675217592817", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "12160764253455777655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "9034951536385533818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "17377315194963069204", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "12756432707088842236", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "523055954326631884", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17850932752450917677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "14973411884734235059", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "16229324496308453344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "10736892779278378335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "11261619081095309088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "13368477378531148593", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "5401523175111660554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9802832901508552733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11361013180071053597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "269334626439013799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17970855913877771858", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "18332090297993015499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "3665837617379468265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "8316848551837633169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "17807033661138518449", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6571473790090353005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "499739705596245675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "9761573038170759563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "11830297960718214360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "54975980454651672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5603409300903611279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14332388011233886083", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6673753637296082820", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8528886126454874796", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10946069941293798874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "10054253863699485503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "10690972785852373520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9416285845239621878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "9042812985530274425", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12671153706040443724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 53) },
-            { "12705054744767500423", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "8503207028307570404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "5049534591553232781", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6456426339461437148", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1289009275012699560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "3965871278597751318", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13744951984978188201", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "13728180355108851541", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4524347845016978037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "4871907623235871050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "13059207969254830451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "5011273172385428756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "12283317230112506089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4481903208484313806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "10175721494218314250", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10432687907685994204", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13614921331048223116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15447513376965243034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "3041612155708729812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "9765339420071627045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "10660230104888153758", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12386930130408773521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6706491729783125139", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12675858428585873471", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6293403765897901528", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9888097487468905169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9416186718345824095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "4149728557142033774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "466868648178437688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13464226348405628455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "7282751412088726760", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1124) },
-            { "14270450799210365812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7518734167761579102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9854440591497995284", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "13405310261845268772", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7715520469947900684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 571) },
-            { "16408015571155576773", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4783126652984096700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "13388004363210658650", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5170245731599664670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 252) },
-            { "14256842018830898376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "16114623916610925741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "10397253349562394184", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "8007667797556094444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "7368916076070115064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "15129834325410878425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "18417880214901227799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "4722824701199486161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 107) },
-            { "1033385936344875354", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17011927973643184196", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15212317205888563836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "13802834658447955377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "6527268791835193134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "10918743320372308981", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2737840613867456953", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "269829518575229806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2944333966072327932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "10670103699537731664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "12744887771237881196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "1242366856673194709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "17753585752923130911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            });
-        td.td.insert({
-            { "7282595712912388754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 189) },
-            { "6985970932645412773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "13192808619929896995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "7930154826818165796", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17994361454416813294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2150326211917340956", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6953478877896677022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "7134654288295280046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 49) },
-            { "10607904718265020949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14719421757340260468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8008513163448840421", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13221156296791499146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "15391215077224693736", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "704262295684441748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "11455732989503244360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 216) },
-            { "18424400171776141118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "4286652913945761799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 718) },
-            { "5379608399492828685", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4614700272179482173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "15352245788978088971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7441139786825555264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "397770940444464146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "202304354656398848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "11962382064404466630", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5301440603380967612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "12018398218876712811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 674) },
-            { "10898684230183205955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "2752322006160986801", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15660316437768312006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "15668791697154389130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1139581213977408268", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "6649759230117795192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "5244441996055494170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1113) },
-            { "9263063714383940562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 62) },
-            { "11070696274716018686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 570) },
-            { "18068050257421269408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "11207257238719531888", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8146906136296114696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "435261825003875448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "8922463054055280800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13674246753382740056", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14189775376370027482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "8254412626112343365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13596494923128445274", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7085416207166146240", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "10320711719466983961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18310667924071639899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "13624106485902414324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "18377298651236993830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "15566108481408840783", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15225331270926229394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "13659291428095454839", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16932090423428476170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "1882912836250239503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "10414903047695486119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "3442073007560756473", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "3609233164979051271", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "13108356579957761944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14823616678465136590", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "16027853591907232537", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14446344744130895614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "17924819398394001587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "9622546530872848323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "1608378717397996752", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "393884269158067083", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "14903430454784452446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "9311802150474489673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "15293727142789007900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "11079710960007068860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "11815825155082424936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "2367791050032803116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 371) },
-            { "11868789283464117390", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11207578758583923357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "17368161816774674256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "2490155559809645659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "4551182180668229945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "9001645663675631429", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "18191573176587760698", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "6027350558532160900", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11229587372764249222", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15838058479520696173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "7318929661124340248", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3177915003579216846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 675) },
-            { "7052552351421332490", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13176385389367548697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5589785455223385189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5163965164859517893", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2268291720177538378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13205973783895006074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "12892693137085610062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 362) },
-            { "11553355518677163509", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "14108113294744119367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "4161141078006269526", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12929981792125924963", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "4673618329986777239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14287890401250603057", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "3448477246688526708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "18172711677056449158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "18202222342562516071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "7678457226823073886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 91) },
-            { "2532962442388536022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "14433662482531248989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2335428826699999827", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "82249723699159955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 625) },
-            { "16547425454653232058", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "15851356529373376076", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "16613907066461513431", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "11725629762660987217", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "706370730287471796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8171897258557801015", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15959241441689395955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 680) },
-            { "14585370009659482450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "2261453441277654139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "15838114628203742383", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2399812257701033542", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7962383460496540840", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8127570953237266335", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "3828988304073539836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11307531462784240962", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "14838067105091112485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "8207349115037232863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "4790599496008369129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "10358359789382196576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "16073578125651112218", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17405865057155583042", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8312903198090907576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "10173382130572498594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "331390460560782085", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12353956380178079089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14907097142953816744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1811357700607919311", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "11986642867827682648", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "14686278683380845546", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "17006095064160484022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "11114015660322254541", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6420851258772300332", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "14793709237400480942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "15823825508128158158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12569856169024791306", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2001464747481073870", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8863398172720091880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "15148625184033310404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "10624246057883518638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "6730474465453860479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1039) },
-            { "10073439287681954518", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16461809076899645037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "15947699374684516369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5448537627319798272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 523) },
-            { "15465799788109255561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11757953304204716753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "1306339989221885682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "3198726093355425150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "962311766200741205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16728826595086368897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "1147744092130296563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7146559117784312265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "388828310152538138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "13073788277284969422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "2305461098719675735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "17521647426452186921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 276) },
-            { "5433618404351968121", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17794162443307839614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16440598510199834213", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 121) },
-            { "18009765676050504407", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "3509811595028801757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 131) },
-            { "11855070245618904113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "1109243878358317937", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1062) },
-            { "7254869458810021127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12615462894236933223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "11926378988530133568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "2930545263523345204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 542) },
-            { "7630776235327261710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "7824524940405130010", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "13787118639037730152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 298) },
-            { "404419072921281472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "4135003545872878882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 197) },
-            { "11723735945517472199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "17749857812061795980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "2287356884312581209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "4101449235783342476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "14385181780082014495", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6013434489252641471", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8175595372513695437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "15092483859565823523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3503236715353689942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "10831460252334010668", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14681717813022425567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "14898892437285105327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "6157727013102138824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "9823997593704517392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "3223726179820717808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "10033076377998157101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "2571778193407799664", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12668149981216388765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "13769943652297353544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "16031140952379208074", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6128534975733321186", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10273183900108661041", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8316011587868622301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "905780459938651623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "13793441296561946357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "3218248162832023196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "11907507085694711513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "2004120786408087671", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17515573322312447679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "5162737590442940024", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10906417366145323499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11992158790035075804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7606097739225472283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4553409514380460123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "7753336153932360422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6549150139619174585", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "11327097771110264965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "505102470055903237", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "18233660940545931789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "157852787707383962", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "8909239203149651260", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14537109978413728476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "16290626406346691996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 767) },
-            { "17420288204511371476", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12570087709404311189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "6210483922262161762", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "994182747184593564", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "11883941040326858829", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 554) },
-            { "2324120381399737261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "3199841714087553410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "8132521728369930959", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17303981366934280174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "2597523728660247862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "4127717437639868970", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "17981604038340576961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4301372734564127254", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4285475880886685878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2086001721804797157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "12179581684777023804", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16184979150665364486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "1934379409955686502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "11655994466278963438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "1945630503883822822", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15232673324549539143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "12952980509662451384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "6860503758000008398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "6661117204204077150", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10384416235770656262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13716836930727272782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "3819763245853861272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "3007637520820789085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "7345632855842905966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2571186327837339204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "9194788897910888066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "9996196793804333253", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "11246470701714560770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "8212533074856783509", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "33889407315234685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17242442529374722270", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "7496699438957793920", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8375465895534833097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 718) },
-            { "6476949395889340429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "18187262802267413585", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "9454146598828084176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "4241640917176830862", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10446500827044060319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "7908036427091174081", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "12813978452097969536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "2012181953284568566", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "6948147789605707774", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "18159049252673770569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "10904228118889057467", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14266210014132784194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "5587539329568150667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "10098661517988566506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "5519244962044894877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 597) },
-            { "14217181622713951411", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11777373751892075391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "17575293085957492821", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7145194061073256844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7243161613448507792", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11559360678008060513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "2056597791109604534", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2873387231297790075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "4243114942173293897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "18232408112396439386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "14335423820860953927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "10947686124973711385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 55) },
-            { "1187224156936080964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "5759260743809103651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "14759179293743468995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "16622402936526588344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 726) },
-            { "16541722316343690197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "9061025737181218101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "17104611871050967957", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "670951751279091662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "13133323947490009546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10424278617647597641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "6551173574001309451", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "397445657349822499", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18251360413872841969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "17016846635668370921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "10898210758890334465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "11684927349056930189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "332090597573908506", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4682428771166816734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "18006581941186887676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "5245308722062496788", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "15661322183507404821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "12773693193167844110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "14634044133573461949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7714783879762659458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "9806689250758752070", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "18005721959893562716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "3166885953206195915", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4574242607119408140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3930314908786112883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "531020979837645217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "11868551452004726281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9666426531743983113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "12557015880639217508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "262113403359175565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 419) },
-            { "4634475069086874260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "9397711809671506538", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12008952324872799824", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1907439276166837309", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "13314092088416047551", std::make_tuple("fully_connected_gpu_yxfb_ref", 1) },
-            { "12081835728078383819", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "13071064509662090710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "15928746165235747659", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14546281065004619074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8725673763972618034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7819934200255007163", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "13051342120933385671", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "6181308879301978465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17664704673433112966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "5353170440534073482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "12214162812589030126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "6093575518270471235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "8240616667079698459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "4600261954762222519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "7070374681687005676", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16968664807495872526", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "18404344881797725263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "5267143428977695208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "10700011669103135203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "7811861756798601201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "428659495445490820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 925) },
-            { "1056494963618130644", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "962676948282027870", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "5597908143491399643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "2788116002380533417", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10378966564497668941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 283) },
-            { "7086574330273897976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "2732519635571994212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 987) },
-            { "16244270858428653037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 745) },
-            { "11970466555294072275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4586633477264151844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "14733510474010040334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2659712601063515059", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10293186062391000719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 755) },
-            { "6547565989244888354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "218477594596081189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 969) },
-            { "5834006438103071406", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15649927926091502215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "12461575861709234385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "1592994755823247500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 594) },
-            { "2526832080529662683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "1922168904767469999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "2809950092498355574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "15718011075217705480", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "13485140643204970345", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2664944425727769475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "580936360000782237", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "12314918602191412697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "14990645740260870030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 846) },
-            { "11341771589317480665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "6133854782246597175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "7394848434332739139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "9937387440035377216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "11804035561861841621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "18245935804520236353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9352866803638271156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "13324157125165576832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "1894591633696862066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "17580933462801685507", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5408469943982199754", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11913020016435860608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "15260448822338206631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "12492763342322011136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "16758697697363920520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "14975859027256879948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "615833743936753727", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5419775002149092646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5982637097503543357", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9025790715924779508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "17078700948595127028", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5801429077171542466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 94) },
-            { "10662239532841666965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11049130623091275457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "7921388663815287395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3811462129131022619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3555204322491340337", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "509781001842353609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "13047793996728441528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "4047806462440750215", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7524311370696987092", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "12518571127411736885", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17050675313067213312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "13200151444914751729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 508) },
-            { "2802810524370514276", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12248119734016401633", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "7671016314869993705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "8054562515577756499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "10732225577823701543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "2836903620603494117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "1650080413259413393", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7864880361674128748", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "15123868617509445149", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "2903075619523363020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "14211549589070739656", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8749468546606972791", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4840004190985490064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "148355059345569721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "4304943753428518690", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17318287523550546026", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15364374265752682266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 894) },
-            { "5136111979773513341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "15667487381692577290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 878) },
-            { "482564204402769504", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5983808817108775912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "14849708746319190277", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4646795194660982475", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "94012300876418257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "15786313441300512560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "1895945774251432343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6512006285490280576", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14026570177552137240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15890473622821659630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "3565702695809105495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "12610854610554906160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "3895088069642140043", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2100387626452428743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "1362540464632328798", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13012283016751495099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "436514945529747349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "4191326605459754690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6719956770229212208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1094) },
-            { "12692563384795319282", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "5933743119393822386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "12523676912856063091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 554) },
-            { "14744368497944610864", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "868177350337221377", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "832976844701988460", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14034487492239603874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12669547093826826335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1025) },
-            { "5947492124433175601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "13276867073526485069", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "528618206870447012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "488298169768725160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "7426788519998680898", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8961138963663532667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "9803306661531470015", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "6476480727582657308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "16774728502960825097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "17419874083634480896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "6517802281521111563", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10652512666086843369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1452841775482537260", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6204725118764552662", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16285256723517297210", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14852990574796128305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "8550783999616052522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5420766967862917815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "5733701901687257088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15860915170591763391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "6089202061701179659", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "16443833779968719790", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "12812685418923919055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 764) },
-            { "13224814158106791463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15888454525088587794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "8116504545035982006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "5275016494706355806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 832) },
-            { "18203935818408469865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "10408322429232132983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "15585700465988560560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "9127066823698894015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "5961488595080209440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4665029580355133140", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1939140810847988694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5845969526791988973", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6635217802203685464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "12307446289692143781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "5251771557248725731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "13758938418512211194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12700008320838073774", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14164778301660100413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "12711558966638028352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "69439315851965666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12522364636280164681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "18369668865072009928", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "727203296169504486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "4703107905652287491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12129572274423886770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            });
-        td.td.insert({
-            { "5214678408335388758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17835134875461003221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "8465142022921853516", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15192024816519005250", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "11599932445375240727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "4601800315090684242", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18382226420077875582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14459249705747952583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12411228585189337571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "8124736388338424498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "8995892222116060827", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "598390166442977699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "15320845027635796583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12310462218432530363", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "9776332064497085361", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9993925424761661218", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "17824431042110985323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "17001492460236540325", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9454457647272059910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "4578587579993676820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "17599383258252980421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "16113302464937833403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 655) },
-            { "17825280904760131680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "1999892441424036372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "13074593348097634731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17392732266843821039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "2966185891283165994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "14566257978356851712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15783329079045263237", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9547451431091729288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "15149336254307320187", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10971070835319242371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "3961000444895975975", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9513545197321447870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "6980201892073961793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "13031027103925431505", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16583563382485459718", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4858337483345561292", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6536333665377249409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8374409021681741916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "2307629242354292362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7670176887560273910", std::make_tuple("convolution_gpu_bfyx_1x1", 2) },
-            { "1847170421455825520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "17407904982433770732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2460415719642436412", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "7877332346656934022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 678) },
-            { "11437885274663749440", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 806) },
-            { "5032195346490064156", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "18077281411861416889", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1044) },
-            { "7527175223662342321", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "68637843533109734", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8501760360687221821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "8906588133431586825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "5890599002797783437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1089) },
-            { "12232696287029987946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "16981010901052181199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 832) },
-            { "3499109651698979012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "13636129806349817264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "14900099988131599740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "17867620992288101450", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "621272125402238670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "12408889192918919210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "13497225521878034159", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13155901262605819372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 292) },
-            { "5040944983588288886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "10897622326486559468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9065894438656900887", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "15356995665520295246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17907732260451873185", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13762042713029963144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "15365628642332393565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15777551868644801538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "4304041922043496030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "385046297070779752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "17680403286850504499", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4833761011498696645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "17601171646153308079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "8204962103567653154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "13974740392602492680", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2712946943923358377", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "5367634698951188749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 373) },
-            { "15361186788588226064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "95993272253183796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2173649669339714890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 653) },
-            { "14355612297330229277", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10888435127006141874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 645) },
-            { "17754836801944078461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5608447459568229694", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "659846949368492111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "2850118175701764737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "17093159649157277089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "277410555520090949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "7975810844103449438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "18218631037214746168", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10612049417873776481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "16884396694505987920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            { "13191096881934434519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9987939079053625302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18341524156838963264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17784882947271841103", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "9751582946441607796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "7941729567451949422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "5994204139128667921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13367043015761260275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "16037141448095945650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "1545105800386716684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "12983461576274227638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "9747165558500755104", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12793814016409887162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "15653223776766070604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "9194441947620820715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "12421707187947291166", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "15471470494305051299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "10702234389482091891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "15329084374930297871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18253784177599134876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 938) },
-            { "7509199936979430017", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4553508439536472227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "6638696743420807294", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2702144517025248597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1720057192283799086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "4542143431130171516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1078) },
-            { "6205240287062600210", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13809218391763818477", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2129726780118554358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "9261867808456596636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "16568662638983972991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "10323345824599612614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12024318713420323349", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7831542641855749925", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13356152596085257346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "10109431802089940590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "10398572248321217585", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12584870629297848143", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "2198100074518629980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "1552088062654417187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "5485749317130402302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "4407683781177409314", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16747069131271457481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "534032316469702287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "2213068950786625268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "17400844732252600825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "7400370437512056636", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1436830013293669148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8243230863677884952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4750897775273897282", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "14639233649574991406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13940433448128376511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "10127598593949337541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1056) },
-            { "9660812093766156608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "4795705973706796563", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "13764532551476584909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14908665013877276517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "10795104632256101599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "941829593638869991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "6555440973226014216", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8616686489737649890", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 93) },
-            { "10377729875228238588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 908) },
-            { "5495063314176654751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15595549493819416194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "2032438743863827309", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "17303584953298149285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "8036592210244553232", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1089) },
-            { "15550722997950669458", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8007491455800395118", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "7354234812009979811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 90) },
-            { "16789135236017252073", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16706244336960642883", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14384062335728088286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "16202841384048331166", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "9427999492792081454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 128) },
-            { "8469338060514215816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "17832542092610191859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "13291816522762326802", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8104522072297740079", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10127626701775288565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "641417817126876622", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13071545223094862275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "14799589725341253463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "17977676737774695825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "12906669887096343446", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17966517080605659454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "13663893159182636270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "11086699387784339943", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 495) },
-            { "2618108630886857741", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "17796867588410764794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "18395970344992997862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "9367157746678824712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "7575634241190730697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11446181888102710561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 198) },
-            { "6085098225080533278", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4200340674281276565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 224) },
-            { "8335501317577461610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "3991584206721185508", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "11292995457386147494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "4131527916449986086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "7505608160068471520", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "6148794431848761670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "11571049833132558023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "52089503050497755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 899) },
-            { "12617625046664709483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "17130630712943165823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "3653156933813711765", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "11455518069358829249", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "15240660399630429406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "15531908897773912572", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10771178773821148370", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12279591818557049086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "5290935680520661218", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1097) },
-            { "16691293834516280510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "18157442326218165947", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15379873910046172004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11345101652477732928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "16431165572426232677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "5595802790436774398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17267132595546153629", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15887484617041779814", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12052225815821079044", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "14112695611389738149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "913496537924971856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "12831670701606794888", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17778706153204631930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "116291934148608396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 235) },
-            { "9447458159095730492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "1334121138243951086", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13939763360217628282", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16303870101043861053", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16237775310369180101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "11421235118459218209", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5033753554611312392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 186) },
-            { "11269720109905550213", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "7777333052643961206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "517601465150912854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "5233164031954315264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "7303492518741737111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "4134729533276761488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 744) },
-            { "5397783260083330774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "5222741986856655072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4186140878816408491", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 125) },
-            { "9573589861499897842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "10987953316324712538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "5766507688771440170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "1594612401422787491", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8623022306922454565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3237680963342495368", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2446435710311724460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "6670327979947471550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "15561518067918160695", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 248) },
-            { "14711697456265712456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "1852269248476496933", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "16001665772103476029", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8757900457181374694", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "6902644989079870993", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17758354062670710364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "17464785726466943638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "10754321688472707825", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13993045680928507594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12415368596357091523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "14749947225382670869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "5335250793358473555", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3037042229494600258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "16021335552443492452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "1469048759583678106", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8549811622247170014", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "9816834679089152140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "425744529089575241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2054100643811117871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12700957546822808929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "18020588962875998441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "6343396486660315308", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4272417312859966238", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6531171505861182429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 383) },
-            { "3714179297375678368", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 319) },
-            { "89439319782574517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "498221230041656321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "6407471972820516685", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "17869928048344193660", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "6439778526899109398", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2881475011209167644", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "16934386540875904239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "8129414331584785189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6996376303337512293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "3244402155461139559", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17602686382249457351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "15374625876485618845", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13083412418930786217", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15262493122847269333", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3291900073868076610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "15993651594402422200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "4265991006340418914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "6080989915764831447", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2649948006897488504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "9640773327221702885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 834) },
-            { "3557182643072772598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6962268765187856246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18402875771862490280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 678) },
-            { "6057433908801727873", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11828522357351010810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 45) },
-            { "15245792492785141641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2668985670745598382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "14046114605615338907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "16642535448111764945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17366007551797367227", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2470579932413307757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13480393611172760874", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "13414375996946350733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "10118395047539851751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "17399103575103078835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1089) },
-            { "6642767323474835034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "11718418772370938734", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 843) },
-            { "11461581290174106570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "11210371874006224582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "10093371683053539916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "15392077168521832549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "15213473731205734586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 892) },
-            { "929378940515745198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "16306284020664131647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "9140953654075340568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "659150305191479097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 902) },
-            { "10186942318345695432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 648) },
-            { "6062246008880097669", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "11430400968543668873", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "15456771485750114116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5011190083565902614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 372) },
-            { "4479117540570599742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3768977479127609228", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9105949910901552052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16195252193236429176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13898284586432291433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10726830507311062380", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "6724516766412732606", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "16958661630307271135", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1187622888238643867", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17796784393519192261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "14749290801006453098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "12963601040302529291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "3644282167178264526", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11443268857010762276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "1781619247831135285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 305) },
-            { "4424258528650299664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "1996860183441418841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "3291180926381314705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 994) },
-            { "2662628817605495834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "8641167903508739082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 618) },
-            { "15247278167909654073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "568023964685613279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "17212292336626940406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "3202034075645193740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "16355518852513270001", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9172445047535982729", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17257466221539644081", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16511261203374835334", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13379165253894817165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "17845905249343189063", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1676419079398771261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "3755253206085028904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "11696708134796103802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9756049510998074315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "13182965457868586949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "1474719104479956715", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9464448984918455020", std::make_tuple("fully_connected_gpu_fb_io_ref", 0) },
-            { "10344489318472060767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "8107597524360102037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "16349083818768061549", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3861084063403560668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "5782934278345953016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "13787436604877398090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1036) },
-            { "6534932244936310237", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5254115874873721374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "10169992769527680821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "8320522112821700316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "9399994156762372761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "14980327142253281498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "10995849055789490935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "2430404993947067949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 418) },
-            { "1100681675092122613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 456) },
-            { "17829148383265978140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "956022649859563080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 630) },
-            { "13610246822402943068", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9559533345689069514", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "3429844423226609965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7601006550805536675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "1889171157980977747", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6493509887452943215", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8075180350084516696", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5088898934670078153", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "61390148213644186", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1183774022668948480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "2294026590516781945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 943) },
-            { "7969848911698660033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12494969618927201911", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "2740834366358352617", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "12156683064218448087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15581678976147496970", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "4332002982390788477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "7844764086278702374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "7650874310714729923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "8484380699802533068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "10900962238463588974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "7394217382008802567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13443130482173929700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4307817040832953223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "15975964562807570772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2933183897022161826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "11341287517759485930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11164600098693999456", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15718782218800307385", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "16504962609450876148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "17788367809717898285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "9269175963143039426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "4237276338897143680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "11767263058642131204", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10295330953350618042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "17251021943762069083", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1249137685908951501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "14406070210216948643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "17729546848373991614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "10205929431600082124", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1824009696938637196", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "2691406689892290663", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9144136375141111897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "14702670413549232065", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11033758130987285174", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12696412964119109465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "609926704263171728", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "1312322903335525510", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9241243727411869340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "7576873892262851401", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14936045362442728963", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "16628679902327485435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 730) },
-            { "13112861120841066430", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "11810221946429451169", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 0) },
-            { "9974986004361966590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13775683667344570223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "15696910741835640150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "15170578644807800052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "868827643007921561", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12361848206190267821", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1564774057733793087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 97) },
-            { "10354305663463607086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9172699707430374863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "16362139250976572928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 554) },
-            { "16322719022997791344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "3221221905804708596", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16853250891250756537", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "8146559042269976123", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "18009083375897554008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 279) },
-            { "16482301217529090205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9246213432501129631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "8733109144496806085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "190530884420224257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 998) },
-            { "3021451990778420603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "844278648549884313", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10286228358844791913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "13201854669827561901", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12184558469694708819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "2497756607567197523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "3803179179802002296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "13248218293365141596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "41250455178236256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "2730604806511016352", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7044087204529042819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "14001920054473316909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10093554313775878065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8108939799996498955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "12503605837910457108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "1452597292381229708", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "32035190068479388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15971924211584724882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "16763335832616216769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "7196214243890296121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "7102173884859438914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "16896434896068867157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "8860815977851486767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "17608288706234084973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "15642549417953837059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8484176982872847423", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6643161848623134458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "2794704364476462562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "875142032423622622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "16995873636564597028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "8108843303778211282", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "4593862318851730430", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14463983770858421738", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8291770994531919371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "6538694526777067399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14484890926084856480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "12894625941923144893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "15963358868537664345", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "796900095669815456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "949330876419581703", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "505027953105355818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5573639264204952559", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 501) },
-            { "1106762955109168526", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "16632447105476661928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "3170274732463232729", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "88592091379585141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "11976258954756052550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 894) },
-            { "12159582810513550491", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14514450640485628836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            });
-        td.td.insert({
-            { "6471563320494376693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "10134708781744282286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "3006428377575478529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "6737332058785771073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "9868561386826862471", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "4660214425505918397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "6877976003072165363", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17516369849823844076", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "6789547098653828902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3003526572122876385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7595481705069674721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "9805748332775912215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "16580523689587532278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "11407554707582995190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "8358425189419823078", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "17784357412228522825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "12916369918132790013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "18356980026934328781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1037) },
-            { "2452226948562393335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 767) },
-            { "12819626280531787705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "10231289519907741812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4157063588837576075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "8751967016877067287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 894) },
-            { "10289725524396556967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17443356777503458523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "13948512795148364852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "5951936376654416075", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 1) },
-            { "3436770797199367854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8479958930889587809", std::make_tuple("fully_connected_gpu_yxfb_ref", 0) },
-            { "16169024543367503806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "9323825370872655346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "13140527131098422428", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5167141379778311462", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13761566845514364807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "2597453794298356435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8028456017016080468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "259085394007031207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13959998803881264899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3686062608868674589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11462462742322068863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "9988801796928462423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "14727155647330710270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2415478259408761142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 302) },
-            { "14602509614865844486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 665) },
-            { "9289375071420565548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7440546908141206022", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15485011864326008444", std::make_tuple("fully_connected_gpu_fb_io_ref", 0) },
-            { "8470783908138180217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "17845195044080380488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "15459849799278480779", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "17721709435558297965", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14132860735060026066", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15522785615618973614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6983544541444063131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 423) },
-            { "13340998273773542342", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3134642518413656360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2440366541074371090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "12341291953192305346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "4986977887030495943", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 433) },
-            { "16852690434396099861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "3526198034974948081", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 276) },
-            { "16053585286807864356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "4282661608732125403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "1882052795393187384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 670) },
-            { "3273748387141431306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "7617773507561261623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "4623542918584461522", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "13459568779083836506", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13785621878621289403", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1980887257657896260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "12809199739984715013", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "4886289616235149731", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1898776014554946000", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4770478662275293849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15117830538655814853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17178808153714023980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "1629280013296592298", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15110359240685619357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "16370218798911151331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 287) },
-            { "13663612869789682704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "14423094456821270228", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6820284286806022849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16779678846332091086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 523) },
-            { "15989730594386153813", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6095158932103797740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "11215217005872946038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "7399775379344444344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "13381833588713493653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3380653500106294036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "18125732229366977468", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "13613399861925108148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "9981938305144461962", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4519609440668743423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "15097371415144491976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 640) },
-            { "12338760476079493547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "13933912937625580405", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "17126714253919198029", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "2341006744107937832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "9819596940685093690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "8881135571874888085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "4750755523645265967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3063055767192991776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1017) },
-            { "18178391985193947355", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4161612746310931789", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16509472637458153234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "11641605357868918146", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "562221645849170027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "11561790484526369917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "3658149289395969504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "8818070832398055086", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5509631031571317557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "5357531127711906072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "8994777547915132466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 834) },
-            { "2687781952021151359", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18083041911869525296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9876098429582714576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12466721526829931923", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10848407542826653699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "16808618754363181939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10436819182310112786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "7657964685067862984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13141069720428059461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15831600396403741571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1138439260035360722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 547) },
-            { "18184154104081850641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "2338707843044884352", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13850920989756588064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17176310030469904708", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "9146427497025645310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "11291881629276762730", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9850711648349010674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7172604084103519563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 994) },
-            { "700717277178942679", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6827316954140278736", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 125) },
-            { "13054405729329143152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "8509941319309380587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "16488426854651696706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "10432925516327889351", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10600040563032392126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "11511221956203704038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "11469881811044037340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "13839590781642269381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7508931961595339477", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10500029207807372735", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "14330281759626724494", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7419216766190700536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "5585398540591396124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "17089801601582809764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "3404911902272307873", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17489420766684604600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "18196676408993954972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 695) },
-            { "10186866999254188246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4817953977830392054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "2930702812469156271", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "16549498607618849252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "11855777686733253894", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "4936968239673204144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "11988463489006787939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "10178951466584845110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13326233188936584240", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "2194607895573544953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "11290558687608213321", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12366546292695084543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 456) },
-            { "11267742746905371769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "16582080251500644069", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18113235498360281695", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16851949759898002809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 648) },
-            { "14233388108948021331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "12434799432980627966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "16192971634546462244", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "4652136280940317116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 740) },
-            { "7744644472305197412", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16733587306017341904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10089588313551601914", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14397348576352573007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "11823106525249133834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13122637768866153753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "10110359677546019738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "4342360467977736802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2937907409658060025", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12312291300513951124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5989664002046950385", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "2346855978590136528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "1372939511728986224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "6491244517639245276", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17025268985366223779", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "7076937538747704750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "3971456598769336038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5329218407413679209", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18171940644650760608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "850343942782057099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "8121179472578287280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 5) },
-            { "11215862132334892351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "13453226687921450129", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1056009037551688122", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "2816353973187452604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18273922178875123753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "6904130543085920483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "2028273519579688266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "16266491618150971928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "6578908625437515675", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "6233455595448276342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "13184662326021747000", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11185041745377164894", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "4887402175773881313", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3192332625020432602", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "18259656768460999562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "3086110559166474482", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3234567405788241673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "814227839929688672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "7565221050911842393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9942726414918759892", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7771969115805231266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "17622515300258231642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "11806105193035393795", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "17715553891959228879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "11829442945690098558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "2103882464623009432", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "4488336106517889531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "13320828013530046693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "9141802671320572984", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16170237673140354764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "9933958860597451711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "8616175124735896626", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8482147530539941792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "17269318621094624075", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1529658068204046700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6370189612027110022", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15317510501392280831", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5688478347124565305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "447152944190888653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7817036102984218692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7500192998744460131", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "14606504543906913119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "3930526618478171342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14429081455612806819", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "10455850115486014344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "6458124573210430792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "6210051945051792519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "14025496192869856801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "15451193085395494344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "5163641718529821203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7104756264011682902", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11374410888638324212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "16661248688859994717", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3518981281605476136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "628191607060767879", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "10413043556440687328", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "911927861489659568", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6561864486643226753", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "17494823614269622175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1031) },
-            { "8071652278387309042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "4805958162773855302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "16666383605403885590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "1410512481031922864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "7033442247935655919", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5120466856097219243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12141880589558027223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "2328698995040390396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15410074937424854348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "4195847890935259046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "3923715765392385764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2348721939771018658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8500612796090968552", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13695012630130671371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "5475537064464968733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "6914536960012332706", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3242468066266096173", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "8817624284607822971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "8453402620168400406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "12087141795291232248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10416622008071151225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 546) },
-            { "5934211962000091180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "10178462061836778766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "9810703513111623136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "8870736106637803783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 43) },
-            { "6040286126398028933", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9628702542543622433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 567) },
-            { "14845194064376163156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8296551195150971668", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3436576388124386308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "16711955423531846725", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "17152100243867367458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "2281119269283845320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "4614042998549572181", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7807168142899312025", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "12150109996250730485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "13553045975561262752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "435888248913413834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16683909937519981313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "14174888981602932979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "16352331970945217438", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "7441199361135503715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6988674007771237080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1091511312740979158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9134203155715293387", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17089332981370803321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "16434635675895599016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "5186963188234940985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2683507674615735878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16951050796024922417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "2842103889477438816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13395074742046717601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "14284223645235602230", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "10861525139715322534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "13248567106128518549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "11739629316219263056", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14797994820826922836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "1743572310914695413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14363654136811880073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9579316322704307175", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10131754493574658838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "13273455049742872922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "15085980226773631346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "15325810055037682679", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17542414935564676110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "13447226378200557777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "3075961585045028347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11851216776536423298", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12251901229904154127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12716923819769400487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "3438852523146175580", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3638987901025418036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "11856266545854830143", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10445587307296180364", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6692408578556372014", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16053383948025511837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "7703363154993904399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5632101951796129342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "3666268650646000870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "10551742525038893508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "2065752819810364738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "153117141968471446", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "6313048719388952335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "5981885264666023260", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11462394098346770463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "1698847067049584068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "4046513842327685203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16181974394948732584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "2431427502927207912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15119063070382146368", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "5023609284081684300", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5797545757863100286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "3853598651573655548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "16036386660666696362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "17332395907621747512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 658) },
-            { "5524218746051008792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "6981537186704688907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "7162701010394257343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "13383524675055536682", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4099859307693687554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "7105622384646913935", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1908733355560815063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "12278842522836720245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7210729932836957540", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2239948568632407776", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8337820318779061494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "5312140481706133684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "582386337144876096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "4569416043426963318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "17921616427936768657", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "2354885756165078342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 834) },
-            { "11915835787294686201", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "11588201241814594642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "17171513366028235799", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1313038182637545943", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14066660382918185188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "17810119189318801197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "884923290083082187", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2786925522916317149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "10701231567226563098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11260588538207111217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "6048964584602891448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "3256940792095638732", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5041111302824362529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "10156210866362845661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 300) },
-            { "16482763280295827563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "13661225837036677371", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7351733901977025859", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "11569367085498045793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "12324580272733221544", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10885831773581103653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "14897935118679731283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6413565827738894970", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17221173795372066030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "18116824232149703772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "10472893418729915556", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13090596133852586482", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "10274587614581350261", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10831204282620894983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "10394041365384258612", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16843976559933040107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "1051506168926530904", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "11728824117049687850", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "346832567535597247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 515) },
-            { "17934338042329576850", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14046990030104971367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "15715522462313302642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "6569793510829850291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5115134711994944288", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "15711618559677233865", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15136557970717196814", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6603817696964851209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "9104236539185546468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "7247414730479113619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "1314612539156304342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 142) },
-            { "5368419079251107469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5622089373755094139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "16723949803487501587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15640202505592598653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "17258278942367320412", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "11872894645888259277", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6889498170947481097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 517) },
-            { "9667762333290150436", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12797434473085560369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10025839973092358719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "18086782289842715645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10880656082867082647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "14108091242461324109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "12478041902013146137", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "5375957124102705020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5122639094068865656", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3741411131962514208", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "5504757952698692953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "8376077531098664520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12515465135362865565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "17221958812979739319", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10492056481694320580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "11075875009517060583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13973179950424276578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 48) },
-            { "4209610989252810404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "10328182165125764988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "1604661321386793876", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "7883469783245625654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "8460847842045253466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 388) },
-            { "12814676907278614920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "15702382940521972117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1001) },
-            { "15402502830461368746", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10023279637210292010", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "1104098779103065492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "6423120553520000795", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 475) },
-            { "15759530339367380982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "10392297152843428925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "374553246608550876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "642256034968512602", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 687) },
-            { "1701609125136907870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "761169277744593430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13753473508578037346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "7059809764116926828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "15291457825664605611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "1817929353109443200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10182490653383265979", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "2660620513253264815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "13116746433291181712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "8017024160145338317", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1045) },
-            { "2407509127927738079", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "12345000525470836335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "7107313154723472157", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17116130466596594359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 270) },
-            { "6096189754478965440", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "9100044555742394133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "389822325870173489", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12608653044712562811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "17827762625385383658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1103228955716492167", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "6744583842563891546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "4830121683809417143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 939) },
-            { "14400339764883906933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "593712935037568960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "6100453836448514115", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "460780635491857522", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8054185159612481260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "10468108569766167175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "10290107543739998181", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "12881836161162762524", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "12098146032672599222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 198) },
-            { "10533367671706069274", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2616828683870391718", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18215260982292770252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17915846724151945664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "15308667224953963012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "7678730081652720605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 121) },
-            { "7536267099632318821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "3649980610274946512", std::make_tuple("fully_connected_gpu_fb_io_ref", 0) },
-            { "14642845734482478360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17550795608527501180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "3883845471211207871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "8090497202997192142", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15300588247579013966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 948) },
-            { "12940491379482292807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "761183183078910587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1016) },
-            { "1451466106918423837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "3180320769716158201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 107) },
-            { "1154228007901031779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "10783981060353445280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 52) },
-            { "9853089109234784643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "9151597254187513724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "14472187692485966933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "592364460086746355", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14959566236432790882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            });
-        td.td.insert({
-            { "14560435854055940143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "2534408579674556441", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1697248235682953135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "970596838400633278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "16474284418841532356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10131771849139346986", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "18432787283148809023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "12412224630798427948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            { "9378419102254633989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "17543094050285028967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 348) },
-            { "15095146351334328804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5211191663202250117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6763373100985812924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "9126242742012768166", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9501165931845934084", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "8200094670006738584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 695) },
-            { "13091799752362714688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "3001615302961701154", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10136369729388564720", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7654445730724243959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4142978475842207311", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15936513690378208182", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2510919738337557939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "14157776769026046014", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "2888587871912905870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 45) },
-            { "15107740124884150777", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13852065717057446998", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15101680837342453931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "8848042913869254179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "5419041493176804960", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "7162575953766465459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "2538377242539785672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11047625525388102466", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "194324011642969540", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15160738482264643601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "16159309494101203811", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2299440282267661763", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2451603338483395600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "17044070592136685322", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10994887986667360638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 93) },
-            { "7450915928720828406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "2004691166378443418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2595273700611743351", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12175796957622122377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "11190259822407791373", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5116633474932727191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13821388909343378606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "8997120235555587461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2355214244972870639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 514) },
-            { "5673972310424776040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9182897385081081193", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "6681818065741882453", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10267260789603562117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "16797936364395702812", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11324851661119942609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "5957444113623953990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14566544143931267758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7391591731082133842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15592321818359223008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7881579844586294503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "15997754881872769378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "15688260390755491480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "444533022549215983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5629373398445592781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "12930435393720466720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5091558853871982858", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "9300767936311837876", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11756881293845417212", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "6323504675912413145", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6364288463529107554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "3089303702413279458", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13418701036204748812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "8873424072104563382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 649) },
-            { "5085190482265319015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "10384537928514123040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "18424912460022156378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "15650839696475698676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 418) },
-            { "8075453526439606224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9988347141056982336", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18146068930296529306", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3809343305878998617", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "7304346312452588844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "1096671695414716274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "15670841106242481912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "5516343490635816913", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5552958912776013600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "6717268005860715462", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15154934905173371714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "6919081291036849635", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13599555566632152241", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5584432943673435454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "5077214229434392730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7431069335622070596", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "14088382963493477342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "2105482100745329286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "4108579755980014185", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7009735776703529573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "12360796145248339074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 718) },
-            { "11318404975804457466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15596913527233792996", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4474697990228400564", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15163327502374403643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "11674630830833831209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12089505956882731481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "16811402686462277562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5970516037710024187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "6377828127090689238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "4213330047036138895", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15908673392788376468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "11931909191490706784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "12706645084970410965", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12631385844456089132", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10205576142280465189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "4347816192417741558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "14776308019009874809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "4557272439632791722", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8939683514448064461", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 148) },
-            { "8307147375351882939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "10997029728191881587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15426960908024585800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "14043770215999952932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17765244777397448823", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13906695412889750672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "12397493112115605421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "2043990557089419633", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "11047327014045909812", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "360872770877634346", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16168891366331544806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11825205449232126827", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6680219899975628258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "11996551650886043090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 271) },
-            { "12691733869577147545", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "761984225415608773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14545322358931928911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "3286476039871096924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "3167336012388169649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "12878858391355259417", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2460361970017706505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "11623764266322172086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "9852052796465340830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "5559417017584278927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "10157866834809927320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1042) },
-            { "3138374672801504481", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "15470979879166640563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1022) },
-            { "5240181393417899912", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "8500148569566077929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 994) },
-            { "4030835922805418609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "12380856644683171627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13121196588092064246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16816222375242496370", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "16626226341188424071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "13132804928635689780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "1338534626640014074", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16112835627818488034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12013883366396753346", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "9777638299795801012", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1652781065871883392", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "5481293245081340756", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2888315406857606108", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13951717514084457087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "2415883693527779570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "7953340333870774815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10971971008143485353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1052) },
-            { "5842284971563375197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "18076018773227225156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "832830374368320801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "2724007091383127418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1025) },
-            { "5115661026367632863", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 765) },
-            { "9632178829095307219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "1429370139030130929", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12478496773222604204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "6634330132674952638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 179) },
-            { "8467771025017377254", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "685140170576742460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "14704939880642470064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17264554677210911187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8549465639583777774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "2915165824085219545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "1155389358857780776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "6181272224000872375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "1350402181555441235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "9552312946391901745", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17995371099806008878", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13300022131572486202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "5294364781478821403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "16985565646738638215", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14545094765855515974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "157805434489791310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "16896833230469488924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "11860902750907076009", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3790881125495367946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2072246877651869428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "16125965158927145599", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "6748628505489041229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "3119235799568225015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "5094600092408024387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 939) },
-            { "14057348639391787117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "13973028408397200796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "3504421925108785018", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11284755586130392759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "14810839157236175179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "10295400862890021635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "3830787224073518842", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "6586833064055001967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "5191016422297403500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15160192060731796225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "10858234923346500323", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8913451832923806760", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7264756313770306662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "11754316727756881612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 475) },
-            { "381149736509958403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "17723621158215826108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "11878200328276635385", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8253823502854784432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12270548292992377827", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17881905640473324965", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "5018845267269043034", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "2183193161596798350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "5763440554939527411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "2737738314051715813", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15434536162164591656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "14743760934522111296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "578940134826172063", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12297371032753209816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "10842828403850880541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "2198278382394812839", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "10754450245035836188", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6585223640997887253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1226681724476075216", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15012744672096562609", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12024416333474523686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "14366861063858001106", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14872992823083730615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4104803308438043557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8557939065994799094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "3725060015826635697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "941626985322260281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "10046663998164493552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "6982733543386888622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "8676627474831455650", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13312514874803986753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "15342520770460205985", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12061391584831995030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "18420783889227814721", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14104238386345631681", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "8751016391945753900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "5175845410753897614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "4318632837402329958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9048522050692986204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "12608839247035566137", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1081969835308672753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "9340606088243696490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "8143125165478395106", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4265693151382066296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "10727592780669452048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "948917645960296825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "15733030371524967129", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "18325123280144403295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1123) },
-            { "7430073011895298582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "4642234334824303290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 172) },
-            { "3006979228759768702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9899897639161550704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 834) },
-            { "15516674573659704770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "17675227620234837075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8774613863662947205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 113) },
-            { "411914986559525749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "13994738382469480124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "6261584163347634965", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "8648848365873958010", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "16442107352245114876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "17358462939783262207", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10117784802089387496", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1021364163511049664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15576932271488848457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16234606052818596502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 468) },
-            { "13025323039227543550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 575) },
-            { "8901432555239515645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1063) },
-            { "8127190765748950828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "17489255290900178723", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6819846227498139601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12967849866710811070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "16484600784717969318", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7904735292914337507", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1346716334208025932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "16419903786705052849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "16954232936536653281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "6140789642561898454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "17285815901490707654", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "10396343030099602596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "6522575549211855712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "16945184617367657570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "11306782565667740785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 142) },
-            { "16881283637687482989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "8114928396876060694", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "17598441149165536737", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13189392239349392492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "3524531620118359828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "11413890625163220846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8873614802459592665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "3811325657214369711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "11798081355131440794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "14763015336626099830", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2808205041095636198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11006325877486632502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "1938086876393565238", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "11135894989941122115", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16818714747882774917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 973) },
-            { "1197101651805223230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "5754301693527535975", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15884763176333003771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "9940300152880498818", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15809072026388479729", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "2525260242689556544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "1462775202780029067", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4408772370026995920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "4800587664660105589", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "15096978026328154490", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14945451027055549800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2411809718611709031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "6364765994481977132", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7606716827635769887", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "759816003617478606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "8100051552977329013", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16706121580364790904", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16061176355133391199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "11670430946096342056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "16801078648431425148", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16497757978901707098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "7230623964042057933", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15461879919099373703", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15331103261044247142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 845) },
-            { "13671635457689276237", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "5157249499936659040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "8149815705026829258", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5115051214738974496", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "846088275031979661", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "17208186152576814861", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13502487084912428404", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "75742659105146536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "12972406304361050136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "2623687018437195679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "2451627421465368826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17793292063552633023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "1145700078649932035", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "11932768899981458741", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17188170051014066220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "13073917160317338455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "18156747282906367814", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "18355551625040856531", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9657585348407617520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10841786394951910408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "9462315044265139531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8897786294680986991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "9067207838429479363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "706049518431331645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11772741918108731396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 620) },
-            { "17430593168191424639", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11446745541571732900", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "11523864029587161089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17847109385592002207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "6181651715051152713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "2940027113687311893", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4017163133829149027", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "3320392060021963536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "368147139706197757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5381578460674280089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "4915831715914920982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "5523778675167321193", std::make_tuple("fully_connected_gpu_fb_io_ref", 0) },
-            { "2597435203284675496", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2081318772333460627", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "3234107167862677811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "10499265278415026816", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17316626950179740845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 564) },
-            { "2669822154816760632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "9104710269725948935", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 562) },
-            { "10447427622114317323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 939) },
-            { "10263861857115868555", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "14561847633011875566", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5169676188205309169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13649894122307008732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "11192356850081328892", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "8739347545059610410", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3170336071769787200", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1938627662342504660", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "13505239531682993049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11327678075247102542", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2585767464396438954", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3377472614945731801", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7838176322738051195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 856) },
-            { "7520300815632157008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "5124291229936820926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "13384754476437374504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "17182839667242694171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 264) },
-            { "2098357709530580176", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10856527039674342926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1100) },
-            { "16430562172386510259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5658491804782285708", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2510093757258898215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "13817553830305981296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17353894529222574441", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 552) },
-            { "12730339458081890990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17923035110851963413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "5627834277145735283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "8468092944055919238", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2893564501191050837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "218070270815606832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3124997104810767514", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "16565784556269819846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "16429816273405099453", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4456004887590847716", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11006013403687198405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "14431607479949498164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7802311886554362782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "697609699740088622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "15641049130597645936", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17287487062245049466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "7575675354187625951", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12675313398314286884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "18348301285923584995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11098189888598804624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "13015379405020620466", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17287404861045114619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "13045206675957093567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "2479282650381163888", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16053441017037949431", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "10451904743064959757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "5902427784683046762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "1006721963560645335", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17243953172314194409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "17223169013008075474", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17854578307286932628", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7024495439434892956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "14008438372661779490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "7958595516465029682", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "426267761240826769", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "241860795253927746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "5381354625969068789", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7937517564893685647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "8166976803757624321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "17163595630291422874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3502889736327580141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "17338623890209792485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "3362829461757548683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "16865271154583564899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "17185089684685480638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "2702566744272427570", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7712831597869354170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "12219239604684537521", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9318550032135064372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "5303170164698694791", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "805221045541170643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "9216608098626790565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "6494837659483504443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "6621483425195088869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "5458310740719324710", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "12840204133991239572", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "4282198629458668761", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15247381586316467097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15715775011639091549", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "5065071428884648135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "7457899998356343871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "11992625045241269569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "4296524295134959042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "18384657372655350144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "2912984501615111849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2103507679502667581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 752) },
-            { "1532263118203058517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "4597954342704466825", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5567670507334783760", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3561366509539440079", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1364905900191854779", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "1339402691552717009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "15602863681196390535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "15678329601718218341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "9005351264094503686", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3518605747492037670", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8295126647635181949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16359282790151128772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1082) },
-            { "360764089318153518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "15834666915651997510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "11851526665791263153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "13007534905441600782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "16323870023648254366", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "17190698921280188790", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9753702905908744910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "56327004269432885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "15936869458531244961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "13702914647519703599", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11459784003592366395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2572395498687401679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "296142385116663420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7546586420552408243", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "14089893422771228191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "9004823715680825977", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17001502418583498926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "6505706083205285176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "11528310408333718862", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "8971115542951085891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "14074914477149374595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "12238674883388043717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            });
-        td.td.insert({
-            { "8131682691875884781", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6302958994152837045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 47) },
-            { "11070620435959083971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "3177362994630209421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "9780938731831129283", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3159681096461848644", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1046) },
-            { "17795554443343871443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "7549378486471456156", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "545425355231744794", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "3885931890288969926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "1054159213127890689", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12664952811642406457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 569) },
-            { "2080397907007737054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "18037918102910297531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "16494403731659808258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 540) },
-            { "14716719350966652036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "14258499419905714808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "1119928633562250911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 947) },
-            { "7713736987017889212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "14939750655636313880", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1646362346584649954", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "13192885349640152576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "16025442470600124062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "14133958262039763609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "17142080999569154649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "13394233139064923018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9410978119783758141", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "2047041720569246861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "5454796925594082324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "2172121470071868949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "17700958439420868719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "12972634653821069685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "1682776041247037802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "10624567684389583173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "17959539037614502049", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1954052357826969119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "16956980254113285457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "922541506531537121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6447172410311223671", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15052127817178941719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "11062005455602919062", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6351924049625723579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "12925156865008155065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "10556089809203693400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "5291944277945000781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17123463568694499533", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11243840588602365090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "13990028451169604107", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "423221712829930726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "311255514995417672", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11868419561534906809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 363) },
-            { "3664562521273273709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "11299275869800089824", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5221320470007950766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11107930597263802755", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3889519976910355277", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "2438374917504708831", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5284132464580556804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "17309224746854446222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "8154794217037682993", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18133614045401867449", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1572991986657256775", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "5183231560876991543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "3897967722980386263", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15088940149962496972", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7083152697366621236", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17877776363798202236", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "9298483238271063853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "10625675062556386448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "6121673167888047110", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12541764833974378504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "12923653434892323603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "2567809041240246707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "2251029128552117936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4640028527711211109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17942120824047252501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "17912189681971987483", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7573459699367415551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 515) },
-            { "4082229510324076196", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5608133987357542077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 539) },
-            { "8489998884193999354", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10356951625481502476", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14044495589185586465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "3796274347773622633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "41672385434660942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "8262441556572334783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "16748743818537812349", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1999979442136861875", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "8234878941966364642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "7396823789595001064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "649203303142950236", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "953306082374100275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "2850279308978256234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10068502639160680134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "4766071144928072260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "4455497237293642238", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3621449131285713809", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18044455700176500102", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3623866842874047894", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "17332230377845694888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "3200047546714112402", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 894) },
-            { "3325727286860556323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "8682149821028981871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "5927467766675317093", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "17154337492545826355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "12011982029561277581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 661) },
-            { "11147816119060617810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "6290180140047520382", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5135353986081664933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12138556002719602750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "15603643151057665338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 977) },
-            { "5033665285977853779", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "17433037267999205350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "7881187047171099732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9069334144391048686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 543) },
-            { "13199524367893035805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "17279975778400757791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "13925839061045347955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12790788016297794214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "3392693938352572136", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3761770343527826418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "9092949297095391463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "10545749454895857995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4590784654677429162", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7981376447277193852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 843) },
-            { "17829047941256922307", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "10306542963828398049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "13550435052563656432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "6964180083696019970", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6496839689453807726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "203639177311791127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "1005880016096298476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 618) },
-            { "10679760989906275129", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "6719302427415173754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 42) },
-            { "9750510172185801133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6905249031401202060", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17575578027095664417", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3036808833459559381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "3125577147662589592", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10708706979952421150", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "30229601562833524", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5756918912614763074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "5973242004448142604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "9863856393759813897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "11052732052072367261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "9609257787066002999", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8454760437961964894", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1117787205894124896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "14471867575610362464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "3816774953143987171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "8576229375621297412", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "9759380701896779097", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17774902969414949042", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3882955134902442387", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 720) },
-            { "16683485007140805060", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "16767564582561837873", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2104529100867065546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "10158184435144178161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 337) },
-            { "11892088065638996743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "9743806043658380623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "17228877915053571642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "15284262113150488297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "3272776991539782834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "14234117003504517946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "2968031010495399536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10555597973766215754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2220961811760955456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "8850600236849718709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1024) },
-            { "12643423612381102003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 831) },
-            { "8133587696326295326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "5519835581976587401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "17040970955448750876", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 733) },
-            { "4239133538073498792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "5409924335138540834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 526) },
-            { "14132290154676895976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "12582624102297726596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "9454954846682513038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "4865023158176874622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4950144098898276785", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12427258337646070422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "16131448347558322280", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "7228139313323996640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "11254635684957519432", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "9569446666675696513", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7813041847979170166", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17628984504073918701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "2713481951804190325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "15489882561480858974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "3286629188347536485", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "3939805316470672966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "3839690227347352846", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17864395500488861670", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5036963191507722541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 675) },
-            { "261021128656714770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 675) },
-            { "12482312825666761192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "18219755699990183812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "9070474871526366492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "2841943277631596989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "13268525255152984893", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 847) },
-            { "5570191330195573102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "12823842409678756966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10887835418423052188", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15351724241036614758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "6262190151863459214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "69884424286147709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2521821959816944292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "17471843449888763571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2777614869053822003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 377) },
-            { "13126786259906598018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1026) },
-            { "13948873105076070952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "4220826666482500445", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "7025975403069487257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "8422808932256100230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "6621371075123542816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "7862815466573236157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "14136097914489095982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 516) },
-            { "3067806959725855130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 512) },
-            { "15360511165237335684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "17399542571019639128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "10117376369841171716", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9642229389394495047", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "846177346130290194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "3621424752591567930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15336590103518398224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17243648226968859637", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2930848604606590505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "3621070130367713395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "15411603884973340468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "15016406041863758148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "13804435767468730732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2128376438627103433", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10463896120685306944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "13786357802945430475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "15808629700189777056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "17713034180977313726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "16894871557229780934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 547) },
-            { "9404677451270692749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "7942294816235384071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "1865187811299838654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "17049054004246292085", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2133849627845285277", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 5) },
-            { "4147006350295905486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "9655550151067451233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9833242806281729759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11239754372812258455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "9421927854269492263", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "4013707396889204359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "9019388470685749691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "12545558125736154584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "9038991914155436715", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10730856574108806045", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 854) },
-            { "5461980510262646821", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4679163800360809315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "12714194906146827658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3859314295530377028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "7263339400190408379", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15532419087060587119", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5536424274663702901", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4086556132337751931", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "2746052215199129520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "17716065235878633691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "8594644182487917002", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "5685381761573686628", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8258382025812748961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "14707855908416908375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "14650567822254940018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "15118142492742177336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "15294692035670155801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "498239903908845198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4085450203909854919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "15479549936562568596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "7363788553442810299", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5353552956675518468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "15775917744517770768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9899242398980336120", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12791525533856308302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "9256308629247511374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "11433534680781300610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "142486914279119363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "10965563190266380694", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "17252689774572814142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "6158514925486943212", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "14786904599410885158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 465) },
-            { "10728212277329722684", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11151426820269138585", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "1076005730007872492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "2052712465925238009", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "1103204698908514224", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "5893940382830835820", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "10000618285883395700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "1276881030620698911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "17523210737277743952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4883106423598271822", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "8800251965243080024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "5601435819039968726", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3382494956350224120", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6830387121684699972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "15322989486222859378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "15881381297320383917", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "801864263975761712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 291) },
-            { "9457038545823436137", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9798585825695496550", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12654574135415748217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 318) },
-            { "8131617570786904723", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1663732107639157701", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6695336381467406810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "11984095218733350838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14953809073272885651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "4911398420005278258", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4940950742383121943", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "17614929666625976544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "3737552767159920174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "10683839359385393536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9207334433308148635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13954144830230671601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "18153597620760635012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "13373912451448693522", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7369471926167902143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "10076578838853982233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "2935787827649981367", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9198752981132674942", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17693518538833606792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "572155668587252712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1054) },
-            { "530825424084837479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "1655427025346068673", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10084794570892043447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "4495774394017823312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1094) },
-            { "13359643347682243944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "11568162864377479487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "8155752116518841384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "181006047500375768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 280) },
-            { "9173631510896381179", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7982784766505903515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 718) },
-            { "5141753233513623264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "5079055505117153635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 668) },
-            { "4185477435943946730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "8354812222032899427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "16131386739027190836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 747) },
-            { "6277198010392189880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "11845013061234102293", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11287863182337672053", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "12090536142661253835", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "13472532612464340803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "4716188972902735458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "3704618172730076978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "7768680313873061531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12788968383428254917", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13327653786981478088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "15265621959560796543", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "14230385851791760020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "9130971535185609293", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14930745998253392722", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2124033349728954551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "8963262014498730146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3304589333915676807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4947961640303581107", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1791615587935799399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "16336482874764861478", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11088128828863596806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1450888744802985214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "4983880246908724272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1023) },
-            { "11649407835105973949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "4294879469633231552", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9101018613418825655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11163107409437069532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "9608917563823863132", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "12889351859522118935", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6777045876155144709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "1233021176530240722", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4999210721703970274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14086074948200412805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "1207026216972160297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "8515479970005301094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "7071991799972799089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "54019631544204590", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12590495767805868405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "15316782593191029443", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17556238490521153146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "244921290040927639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "17466025028296506313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "17259951372033727587", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15385506288692289568", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17087143277789116317", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1095495157025479260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "14811022197918391667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "1423297940282476513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "16996022503617157059", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "10509933181132310969", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6225447513745282621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11195875185591819437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "13404888565084206853", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "7863886351122918972", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 194) },
-            { "17006655627343469372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "8485845304380573432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "10628725059172743408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17302671258991071440", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "2479856511929768548", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "702096475436365058", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4327450388326573746", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "939718260623752240", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "11806402239500046867", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11529876081402974396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "7848121247546147821", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "1003101267609305257", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "9810904714798127155", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "10462144647439624978", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16170708786673864371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "5229688072405810569", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8269543491844451750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "11612998433409522582", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17303408650780384587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "11704369548723383645", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16122033101591094139", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "2094213523530180653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 229) },
-            { "5011769546010018777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "18117954008112578376", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14554225625951128811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "1540459344569916165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "5055133356846736609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "10608496431404827757", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "2986189945936592561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "8797661560676476245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "582360460084115077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "8529170838214082841", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8378690770140438511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "3860603464276263676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "13616241450266119966", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "16802487456370986847", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "14826791706471872785", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15315327794058441258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "4424217045094988504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "16063854283763838910", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15924144379094505874", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "868488930567226694", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10348660503952680688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "10208132281050693649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "14394427817253242611", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6343888265369366589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "17101789600628162503", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "17406383217119217230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "14070988879848388270", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 1) },
-            { "6495132856471482043", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 865) },
-            { "3106922888635965020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14094981198645015124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8203550467004532364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "11782525502250249483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5230871884758163940", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "6898793319624390153", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13600579723542095577", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "9207413252274439059", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 687) },
-            { "8300655194765375060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "15151957983054148973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "14885109535362957947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "14366252780310630703", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "10428477376571919905", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "18250076003231973692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6778781361481531516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4196367396954155354", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4406157095142118884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "15381551674482810230", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "18308661808437079996", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "4465781406991476376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 280) },
-            { "5277400567128489977", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "8732106543033226791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "10568883265991969648", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1795659014508380077", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14141983383097250411", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6651097363666320726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1025) },
-            { "10902108166827340970", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17599396373608265826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "9357359875134299131", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14579050468883613611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "1876286132660871464", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2740287492529009109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "15285236716284874711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "1062508357634542606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "18373068999874730591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "10237524128771958432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9831195630506601660", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11825293922127550847", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7606728651572102823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "7019316994558628633", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13729951531199985382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "9643671820560131959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 137) },
-            { "15841489476316341204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 649) },
-            { "15024130918582332928", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14301661367597749567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "6707221689266688389", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "1303304215797905198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10917498758625273194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "7658318862249823838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "4347494599650425733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "13139625572508441980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1109) },
-            { "8939520209266902800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17886436103211436626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "12757564215386697460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "14959281374959998609", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18204971481718743856", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7174804306958128658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4550028191070279999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            });
-        td.td.insert({
-            { "6821855018718422278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "1605295763358374504", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12493863403516600413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8749399240948437294", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7937870623766562191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "472454322186482185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "16494581774051338901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "4054010905884346287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1102) },
-            { "10967218651864700933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "17713011656078651", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "15683344003370367509", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "17604747523124060652", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7688176479120305539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 918) },
-            { "12319165874575782715", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 260) },
-            { "3935883681780676157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "17828453493113919756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 632) },
-            { "9639014900668946045", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15280273795883244074", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "7761195307416102494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5095827462645341808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "17496371501557652357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "12085208566397959149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5996261744926399743", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6954257882806659594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "16937207522545573792", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13708979487306970634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "10292243973236220688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "2566302789609970663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "6324565723045697080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "17421991623849671076", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10600884986702650404", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12228963567837353733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "4797026040899499511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "1127598752149871162", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "5939121107940759940", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 378) },
-            { "17123153447808465303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "585914943085061885", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11185156002426041243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "11579025491409526679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "14512407261081843554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "3963106895592011725", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "2346992541638145615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12655099960717366198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "10682918518101379579", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "17225578855755054959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "4859271780094116779", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13027039165868458729", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1643241486250690844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "5749536453225343663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "1760830986937165861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "15551453802011405101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "2467535554409643460", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15124985846197662243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "10058614204420018541", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 4) },
-            { "3615203440895591147", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8230144305844912369", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 554) },
-            { "10791067159964399241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 310) },
-            { "7826714904736870517", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17342868362584820356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3830703844770425343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "13462726136352103466", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10433456687054381828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "13816104794723484993", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "2577413012740709678", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17839839336294937155", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7351401242363888463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "804195263636995800", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15434706304418357961", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12636120902231094700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "3792945601873900927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "6717243674054760598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "16684378382033936005", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16781127329510211966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3480732841490521799", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 802) },
-            { "8431845338648284548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "1410630713443793537", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "1760779615705074283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 190) },
-            { "13020929028222837402", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "16228026045292341333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4660288622381620227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "18445243511250094011", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "4428101657497677982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "4860779741225078946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "12965552570525926289", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16467987800266816984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "14683086376707577764", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9057036344533510776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1146282291269334070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "2425177545256374371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16103943009195163681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "17809920600993699808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "13002363400738122017", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "5093049998173715787", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6995472847770703647", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9366201112659847392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "16489624657475712467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "1819720745131968914", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12667014405537239093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "10270203686708782941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "3150231129728961455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "11198908896401597838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "14365699621119565405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11430797372848621790", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "841243068178925457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "3855151839445505918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 532) },
-            { "1179906398014559042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "6578239603654034233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "11322451605795727486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "7410628771323937530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7490524380333929773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "12319073009094248232", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 222) },
-            { "11936419502418995274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "5695368162557483073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "12136803297132972709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "6526586547926160627", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "11910060331768652144", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6603489144277795818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 893) },
-            { "2095802691829304676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "6553736978928374036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "2235210915304938149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18137106379929135901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7356440848422235031", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17846557385112426504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "12713087335581316946", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "3831257753143317802", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17372520271370779917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "8860685325047463026", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "13731964100893109797", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2916077416184925232", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "13926122593957480821", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "7157499157310356912", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8509748651922589684", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "10756831914332769026", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 739) },
-            { "18400379759523099542", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5369464352361405510", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9522661528867955338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "1691554843141984381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "13797057152042581440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14352303529756685990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "10205696100164492716", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12247991248100147706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "2055914145961691571", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8104331313502492541", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12516911293946682547", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "15282806587681892519", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18210370419559876426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "15552287544878243347", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14156845527754813253", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "6740385846687754849", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "12823080103951853168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "17851024468934906318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "5078905972285278557", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10190532901392055501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "4113935675071480884", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14757855448502485216", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "15857087373591747006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5352896995050401444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8701639906504450534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "17526891234501366023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "14269161473352876138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "989564341557094953", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 807) },
-            { "9519623751582710696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "17631458041591681785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "14213516751025324346", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2632535010129224704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 508) },
-            { "5754844816339228920", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 293) },
-            { "9324602658580246084", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "10660722770448981436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "9743549865786050651", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4356806313729405658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "5906712613621491207", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7311120574972466702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "14100870590396726248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "8071957466247137919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11622925573287101001", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "9522947878591994913", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12949204491386872217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "13468713306678453952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "9527075413813342687", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11369389082421346630", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "7786866732196451977", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "17833517350994024381", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "4479979951990338510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "2039909180006215069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "14174805457643822445", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "533820672115442982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "459936950868112292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "6747799061507191246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "9468542963649996822", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "6108475838757986889", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17769703068450272262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "17128723415461475388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1713947356482032411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "5887877259873928726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4607428643002808173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "16149924641081427062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "2388209402010617408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "18043340998699622388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 558) },
-            { "13699740641705514374", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "15511138074959300404", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10483664832302187567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "4747159205186229582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 479) },
-            { "13348329768178411596", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "9594594523961285945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "1299452063079314341", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9497934813418221769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "1395293354112586043", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "11706378390483804857", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7730305811644972643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "17514082938765137629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "18259001228411909210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "6587817876244206939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7089077910858800239", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "7289940394271052757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13702692566238948173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "9391425117463100557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17775705003104146872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 994) },
-            { "15695275881213623746", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7843498978148810586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 235) },
-            { "4897991181236908768", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12582321591799165205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 421) },
-            { "1629816265162728770", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14740550583313186369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17517495652165026573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "4584970211859494304", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14808831640065476291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "4369346833875105372", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12836639380579091509", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "1650519167046658780", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "1114661658519542600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "18132981365225439999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "13855438905855887272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2467766894778630615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "12680339228267704518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 876) },
-            { "3107611675766875160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 599) },
-            { "4202116155711873525", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "17370051888730874220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "8509882139595784161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "3995098494991567714", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3032921857841371728", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "363330365598760149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "10395191003166536655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "11696231285411686761", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14289048840489035546", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "8655525088525612583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11640865562390693266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "5020605371834958647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 996) },
-            { "178353385245384751", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6296371382672640627", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13337315872184544686", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 640) },
-            { "2376239021851907962", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1208534686657112759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "310584224049735004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "16327433707667075261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 212) },
-            { "3435773540391994106", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "13676670925355487305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "7545013298074733778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 549) },
-            { "17343050785312683560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 186) },
-            { "14176233347574275776", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14670068483447729857", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "5691889055008878111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "6306539529168638031", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12253987037990618484", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2040762223425679479", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "9165275903833498932", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15156836293519486753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "7974614031099580856", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11928926429060828408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 132) },
-            { "7009873605945341897", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8464582977975377118", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "14755869345266103764", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "9557728221162137067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "14417033368952865805", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16026019808764920641", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16897485136352617189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2688060699200137048", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4834591210311380436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 716) },
-            { "13237050834496100264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 527) },
-            { "13500369101462555447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13558618754911056302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "5334190564423375247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 926) },
-            { "15679696422603106163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3522455279376021211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "2246205611561147645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "5301394322453453489", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "11398019086259011063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "17429692714456679999", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17427036330773218054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "5040730152867713388", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9177395776408296291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "14904665242518014005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "1565612286723277822", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5718472464360340274", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10897008852059401902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12935563359569230797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "12676139447729343679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7142195383189497127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2789137853864057385", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17900257435531434807", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1375156980278317418", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5797243082477551421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 469) },
-            { "12988961529988078346", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3574679673239756551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "11726298758004767743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "14006248791647711759", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "8025053805734757314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "17991368786018745231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "9513032457323269513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "6203602270552179462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "16559140502701231107", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "16172528828198474326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "13675314612031135613", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8962502004422485576", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16955653765071712611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "3217555855036660482", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "8775336277634573074", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 635) },
-            { "6876300000441081789", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "5762290464889692462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "2070429718533716882", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13941251104772804303", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "5415319660821122528", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 1) },
-            { "14083279273292567319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "8336494030011542852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6204183474669103812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 889) },
-            { "14010642743400284761", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9270950131920019932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "878892264408839067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "498420237272375425", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13765632280570725774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "9475130054420979752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "14046217730873620907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17086887873464601732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8734483136584351066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "3018306533413795559", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3355259926747524578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "755414184406250882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 469) },
-            { "17818587793483875865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13064477237937322246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18193831330827252971", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12044635257539223503", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4725009116734166168", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "4958222070605478947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "18232459663207612727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "11327867170377736609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "9840495023131952174", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 1) },
-            { "1197184887743937394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9833540739021310892", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16304963156448605623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16491532291908469567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "11213667690594303395", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "9368244029111057323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "1168589063110524328", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "6026065914078520895", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 418) },
-            { "12083217714727863832", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10264913782610095832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 888) },
-            { "5246955189449281709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1724222702460860833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6973621625148257910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "18010600104565458874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11981887712163064333", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "7152107839144357830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9404953235624894187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 95) },
-            { "5955810688179557560", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15720507574336564201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 618) },
-            { "14038261392627717712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "710166379854475667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "13898821685774165645", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 847) },
-            { "1579733029852052699", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16833026567865627676", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "5582896843095691256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "7460672405409009037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "8680545947510235993", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "7380979920013545867", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13890118723041457532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "6351347283201596793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 57) },
-            { "5592556538784745960", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5488296540132936296", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "304721598975479337", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4299492266819967844", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 994) },
-            { "6133592828563353516", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8158983334404475382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "7353255713834431471", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "11280403113463077620", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12794030011655906930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "17361319565503258506", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "3856394004079548211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "12163456975896925619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "5592428580503282095", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "12311901617815857033", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10527256963399838405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "8334832698020211623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17965825642065048619", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "8235002440285527553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "14251848023416168295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "4846216894450341698", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7878217536124016199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "13283842370311517843", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "6537576410448334203", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 277) },
-            { "7289633911925073088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13946367911927964830", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12175297963550750804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "3432296808755992670", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "4085907608404305515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "13836867092941506302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 315) },
-            { "9758759365463492505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "12305383126483033452", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8913950860101596091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "9497269191159495932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 123) },
-            { "8329846097322076175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "16011429608661242565", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11979910991788695837", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "8701248964531180496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "12792454713887439830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 893) },
-            { "15241191584896579183", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "6942049339361951275", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "15534517308430424624", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11878217002671373638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "8045393243176844621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4245229655273611845", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 887) },
-            { "12315068368597230211", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "12169896916690963726", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6674643031068271417", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10838721873837128971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 676) },
-            { "5172712078329324967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6796758191974756201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "2215194389847256545", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "496948821475405395", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18286006396667126860", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10713207196920878995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1890739204389692970", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "17446388159565719362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "6493920223660825755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 370) },
-            { "10011668671963948912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5172823024549700279", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5635449856699664273", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "12451592945087000191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "3363675939515208883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "2257384183256237750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14463173937397982331", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18423051691107460439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "8402396502992483524", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17888721282811720634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "2406816735581074778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "2410828969408182980", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "16928564394848059094", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14742909697076926475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "10650698451740924172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "14807299286266923693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "4408600136502382976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 417) },
-            { "7316825051569394089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "16935619230235600309", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4885944395876887711", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "7439340221097179208", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10614918790075146626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1071) },
-            { "1908809004094565452", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 918) },
-            { "2527189070714658176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 321) },
-            { "3069396488274616770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "2322559721899919275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "15929361440504489924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 47) },
-            { "10968768803038046390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "10591159235183381823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "7558864177789582540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "4232250144427804891", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "16236397968499692493", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "6895664772793074050", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "14206328165498357760", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13766538247146238357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 691) },
-            { "4945845875046545967", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14309292105974991733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 972) },
-            { "15214779483545052950", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "792684262493086891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "5120274680151325194", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14848732804958314374", std::make_tuple("fully_connected_gpu_yxfb_ref", 0) },
-            { "1034911525083515252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "13941188114382863776", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "18271689282126907793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1047) },
-            { "1373904073013943690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 649) },
-            { "3746573775462003750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "13282612510005390816", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1096) },
-            { "10073779356457603252", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7404732699742965436", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "10306169610486701545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "11007100272494557520", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "3752278444736105763", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11404331488962230130", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4991419288164762786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "15394217414267195999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "13721983823460534294", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "937200116534179904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "5341876404211768451", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9953329530402569669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5872553335123308034", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3434842614653335826", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6232596685071671579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7173828525834910425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9275303306340702111", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3409255127071376537", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "1149548328523286475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "5912303851874077576", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "15019050434475217267", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            });
-        td.td.insert({
-            { "11093147488085506266", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "3604379857905625467", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "3447774474841314860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "16705941191876956548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "6491772898618671653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "9421643783312790618", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3318430113631867573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1052) },
-            { "3416636940668221406", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 378) },
-            { "6753857156025715321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 223) },
-            { "755157892988514864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 136) },
-            { "16159852373972174245", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10168317560306247723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 228) },
-            { "4370027682980493159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "13694766887442024878", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "6556795059657533200", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15387047026300787039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "875552069535001284", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "364197229238830807", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "6293500642319778096", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10784073615329190425", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "2477866283402053371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "5448665190811365701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "16689318540732157754", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "598745924736700294", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11814740669468421049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8054599744123820194", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "1663285216972929652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "10159790066948852390", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 934) },
-            { "265124365266629363", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "2805931700404492624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "3109104171383198425", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "4718705504966715203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9444953530704856016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3036512701943687724", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "6656593119788274992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "1677118421195120152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "13253775441326432265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "14462438074931673266", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "713121569924250372", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "16150934538381572916", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11004350075893421731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "6849874726361751307", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16312223896859176991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "433161293684647032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1120) },
-            { "8788703258318141635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "6639715607290389968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "12962552332511702682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "10892706534058849825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 284) },
-            { "18174857480705846286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "15737508945513376813", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5743482411668939203", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7148542290597073512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "7281661441196896385", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2542984219353153495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "6322831233548420761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15308578014507211237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "15733883474006568340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15918017311798856029", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "5385316497510064491", std::make_tuple("fully_connected_gpu_fb_oi_ref", 1) },
-            { "11522488904021243956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "11834683513280095384", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3420064118559852968", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3797957937905580811", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "2431923918345445420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "11717348577195224554", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7860086755625626604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10982693252072682414", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "973402921452083017", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 225) },
-            { "7218689869635572700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9116206094279111365", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "12329909110827539139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16385712633367611786", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "4063525218682664832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "12987636957813312667", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "10881884300766361791", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3704271978133986620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8275277322582733101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "7717602860943327535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "16766706479910720794", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10629681722649771498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "1659851931406041285", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17902799955139047426", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15737542477498282367", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "8550133332738529361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11528417522960871233", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "6626716013917662606", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5920614348521143999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 129) },
-            { "3617433210865054182", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "2772704069752888874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9968686603153440164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "14151249542292579535", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "17947613081555491099", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "4244790495090049295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "3285520504090196295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 323) },
-            { "4554343896877444783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "13599438824699346708", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 240) },
-            { "937050062571228573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10250778203413648582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "10153070641942936648", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16463823433924519300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "2838789360952219092", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8272823732258536202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "9884646296875511696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "4445912157712391517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "4674416595144505741", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8153567933591966877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "7315740838189400004", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5060817429317741254", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14724862072414829490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 966) },
-            { "981276017776678882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "10643373404881648498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "3355824730785179775", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 899) },
-            { "1018319414633271980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1025) },
-            { "2764034841399585177", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "14947798627499698329", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5495776091407365966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8474585711383508493", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "16687701987371294908", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15594091060902767607", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "10880081193716628051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "17309326904418811234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 552) },
-            { "1787598049938821496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 107) },
-            { "2072252610120557179", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6053594232298534345", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "10995424394152951534", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17947818179123182001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "15741360654354155504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "11709992724966310174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 124) },
-            { "12878631058803628679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9531730330306606343", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "1640358227345963848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "8737417433314100353", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14445520478857662586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6040623414692799116", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 732) },
-            { "10381752670329683275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "14066219153422011272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 202) },
-            { "14738573151275130683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "3255465741612432300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "12874626654611400042", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "3599823735065658574", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "12365282242489300092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 379) },
-            { "3113016029551460773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "1089679781525023551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "4091785563304559606", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13104509059416300615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "9945721344229922405", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "16865879032845300007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "12176879951537921518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "14173867073407110501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "277151219694781348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 655) },
-            { "14629433964319883917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "14669219788000023965", std::make_tuple("fully_connected_gpu_fb_oi_ref", 0) },
-            { "889943986793446284", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "15325302411038679750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "10177466042250039828", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16140133852987111783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "15693851280141842140", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7562624810837784407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14535007186125575064", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "14864150409380754546", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5831305777612569716", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6660221471357497741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10168217053882274702", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13874754478479442212", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11951606039079763598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5326891298755303584", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5550000568272972532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2387628682187438903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "72444706264681262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "14257548530334193336", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13711710595263882397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14436334357815544497", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "11231597775940542830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14746359019867963124", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4536811685836767511", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8161047856682416508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "15257886319670476581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1028160614515220430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "12879205642236526041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "7215460815798365056", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3800011935243649447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "2881769839926594784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "11529521968552409482", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6641684310751726510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17122338330334998991", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5185895996350118172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "714397516895317906", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "13146231972557134419", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7005371843527735283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "490233152678323691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 182) },
-            { "4890442595203749341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "9216695884134021401", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "17382660912493284320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "15847413004526420496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14652719560551657529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "4690935789908896751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14352796912241296357", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 0) },
-            { "407189201971322683", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "17610648476343170476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6210074450403696110", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5197105253412476591", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13893789954946953427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 586) },
-            { "12309132521191764927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "2287331417346465035", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9235762655002034553", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14996839491874598555", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16507285966998102421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "557778263661655803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "7344363094493575878", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17947097500350250352", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "8855801044538137828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "18214405165366931407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11095908837221722097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "14902389080201926109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "12526627889432649075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "10340099951904598712", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "8107447526839063293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "6489448536745533209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "12063854963434677046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "10931533380146553429", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17021953651379372973", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16907043223873231356", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "4894227264080887361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "17633445715900116866", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13980058444317683376", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "8039045580314824307", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13286723666743148654", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 880) },
-            { "3633858263279042265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "13277308739029064167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14203217958874365062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "15278336216464964580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "14621327324047759584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "5724069285122500749", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12460004417430913427", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1755021778097194246", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1062464852330435815", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2267942216745157485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 886) },
-            { "4766447533088048613", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17738299860390552088", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "12581879452540858313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "13597240991532942069", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "2705394837952559308", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8501145642605270365", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12174571114411168588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5734909305243135224", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "3134489458855347772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "10155417869639270818", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 258) },
-            { "16815373779430857324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "5439738552514649732", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8708643228914766202", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "17928043901784474130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "18216392915308276053", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5835634465164771899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "8101977280003030465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12418390364502912036", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "5821887901198535792", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7605139219344415117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "6370629727707634189", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "16294825599850364701", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "10869005786136023160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "10613156984920928792", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15901675909820977223", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 757) },
-            { "14585144905582599299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 894) },
-            { "17108987360340581555", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "7071864660784255328", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "15310138877321331399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8526484907799590618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "4788094685976850847", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5699637716202391188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "451787079167744428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 41) },
-            { "5865480930796299143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 176) },
-            { "6696330836969622824", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5326247361632903583", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1617907811128880383", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11173744709088359283", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "15173187675372221634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "17868294056467093895", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13932662890258900896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "10050254009828302053", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "17390307025967314108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 718) },
-            { "7457951266863598199", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "14595102366207856448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "8906185843274300447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "13654816209891478730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "16043683538361975370", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17094948685292534952", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 174) },
-            { "9391102514951576629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11275109735493317886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 603) },
-            { "158222105675022402", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "2155348872565175553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "6381439938385141423", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2265784112305305260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "7666505529539001492", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17300963371220857043", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9150686862263626364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "6066347819693426556", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "581553908799266285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "13105192484434299621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2543041530639980505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "7084794834886364709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8977099691399563065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "15747538142554815480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 712) },
-            { "14156264942337528284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "893885204484374577", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "1436052878894538927", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "11873734271080160669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 92) },
-            { "7671440804202996063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "11882388384272635526", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9080269503597463911", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11985789598994479652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "861944552852043171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "7570346182940928159", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1616603916015535857", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "15076307524263378967", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8671491767142900139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "11646035413147246650", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8436644625511258721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "17499047811775012205", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15948383678216076358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 617) },
-            { "40684756725622867", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15404352708246779967", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17703907155485973486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "18269382610859905921", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6614833247756539341", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "5482851829165191681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 645) },
-            { "683530182479794259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "10506079835013332412", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10433541468308381909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3652749152621176846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10747768416582634270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "14433939319502072879", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "12854110364457722483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "13163146272900339330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "10002942280571012447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "14611470203914805229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 888) },
-            { "3317498303952226642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7957927312958744432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "14784115394395151055", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7370273921473161914", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "6990161783770805523", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "12361909180687647792", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "9219978118417391687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15184480575877095737", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18400137500031567479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7852144838267007144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "10712251675747436685", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 190) },
-            { "1404523328737649536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10340626080611300806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "10632020369698615114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "11913865086932469909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15011504472108164173", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6955820760012983739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "5901470393936541758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "11561352430430157770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12134712464763856064", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "3682813162987778705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1044) },
-            { "12659539044474018256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 138) },
-            { "17479614483340719566", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15630712601053635938", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1090) },
-            { "15314178289202641916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15385836287435319028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "13931470674812510958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "15982499072593548907", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "3805991105758534542", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4810979456269693700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "14387663434151374245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "8093154215631195896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "879461985074219072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "16468779692009938330", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "16507216630035678597", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8525631489886320841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1121) },
-            { "9631545863582097486", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 254) },
-            { "16495435651959280198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "9192665896782282996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "14017106221778585861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 686) },
-            { "3140230065585683313", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "16620032793356620588", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "6087091876057515304", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "15668060723417155782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "15905812449037427213", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15372944709956866587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "393130776826919699", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10710426249911063154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "6213386558868267629", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "17790622334577372736", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12138341287265949399", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9110265526128628472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "14322754320861242412", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "11388177266504804841", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "14243609293683870669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "5385637020152792781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "10848277915422577656", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 421) },
-            { "17651949893303962955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "557926911473978758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "9133224739401155411", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "6946815194102787268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "3095800485689583188", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "779633618375662086", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15277856047844308598", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9373353053843326128", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15619086801947147359", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "8965747921518186477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "3094541981461578435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "15444345793124210505", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "2822531372171708171", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15984885011101717258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 735) },
-            { "15767973630744679517", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3787897045202294227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "9285566577169147378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "8954139494467782298", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4184940877670248246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "16683089431066989909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3013359852055354405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1049) },
-            { "15927212142469570269", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1102) },
-            { "10744779302034526105", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10422138282116598013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6046380638013542109", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18169371857833455144", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "15140592697506341614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15033864286535250007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "6925829066248055368", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9849272539053219052", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "3892679716763161057", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "3167115892101501516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "11379252854859166206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17829983167337875463", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "10409424254454997557", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "8435953773852854494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "10772763339005937717", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3926585856863002495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 585) },
-            { "18269685060032395235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "872401732136570312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "13771196685227797262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "7431849514656037251", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "6754359635395225555", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "10774528268153772208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "890679620691833367", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "871656942964602772", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12976499206227689731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 604) },
-            { "7458923250983373160", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "18305785425659656349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "10869059995205753062", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7962991673727743706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "9626028243479089234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16947969669087411530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "6391847213494189692", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13816380312874384117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "7963120178142346699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "5061053593616346116", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "801943727169437597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "654122557966242717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "14503814672536990561", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1103) },
-            { "12693511427898130707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "1891216794223363114", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2857337999074313592", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "3201851883430682391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "5876880412336151866", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "914589847837601900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "1305434952341925041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "11213283109763090897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "3290503865540626256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "12293786134765875615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "6375149408738336520", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8094836777153039013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "774981050284188673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "15529767675448574617", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15464327246951632247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3179874645565098825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "5776920093461427179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "8790992468693685188", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "17608082492919905570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "5150467145740542480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "10252930102508743294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "9660587580162063066", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11850332373794932468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 213) },
-            { "10133406610245448421", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "17195491464960153261", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "1557549837620967530", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15197400201857680173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 353) },
-            { "11703557271443535142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "17376180096577763039", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "11353671464383068485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1068) },
-            { "4197617702037834389", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "14322392426975869640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "6227066883925046010", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "17423645390621980919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 263) },
-            { "4957638663977636791", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "318377908569897093", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10578656188786691161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "11800958516083095340", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "8990561333549136048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1112) },
-            { "4072967257556128157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "4292467512797995948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "7287802938269404923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "9180575279116075400", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6404731509766519779", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "8195881973746570408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "11582534256623549131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10792503079194374004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 556) },
-            { "8021962180961047152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            });
-        td.td.insert({
-            { "1316444335300814745", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "18136765667969393174", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "9895036366054127607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "11002656253983635383", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1102) },
-            { "8481272193490654884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "3033264172690274208", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 853) },
-            { "4016652650196255483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "16159055229009077435", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4573547058027867538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1016) },
-            { "9763310312421884308", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "16165264024659208580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "3539764293444807886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "10849780273184392468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "13835908664998757647", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "3511588484597779204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "12558716383635737426", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "7023033151960653752", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "7636001038842031672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "13093429681061786539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "2858694223939965231", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 694) },
-            { "4680261350523889008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "14951164724050668856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "15594387862678649962", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 961) },
-            { "2912858944747613525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "11273554217552152172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "7662200927459001757", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "6438522646185979880", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "80038800201815976", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "1917986916390093536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "2054895351334936744", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "4151997155802743451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "18213389163198755626", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "12363462562375148101", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11312797737791604596", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15392592805235453180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 533) },
-            { "5424159498790442193", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "16601702334097258697", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "7390751298966198773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "6695224851008237679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3865480446980740412", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16710010075465723498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8141428150264829362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1033) },
-            { "1615155632991337496", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "14326748416648598247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "2518919454830671073", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17750329428766282997", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "414342067295883061", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "9358320688298379206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "18139055731468596187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "6129602738379919488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "5922243230245842969", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11428599290755097395", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "13387804712929042302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "11927673108508931485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "13429534778879474114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "11066538564303243604", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "4440261013093281358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 207) },
-            { "8881150100883636392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "17325129240374428839", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "18074320074700491416", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "12352083215873760290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "12388375914105990324", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "5601320732740276692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "10462203417605590793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "10573920781439771673", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 303) },
-            { "15451919862187018297", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12561852932488001568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "17337689605705740533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 230) },
-            { "684240994243755872", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10973267399508186283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 191) },
-            { "8703051983346886620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "3807725810350819929", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6303682540621797774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 320) },
-            { "14998412675237613013", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17800494747865760215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "1241188741090538769", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3689722043202617487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "2605525859754242318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "15743075522781198932", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "7903891232234389925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "1818234431954731769", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "1555841293175143289", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2140514316203117958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "1691020960118022320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "15260010680436431377", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "11066913713501760080", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6879801583428507100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "7945923871349397386", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "737706555781027628", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "3826083535442459719", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "4460838234035901102", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17393241435373906917", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 319) },
-            { "791937929163665770", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13855910108498240870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "10591379189397010097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 989) },
-            { "13540002981450186147", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "4987922194420804256", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "10665697051755790682", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "18150429561058646714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "10090923790949378407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4004333174619528327", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11215297942420903101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 971) },
-            { "12260041857695743504", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "15220874718853723626", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17993337310288098038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12971822824884826169", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6683090495189325653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "8065408380801722040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 858) },
-            { "17370560568464798319", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 910) },
-            { "1541754036637209097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "13381441263790184121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "1742897526168249500", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17508515605648584094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3142706898070129318", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7833495651619250213", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13972357557211413688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "9549667332801021099", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11878734040194151073", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11740474593275702888", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7143510787416483146", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "5648099611567577611", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "8162762980597497749", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8323445733669842657", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "2727219457659794468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "15825993019555657125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "13186342942242476803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1067) },
-            { "13267438341255312172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "16566714514564722975", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "14841539539334726292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "12278364834477923930", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16348402367953880206", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 992) },
-            { "16857192626139882429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "5132761922124425835", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "13353123037511986804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "265378250397648692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "18260147016899103633", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8374232727884943288", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2253443114793765536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16132186023443894579", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 706) },
-            { "16461300997058854554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "14122647818827599984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "16091195788712971747", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "14869125900405603130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "14532844474906286088", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "4152919461079296700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "14353390922580547467", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "16062811901668074268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 833) },
-            { "17761681290527373180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "12266072789949082198", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3349519148124496343", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "13410178186827874638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "9226912483632588371", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "13426413463253581310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1064) },
-            { "10010921697596131761", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "16042236932298055236", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8713639086785023623", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 944) },
-            { "3855859061709004677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 969) },
-            { "17873182129275583020", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5073980187181521102", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "14214141488645257351", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5390559917122707732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 426) },
-            { "8700953648388124963", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "263575476655527355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "3438116423688595487", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "16273414163942580140", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 457) },
-            { "8260130048649729185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "17034122796081495259", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2307310127637739872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1072) },
-            { "10835684445936063871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "4409539711630405776", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5627351109775149477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "16692569816843207989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 646) },
-            { "14204028212129440429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "2235888904701517631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13947140171097868740", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "10412588668458621135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 496) },
-            { "7177837234452118325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "2305345466244887603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "4693778191222244259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "16126210124715599267", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "5440622601084846974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "6104567430127604601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 665) },
-            { "12576360049619146496", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7533669599936874355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 7) },
-            { "15217183882858251099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "3062101811226530720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 673) },
-            { "14408266407898585602", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "26434141991791193", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4186957909762095019", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1052) },
-            { "17075150439662364176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "4163359403543480821", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 0) },
-            { "12015922610963701033", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "3122997634505472500", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 611) },
-            { "6075691042233712335", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16763947298003094797", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "7476503420928065329", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "2839767407547705101", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15466940145773097237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "11208787273440167590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "14944798586094927774", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "10670829898588047148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "13842309033760176194", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2588106330058954614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "4011704860949525864", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "8916983923551808409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "16207793515276299964", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "192209423643075326", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3495464175121035222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "13644681270630373984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "9762182215179534181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "13869279315296163696", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "14146157492452859667", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "4428125859693766145", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18052322665755789573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "1383899865465106141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8420176522157084802", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8619380242063264016", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "2315979511894958580", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8394085742794617896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "3880189981766119529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "14862938122758223157", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 110) },
-            { "5084402281339667158", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3800864312883193560", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 318) },
-            { "3643056883397245235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 602) },
-            { "5812274221348979687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1019) },
-            { "18109284647478027063", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "13178480813522103091", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "13485431068391184236", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1096929244128185929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "10545983240319359348", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "555153826947872383", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18194662560696168435", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4892959859293355837", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1361159591875955678", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17699579394941627848", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18106333667377667797", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2424832456352484524", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "14559552090809408184", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "14350963106032411355", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "12348135936862667024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "17347387929692736001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "7917673216808705075", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "6329618009202266591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "9381304526221508530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "7111620180131341264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "12711366212612147422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "14605107834931199380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "17381682740282686038", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "553884705007944190", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "4084106758501882407", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 2) },
-            { "13748207123919546925", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "7822148442995976259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7379959915507694400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2615550169523847175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "13400559817638330692", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "17061233750738578337", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "4238163995861108694", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 257) },
-            { "1961296939362567851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 958) },
-            { "11431776034512615562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11490143853656040028", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1081) },
-            { "11080118408282076423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "2038505773698938555", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "2797723586312707948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "5514520264534847093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "6478247863479663432", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "3621930417735246405", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "14361697687217060995", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6857064389795419021", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "8332688858465419317", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13094313253457422444", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 713) },
-            { "13723543003759101485", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2053428297205345660", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "16674897846232931666", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "13646026173083209094", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10253092389452603623", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8012414839721814470", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "11102920976866402928", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16117738994809548007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14609655423082082099", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5519535335798045279", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3927333491885837374", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "18136968124686255108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "656536921219262336", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "17140704838989242732", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "13891498649894490342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "6625355663340809894", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8382355932367801226", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 628) },
-            { "7486133596762640215", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "15790005937034794347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "5159470523468873105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "3457676694935264283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "4242438539626727158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "1188428190761098784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9996590003462421281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "16614092873294424156", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8964252048679144533", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17821196374523699955", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "14788817017267716113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "7966454753124154534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "17377293745073971167", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "9824678205469832038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "5864250949922222051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "7578465277886568471", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7877872008801536537", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12174729877807876787", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12651215303242591871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13499476832444042458", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "7596423139159263456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "10462797712860969072", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12526417587678222534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6223991300587768990", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "709835724029986012", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "5287076386757143976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "15199659885055090985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "13510598063226540077", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "11232261979256657934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "3491333679577961640", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8394337033015371278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "11864780937861562358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "11883485911218628865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "11583017348580874022", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 111) },
-            { "2602209853120236226", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12136029303893296753", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "8104509697376352086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "11863623794400366834", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "16071723603031305677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "5490683510357615963", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 346) },
-            { "2349007644347065353", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11769511287553067221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "16286085532892593349", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "7853648744637103420", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "12882754981683858333", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17387764798693150143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "7474639594232203854", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "18026754720065676632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "10942743767167283370", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "4161001033681779582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "708347829794105085", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18372277746801271292", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "3046878786712386934", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15450609897480659306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 929) },
-            { "18012549942299450620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "17119834538806653818", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12635265188475834607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "15989164585998175871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "17274625805315816028", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4764776977138392550", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 81) },
-            { "6366477005383470532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "4678945085654662665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "3266638956600784732", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15962137123591591534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "1708527842474979709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15038779174806415801", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11901740241052104941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 626) },
-            { "18034648276860485300", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "12141300895511301068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 892) },
-            { "8415763978601237333", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "9321208819255762521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "12944449254981328284", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 510) },
-            { "17422822627612865758", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "16351593165006175213", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "16496066467505445971", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "17480519865636248903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "2830019939638455400", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3547275591884493445", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "18128162750557822655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 203) },
-            { "11439519952236570490", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "15334195300678132907", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "3497946462254198388", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 319) },
-            { "13041981853634484809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "16206791915939407806", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "13343968006718934574", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13489318651148001664", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17856816245251319111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 845) },
-            { "139367204458861048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "4720851194954041037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "2174528711050181972", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13546876216568825877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 241) },
-            { "5566145479615299930", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "10134863884423338495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "5873257164958285393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "797387385159110695", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2297846338452062425", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14559308665571750465", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "994489782629179836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "17838473675663772639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "772794189370544860", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "13800387305792597325", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1040) },
-            { "204378699575356398", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11275526584835606578", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14168946412009689868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "18259018980049662870", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "8403919905230540356", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "17509205154057032109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 471) },
-            { "9213563311267466388", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "7584912988728072414", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 336) },
-            { "4560479630843098090", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3069726952591207961", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15890492401334524258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "16916632481840858091", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "879939701282942121", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "9031338938030715616", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "2684971093531227585", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9970142663470031403", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "15689502054035168040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "12932174902085755507", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10681304359334525584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "15507430010796753396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 476) },
-            { "3723082283919334922", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17286180622990393912", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16881320590336043120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 199) },
-            { "11178675492112714513", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "2102507337684140674", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "5524215233998361104", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "7606277451240586967", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13372079273473545269", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12077176094606956613", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16832083703120717402", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15856268902838573812", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "5930451476167223501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "14524011013133838054", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 729) },
-            { "6324194607665787911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "18057258413318190788", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 365) },
-            { "6858245954375015939", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2973436171295280783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "5740738339752793113", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "7092429446071184360", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "14840301687056551916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "6307840223437204536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "2758256770667070477", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "17621284804179990612", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15752695063119223631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 430) },
-            { "18232278892738147217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "9322808125154719434", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5019077257951332016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "10534355502345993326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "786418751322581924", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15078379507314446744", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11673506380927771816", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "4563407231964979217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 964) },
-            { "522181557896569275", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "8954957191824520301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "3055842046969432235", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1065) },
-            { "765085235448596225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "578703329577922869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "176148486634277377", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1743672154424707483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3723613341885592267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 6) },
-            { "9519113693008246391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1102) },
-            { "3892873577927627992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "10565789595834959047", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "17791773192152464021", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10743628077362128751", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "10031973538398542700", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "9236621881488650027", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9524303276541517389", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12850610175882424919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 209) },
-            { "16822728519529055454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "10729288973933590396", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8886676435675463412", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3041752019114501584", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "11726125778063855770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "7002547494442875680", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "15751445344585167275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1056) },
-            { "1187817806204244044", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 590) },
-            { "17796310681498690253", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "14994322266840011040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "253337639942573142", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "14487682847898298214", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 0) },
-            { "12355112948013108181", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "8655883535274781128", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10254790628108678637", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9513218905938141296", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "170594581804738255", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "12164298124869114517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 359) },
-            { "18415227597391874233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 458) },
-            { "17707294419513060769", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15861253904810475842", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6638761803107874904", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "11033824757086203326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "16767657090925788431", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7174790971918109163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1016) },
-            { "18096803908321982720", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "8938942439963723596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "6447357750120537934", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4355933224673863178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "13476976389397273052", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16522364268583242080", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "2969389503332309296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "16703049240941366828", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14121939808880396150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "1832310305089212990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "11044223289209000460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13387602037439694372", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "9860570706348640782", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "104165137500939902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "7552144047474664265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "15598527290222497283", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "13881505737488515065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 154) },
-            { "1152693503778768433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            });
-        td.td.insert({
-            { "5235375820995365354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "1014934490175718598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "15891746043846062984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1051) },
-            { "11782514629636023633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1896394898744191046", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9055254157155243850", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "475079717987185580", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 198) },
-            { "4492673409319122180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "577182964135927041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "4344644499804057502", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15467064540951151390", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "16120159001372711511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "4026686872534942904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 174) },
-            { "15643053402284856082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12181607120522804433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "17517541283617012275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "1434535531617424039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "8321148793275220552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "11078289776590382448", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "14578291812739325465", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 158) },
-            { "9423239651872522813", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1957975992563882145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1025) },
-            { "530491406341772040", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10104091044601583658", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2686152083115758704", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 965) },
-            { "6672808203620992802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 247) },
-            { "10302338806536775954", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "17172842643607718498", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "17392594284473856393", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6290317420155851465", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "15911508155433936727", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "529543453251381109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 879) },
-            { "5020788604681810984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "9305758766575321575", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "14555366228958374512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 134) },
-            { "7199295899520406795", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12796777049340516563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "7020743056013297476", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14071393823183565145", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13602299412525111348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 805) },
-            { "12394049027081208902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 357) },
-            { "2627779045483019709", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 812) },
-            { "1622880009460832832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 932) },
-            { "10087048842366891699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "142345353315012903", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "17802514063213000148", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "4132087699110753428", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8306337702797456793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "591445875836641836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "4960466075321426984", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 559) },
-            { "8995598177504756805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 85) },
-            { "15976399554094563736", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "11386443944172875185", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "5485050451156514865", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "2659031931257084418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 540) },
-            { "16208488491972128275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "17615365894230830516", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 327) },
-            { "14118838785256822389", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8866164762286856139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 738) },
-            { "97332433783610027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 215) },
-            { "17080372737840346243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "16720108310653948550", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12650986929262866534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "4477135619420651110", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9040986180016264906", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1126) },
-            { "1413598669014941757", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7431469348791099474", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16383540667048742064", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13470016086265528105", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5854267518455107328", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "15603710070700542017", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5219818570070061892", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "1601512693620510391", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "13297691763391637265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "13455881643467418059", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5706423911886410117", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13503608041359512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "12951069548510783681", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15591167992985613695", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 503) },
-            { "5637480705139132901", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "4107088111454348836", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "6124219814856247918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 688) },
-            { "10062957707721107508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "16179959997108523051", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9647713236241614167", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10884966210360699082", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2728956755635458379", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8578774826625315147", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5414285637221358737", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14172081523880352608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 572) },
-            { "15786328370300803713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "5795073619189010837", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "12647099325257717945", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13292923826380958700", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18439017855540532958", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "15963038745470172423", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "3683201905077543598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 44) },
-            { "5179760459095053114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11855137287698046529", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15479071839425218367", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4701832665603867798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 618) },
-            { "9145357433824567384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 297) },
-            { "8797843396807284399", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "11544455862638831851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3296080624478711270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "15929970324703663357", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "3388752887767453958", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16181623411787179429", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6345550009198921347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "7780366826820540504", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4538102435488584866", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7129623351507828661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 723) },
-            { "16629493658542781988", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "14177187878748170225", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "4049276089777687996", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "143255828863957128", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12843671306854567956", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "2231648183489019418", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 428) },
-            { "8882042369902399339", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "676641023579624117", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "17009318615658405230", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "13194245601015251743", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "1641881628032037384", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "9529614587861271730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "17116941326889312928", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "14336344152455180534", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9559550404190168365", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8985531644129639832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "875296362957469305", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "10071611039987219440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17585210048585855482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "13558603350852076889", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "13839075443229327158", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "7570078010521452080", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7054270030260701612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "17564338309805484464", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 482) },
-            { "12847879935060092791", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "16483792160297698151", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "5343186686923330871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "2438221595194783178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "294103776081392899", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "689445825453914111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "4729855738455185191", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "6780215829176686721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "6355395905401306995", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6139574161497189424", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "14420809655798184553", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "1630585964216121575", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1014) },
-            { "7806129039150321333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9058996149754556268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "7630342538679060038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "9028970753877215614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "18383733736250135501", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15995056067568652754", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15129201859573664210", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14695781272831602408", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "12914986936318857086", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "3012268657922581268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "1160579996766519752", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14381420852659789698", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16522546805419218429", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "12992163255353386581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "13317417676446624018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "11071972036962275632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 727) },
-            { "1269703478898366518", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "6767245864232675168", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12517838703662330663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 756) },
-            { "11530101016435264783", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "16561224775421968533", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "1473214668483422172", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9052153145556623933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "14037325204801680738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "2482449683288477640", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6515141738021465336", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16245760498096322525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "12709406234969954619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "7963529808900784906", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "9890252170749328138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "5053369963163583573", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 856) },
-            { "14247451223653900488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "12698546873263218041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "10294185397756053636", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "3408249386342406615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9454028594043242985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 955) },
-            { "13401926003864565026", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "8058623285594809047", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "13624969243174329965", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3810356382905059819", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "1836277956961261472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "9164584153555521506", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10265955847846166394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "7291920886894073603", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 531) },
-            { "3191047205441946466", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "15862793522143880668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 878) },
-            { "11932770338770247767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 804) },
-            { "8434794604559592624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1006) },
-            { "11595387512434355394", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "17035903590837750750", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "3510837206834640871", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 369) },
-            { "6729785110495533200", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "14291113322487568376", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13611054146745413536", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11892210755884128272", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "844742962836593299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 675) },
-            { "11929531534620071758", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 612) },
-            { "11191005013126286532", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 552) },
-            { "13727643349589056375", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 439) },
-            { "11273168411455998347", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "3509027370372599394", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "14185215566042478462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 264) },
-            { "12927339938362960563", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "4801117903303888658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1078) },
-            { "1265277707626014051", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 714) },
-            { "9428176632140441528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "4491694127072416122", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 314) },
-            { "5340016094501559693", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "6150043972317126583", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 962) },
-            { "1071007164550012186", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 21) },
-            { "281287280558289393", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 979) },
-            { "4264078972561407296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "997155336931700015", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7552049239568474944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "3280795516668356985", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "8780604510524622314", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 893) },
-            { "7187734276051878356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5296506025538423220", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "6688522645556262131", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 993) },
-            { "13987250743654950733", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "15381014522874131924", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 665) },
-            { "11026432639515866259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "3625906783784771100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 671) },
-            { "9339038855869763548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "14907038741687299621", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "4206637285289830669", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9266375177690276615", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17543625777838573622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "5515216528474382598", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15641537661939240413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "18076129452098771655", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17106086048442658788", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5750277248295796439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 108) },
-            { "12815588500303820284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "10809330882739297269", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "11359020774437470164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "4476037346005841003", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13198480749588992978", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15452906059667613512", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4178614913813882037", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1435153323458789173", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "13312401790608349463", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11919579121199894437", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1027) },
-            { "7351443601143314161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "14418429155823196539", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "17301887391757619741", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 329) },
-            { "2801141274570069180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 509) },
-            { "9883682535839267422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "1686420552593340731", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 46) },
-            { "8898449752724034655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 731) },
-            { "830147122986411443", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8837079302496539409", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 591) },
-            { "40704767167309552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "2995957440356398418", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "4316278502963439894", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6149673627320838019", std::make_tuple("fully_connected_gpu_bs_f_bsv16_b1", 2) },
-            { "14645023135017806432", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13054706902087663592", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17372326727957287976", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "10554266898346470422", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "1779941298820543013", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 555) },
-            { "10168272404395268951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "9556219639756304369", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "906587812125311288", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "15406324750533549980", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "6410682026872155392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "6750003965952674453", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 210) },
-            { "9438739171104456179", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "4949865765880884373", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "11622271315873664622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "6278892144796112655", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1090447867763814054", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "11845504142528424662", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11661208196482963286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "16995919898822376726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "11354523117287453982", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3239779684432082106", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1080) },
-            { "15783558375979538895", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13853056718266488510", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 883) },
-            { "16605697831520435304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 746) },
-            { "625469553102754234", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "20037669704517227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "2328951328483718941", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10279778381617181802", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "9513403717116039597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12685978195521469707", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 189) },
-            { "12752101288912456176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 243) },
-            { "1294871956977733262", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15692223101958737604", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11453044274130869816", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12379734005351960619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5786828339670204894", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 276) },
-            { "4010650902230520983", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13583272198088247606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "15134268179029323647", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "7395593936948809439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 692) },
-            { "3349108500387301004", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "12407002532205454767", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "13439896617880328331", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1074) },
-            { "7004953121070642766", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "6644418194983229139", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "1027438463802481676", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10642327923162019888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "2242915551775617989", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 291) },
-            { "5061795324735006354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 639) },
-            { "8866736221671835567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "1421879144542252228", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "16978447917682236120", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "6771637612965430926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 749) },
-            { "4586246090279043149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17357800564047774826", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2008999755215725290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10916647716124396856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 201) },
-            { "981733129438741439", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 328) },
-            { "7211355951470869591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "5338109154207406041", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "5031342439443897167", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "16469788155263456039", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14249486431781112226", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 907) },
-            { "5424164608102708333", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11802527991096689252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "981197653890885407", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8612114608666892632", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "1019936903773818652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "13077961697656030315", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "8317140711232187781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "8169762955969255618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "123283730755186382", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5083776511235413204", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "5510336500642744696", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9625931001541723278", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "13538051178827008933", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "3985659568982275663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1124) },
-            { "7744787957569714828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "3378088934862423864", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7978370756654787278", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "5779388310240896974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 80) },
-            { "17340789730321673934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "7843833033404155302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 374) },
-            { "5670530004773188380", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "3159147743553063163", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "3128856679264648666", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17193614571243427089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15031089621161080026", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "15156015174611610705", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "8055193939726603877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 231) },
-            { "10598995451755327159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "13336847303794450665", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4992668316921598993", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "9220830217525628783", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8578747191812631883", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "14915908231779912828", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "4226968857681929488", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "9676055912997166605", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4369680877112803848", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "4745007371868123765", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "288825580282908143", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 101) },
-            { "16932172538978111342", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "13850807749756445264", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 477) },
-            { "778175413671462719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "9785114056964539323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 624) },
-            { "10704037259494193565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "11734299455885510243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 793) },
-            { "15395497315929884637", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1114) },
-            { "17769940507971546305", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "7246177123265734169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 332) },
-            { "14848351491062336554", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 583) },
-            { "14443599718173185176", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4217179485243909459", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13625877249040282040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "4236174000795439083", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "282274448389888221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "3526580286148537369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14257161696605459633", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 689) },
-            { "12529210672030682764", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "6768451741770053089", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15943174060386142134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 186) },
-            { "16415344078703911571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15822975685755664152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 999) },
-            { "6577240413312348523", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "11668043528929060706", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15379595951542162189", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2056766012044921101", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "2384942244346844027", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "6400671582981760192", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9746964858035717775", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "7164580481046523192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 914) },
-            { "2100891581797371600", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 274) },
-            { "9583760104223104233", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "13956744866244022582", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14403780921831769097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12956535344568057480", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 84) },
-            { "1753515740487760297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "10160082844961863335", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 199) },
-            { "11875516764635427358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 133) },
-            { "12242618640422208652", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "12761366575293006784", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "15051114821536746998", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "6706802683366112205", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "3661305534604931936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3598116387801985039", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 676) },
-            { "12478421208861550581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "4750894407873652809", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "13066055561434178894", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 981) },
-            { "18160969423211875528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "104321144590863458", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9008848676120441863", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4695273549696315193", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14281201038135286621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 627) },
-            { "4563773888811395621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5351705572686943348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "2647922515901529845", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "296202142406900242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "16094174852600023296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "13342769641176584743", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "10468562355439385073", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 708) },
-            { "4503960445974334415", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 805) },
-            { "3120553928584920777", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 578) },
-            { "9492331996847106233", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "7107513718824525169", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "11376522803174788945", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1772363899841601255", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 938) },
-            { "16715151641337602113", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7997955859883990923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 126) },
-            { "6474882514032493642", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13348855287761849180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15922076723067110929", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "3980754726678047241", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "9794061741834174000", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "7869916853707978306", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "7410220112400588068", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12323840136934980793", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "13110173649734084688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "13411431109933021193", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9152451371616153112", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "3590316457726550768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "12942085219027232135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 587) },
-            { "4818231379191523896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 290) },
-            { "8981229334098733320", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "583303098958523195", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "14682537852514419239", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1884327428051733366", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10049571207493913006", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 968) },
-            { "2301409406426420354", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11091004452522208782", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "7353563160591978243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "12386437738920143482", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "1660279112011537957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            { "6483208845600234755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "15239764240622554314", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "14729854278671832528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "16122815225820081176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "14131851237755716991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 364) },
-            { "10599639229366933472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 629) },
-            { "11674725184029885494", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "12225119940380026093", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1034) },
-            { "10908411570889102154", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15227034948424983496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "17659601542171299562", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "12895496994338720556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "2506154888542197909", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 860) },
-            { "15824189967727245909", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12040626513219974957", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "11534123522633460320", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11922163303962372849", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11357813056434049302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "2950917846016525392", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1122) },
-            { "15156525717629023944", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 705) },
-            { "6172851296465788161", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "6432519735121751346", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14685573786743639408", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3928266232090746643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "11141999085710526242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "8951503172834790833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13498795599230228492", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 502) },
-            { "16815680874311765189", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13886526360627032217", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1073) },
-            { "10476627457539425144", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10110395703775498948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 376) },
-            { "15897477855246170861", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17065380294456704620", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 535) },
-            { "13441117085490814804", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "272730229972987861", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1034) },
-            { "13698389420396031586", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "14601912265050074833", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5816730482014477109", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "14821616804286068969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "10016243001407196485", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1502236537645808646", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "852092858392507925", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "14682894856346977838", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "15354185859262170540", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            });
-        td.td.insert({
-            { "60749853744407778", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5032866547826271476", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 252) },
-            { "12630173933512965589", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3297036980627776719", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17160915544701715607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13285123703712436126", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "682912708716537431", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14454927839795553295", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "16039372573821594566", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9929060811766882316", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1009) },
-            { "11455843788148231615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1004) },
-            { "7043547563530810431", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "11546295514640813785", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7693556065684619275", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 568) },
-            { "16129296588866116913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "8618835732380720921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "11906319144823550582", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "16589607587365212240", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "815847426244665239", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9148379585489720669", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 845) },
-            { "4212194737559719449", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2352142833866194508", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "7924408980408826942", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "568114041320772862", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10616832946298118456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14581447673401303181", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "26773921190137993", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "969746749329671447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "3762117189312286955", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17453621319901961773", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 139) },
-            { "4565037760028957581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 852) },
-            { "15578217564714846277", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "8697631439739291302", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 633) },
-            { "7313000297447719088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13993319023992950944", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11796671083187280457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1106) },
-            { "15637565679147396649", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 891) },
-            { "4806571630436601566", std::make_tuple("fully_connected_gpu_bf_io_input_spatial", 4) },
-            { "14385995236701277049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "6031307393395339699", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "7000524935770116969", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "15432337846778101995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "2722601800398376127", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "15616954046484566002", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15830721134654889992", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 909) },
-            { "7974918595373182037", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "8178825467227185946", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "386749666417295495", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "13102754309439605192", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18372284940315010254", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "13691555384698806010", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15863633107759120207", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12511186263003392018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "9954050478761346921", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 975) },
-            { "11686670048744589243", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15168098632351740923", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "16650590194585316886", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "2743892624333411461", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "17177353407003831190", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3292554262586950764", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5635504912415420460", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "11716771904412649891", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 52) },
-            { "3002986032379998259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 151) },
-            { "10309083227104422150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 616) },
-            { "11067412830219638639", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "14865708345458193472", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1008) },
-            { "15464714725848277081", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "10716913534741102635", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 483) },
-            { "3596159214965874273", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "11210961619302975072", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8319405652132127420", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "9980945809859857871", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13858485871773319706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "13319880343534837963", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6983900601570231321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "11897886369869427808", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8048617952947915835", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16540183777173974162", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7852745450437172519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4862529593282936100", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "17052596472114345717", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 707) },
-            { "7732899312577293959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 322) },
-            { "12458305535453345462", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13255006150107668739", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17097621900023182992", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14523905821262502926", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "5687802882700097624", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "11115684531624462986", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "16162899163122139501", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "15891505875671050928", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10271474583233390474", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 155) },
-            { "4640696923527766618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1105) },
-            { "13473730516782884152", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9245770108138984525", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "4959718589070770515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "3934290309368153435", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "13234170505677988638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "45545661884854912", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1051) },
-            { "5311718276151327830", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 127) },
-            { "12896159402462325805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 888) },
-            { "14647949921048404551", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 245) },
-            { "9979259596137305973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "5327803911898085293", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "10196332102593337214", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "4793007249026943006", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "11012846743944132853", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4713580645061462578", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 837) },
-            { "11576182324195008022", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "9673176853197584682", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3935404533406270186", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "13358754652597677285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 674) },
-            { "5246229312484886433", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1107) },
-            { "15939309688773899430", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3805854200552708060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "5219048275475447369", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2832331506191733785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "710656784939783221", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "8306931146242110738", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1095) },
-            { "118898027441804310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12894240573737168362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 941) },
-            { "7941359635463232326", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "18418073826375395057", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3935174650108042053", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "10989937450490049763", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "288853243482418538", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "10930115765550856328", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 253) },
-            { "7994179151788368291", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 933) },
-            { "5342657840254586591", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16744011463988595802", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "6025872155179042054", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9562291747339451180", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "8739570656208259296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 737) },
-            { "7086554406050778468", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16342158355942808662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "15887938842582811165", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 338) },
-            { "4211445170027080823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 717) },
-            { "3272017687600371031", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18118237182023167949", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "15487538714246568015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "17641726060706984007", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 342) },
-            { "8449108317864057899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "16536775289334717044", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 431) },
-            { "13150876648527896999", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1076) },
-            { "12223993560805441284", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8779987507326777359", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8215519118071138614", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9069245927173134634", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "1201692134690347847", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "3120885087070223590", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "6728889146307098720", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14004618842373739106", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16741985699154392565", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "8176520928011006903", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "14213127286928643795", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1336477297334930004", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "12565318283493666631", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1043) },
-            { "11901687795497708884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 721) },
-            { "11858246418724176452", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "17355826643208208691", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1573498199681662714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "1204089510255285420", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7727001441358508665", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 22) },
-            { "12621528958448913800", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1941341635794709702", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 255) },
-            { "2768512766772748723", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "15579919505002150556", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "16352438188558979362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 588) },
-            { "3594327736281012643", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 299) },
-            { "8281411537393664160", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "8843585527713905568", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 598) },
-            { "11152834864013527469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 220) },
-            { "5384134329664434112", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1063) },
-            { "16749148369456398030", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "10522649794540845800", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "17197868427757781334", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 605) },
-            { "14463841899941062548", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "8734220847509054149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "15597522934012485452", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "8770858724416759637", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3651651926851660222", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "1460916897832302487", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2251572761614039612", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "17503210896556316294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 208) },
-            { "12308359047798183133", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 548) },
-            { "14547907449418439737", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "15618891972122000521", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "11771014003680394135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "10380031655567712558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "9516288831713776693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "13550337096609413041", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17459500507201824299", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 345) },
-            { "18379763351534914922", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 140) },
-            { "1509728225855233852", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15993427814066246646", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7781809277449433812", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9003196270667188479", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3034466284781235431", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 159) },
-            { "11198378813600875939", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "5509852360472061267", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "11682323163346544125", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 797) },
-            { "1239861345413267621", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1720791539242542292", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "2419819939573989749", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 2) },
-            { "4062706195708729345", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "9390919808369333231", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11882021989615795558", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 381) },
-            { "4003468969524607815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "12169148580322697755", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "3750338655074082587", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "14524678598440880756", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 832) },
-            { "5336120047683197088", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14592395793778583608", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1087) },
-            { "1781189282179491198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "16587387608532583713", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "11205571992835612111", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "14674266217397415571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8642397690605957294", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 244) },
-            { "172303227623890951", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 156) },
-            { "17855733925989425515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "13982221711075598070", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 957) },
-            { "13337122303005980542", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 344) },
-            { "5134857932624749530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8740196547852036537", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9781830607177020570", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "11297512843662536362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "16071030448801649281", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "4160656836528944651", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "13713501506522022845", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "4034250407843183678", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3661361503342294227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "7247891577022043949", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15628121900226431719", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11992353959766718397", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 178) },
-            { "8734419426540206087", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 383) },
-            { "2559310381697374321", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "6659313690133629176", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "7617123358753247310", std::make_tuple("fully_connected_gpu_fb_io_ref", 2) },
-            { "10784905418636316601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "7999747927804607567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "14670952132900619664", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "4276712095427918904", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "3806791682244402910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1088) },
-            { "11879484013890539145", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "9287404618748313247", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11149782181562145291", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13952295742818866246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 885) },
-            { "7638626850074132214", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "4544242784357021697", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2094546483928406874", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "3831201505512446456", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14097319816812992451", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "8268533335852735248", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "7279393739634103483", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "38736266675995457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "13661880440426932218", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "7590767013583950613", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "1617362484243823916", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1028) },
-            { "5659168916726488798", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "1559798212423183813", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 935) },
-            { "14491949194619001237", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 813) },
-            { "8819268903800581706", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "16320454719906370247", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 325) },
-            { "10972033292930619311", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "16230621843665445228", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "8892991171111842341", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "323234725943768094", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1005) },
-            { "4670443882075998209", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "15287650965861631130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1015) },
-            { "15818237122613168508", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "6542486391263861823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "15938703221521364046", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "8333743604646422982", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "5334291640387922287", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 358) },
-            { "4800208854712166990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "16590893345666612869", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 256) },
-            { "12601126285773042005", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1055) },
-            { "3012566432840424198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "14733291836016183044", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15494543914974994991", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 180) },
-            { "1081287304647703427", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 333) },
-            { "11609821372586026178", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "1698321314111848001", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 530) },
-            { "10961049607808752432", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "6161072079255825074", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10392013312924273545", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1111) },
-            { "10400727836871462348", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "11494395549955384747", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "3329610414149222728", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "8986253016099337778", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 330) },
-            { "12606196670791209919", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "13484950419220835364", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 699) },
-            { "8863731258634577277", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2586132860307138964", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2844746478867668588", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12553441041059632729", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "5485971317082563152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 252) },
-            { "1400089266180918877", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1077) },
-            { "17522452942286240233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7947870656736319919", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 49) },
-            { "15417738436777481469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 634) },
-            { "4917595053453614536", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 983) },
-            { "14603590053512154268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1002) },
-            { "5688623850477433571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17790026124881397912", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "4112696777811320312", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 995) },
-            { "1474271081523145413", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10773411423039491193", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11809236497308682596", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "2146633923143071497", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "2968144776497288135", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "3311449696894745049", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 796) },
-            { "17472252137354770318", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 462) },
-            { "7271236108345900406", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "17024388383581997032", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 584) },
-            { "3691705516240577130", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "7026575758396092435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 172) },
-            { "15898888434295644774", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "13046322179198317310", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 883) },
-            { "11897113890115321056", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "15661055655577513377", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 1) },
-            { "12965800692507042874", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "287386909600391846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 497) },
-            { "14800933038795670868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "10721811813682112908", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 710) },
-            { "14762859593402798050", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4561874206785244358", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "15972805725107234322", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 930) },
-            { "11140864132614066113", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "822162932339827810", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 794) },
-            { "2909728331855309274", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "16261543808418336089", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "15228614030349540878", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6335628260431943016", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 906) },
-            { "6545814945227676265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3007505068107685147", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 5) },
-            { "13722424507812159961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 227) },
-            { "6418327009347170687", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "15659671804906879034", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15893297349596399716", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6612243861034102250", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "3913951712614107871", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "2546472090573813082", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "1013207188944763398", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2679903779216253668", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "11409066626289209846", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 351) },
-            { "7386836350136973872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "16211466749116679534", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "1403373982815401451", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7126601602274920416", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8790625191540101806", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11914756126771310827", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "17224820843490443805", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "13683563727561197895", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 331) },
-            { "14159293183840880884", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1011) },
-            { "14763982961176216679", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 576) },
-            { "11885660439698926227", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "13448159575961515854", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "13779700363254765602", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "18125075313255528454", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 959) },
-            { "17252449599613270108", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "2260718905219541967", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 704) },
-            { "5688161172644782612", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "12896164738668798380", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "5635500901926740475", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "17691748026963003695", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 261) },
-            { "3513523165606656242", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "15754688305730191542", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 557) },
-            { "37061093840513038", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "6830643729780599672", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "13865227850818392065", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 40) },
-            { "8779164026828163571", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "352808518345312040", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 619) },
-            { "4014667229872705228", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "16835545111241063900", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "9343876424591024597", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "11092828091552833150", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 799) },
-            { "16705621644424684055", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "3064765745900772872", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "2008064690158516711", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11447737411040418462", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 295) },
-            { "16485921493309285440", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17465517455679097501", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "7589346100701197023", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "16615858951735101760", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "13551767519605460627", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 355) },
-            { "3830091089824446164", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "5758223108250439377", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "4399656162365214694", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 251) },
-            { "15571801737237063594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "6236857636305802170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "8769060267707904998", std::make_tuple("convolution_gpu_winograd_6x3_s1_fused", 2) },
-            { "1334070221835422461", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8631194673451861459", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "3392632422002516166", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1079) },
-            { "9402935157379983392", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "10001963042016663554", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "13680502636898130714", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "5503904988517480229", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 701) },
-            { "9561367273233389233", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "17495070522944546801", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 679) },
-            { "5176939691838030517", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 259) },
-            { "4942131377140353094", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "14946519992043402896", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 607) },
-            { "5398895598407183682", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12478309735214802531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 467) },
-            { "13753670205703732353", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 690) },
-            { "2148648022160178995", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1125) },
-            { "6772239376357727149", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "596528462327775677", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 687) },
-            { "7512702933193596918", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "9644723852089512961", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "264371219192743152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "8663545677000846511", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1117) },
-            { "7200893702912130808", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "5718747983756317198", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2850803473613487020", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "2335783507270234825", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "3088402690095697589", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 595) },
-            { "10112032316939871435", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "1211404528755199615", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11521288355888665606", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "4673127824919879657", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "15816980369722540994", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 157) },
-            { "5781431860747226742", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15365776263895633531", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 601) },
-            { "3389739049224815652", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "7877637636782924097", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "18398231411109020099", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "17520777331163825810", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16462862831307415504", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "5348059680010171141", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7289907211627391947", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 631) },
-            { "5378151578014945610", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 354) },
-            { "5629582391075745771", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 652) },
-            { "11607736973932389832", std::make_tuple("convolution_gpu_bfyx_gemm_like", 0) },
-            { "2598910952085172410", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "1628593159980574595", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 622) },
-            { "17342603054992556378", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 960) },
-            { "3332444589775844154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "4136736579788862192", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 0) },
-            { "13161798453564436688", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "18429276095695345973", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 204) },
-            { "2653651564133701304", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "15962533525948221648", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "9539616823548370185", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "9914440875772341708", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14484004336536993120", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 367) },
-            { "10978173291465325823", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 798) },
-            { "7065121716452374910", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 792) },
-            { "9839670675413379092", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8854234880878427078", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "1194267934213722567", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 892) },
-            { "2387389473399444503", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 678) },
-            { "10775785602937893911", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "7875724726741958520", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "8124166677361481618", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "5057534502588100071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1119) },
-            { "9267417754412894234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 361) },
-            { "14389915292223442327", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 459) },
-            { "5896089609470353090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "2908249767551054613", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 641) },
-            { "5119087113905313336", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "4104062066031480003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "3600066510593746268", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 534) },
-            { "16998508915819714690", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 577) },
-            { "10857567623940140266", std::make_tuple("fully_connected_gpu_fb_io_ref", 1) },
-            { "18199526506796726885", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "5149553691611520515", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "11311890411536750673", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "3974589991022739479", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "859377216693940737", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2915952195141872726", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 978) },
-            { "9274179337770060652", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 326) },
-            { "14142812374094816721", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 719) },
-            { "8100595788531468781", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 2) },
-            { "12994819742376207273", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "12057000101434512661", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "11047759270093007856", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 83) },
-            { "15688186132508213638", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 324) },
-            { "12715500118796263683", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2830742500858558621", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 751) },
-            { "12445292008737311977", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15158997684077722015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 49) },
-            { "13004055504657277105", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1101) },
-            { "8347537383976709519", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 805) },
-            { "13398875754083902831", std::make_tuple("fully_connected_gpu_yxfb_ref", 2) },
-            { "16450345154125804290", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 183) },
-            { "10900880512948479338", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6418748992581951435", std::make_tuple("fully_connected_gpu_bs_f_bsv8_af8_vload", 1) },
-            { "5848293219267886434", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "17882819773586674851", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 135) },
-            { "12642701787250074691", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 343) },
-            { "4642402648038764246", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 181) },
-            { "17026348860895225619", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 313) },
-            { "4554398307153171456", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "4445257000541366640", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 416) },
-            { "4682062886371423209", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8337457116169698090", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "14969813450703071948", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "14167086447992316314", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            });
-        td.td.insert({
-            { "1961348920992050029", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 484) },
-            { "8650948093564284852", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1003) },
-            { "2171768477223405739", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1085) },
-            { "13204120207726209723", std::make_tuple("fully_connected_gpu_bf_io_gemm", 2) },
-            { "14218701503304823803", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 366) },
-            { "16402312692470500253", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "541744773413565297", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "18173314625562011976", std::make_tuple("convolution_gpu_bfyx_depthwise_weights_lwg", 2) },
-            { "14224121742920800990", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 839) },
-            { "13647773816638053437", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1143214652021653634", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 859) },
-            { "3300655231758263066", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1118) },
-            { "13985989113434682460", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16576300898841314587", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "4082218299236753259", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 334) },
-            { "3138712043201001156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9493034132406318197", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 956) },
-            { "2984236836610169934", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 142) },
-            { "18419183012101393192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "16969463538496570528", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1084) },
-            { "9351428703239678614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 980) },
-            { "17546650302679801134", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 743) },
-            { "5089359404080552270", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1007) },
-            { "11970881115757095265", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1066) },
-            { "5890683283363730941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "6678101356115372537", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "1838534101161814609", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 499) },
-            { "17646394278957547470", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "2651385050387738902", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "7875272450497189442", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 425) },
-            { "4792657031481471098", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 352) },
-            { "13423515205322319913", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "1431307776181554710", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8146945902795164796", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 698) },
-            { "9771430089730856496", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 141) },
-            { "17308907916370632622", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "13374993751390784382", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1070) },
-            { "13435416060730279243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 741) },
-            { "10842505566649585090", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "6326191473779365124", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2705534741438659581", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 475) },
-            { "17050143605017295447", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "11307721164906705899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1075) },
-            { "11352094952907979172", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 375) },
-            { "14512311371993445906", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 734) },
-            { "13076343553185159307", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "2832311883163804015", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 976) },
-            { "3182329375739242693", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "1077773457856682663", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 218) },
-            { "17294244481988344762", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "5401946420641519048", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 582) },
-            { "10526411638069090068", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 211) },
-            { "8181704316455400709", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "16462033126494826292", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12547252593506448096", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 82) },
-            { "5321807316257768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 963) },
-            { "1071663904249509302", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "1878953827218615252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "8321769923556905957", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "7053070767227498983", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 696) },
-            { "12318427976031000768", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 262) },
-            { "3060709449176556770", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 636) },
-            { "16936366288366370882", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15485701086886851362", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 931) },
-            { "14741012384358891350", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 911) },
-            { "3626743386403140330", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "16134637021630473012", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "15026219694198820614", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 835) },
-            { "15671873744670386067", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 143) },
-            { "2870715678422088243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 759) },
-            { "5103094815475470596", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 498) },
-            { "3430998232987873998", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1083) },
-            { "1127844465496534455", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "15958017891397409552", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "13477416097954638887", std::make_tuple("fully_connected_gpu_bf_io_gemm", 1) },
-            { "2010255131587843361", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "11679869968143173159", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 107) },
-            { "1154469970162137785", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 214) },
-            { "14762599606783897222", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 242) },
-            { "4994591211723226974", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 606) },
-            { "8260689555974656662", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 579) },
-            { "11206468937763516689", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "1265107284215037966", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "6616869272699525153", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "6953499208425592115", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 87) },
-            { "879896719155824868", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "10111038481447198008", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1127) },
-            { "6519443541076418301", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1053) },
-            { "11636129433022017868", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 589) },
-            { "7253709516917901897", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 637) },
-            { "10236258478395201152", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 206) },
-            { "15513894336778253285", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "8942221095468681112", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "13410850301164057911", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 252) },
-            { "6571438978296387721", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2020044486043617858", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 335) },
-            { "14233219774448115529", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9770300588867836071", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 725) },
-            { "191374388179598660", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "4184357870886924038", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 461) },
-            { "6235132681081375078", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 838) },
-            { "13297875917250935192", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1104) },
-            { "14577775579978745344", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "9724624621108712962", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 836) },
-            { "17638692805430115529", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 709) },
-            { "9729771183572950642", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "11327228813412934262", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 702) },
-            { "9212091835906796243", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 895) },
-            { "8528750110601691390", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "4737347018334654530", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 94) },
-            { "17829854042305231384", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "17798636687709019154", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 44) },
-            { "8571662320744858201", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1093) },
-            { "5828768432282043413", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "3685556976073096544", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 312) },
-            { "8047078039937885319", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "14691372262153587653", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 294) },
-            { "18062849937960759210", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "4366043672240989175", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 711) },
-            { "6148022455516485135", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "2932914865200583326", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13225520357177380691", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8709632541892447149", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5261762234237034874", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "3102816736961785641", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 874) },
-            { "5409329687010951601", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1013) },
-            { "10885752780697269323", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 967) },
-            { "4577872082734403187", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "9614300332487270888", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 226) },
-            { "6997121306455110286", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 580) },
-            { "1071090704302849258", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "937763627727362899", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1086) },
-            { "6146876760962332928", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "9723314434598141024", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1010) },
-            { "5185125307593023170", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 356) },
-            { "11933283931932057859", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "18120169120088482114", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 669) },
-            { "17774424004510360936", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 795) },
-            { "16541535256432192398", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4646176801168621136", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 728) },
-            { "7130694811424715594", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1110) },
-            { "3119045125726216156", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "141166664952282933", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "220326805056361171", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 952) },
-            { "8228641750970480948", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 954) },
-            { "835367600773871252", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 463) },
-            { "15114370307779942381", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 1) },
-            { "17962578815194404362", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "4831224999851230245", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 349) },
-            { "6812025576584060234", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 86) },
-            { "9601849246293120347", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15156805695359911457", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 519) },
-            { "16295660312557315941", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 953) },
-            { "4515798403196565084", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "8122815203088327658", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 638) },
-            { "5962764672151728219", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1108) },
-            { "2622434279674583815", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 221) },
-            { "2582625260054352916", std::make_tuple("convolution_gpu_bfyx_gemm_like", 1) },
-            { "8809794528993445200", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 2) },
-            { "13660015013041074867", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5948701218437980356", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "15548971488532746290", std::make_tuple("convolution_gpu_bfyx_direct_10_12_16", 0) },
-            { "10800323158234163234", std::make_tuple("fully_connected_gpu_fb_oi_ref", 2) },
-            { "6876164425008541018", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 205) },
-            { "14652791434312888296", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 697) },
-            { "5594180958505308003", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 249) },
-            { "12942776337163777730", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "16884228931101540030", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "5629670679897666607", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 1012) },
-            { "14878347463243157447", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 742) },
-            { "15488550074426713959", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 982) },
-            { "18331981707436752260", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 341) },
-            { "59739211822469868", std::make_tuple("convolution_gpu_bfyx_1x1_hgemm_buf_16x1", 2) },
-            { "15765198153800696060", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 460) },
-            { "11169292427557543138", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 581) },
-            { "9628735886189157469", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 703) },
-            { "4569338575782832784", std::make_tuple("convolution_gpu_bfyx_gemm_like", 2) },
-            { "12854272540346358832", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 890) },
-            { "11831092915967558428", std::make_tuple("convolution_gpu_bfyx_os_iyx_osv16", 647) },
-            });
-    }
-}
\ No newline at end of file
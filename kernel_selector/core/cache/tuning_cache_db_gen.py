@@ -0,0 +1,179 @@
+#!/usr/bin/python
+
+# Converts tuning data to the binary tuning database read by kernel_selector::tuning_cache_db
+# and the binary database to C include file which is embedded into the kernel selector.
+#
+# Sources of tuning data:
+#   -cpp_cache DIR    legacy generated cache_*.cpp files (td.insert({ {"hash", std::make_tuple("kernel", idx)}, ...}))
+#   -online FILE      tuning files written in TUNING_TUNE_AND_CACHE mode (compute units, driver and host versions
+#                     in first three lines followed by "hash kernel index" lines)
+#   -db FILE          existing binary tuning databases
+# Data from all sources is merged, the first entry for given compute units count and hash wins. Sources are read
+# from the freshest to the oldest: on-line tuning files, legacy cache files, then existing databases.
+#
+# Binary layout (little-endian):
+#   header:   char magic[8] = "CLDNNTDB", uint32 version, uint32 sections count, uint32 names count, uint32 reserved
+#   sections: { uint32 compute units, uint32 first entry, uint32 entries count, uint32 reserved } sorted by compute units
+#   entries:  { uint64 hash, uint32 kernel name id, int32 tune index } sorted by hash within section
+#   names:    { uint32 offset, uint32 length } per name, followed by names blob
+
+from __future__ import print_function
+import os
+import re
+import glob
+import struct
+import argparse
+
+MAGIC = b'CLDNNTDB'
+VERSION = 1
+HEADER = struct.Struct('<8sIIII')
+SECTION = struct.Struct('<IIII')
+ENTRY = struct.Struct('<QIi')
+NAME = struct.Struct('<II')
+
+
+class TuningData(object):
+
+    def __init__(self):
+        self.sections = {} # compute units -> { hash -> (kernel name, tune index) }
+
+    def add(self, compute_units, hash_value, kernel_name, tune_index):
+        section = self.sections.setdefault(compute_units, {})
+        if hash_value not in section:
+            section[hash_value] = (kernel_name, tune_index)
+
+    def entries_count(self):
+        return sum(len(s) for s in self.sections.values())
+
+    def load_cpp_cache(self, cache_dir):
+        func_re = re.compile(r'void\s+tuning_cache_(\w+)\s*\(\s*tuning_data\s*&\s*td\s*\)\s*\{')
+        call_re = re.compile(r'tuning_cache_(\w+)\s*\(\s*td\s*\)\s*;')
+        entry_re = re.compile(r'\{\s*"(\d+)"\s*,\s*std::make_tuple\(\s*"(\w+)"\s*,\s*(-?\d+)\s*\)\s*\}')
+
+        # function name -> ordered list of ('call', name) / ('entry', hash, kernel, index)
+        functions = {}
+        for filename in sorted(glob.glob(os.path.join(cache_dir, 'cache_*.cpp'))):
+            with open(filename) as f:
+                content = f.read()
+            matches = list(func_re.finditer(content))
+            for i, m in enumerate(matches):
+                end = matches[i + 1].start() if i + 1 < len(matches) else len(content)
+                body = content[m.end():end]
+                ops = []
+                for op in re.finditer(r'{}|{}'.format(call_re.pattern, entry_re.pattern), body):
+                    if op.group(1) is not None:
+                        ops.append(('call', op.group(1)))
+                    else:
+                        ops.append(('entry', int(op.group(2)), op.group(3), int(op.group(4))))
+                functions[m.group(1)] = ops
+
+        called = set(op[1] for ops in functions.values() for op in ops if op[0] == 'call')
+        for name in sorted(functions):
+            if name in called or not name.isdigit():
+                continue
+            self._add_cpp_function(int(name), name, functions)
+
+    def _add_cpp_function(self, compute_units, name, functions):
+        for op in functions[name]:
+            if op[0] == 'call':
+                self._add_cpp_function(compute_units, op[1], functions)
+            else:
+                self.add(compute_units, op[1], op[2], op[3])
+
+    def load_online_file(self, filename):
+        with open(filename) as f:
+            lines = [l.strip() for l in f.readlines()]
+        if len(lines) < 3:
+            raise RuntimeError('{}: bad tuning file structure'.format(filename))
+        compute_units = int(lines[0])
+        for line in lines[3:]:
+            if not line:
+                continue
+            hash_value, kernel_name, tune_index = line.split()
+            self.add(compute_units, int(hash_value), kernel_name, int(tune_index))
+
+    def load_db(self, filename):
+        with open(filename, 'rb') as f:
+            data = f.read()
+        magic, version, sections_count, names_count, _ = HEADER.unpack_from(data, 0)
+        if magic != MAGIC or version != VERSION:
+            raise RuntimeError('{}: not a tuning database'.format(filename))
+        sections_offset = HEADER.size
+        entries_offset = sections_offset + sections_count * SECTION.size
+        sections = [SECTION.unpack_from(data, sections_offset + i * SECTION.size) for i in range(sections_count)]
+        entries_count = sum(s[2] for s in sections)
+        names_offset = entries_offset + entries_count * ENTRY.size
+        blob_offset = names_offset + names_count * NAME.size
+        names = []
+        for i in range(names_count):
+            offset, length = NAME.unpack_from(data, names_offset + i * NAME.size)
+            names.append(data[blob_offset + offset:blob_offset + offset + length].decode('ascii'))
+        for compute_units, first, count, _ in sections:
+            for i in range(first, first + count):
+                hash_value, name_id, tune_index = ENTRY.unpack_from(data, entries_offset + i * ENTRY.size)
+                self.add(compute_units, hash_value, names[name_id], tune_index)
+
+    def serialize(self):
+        names = sorted(set(v[0] for s in self.sections.values() for v in s.values()))
+        name_ids = dict((n, i) for i, n in enumerate(names))
+
+        sections = b''
+        entries = b''
+        first = 0
+        for compute_units in sorted(self.sections):
+            section = self.sections[compute_units]
+            sections += SECTION.pack(compute_units, first, len(section), 0)
+            for hash_value in sorted(section):
+                kernel_name, tune_index = section[hash_value]
+                entries += ENTRY.pack(hash_value, name_ids[kernel_name], tune_index)
+            first += len(section)
+
+        names_table = b''
+        blob = b''
+        for n in names:
+            encoded = n.encode('ascii')
+            names_table += NAME.pack(len(blob), len(encoded))
+            blob += encoded
+
+        header = HEADER.pack(MAGIC, VERSION, len(self.sections), len(names), 0)
+        return header + sections + entries + names_table + blob
+
+
+def write_inc(data, filename):
+    res = '// This file is autogenerated by tuning_cache_db_gen.py, all changes to this file will be undone\n\n'
+    values = bytearray(data)
+    for i in range(0, len(values), 32):
+        res += ','.join(str(b) for b in values[i:i + 32]) + ',\n'
+    with open(filename, 'w') as out_file:
+        out_file.write(res)
+
+
+def main():
+    ap = argparse.ArgumentParser()
+    ap.add_argument('-cpp_cache', metavar='PATH', help='The path to folder with legacy cache_*.cpp files')
+    ap.add_argument('-online', metavar='PATH', nargs='*', default=[], help='On-line tuning files')
+    ap.add_argument('-db', metavar='PATH', nargs='*', default=[], help='Binary tuning databases')
+    ap.add_argument('-out_db', metavar='PATH', help='Output binary tuning database')
+    ap.add_argument('-out_path', metavar='PATH', help='The path to folder with generated include file')
+    ap.add_argument('-out_file_name', metavar='PATH', help='Generated include file name')
+    args = ap.parse_args()
+
+    data = TuningData()
+    for online in args.online:
+        data.load_online_file(online)
+    if args.cpp_cache:
+        data.load_cpp_cache(args.cpp_cache)
+    for db in args.db:
+        data.load_db(db)
+
+    serialized = data.serialize()
+    print('tuning database: {} sections, {} entries, {} bytes'.format(len(data.sections), data.entries_count(), len(serialized)))
+
+    if args.out_db:
+        with open(args.out_db, 'wb') as out_file:
+            out_file.write(serialized)
+    if args.out_path and args.out_file_name:
+        write_inc(serialized, os.path.join(args.out_path, args.out_file_name))
+
+if __name__ == '__main__':
+    main()
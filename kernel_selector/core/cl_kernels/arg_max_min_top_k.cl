@@ -0,0 +1,176 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+// Work-group handles one set of VALUES_NUM values placed GAP_SIZE elements apart. (value, index) pairs are
+// sorted in local memory with a bitonic network; sets bigger than SORT_SIZE are processed chunk by chunk,
+// each new chunk is sorted together with the best TOP_K pairs of the previous ones.
+
+#ifdef XYF_AXIS
+    #define GAP_SIZE 1
+    #define FIRST_DIM_SIZE 1
+    #define SECOND_DIM_SIZE 1
+    #define FIRST_DIM_MUL 0
+    #define SECOND_DIM_MUL 0
+    #define THIRD_DIM_MUL VALUES_NUM
+#endif
+#ifdef BATCH_AXIS
+    #define GAP_SIZE (INPUT0_FEATURE_NUM * INPUT0_SIZE_X * INPUT0_SIZE_Y)
+    #define FIRST_DIM_SIZE INPUT0_SIZE_X
+    #define SECOND_DIM_SIZE INPUT0_SIZE_Y
+    #define FIRST_DIM_MUL 1
+    #define SECOND_DIM_MUL INPUT0_SIZE_X
+    #define THIRD_DIM_MUL (INPUT0_SIZE_X * INPUT0_SIZE_Y)
+#endif
+#ifdef FEATURE_AXIS
+    #define GAP_SIZE (INPUT0_SIZE_X * INPUT0_SIZE_Y)
+    #define FIRST_DIM_SIZE INPUT0_SIZE_X
+    #define SECOND_DIM_SIZE INPUT0_SIZE_Y
+    #define FIRST_DIM_MUL 1
+    #define SECOND_DIM_MUL INPUT0_SIZE_X
+    #define THIRD_DIM_MUL (INPUT0_SIZE_X * INPUT0_SIZE_Y * INPUT0_FEATURE_NUM)
+#endif
+#ifdef Y_AXIS
+    #define GAP_SIZE INPUT0_SIZE_X
+    #define FIRST_DIM_SIZE INPUT0_SIZE_X
+    #define SECOND_DIM_SIZE INPUT0_FEATURE_NUM
+    #define FIRST_DIM_MUL 1
+    #define SECOND_DIM_MUL (INPUT0_SIZE_Y * INPUT0_SIZE_X)
+    #define THIRD_DIM_MUL (INPUT0_SIZE_X * INPUT0_SIZE_Y * INPUT0_FEATURE_NUM)
+#endif
+#ifdef X_AXIS
+    #define GAP_SIZE 1
+    #define FIRST_DIM_SIZE INPUT0_SIZE_Y
+    #define SECOND_DIM_SIZE INPUT0_FEATURE_NUM
+    #define FIRST_DIM_MUL INPUT0_SIZE_X
+    #define SECOND_DIM_MUL (INPUT0_SIZE_Y * INPUT0_SIZE_X)
+    #define THIRD_DIM_MUL (INPUT0_SIZE_X * INPUT0_SIZE_Y * INPUT0_FEATURE_NUM)
+#endif
+
+#ifdef MAX_OUT
+    #define FILL_VAL (-INFINITY)
+    #define IS_BETTER(a, b) ((a) > (b))
+#else
+    #define FILL_VAL INFINITY
+    #define IS_BETTER(a, b) ((a) < (b))
+#endif
+
+// Strict order of the pairs: better value first, lower index first among equal values (padding has the
+// largest index), so ties are resolved the same way on every run.
+#define IS_BEFORE(val_a, idx_a, val_b, idx_b) (IS_BETTER(val_a, val_b) || ((val_a) == (val_b) && (idx_a) < (idx_b)))
+
+inline void FUNC(bitonic_sort)(__local float* values, __local uint* indices)
+{
+    const uint lid = (uint)get_local_id(0);
+
+    for (uint size = 2; size <= SORT_SIZE; size *= 2)
+    {
+        for (uint stride = size / 2; stride > 0; stride /= 2)
+        {
+            for (uint p = lid; p < SORT_SIZE / 2; p += LWS)
+            {
+                const uint i = 2 * stride * (p / stride) + p % stride;
+                const uint j = i + stride;
+
+                const float val_i = values[i];
+                const float val_j = values[j];
+                const uint idx_i = indices[i];
+                const uint idx_j = indices[j];
+
+                // blocks alternate direction until the last (whole buffer) merge, which puts the best pair first
+                const bool best_first = (i & size) == 0;
+                if (IS_BEFORE(val_j, idx_j, val_i, idx_i) == best_first)
+                {
+                    values[i] = val_j;
+                    values[j] = val_i;
+                    indices[i] = idx_j;
+                    indices[j] = idx_i;
+                }
+            }
+            barrier(CLK_LOCAL_MEM_FENCE);
+        }
+    }
+}
+
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(arg_max_min_top_k)(const __global UNIT_TYPE* input, __global float* output)
+{
+    const uint lid = (uint)get_local_id(0);
+    const uint set = (uint)get_group_id(0);
+
+    const uint first_dim_id = set % FIRST_DIM_SIZE;
+    const uint second_dim_id = (set / FIRST_DIM_SIZE) % SECOND_DIM_SIZE;
+    const uint third_dim_id = set / (FIRST_DIM_SIZE * SECOND_DIM_SIZE);
+    const uint offset = first_dim_id * FIRST_DIM_MUL + second_dim_id * SECOND_DIM_MUL + third_dim_id * THIRD_DIM_MUL;
+
+    __local float values[SORT_SIZE];
+    __local uint indices[SORT_SIZE];
+
+    // values are kept in float for every input type, fp16 and int8 are converted exactly
+    for (uint i = lid; i < SORT_SIZE; i += LWS)
+    {
+        if (i < VALUES_NUM)
+        {
+            values[i] = (float)input[offset + i * GAP_SIZE];
+            indices[i] = i;
+        }
+        else
+        {
+            values[i] = FILL_VAL;
+            indices[i] = UINT_MAX;
+        }
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    FUNC_CALL(bitonic_sort)(values, indices);
+
+#if VALUES_NUM > SORT_SIZE
+    // the best TOP_K pairs stay at the front, the rest of the buffer takes the next chunk
+    for (uint chunk_start = SORT_SIZE; chunk_start < VALUES_NUM; chunk_start += SORT_SIZE - TOP_K)
+    {
+        for (uint i = TOP_K + lid; i < SORT_SIZE; i += LWS)
+        {
+            const uint value_id = chunk_start + i - TOP_K;
+            if (value_id < VALUES_NUM)
+            {
+                values[i] = (float)input[offset + value_id * GAP_SIZE];
+                indices[i] = value_id;
+            }
+            else
+            {
+                values[i] = FILL_VAL;
+                indices[i] = UINT_MAX;
+            }
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        FUNC_CALL(bitonic_sort)(values, indices);
+    }
+#endif
+
+    for (uint k = lid; k < TOP_K; k += LWS)
+        output[set * TOP_K + k] = indices[k];
+}
+
+#undef GAP_SIZE
+#undef FIRST_DIM_SIZE
+#undef SECOND_DIM_SIZE
+#undef FIRST_DIM_MUL
+#undef SECOND_DIM_MUL
+#undef THIRD_DIM_MUL
+#undef FILL_VAL
+#undef IS_BETTER
+#undef IS_BEFORE
@@ -0,0 +1,109 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+// bfyx border; work-item writes VEC_SIZE consecutive elements of an output row. Source row is resolved once per
+// work-item, chunks lying entirely inside the input interior are copied with vector loads/stores and only the
+// chunks touching the left/right border go through the per-element path.
+
+#define BORDER_VEC_TYPE MAKE_VECTOR_TYPE(UNIT_TYPE, VEC_SIZE)
+
+// Maps output coordinate to input coordinate along one dimension (blt - left-top border size, in_s - input size,
+// in_l - exclusive output limit of the input interior). For constant border coordinates outside of the interior
+// are not mapped and have to be checked by the caller.
+#if defined BORDER_TYPE_CONSTANT
+    #define BORDER_IN_COORD(out_c, blt, in_s, in_l) ((out_c) - (blt))
+#elif defined BORDER_TYPE_EDGE
+    #define BORDER_IN_COORD(out_c, blt, in_s, in_l) \
+        (((out_c) >= (blt) & (out_c) < (in_l)) ? (out_c) - (blt) : ((out_c) < (blt) ? 0 : (in_s) - 1))
+#elif defined BORDER_TYPE_MIRROR
+    #define BORDER_IN_COORD(out_c, blt, in_s, in_l) \
+        (((out_c) >= (blt) & (out_c) < (in_l)) ? (out_c) - (blt) : ((out_c) < (blt) ? (blt) - 1 - (out_c) : (in_s) + (in_l) - 1 - (out_c)))
+#elif defined BORDER_TYPE_MIRROR_101
+    #define BORDER_IN_COORD(out_c, blt, in_s, in_l) \
+        (((out_c) >= (blt) & (out_c) < (in_l)) ? (out_c) - (blt) : ((out_c) < (blt) ? (blt) - (out_c) : (in_s) + (in_l) - 2 - (out_c)))
+#else
+    #error Unsupported border type.
+#endif
+
+#define IN_LX (INPUT0_SIZE_X + LT_SIZES_SIZE_X)
+#define IN_LY (INPUT0_SIZE_Y + LT_SIZES_SIZE_Y)
+#define IN_LF (INPUT0_FEATURE_NUM + LT_SIZES_FEATURE_NUM)
+#define IN_LB (INPUT0_BATCH_NUM + LT_SIZES_BATCH_NUM)
+
+KERNEL(border_gpu_vectorized)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output)
+{
+    const uint out_x0 = (uint)get_global_id(0) * VEC_SIZE;
+    const uint out_y  = (uint)get_global_id(1);
+    const uint out_fb = (uint)get_global_id(2);
+
+    const uint out_f  = out_fb % OUTPUT_FEATURE_NUM;
+    const uint out_b  = out_fb / OUTPUT_FEATURE_NUM;
+
+    const uint out_row = GET_DATA_INDEX(OUTPUT, out_b, out_f, out_y, 0);
+    const uint count   = out_x0 + VEC_SIZE <= OUTPUT_SIZE_X ? VEC_SIZE : OUTPUT_SIZE_X - out_x0;
+
+#ifdef BORDER_TYPE_CONSTANT
+    const UNIT_TYPE border_val = TO_UNIT_TYPE(BORDER_VALUE);
+
+    if (out_y < LT_SIZES_SIZE_Y | out_y >= IN_LY |
+        out_f < LT_SIZES_FEATURE_NUM | out_f >= IN_LF |
+        out_b < LT_SIZES_BATCH_NUM | out_b >= IN_LB)
+    {
+        // whole row lies in the border
+        if (count == VEC_SIZE)
+        {
+            CAT(vstore, VEC_SIZE)((BORDER_VEC_TYPE)border_val, 0, output + out_row + out_x0);
+        }
+        else
+        {
+            for (uint i = 0; i < count; ++i)
+                output[out_row + out_x0 + i] = border_val;
+        }
+        return;
+    }
+#endif
+
+    const uint in_y = BORDER_IN_COORD(out_y, LT_SIZES_SIZE_Y, INPUT0_SIZE_Y, IN_LY);
+    const uint in_f = BORDER_IN_COORD(out_f, LT_SIZES_FEATURE_NUM, INPUT0_FEATURE_NUM, IN_LF);
+    const uint in_b = BORDER_IN_COORD(out_b, LT_SIZES_BATCH_NUM, INPUT0_BATCH_NUM, IN_LB);
+    const uint in_row = GET_DATA_INDEX(INPUT0, in_b, in_f, in_y, 0);
+
+    if (out_x0 >= LT_SIZES_SIZE_X & out_x0 + VEC_SIZE <= IN_LX)
+    {
+        CAT(vstore, VEC_SIZE)(CAT(vload, VEC_SIZE)(0, input + in_row + out_x0 - LT_SIZES_SIZE_X), 0, output + out_row + out_x0);
+        return;
+    }
+
+    for (uint i = 0; i < count; ++i)
+    {
+        const uint out_x = out_x0 + i;
+#ifdef BORDER_TYPE_CONSTANT
+        output[out_row + out_x] = (out_x >= LT_SIZES_SIZE_X & out_x < IN_LX) ? input[in_row + out_x - LT_SIZES_SIZE_X] : border_val;
+#else
+        output[out_row + out_x] = input[in_row + BORDER_IN_COORD(out_x, LT_SIZES_SIZE_X, INPUT0_SIZE_X, IN_LX)];
+#endif
+    }
+}
+
+#undef BORDER_VEC_TYPE
+#undef BORDER_IN_COORD
+#undef IN_LX
+#undef IN_LY
+#undef IN_LF
+#undef IN_LB
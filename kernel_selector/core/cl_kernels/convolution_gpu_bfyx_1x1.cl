@@ -70,7 +70,8 @@ KERNEL(convolution_bfyx_1x1)(
 #if BIAS_TERM
     __global BIAS_TYPE* biases,
 #endif
-    uint split_idx)
+    uint split_idx
+    FUSED_OPS_DECLS)
 {
     const uint xy = get_group_id(0) * 16 + get_sub_group_local_id();
     const uint x = xy % OUTPUT_SIZE_X;
@@ -132,7 +133,11 @@ KERNEL(convolution_bfyx_1x1)(
     #if LEFTOVERS
         if(group_f+i < OUTPUT_FEATURE_NUM)
     #endif
-        output[dst_index] = ACTIVATION(blockC00[i], NL_M, NL_N);   
+        {
+            OUTPUT_TYPE dst = ACTIVATION(blockC00[i], NL_M, NL_N);
+            FUSED_OPS(dst, b, group_f+i, y, x);
+            output[dst_index] = dst;
+        }
     }
 }
 
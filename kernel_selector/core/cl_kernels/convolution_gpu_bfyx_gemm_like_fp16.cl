@@ -29,7 +29,8 @@ KERNEL(convolution_f16)(
 #if BIAS_TERM
     const __global half *bias,
 #endif
-    uint split_idx)
+    uint split_idx
+    FUSED_OPS_DECLS)
 {
 #include "include/vec_typedefs.cl"
 
@@ -253,6 +254,16 @@ KERNEL(convolution_f16)(
      + ( group_x * TILE_N ) * OUTPUT_FEATURE_PITCH                                     // channel offset
      + ( ( global_y * TILE_M ) / OUTPUT_SIZE_X ) * OUTPUT_Y_PITCH                      // y offset
      + ( ( global_y * TILE_M ) % OUTPUT_SIZE_X );                                      // x offset
+    const uint out_y = ( global_y * TILE_M ) / OUTPUT_SIZE_X;
+    const uint out_x = ( global_y * TILE_M ) % OUTPUT_SIZE_X;
+
+    // applies fused operations to the value of output channel ch of the tile and stores it
+    #define STORE_OUTPUT(out, out_y, out_x, ch, value)                              \
+    {                                                                               \
+        UNIT_TYPE dst_val = (value);                                                \
+        FUSED_OPS(dst_val, global_z, group_x * TILE_N + (ch), out_y, out_x);        \
+        out[(ch) * OUTPUT_FEATURE_PITCH] = dst_val;                                 \
+    }
 
 
     if (global_y * TILE_M < OUTPUT_SIZE_X * OUTPUT_SIZE_Y )
@@ -273,8 +284,8 @@ KERNEL(convolution_f16)(
 
         for (unsigned i = 0; i < 16; i++)
         {
-            out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-            out[(16+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
+            STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
+            STORE_OUTPUT(out, out_y, out_x, 16+i, blockC10[i]);
         }
 
 #elif ( ( OUTPUT_FEATURE_NUM % 16 ) == 0 )
@@ -290,8 +301,8 @@ KERNEL(convolution_f16)(
 
             for ( unsigned i = 0; i < 16; i++ )
             {
-                out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                out[(16+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
+                STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
+                STORE_OUTPUT(out, out_y, out_x, 16+i, blockC10[i]);
             }
         }
         else
@@ -304,7 +315,7 @@ KERNEL(convolution_f16)(
 
             for (unsigned i = 0; i < 16; i++)
             {
-                out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
+                STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
             }
         }
 #else
@@ -320,8 +331,8 @@ KERNEL(convolution_f16)(
 
             for ( unsigned i = 0; i < 16; i++ )
             {
-                out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                out[(16+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
+                STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
+                STORE_OUTPUT(out, out_y, out_x, 16+i, blockC10[i]);
             }
         }
         else
@@ -338,11 +349,11 @@ KERNEL(convolution_f16)(
 
             for (unsigned i = 0; i < 16 ; i++)
             {
-                out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
+                STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
             }
             for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 16 ; i++)
             {
-                out[(16+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
+                STORE_OUTPUT(out, out_y, out_x, 16+i, blockC10[i]);
             }
 #else
             #if BIAS_TERM
@@ -353,12 +364,13 @@ KERNEL(convolution_f16)(
 
             for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 16 ; i++)
             {
-                out[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
+                STORE_OUTPUT(out, out_y, out_x, 0+i, blockC00[i]);
             }
 #endif
         }
 #endif
     }
 
+    #undef STORE_OUTPUT
 }
 #endif
@@ -29,7 +29,8 @@ KERNEL(convolution_f32)(
 #if BIAS_TERM
     const __global float *bias,
 #endif
-    uint split_idx)
+    uint split_idx
+    FUSED_OPS_DECLS)
 {
 #include "include/vec_typedefs.cl"
 
@@ -220,6 +221,18 @@ KERNEL(convolution_f32)(
      + ( group_x * TILE_N ) * OUTPUT_FEATURE_PITCH                                     // channel offset
      + ( ( global_y * TILE_M + 1 ) / OUTPUT_SIZE_X ) * OUTPUT_Y_PITCH                  // y offset
      + ( ( global_y * TILE_M + 1 ) % OUTPUT_SIZE_X );                                  // x offset
+    const uint out0_y = ( global_y * TILE_M ) / OUTPUT_SIZE_X;
+    const uint out0_x = ( global_y * TILE_M ) % OUTPUT_SIZE_X;
+    const uint out1_y = ( global_y * TILE_M + 1 ) / OUTPUT_SIZE_X;
+    const uint out1_x = ( global_y * TILE_M + 1 ) % OUTPUT_SIZE_X;
+
+    // applies fused operations to the value of output channel ch of the tile and stores it
+    #define STORE_OUTPUT(out, out_y, out_x, ch, value)                              \
+    {                                                                               \
+        UNIT_TYPE dst_val = (value);                                                \
+        FUSED_OPS(dst_val, global_z, group_x * TILE_N + (ch), out_y, out_x);        \
+        out[(ch) * OUTPUT_FEATURE_PITCH] = dst_val;                                 \
+    }
 
     #if BIAS_TERM
     __global float8* biasPtr = (__global float8*) (bias + group_x * TILE_N);
@@ -243,10 +256,10 @@ KERNEL(convolution_f32)(
 
             for( unsigned i = 0; i < 8; i++ )
             {
-                out0[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                out0[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
-                out0[(16+i) * OUTPUT_FEATURE_PITCH] = blockC20[i];
-                out0[(24+i) * OUTPUT_FEATURE_PITCH] = blockC30[i];
+                STORE_OUTPUT(out0, out0_y, out0_x, 0+i, blockC00[i]);
+                STORE_OUTPUT(out0, out0_y, out0_x, 8+i, blockC10[i]);
+                STORE_OUTPUT(out0, out0_y, out0_x, 16+i, blockC20[i]);
+                STORE_OUTPUT(out0, out0_y, out0_x, 24+i, blockC30[i]);
             }
         }
         else
@@ -267,10 +280,10 @@ KERNEL(convolution_f32)(
 
                 for ( unsigned i = 0; i < 8; i++ )
                 {
-                    out0[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                    out0[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
-                    out0[(16+i) * OUTPUT_FEATURE_PITCH] = blockC20[i];
-                    out0[(24+i) * OUTPUT_FEATURE_PITCH] = blockC30[i];
+                    STORE_OUTPUT(out0, out0_y, out0_x, 0+i, blockC00[i]);
+                    STORE_OUTPUT(out0, out0_y, out0_x, 8+i, blockC10[i]);
+                    STORE_OUTPUT(out0, out0_y, out0_x, 16+i, blockC20[i]);
+                    STORE_OUTPUT(out0, out0_y, out0_x, 24+i, blockC30[i]);
                 }
             }
             else
@@ -290,15 +303,15 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out0[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                        out0[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
-                        out0[(16+i) * OUTPUT_FEATURE_PITCH] = blockC20[i];
+                        STORE_OUTPUT(out0, out0_y, out0_x, 0+i, blockC00[i]);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 8+i, blockC10[i]);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 16+i, blockC20[i]);
                     }
 
                     // remaining output channels
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out0[(24+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC30[i], NL_M, NL_N);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 24+i, ACTIVATION(blockC30[i], NL_M, NL_N));
                     }
                 }
                 else if ( ( OUTPUT_FEATURE_NUM % TILE_N ) >= 16 )
@@ -315,13 +328,13 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out0[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
-                        out0[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC10[i];
+                        STORE_OUTPUT(out0, out0_y, out0_x, 0+i, blockC00[i]);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 8+i, blockC10[i]);
                     }
 
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out0[(16+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC20[i], NL_M, NL_N);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 16+i, ACTIVATION(blockC20[i], NL_M, NL_N));
 
                     }
                 }
@@ -337,12 +350,12 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out0[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC00[i];
+                        STORE_OUTPUT(out0, out0_y, out0_x, 0+i, blockC00[i]);
                     }
 
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out0[(8+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC10[i], NL_M, NL_N);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 8+i, ACTIVATION(blockC10[i], NL_M, NL_N));
                     }
                 }
                 else
@@ -352,7 +365,7 @@ KERNEL(convolution_f32)(
                     #endif
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out0[( 0+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC00[i], NL_M, NL_N);
+                        STORE_OUTPUT(out0, out0_y, out0_x, 0+i, ACTIVATION(blockC00[i], NL_M, NL_N));
                     }
                 }
             }
@@ -377,10 +390,10 @@ KERNEL(convolution_f32)(
 
             for( unsigned i = 0; i < 8; i++ )
             {
-                out1[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC01[i];
-                out1[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC11[i];
-                out1[(16+i) * OUTPUT_FEATURE_PITCH] = blockC21[i];
-                out1[(24+i) * OUTPUT_FEATURE_PITCH] = blockC31[i];
+                STORE_OUTPUT(out1, out1_y, out1_x, 0+i, blockC01[i]);
+                STORE_OUTPUT(out1, out1_y, out1_x, 8+i, blockC11[i]);
+                STORE_OUTPUT(out1, out1_y, out1_x, 16+i, blockC21[i]);
+                STORE_OUTPUT(out1, out1_y, out1_x, 24+i, blockC31[i]);
             }
         }
         else
@@ -401,10 +414,10 @@ KERNEL(convolution_f32)(
 
                 for ( unsigned i = 0; i < 8; i++ )
                 {
-                    out1[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC01[i];
-                    out1[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC11[i];
-                    out1[(16+i) * OUTPUT_FEATURE_PITCH] = blockC21[i];
-                    out1[(24+i) * OUTPUT_FEATURE_PITCH] = blockC31[i];
+                    STORE_OUTPUT(out1, out1_y, out1_x, 0+i, blockC01[i]);
+                    STORE_OUTPUT(out1, out1_y, out1_x, 8+i, blockC11[i]);
+                    STORE_OUTPUT(out1, out1_y, out1_x, 16+i, blockC21[i]);
+                    STORE_OUTPUT(out1, out1_y, out1_x, 24+i, blockC31[i]);
                 }
             }
             else
@@ -424,15 +437,15 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out1[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC01[i];
-                        out1[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC11[i];
-                        out1[(16+i) * OUTPUT_FEATURE_PITCH] = blockC21[i];
+                        STORE_OUTPUT(out1, out1_y, out1_x, 0+i, blockC01[i]);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 8+i, blockC11[i]);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 16+i, blockC21[i]);
                     }
 
                     // Remaining channels
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out1[(24+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC31[i], NL_M, NL_N);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 24+i, ACTIVATION(blockC31[i], NL_M, NL_N));
                     }
                 }
                 else if ( ( OUTPUT_FEATURE_NUM % TILE_N ) >= 16 )
@@ -448,13 +461,13 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out1[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC01[i];
-                        out1[( 8+i) * OUTPUT_FEATURE_PITCH] = blockC11[i];
+                        STORE_OUTPUT(out1, out1_y, out1_x, 0+i, blockC01[i]);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 8+i, blockC11[i]);
                     }
 
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out1[(16+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC21[i], NL_M, NL_N);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 16+i, ACTIVATION(blockC21[i], NL_M, NL_N));
                     }
                 }
                 else if ( ( OUTPUT_FEATURE_NUM % TILE_N ) >= 8 )
@@ -468,12 +481,12 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < 8; i++)
                     {
-                        out1[( 0+i) * OUTPUT_FEATURE_PITCH] = blockC01[i];
+                        STORE_OUTPUT(out1, out1_y, out1_x, 0+i, blockC01[i]);
                     }
 
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out1[(8+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC11[i], NL_M, NL_N);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 8+i, ACTIVATION(blockC11[i], NL_M, NL_N));
                     }
                 }
                 else
@@ -484,10 +497,12 @@ KERNEL(convolution_f32)(
 
                     for (unsigned i = 0; i < OUTPUT_FEATURE_NUM % 8; i++)
                     {
-                        out1[( 0+i) * OUTPUT_FEATURE_PITCH] = ACTIVATION(blockC01[i], NL_M, NL_N);
+                        STORE_OUTPUT(out1, out1_y, out1_x, 0+i, ACTIVATION(blockC01[i], NL_M, NL_N));
                     }
                 }
             }
         }
     }
+
+    #undef STORE_OUTPUT
 }
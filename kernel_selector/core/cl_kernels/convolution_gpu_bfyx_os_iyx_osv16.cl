@@ -14,6 +14,7 @@
 
 #include "include/common.cl"
 #include "include/data_types.cl"
+#include "include/fetch.cl"
 
 
 // ---------------------------------------------------------------------------------------------------------------------
@@ -72,7 +73,8 @@ KERNEL(convolution_gpu_bfyx_os_iyx_osv16)(
 #if BIAS_TERM
     const __global UNIT_TYPE* bias,
 #endif   
-    uint split_idx) // TODO: removing this parameter cause a performance degradation... :)
+    uint split_idx // TODO: removing this parameter cause a performance degradation... :)
+    FUSED_OPS_DECLS)
 {
     const uint oc  = (uint)get_global_id(0) * OUTPUT_BLOCK_WIDTH;  // oc = Output Column
     const uint or  = (uint)get_global_id(1) * OUTPUT_BLOCK_HEIGHT; // or = Output Row
@@ -220,7 +222,11 @@ KERNEL(convolution_gpu_bfyx_os_iyx_osv16)(
             for(uint c = 0; c < OUTPUT_BLOCK_WIDTH; c++) {
                 // this does a scattered write to 16 different feature maps, so that data within one map is contiguous, thus ready for input to next layer.
                 if(!(oc + c >= OUTPUT_SIZE_X))
-                    output[out_addr + r * OUTPUT_Y_PITCH + c] = out[r * OUTPUT_BLOCK_WIDTH + c];
+                {
+                    UNIT_TYPE dst = out[r * OUTPUT_BLOCK_WIDTH + c];
+                    FUSED_OPS(dst, batch_idx, feature_idx, or + r, oc + c);
+                    output[out_addr + r * OUTPUT_Y_PITCH + c] = dst;
+                }
             }
         }
     }
@@ -0,0 +1,128 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// Outputs of one stride phase (out_x % STRIDE_SIZE_X, out_y % STRIDE_SIZE_Y) are reached by the same subset of
+// filter taps and, along the phase, the input coordinate of a tap advances by one - so every phase is a dense
+// convolution. Work-item computes X_BLOCK outputs of one x phase for OFM_BLOCK output features; the filter is
+// in yxio layout, so values of one tap for consecutive output features are contiguous.
+
+KERNEL(deconvolution_gpu_bfyx_stride_phase)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output,
+    const __global UNIT_TYPE* filter,
+#if BIAS_TERM
+    const __global UNIT_TYPE* bias,
+#endif
+    uint split_idx
+#if FUSED_ELTWISE
+    , const __global UNIT_TYPE* fuse_input
+#endif
+    )
+{
+    const uint phase_x = (uint)get_global_id(0) / X_BLOCKS_NUM;
+    const uint x_block = ((uint)get_global_id(0) % X_BLOCKS_NUM) * X_BLOCK;
+    const uint out_y   = (uint)get_global_id(1);
+    const uint ofm     = ((uint)get_global_id(2) % OFM_BLOCKS_NUM) * OFM_BLOCK;
+    const uint b       = (uint)get_global_id(2) / OFM_BLOCKS_NUM;
+
+    // coordinates in the input upsampled by the stride, as in the reference kernel
+    const int in_x = (int)phase_x + PADDING_SIZE_X - (FILTER_SIZE_X - 1);
+    const int in_y = (int)out_y + PADDING_SIZE_Y - (FILTER_SIZE_Y - 1);
+
+    // first taps hitting a real input element
+    const uint start_x = (STRIDE_SIZE_X - (in_x % STRIDE_SIZE_X)) % STRIDE_SIZE_X;
+    const uint start_y = (STRIDE_SIZE_Y - (in_y % STRIDE_SIZE_Y)) % STRIDE_SIZE_Y;
+
+    UNIT_TYPE acc[X_BLOCK][OFM_BLOCK];
+    __attribute__((opencl_unroll_hint))
+    for (uint k = 0; k < X_BLOCK; ++k)
+    {
+        __attribute__((opencl_unroll_hint))
+        for (uint o = 0; o < OFM_BLOCK; ++o)
+            acc[k][o] = UNIT_VAL_ZERO;
+    }
+
+    const uint input_offset = INPUT0_OFFSET + b*INPUT0_BATCH_PITCH + split_idx*FILTER_IFM_NUM*INPUT0_FEATURE_PITCH;
+
+    for (uint i = start_y; i < FILTER_SIZE_Y; i += STRIDE_SIZE_Y)
+    {
+        const int y = (in_y + (int)i) / STRIDE_SIZE_Y;
+        if (y < 0 || y >= INPUT0_SIZE_Y)
+            continue;
+
+        for (uint j = start_x; j < FILTER_SIZE_X; j += STRIDE_SIZE_X)
+        {
+            // input x of the first output of the block, the following ones step by one
+            const int x = (in_x + (int)j) / STRIDE_SIZE_X + (int)x_block;
+
+            uint input_idx = input_offset + (uint)y*INPUT0_Y_PITCH;
+            uint filter_idx = (FILTER_SIZE_Y - i - 1)*FILTER_Y_PITCH + (FILTER_SIZE_X - j - 1)*FILTER_X_PITCH + ofm*FILTER_OFM_PITCH;
+
+            for (uint ifm = 0; ifm < FILTER_IFM_NUM; ++ifm)
+            {
+                UNIT_TYPE in_vals[X_BLOCK];
+                __attribute__((opencl_unroll_hint))
+                for (uint k = 0; k < X_BLOCK; ++k)
+                {
+                    const int xk = x + (int)k;
+                    in_vals[k] = (xk >= 0 && xk < INPUT0_SIZE_X) ? input[input_idx + (uint)xk*INPUT0_X_PITCH] : UNIT_VAL_ZERO;
+                }
+
+                UNIT_TYPE w[OFM_BLOCK];
+                __attribute__((opencl_unroll_hint))
+                for (uint o = 0; o < OFM_BLOCK; ++o)
+                    w[o] = filter[filter_idx + o*FILTER_OFM_PITCH];
+
+                __attribute__((opencl_unroll_hint))
+                for (uint k = 0; k < X_BLOCK; ++k)
+                {
+                    __attribute__((opencl_unroll_hint))
+                    for (uint o = 0; o < OFM_BLOCK; ++o)
+                        acc[k][o] = fma(in_vals[k], w[o], acc[k][o]);
+                }
+
+                input_idx += INPUT0_FEATURE_PITCH;
+                filter_idx += FILTER_IFM_PITCH;
+            }
+        }
+    }
+
+    const uint out_split_offset = split_idx * OUTPUT_FEATURE_PITCH * FILTER_OFM_NUM;
+    for (uint k = 0; k < X_BLOCK; ++k)
+    {
+        const uint out_x = phase_x + (x_block + k) * STRIDE_SIZE_X;
+        if (out_x >= OUTPUT_SIZE_X)
+            break;
+
+        __attribute__((opencl_unroll_hint))
+        for (uint o = 0; o < OFM_BLOCK; ++o)
+        {
+            UNIT_TYPE result = acc[k][o];
+#if BIAS_TERM
+            result += bias[ofm + o];
+#endif
+            const uint dst_index = OUTPUT_OFFSET + out_split_offset + b*OUTPUT_BATCH_PITCH + (ofm + o)*OUTPUT_FEATURE_PITCH + out_y*OUTPUT_Y_PITCH + out_x*OUTPUT_X_PITCH;
+#if FUSED_ELTWISE
+            const uint fused_index = INPUT1_OFFSET + split_idx * INPUT1_FEATURE_PITCH * FILTER_OFM_NUM + b*INPUT1_BATCH_PITCH + (ofm + o)*INPUT1_FEATURE_PITCH + out_y*INPUT1_Y_PITCH + out_x*INPUT1_X_PITCH;
+            output[dst_index] = ACTIVATION(result + fuse_input[fused_index], NL_M, NL_N);
+#else
+            output[dst_index] = ACTIVATION(result, NL_M, NL_N);
+#endif
+        }
+    }
+}
+
+#undef ACTIVATION
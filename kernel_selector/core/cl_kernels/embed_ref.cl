@@ -15,7 +15,7 @@
 #include "include/include_all.cl"
 
 KERNEL(embed_ref)(const __global UNIT_TYPE* input0,
-    __global UNIT_TYPE* output,
+    __global OUTPUT_TYPE* output,
     const __global UNIT_TYPE* weights
 #if BIAS_TERM
     ,const __global UNIT_TYPE* biases
@@ -27,8 +27,9 @@ KERNEL(embed_ref)(const __global UNIT_TYPE* input0,
 	const uint b = (uint)get_global_id(2);
 
 	uint output_idx = (b*INPUT0_ELEMENTS_COUNT*NUM_OUTPUT_SIZE)+(uint)(x*NUM_OUTPUT_SIZE+y);
-    output[output_idx] = weights[(uint)(input0[(b*INPUT0_ELEMENTS_COUNT)+x]*NUM_OUTPUT_SIZE+y)];
+    UNIT_TYPE res = weights[(uint)(input0[(b*INPUT0_ELEMENTS_COUNT)+x]*NUM_OUTPUT_SIZE+y)];
 #if BIAS_TERM
-    output[output_idx] += biases[y];
+    res += biases[y];
 #endif
+    output[output_idx] = TO_OUTPUT_TYPE(res);
 }
@@ -0,0 +1,63 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// Work-item copies VEC_SIZE consecutive values of the embedding row selected by one input index. Rows of
+// the table are NUM_OUTPUT_SIZE long and contiguous, so they are read with vector loads. Values are converted
+// to the output type on store (fp16 table with fp32 output).
+
+#define EMBED_VEC_TYPE MAKE_VECTOR_TYPE(UNIT_TYPE, VEC_SIZE)
+#define TO_OUTPUT_VEC_TYPE(v) CAT(convert_, MAKE_VECTOR_TYPE(OUTPUT_TYPE, VEC_SIZE))(v)
+
+KERNEL(embed_vectorized)(const __global UNIT_TYPE* input0,
+    __global OUTPUT_TYPE* output,
+    const __global UNIT_TYPE* weights
+#if BIAS_TERM
+    ,const __global UNIT_TYPE* biases
+#endif
+)
+{
+    const uint y = (uint)get_global_id(0) * VEC_SIZE;
+    const uint x = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2);
+
+    const uint row = (uint)input0[(b*INPUT0_ELEMENTS_COUNT)+x];
+    const __global UNIT_TYPE* src = weights + row*NUM_OUTPUT_SIZE;
+    __global OUTPUT_TYPE* dst = output + (b*INPUT0_ELEMENTS_COUNT + x)*NUM_OUTPUT_SIZE;
+
+#if NUM_OUTPUT_SIZE % VEC_SIZE != 0
+    if (y + VEC_SIZE > NUM_OUTPUT_SIZE)
+    {
+        for (uint i = y; i < NUM_OUTPUT_SIZE; ++i)
+        {
+#if BIAS_TERM
+            dst[i] = TO_OUTPUT_TYPE(src[i] + biases[i]);
+#else
+            dst[i] = TO_OUTPUT_TYPE(src[i]);
+#endif
+        }
+        return;
+    }
+#endif
+
+    EMBED_VEC_TYPE val = CAT(vload, VEC_SIZE)(0, src + y);
+#if BIAS_TERM
+    val += CAT(vload, VEC_SIZE)(0, biases + y);
+#endif
+    CAT(vstore, VEC_SIZE)(TO_OUTPUT_VEC_TYPE(val), 0, dst + y);
+}
+
+#undef TO_OUTPUT_VEC_TYPE
+#undef EMBED_VEC_TYPE
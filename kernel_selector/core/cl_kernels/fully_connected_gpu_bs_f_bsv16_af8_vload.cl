@@ -41,6 +41,10 @@
 
 #define SUB_GROUP_SIZE 16
 
+// applies fused operations to the block of 16 consecutive batches of a single neuron stored at vector offset vec_offset
+#define FUSED_OPS_BLOCK(block, vec_offset) \
+    FUSED_OPS_VEC16(block, ((vec_offset) * 16) % OUTPUT_BATCH_NUM, ((vec_offset) * 16) / OUTPUT_BATCH_NUM, 0, 0)
+
 __attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
 __attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
 KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv16_vload)(
@@ -48,10 +52,9 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv16_vload)(
     __global UNIT_TYPE* output,
     const __global UNIT_TYPE* weight
 #if BIAS_TERM
-    , __global UNIT_TYPE* bias)
-#else
-    )
+    , __global UNIT_TYPE* bias
 #endif
+    FUSED_OPS_DECLS)
 {
     const uint global_id = get_global_id(0);
     const uint group_id = get_group_id(0);
@@ -85,10 +88,12 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv16_vload)(
 
     blockC00 = ACTIVATION(blockC00, NL_M, NL_N);
 
+    FUSED_OPS_BLOCK(blockC00, out_id);
     vstore16(blockC00, out_id, output);
 
 }
 
 #undef SUB_GROUP_SIZE
+#undef FUSED_OPS_BLOCK
 #undef ALIGNED_BLOCK_READ8
 #undef MULTIPLY_BLOCKS_16x8
@@ -66,6 +66,10 @@
 
 #define SUB_GROUP_SIZE 8
 
+// applies fused operations to the block of 8 consecutive batches of a single neuron stored at vector offset vec_offset
+#define FUSED_OPS_BLOCK(block, vec_offset) \
+    FUSED_OPS_VEC8(block, ((vec_offset) * 8) % OUTPUT_BATCH_NUM, ((vec_offset) * 8) / OUTPUT_BATCH_NUM, 0, 0)
+
 __attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
 __attribute__((intel_reqd_sub_group_size(SUB_GROUP_SIZE)))
 KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv8_vload)(
@@ -73,10 +77,9 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv8_vload)(
     __global UNIT_TYPE* output,
     const __global UNIT_TYPE* weight
 #if BIAS_TERM
-    , __global UNIT_TYPE* bias)
-#else
-    )
+    , __global UNIT_TYPE* bias
 #endif
+    FUSED_OPS_DECLS)
 {
     const uint global_id = get_global_id(0);
     const uint group_id = get_group_id(0);
@@ -197,11 +200,15 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv8_vload)(
     if(neuronIdx >= OUTPUT_ELEMENTS_COUNT)
         return;
 
+    FUSED_OPS_BLOCK(blockC00, out_id);
     vstore8(blockC00, out_id, output);
 #if BATCHES_PER_WORK_ITEM >= 16
+    FUSED_OPS_BLOCK(blockC01, out_id + 1);
     vstore8(blockC01, out_id + 1, output);
 #if BATCHES_PER_WORK_ITEM >= 32
+    FUSED_OPS_BLOCK(blockC02, out_id + 2);
     vstore8(blockC02, out_id + 2, output);
+    FUSED_OPS_BLOCK(blockC03, out_id + 3);
     vstore8(blockC03, out_id + 3, output);
 #endif
 #endif
@@ -211,11 +218,15 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv8_vload)(
     if(neuronIdx + 8 >= OUTPUT_ELEMENTS_COUNT)
         return;
 
+    FUSED_OPS_BLOCK(blockC10, out_id+INPUT0_BATCH_NUM);
     vstore8(blockC10, out_id+INPUT0_BATCH_NUM, output);
 #if BATCHES_PER_WORK_ITEM >= 16
+    FUSED_OPS_BLOCK(blockC11, out_id+INPUT0_BATCH_NUM+1);
     vstore8(blockC11, out_id+INPUT0_BATCH_NUM+1, output);
 #if BATCHES_PER_WORK_ITEM >= 32
+    FUSED_OPS_BLOCK(blockC12, out_id+INPUT0_BATCH_NUM+2);
     vstore8(blockC12, out_id+INPUT0_BATCH_NUM+2, output);
+    FUSED_OPS_BLOCK(blockC13, out_id+INPUT0_BATCH_NUM+3);
     vstore8(blockC13, out_id+INPUT0_BATCH_NUM+3, output);
 #endif
 #endif
@@ -224,5 +235,6 @@ KERNEL (fully_connected_gpu_xb_bs_xs_xsv8_bsv8_vload)(
 }
 
 #undef SUB_GROUP_SIZE
+#undef FUSED_OPS_BLOCK
 #undef ALIGNED_BLOCK_READ8
 #undef MULTIPLY_BLOCKS_8x8
@@ -60,16 +60,19 @@
 
 #define SUB_GROUP_SIZE 8
 
+// applies fused operations to the block of 8 consecutive batches of a single neuron stored at vector offset vec_offset
+#define FUSED_OPS_BLOCK(block, vec_offset) \
+    FUSED_OPS_VEC8(block, ((vec_offset) * 8) % OUTPUT_BATCH_NUM, ((vec_offset) * 8) / OUTPUT_BATCH_NUM, 0, 0)
+
 __attribute__((reqd_work_group_size(SUB_GROUP_SIZE, 1, 1)))
 KERNEL (fully_connected_gpu_xb_xb_b8_x8_vload)(
     const __global UNIT_TYPE* input,
     __global UNIT_TYPE* output,
     const __global UNIT_TYPE* weight
 #if BIAS_TERM
-    , __global UNIT_TYPE* bias)
-#else
-    )
+    , __global UNIT_TYPE* bias
 #endif
+    FUSED_OPS_DECLS)
 {
     const uint global_id = get_global_id(0);
     const uint group_id = get_global_id(1); // which part of batches we are computing, for example for batch 64 we compute batches 0..31 for group_id == 0 and batches 32..65 for group_id == 1
@@ -206,25 +209,33 @@ KERNEL (fully_connected_gpu_xb_xb_b8_x8_vload)(
 
 #endif // #if NEURONS_PER_WORK_ITEM > 1
 
+    FUSED_OPS_BLOCK(blockC00, out_id);
     vstore8(blockC00, out_id, output);
 #if BATCHES_PER_WORK_ITEM >= 16
+    FUSED_OPS_BLOCK(blockC01, out_id + 1);
     vstore8(blockC01, out_id + 1, output);
 #endif
 #if BATCHES_PER_WORK_ITEM >= 32
+    FUSED_OPS_BLOCK(blockC02, out_id + 2);
     vstore8(blockC02, out_id + 2, output);
+    FUSED_OPS_BLOCK(blockC03, out_id + 3);
     vstore8(blockC03, out_id + 3, output);
 #endif
 #endif // #if BIAS_TERM
 #if NEURONS_PER_WORK_ITEM > 1
 
+    FUSED_OPS_BLOCK(blockC10, out_id+INPUT0_BATCH_NUM);
     vstore8(blockC10, out_id+INPUT0_BATCH_NUM, output);
 
 #if BATCHES_PER_WORK_ITEM >= 16
+    FUSED_OPS_BLOCK(blockC11, out_id+INPUT0_BATCH_NUM+1);
     vstore8(blockC11, out_id+INPUT0_BATCH_NUM+1, output);
 #endif
 
 #if BATCHES_PER_WORK_ITEM >= 32
+    FUSED_OPS_BLOCK(blockC12, out_id+INPUT0_BATCH_NUM+2);
     vstore8(blockC12, out_id+INPUT0_BATCH_NUM+2, output);
+    FUSED_OPS_BLOCK(blockC13, out_id+INPUT0_BATCH_NUM+3);
     vstore8(blockC13, out_id+INPUT0_BATCH_NUM+3, output);
 #endif
 
@@ -232,6 +243,7 @@ KERNEL (fully_connected_gpu_xb_xb_b8_x8_vload)(
 }
 
 #undef SUB_GROUP_SIZE
+#undef FUSED_OPS_BLOCK
 #undef ALIGNED_BLOCK_READ8
 #undef MAKE_VECTOR_TYPE
 #undef CONCAT_TOKEN
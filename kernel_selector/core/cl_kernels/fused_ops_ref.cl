@@ -0,0 +1,39 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/fetch.cl"
+
+// Applies fused operations in place to the output of the preceding kernel (used when that kernel cannot fuse them).
+KERNEL(fused_ops_ref)(
+    __global UNIT_TYPE* output
+    FUSED_OPS_DECLS)
+{
+    const uint x = (uint)get_global_id(0) % OUTPUT_SIZE_X;
+    const uint y = (uint)get_global_id(0) / OUTPUT_SIZE_X;
+    const uint f = (uint)get_global_id(1);
+    const uint b = (uint)get_global_id(2);
+
+#if OUTPUT_LAYOUT_BF8_XY16
+    const uint output_idx = GET_DATA_BF8_XY16_INDEX(OUTPUT, b, f, y, x);
+#else
+    const uint output_idx = GET_DATA_INDEX(OUTPUT, b, f, y, x);
+#endif
+
+    UNIT_TYPE val = output[output_idx];
+    FUSED_OPS(val, b, f, y, x);
+    output[output_idx] = val;
+}
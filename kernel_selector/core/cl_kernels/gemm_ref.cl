@@ -52,9 +52,9 @@ for (uint i = 0; i < Y1; ++i)
 #if TRANSPOSE_INPUT1 && TRANSPOSE_INPUT2
 	uint out_idx = x * Y2 + y + b * X1 * Y2;
 #elif TRANSPOSE_INPUT1
-	uint out_idx = x * X2 + y + b * X1 * Y1;
+	uint out_idx = x * X2 + y + b * X1 * X2;
 #elif TRANSPOSE_INPUT2
-	uint out_idx = x * Y2 + y + b * X2 * Y2;
+	uint out_idx = x * Y2 + y + b * Y1 * Y2;
 #else
 	uint out_idx = x * X2 + y + b * X2 * Y1;
 #endif
@@ -0,0 +1,203 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+// C[M x N] = ALPHA * A[M x K] * B[K x N] + BETA * input2, where A is input0 (transposed when TRANSPOSE_INPUT1)
+// and B is input1 (transposed when TRANSPOSE_INPUT2). Work-group computes TILE_M x TILE_N block of C,
+// work-item (lx, ly) accumulates elements (ly + i * LWS_M, lx + j * LWS_N) of it, i < BLOCK_M, j < BLOCK_N.
+// Tiles of inputs are copied to local memory in their global orientation, so rows are read with vector loads.
+
+#define LWS_N (TILE_N / BLOCK_N)
+#define LWS_M (TILE_M / BLOCK_M)
+#define LWS   (LWS_N * LWS_M)
+
+#if TRANSPOSE_INPUT1
+    // tile of A is stored as K x M
+    #define A_ROWS              TILE_K
+    #define A_COLS              TILE_M
+    #define A_TILE(m, k)        a_tile[(k) * (A_COLS + 1) + (m)]
+    #define A_IN_RANGE(r, c)    ((r) < MATRIX_K && (c) < MATRIX_M)
+#else
+    #define A_ROWS              TILE_M
+    #define A_COLS              TILE_K
+    #define A_TILE(m, k)        a_tile[(m) * (A_COLS + 1) + (k)]
+    #define A_IN_RANGE(r, c)    ((r) < MATRIX_M && (c) < MATRIX_K)
+#endif
+
+#if TRANSPOSE_INPUT2
+    // tile of B is stored as N x K
+    #define B_ROWS              TILE_N
+    #define B_COLS              TILE_K
+    #define B_TILE(k, n)        b_tile[(n) * (B_COLS + 1) + (k)]
+    #define B_IN_RANGE(r, c)    ((r) < MATRIX_N && (c) < MATRIX_K)
+#else
+    #define B_ROWS              TILE_K
+    #define B_COLS              TILE_N
+    #define B_TILE(k, n)        b_tile[(k) * (B_COLS + 1) + (n)]
+    #define B_IN_RANGE(r, c)    ((r) < MATRIX_K && (c) < MATRIX_N)
+#endif
+
+#define INPUT0_VEC_TYPE MAKE_VECTOR_TYPE(INPUT0_TYPE, VEC_SIZE_A)
+#define INPUT1_VEC_TYPE MAKE_VECTOR_TYPE(INPUT1_TYPE, VEC_SIZE_B)
+
+#if VEC_SIZE_A == 1
+    #define LOAD_A(ptr)         (*(ptr))
+    #define STORE_A(val, ptr)   (*(ptr) = (val))
+#else
+    #define LOAD_A(ptr)         CAT(vload, VEC_SIZE_A)(0, ptr)
+    #define STORE_A(val, ptr)   CAT(vstore, VEC_SIZE_A)(val, 0, ptr)
+#endif
+
+#if VEC_SIZE_B == 1
+    #define LOAD_B(ptr)         (*(ptr))
+    #define STORE_B(val, ptr)   (*(ptr) = (val))
+#else
+    #define LOAD_B(ptr)         CAT(vload, VEC_SIZE_B)(0, ptr)
+    #define STORE_B(val, ptr)   CAT(vstore, VEC_SIZE_B)(val, 0, ptr)
+#endif
+
+__attribute__((reqd_work_group_size(LWS_N, LWS_M, 1)))
+KERNEL(gemm_tiled_opt)(
+    const __global INPUT0_TYPE* input0,
+    const __global INPUT1_TYPE* input1,
+#if OUT_BIAS_TERM
+    const __global INPUT2_TYPE* input2,
+#endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint lx = (uint)get_local_id(0);
+    const uint ly = (uint)get_local_id(1);
+    const uint lid = ly * LWS_N + lx;
+    const uint n0 = (uint)get_group_id(0) * TILE_N;
+    const uint m0 = (uint)get_group_id(1) * TILE_M;
+    const uint b = (uint)get_global_id(2);
+
+    __local INPUT0_TYPE a_tile[A_ROWS * (A_COLS + 1)];
+    __local INPUT1_TYPE b_tile[B_ROWS * (B_COLS + 1)];
+
+    const __global INPUT0_TYPE* a_ptr = input0 + INPUT0_OFFSET + b * INPUT0_BATCH_PITCH;
+    const __global INPUT1_TYPE* b_ptr = input1 + INPUT1_OFFSET + b * INPUT1_BATCH_PITCH;
+
+    ACCUMULATOR_TYPE acc[BLOCK_M][BLOCK_N];
+    __attribute__((opencl_unroll_hint))
+    for (uint i = 0; i < BLOCK_M; ++i)
+    {
+        __attribute__((opencl_unroll_hint))
+        for (uint j = 0; j < BLOCK_N; ++j)
+            acc[i][j] = ACCUMULATOR_TYPE_ZERO;
+    }
+
+    for (uint k0 = 0; k0 < MATRIX_K; k0 += TILE_K)
+    {
+        // copy tiles of inputs, VEC_SIZE elements of a row at a time; rows never end inside a vector
+#if TRANSPOSE_INPUT1
+        const uint a_row0 = k0;
+        const uint a_col0 = m0;
+#else
+        const uint a_row0 = m0;
+        const uint a_col0 = k0;
+#endif
+        for (uint v = lid; v < A_ROWS * A_COLS / VEC_SIZE_A; v += LWS)
+        {
+            const uint r = v / (A_COLS / VEC_SIZE_A);
+            const uint c = (v % (A_COLS / VEC_SIZE_A)) * VEC_SIZE_A;
+            INPUT0_VEC_TYPE val = (INPUT0_VEC_TYPE)0;
+            if (A_IN_RANGE(a_row0 + r, a_col0 + c))
+                val = LOAD_A(a_ptr + (a_row0 + r) * INPUT0_Y_PITCH + a_col0 + c);
+            STORE_A(val, a_tile + r * (A_COLS + 1) + c);
+        }
+
+#if TRANSPOSE_INPUT2
+        const uint b_row0 = n0;
+        const uint b_col0 = k0;
+#else
+        const uint b_row0 = k0;
+        const uint b_col0 = n0;
+#endif
+        for (uint v = lid; v < B_ROWS * B_COLS / VEC_SIZE_B; v += LWS)
+        {
+            const uint r = v / (B_COLS / VEC_SIZE_B);
+            const uint c = (v % (B_COLS / VEC_SIZE_B)) * VEC_SIZE_B;
+            INPUT1_VEC_TYPE val = (INPUT1_VEC_TYPE)0;
+            if (B_IN_RANGE(b_row0 + r, b_col0 + c))
+                val = LOAD_B(b_ptr + (b_row0 + r) * INPUT1_Y_PITCH + b_col0 + c);
+            STORE_B(val, b_tile + r * (B_COLS + 1) + c);
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        __attribute__((opencl_unroll_hint(8)))
+        for (uint k = 0; k < TILE_K; ++k)
+        {
+            ACCUMULATOR_TYPE a_reg[BLOCK_M];
+            ACCUMULATOR_TYPE b_reg[BLOCK_N];
+            __attribute__((opencl_unroll_hint))
+            for (uint i = 0; i < BLOCK_M; ++i)
+                a_reg[i] = TO_ACCUMULATOR_TYPE(A_TILE(ly + i * LWS_M, k));
+            __attribute__((opencl_unroll_hint))
+            for (uint j = 0; j < BLOCK_N; ++j)
+                b_reg[j] = TO_ACCUMULATOR_TYPE(B_TILE(k, lx + j * LWS_N));
+
+            __attribute__((opencl_unroll_hint))
+            for (uint i = 0; i < BLOCK_M; ++i)
+            {
+                __attribute__((opencl_unroll_hint))
+                for (uint j = 0; j < BLOCK_N; ++j)
+                    acc[i][j] = mad(a_reg[i], b_reg[j], acc[i][j]);
+            }
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    __attribute__((opencl_unroll_hint))
+    for (uint i = 0; i < BLOCK_M; ++i)
+    {
+        const uint m = m0 + ly + i * LWS_M;
+        __attribute__((opencl_unroll_hint))
+        for (uint j = 0; j < BLOCK_N; ++j)
+        {
+            const uint n = n0 + lx + j * LWS_N;
+            if (m < MATRIX_M && n < MATRIX_N)
+            {
+                ACCUMULATOR_TYPE value = (ACCUMULATOR_TYPE)ALPHA * acc[i][j];
+#if OUT_BIAS_TERM
+                value += (ACCUMULATOR_TYPE)BETA * TO_ACCUMULATOR_TYPE(input2[INPUT2_OFFSET + b * INPUT2_BATCH_PITCH + m * INPUT2_Y_PITCH + n]);
+#endif
+                output[OUTPUT_OFFSET + b * OUTPUT_BATCH_PITCH + m * OUTPUT_Y_PITCH + n] = TO_OUTPUT_TYPE(value);
+            }
+        }
+    }
+}
+
+#undef LWS_N
+#undef LWS_M
+#undef LWS
+#undef A_ROWS
+#undef A_COLS
+#undef A_TILE
+#undef A_IN_RANGE
+#undef B_ROWS
+#undef B_COLS
+#undef B_TILE
+#undef B_IN_RANGE
+#undef INPUT0_VEC_TYPE
+#undef INPUT1_VEC_TYPE
+#undef LOAD_A
+#undef STORE_A
+#undef LOAD_B
+#undef STORE_B
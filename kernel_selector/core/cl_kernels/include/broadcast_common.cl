@@ -0,0 +1,70 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Output element (b, f, y, x) takes input element (b % INPUT0_BATCH_NUM, f % INPUT0_FEATURE_NUM, y % INPUT0_SIZE_Y,
+// x % INPUT0_SIZE_X), which covers both broadcast and tile. Work-item writes VEC_SIZE consecutive elements of
+// a bfyx output row: the source row is located once per work-item and the source x is advanced without divisions.
+
+#define BROADCAST_VEC_TYPE MAKE_VECTOR_TYPE(UNIT_TYPE, VEC_SIZE)
+
+inline void FUNC(broadcast_row)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output)
+{
+    const uint out_x0 = (uint)get_global_id(0) * VEC_SIZE;
+    const uint out_y  = (uint)get_global_id(1);
+    const uint out_fb = (uint)get_global_id(2);
+
+    const uint out_f  = out_fb % OUTPUT_FEATURE_NUM;
+    const uint out_b  = out_fb / OUTPUT_FEATURE_NUM;
+
+    const uint in_row  = GET_DATA_INDEX(INPUT0, out_b % INPUT0_BATCH_NUM, out_f % INPUT0_FEATURE_NUM, out_y % INPUT0_SIZE_Y, 0);
+    const uint out_row = GET_DATA_INDEX(OUTPUT, out_b, out_f, out_y, 0);
+
+    const bool full_vector = out_x0 + VEC_SIZE <= OUTPUT_SIZE_X;
+
+#if INPUT0_SIZE_X == 1
+    // single source element repeated along the row
+    const UNIT_TYPE val = input[in_row];
+    if (full_vector)
+    {
+        CAT(vstore, VEC_SIZE)((BROADCAST_VEC_TYPE)val, 0, output + out_row + out_x0);
+    }
+    else
+    {
+        for (uint x = out_x0; x < OUTPUT_SIZE_X; ++x)
+            output[out_row + x] = val;
+    }
+#elif INPUT0_SIZE_X == OUTPUT_SIZE_X
+    // whole row copied
+    if (full_vector)
+    {
+        CAT(vstore, VEC_SIZE)(CAT(vload, VEC_SIZE)(0, input + in_row + out_x0), 0, output + out_row + out_x0);
+    }
+    else
+    {
+        for (uint x = out_x0; x < OUTPUT_SIZE_X; ++x)
+            output[out_row + x] = input[in_row + x];
+    }
+#else
+    // row repeated OUTPUT_SIZE_X / INPUT0_SIZE_X times
+    uint in_x = out_x0 % INPUT0_SIZE_X;
+    const uint count = full_vector ? VEC_SIZE : OUTPUT_SIZE_X - out_x0;
+    for (uint i = 0; i < count; ++i)
+    {
+        output[out_row + out_x0 + i] = input[in_row + in_x];
+        in_x = (in_x + 1 == INPUT0_SIZE_X) ? 0 : in_x + 1;
+    }
+#endif
+}
+
+#undef BROADCAST_VEC_TYPE
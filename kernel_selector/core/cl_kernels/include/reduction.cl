@@ -0,0 +1,57 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Work-group reductions through a local memory tree. All work-items of the (one dimensional) work-group have to
+// call the function; scratch has to hold get_local_size(0) floats and the local size has to be a power of two.
+// Partial values are accumulated in float also for fp16 data. The result is returned to every work-item and the
+// scratch can be reused right after the call.
+
+inline float FUNC(work_group_reduce_sum)(float val, __local float* scratch)
+{
+    const uint lid = (uint)get_local_id(0);
+
+    scratch[lid] = val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint offset = (uint)get_local_size(0) / 2; offset > 0; offset /= 2)
+    {
+        if (lid < offset)
+            scratch[lid] += scratch[lid + offset];
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    const float result = scratch[0];
+    barrier(CLK_LOCAL_MEM_FENCE);
+    return result;
+}
+
+inline float FUNC(work_group_reduce_max)(float val, __local float* scratch)
+{
+    const uint lid = (uint)get_local_id(0);
+
+    scratch[lid] = val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for (uint offset = (uint)get_local_size(0) / 2; offset > 0; offset /= 2)
+    {
+        if (lid < offset)
+            scratch[lid] = fmax(scratch[lid], scratch[lid + offset]);
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    const float result = scratch[0];
+    barrier(CLK_LOCAL_MEM_FENCE);
+    return result;
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Bilinear sample of ROI Align at input coordinates (y, x). Samples more than one cell outside the feature map
+// contribute nothing (false is returned), others are clamped to it. pos holds the rows (y_low, y_high) and
+// the columns (x_low, x_high) of the four neighbours, frac the distances from the low row and column.
+inline bool FUNC(roi_align_point)(float y, float x, int src_h, int src_w, int4* pos, float2* frac)
+{
+    if (y < -1.f || y > (float)src_h || x < -1.f || x > (float)src_w)
+        return false;
+
+    y = max(y, 0.f);
+    x = max(x, 0.f);
+
+    int y_low = (int)y;
+    int x_low = (int)x;
+    int y_high = y_low + 1;
+    int x_high = x_low + 1;
+
+    if (y_low >= src_h - 1)
+    {
+        y_low = y_high = src_h - 1;
+        y = (float)y_low;
+    }
+    if (x_low >= src_w - 1)
+    {
+        x_low = x_high = src_w - 1;
+        x = (float)x_low;
+    }
+
+    *pos = (int4)(y_low, y_high, x_low, x_high);
+    *frac = (float2)(y - y_low, x - x_low);
+    return true;
+}
+
+inline float FUNC(roi_align_interpolate)(float top_left, float top_right, float bottom_left, float bottom_right, float2 frac)
+{
+    const float top = top_left + (top_right - top_left) * frac.s1;
+    const float bottom = bottom_left + (bottom_right - bottom_left) * frac.s1;
+    return top + (bottom - top) * frac.s0;
+}
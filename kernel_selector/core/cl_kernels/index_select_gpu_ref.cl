@@ -16,11 +16,11 @@
 
 
 KERNEL(index_select_gpu_ref)(
-    const __global UNIT_TYPE* input,
+    const __global INPUT0_TYPE* input,
     #ifndef REVERSE
-    const __global int* indices,
+    const __global INPUT1_TYPE* indices,
     #endif
-    __global UNIT_TYPE* output)
+    __global OUTPUT_TYPE* output)
 {
     // [CONSTEXPR]:
     const uint input_sx  = INPUT0_SIZE_X;
@@ -34,7 +34,7 @@ KERNEL(index_select_gpu_ref)(
     #ifdef REVERSE
     const uint indices_value = REVERSE_AXIS_SIZE - 1 - indices_idx;
     #else
-    const uint indices_value = indices[indices_idx];
+    const uint indices_value = (uint)indices[indices_idx];
     #endif
 
     // [LOGIC]:
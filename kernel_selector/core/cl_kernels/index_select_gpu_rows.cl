@@ -0,0 +1,54 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/include_all.cl"
+
+// Index selects a row of ROW_SIZE contiguous elements in each of the outer blocks (batch axis: one block,
+// feature axis: one per batch, y axis: one per batch and feature). Work-item copies VEC_SIZE elements of
+// the row, indices are read in their own type. Values are converted to the output type on store.
+
+#define TO_OUTPUT_VEC_TYPE(v) CAT(convert_, MAKE_VECTOR_TYPE(OUTPUT_TYPE, VEC_SIZE))(v)
+
+KERNEL(index_select_gpu_rows)(
+    const __global INPUT0_TYPE* input,
+    #ifndef REVERSE
+    const __global INPUT1_TYPE* indices,
+    #endif
+    __global OUTPUT_TYPE* output)
+{
+    const uint x           = (uint)get_global_id(0) * VEC_SIZE;
+    const uint indices_idx = (uint)get_global_id(1);
+    const uint outer       = (uint)get_global_id(2);
+    #ifdef REVERSE
+    const uint indices_value = REVERSE_AXIS_SIZE - 1 - indices_idx;
+    #else
+    const uint indices_value = (uint)indices[indices_idx];
+    #endif
+
+    const __global INPUT0_TYPE* src = input + (outer * AXIS_SIZE + indices_value) * ROW_SIZE;
+    __global OUTPUT_TYPE* dst = output + (outer * SELECTED_NUM + indices_idx) * ROW_SIZE;
+
+#if ROW_SIZE % VEC_SIZE != 0
+    if (x + VEC_SIZE > ROW_SIZE)
+    {
+        for (uint i = x; i < ROW_SIZE; ++i)
+            dst[i] = TO_OUTPUT_TYPE(src[i]);
+        return;
+    }
+#endif
+
+    CAT(vstore, VEC_SIZE)(TO_OUTPUT_VEC_TYPE(CAT(vload, VEC_SIZE)(0, src + x)), 0, dst + x);
+}
+
+#undef TO_OUTPUT_VEC_TYPE
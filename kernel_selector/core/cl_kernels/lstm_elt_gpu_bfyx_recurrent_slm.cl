@@ -0,0 +1,110 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+#define ACTIVATION_LOGISTIC(input)                      (UNIT_VAL_ONE/(UNIT_VAL_ONE + exp(-input)))
+#define ACTIVATION_HYPERBOLIC_TAN(input)                (tanh(input))
+
+#define ACC_TYPE4       MAKE_VECTOR_TYPE(ACCUMULATOR_TYPE, 4)
+#define TO_ACC_TYPE4    CAT(convert_, ACC_TYPE4)
+
+// gates     = [ batch, 1, direction, 4 * hidden_size ] input (Xt*W^T + Wb)
+// cell      = [ batch, 1, direction, hidden_size ] optional
+// hidden    = [ batch, 1, direction, hidden_size ]
+// recurrent = [     1, direction, 4 * hidden_size, hidden_size ]
+// output    = [ batch, 1, direction, hidden_size ] output
+// Each work-item computes one hidden unit of one batch: rows of all four gates of recurrent weights are multiplied
+// with the previous hidden state, which the work-group loads to local memory once.
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(lstm_elt_recurrent_slm)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output
+#if CELL_TERM
+    ,const __global OUTPUT_TYPE* cell
+#endif
+    ,const __global OUTPUT_TYPE* hidden
+    ,const __global RECURRENT_TYPE* recurrent
+    )
+{
+    const uint x = get_global_id(0);
+    const uint b = get_global_id(1);
+    const uint lid = get_local_id(0);
+
+    __local ACCUMULATOR_TYPE hidden_slm[HIDDEN_SIZE_X];
+    for (uint k = lid; k < HIDDEN_SIZE_X; k += LWS)
+    {
+        hidden_slm[k] = (ACCUMULATOR_TYPE)hidden[GET_DATA_INDEX(HIDDEN, b, 0, HIDDEN_DIRECTION, k)];
+    }
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    if (x >= OUTPUT_SIZE_X)
+        return;
+
+    ACCUMULATOR_TYPE it = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_I)];
+    ACCUMULATOR_TYPE ot = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_O)];
+    ACCUMULATOR_TYPE zt = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_Z)];
+    ACCUMULATOR_TYPE ft = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_F)];
+
+    const __global RECURRENT_TYPE* r_i = recurrent + GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_I, 0);
+    const __global RECURRENT_TYPE* r_o = recurrent + GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_O, 0);
+    const __global RECURRENT_TYPE* r_z = recurrent + GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_Z, 0);
+    const __global RECURRENT_TYPE* r_f = recurrent + GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_F, 0);
+
+    ACC_TYPE4 acc_i = 0;
+    ACC_TYPE4 acc_o = 0;
+    ACC_TYPE4 acc_z = 0;
+    ACC_TYPE4 acc_f = 0;
+
+    uint k = 0;
+    for (; k + 4 <= HIDDEN_SIZE_X; k += 4)
+    {
+        const ACC_TYPE4 h = vload4(0, hidden_slm + k);
+        acc_i = mad(h, TO_ACC_TYPE4(vload4(0, r_i + k)), acc_i);
+        acc_o = mad(h, TO_ACC_TYPE4(vload4(0, r_o + k)), acc_o);
+        acc_z = mad(h, TO_ACC_TYPE4(vload4(0, r_z + k)), acc_z);
+        acc_f = mad(h, TO_ACC_TYPE4(vload4(0, r_f + k)), acc_f);
+    }
+    for (; k < HIDDEN_SIZE_X; ++k)
+    {
+        const ACCUMULATOR_TYPE h = hidden_slm[k];
+        it += h * r_i[k];
+        ot += h * r_o[k];
+        zt += h * r_z[k];
+        ft += h * r_f[k];
+    }
+    it += acc_i.s0 + acc_i.s1 + acc_i.s2 + acc_i.s3;
+    ot += acc_o.s0 + acc_o.s1 + acc_o.s2 + acc_o.s3;
+    zt += acc_z.s0 + acc_z.s1 + acc_z.s2 + acc_z.s3;
+    ft += acc_f.s0 + acc_f.s1 + acc_f.s2 + acc_f.s3;
+
+    ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+
+#if INPUT_FORGET
+    val *= ((ACCUMULATOR_TYPE)1 - ft);
+#endif
+
+#if CELL_TERM
+    val += cell[GET_DATA_INDEX(CELL, b, 0, CELL_DIRECTION, x)] * ACTIVATION_LOGISTIC(CLIP(ft));
+#endif
+
+    output[GET_DATA_INDEX(OUTPUT, b, 0, 0, x)] = (OUTPUT_TYPE)(ACTIVATION_HYPERBOLIC_TAN(val) * ACTIVATION_LOGISTIC(ot)); // hidden
+    output[GET_DATA_INDEX(OUTPUT, b, 1, 0, x)] = (OUTPUT_TYPE)val; // cell
+}
+
+#undef ACC_TYPE4
+#undef TO_ACC_TYPE4
+#undef ACTIVATION_LOGISTIC
+#undef ACTIVATION_HYPERBOLIC_TAN
@@ -20,12 +20,17 @@
 
 // tempGEMM = [ batch, 1, direction, 4 * hidden_size ]
 // cell     = [ batch, 1, direction, hidden_size ] optional
+// hidden   = [ batch, 1, direction, hidden_size ] optional, Ht-1*R^T is added to tempGEMM
 // output   = [ batch, 1, direction, hidden_size ] output
 KERNEL(lstm_elt)(
     const __global INPUT0_TYPE* input,
     __global OUTPUT_TYPE* output
 #if CELL_TERM
     ,const __global OUTPUT_TYPE* cell
+#endif
+#if HIDDEN_TERM
+    ,const __global OUTPUT_TYPE* hidden
+    ,const __global RECURRENT_TYPE* recurrent
 #endif
     )
 {
@@ -36,12 +41,24 @@ KERNEL(lstm_elt)(
     ACCUMULATOR_TYPE ot = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_O)]; // pass constant offsets here
     ACCUMULATOR_TYPE zt = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_Z)];
 
-    ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
-
 #if CELL_TERM || INPUT_FORGET
     ACCUMULATOR_TYPE ft = input[GET_DATA_INDEX(INPUT0, b, 0, 0, x + GEMM_OFFSET_F)];
 #endif
 
+#if HIDDEN_TERM
+    for (uint k = 0; k < HIDDEN_SIZE_X; ++k) {
+        const ACCUMULATOR_TYPE h = hidden[GET_DATA_INDEX(HIDDEN, b, 0, HIDDEN_DIRECTION, k)];
+        it += h * recurrent[GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_I, k)];
+        ot += h * recurrent[GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_O, k)];
+        zt += h * recurrent[GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_Z, k)];
+#if CELL_TERM || INPUT_FORGET
+        ft += h * recurrent[GET_DATA_INDEX(RECURRENT, 0, DIRECTION, x + GEMM_OFFSET_F, k)];
+#endif
+    }
+#endif
+
+    ACCUMULATOR_TYPE val = ACTIVATION_LOGISTIC(CLIP(it)) * ACTIVATION_HYPERBOLIC_TAN(CLIP(zt));
+
 #if INPUT_FORGET
     val *= ((ACCUMULATOR_TYPE)1 - ft);
 #endif
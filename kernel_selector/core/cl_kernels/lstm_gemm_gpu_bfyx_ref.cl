@@ -25,6 +25,7 @@
 // biases    = [        1,         1,       direction, 4 * hidden_size ] optional
 // hidden    = [    batch, direction,               1,     hidden_size ] optional
 // tempGEMM  = [    batch, direction,               1, 4 * hidden_size ] output
+// Without hidden, input may contain the whole sequence and tempGEMM = [ batch, sequence, 1, 4 * hidden_size ].
 KERNEL(lstm_gemm)(
     const __global INPUT0_TYPE* input,
     __global OUTPUT_TYPE* output,
@@ -40,10 +41,11 @@ KERNEL(lstm_gemm)(
 {
     const uint y = get_global_id(0);
     const uint b = get_global_id(1);
+    const uint t = get_global_id(2);
 
     ACCUMULATOR_TYPE dotProd = 0;
     for(uint x = 0; x < INPUT0_SIZE_X; ++x ) {
-      const uint input_idx     = GET_DATA_INDEX(INPUT0, b, 0, INPUT_DIRECTION, x);
+      const uint input_idx     = GET_DATA_INDEX(INPUT0, b, t, INPUT_DIRECTION, x);
       const uint weights_idx   = GET_DATA_INDEX(WEIGHTS, 0, DIRECTION, y, x);
       dotProd += (ACCUMULATOR_TYPE)(input[input_idx] * weights[weights_idx]);
     }
@@ -60,6 +62,6 @@ KERNEL(lstm_gemm)(
     const uint bias_idx = GET_DATA_INDEX(BIAS, 0, 0, DIRECTION, y);
     dotProd += (ACCUMULATOR_TYPE)biases[bias_idx];
 #endif
-    const uint output_idx = GET_DATA_INDEX(OUTPUT, b, 0, 0, y);
+    const uint output_idx = GET_DATA_INDEX(OUTPUT, b, t, 0, y);
     output[output_idx] = (OUTPUT_TYPE)dotProd;
 }
\ No newline at end of file
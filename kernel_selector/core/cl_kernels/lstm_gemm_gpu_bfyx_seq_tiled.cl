@@ -0,0 +1,85 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/include_all.cl"
+
+#define ROWS (INPUT0_BATCH_NUM * INPUT0_FEATURE_NUM)
+
+// input     = [    batch,  sequence,               1,      input_size ]
+// weights   = [        1, direction, 4 * hidden_size,      input_size ]
+// biases    = [        1,         1,       direction, 4 * hidden_size ] optional
+// tempGEMM  = [    batch,  sequence,               1, 4 * hidden_size ] output
+// Input rows (batch * sequence) are multiplied by weights rows as one GEMM. A work-group computes TILE_SIZE x TILE_SIZE
+// outputs and both operands are staged through local memory in TILE_SIZE wide slices along input_size.
+__attribute__((reqd_work_group_size(TILE_SIZE, TILE_SIZE, 1)))
+KERNEL(lstm_gemm_seq_tiled)(
+    const __global INPUT0_TYPE* input,
+    __global OUTPUT_TYPE* output,
+    const __global WEIGHTS_TYPE* weights
+#if BIAS_TERM
+    , const __global BIAS_TYPE* biases
+#endif
+    )
+{
+    const uint y = get_global_id(0);
+    const uint row = get_global_id(1);
+    const uint ly = get_local_id(0);
+    const uint lrow = get_local_id(1);
+    const uint tile_y = get_group_id(0) * TILE_SIZE;
+    const uint tile_row = get_group_id(1) * TILE_SIZE;
+
+    __local ACCUMULATOR_TYPE input_tile[TILE_SIZE][TILE_SIZE];
+    __local ACCUMULATOR_TYPE weights_tile[TILE_SIZE][TILE_SIZE + 1];
+
+    // loads are mapped so that consecutive work-items read consecutive elements along input_size
+    const uint load_row = tile_row + lrow;
+    const uint load_b = load_row / INPUT0_FEATURE_NUM;
+    const uint load_t = load_row % INPUT0_FEATURE_NUM;
+    const uint load_y = tile_y + lrow;
+
+    ACCUMULATOR_TYPE dotProd = ACCUMULATOR_TYPE_ZERO;
+    for (uint x0 = 0; x0 < INPUT0_SIZE_X; x0 += TILE_SIZE)
+    {
+        const uint x = x0 + ly;
+
+        input_tile[lrow][ly] = (load_row < ROWS && x < INPUT0_SIZE_X) ?
+            (ACCUMULATOR_TYPE)input[GET_DATA_INDEX(INPUT0, load_b, load_t, INPUT_DIRECTION, x)] : ACCUMULATOR_TYPE_ZERO;
+        weights_tile[lrow][ly] = (load_y < OUTPUT_SIZE_X && x < INPUT0_SIZE_X) ?
+            (ACCUMULATOR_TYPE)weights[GET_DATA_INDEX(WEIGHTS, 0, DIRECTION, load_y, x)] : ACCUMULATOR_TYPE_ZERO;
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        __attribute__((opencl_unroll_hint(TILE_SIZE)))
+        for (uint k = 0; k < TILE_SIZE; ++k)
+        {
+            dotProd = mad(input_tile[lrow][k], weights_tile[ly][k], dotProd);
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if (row >= ROWS || y >= OUTPUT_SIZE_X)
+        return;
+
+#if BIAS_TERM
+    dotProd += (ACCUMULATOR_TYPE)biases[GET_DATA_INDEX(BIAS, 0, 0, DIRECTION, y)];
+#endif
+
+    const uint b = row / INPUT0_FEATURE_NUM;
+    const uint t = row % INPUT0_FEATURE_NUM;
+    output[GET_DATA_INDEX(OUTPUT, b, t, 0, y)] = (OUTPUT_TYPE)dotProd;
+}
+
+#undef ROWS
@@ -14,6 +14,7 @@
 
 #include "include/common.cl"
 #include "include/data_types.cl"
+#include "include/reduction.cl"
 
 
 #if FP16_UNIT_USED
@@ -50,19 +51,7 @@ KERNEL (mvn_gpu_bfyx_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* o
         my_sum += (float)input[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx];
     }
 
-    lg_storage[in_data_set_idx] = my_sum;
-
-    barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
-    {
-        for (uint i=1; i<LWS; ++i)
-            my_sum += lg_storage[i];
-
-        lg_storage[0] = my_sum / data_set_size;
-    }
-    barrier(CLK_LOCAL_MEM_FENCE);
-
-    my_sum = lg_storage[0];
+    my_sum = FUNC_CALL(work_group_reduce_sum)(my_sum, lg_storage) / data_set_size;
 
 #if NORMALIZE_VARIANCE == 0
     for (uint i=0; i<ITEMS_NUM; ++i)
@@ -70,8 +59,6 @@ KERNEL (mvn_gpu_bfyx_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* o
     if (in_data_set_idx < LEFTOVERS)
         output[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx] = ACTIVATION(UNIT_CVT_FUNC(input[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx]) - UNIT_CVT_FUNC(my_sum), NL_M ,NL_N);
 #else
-    barrier(CLK_LOCAL_MEM_FENCE);
-
     float my_variance = 0.f;
     //each WI reads ITEMS_NUM consecutive items from batch*feature
     for (uint i=0; i<ITEMS_NUM; ++i)
@@ -88,20 +75,8 @@ KERNEL (mvn_gpu_bfyx_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* o
         my_variance = fma(tmp, tmp, my_variance);
     }
 
-    lg_storage[in_data_set_idx] = my_variance;
-
-    barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
-    {
-        for (uint i=1; i<LWS; ++i)
-            my_variance += lg_storage[i];
-
-        my_variance /= data_set_size;
-        lg_storage[0] = native_powr(my_variance + (float)EPSILON, -0.5f);
-    }
-    barrier(CLK_LOCAL_MEM_FENCE);
-
-    my_variance = lg_storage[0];
+    my_variance = FUNC_CALL(work_group_reduce_sum)(my_variance, lg_storage) / data_set_size;
+    my_variance = native_powr(my_variance + (float)EPSILON, -0.5f);
 
     for (uint i=0; i<ITEMS_NUM; ++i)
         output[my_data_offset + i * workers_per_data_set] = ACTIVATION((UNIT_CVT_FUNC(input[my_data_offset + i * workers_per_data_set]) - UNIT_CVT_FUNC(my_sum)) * UNIT_CVT_FUNC(my_variance), NL_M ,NL_N);
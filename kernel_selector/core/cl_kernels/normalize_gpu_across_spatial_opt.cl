@@ -0,0 +1,74 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/reduction.cl"
+
+// Work-group normalizes one batch: work-items walk the f*y*x volume with LWS stride, the sum of squares is
+// reduced in float through local memory and every work-item scales its own elements.
+
+#define SPATIAL_SIZE (INPUT0_SIZE_Y * INPUT0_SIZE_X)
+
+inline uint FUNC(get_scale_index)(uint f)
+{
+#if SCALE_TABLE_FEATURE_NUM == 1
+    return 0;
+#elif INPUT0_FEATURE_NUM <= SCALE_TABLE_FEATURE_NUM
+    return f;
+#else
+    return f % SCALE_TABLE_FEATURE_NUM;
+#endif
+}
+
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL (normalize_gpu_across_spatial_opt)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output, const __global UNIT_TYPE* scale_input)
+{
+    const uint lid = (uint)get_local_id(0);
+    const uint b = (uint)get_global_id(2);
+
+    __local float scratch[LWS];
+
+    float partial = 0.f;
+    for (uint i = lid; i < INPUT0_FEATURE_NUM * SPATIAL_SIZE; i += LWS)
+    {
+        const uint f = i / SPATIAL_SIZE;
+        const uint y = (i % SPATIAL_SIZE) / INPUT0_SIZE_X;
+        const uint x = i % INPUT0_SIZE_X;
+        const float value = (float)input[GET_DATA_INDEX(INPUT0, b, f, y, x)];
+        partial = mad(value, value, partial);
+    }
+
+    float norm = EPSILON + FUNC_CALL(work_group_reduce_sum)(partial, scratch);
+    if (norm <= THRESHOLD)
+    {
+        norm = 0;
+    }
+    else
+    {
+        norm = native_powr(norm, -0.5f);
+    }
+
+    for (uint i = lid; i < INPUT0_FEATURE_NUM * SPATIAL_SIZE; i += LWS)
+    {
+        const uint f = i / SPATIAL_SIZE;
+        const uint y = (i % SPATIAL_SIZE) / INPUT0_SIZE_X;
+        const uint x = i % INPUT0_SIZE_X;
+        const float res = norm * (float)input[GET_DATA_INDEX(INPUT0, b, f, y, x)] * (float)scale_input[FUNC_CALL(get_scale_index)(f)];
+        output[GET_DATA_INDEX(OUTPUT, b, f, y, x)] = ACTIVATION((UNIT_TYPE)res, NL_M, NL_N);
+    }
+}
+
+#undef SPATIAL_SIZE
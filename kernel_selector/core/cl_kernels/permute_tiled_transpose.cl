@@ -0,0 +1,74 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+// Element at input coordinates idx goes to OUTPUT_OFFSET + sum(idx[d] * OUT_PITCH_d). Work-group transposes
+// TILE_SIZE x TILE_SIZE block spanned by input dimensions DIM_IN_INNERMOST (contiguous in input) and
+// DIM_OUT_INNERMOST (contiguous in output); each work-item moves TILE_SIZE / TILE_ROWS elements of a column.
+
+#define IN_PITCH(d)     CAT(IN_PITCH_, d)
+#define OUT_PITCH(d)    CAT(OUT_PITCH_, d)
+#define SIZE(d)         CAT(SIZE_, d)
+
+__attribute__((reqd_work_group_size(TILE_SIZE, TILE_ROWS, 1)))
+KERNEL(permute_tiled_transpose)(const __global INPUT0_TYPE* input, __global OUTPUT_TYPE* output)
+{
+    __local INPUT0_TYPE tile[TILE_SIZE][TILE_SIZE + 1];
+
+    const uint lx = (uint)get_local_id(0);
+    const uint ly = (uint)get_local_id(1);
+    const uint i_base = (uint)get_group_id(0) * TILE_SIZE;
+    const uint o_base = (uint)get_group_id(1) * TILE_SIZE;
+
+    const uint other0 = (uint)get_global_id(2) % SIZE(DIM_OTHER0);
+    const uint other1 = (uint)get_global_id(2) / SIZE(DIM_OTHER0);
+    const uint input_base = INPUT0_OFFSET + other0 * IN_PITCH(DIM_OTHER0) + other1 * IN_PITCH(DIM_OTHER1);
+    const uint output_base = OUTPUT_OFFSET + other0 * OUT_PITCH(DIM_OTHER0) + other1 * OUT_PITCH(DIM_OTHER1);
+
+    // rows of the tile are read along the input innermost dimension
+    const uint i_read = i_base + lx;
+    if (i_read < SIZE(DIM_IN_INNERMOST))
+    {
+        for (uint r = ly; r < TILE_SIZE; r += TILE_ROWS)
+        {
+            const uint o = o_base + r;
+            if (o < SIZE(DIM_OUT_INNERMOST))
+                tile[r][lx] = input[input_base + i_read * IN_PITCH(DIM_IN_INNERMOST) + o * IN_PITCH(DIM_OUT_INNERMOST)];
+        }
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // and written along the output innermost dimension
+    const uint o_write = o_base + lx;
+    if (o_write < SIZE(DIM_OUT_INNERMOST))
+    {
+        for (uint r = ly; r < TILE_SIZE; r += TILE_ROWS)
+        {
+            const uint i = i_base + r;
+            if (i < SIZE(DIM_IN_INNERMOST))
+            {
+                const uint output_idx = output_base + i * OUT_PITCH(DIM_IN_INNERMOST) + o_write * OUT_PITCH(DIM_OUT_INNERMOST);
+                output[output_idx] = ACTIVATION(tile[lx][r], NL_M, NL_N);
+            }
+        }
+    }
+}
+
+#undef IN_PITCH
+#undef OUT_PITCH
+#undef SIZE
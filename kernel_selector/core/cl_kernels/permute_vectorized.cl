@@ -0,0 +1,47 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+
+// Permutation which keeps the innermost dimension: element at input coordinates idx goes to
+// OUTPUT_OFFSET + sum(idx[d] * OUT_PITCH_d), so each work-item copies VEC_SIZE consecutive elements of a row.
+
+#define IN_PITCH(d)     CAT(IN_PITCH_, d)
+#define OUT_PITCH(d)    CAT(OUT_PITCH_, d)
+#define SIZE(d)         CAT(SIZE_, d)
+
+KERNEL(permute_vectorized)(const __global INPUT0_TYPE* input, __global OUTPUT_TYPE* output)
+{
+    const uint i = (uint)get_global_id(0) * VEC_SIZE;
+    const uint other0 = (uint)get_global_id(1);
+    const uint other1 = (uint)get_global_id(2) % SIZE(DIM_OTHER1);
+    const uint other2 = (uint)get_global_id(2) / SIZE(DIM_OTHER1);
+
+    const uint input_idx = INPUT0_OFFSET + i +
+                           other0 * IN_PITCH(DIM_OTHER0) + other1 * IN_PITCH(DIM_OTHER1) + other2 * IN_PITCH(DIM_OTHER2);
+    const uint output_idx = OUTPUT_OFFSET + i +
+                            other0 * OUT_PITCH(DIM_OTHER0) + other1 * OUT_PITCH(DIM_OTHER1) + other2 * OUT_PITCH(DIM_OTHER2);
+
+#if VEC_SIZE == 1
+    output[output_idx] = input[input_idx];
+#else
+    CAT(vstore, VEC_SIZE)(CAT(vload, VEC_SIZE)(0, input + input_idx), 0, output + output_idx);
+#endif
+}
+
+#undef IN_PITCH
+#undef OUT_PITCH
+#undef SIZE
@@ -0,0 +1,97 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/fetch.cl"
+
+// Each detection is [image_id, label, confidence, xmin, ymin, xmax, ymax], as in detection_output.
+#define ROW_SIZE 7
+#define ENTRIES (COORDS + CLASSES + 1)
+
+inline float FUNC(logistic)(float x)
+{
+    return 1.f / (1.f + exp(-x));
+}
+
+KERNEL(region_yolo_gpu_detect)(const __global INPUT0_TYPE* input, __global OUTPUT_TYPE* output, __global int* counter)
+{
+#if CLEAR_OUTPUT
+    const uint row = get_global_id(0);
+    if (row == 0)
+        *counter = 0;
+
+    const uint offset = OUTPUT_OFFSET + row*OUTPUT_Y_PITCH;
+    output[offset] = (OUTPUT_TYPE)(-1);
+    for (uint i = 1; i < ROW_SIZE; i++)
+        output[offset + i*OUTPUT_X_PITCH] = (OUTPUT_TYPE)0;
+#else
+    const uint x = get_global_id(0) % INPUT0_SIZE_X;
+    const uint y = get_global_id(0) / INPUT0_SIZE_X;
+    const uint n = get_global_id(1);
+    const uint b = get_global_id(2);
+
+#define READ_ENTRY(entry) ((float)input[GET_DATA_INDEX(INPUT0, b, n*ENTRIES + (entry), y, x)])
+
+    // class probabilities are at most the objectness, so most cells stop here
+    const float objectness = FUNC_CALL(logistic)(READ_ENTRY(COORDS));
+    if (objectness <= CONFIDENCE_THRESHOLD)
+        return;
+
+    const float center_x = (x + FUNC_CALL(logistic)(READ_ENTRY(0))) / INPUT0_SIZE_X;
+    const float center_y = (y + FUNC_CALL(logistic)(READ_ENTRY(1))) / INPUT0_SIZE_Y;
+    const float half_w = exp(READ_ENTRY(2)) * ANCHORS[2*n] / INPUT0_SIZE_X / 2;
+    const float half_h = exp(READ_ENTRY(3)) * ANCHORS[2*n + 1] / INPUT0_SIZE_Y / 2;
+
+#if DO_SOFTMAX
+    float max_score = READ_ENTRY(COORDS + 1);
+    for (uint c = 1; c < CLASSES; c++)
+        max_score = max(max_score, READ_ENTRY(COORDS + 1 + c));
+
+    float exp_sum = 0.f;
+    for (uint c = 0; c < CLASSES; c++)
+        exp_sum += exp(READ_ENTRY(COORDS + 1 + c) - max_score);
+#endif
+
+    for (uint c = 0; c < CLASSES; c++)
+    {
+#if DO_SOFTMAX
+        const float prob = objectness * exp(READ_ENTRY(COORDS + 1 + c) - max_score) / exp_sum;
+#else
+        const float prob = objectness * FUNC_CALL(logistic)(READ_ENTRY(COORDS + 1 + c));
+#endif
+        if (prob <= CONFIDENCE_THRESHOLD)
+            continue;
+
+        // detections beyond MAX_BOXES are dropped
+        const int row = atomic_inc(counter);
+        if (row >= MAX_BOXES)
+            return;
+
+        const uint offset = OUTPUT_OFFSET + row*OUTPUT_Y_PITCH;
+        output[offset + 0*OUTPUT_X_PITCH] = (OUTPUT_TYPE)b;
+        output[offset + 1*OUTPUT_X_PITCH] = (OUTPUT_TYPE)c;
+        output[offset + 2*OUTPUT_X_PITCH] = (OUTPUT_TYPE)prob;
+        output[offset + 3*OUTPUT_X_PITCH] = (OUTPUT_TYPE)(center_x - half_w);
+        output[offset + 4*OUTPUT_X_PITCH] = (OUTPUT_TYPE)(center_y - half_h);
+        output[offset + 5*OUTPUT_X_PITCH] = (OUTPUT_TYPE)(center_x + half_w);
+        output[offset + 6*OUTPUT_X_PITCH] = (OUTPUT_TYPE)(center_y + half_h);
+    }
+
+#undef READ_ENTRY
+#endif
+}
+
+#undef ROW_SIZE
+#undef ENTRIES
@@ -0,0 +1,132 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/reshape_dims.cl"
+#include "include/fetch.cl"
+
+#include "include/data_types.cl"
+
+///////////////////////// Input Index /////////////////////////
+inline uint FUNC(get_input_index)(uint b, uint f, uint y, uint x)
+{
+#if   INPUT0_SIMPLE
+    return GET_DATA_INDEX(INPUT0, b, f, y, x);
+#elif defined INPUT0_LAYOUT_BYXF_AF32
+    return GET_DATA_BYXF_AF32_INDEX(INPUT0, b, f, y, x);
+#elif defined INPUT0_LAYOUT_FS_BS_YX_BSV4_FSV32
+    return GET_DATA_FS_BS_YX_BSV4_FSV32_INDEX(INPUT0, b, f, y, x);
+#else
+#error reorder_data_tiled_transpose.cl: input format - not supported
+#endif
+}
+
+///////////////////////// Output Index /////////////////////////
+inline uint FUNC(get_output_index)(uint b, uint f, uint y, uint x)
+{
+#if   OUTPUT_SIMPLE
+    return GET_DATA_INDEX(OUTPUT, b, f, y, x);
+#elif defined OUTPUT_LAYOUT_BYXF_AF32
+    return GET_DATA_BYXF_AF32_INDEX(OUTPUT, b, f, y, x);
+#elif defined OUTPUT_LAYOUT_FS_BS_YX_BSV4_FSV32
+    return GET_DATA_FS_BS_YX_BSV4_FSV32_INDEX(OUTPUT, b, f, y, x);
+#else
+#error reorder_data_tiled_transpose.cl: output format - not supported
+#endif
+}
+
+// Tile dimensions: 0 - batch, 1 - feature, 2 - flattened y * x. Work-group moves TILE_SIZE x TILE_SIZE block
+// spanned by DIM_IN_INNERMOST (contiguous in input) and DIM_OUT_INNERMOST (contiguous in output) for one
+// coordinate of the remaining dimension; each work-item moves TILE_SIZE / TILE_ROWS elements of a column.
+
+#define SIZE_0      INPUT0_BATCH_NUM
+#define SIZE_1      INPUT0_FEATURE_NUM
+#define SIZE_2      (INPUT0_SIZE_Y * INPUT0_SIZE_X)
+#define SIZE(d)     CAT(SIZE_, d)
+
+#define COORD(d, in_c, out_c, other_c) ((d) == DIM_IN_INNERMOST ? (in_c) : (d) == DIM_OUT_INNERMOST ? (out_c) : (other_c))
+
+__attribute__((reqd_work_group_size(TILE_SIZE, TILE_ROWS, 1)))
+KERNEL (reorder_data_tiled_transpose)(
+    const __global INPUT_REORDER_TYPE* input,
+    __global OUTPUT_REORDER_TYPE* output
+#ifdef MEAN_SUBTRACT_IN_BUFFER
+    , __global MEAN_SUBTRACT_TYPE* mean_subtract
+#endif
+    )
+{
+    __local OUTPUT_REORDER_TYPE tile[TILE_SIZE][TILE_SIZE + 1];
+
+    const uint lx = (uint)get_local_id(0);
+    const uint ly = (uint)get_local_id(1);
+    const uint i_base = (uint)get_group_id(0) * TILE_SIZE;
+    const uint o_base = (uint)get_group_id(1) * TILE_SIZE;
+    const uint other = (uint)get_global_id(2);
+
+    // rows of the tile are read along the input innermost dimension
+    const uint i_read = i_base + lx;
+    if (i_read < SIZE(DIM_IN_INNERMOST))
+    {
+        for (uint r = ly; r < TILE_SIZE; r += TILE_ROWS)
+        {
+            const uint o = o_base + r;
+            if (o < SIZE(DIM_OUT_INNERMOST))
+            {
+                const uint b = COORD(0, i_read, o, other);
+                const uint f = COORD(1, i_read, o, other);
+                const uint yx = COORD(2, i_read, o, other);
+                const uint y = yx / INPUT0_SIZE_X;
+                const uint x = yx % INPUT0_SIZE_X;
+                const uint input_idx = FUNC_CALL(get_input_index)(b, f, y, x);
+
+#if defined MEAN_SUBTRACT_INSIDE_PARAMS
+                float res = TO_MEAN_TYPE(input[input_idx]);
+                res = MEAN_OP(res, VALUE_TO_SUBTRACT[f % VALUE_TO_SUBTRACT_SIZE]);
+#elif defined MEAN_SUBTRACT_IN_BUFFER
+                MEAN_SUBTRACT_TYPE res = TO_MEAN_TYPE(input[input_idx]);
+                uint4 msv = FUNC_CALL(reshape_dims)(b,f,y,x, INPUT0_SIZE_Y, INPUT0_SIZE_X, MEAN_SUBTRACT_SIZE_Y, MEAN_SUBTRACT_SIZE_X, INPUT0_DIMS, MEAN_SUBTRACT_DIMS);
+                res = MEAN_OP(res, mean_subtract[GET_DATA_INDEX_SAFE(MEAN_SUBTRACT, msv[0], msv[1], msv[2], msv[3])]);
+#else
+                CALC_TYPE res = TO_CALC_TYPE(input[input_idx]);
+#endif
+                tile[r][lx] = ACTIVATION(TO_OUTPUT_REORDER_TYPE(res), NL_M ,NL_N);
+            }
+        }
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // and written along the output innermost dimension
+    const uint o_write = o_base + lx;
+    if (o_write < SIZE(DIM_OUT_INNERMOST))
+    {
+        for (uint r = ly; r < TILE_SIZE; r += TILE_ROWS)
+        {
+            const uint i = i_base + r;
+            if (i < SIZE(DIM_IN_INNERMOST))
+            {
+                const uint b = COORD(0, i, o_write, other);
+                const uint f = COORD(1, i, o_write, other);
+                const uint yx = COORD(2, i, o_write, other);
+                output[FUNC_CALL(get_output_index)(b, f, yx / INPUT0_SIZE_X, yx % INPUT0_SIZE_X)] = tile[lx][r];
+            }
+        }
+    }
+}
+
+#undef SIZE_0
+#undef SIZE_1
+#undef SIZE_2
+#undef SIZE
+#undef COORD
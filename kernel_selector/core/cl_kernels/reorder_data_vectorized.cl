@@ -0,0 +1,93 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/reshape_dims.cl"
+#include "include/fetch.cl"
+
+#include "include/data_types.cl"
+
+// Input and output have the same layout and no padding, so element idx of the input goes to element idx
+// of the output. Work-item converts VEC_SIZE consecutive elements, the last one also handles the tail.
+
+inline OUTPUT_REORDER_TYPE FUNC(reorder_value)(INPUT_REORDER_TYPE val, uint idx
+#ifdef MEAN_SUBTRACT_IN_BUFFER
+    , const __global MEAN_SUBTRACT_TYPE* mean_subtract
+#endif
+    )
+{
+#if defined MEAN_SUBTRACT_INSIDE_PARAMS || defined MEAN_SUBTRACT_IN_BUFFER
+    const uint b = (idx / INPUT0_BATCH_PITCH) % INPUT0_BATCH_NUM;
+    const uint f = (idx / INPUT0_FEATURE_PITCH) % INPUT0_FEATURE_NUM;
+#if   INPUT0_DIMS == 2
+    const uint y = 0;
+    const uint x = 0;
+#else
+    const uint y = (idx / INPUT0_Y_PITCH) % INPUT0_SIZE_Y;
+    const uint x = (idx / INPUT0_X_PITCH) % INPUT0_SIZE_X;
+#endif
+#endif
+
+#if defined MEAN_SUBTRACT_INSIDE_PARAMS
+    float res = TO_MEAN_TYPE(val);
+    res = MEAN_OP(res, VALUE_TO_SUBTRACT[f % VALUE_TO_SUBTRACT_SIZE]);
+#elif defined MEAN_SUBTRACT_IN_BUFFER
+    MEAN_SUBTRACT_TYPE res = TO_MEAN_TYPE(val);
+    uint4 msv = FUNC_CALL(reshape_dims)(b,f,y,x, INPUT0_SIZE_Y, INPUT0_SIZE_X, MEAN_SUBTRACT_SIZE_Y, MEAN_SUBTRACT_SIZE_X, INPUT0_DIMS, MEAN_SUBTRACT_DIMS);
+    res = MEAN_OP(res, mean_subtract[GET_DATA_INDEX_SAFE(MEAN_SUBTRACT, msv[0], msv[1], msv[2], msv[3])]);
+#else
+    CALC_TYPE res = TO_CALC_TYPE(val);
+#endif
+
+    return ACTIVATION(TO_OUTPUT_REORDER_TYPE(res), NL_M ,NL_N);
+}
+
+#ifdef MEAN_SUBTRACT_IN_BUFFER
+    #define REORDER_VALUE(val, idx) FUNC_CALL(reorder_value)(val, idx, mean_subtract)
+#else
+    #define REORDER_VALUE(val, idx) FUNC_CALL(reorder_value)(val, idx)
+#endif
+
+KERNEL (reorder_data_vectorized)(
+    const __global INPUT_REORDER_TYPE* input,
+    __global OUTPUT_REORDER_TYPE* output
+#ifdef MEAN_SUBTRACT_IN_BUFFER
+    , __global MEAN_SUBTRACT_TYPE* mean_subtract
+#endif
+    )
+{
+    const uint idx = (uint)get_global_id(0) * VEC_SIZE;
+
+#if ELEMENTS_COUNT % VEC_SIZE != 0
+    if (idx + VEC_SIZE > ELEMENTS_COUNT)
+    {
+        for (uint i = idx; i < ELEMENTS_COUNT; ++i)
+            output[i] = REORDER_VALUE(input[i], i);
+        return;
+    }
+#endif
+
+    // lanes are converted one by one (mean depends on coordinates), but memory is accessed with vectors
+    INPUT_REORDER_TYPE in_vals[VEC_SIZE];
+    OUTPUT_REORDER_TYPE out_vals[VEC_SIZE];
+    CAT(vstore, VEC_SIZE)(CAT(vload, VEC_SIZE)(0, input + idx), 0, in_vals);
+
+    __attribute__((opencl_unroll_hint))
+    for (uint i = 0; i < VEC_SIZE; ++i)
+        out_vals[i] = REORDER_VALUE(in_vals[i], idx + i);
+
+    CAT(vstore, VEC_SIZE)(CAT(vload, VEC_SIZE)(0, out_vals), 0, output + idx);
+}
+
+#undef REORDER_VALUE
@@ -0,0 +1,186 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/roi_align.cl"
+
+// Work-group pools one channel of one ROI. The part of the feature map covered by the ROI is read once, with
+// consecutive work-items on consecutive elements, into local memory, then each work-item pools its bins from
+// there. Windows larger than WINDOW_CAPACITY are pooled straight from global memory.
+
+// Each RoI is described by 5 elements, the first one being unused.
+#define ROI_NUM_ELEMENTS 5
+
+#define SRC_W INPUT0_SIZE_X
+#define SRC_H INPUT0_SIZE_Y
+#define DST_W POOLED_WIDTH
+#define DST_H POOLED_HEIGHT
+#define PITCH_ROI_R INPUT1_BATCH_PITCH
+
+#define COORD_T float
+#define ACCUM_T float
+
+#if INPUT1_FEATURE_NUM != ROI_NUM_ELEMENTS
+#error - unknown ROI_POOLING kernel type
+#endif
+
+// [begin, after) range of the input covered by one bin along one axis. The kernel only serves plain ROI pooling
+// (GROUP_SIZE == 0), which uses the rounding of roi_pooling_ref.cl under USE_OLD_SCALE_AND_ROUNDING.
+inline int2 FUNC(bin_range)(int roi_start, int roi_size, int bin, int pooled, int src_size)
+{
+    const int begin = (bin * roi_size) / pooled;
+    const int after = ((bin + 1) * roi_size + pooled - 1) / pooled;
+    return (int2)(clamp(roi_start + begin, 0, src_size), clamp(roi_start + after, 0, src_size));
+}
+
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(roi_pooling_opt)
+(
+    const __global INPUT0_TYPE * src_data,
+    __global OUTPUT_TYPE * dst_data,
+    const __global INPUT1_TYPE * src_rois
+)
+{
+    __local ACCUM_T window[WINDOW_CAPACITY];
+
+    const uint lid = (uint)get_local_id(0);
+    const uint r = (uint)get_global_id(1);
+    const uint c = (uint)get_global_id(2);
+
+    const __global INPUT1_TYPE * roi_ptr = &src_rois[PITCH_ROI_R * r];
+    const __global INPUT0_TYPE * data = src_data + INPUT0_OFFSET + INPUT0_FEATURE_PITCH*c;
+
+#if ROI_ALIGN_POOLING
+    // no rounding of the ROI, malformed ones are treated as 1x1
+    const COORD_T roi_x = roi_ptr[1] * SPATIAL_SCALE;
+    const COORD_T roi_y = roi_ptr[2] * SPATIAL_SCALE;
+    const COORD_T roi_w = max(roi_ptr[3] * SPATIAL_SCALE - roi_x, 1.f);
+    const COORD_T roi_h = max(roi_ptr[4] * SPATIAL_SCALE - roi_y, 1.f);
+
+    const COORD_T bin_w = roi_w / DST_W;
+    const COORD_T bin_h = roi_h / DST_H;
+#if SAMPLING_RATIO > 0
+    const int grid_w = SAMPLING_RATIO;
+    const int grid_h = SAMPLING_RATIO;
+#else
+    const int grid_w = (int)ceil(bin_w);
+    const int grid_h = (int)ceil(bin_h);
+#endif
+
+    // neighbours of the samples, see roi_align_point
+    const int win_x0 = (int)clamp(floor(roi_x), 0.f, (COORD_T)(SRC_W - 1));
+    const int win_y0 = (int)clamp(floor(roi_y), 0.f, (COORD_T)(SRC_H - 1));
+    const int win_x1 = (int)clamp(floor(roi_x + roi_w) + 1.f, 0.f, (COORD_T)(SRC_W - 1)) + 1;
+    const int win_y1 = (int)clamp(floor(roi_y + roi_h) + 1.f, 0.f, (COORD_T)(SRC_H - 1)) + 1;
+#else
+    const int roi_x  = round(roi_ptr[1] * SPATIAL_SCALE);
+    const int roi_y  = round(roi_ptr[2] * SPATIAL_SCALE);
+    const int roi_x1 = round(roi_ptr[3] * SPATIAL_SCALE);
+    const int roi_y1 = round(roi_ptr[4] * SPATIAL_SCALE);
+
+    // the final coordinate is within the ROI and malformed dimensions are treated as 1
+    const int roi_w = max(roi_x1 - roi_x, 0) + 1;
+    const int roi_h = max(roi_y1 - roi_y, 0) + 1;
+
+    // bins are ordered, so the first and the last one bound the window
+    const int win_x0 = FUNC_CALL(bin_range)(roi_x, roi_w, 0, DST_W, SRC_W).s0;
+    const int win_y0 = FUNC_CALL(bin_range)(roi_y, roi_h, 0, DST_H, SRC_H).s0;
+    const int win_x1 = FUNC_CALL(bin_range)(roi_x, roi_w, DST_W - 1, DST_W, SRC_W).s1;
+    const int win_y1 = FUNC_CALL(bin_range)(roi_y, roi_h, DST_H - 1, DST_H, SRC_H).s1;
+#endif
+
+    const int win_w = max(win_x1 - win_x0, 0);
+    const int win_h = max(win_y1 - win_y0, 0);
+    const bool use_window = win_w * win_h <= WINDOW_CAPACITY;
+
+    if (use_window)
+    {
+        for (int i = (int)lid; i < win_w * win_h; i += LWS)
+        {
+            const int yy = win_y0 + i / win_w;
+            const int xx = win_x0 + i % win_w;
+            window[i] = (ACCUM_T)data[yy*INPUT0_Y_PITCH + xx*INPUT0_X_PITCH];
+        }
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+#define READ_INPUT(yy, xx) (use_window ? window[((yy) - win_y0)*win_w + (xx) - win_x0] : (ACCUM_T)data[(yy)*INPUT0_Y_PITCH + (xx)*INPUT0_X_PITCH])
+
+    for (uint bin = lid; bin < DST_W * DST_H; bin += LWS)
+    {
+        const int x = (int)(bin % DST_W);
+        const int y = (int)(bin / DST_W);
+
+#if ROI_ALIGN_POOLING
+        ACCUM_T res = 0;
+        for (int iy = 0; iy < grid_h; ++iy)
+        {
+            const COORD_T sy = roi_y + y*bin_h + (iy + .5f)*bin_h/grid_h;
+            for (int ix = 0; ix < grid_w; ++ix)
+            {
+                const COORD_T sx = roi_x + x*bin_w + (ix + .5f)*bin_w/grid_w;
+
+                int4 pos;
+                float2 frac;
+                if (FUNC_CALL(roi_align_point)(sy, sx, SRC_H, SRC_W, &pos, &frac))
+                {
+                    res += FUNC_CALL(roi_align_interpolate)(READ_INPUT(pos.s0, pos.s2), READ_INPUT(pos.s0, pos.s3),
+                                                            READ_INPUT(pos.s1, pos.s2), READ_INPUT(pos.s1, pos.s3), frac);
+                }
+            }
+        }
+        res /= grid_h*grid_w;
+#else
+        const int2 range_x = FUNC_CALL(bin_range)(roi_x, roi_w, x, DST_W, SRC_W);
+        const int2 range_y = FUNC_CALL(bin_range)(roi_y, roi_h, y, DST_H, SRC_H);
+
+#if MAX_POOLING
+        ACCUM_T res = range_x.s0 < range_x.s1 && range_y.s0 < range_y.s1 ? -FLT_MAX : 0;
+#else
+        ACCUM_T res = 0;
+#endif
+
+        for (int yy = range_y.s0; yy < range_y.s1; ++yy)
+        for (int xx = range_x.s0; xx < range_x.s1; ++xx)
+        {
+#if MAX_POOLING
+            res = max(res, READ_INPUT(yy, xx));
+#else
+            res = res + READ_INPUT(yy, xx);
+#endif
+        }
+
+#if !MAX_POOLING
+        const COORD_T area = (range_y.s1 - range_y.s0) * (range_x.s1 - range_x.s0);
+        if (area) res /= area;
+#endif
+#endif
+
+        const uint output_offset = OUTPUT_OFFSET + x*OUTPUT_X_PITCH + y*OUTPUT_Y_PITCH + c*OUTPUT_FEATURE_PITCH + r*OUTPUT_ROI_PITCH;
+        dst_data[output_offset] = ACTIVATION((OUTPUT_TYPE)res, NL_M, NL_N);
+    }
+
+#undef READ_INPUT
+}
+
+#undef ROI_NUM_ELEMENTS
+#undef SRC_W
+#undef SRC_H
+#undef DST_W
+#undef DST_H
+#undef PITCH_ROI_R
+#undef COORD_T
+#undef ACCUM_T
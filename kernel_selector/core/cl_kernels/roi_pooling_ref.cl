@@ -14,6 +14,7 @@
 
 #include "include/common.cl"
 #include "include/data_types.cl"
+#include "include/roi_align.cl"
 
 
 /****************************************************************************
@@ -114,6 +115,51 @@ KERNEL(roi_pooling_gpu)
 
     ACCUM_T res = top + (bottom - top) * (in_y - top_y_index);
 
+    dst_data[output_offset] = ACTIVATION((OUTPUT_TYPE)res, NL_M, NL_N);
+#elif ROI_ALIGN_POOLING
+    const uint output_offset = OUTPUT_OFFSET + x*OUTPUT_X_PITCH + y*OUTPUT_Y_PITCH + c*OUTPUT_FEATURE_PITCH + r*OUTPUT_ROI_PITCH;
+
+    // no rounding of the ROI, malformed ones are treated as 1x1
+    const COORD_T roi_x = roi_ptr[1] * SPATIAL_SCALE;
+    const COORD_T roi_y = roi_ptr[2] * SPATIAL_SCALE;
+    const COORD_T roi_w = max(roi_ptr[3] * SPATIAL_SCALE - roi_x, 1.f);
+    const COORD_T roi_h = max(roi_ptr[4] * SPATIAL_SCALE - roi_y, 1.f);
+
+    const COORD_T bin_w = roi_w / DST_W;
+    const COORD_T bin_h = roi_h / DST_H;
+#if SAMPLING_RATIO > 0
+    const int grid_w = SAMPLING_RATIO;
+    const int grid_h = SAMPLING_RATIO;
+#else
+    const int grid_w = (int)ceil(bin_w);
+    const int grid_h = (int)ceil(bin_h);
+#endif
+
+    const __global INPUT0_TYPE* data = src_data + INPUT0_OFFSET + INPUT0_FEATURE_PITCH*c;
+
+    ACCUM_T res = 0;
+    for (int iy = 0; iy < grid_h; ++iy)
+    {
+        const COORD_T sy = roi_y + y*bin_h + (iy + .5f)*bin_h/grid_h;
+        for (int ix = 0; ix < grid_w; ++ix)
+        {
+            const COORD_T sx = roi_x + x*bin_w + (ix + .5f)*bin_w/grid_w;
+
+            int4 pos;
+            float2 frac;
+            if (FUNC_CALL(roi_align_point)(sy, sx, SRC_H, SRC_W, &pos, &frac))
+            {
+                res += FUNC_CALL(roi_align_interpolate)(
+                    (ACCUM_T)data[pos.s0*INPUT0_Y_PITCH + pos.s2*INPUT0_X_PITCH],
+                    (ACCUM_T)data[pos.s0*INPUT0_Y_PITCH + pos.s3*INPUT0_X_PITCH],
+                    (ACCUM_T)data[pos.s1*INPUT0_Y_PITCH + pos.s2*INPUT0_X_PITCH],
+                    (ACCUM_T)data[pos.s1*INPUT0_Y_PITCH + pos.s3*INPUT0_X_PITCH],
+                    frac);
+            }
+        }
+    }
+    res /= grid_h*grid_w;
+
     dst_data[output_offset] = ACTIVATION((OUTPUT_TYPE)res, NL_M, NL_N);
 #else
 
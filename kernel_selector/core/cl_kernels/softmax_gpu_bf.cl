@@ -14,6 +14,7 @@
 
 #include "include/common.cl"
 #include "include/data_types.cl"
+#include "include/reduction.cl"
 
 
 __attribute__((reqd_work_group_size(LWS, 1, 1)))
@@ -29,74 +30,47 @@ KERNEL (softmax_gpu_continoues_bfyx)(const __global UNIT_TYPE* input, __global U
     const uint my_data_offset = data_set_offset + in_data_set_idx;
 
     UNIT_TYPE my_chunk[ITEMS_NUM + 1];
-    UNIT_TYPE my_maximum = -UNIT_VAL_MAX;
-    UNIT_TYPE my_sum = UNIT_VAL_ZERO;
-    UNIT_TYPE tmp;
+    float my_maximum = -FLT_MAX;
+    float my_sum = 0.f;
+    float tmp;
 
-    __local UNIT_TYPE lg_storage[LWS];
+    __local float lg_storage[LWS];
 
     //each WI reads ITEMS_NUM consecutive items from batch
     for (uint i=0; i<ITEMS_NUM; ++i)
     {
-        tmp = input[my_data_offset + i * workers_per_data_set];
-        my_maximum = max(my_maximum, tmp);
-        my_chunk[i] = tmp;
+        my_chunk[i] = input[my_data_offset + i * workers_per_data_set];
+        my_maximum = fmax(my_maximum, (float)my_chunk[i]);
     }
 
     if (in_data_set_idx < LEFTOVERS)
     {
-        tmp = input[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx];
-        my_maximum = max(my_maximum, tmp);
-        my_chunk[ITEMS_NUM] = tmp;
+        my_chunk[ITEMS_NUM] = input[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx];
+        my_maximum = fmax(my_maximum, (float)my_chunk[ITEMS_NUM]);
     }
 
-    lg_storage[in_data_set_idx] = my_maximum;
-
-    barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
-    {
-        for (uint i=1; i<LWS; ++i)
-            my_maximum = max(my_maximum, lg_storage[i]);
-
-        lg_storage[0] = my_maximum;
-    }
-    barrier(CLK_LOCAL_MEM_FENCE);
-
     //my_maximum from this point is in fact global maximum
-    my_maximum = lg_storage[0];
-
-    barrier(CLK_LOCAL_MEM_FENCE);
+    my_maximum = FUNC_CALL(work_group_reduce_max)(my_maximum, lg_storage);
 
+    // exponents are summed in float also for fp16 data
     for (uint i=0; i<ITEMS_NUM; ++i)
     {
-        tmp = native_exp(my_chunk[i] - my_maximum);
+        tmp = native_exp((float)my_chunk[i] - my_maximum);
         my_sum += tmp;
-        my_chunk[i] = tmp;
+        my_chunk[i] = (UNIT_TYPE)tmp;
     }
 
     if (in_data_set_idx < LEFTOVERS)
     {
-        tmp = native_exp(my_chunk[ITEMS_NUM] - my_maximum);
+        tmp = native_exp((float)my_chunk[ITEMS_NUM] - my_maximum);
         my_sum += tmp;
-        my_chunk[ITEMS_NUM] = tmp;
-    }
-
-    lg_storage[in_data_set_idx] = my_sum;
-
-    barrier(CLK_LOCAL_MEM_FENCE);
-    if (in_data_set_idx == 0)
-    {
-        for (uint i=1; i<LWS; ++i)
-            my_sum += lg_storage[i];
-
-        lg_storage[0] = my_sum;
+        my_chunk[ITEMS_NUM] = (UNIT_TYPE)tmp;
     }
-    barrier(CLK_LOCAL_MEM_FENCE);
 
-    my_sum = lg_storage[0];
+    const float inv_sum = 1.f / FUNC_CALL(work_group_reduce_sum)(my_sum, lg_storage);
 
     for (uint i=0; i<ITEMS_NUM; ++i)
-        output[my_data_offset + i * workers_per_data_set] = ACTIVATION(my_chunk[i] / my_sum, NL_M ,NL_N);
+        output[my_data_offset + i * workers_per_data_set] = ACTIVATION((UNIT_TYPE)((float)my_chunk[i] * inv_sum), NL_M ,NL_N);
     if (in_data_set_idx < LEFTOVERS)
-        output[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx] = ACTIVATION(my_chunk[ITEMS_NUM] / my_sum, NL_M ,NL_N);
+        output[data_set_offset + workers_per_data_set * ITEMS_NUM + in_data_set_idx] = ACTIVATION((UNIT_TYPE)((float)my_chunk[ITEMS_NUM] * inv_sum), NL_M ,NL_N);
 }
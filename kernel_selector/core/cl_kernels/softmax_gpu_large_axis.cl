@@ -0,0 +1,52 @@
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "include/common.cl"
+#include "include/data_types.cl"
+#include "include/reduction.cl"
+
+// Work-group computes one softmax over INPUT0_CLASS_NUM elements: each work-item walks the class axis with LWS
+// stride, maximum and sum of exponents are reduced in float through local memory and the input is read again
+// for every pass, so the class count is not limited by private memory.
+
+__attribute__((reqd_work_group_size(LWS, 1, 1)))
+KERNEL(softmax_gpu_large_axis)(const __global UNIT_TYPE* input, __global UNIT_TYPE* output)
+{
+    const uint lid    = (uint)get_local_id(0);
+    const uint other0 = (uint)get_group_id(0);
+    const uint other1 = (uint)get_global_id(1);
+    const uint batch  = (uint)get_global_id(2);
+
+    const uint in_depth_offset  = batch*INPUT0_BATCH_PITCH + other1*INPUT0_OTHER1_PITCH + other0*INPUT0_OTHER0_PITCH + INPUT0_OFFSET;
+    const uint out_depth_offset = batch*OUTPUT_BATCH_PITCH + other1*OUTPUT_OTHER1_PITCH + other0*OUTPUT_OTHER0_PITCH + OUTPUT_OFFSET;
+
+    __local float scratch[LWS];
+
+    float max_value = -FLT_MAX;
+    for (uint cls = lid; cls < INPUT0_CLASS_NUM; cls += LWS)
+        max_value = fmax(max_value, (float)input[in_depth_offset + cls*INPUT0_CLASS_PITCH]);
+    max_value = FUNC_CALL(work_group_reduce_max)(max_value, scratch);
+
+    float denominator = 0.f;
+    for (uint cls = lid; cls < INPUT0_CLASS_NUM; cls += LWS)
+        denominator += native_exp((float)input[in_depth_offset + cls*INPUT0_CLASS_PITCH] - max_value);
+    const float inv_denominator = 1.f / FUNC_CALL(work_group_reduce_sum)(denominator, scratch);
+
+    for (uint cls = lid; cls < INPUT0_CLASS_NUM; cls += LWS)
+    {
+        const float res = native_exp((float)input[in_depth_offset + cls*INPUT0_CLASS_PITCH] - max_value) * inv_denominator;
+        output[out_depth_offset + cls*OUTPUT_CLASS_PITCH] = ACTIVATION((UNIT_TYPE)res, NL_M, NL_N);
+    }
+}
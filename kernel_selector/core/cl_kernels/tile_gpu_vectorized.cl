@@ -1,4 +1,3 @@
-/*
 // Copyright (c) 2018 Intel Corporation
 //
 // Licensed under the Apache License, Version 2.0 (the "License");
@@ -12,15 +11,15 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
-*/
 
-#include "auto_tuner.h"
-#include "auto_tuner_offline.h"
-namespace kernel_selector 
+
+#include "include/include_all.cl"
+#include "include/broadcast_common.cl"
+
+
+KERNEL(tile_gpu_vectorized)(
+    const __global UNIT_TYPE* input,
+    __global UNIT_TYPE* output)
 {
-    // ICL_GT2
-    void tuning_cache_64(tuning_data& td)
-    {
-        tuning_cache_64_1(td);
-    }
-}
\ No newline at end of file
+    FUNC_CALL(broadcast_row)(input, output);
+}
@@ -145,6 +145,23 @@ namespace kernel_selector
         return args;
     }
 
+    // Tensors of fused operations - to be appended after all other arguments (see FUSED_OPS_DECLS).
+    Arguments common_kernel_base::GetFusedOpsArgsDesc(const base_params& params) const
+    {
+        Arguments args;
+        uint32_t index = 0;
+
+        for (const auto& op : params.fusedOps)
+        {
+            for (size_t i = 0; i < op.tensors.size(); i++)
+            {
+                args.push_back({ ArgumentDescriptor::Types::FUSED_OP_INPUT, index++ });
+            }
+        }
+
+        return args;
+    }
+
     std::shared_ptr<KernelString> common_kernel_base::GetKernelString(const std::string& name, const std::string& jit, const std::string& entry_point, const EngineInfo& engine_info, const std::string& exe_mode) const
     {
         std::shared_ptr<KernelString> kernel_string = std::make_shared<KernelString>();
@@ -49,6 +49,7 @@ namespace kernel_selector
         std::string                     CreateJit(const std::string& template_name, const JitConstants& constants, const std::string& kernel_name) const;
         std::string                     GetEntryPoint(const std::string& templateName, const std::string& layerID, const optional_params& options) const;
         Arguments                       GetArgsDesc(uint32_t num_of_input, bool use_weights, bool use_bias, bool use_quantization = false, bool use_calibration = 0) const;
+        Arguments                       GetFusedOpsArgsDesc(const base_params& params) const;
         std::shared_ptr<KernelString>   GetKernelString(const std::string& kernel_name, const std::string& jit, const std::string& entry_point, const EngineInfo& engine_info, const std::string& exe_mode = DEFAULT) const;
         void                            FillCLKernelData(clKernelData& kernel, const CommonDispatchData& runInfo, const EngineInfo& engine_info, const std::string& kernel_map_name, const std::string& jit, const std::string& entry_point, const std::string& exe_mode = DEFAULT,
                                                             bool weights = false, bool bias = false, int number_of_inputs = 1, bool quantization = false, bool calibration = false) const;    };
@@ -411,6 +411,7 @@ namespace kernel_selector {
 
         // for activation function
         jit.Merge(MakeActivationJitConstants(params.activation));
+        jit.Merge(MakeFusedOpsJitConstants(params));
 
         for (size_t i = 0; i < params.inputs.size(); i++)
         {
@@ -420,6 +421,152 @@ namespace kernel_selector {
         return jit;
     }
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // MakeFusedOpsJitConstants
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    namespace
+    {
+        std::string FusedOpTensorName(size_t op, size_t tensor)
+        {
+            return "FUSED_OP" + toCodeString(op) + "_INPUT" + toCodeString(tensor);
+        }
+
+        std::string FusedOpArgName(size_t op, size_t tensor)
+        {
+            return "fused_op" + toCodeString(op) + "_input" + toCodeString(tensor);
+        }
+
+        // Index of the element of fused op tensor at output position (b, f, y, x). Dimensions of size 1 are broadcasted.
+        std::string FusedOpTensorIndex(const DataTensor& t, const std::string& name)
+        {
+            const std::string b = t.Batch().v == 1 ? "0" : "(b)";
+            const std::string f = t.Feature().v == 1 ? "0" : "(f)";
+            const std::string y = t.Y().v == 1 ? "0" : "(y)";
+            const std::string x = t.X().v == 1 ? "0" : "(x)";
+            const std::string coords = name + ", " + b + ", " + f + ", " + y + ", " + x;
+
+            if (t.SimpleLayout())
+                return "GET_DATA_INDEX(" + coords + ")";
+            if (t.GetLayout() == DataLayout::bf8_xy16)
+                return "GET_DATA_BF8_XY16_INDEX(" + coords + ")";
+
+            throw std::runtime_error("Unsupported layout of fused operation tensor: " + toString(t.GetLayout()));
+        }
+
+        // Loads vectorSize consecutive batches (or a single element when vectorSize is 1).
+        std::string FusedOpTensorLoad(const DataTensor& t, size_t op, size_t tensor, size_t vectorSize)
+        {
+            const std::string arg = FusedOpArgName(op, tensor);
+            const std::string index = FusedOpTensorIndex(t, FusedOpTensorName(op, tensor));
+            if (vectorSize == 1 || t.Batch().v == 1)
+                return arg + "[" + index + "]";
+
+            if (t.Batch().pitch != 1 || !t.SimpleLayout())
+                throw std::runtime_error("Fused operation tensor batches are not contiguous");
+
+            return "vload" + toCodeString(vectorSize) + "(0, " + arg + " + " + index + ")";
+        }
+
+        // FUSED_OPS(val, b, f, y, x) (or FUSED_OPS_VEC<vectorSize>) applies all fused operations in order.
+        JitConstants MakeFusedOpsApplyJitConstants(const base_params& params, size_t vectorSize)
+        {
+            const std::string suffix = vectorSize == 1 ? "" : "_VEC" + toCodeString(vectorSize);
+            JitConstants jit{};
+            std::string ops;
+
+            for (size_t i = 0; i < params.fusedOps.size(); i++)
+            {
+                const auto& op = params.fusedOps[i];
+                const std::string opName = "FUSED_OP" + toCodeString(i) + suffix;
+                std::string expr;
+
+                switch (op.type)
+                {
+                case FusedOpType::ACTIVATION:
+                {
+                    const std::string activationSuffix = "_FUSED_OP" + toCodeString(i);
+                    expr = "ACTIVATION" + activationSuffix + "(val, NL_M" + activationSuffix + ", NL_N" + activationSuffix + ")";
+                    break;
+                }
+                case FusedOpType::SCALE:
+                    expr = "(val) * " + FusedOpTensorLoad(op.tensors.at(0), i, 0, vectorSize);
+                    if (op.tensors.size() > 1)
+                        expr += " + " + FusedOpTensorLoad(op.tensors[1], i, 1, vectorSize);
+                    break;
+                case FusedOpType::ELTWISE:
+                {
+                    const std::string operand = FusedOpTensorLoad(op.tensors.at(0), i, 0, vectorSize);
+                    switch (op.mode)
+                    {
+                    case EltwiseMode::ADD: expr = "(val) + " + operand; break;
+                    case EltwiseMode::SUB: expr = "(val) - " + operand; break;
+                    case EltwiseMode::MUL: expr = "(val) * " + operand; break;
+                    case EltwiseMode::DIV: expr = "(val) / " + operand; break;
+                    case EltwiseMode::MIN: expr = "UNIT_MIN_FUNC(val, " + operand + ")"; break;
+                    case EltwiseMode::MAX: expr = "UNIT_MAX_FUNC(val, " + operand + ")"; break;
+                    default:
+                        throw std::runtime_error("Unsupported fused eltwise mode: " + toString(op.mode));
+                    }
+                    break;
+                }
+                default:
+                    throw std::runtime_error("Unsupported fused operation");
+                }
+
+                jit.AddConstant(MakeJitConstant(opName + "(val, b, f, y, x)", "(" + expr + ")"));
+                ops += "val = " + opName + "(val, b, f, y, x); ";
+            }
+
+            jit.AddConstant(MakeJitConstant("FUSED_OPS" + suffix + "(val, b, f, y, x)", ops.empty() ? "" : "{ " + ops + "}"));
+            return jit;
+        }
+    }
+
+    JitConstants MakeFusedOpsJitConstants(const base_params& params)
+    {
+        JitConstants jit{};
+        std::string decls;
+
+        for (size_t i = 0; i < params.fusedOps.size(); i++)
+        {
+            const auto& op = params.fusedOps[i];
+            if (op.type == FusedOpType::ACTIVATION)
+                jit.Merge(MakeActivationJitConstants(op.activation, "_FUSED_OP" + toCodeString(i)));
+
+            for (size_t j = 0; j < op.tensors.size(); j++)
+            {
+                if (op.tensors[j].GetDType() != params.output.GetDType())
+                    throw std::runtime_error("Fused operation tensor data type differs from the output");
+
+                jit.AddConstant(MakeJitConstant(FusedOpTensorName(i, j), op.tensors[j]));
+                decls += ", const __global UNIT_TYPE* " + FusedOpArgName(i, j);
+            }
+        }
+
+        // kernel parameters of fused op tensors - placed at the end of kernel parameters list
+        jit.AddConstant(MakeJitConstant("FUSED_OPS_DECLS", decls));
+        jit.Merge(MakeFusedOpsApplyJitConstants(params, 1));
+        return jit;
+    }
+
+    JitConstants MakeFusedOpsBatchVectorJitConstants(const base_params& params, size_t vectorSize)
+    {
+        return MakeFusedOpsApplyJitConstants(params, vectorSize);
+    }
+
+    bool FusedOpsSupportBatchVectors(const base_params& params)
+    {
+        for (const auto& op : params.fusedOps)
+        {
+            for (const auto& t : op.tensors)
+            {
+                if (t.Batch().v != 1 && (t.Batch().pitch != 1 || !t.SimpleLayout()))
+                    return false;
+            }
+        }
+        return true;
+    }
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // MakeLoopUnrollParamsJitConstants
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +240,9 @@ public:
 
 JitConstants MakeActivationJitConstants(const base_activation_params& params, const std::string& suffix="");
 JitConstants MakeBaseParamsJitConstants(const base_params& params);
+JitConstants MakeFusedOpsJitConstants(const base_params& params);
+JitConstants MakeFusedOpsBatchVectorJitConstants(const base_params& params, size_t vectorSize);
+bool FusedOpsSupportBatchVectors(const base_params& params);
 JitConstants MakeLoopUnrollParamsJitConstants(uint32_t loopCount);
 JitConstants MakeUnitTypeJitConstants(Datatype dataType);
 
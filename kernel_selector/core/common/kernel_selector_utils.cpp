@@ -131,6 +131,8 @@ namespace kernel_selector {
             weightsReorderParams.dtype = dtype;
             weightsReorderParams.destLayout = r_params.output.GetLayout();
             weightsReorderParams.toImageType = Tensor::IsImageType(r_params.output.GetLayout());
+            weightsReorderParams.input = r_params.input;
+            weightsReorderParams.output = r_params.output;
 
             newParams.weights = r_params.output;
         }
@@ -227,4 +229,17 @@ namespace kernel_selector {
 
         return no_pitch_same_dims;
     }
-}
\ No newline at end of file
+
+    // Power of two work-group size for local memory tree reductions (include/reduction.cl): as big as the device
+    // allows (one float of local memory per work-item, at most 256), but not bigger than the reduced extent.
+    size_t GetReductionWorkGroupSize(const EngineInfo& engineInfo, size_t reducedSize)
+    {
+        const size_t max_lws = std::min<size_t>(256, std::min<size_t>(engineInfo.maxWorkGroupSize, engineInfo.maxLocalMemSize / sizeof(float)));
+
+        size_t lws = 1;
+        while (lws * 2 <= max_lws && lws < reducedSize)
+            lws *= 2;
+
+        return lws;
+    }
+}
@@ -31,4 +31,5 @@ namespace kernel_selector {
     std::vector<size_t> GetTensorFriendlyWorkGroups(const DataTensor& t);
     std::vector<size_t> GetOptimalLocalWorkGroupSizes(std::vector<size_t> gws);
     bool CheckInputsOutputNoPitchSameDims(const base_params& params);
+    size_t GetReductionWorkGroupSize(const EngineInfo& engineInfo, size_t reducedSize);
 }
\ No newline at end of file
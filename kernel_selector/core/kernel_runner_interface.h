@@ -21,8 +21,9 @@ namespace kernel_selector
     class KernelRunnerInterface
     {
     public:
-        // Gets a list of kernels, executes them and returns the run time of each kernel (in nano-seconds).
-        virtual std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData) = 0;
+        // Gets a list of kernels, executes each of them runsPerKernel times and returns the average run time of each kernel (in nano-seconds).
+        // (runsPerKernel was added for pruned tuning search, implementations which always executed kernels 3 times have to take it into account)
+        virtual std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData, uint32_t runsPerKernel) = 0;
 
         virtual ~KernelRunnerInterface() = default;
     };
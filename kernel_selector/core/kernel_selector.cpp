@@ -17,6 +17,7 @@
 #include "kernel_base.h"
 #include "kernel_selector_common.h"
 #include "kernel_selector.h"
+#include "auto_tuner_search.h"
 #include <type_traits>
 #include <sstream>
 #include <fstream>
@@ -36,6 +37,16 @@ namespace kernel_selector {
 
     AutoTuner kernel_selector_base::autoTuner;
 
+    // Logical dimensions of the first input and the output - used to find the nearest already tuned layer.
+    static std::vector<size_t> GetTuningShape(const Params& params)
+    {
+        const auto& baseParams = static_cast<const base_params&>(params);
+        std::vector<size_t> shape = baseParams.inputs[0].LogicalDims();
+        const auto outputDims = baseParams.output.LogicalDims();
+        shape.insert(shape.end(), outputDims.begin(), outputDims.end());
+        return shape;
+    }
+
 #ifdef ENABLE_ENV
     std::string strip(const std::string str)
     {
@@ -206,26 +217,22 @@ namespace kernel_selector {
             // Start on-line tuning
             assert(options.tuningParams.runner);
 
+            const auto shape = GetTuningShape(params);
+            const auto seed = autoTuner.FindNearestTunedShape(kType, shape);
+
+            std::vector<TuningCandidate> candidates;
             for (const auto& implementation : implementations)
             {
-                printf("%s \n", implementation->GetName().c_str());
-
                 const ParamsKey implKey = implementation->GetSupportedKey();
                 if (implKey.Support(requireKey) && implKey.TuningSupport())
                 {
                     try
                     {
                         KernelsData kds = implementation->GetKernelsDataForAutoTune(params, options);
-                        std::vector<uint64_t> runTimes = options.tuningParams.runner->run_kernels(kds);
-                        
-                        for (size_t i = 0; i < kds.size(); i++)
+                        for (auto& kd : kds)
                         {
-                            kds[i].runTime = runTimes[i];
-                            if (kernelsData.size() == 0 || kds[i].runTime < kernelsData[0].runTime)
-                            {
-                                kernelsData = { kds[i] };
-                                kernelName = implementation->GetName();                                
-                            }
+                            const bool isSeed = implementation->GetName() == std::get<0>(seed) && kd.autoTuneIndex == std::get<1>(seed);
+                            candidates.push_back({ std::move(kd), implementation->GetName(), isSeed });
                         }
                     }
                     catch (std::runtime_error&)
@@ -235,6 +242,47 @@ namespace kernel_selector {
                 }
             }
 
+            // Kernels of each implementation are executed by a separate call, as the runner allocates
+            // buffers (i.e. weights in implementation specific layout) based on the first kernel.
+            TuningRunner runner = [&](const std::vector<size_t>& indices, uint32_t runs)
+            {
+                std::vector<uint64_t> runTimes(indices.size(), std::numeric_limits<uint64_t>::max());
+                std::map<std::string, std::vector<size_t>> byImplementation;
+                for (size_t i = 0; i < indices.size(); i++)
+                    byImplementation[candidates[indices[i]].implementationName].push_back(i);
+
+                for (const auto& impl : byImplementation)
+                {
+                    KernelsData kds;
+                    for (auto i : impl.second)
+                        kds.push_back(candidates[indices[i]].kernelData);
+                    try
+                    {
+                        const auto implRunTimes = options.tuningParams.runner->run_kernels(kds, runs);
+                        for (size_t i = 0; i < impl.second.size(); i++)
+                            runTimes[impl.second[i]] = implRunTimes[i];
+                    }
+                    catch (std::runtime_error&)
+                    {
+                        // we have to handle it in order to avoid exception in KernelSelector as much we can
+                    }
+                }
+                return runTimes;
+            };
+
+            TuningSearchStats stats;
+            AutoTuneSearch search(options.tuningParams.exhaustiveSearch, options.tuningParams.layerTimeBudgetMs, params.engineInfo.computeUnitsCount);
+            const int best = search.Run(candidates, runner, stats);
+            if (best >= 0)
+            {
+                kernelsData = { candidates[best].kernelData };
+                kernelName = candidates[best].implementationName;
+                ENV_PRINTF("%s: %s [%d] %llu ns (%zu configs, %zu pruned, %zu kernel runs in %zu rounds, %.1f ms%s)\n",
+                    params.layerID.c_str(), kernelName.c_str(), kernelsData[0].autoTuneIndex, static_cast<unsigned long long>(stats.bestRunTime),
+                    stats.candidates, stats.pruned, stats.kernelRuns, stats.rounds, stats.tuningTimeUs / 1000.0,
+                    stats.budgetExceeded ? ", time budget exceeded" : "");
+            }
+
             //try to fallback to reference kernels if no optimized were found during tuning
             if (!kernelsData.size())
             {
@@ -248,7 +296,7 @@ namespace kernel_selector {
                         try
                         {
                             KernelsData kds = implementation->GetKernelsDataForAutoTune(params, options);
-                            std::vector<uint64_t> runTimes = options.tuningParams.runner->run_kernels(kds);
+                            std::vector<uint64_t> runTimes = options.tuningParams.runner->run_kernels(kds, AutoTuneSearch::exhaustiveRuns);
 
                             for (size_t i = 0; i < kds.size(); i++)
                             {
@@ -273,6 +321,7 @@ namespace kernel_selector {
                 kernelsData[0].kernelName = kernelName;
                 kernelsData[0].kernels[0].layerID = params.layerID;
                 autoTuner.StoreKernel(options.tuningParams.cacheFilePath, hash, kernelName, kernelsData[0].autoTuneIndex);
+                autoTuner.StoreTunedShape(kType, shape, kernelName, kernelsData[0].autoTuneIndex);
             }
         } 
 
@@ -146,6 +146,7 @@ namespace kernel_selector
         case KernelType::ELTWISE:           return "ELTWISE";
         case KernelType::REORDER:           return "REORDER";
         case KernelType::SELECT:            return "SELECT";
+        case KernelType::FUSED_OPS:         return "FUSED_OPS";
         default:
             return "";
         }
@@ -171,6 +172,18 @@ namespace kernel_selector
         }
     }
 
+    std::string toString(FusedOpType type)
+    {
+        switch (type)
+        {
+        case FusedOpType::ACTIVATION:   return "ACTIVATION";
+        case FusedOpType::SCALE:        return "SCALE";
+        case FusedOpType::ELTWISE:      return "ELTWISE";
+        default:
+            return "";
+        }
+    }
+
     std::string toString(ReorderMode mode)
     {
         switch (mode)
@@ -241,6 +254,7 @@ namespace kernel_selector
         case PoolType::AVG: return "AVG";
         case PoolType::MAX_WITH_ARGMAX: return "MAX_WITH_ARGMAX";
         case PoolType::BILINEAR: return "BILINEAR";
+        case PoolType::ROI_ALIGN: return "ROI_ALIGN";
         default: return "";
         }
     }
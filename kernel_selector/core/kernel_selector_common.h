@@ -149,7 +149,8 @@ namespace kernel_selector {
             HIDDEN,    // RNN/LSTM/GRU hidden input
             CELL,      // LSTM cell input
             LSTM_PACK, // LSTM packed output
-            LEARNING_RATE
+            LEARNING_RATE,
+            FUSED_OP_INPUT, // tensors of fused operations, in order of base_params::fusedOps
         };
 
         enum class ScalarTypes
@@ -220,6 +221,8 @@ namespace kernel_selector {
         WeightsType dtype = WeightsType::F16;
         WeightsLayout destLayout = WeightsLayout::oiyx;
         bool toImageType = false;
+        WeightsTensor input;        // source and destination of the reorder, used when it's done on host
+        WeightsTensor output;
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +268,7 @@ namespace kernel_selector {
     std::string toString(WeightsType wType);
     std::string toString(KernelType kt);
     std::string toString(EltwiseMode b_mode);
+    std::string toString(FusedOpType type);
     std::string toString(ReorderMode mode);
     std::string toString(MeanSubtractMode mode);
     std::string toString(ArgMaxMinOut mode);
@@ -273,6 +273,10 @@ namespace kernel_selector {
             break;
         case PoolType::BILINEAR:
             key.restrict.val.dedicated.pooling.bilinear = 1;
+            break;
+        case PoolType::ROI_ALIGN:
+            key.restrict.val.dedicated.pooling.roi_align = 1;
+            break;
         default:
             break;
         }
@@ -555,6 +559,11 @@ namespace kernel_selector {
             k.EnableGradient();
         }
 
+        if (!fusedOps.empty())
+        {
+            k.EnableFusedOps();
+        }
+
         return k;
     }
 
@@ -577,6 +586,18 @@ namespace kernel_selector {
         }
         s << toString(output);
 
+        // fused operations change the kernel's work, so fused layers get their own tuning results (cached by the hash);
+        // the string of an unfused layer stays the same as before
+        for (const auto& op : fusedOps)
+        {
+            s << "_fused_" << toString(op.type);
+            if (op.type == FusedOpType::ACTIVATION)
+                s << "_" << op.activation.to_string();
+            else if (op.type == FusedOpType::ELTWISE)
+                s << "_" << toString(op.mode);
+            for (const auto& tensor : op.tensors)
+                s << "_" << toString(tensor);
+        }
         return s.str();
     }
 }
\ No newline at end of file
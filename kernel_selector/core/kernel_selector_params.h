@@ -67,6 +67,7 @@ namespace kernel_selector
                     uint32_t FP16Emulation : 1;
                     uint32_t gradient : 1;
                     uint32_t momentum : 1;
+                    uint32_t fusedOps : 1;
 
                     union dedicated_t
                     {
@@ -116,6 +117,7 @@ namespace kernel_selector
                             uint32_t max_with_argmax : 1;
                             uint32_t ceil : 1;
                             uint32_t bilinear : 1;
+                            uint32_t roi_align : 1;
                             uint32_t fixedKenrelDivider : 1;
                             uint32_t dynamicKenrelDivider : 1;
                             uint32_t dynamicKenrelDividerWithPadding : 1;
@@ -181,6 +183,7 @@ namespace kernel_selector
                         } lstm_gemm;
                         struct lstm_elt_t {
                             uint32_t cell : 1;
+                            uint32_t hidden : 1;
                         } lstm_elt;
                     } dedicated;
                 } val;
@@ -256,6 +259,7 @@ namespace kernel_selector
         void EnableBiasPerOutput() { key.restrict.val.biasPerOutput = 1; }
         void EnableActivationAdditionalParamsAsInput() { key.restrict.val.activationAdditionalParamsAsInput = 1; }
         void EnableMomentum() { key.restrict.val.momentum = 1; }
+        void EnableFusedOps() { key.restrict.val.fusedOps = 1; }
         void EnableLRNMode(LRNMode m);
         void EnableLookUpTableAxis(LookUpTableAxis m);
         void EnableNormalizeMode(NormalizeMode m);
@@ -280,6 +284,7 @@ namespace kernel_selector
         void EnableLSTMGEMMBias() { key.restrict.val.dedicated.lstm_gemm.bias = 1; }
         void EnableLSTMGEMMHidden() { key.restrict.val.dedicated.lstm_gemm.hidden = 1; }
         void EnableLSTMEltCell() { key.restrict.val.dedicated.lstm_elt.cell = 1; }
+        void EnableLSTMEltHidden() { key.restrict.val.dedicated.lstm_elt.hidden = 1; }
         void EnableConcatKernelPerInput() { key.restrict.val.dedicated.concat.kernelPerInput = 1; }
         void DisableTuning() { key.enableTuning = 0; }
         void EnableConcatOneKernel() { key.restrict.val.dedicated.concat.oneKernel = 1; }
@@ -357,6 +362,19 @@ namespace kernel_selector
         virtual std::string to_string() const;
     };
 
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // fused_operation_desc
+    ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Elementwise operation applied to the output of the kernel before it is stored (after the kernel's own activation).
+    // Tensors are additional kernel inputs - indexed by output position, dimensions of size 1 are broadcasted.
+    struct fused_operation_desc
+    {
+        FusedOpType             type = FusedOpType::ACTIVATION;
+        base_activation_params  activation;                     // ACTIVATION
+        EltwiseMode             mode = EltwiseMode::ADD;        // ELTWISE: output = output <mode> tensors[0]
+        MultiDataTensor         tensors;                        // SCALE: scale and optional shift, ELTWISE: second operand
+    };
+
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     // base_params
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -364,10 +382,11 @@ namespace kernel_selector
     {
         virtual ~base_params() {}
 
-        base_activation_params activation;
-        MultiDataTensor        inputs;
-        DataTensor             output;
-        bool                   gradient = false;
+        base_activation_params              activation;
+        MultiDataTensor                     inputs;
+        DataTensor                          output;
+        bool                                gradient = false;
+        std::vector<fused_operation_desc>   fusedOps;
 
         virtual std::string to_string() const;
         virtual ParamsKey GetParamsKey() const;
@@ -385,8 +404,10 @@ namespace kernel_selector
         TuningMode mode;
         std::string cacheFilePath;
         std::shared_ptr<KernelRunnerInterface> runner;
+        bool exhaustiveSearch;          // measure all configs of all implementations instead of pruned successive halving search
+        uint32_t layerTimeBudgetMs;     // on-line tuning time budget per layer (0 - unlimited)
 
-        TuningParams() : mode(TuningMode::TUNING_DISABLED), cacheFilePath(""), runner(nullptr) {}
+        TuningParams() : mode(TuningMode::TUNING_DISABLED), cacheFilePath(""), runner(nullptr), exhaustiveSearch(true), layerTimeBudgetMs(0) {}
     };
 
     ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,257 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include "tuning_cache_db.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace kernel_selector
+{
+    namespace
+    {
+        const char db_magic[8] = { 'C', 'L', 'D', 'N', 'N', 'T', 'D', 'B' };
+        const uint32_t db_version = 1;
+    }
+
+    struct tuning_cache_db::header
+    {
+        char magic[8];
+        uint32_t version;
+        uint32_t sections_count;
+        uint32_t names_count;
+        uint32_t reserved;
+    };
+
+    struct tuning_cache_db::section
+    {
+        uint32_t compute_units_count;
+        uint32_t first_entry;
+        uint32_t entries_count;
+        uint32_t reserved;
+    };
+
+    struct tuning_cache_db::entry
+    {
+        uint64_t hash;
+        uint32_t name_id;
+        int32_t tune_index;
+    };
+
+    struct tuning_cache_db::name
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct tuning_cache_db::mapped_file
+    {
+        const void* data = nullptr;
+        size_t size = 0;
+#ifdef _WIN32
+        HANDLE file = INVALID_HANDLE_VALUE;
+        HANDLE mapping = NULL;
+
+        explicit mapped_file(const std::string& path)
+        {
+            file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+            if (file == INVALID_HANDLE_VALUE)
+                throw std::runtime_error("Tuning database: " + path + " could not be opened!");
+
+            LARGE_INTEGER file_size;
+            if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0)
+            {
+                CloseHandle(file);
+                throw std::runtime_error("Tuning database: " + path + " is empty!");
+            }
+            size = static_cast<size_t>(file_size.QuadPart);
+
+            mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+            if (mapping != NULL)
+                data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+            if (data == nullptr)
+            {
+                if (mapping != NULL)
+                    CloseHandle(mapping);
+                CloseHandle(file);
+                throw std::runtime_error("Tuning database: " + path + " could not be mapped!");
+            }
+        }
+
+        ~mapped_file()
+        {
+            UnmapViewOfFile(data);
+            CloseHandle(mapping);
+            CloseHandle(file);
+        }
+#else
+        explicit mapped_file(const std::string& path)
+        {
+            int fd = open(path.c_str(), O_RDONLY);
+            if (fd < 0)
+                throw std::runtime_error("Tuning database: " + path + " could not be opened!");
+
+            struct stat st;
+            if (fstat(fd, &st) != 0 || st.st_size == 0)
+            {
+                close(fd);
+                throw std::runtime_error("Tuning database: " + path + " is empty!");
+            }
+            size = static_cast<size_t>(st.st_size);
+
+            void* ptr = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);
+            if (ptr == MAP_FAILED)
+                throw std::runtime_error("Tuning database: " + path + " could not be mapped!");
+            data = ptr;
+        }
+
+        ~mapped_file()
+        {
+            munmap(const_cast<void*>(data), size);
+        }
+#endif
+    };
+
+    tuning_cache_db::tuning_cache_db(const void* data, size_t size)
+        : _data(static_cast<const uint8_t*>(data))
+        , _size(size)
+    {
+        validate();
+    }
+
+    tuning_cache_db::tuning_cache_db(std::unique_ptr<mapped_file> file)
+        : _file(std::move(file))
+        , _data(static_cast<const uint8_t*>(_file->data))
+        , _size(_file->size)
+    {
+        validate();
+    }
+
+    tuning_cache_db::~tuning_cache_db() = default;
+
+    std::shared_ptr<tuning_cache_db> tuning_cache_db::load(const std::string& path)
+    {
+        std::unique_ptr<mapped_file> file(new mapped_file(path));
+        return std::shared_ptr<tuning_cache_db>(new tuning_cache_db(std::move(file)));
+    }
+
+    bool tuning_cache_db::is_tuning_cache_db(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+        char magic[sizeof(db_magic)] = {};
+        file.read(magic, sizeof(magic));
+        return file.good() && std::memcmp(magic, db_magic, sizeof(db_magic)) == 0;
+    }
+
+    void tuning_cache_db::validate()
+    {
+        static_assert(sizeof(entry) == 16, "tuning database entry has to be packed to 16 bytes");
+
+        if (_size < sizeof(header) || std::memcmp(_data, db_magic, sizeof(db_magic)) != 0)
+            throw std::runtime_error("Tuning database: bad signature.");
+
+        _header = reinterpret_cast<const header*>(_data);
+        if (_header->version != db_version)
+            throw std::runtime_error("Tuning database: unsupported version " + std::to_string(_header->version) + ".");
+
+        size_t offset = sizeof(header);
+        _sections = reinterpret_cast<const section*>(_data + offset);
+        offset += _header->sections_count * sizeof(section);
+        if (offset > _size)
+            throw std::runtime_error("Tuning database: truncated sections table.");
+
+        size_t entries_count = 0;
+        for (uint32_t i = 0; i < _header->sections_count; i++)
+        {
+            if (_sections[i].first_entry != entries_count ||
+                (i > 0 && _sections[i - 1].compute_units_count >= _sections[i].compute_units_count))
+                throw std::runtime_error("Tuning database: bad sections table.");
+            entries_count += _sections[i].entries_count;
+        }
+
+        _entries = reinterpret_cast<const entry*>(_data + offset);
+        offset += entries_count * sizeof(entry);
+        _names = reinterpret_cast<const name*>(_data + offset);
+        offset += _header->names_count * sizeof(name);
+        if (offset > _size)
+            throw std::runtime_error("Tuning database: truncated entries or names table.");
+
+        _names_blob = reinterpret_cast<const char*>(_data + offset);
+        const size_t blob_size = _size - offset;
+        for (uint32_t i = 0; i < _header->names_count; i++)
+        {
+            if (static_cast<size_t>(_names[i].offset) + _names[i].length > blob_size)
+                throw std::runtime_error("Tuning database: truncated names blob.");
+        }
+
+        // lookups are binary searches, so entries have to be sorted by hash within each section
+        for (uint32_t i = 0; i < _header->sections_count; i++)
+        {
+            const auto first = _entries + _sections[i].first_entry;
+            const auto last = first + _sections[i].entries_count;
+            for (auto it = first; it != last; ++it)
+            {
+                if (it->name_id >= _header->names_count)
+                    throw std::runtime_error("Tuning database: bad kernel name id.");
+                if (it != first && (it - 1)->hash >= it->hash)
+                    throw std::runtime_error("Tuning database: entries are not sorted.");
+            }
+        }
+    }
+
+    const tuning_cache_db::section* tuning_cache_db::get_section(uint32_t compute_units_count) const
+    {
+        const auto sections_end = _sections + _header->sections_count;
+        const auto it = std::lower_bound(_sections, sections_end, compute_units_count,
+            [](const section& s, uint32_t cu) { return s.compute_units_count < cu; });
+        if (it == sections_end || it->compute_units_count != compute_units_count)
+            return nullptr;
+        return it;
+    }
+
+    bool tuning_cache_db::has_section(uint32_t compute_units_count) const
+    {
+        return get_section(compute_units_count) != nullptr;
+    }
+
+    std::tuple<std::string, int> tuning_cache_db::find(uint32_t compute_units_count, uint64_t hash) const
+    {
+        const auto sec = get_section(compute_units_count);
+        if (sec == nullptr)
+            return std::make_tuple("", 0);
+
+        const auto first = _entries + sec->first_entry;
+        const auto last = first + sec->entries_count;
+        const auto it = std::lower_bound(first, last, hash, [](const entry& e, uint64_t h) { return e.hash < h; });
+        if (it == last || it->hash != hash)
+            return std::make_tuple("", 0);
+
+        const auto& kernel_name = _names[it->name_id];
+        return std::make_tuple(std::string(_names_blob + kernel_name.offset, kernel_name.length), it->tune_index);
+    }
+}
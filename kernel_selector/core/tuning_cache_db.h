@@ -0,0 +1,73 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <tuple>
+
+namespace kernel_selector
+{
+    /*
+        Read-only view of binary tuning database (see cache/tuning_cache_db_gen.py for the layout and the converter).
+        Database contains one section per compute units count, each one is a table of (hash -> kernel name id, tune index)
+        entries sorted by hash, so lookups are binary searches directly over the underlying memory - the table is never copied.
+        Layout, sort order and name ids are validated on construction, invalid database throws std::runtime_error.
+        The memory is either provided by the caller (i.e. database embedded into the library) or memory-mapped from a file.
+    */
+    class tuning_cache_db
+    {
+    public:
+        // Creates view over existing memory. The memory has to outlive the object and be 8-byte aligned.
+        tuning_cache_db(const void* data, size_t size);
+        ~tuning_cache_db();
+
+        tuning_cache_db(const tuning_cache_db&) = delete;
+        tuning_cache_db& operator=(const tuning_cache_db&) = delete;
+
+        // Memory-maps database file. Throws if file cannot be mapped or is not a valid database.
+        static std::shared_ptr<tuning_cache_db> load(const std::string& path);
+        // Returns true if the file starts with the database signature.
+        static bool is_tuning_cache_db(const std::string& path);
+
+        bool has_section(uint32_t compute_units_count) const;
+        // Returns (kernel name, tune index), or empty kernel name if there is no entry for the hash.
+        std::tuple<std::string, int> find(uint32_t compute_units_count, uint64_t hash) const;
+
+    private:
+        struct header;
+        struct section;
+        struct entry;
+        struct name;
+        struct mapped_file;
+
+        tuning_cache_db(std::unique_ptr<mapped_file> file);
+        void validate();
+        const section* get_section(uint32_t compute_units_count) const;
+
+        std::unique_ptr<mapped_file> _file;
+        const uint8_t* _data;
+        size_t _size;
+
+        const header* _header = nullptr;
+        const section* _sections = nullptr;
+        const entry* _entries = nullptr;
+        const name* _names = nullptr;
+        const char* _names_blob = nullptr;
+    };
+}
@@ -112,5 +112,27 @@ border_inst::typed_primitive_inst(network_impl& network, border_node const& node
         CLDNN_ERROR_TENSOR_SIZES_GREATER_THAN(node.id(), "Right/Bottom border sizes", rb_sizes, "input_sizes - 1", reduced_input_sizes,
                                               "Not enough data in input to create mirror-101 border of specified size");
     }
+
+    if (node.can_be_optimized())
+    {
+        build_deps();
+        reuse_input();
+    }
+}
+
+void border_inst::on_execute()
+{
+    if (!node.can_be_optimized())
+        return;
+
+    if (_output && _network.get_engine().is_the_same_buffer(output_memory(), input_memory()))
+        return;
+
+    reuse_input();
+}
+
+void border_inst::reuse_input()
+{
+    _output = _network.get_engine().reinterpret_buffer(input_memory(), node.get_output_layout());
 }
 }
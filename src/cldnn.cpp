@@ -25,6 +25,8 @@
 #include "memory_impl.h"
 #include "primitive_inst.h"
 
+#include <algorithm>
+
 namespace cldnn {
     last_err& last_err::instance()
     {
@@ -283,6 +285,58 @@ int64_t cldnn_get_temp_used_device_memory_size(cldnn_engine engine, cldnn_status
     });
 }
 
+void cldnn_get_kernels_build_stats(cldnn_engine engine, cldnn_kernels_build_info* stats, size_t size, char* names, size_t names_size,
+    size_t* size_ret, size_t* names_size_ret, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(engine, "Engine");
+        SHOULD_NOT_BE_NULL(size_ret, "Size ret");
+        SHOULD_NOT_BE_NULL(names_size_ret, "Names size ret");
+        auto build_stats = api_cast(engine)->get_kernels_build_stats();
+
+        size_t required_names = 0;
+        for (auto& info : build_stats)
+        {
+            required_names += info.bucket.size() + 1;
+            for (auto& kernel : info.kernels)
+                required_names += kernel.entry_point.size() + 1;
+            required_names += 1;
+        }
+        *size_ret = build_stats.size();
+        *names_size_ret = required_names;
+
+        if (size < build_stats.size() || names_size < required_names)
+            return;
+
+        size_t offset = 0;
+        auto add_name = [&](const std::string& name)
+        {
+            std::copy(name.begin(), name.end(), names + offset);
+            offset += name.size();
+            names[offset++] = '\0';
+        };
+        size_t i = 0;
+        for (auto& info : build_stats)
+        {
+            stats[i].bucket = offset;
+            add_name(info.bucket);
+            stats[i].entry_points = offset;
+            for (auto& kernel : info.kernels)
+                add_name(kernel.entry_point);
+            names[offset++] = '\0';
+            stats[i].part = info.part;
+            stats[i].kernels_count = static_cast<uint32_t>(info.kernels.size());
+            stats[i].source_size = info.source_size;
+            stats[i].jit_defines = info.jit_defines;
+            stats[i].build_time_us = info.build_time_us;
+            stats[i].build_log_size = info.build_log_size;
+            stats[i].succeeded = info.succeeded;
+            ++i;
+        }
+    });
+}
+
 cldnn_event cldnn_create_user_event(cldnn_engine engine, cldnn_status* status)
 {
     return exception_handler<cldnn_event>(CLDNN_ERROR, status, nullptr, [&]()
@@ -466,6 +520,17 @@ void cldnn_set_network_input(cldnn_network network, cldnn_primitive_id id, cldnn
     });
 }
 
+void cldnn_update_network_data(cldnn_network network, cldnn_primitive_id id, cldnn_memory mem, cldnn_status* status)
+{
+    exception_handler(CLDNN_ERROR, status, [&]()
+    {
+        SHOULD_NOT_BE_NULL(mem,         "Mem");
+        SHOULD_NOT_BE_NULL(network,     "Network");
+        SHOULD_NOT_BE_NULL(id,          "Id");
+        api_cast(network)->update_data(id, *api_cast(mem));
+    });
+}
+
 void cldnn_set_learning_rate(cldnn_network network, float lr, cldnn_status* status)
 {
     exception_handler(CLDNN_ERROR, status, [&]()
@@ -502,6 +567,42 @@ cldnn_program cldnn_get_network_program(cldnn_network network, cldnn_status* sta
     });
 }
 
+uint32_t cldnn_get_network_id(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<uint32_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return api_cast(network)->get_id();
+    });
+}
+
+size_t cldnn_get_network_eliminated_copy_bytes(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<size_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return api_cast(network)->get_program().get_eliminated_copy_bytes();
+    });
+}
+
+size_t cldnn_get_network_removed_duplicates(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<size_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return api_cast(network)->get_program().get_removed_duplicates();
+    });
+}
+
+size_t cldnn_get_network_removed_duplicate_bytes(cldnn_network network, cldnn_status* status)
+{
+    return exception_handler<size_t>(CLDNN_ERROR, status, 0, [&]()
+    {
+        SHOULD_NOT_BE_NULL(network, "Network");
+        return api_cast(network)->get_program().get_removed_duplicate_bytes();
+    });
+}
+
 void cldnn_get_primitive_info(cldnn_network network, cldnn_primitive_id prim_id, char* info, size_t size, size_t* size_ret, cldnn_status* status)
 {
     return exception_handler(CLDNN_ERROR, status, [&]()
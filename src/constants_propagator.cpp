@@ -22,6 +22,8 @@
 
 #include "api/CPP/input_layout.hpp"
 
+#include <algorithm>
+
 using namespace cldnn;
 
 constants_propagator::constants_propagator(program_impl::ptr program) : prog(program)
@@ -30,41 +32,82 @@ constants_propagator::constants_propagator(program_impl::ptr program) : prog(pro
 
 void constants_propagator::visit_node(program_node& node)
 {
-    if (node.is_constant())
-        handle_constant(node);
+    if (node.is_constant() && !node.is_type<data>())
+        const_nodes.push_back(&node);
 }
 
 std::list<std::pair<primitive_id, memory_impl::ptr>> constants_propagator::calculate()
 {
-    if (!has_non_trivial_constants)
+    if (const_nodes.empty())
         return{};
 
+    //constants are evaluated on host when possible, the remaining ones are calculated by internal network
+    //(nodes are visited in processing order, so all dependencies are handled before their users)
+    std::list<std::pair<primitive_id, memory_impl::ptr>> ret;
+    host_evaluator evaluator(prog->get_engine(), prog->get_options().get<build_option_type::host_weights_reorder>()->enabled());
+    for (auto node : const_nodes)
+    {
+        if (evaluate_on_host(evaluator, *node))
+        {
+            if (node->has_non_const_user() || node->is_endpoint() || node->is_output())
+                ret.push_back({ node->id(), host_results.at(node) });
+            continue;
+        }
+
+        add_constant(*node);
+        if (node->has_non_const_user())
+            const_outputs.push_back(node->id());
+    }
+
+    if (const_outputs.empty())
+        return ret;
+
     build_options bo;
     bo.set_option(build_option::optimize_data(false));
     bo.set_option(build_option::outputs(const_outputs));
     network_impl::ptr net = prog->get_engine().build_network(tpl, bo, true);
     for (auto& cin : const_inputs)
-        net->set_input_data(cin->id(), cin->get_attached_memory());
+        net->set_input_data(cin.first, *cin.second);
 
     net->execute({});
     net->reset_execution(true); //wait for computations to complete
     auto outputs = net->get_outputs();
 
-    std::list<std::pair<primitive_id, memory_impl::ptr>> ret;
     for (auto& out : outputs)
         ret.push_back({ out->id(), &out->output_memory() });
 
     return ret;
 }
 
-void constants_propagator::handle_constant(program_node& node)
+bool constants_propagator::is_host_available(program_node& node) const
 {
-    if (!node.is_type<data>())
+    return node.is_type<data>() || host_results.count(&node) != 0;
+}
+
+memory_impl::ptr constants_propagator::get_host_memory(program_node& node) const
+{
+    if (node.is_type<data>())
+        return &node.as<data>().get_attached_memory();
+    return host_results.at(&node);
+}
+
+bool constants_propagator::evaluate_on_host(host_evaluator& evaluator, program_node& node)
+{
+    const auto& deps = node.get_dependencies();
+    if (!std::all_of(deps.begin(), deps.end(), [this](program_node* dep) { return is_host_available(*dep); }) ||
+        !evaluator.can_evaluate(node))
+        return false;
+
+    std::vector<memory_impl::ptr> inputs;
+    std::vector<memory_impl*> inputs_ptrs;
+    for (auto dep : deps)
     {
-        add_constant(node);
-        if (node.has_non_const_user())
-            const_outputs.push_back(node.id());
+        inputs.push_back(get_host_memory(*dep));
+        inputs_ptrs.push_back(inputs.back().get());
     }
+
+    host_results[&node] = evaluator.evaluate(node, inputs_ptrs);
+    return true;
 }
 
 void constants_propagator::add_constant(program_node& node)
@@ -73,13 +116,12 @@ void constants_propagator::add_constant(program_node& node)
         return;
 
     tpl.add(node.desc);
-    has_non_trivial_constants = true;
 
     //if a node is either an endpoint or an output, always add it as an output
     if (node.is_endpoint() || node.is_output())
         const_outputs.push_back(node.id());
 
-    //if a non-tirivial constant has a trivial input, add this input as an input for our network
+    //if a non-tirivial constant has a trivial (or evaluated on host) input, add this input as an input for our network
     add_deps_to_tpl(node.get_dependencies());
 }
 
@@ -95,11 +137,11 @@ void constants_propagator::add_deps_to_tpl(const std::vector<program_node*>& dep
      */
     for (auto& dep : deps)
     {
-        if (dep->is_type<data>())
+        if (is_host_available(*dep))
         {
             if (is_already_in_tpl(dep->id())) continue;
-            tpl.add(std::make_shared<input_layout>(dep->id(), dep->as<data>().get_primitive()->mem.get_layout()));
-            const_inputs.push_back(&dep->as<data>());
+            tpl.add(std::make_shared<input_layout>(dep->id(), dep->get_output_layout()));
+            const_inputs.push_back({ dep->id(), get_host_memory(*dep) });
         }
     }
 }
@@ -0,0 +1,188 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "data_updater.h"
+#include "data_inst.h"
+#include "program_impl.h"
+#include "program_node.h"
+#include "topology_impl.h"
+#include "error_handler.h"
+
+#include <algorithm>
+#include <cstring>
+
+using namespace cldnn;
+
+namespace
+{
+    void copy_content(memory_impl& src, memory_impl& dst, size_t dst_offset = 0)
+    {
+        if (&src == &dst)
+            return;
+
+        mem_lock<char> src_lock{ src };
+        mem_lock<char> dst_lock{ dst };
+        std::memcpy(dst_lock.data() + dst_offset, src_lock.data(), src.size());
+    }
+}
+
+data_updater::data_updater(engine_impl& engine, bool host_weights_reorder)
+    : _engine(engine), _host_weights_reorder(host_weights_reorder)
+{
+}
+
+void data_updater::add_source(const primitive_id& id, memory_impl& mem)
+{
+    _sources[id] = &mem;
+}
+
+void data_updater::add_slice(memory_impl& src, memory_impl& dst, size_t dst_offset)
+{
+    _slices.push_back({ &src, &dst, dst_offset });
+    _steps.push_back({ step_type::slice, _slices.size() - 1 });
+}
+
+void data_updater::add_recipe(const std::vector<program_node*>& const_nodes, const std::list<std::pair<primitive_id, memory_impl::ptr>>& results)
+{
+    //each result gets its own recipe with the constant nodes it depends on, so an update replays only affected subgraphs
+    std::set<program_node*> const_set(const_nodes.begin(), const_nodes.end());
+    for (auto& result : results)
+    {
+        auto result_node = std::find_if(const_nodes.begin(), const_nodes.end(), [&](program_node* node) { return node->id() == result.first; });
+        if (result_node == const_nodes.end())
+            continue;
+
+        std::set<program_node*> used;
+        std::vector<program_node*> to_visit = { *result_node };
+        while (!to_visit.empty())
+        {
+            auto node = to_visit.back();
+            to_visit.pop_back();
+            if (!used.insert(node).second)
+                continue;
+            for (auto dep : node->get_dependencies())
+            {
+                if (const_set.count(dep) != 0)
+                    to_visit.push_back(dep);
+            }
+        }
+
+        recipe r;
+        r.replayable = true;
+        for (auto node : const_nodes)
+        {
+            if (used.count(node) == 0)
+                continue;
+
+            r.descs.push_back(node->desc);
+            if (node->get_fused_activation_func() != activation_none)
+                r.replayable = false;
+
+            for (auto dep : node->get_dependencies())
+            {
+                if (!dep->is_type<data>())
+                    continue;
+                auto already_added = std::any_of(r.inputs.begin(), r.inputs.end(),
+                    [&](const std::pair<primitive_id, memory_impl::ptr>& input) { return input.first == dep->id(); });
+                if (!already_added)
+                    r.inputs.push_back({ dep->id(), &dep->as<data>().get_attached_memory() });
+            }
+        }
+        r.outputs.push_back(result);
+
+        _recipes.push_back(std::move(r));
+        _steps.push_back({ step_type::recipe, _recipes.size() - 1 });
+    }
+}
+
+std::set<memory_impl*> data_updater::update(const primitive_id& id, memory_impl& mem)
+{
+    auto source = _sources.find(id);
+    if (source == _sources.end())
+        CLDNN_ERROR_MESSAGE(id, "primitive " + id + " is not an updatable data primitive");
+
+    auto& dst = *source->second;
+    CLDNN_ERROR_LAYOUT_MISMATCH(id, "new data layout", mem.get_layout(), "data layout", dst.get_layout(), "Layout of new data has to match the layout of data primitive.");
+
+    copy_content(mem, dst);
+
+    //steps are replayed in order of recording, so outputs of a step are up to date before they're used by following ones
+    std::set<memory_impl*> changed = { &dst };
+    for (auto& step : _steps)
+    {
+        if (step.first == step_type::slice)
+        {
+            auto& s = _slices[step.second];
+            if (changed.count(s.src.get()) == 0)
+                continue;
+            replay(s);
+            changed.insert(s.dst.get());
+        }
+        else
+        {
+            auto& r = _recipes[step.second];
+            if (std::none_of(r.inputs.begin(), r.inputs.end(),
+                [&](const std::pair<primitive_id, memory_impl::ptr>& input) { return changed.count(input.second.get()) != 0; }))
+                continue;
+            if (!r.replayable)
+                CLDNN_ERROR_MESSAGE(id, "data primitive " + id + " is used by constant primitives with fused activation which cannot be recomputed");
+            replay(r);
+            for (auto& output : r.outputs)
+                changed.insert(output.second.get());
+        }
+    }
+    return changed;
+}
+
+void data_updater::replay(const slice& s)
+{
+    copy_content(*s.src, *s.dst, s.dst_offset);
+}
+
+void data_updater::replay(const recipe& r)
+{
+    topology_impl tpl;
+    for (auto& input : r.inputs)
+    {
+        //TODO: do not use API primitives internally and get rid of this last 'cldnn::memory' internal usage
+        memory api_memory = details::memory_c_to_cpp_converter::convert(api_cast(input.second.get()));
+        //c-cpp converter does not retain since normally it is done inside API-impl layer (cldnn.cpp) so we need to do it manually
+        input.second->add_ref();
+        tpl.add(std::make_shared<data>(input.first, api_memory));
+    }
+    for (auto& desc : r.descs)
+        tpl.add(desc);
+
+    std::vector<primitive_id> output_ids;
+    for (auto& output : r.outputs)
+        output_ids.push_back(output.first);
+
+    //constants propagation of the internal program folds the whole subgraph, its outputs are replaced with data
+    build_options bo;
+    bo.set_option(build_option::optimize_data(false));
+    bo.set_option(build_option::outputs(output_ids));
+    bo.set_option(build_option::host_weights_reorder(_host_weights_reorder));
+    auto prog = _engine.build_program(tpl, bo, true);
+
+    for (auto& output : r.outputs)
+    {
+        auto& result = prog->get_node("_cldnn_const_prop_" + output.first).as<data>().get_attached_memory();
+        CLDNN_ERROR_LAYOUT_MISMATCH(output.first, "recomputed layout", result.get_layout(), "layout", output.second->get_layout(), "Recomputed constant has different layout.");
+        copy_content(result, *output.second);
+    }
+}
@@ -40,6 +40,12 @@ gpu_toolkit_config convert_configuration(const engine_configuration conf)
     result.ocl_sources_dumps_dir = conf.sources_dumps_dir;
     result.priority_mode = static_cast<cldnn_priority_mode_type>(conf.priority_mode);
     result.throttle_mode = static_cast<cldnn_throttle_mode_type>(conf.throttle_mode);
+    if (conf.device_type != device_types::gpu)
+    {
+        // non-GPU devices (i.e. CPU runtime used to measure host-side overhead) are accepted from any vendor
+        result.device_type = conf.device_type == device_types::cpu ? gpu_toolkit_config::cpu : gpu_toolkit_config::accelerator;
+        result.device_vendor = 0;
+    }
     return result;
 }
 
@@ -57,10 +63,10 @@ memory_impl::ptr engine_impl::allocate_memory(layout layout)
     return _memory_pool.get_memory(layout);
 }
 
-memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t network_id, std::set<primitive_id> dependencies, bool reusable)
+memory_impl::ptr engine_impl::allocate_memory(layout layout, primitive_id id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>& dependencies, bool reusable)
 {
     if (use_memory_pool())
-        return _memory_pool.get_memory(layout, id, network_id, dependencies, reusable);
+        return _memory_pool.get_memory(layout, id, node_idx, network_id, dependencies, reusable);
     return _memory_pool.get_memory(layout);
 }
 
@@ -142,6 +148,11 @@ gpu::engine_info_internal engine_impl::get_engine_info() const
     return _context->get_engine_info();
 }
 
+std::vector<gpu::program_build_info> engine_impl::get_kernels_build_stats() const
+{
+    return _context->get_kernels_cache().get_build_stats();
+}
+
 void engine_impl::compile_program(program_impl& program)
 {
     if (!program.get_options().get<build_option_type::serialize_network>()->serialization_network_name.empty()) 
@@ -29,6 +29,13 @@ struct border_gpu : typed_primitive_gpu_impl<border>
     using parent = typed_primitive_gpu_impl<border>;
     using parent::parent;
 
+protected:
+    bool optimized_out(border_inst& instance) const override
+    {
+        return parent::optimized_out(instance) || _outer.can_be_optimized();
+    }
+
+public:
 
     static primitive_impl* create(const border_node& arg)
     { 
@@ -140,7 +140,7 @@ public:
             conv_optional_params.tuningParams.runner = std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), true);
         }
 
-        kernel_selector::KernelsData best_kernels = kernel_selector.GetBestKernels(conv_params, conv_optional_params);
+        kernel_selector::KernelsData best_kernels = get_best_kernels_with_fused_ops(kernel_selector, conv_params, conv_optional_params, arg.get_program());
 		
         CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
 
@@ -19,6 +19,7 @@
 #include "implementation_map.h"
 #include "error_handler.h"
 #include "kernel_selector_helper.h"
+#include "kernel_runner.h"
 #include "deconvolution/deconvolution_kernel_selector.h"
 #include "deconvolution/deconvolution_kernel_base.h"
 
@@ -134,6 +135,14 @@ public:
         }
 
         auto& kernel_selector = kernel_selector::deconvolution_kernel_selector::Instance();
+
+        const auto& tuning_config = arg.get_program().get_options().get<build_option_type::tuning_config>();
+
+        if (tuning_config->config.mode == tuning_mode::tuning_tune_and_cache)
+        {
+            deconv_optional_params.tuningParams.runner = std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), true);
+        }
+
         auto best_kernels = kernel_selector.GetBestKernels(deconv_params, deconv_optional_params);
 
         CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
@@ -24,26 +24,6 @@
 
 namespace cldnn { namespace gpu {
 
-namespace
-{
-    inline kernel_selector::eltwise_mode convert_to_eltwise_mode(eltwise_mode mode)
-    {
-        switch (mode)
-        {
-        case eltwise_mode::sum:  return kernel_selector::eltwise_mode::ADD;
-        case eltwise_mode::sub:  return kernel_selector::eltwise_mode::SUB;
-        case eltwise_mode::max:  return kernel_selector::eltwise_mode::MAX;
-        case eltwise_mode::prod: return kernel_selector::eltwise_mode::MUL;
-        case eltwise_mode::div: return kernel_selector::eltwise_mode::DIV;
-        case eltwise_mode::min: return kernel_selector::eltwise_mode::MIN;
-        case eltwise_mode::pow: return kernel_selector::eltwise_mode::POW;
-        case eltwise_mode::mod: return kernel_selector::eltwise_mode::MODULU;
-        default:
-            return kernel_selector::eltwise_mode::ADD;
-        }
-    }
-}
-
 struct eltwise_gpu : typed_primitive_gpu_impl<eltwise>
 {
     using parent = typed_primitive_gpu_impl<eltwise>;
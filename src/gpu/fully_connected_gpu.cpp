@@ -57,6 +57,7 @@ protected:
         args.bias       = instance.bias_term() ? &instance.bias_memory() : nullptr;
         args.weights_quantization_factors = instance.weights_quantization_factors_term() ? &instance.weights_quantization_factors_memory() : nullptr;
         args.output_calibration_factors = instance.output_calibration_factors_term() ? &instance.output_calibration_factors_memory() : nullptr;
+        args.fused_op_inputs = get_fused_op_inputs(instance);
 
         return args;
     }
@@ -116,7 +117,7 @@ public:
         fc_optional_params.tuningParams.runner = std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), true);
 
         auto& kernel_selector = kernel_selector::fully_connected_kernel_selector::Instance();
-        auto best_kernels = kernel_selector.GetBestKernels(fc_params, fc_optional_params);
+        auto best_kernels = get_best_kernels_with_fused_ops(kernel_selector, fc_params, fc_optional_params, arg.get_program());
 
         CLDNN_ERROR_BOOL(arg.id(), "Best_kernel.empty()", best_kernels.empty(), "Cannot find a proper kernel with this arguments");
 
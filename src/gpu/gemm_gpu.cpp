@@ -20,6 +20,7 @@
 #include "kernel_selector_helper.h"
 #include "gemm/gemm_kernel_selector.h"
 #include "gemm/gemm_kernel_base.h"
+#include "kernel_runner.h"
 #include "error_handler.h"
 
 namespace cldnn { namespace gpu {
@@ -46,6 +47,9 @@ public:
         gemm_params.transpose_input1 = desc->transpose_input1;
         gemm_params.transpose_input2 = desc->transpose_input2;
 
+        // gemm has no weights or biases, so the runner must not treat the params as weight_bias_params
+        gemm_optional_params.tuningParams.runner = std::make_shared<gpu::kernel_runner>(arg.get_program().get_engine(), false);
+
 
         auto& kernel_selector = kernel_selector::gemm_kernel_selector::Instance();
         auto best_kernels = kernel_selector.GetBestKernels(gemm_params, gemm_optional_params);
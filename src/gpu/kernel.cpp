@@ -132,6 +132,12 @@ namespace {
                     status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.slope).get_buffer());
                 }
                 break;
+            case kernel_selector::kernel_argument_types::FUSED_OP_INPUT:
+                if (args[i].index < data.fused_op_inputs.size() && data.fused_op_inputs[args[i].index])
+                {
+                    status = kernel.setArg(i, dynamic_cast<const gpu::gpu_buffer&>(*data.fused_op_inputs[args[i].index]).get_buffer());
+                }
+                break;
             case kernel_selector::kernel_argument_types::SPLIT:
                 status = kernel.setArg(i, data.split);
                 break;
@@ -69,6 +69,7 @@ public:
         memory_impl::cptr slope;
         memory_impl::cptr prev_weights_grad;
         memory_impl::cptr prev_bias_grad;
+        std::vector<memory_impl::cptr> fused_op_inputs;
         int32_t           split          = 0;
         float             lr;
         const kernel_selector::kernel_scalar_arguments* scalars = nullptr;
@@ -55,6 +55,23 @@ void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kern
 
     args.output = output_buffers[0];
 
+    // Prepare buffers of fused operations inputs
+    if (fused_op_input_buffers.empty())
+    {
+        for (const auto& op : base_params.fusedOps)
+        {
+            for (const auto& tensor_desc : op.tensors)
+            {
+                int num_of_elements = (int)tensor_desc.PhysicalSize();
+                fused_op_input_buffers.push_back(engine->allocate_memory({ from_data_type(tensor_desc.GetDType()), format::bfyx, tensor(1, 1, num_of_elements, 1) }));
+            }
+        }
+    }
+    for (const auto& input : fused_op_input_buffers)
+    {
+        args.fused_op_inputs.push_back(input);
+    }
+
     if (weights_and_bias_exist)
     {
         // Prepare weight buffer
@@ -109,7 +126,7 @@ void kernel_runner::prepare_kernel_args(const kernel_selector::KernelsData& kern
     args.split = 0;
 }
 
-std::vector<uint64_t> kernel_runner::run_kernels(const kernel_selector::KernelsData& kernels_data)
+std::vector<uint64_t> kernel_runner::run_kernels(const kernel_selector::KernelsData& kernels_data, uint32_t runs_per_kernel)
 {
     auto context = engine->get_context();
 
@@ -142,7 +159,7 @@ std::vector<uint64_t> kernel_runner::run_kernels(const kernel_selector::KernelsD
             uint64_t kernel_run_time = 0;
             int num_of_runs = 0;
 
-            for (int iteration = 0; iteration < runs_per_kernel; iteration++)
+            for (uint32_t iteration = 0; iteration < runs_per_kernel; iteration++)
             {
                 event_impl::ptr event;
                 try
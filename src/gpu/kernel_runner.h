@@ -30,12 +30,11 @@ public:
 
     kernel_runner(engine_impl& engine_ref, bool weights_and_bias_exist = false);
 
-    std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData) override;
+    std::vector<uint64_t> run_kernels(const kernel_selector::KernelsData& kernelsData, uint32_t runs_per_kernel) override;
 
 private:
 
     const int compilation_batch_size = 50;
-    const int runs_per_kernel = 3;
 
     void prepare_kernel_args(const kernel_selector::KernelsData& kernels_data, gpu::kernel::kernel_arguments_data& args);
 
@@ -45,6 +44,7 @@ private:
     std::vector<memory_impl::ptr> output_buffers;
     std::vector<memory_impl::cptr> weight_buffers;
     std::vector<memory_impl::cptr> bias_buffers;
+    std::vector<memory_impl::cptr> fused_op_input_buffers;
 };
 
 //////////////////////////////////////////////////////////////////////////////////////////////////////////
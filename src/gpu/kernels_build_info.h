@@ -0,0 +1,47 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cldnn { namespace gpu {
+
+// Compilation telemetry of single kernel (entry point) within program part.
+struct kernel_build_info
+{
+    std::string entry_point;
+    std::string id;
+    size_t source_size = 0;     // jit + kernel code + generated undefs (in bytes)
+    size_t jit_defines = 0;
+};
+
+// Compilation telemetry of single cl::Program (one part of program bucket).
+struct program_build_info
+{
+    std::string bucket;         // key of the bucket (sorted build options + program labels)
+    uint32_t part = 0;
+    size_t source_size = 0;
+    size_t jit_defines = 0;
+    uint64_t build_time_us = 0;
+    size_t build_log_size = 0;
+    bool succeeded = false;
+    std::vector<kernel_build_info> kernels;
+};
+
+}}
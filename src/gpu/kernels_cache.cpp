@@ -22,6 +22,7 @@
 #include <sstream>
 #include <fstream>
 #include <set>
+#include <chrono>
 
 #include "kernel_selector_helper.h"
 
@@ -30,6 +31,19 @@
 namespace cldnn { namespace gpu {
 
 namespace {
+    // quotes the field and doubles embedded quotes (RFC 4180)
+    std::string csv_escape(const std::string& str)
+    {
+        std::string res = "\"";
+        for (char c : str)
+        {
+            if (c == '"')
+                res += '"';
+            res += c;
+        }
+        return res + "\"";
+    }
+
     std::string get_undef_jit(kernels_cache::source_code org_source_code)
     {
         const std::string white_space_with_new_lines = " \t\r\n";
@@ -104,6 +118,15 @@ namespace {
         return options;
     }
 
+    size_t count_jit_defines(const std::string& jit)
+    {
+        const std::string define = "#define";
+        size_t count = 0;
+        for (size_t pos = jit.find(define); pos != std::string::npos; pos = jit.find(define, pos + define.size()))
+            count++;
+        return count;
+    }
+
     inline bool does_options_support_batch_compilation(const std::string& options)
     {
         return
@@ -151,6 +174,7 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
         }
 
         auto& current_bucket = scode[key];
+        current_bucket.bucket = key;
         current_bucket.dump_custom_program = dump_custom_program;
         current_bucket.one_time = one_time_kernel;
 
@@ -162,6 +186,7 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
         if ((current_bucket.kernels_counter % MAX_KERNELS_PER_PROGRAM) == 0)
         {
             current_bucket.source.push_back({});
+            current_bucket.kernels_info.push_back({});
         }
 
         current_bucket.entry_point_to_id[entry_point] = code.second.id;
@@ -173,10 +198,16 @@ kernels_cache::sorted_code kernels_cache::get_program_source(const kernels_code&
             new_source_code.push_back(get_undef_jit(org_source_code));
         }
 
+        kernel_build_info kernel_info;
+        kernel_info.entry_point = entry_point;
+        kernel_info.id = code.second.id;
+        kernel_info.jit_defines = count_jit_defines(code.second.kernel_strings->jit);
         for (auto& s : new_source_code)
         {
+            kernel_info.source_size += s.size();
             current_bucket.source.back().push_back(std::move(s));
         }
+        current_bucket.kernels_info.back().push_back(std::move(kernel_info));
 
         current_bucket.kernels_counter++;
     }
@@ -214,7 +245,7 @@ kernels_cache::kernel_id kernels_cache::set_kernel_source(const std::shared_ptr<
     return id;
 }
 
-kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source) const
+kernels_cache::kernels_map kernels_cache::build_program(const program_code& program_source, std::vector<program_build_info>& build_stats) const
 {
     static uint32_t current_file_index = 0;
 
@@ -238,6 +269,16 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
         uint32_t part_idx = 0;
         for (const auto& sources : program_source.source)
         {
+            program_build_info build_info;
+            build_info.bucket = program_source.bucket;
+            build_info.part = part_idx;
+            build_info.kernels = program_source.kernels_info[part_idx];
+            for (const auto& k : build_info.kernels)
+            {
+                build_info.source_size += k.source_size;
+                build_info.jit_defines += k.jit_defines;
+            }
+
             auto current_dump_file_name = dump_file_name + std::to_string(part_idx++) + ".cl";
             std::ofstream dump_file;
 
@@ -252,17 +293,30 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                 }
             }
 
+            auto build_start = std::chrono::high_resolution_clock::now();
+            auto store_build_time = [&]()
+            {
+                auto build_time = std::chrono::high_resolution_clock::now() - build_start;
+                build_info.build_time_us = std::chrono::duration_cast<std::chrono::microseconds>(build_time).count();
+            };
+
             try
             {
                 cl::Program program(_context.context(), sources);
                 program.build({ _context.device() }, program_source.options.c_str());
+                store_build_time();
+                build_info.succeeded = true;
                 ///Store kernels for serialization process.
                 _context.store_binaries(program.getInfo<CL_PROGRAM_BINARIES>());
 
+                auto build_log = program.getBuildInfo<CL_PROGRAM_BUILD_LOG>();
+                for (auto& p : build_log)
+                    build_info.build_log_size += p.second.size();
+
                 if (dump_sources && dump_file.good())
                 {
                     dump_file << "\n/* Build Log:\n";
-                    for (auto& p : program.getBuildInfo<CL_PROGRAM_BUILD_LOG>())
+                    for (auto& p : build_log)
                         dump_file << p.second << "\n";
 
                     dump_file << "*/\n";
@@ -279,6 +333,8 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
             }
             catch (const cl::BuildError& err)
             {
+                store_build_time();
+
                 if (dump_sources && dump_file.good())
                     dump_file << "\n/* Build Log:\n";
 
@@ -288,12 +344,24 @@ kernels_cache::kernels_map kernels_cache::build_program(const program_code& prog
                         dump_file << p.second << "\n";
                 
                     err_log += p.second + '\n';
+                    build_info.build_log_size += p.second.size();
                 }
 
                 if (dump_sources && dump_file.good())
                     dump_file << "*/\n";
             }
-            
+
+            if (dump_sources && dump_file.good())
+            {
+                dump_file << "\n/* Build Stats:\n";
+                dump_file << "    source size: " << build_info.source_size << " B, jit defines: " << build_info.jit_defines
+                          << ", build time: " << build_info.build_time_us << " us, build log size: " << build_info.build_log_size << " B\n";
+                for (const auto& k : build_info.kernels)
+                    dump_file << "    " << k.entry_point << ": source size: " << k.source_size << " B, jit defines: " << k.jit_defines << "\n";
+                dump_file << "*/\n";
+            }
+
+            build_stats.push_back(std::move(build_info));
         }
 
         if (!err_log.empty())
@@ -329,29 +397,86 @@ void kernels_cache::build_all()
 
     auto sorted_program_code = get_program_source(_kernels_code);
 
-    _one_time_kernels.clear();
-    for (auto& program : sorted_program_code)
+    std::vector<program_build_info> build_stats;
+    // stats of all parts built so far are recorded also when one of them fails to compile
+    auto store_build_stats = [&]()
     {
-        auto kernels = build_program(program.second);
+        dump_build_stats(build_stats);
+        _build_stats.insert(_build_stats.end(), build_stats.begin(), build_stats.end());
+        if (_build_stats.size() > max_build_stats)
+            _build_stats.erase(_build_stats.begin(), _build_stats.end() - max_build_stats);
+    };
 
-        for (auto& k : kernels)
+    _one_time_kernels.clear();
+    try
+    {
+        for (auto& program : sorted_program_code)
         {
-            const auto& entry_point = k.first;
-            const auto& k_id = program.second.entry_point_to_id[entry_point];
-            if (program.second.one_time)
-            {
-                _one_time_kernels[k_id] = k.second;
-            }
-            else
+            auto kernels = build_program(program.second, build_stats);
+
+            for (auto& k : kernels)
             {
-                _kernels[k_id] = k.second;
+                const auto& entry_point = k.first;
+                const auto& k_id = program.second.entry_point_to_id[entry_point];
+                if (program.second.one_time)
+                {
+                    _one_time_kernels[k_id] = k.second;
+                }
+                else
+                {
+                    _kernels[k_id] = k.second;
+                }
             }
         }
     }
+    catch (...)
+    {
+        store_build_stats();
+        throw;
+    }
+
+    store_build_stats();
 
     _kernels_code.clear();
     _pending_compilation = false;
 }
 
+std::vector<program_build_info> kernels_cache::get_build_stats()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return _build_stats;
+}
+
+void kernels_cache::dump_build_stats(const std::vector<program_build_info>& build_stats) const
+{
+    auto dump_dir = _context.get_configuration().ocl_sources_dumps_dir;
+    if (dump_dir.empty() || build_stats.empty())
+        return;
+
+    if (dump_dir.back() != '/')
+        dump_dir += '/';
+
+    const auto file_name = dump_dir + "clDNN_build_stats.csv";
+    const bool write_header = !std::ifstream(file_name).good();
+
+    std::ofstream stats_file(file_name, std::ios::app);
+    if (!stats_file.good())
+        return;
+
+    if (write_header)
+        stats_file << "bucket,part,entry_point,kernel_id,kernel_source_size,kernel_jit_defines,part_source_size,part_jit_defines,part_build_time_us,part_build_log_size,succeeded\n";
+
+    for (const auto& program : build_stats)
+    {
+        for (const auto& k : program.kernels)
+        {
+            stats_file << csv_escape(program.bucket) << "," << program.part << "," << csv_escape(k.entry_point) << "," << csv_escape(k.id) << ","
+                       << k.source_size << "," << k.jit_defines << ","
+                       << program.source_size << "," << program.jit_defines << ","
+                       << program.build_time_us << "," << program.build_log_size << "," << program.succeeded << "\n";
+        }
+    }
+}
+
 }}
  
\ No newline at end of file
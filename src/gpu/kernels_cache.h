@@ -23,6 +23,8 @@
 #include <atomic>
 #include <string>
 
+#include "kernels_build_info.h"
+
 namespace cl {
 class Kernel;
 }
@@ -49,6 +51,8 @@ public:
     struct program_code
     {
         std::vector<source_code> source;
+        std::vector<std::vector<kernel_build_info>> kernels_info; // kernels compiled in each part of 'source'
+        std::string bucket;
         uint32_t kernels_counter = 0;
         std::string options;
         bool dump_custom_program = false;
@@ -77,11 +81,14 @@ private:
     std::atomic<bool> _pending_compilation{ false };
     std::map<std::string, kernel_type> _kernels;
     std::map<std::string, kernel_type> _one_time_kernels; // These kernels are intended to be executed only once (can be removed later from the cache).
+    std::vector<program_build_info> _build_stats; // most recent max_build_stats entries
+    static const size_t max_build_stats = 4096;
 
     sorted_code get_program_source(const kernels_code& kernels_source_code) const;
     friend class gpu_toolkit;
     explicit kernels_cache(gpu_toolkit& context);
-    kernels_map build_program(const program_code& pcode) const;
+    kernels_map build_program(const program_code& pcode, std::vector<program_build_info>& build_stats) const;
+    void dump_build_stats(const std::vector<program_build_info>& build_stats) const;
 
 public:
     kernel_id set_kernel_source(const std::shared_ptr<kernel_selector::kernel_string>& kernel_string, bool dump_custom_program, bool one_time_kernel);
@@ -89,6 +96,9 @@ public:
     gpu_toolkit& get_context() { return _context; }
     //forces compilation of all pending kernels/programs
     void build_all();
+    //returns compilation telemetry of programs built so far (limited to the most recent max_build_stats parts,
+    //complete history is available in clDNN_build_stats.csv when sources dumping is enabled)
+    std::vector<program_build_info> get_build_stats();
 };
 
 }}
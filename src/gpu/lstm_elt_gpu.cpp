@@ -42,6 +42,8 @@ protected:
         kernel::kernel_arguments_data args = parent::get_arguments(instance, 0);
 
         args.cell       = instance.cell_term() ? &instance.cell_memory() : nullptr;
+        args.hidden     = instance.hidden_term() ? &instance.hidden_memory() : nullptr;
+        args.recurrent  = instance.hidden_term() ? &instance.recurrent_memory() : nullptr;
         args.output     = &instance.output_memory();
 
         return args;
@@ -70,6 +72,15 @@ public:
             }
         }
 
+        if (arg.hidden_term())
+        {
+            const auto& hidden_layout = arg.hidden().get_output_layout();
+            lstm_elt_params.SetHidden(convert_data_tensor(hidden_layout), convert_data_tensor(arg.recurrent().get_output_layout()));
+            if (hidden_layout.size.spatial[1] > 1) {
+                lstm_elt_params.hidden_direction = arg.direction();
+            }
+        }
+
         lstm_elt_params.SetOffsetOrder(arg.offset_order());
         lstm_elt_params.clip = arg.clip();
         lstm_elt_params.input_forget = arg.input_forget();
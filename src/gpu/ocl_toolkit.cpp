@@ -96,8 +96,9 @@ namespace {
             ok = false;
         }
 
+        // vendor id equal to 0 accepts devices from any vendor
         auto vendor_id = dev.getInfo<CL_DEVICE_VENDOR_ID>();
-        if (vendor_id != config.device_vendor)
+        if (config.device_vendor != 0 && vendor_id != config.device_vendor)
         {
             reasons.push_back(dev_name + ": invalid vendor type");
             ok = false;
@@ -92,9 +92,25 @@ protected:
 
         args.output = &instance.output_memory();
 
+        args.fused_op_inputs = get_fused_op_inputs(instance);
+
         return args;
     }
 
+    // inputs of primitives fused into this one (see program_node::get_fused_primitives()), in order of fusing
+    static std::vector<memory_impl::cptr> get_fused_op_inputs(const typed_primitive_inst<PType>& instance)
+    {
+        std::vector<memory_impl::cptr> inputs;
+        for (const auto& fused : instance.node.get_fused_primitives())
+        {
+            for (size_t i = 0; i < fused.deps_count; i++)
+            {
+                inputs.push_back(&instance.dep_memory(fused.dep_start_idx + i));
+            }
+        }
+        return inputs;
+    }
+
     virtual int32_t get_split() const
     {
         return 1;
@@ -40,6 +40,17 @@ struct region_yolo_gpu : typed_primitive_gpu_impl<region_yolo>
         ry_params.num = primitive->num;
         ry_params.do_softmax = primitive->do_softmax;
         ry_params.mask_size = primitive->mask_size;
+        ry_params.anchors = primitive->anchors;
+        ry_params.confidence_threshold = primitive->confidence_threshold;
+        ry_params.max_boxes = primitive->max_boxes;
+
+        if (primitive->max_boxes > 0)
+        {
+            const auto anchors = primitive->do_softmax ? primitive->num : primitive->mask_size;
+            CLDNN_ERROR_NOT_EQUAL(arg.id(), "coords", primitive->coords, "expected", 4, "Box decoding requires 4 coordinates.");
+            CLDNN_ERROR_NOT_EQUAL(arg.id(), "anchors size", primitive->anchors.size(), "2 * number of anchors", 2 * anchors, "");
+            CLDNN_ERROR_NOT_EQUAL(arg.id(), "input feature size", arg.input().get_output_layout().size.feature[0], "anchors * (coords + classes + 1)", anchors * (primitive->coords + primitive->classes + 1), "");
+        }
 
         auto& kernel_selector = kernel_selector::region_yolo_kernel_selector::Instance();
         auto best_kernels = kernel_selector.GetBestKernels(ry_params, ry_optional_params);
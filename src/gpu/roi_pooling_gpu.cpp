@@ -44,6 +44,8 @@ namespace {
                 return kernel_selector::pool_type::AVG;
             case pooling_mode::bilinear:
                 return kernel_selector::pool_type::BILINEAR;
+            case pooling_mode::roi_align:
+                return kernel_selector::pool_type::ROI_ALIGN;
             default:
                 assert(0);
                 return kernel_selector::pool_type::MAX;
@@ -92,6 +94,8 @@ public:
             CLDNN_ERROR_NOT_EQUAL(arg.id(), "input feture map", in_feat, "group_sz * group_sz * out_feat", group_sz * group_sz * out_feat, "");
         }
         CLDNN_ERROR_BOOL(arg.id(), "Batching", !hasSingleBatchOutput(arg.input()), "PS/ RoI Pooling doesn't support batching.");
+        CLDNN_ERROR_BOOL(arg.id(), "Group size with roi_align mode", group_sz != 0 && primitive->mode == pooling_mode::roi_align, "PS RoI Pooling doesn't support roi_align mode.");
+        CLDNN_ERROR_LESS_THAN(arg.id(), "Sampling ratio", primitive->sampling_ratio, "value", 0, "");
 
         auto roi_params = get_default_params<kernel_selector::roi_pooling_params>(arg);
         auto roi_optional_params = get_default_optional_params<kernel_selector::roi_pooling_optional_params>(arg.get_program());
@@ -107,6 +111,7 @@ public:
         roi_params.pooledHeight = primitive->pooled_height;
         roi_params.spatialScale = primitive->spatial_scale;
         roi_params.groupSize    = group_sz;
+        roi_params.samplingRatio = primitive->sampling_ratio;
 
         auto& kernel_selector = kernel_selector::roi_pooling_kernel_selector::Instance();
         auto best_kernels = kernel_selector.GetBestKernels(roi_params, roi_optional_params);
@@ -0,0 +1,223 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "api/CPP/crop.hpp"
+#include "convolution_inst.h"
+#include "concatenation_inst.h"
+#include "data_inst.h"
+
+#include "pass_manager.h"
+#include "program_node.h"
+#include "program_impl.h"
+
+#include <cstring>
+
+using namespace cldnn;
+
+//ToDo remove friendship relation from program_node and program_impl
+
+namespace
+{
+    bool is_fusable(const convolution_node& node)
+    {
+        const auto& prim = node.get_primitive();
+        if (node.is_output() || node.get_users().empty() || node.has_fused_primitives() || node.can_be_optimized() ||
+            node.get_output_layout().data_padding || node.get_transposed() || node.get_split() != 1 ||
+            prim->with_output_size || prim->weights_quantization_factors.size() != 0 || prim->output_calibration_factors.size() != 0)
+            return false;
+
+        //the crop replacing the convolution wouldn't be done in place by prepare_buffer_fusing (concatenation is optimized instead)
+        if (node.get_users().size() == 1 && node.get_users().front()->is_type<concatenation>() && !node.get_users().front()->is_output())
+            return false;
+
+        const auto data_type = node.get_output_layout().data_type;
+        if (data_type != data_types::f32 && data_type != data_types::f16)
+            return false;
+
+        //weights are concatenated along output features - it's contiguous only for bfyx weights and biases
+        const auto& weights = node.weights(0);
+        if (!weights.is_type<data>() || weights.get_output_layout().format != format::bfyx ||
+            weights.get_output_layout().data_padding)
+            return false;
+
+        if (node.bias_term())
+        {
+            const auto& bias = node.bias(0);
+            if (!bias.is_type<data>() || bias.get_output_layout().format != format::bfyx ||
+                bias.get_output_layout().data_padding)
+                return false;
+        }
+        return true;
+    }
+
+    bool are_siblings(const convolution_node& lhs, const convolution_node& rhs)
+    {
+        const auto& lhs_prim = lhs.get_primitive();
+        const auto& rhs_prim = rhs.get_primitive();
+        const auto& lhs_weights = lhs.weights(0).get_output_layout();
+        const auto& rhs_weights = rhs.weights(0).get_output_layout();
+
+        return &lhs.input() == &rhs.input() &&
+            lhs_prim->stride == rhs_prim->stride &&
+            lhs_prim->input_offset == rhs_prim->input_offset &&
+            lhs_prim->dilation == rhs_prim->dilation &&
+            lhs_prim->with_activation == rhs_prim->with_activation &&
+            lhs_prim->activation_negative_slope == rhs_prim->activation_negative_slope &&
+            lhs.get_fused_activation_func() == rhs.get_fused_activation_func() &&
+            lhs.get_fused_activation_params().a == rhs.get_fused_activation_params().a &&
+            lhs.get_fused_activation_params().b == rhs.get_fused_activation_params().b &&
+            lhs.bias_term() == rhs.bias_term() &&
+            lhs.get_output_layout().data_type == rhs.get_output_layout().data_type &&
+            lhs_weights.data_type == rhs_weights.data_type &&
+            lhs_weights.size.feature[0] == rhs_weights.size.feature[0] &&
+            lhs_weights.size.spatial[0] == rhs_weights.size.spatial[0] &&
+            lhs_weights.size.spatial[1] == rhs_weights.size.spatial[1] &&
+            (!lhs.bias_term() || lhs.bias(0).get_output_layout().data_type == rhs.bias(0).get_output_layout().data_type);
+    }
+
+    //concatenates memory of given data nodes (in their order) into new buffer with given layout
+    memory_impl::ptr concatenate_data(program_impl& p, const std::vector<program_node*>& nodes, const layout& concatenated_layout)
+    {
+        auto concatenated = p.get_engine().allocate_memory(concatenated_layout);
+        auto updater = p.get_data_updater();
+        mem_lock<char> dst{ concatenated };
+        size_t offset = 0;
+        for (auto node : nodes)
+        {
+            auto& src_mem = node->as<data>().get_attached_memory();
+            const auto bytes = node->get_output_layout().bytes_count();
+            mem_lock<char> src{ src_mem };
+            std::memcpy(dst.data() + offset, src.data(), bytes);
+            if (updater)
+                updater->add_slice(src_mem, *concatenated, offset);
+            offset += bytes;
+        }
+        return concatenated;
+    }
+}
+
+void fuse_sibling_convolutions::run(program_impl &p)
+{
+    //collect groups of sibling convolutions, in processing order of the first one
+    std::vector<std::vector<convolution_node*>> groups;
+    for (auto node : p.get_processing_order())
+    {
+        if (!node->is_type<convolution>() || !is_fusable(node->as<convolution>()))
+            continue;
+
+        auto& conv_node = node->as<convolution>();
+        bool added = false;
+        for (auto& group : groups)
+        {
+            if (are_siblings(*group.front(), conv_node))
+            {
+                group.push_back(&conv_node);
+                added = true;
+                break;
+            }
+        }
+        if (!added)
+            groups.push_back({ &conv_node });
+    }
+
+    for (auto& group : groups)
+    {
+        if (group.size() > 1)
+            fuse_siblings(p, group);
+    }
+}
+
+void fuse_sibling_convolutions::fuse_siblings(program_impl &p, const std::vector<convolution_node*>& siblings)
+{
+    auto& first = *siblings.front();
+    auto first_prim = first.get_primitive();
+    auto& input = first.input();
+    const bool bias_term = first.bias_term();
+
+    std::vector<program_node*> weights_nodes;
+    std::vector<program_node*> bias_nodes;
+    tensor::value_type output_features = 0;
+    for (auto sibling : siblings)
+    {
+        weights_nodes.push_back(&sibling->weights(0));
+        if (bias_term)
+            bias_nodes.push_back(&sibling->bias(0));
+        output_features += sibling->get_output_layout().size.feature[0];
+    }
+
+    //combined convolution with concatenated weights and biases
+    const primitive_id fused_id = "_cldnn_siblings_fused_" + first.id();
+    auto weights_layout = first.weights(0).get_output_layout();
+    weights_layout.size.batch[0] = output_features;
+    auto weights_mem = concatenate_data(p, weights_nodes, weights_layout);
+
+    //data primitives are created with dummy memory which is replaced below
+    float zero = 0.f;
+    layout dummy_layout(data_types::f32, format::bfyx, tensor(1, 1, 1, 1));
+    auto& fused_weights = p.get_or_create(std::make_shared<data>(fused_id + "_weights", memory::attach(dummy_layout, &zero, 1)));
+    fused_weights.as<data>().attach_memory(*weights_mem, false);
+
+    std::vector<primitive_id> bias_ids;
+    program_node* fused_bias = nullptr;
+    if (bias_term)
+    {
+        auto bias_layout = first.bias(0).get_output_layout();
+        bias_layout.size = tensor(1, 1, output_features, 1);
+        auto bias_mem = concatenate_data(p, bias_nodes, bias_layout);
+        fused_bias = &p.get_or_create(std::make_shared<data>(fused_id + "_bias", memory::attach(dummy_layout, &zero, 1)));
+        fused_bias->as<data>().attach_memory(*bias_mem, false);
+        bias_ids.push_back(fused_bias->id());
+    }
+
+    auto fused_prim = std::make_shared<convolution>(fused_id, input.id(), std::vector<primitive_id>{ fused_weights.id() }, bias_ids,
+        first_prim->stride, first_prim->input_offset, first_prim->dilation, first_prim->with_activation, first_prim->activation_negative_slope);
+    auto& fused = p.get_or_create(fused_prim);
+    fused.set_fused_activation(first.get_fused_activation_func(), first.get_fused_activation_params());
+
+    p.add_connection(input, fused);
+    p.add_connection(fused_weights, fused);
+    if (fused_bias)
+        p.add_connection(*fused_bias, fused);
+
+    //the first sibling is the earliest one in processing order
+    auto first_itr = p.processing_order.get_processing_iterator(first);
+    p.processing_order.insert(first_itr, &fused_weights);
+    if (fused_bias)
+        p.processing_order.insert(first_itr, fused_bias);
+    p.processing_order.insert(first_itr, &fused);
+
+    //each sibling is replaced with a crop of its output features, crops are done in place by prepare_buffer_fusing
+    tensor::value_type feature_offset = 0;
+    for (auto sibling : siblings)
+    {
+        const auto sibling_size = sibling->get_output_layout().size;
+        auto crop_prim = std::make_shared<crop>("_cldnn_crop_" + sibling->id(), fused_id, sibling_size, tensor(0, feature_offset, 0, 0));
+        feature_offset += sibling_size.feature[0];
+
+        auto sibling_deps = sibling->get_dependencies();
+        for (auto dep : sibling_deps)
+            p.remove_connection(*dep, *sibling);
+
+        auto& crop_node = p.get_or_create(crop_prim);
+        p.replace(*sibling, crop_node, false, false);
+        p.add_connection(fused, crop_node);
+
+        for (auto dep : sibling_deps)
+            p.remove_if_dangling(*dep);
+    }
+}
@@ -41,7 +41,8 @@ void pre_optimize_bias::optimize_bias(T& node, layout_optimizer& lo, program_imp
 
     size_t weights_offset = node.get_primitive()->input.size();
     size_t bias_offset = weights_offset + program_helpers::wrap_if_single(node.get_primitive()->weights).size();
-    for (size_t i = bias_offset; i < node.get_dependencies().size(); ++i)
+    // inputs of fused primitives are the last dependencies
+    for (size_t i = bias_offset; i < node.get_dependencies().size() - node.get_fused_inputs_count(); ++i)
     {
         //find weights primitive with given pimitive_id and add it to weights_optimizer
         const program_node& bias = node.get_dependency(i);
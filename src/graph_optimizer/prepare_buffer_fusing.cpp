@@ -20,8 +20,10 @@
 #include "api/CPP/pooling.hpp"
 #include "primitive_inst.h"
 #include "activation_inst.h"
+#include "border_inst.h"
 #include "concatenation_inst.h"
 #include "crop_inst.h"
+#include "deconvolution_inst.h"
 #include "eltwise_inst.h"
 #include "reshape_inst.h"
 #include "scale_inst.h"
@@ -29,11 +31,37 @@
 #include "pass_manager.h"
 #include "program_helpers.h"
 
+#include <algorithm>
+
 
 using namespace cldnn;
 
 //ToDo remove friendship relation from  program_node and program_impl
 
+namespace
+{
+    // padding on batch and spatial axes is supported only for formats without blocking
+    bool is_plain_format(format fmt)
+    {
+        return fmt == format::bfyx || fmt == format::yxfb || fmt == format::byxf;
+    }
+
+    // kernels of these primitives write output through pitches and offset of the (padded) output layout,
+    // so the output can be placed directly in a part of bigger buffer
+    bool can_write_to_padded_output(const program_node& node)
+    {
+        return node.is_type<pooling>() || node.is_type<convolution>() || node.is_type<deconvolution>() ||
+            node.is_type<activation>() || node.is_type<eltwise>() || node.is_type<scale>() ||
+            node.is_type<concatenation>() || node.is_type<crop>() || node.is_type<reorder>();
+    }
+
+    // size of the data without padding, i.e. size of a copy which is not performed
+    size_t data_bytes(const layout& l)
+    {
+        return data_type_traits::size_of(l.data_type) * l.count();
+    }
+}
+
 void prepare_buffer_fusing::run(program_impl &p)
 {
     bool is_debug = p.options.get<build_option_type::debug>()->enabled();
@@ -56,57 +84,65 @@ void prepare_buffer_fusing::run(program_impl &p)
                 return;
 
             auto concat_axis = node.get_primitive()->axis;
-            auto padd = node.get_output_layout().data_padding;
+            const auto& output_layout = node.get_output_layout();
+            auto padd = output_layout.data_padding;
+
+            // padding on batch and spatial axes of blocked formats does not describe a contiguous part of the buffer
+            if (concat_axis != concatenation::along_f && !is_plain_format(output_layout.format))
+                return;
 
             tensor lower_padd = padd.lower_size();
             tensor upper_padd = padd.upper_size();
 
-            auto upper_padd_val = node.get_output_layout().get_buffer_size().raw[concat_axis] - lower_padd.raw[concat_axis];
+            auto upper_padd_val = output_layout.get_buffer_size().raw[concat_axis] - lower_padd.raw[concat_axis];
             tensor lower_padd_offset = lower_padd;
 
-            std::list<std::pair<const std::vector<program_node*>, tensor>> stack = { std::make_pair(node.get_dependencies(), tensor{ 0, 0, 0, 0 }) };
+            // paddings of all inputs (including inputs of cascaded concatenations) are computed first and applied
+            // only if every input accepts them
+            std::vector<std::pair<program_node*, padding>> new_paddings;
+            std::list<std::pair<concatenation_node*, tensor>> stack = { std::make_pair(&node, tensor{ 0, 0, 0, 0 }) };
             while (!stack.empty())
             {
-                auto nodes_list = stack.front();
+                auto concat_node = stack.front().first;
+                auto cascade_adjustment = stack.front().second;
                 stack.pop_front();
 
-                auto cascade_adjustment = nodes_list.second;
                 upper_padd.raw[concat_axis] = upper_padd_val;
                 lower_padd = lower_padd_offset;
 
                 //check if concatenation in place can be applied for inputs set
-                for (auto input : nodes_list.first)
+                for (auto input : concat_node->get_dependencies())
                 {
-                    //if any of this node's inputs is used by more than one primitive and is not optimized concatenation then do not fuse buffers,
-                    //also, if an input is marked as network output, prevent optimizations which would affect a form of its output (unless debug flag is set)
+                    //if an input is marked as network output, prevent optimizations which would affect a form of its output (unless debug flag is set)
                     // todo: in future, if this case is problem, it can be optimized further to enable buffer fusing
                     //       per single input rather than all/none
-                    // + restrict input types to pooling, convolution and activation only due to problems with output padding on b and f
-                    if ((!input->is_type<pooling>() && !input->is_type<convolution>() && !input->is_type<activation>() && !input->is_type<concatenation>() && !input->is_type<crop>() && !input->is_type<scale>()) ||
+                    if (!can_write_to_padded_output(*input) ||
                         (input->is_output() && !is_debug) ||
-                        input->get_users().size() > 2)
+                        input->get_output_layout().format != output_layout.format ||
+                        input->get_output_layout().data_type != output_layout.data_type)
                         return;
 
-                    if (input->get_users().size() > 1)
+                    //input can be shared with other users which read it through the padding, but its buffer can be
+                    //a part of only one concatenation and no other user can reuse it as its own output
+                    if (std::count(concat_node->get_dependencies().begin(), concat_node->get_dependencies().end(), input) > 1)
+                        return;
+                    for (auto user : input->get_users())
+                        if (user != concat_node && (user->is_type<concatenation>() || user->can_be_optimized()))
+                            return;
+
+                    //padding on other axes is set to the padding of concatenation output - input can't require different one
+                    auto input_padd = input->get_output_layout().data_padding;
+                    for (size_t axis = 0; axis < lower_padd.raw.size(); axis++)
                     {
-                        auto user_count = input->get_users().size();
-                        for (auto& user : input->get_users())
-                            if (user->is_type<concatenation>())
-                                user_count--;
-                        if (user_count != 1) // user_cout == 0 means that input will be used only by concatenations, so we cannot apply concat in place for it
+                        if (axis == static_cast<size_t>(concat_axis))
+                            continue;
+                        if ((input_padd.lower_size().raw[axis] != 0 && input_padd.lower_size().raw[axis] != lower_padd.raw[axis]) ||
+                            (input_padd.upper_size().raw[axis] != 0 && input_padd.upper_size().raw[axis] != upper_padd.raw[axis]))
                             return;
                     }
-
-                    //check only for spatial paddings. Accept feature and batch
-                    if (input->get_output_layout().data_padding.lower_size().spatial[0] != 0 ||
-                        input->get_output_layout().data_padding.upper_size().spatial[0] != 0 ||
-                        input->get_output_layout().data_padding.lower_size().spatial[1] != 0 ||
-                        input->get_output_layout().data_padding.upper_size().spatial[1] != 0)
-                        return;
                 }
 
-                //apply concatenation in place optimization
-                for (auto input : nodes_list.first)
+                for (auto input : concat_node->get_dependencies())
                 {
                     auto input_lenght = input->get_output_layout().size.raw[concat_axis];
 
@@ -122,8 +158,7 @@ void prepare_buffer_fusing::run(program_impl &p)
                     auto upper_padd_tmp = upper_padd;
                     upper_padd_tmp.raw[concat_axis] -= cascade_adjustment.raw[concat_axis];
 
-                    // set new padding for input
-                    input->set_output_padding(padding(lower_padd_tmp.sizes(), upper_padd_tmp.sizes()));
+                    new_paddings.emplace_back(input, padding(lower_padd_tmp.sizes(), upper_padd_tmp.sizes()));
 
                     // move lower padd further
                     //
@@ -138,12 +173,16 @@ void prepare_buffer_fusing::run(program_impl &p)
                             return;
 
                         if (!input->get_dependencies().empty())
-                            stack.push_back(std::make_pair(input->get_dependencies(), input->get_output_layout().data_padding.lower_size()));
+                            stack.push_back(std::make_pair(&input->as<concatenation>(), lower_padd_tmp));
                     }
                 }
             }
 
+            for (auto& new_padding : new_paddings)
+                new_padding.first->set_output_padding(new_padding.second);
+
             node.can_be_optimized(true);
+            p.add_eliminated_copy_bytes(data_bytes(output_layout));
         });
 
         // zero copy
@@ -160,51 +199,92 @@ void prepare_buffer_fusing::run(program_impl &p)
             if (node.get_dependencies().size() == 1 &&
                 node.get_users().size() > 0)
             {
-                // optimization is available for cropping across depth(features) only
-                // if output padding has defined padding across features already it wouldn't
+                // if output padding has defined padding already it wouldn't
                 // work because it expect to have zeros in the padded area.
                 const auto& crop_layout = node.get_output_layout();
-                auto format = crop_layout.format;
                 auto crop_prim = node.get_primitive();
                 auto input_layout = node.get_dependency(0).get_output_layout();
                 const auto& crop_size = crop_layout.size;
                 const auto& out_padd = crop_layout.data_padding;
-                if (format == format::bfyx &&
-                    crop_size.batch[0] == input_layout.size.batch[0] &&
-                    crop_size.spatial[0] == input_layout.size.spatial[0] &&
-                    crop_size.spatial[1] == input_layout.size.spatial[1] &&
-                    out_padd.lower_size().feature[0] == 0 &&
-                    out_padd.upper_size().feature[0] == 0 &&
-                    out_padd.lower_size().batch[0] == 0 &&
-                    out_padd.upper_size().batch[0] == 0 &&
-                    out_padd.lower_size().spatial[0] == 0 &&
-                    out_padd.lower_size().spatial[1] == 0 &&
-                    out_padd.upper_size().spatial[0] == 0 &&
-                    out_padd.upper_size().spatial[1] == 0)
-                {
-                    //  Regular crop
-                    //  crop input buffer
-                    //  |___________data____________|
-                    //
-                    //  crop output buffer
-                    //  |-------->| offsets[f]  |<--|
-                    //            |_____data____|
-                    //             <------------>
-                    //           reference size
-                    //
-                    //  In-place crop
-                    //  crop output buffer
-                    //  |_low_pad_|__data_size__|___|<-upper pad
-
-                    node.set_output_padding(padding(
-                    { out_padd.lower_size().batch[0], crop_prim->offsets.feature[0], out_padd.lower_size().spatial[0], out_padd.lower_size().spatial[1] },
-                    { out_padd.upper_size().batch[0], input_layout.size.feature[0] - crop_prim->offsets.feature[0] - crop_size.feature[0],
-                        out_padd.upper_size().spatial[0], out_padd.upper_size().spatial[1] }));
-                    node.can_be_optimized(true);
-                }
+                if (out_padd || crop_layout.format != input_layout.format || crop_layout.data_type != input_layout.data_type)
+                    return;
+
+                if (!is_plain_format(crop_layout.format))
+                    return;
+
+                //  Regular crop
+                //  crop input buffer
+                //  |___________data____________|
+                //
+                //  crop output buffer
+                //  |-------->| offsets     |<--|
+                //            |_____data____|
+                //             <------------>
+                //           reference size
+                //
+                //  In-place crop
+                //  crop output buffer
+                //  |_low_pad_|__data_size__|___|<-upper pad
+                //
+                //  Input padding (i.e. input placed in concatenation buffer) is a part of crop padding.
+                auto lower_padd = input_layout.data_padding.lower_size() + crop_prim->offsets;
+                auto upper_padd = input_layout.get_buffer_size() - lower_padd - crop_size;
+                node.set_output_padding(padding(lower_padd.sizes(), upper_padd.sizes()));
+                node.can_be_optimized(true);
+                p.add_eliminated_copy_bytes(data_bytes(crop_layout));
             }
         });
 
+        // zero copy constant border: producer writes directly into the interior of the border output buffer
+        program_helpers::do_for_types<border>(*node, [&p, is_debug](border_node& node)
+        {
+            //if the node is marked as network output, prevent optimizations which would affect a form of its output, unless debug flag is set
+            if (node.is_output() && !is_debug)
+                return;
+
+            // border area is formed by the padding of the producer's buffer, which is zero filled at allocation and
+            // never written by kernels, so only zero constant border can be represented this way
+            auto border_prim = node.get_primitive();
+            if (border_prim->type != border_type::constant || border_prim->border_value != 0.0f)
+                return;
+
+            auto& input = node.input();
+            const auto& border_layout = node.get_output_layout();
+            const auto& input_layout = input.get_output_layout();
+            if (border_layout.format != format::bfyx ||
+                input_layout.format != border_layout.format ||
+                input_layout.data_type != border_layout.data_type)
+                return;
+
+            // padded pool reuses buffers of layouts with the same x/y size and padding, but with bigger batch or feature count,
+            // so only x/y padding of bfyx buffer is guaranteed not to overlap data of a previous user of the buffer
+            const auto lower_border = border_layout.data_padding.lower_size().add(border_prim->left_top_sizes);
+            const auto upper_border = border_layout.data_padding.upper_size().add(border_prim->right_bottom_sizes);
+            if (lower_border.batch[0] != 0 || lower_border.feature[0] != 0 ||
+                upper_border.batch[0] != 0 || upper_border.feature[0] != 0)
+                return;
+
+            // producer has to own its buffer and write it through the padded layout
+            if (!can_write_to_padded_output(input) || input.can_be_optimized() ||
+                (input.is_output() && !is_debug) ||
+                input_layout.data_padding)
+                return;
+
+            //other users read the producer through the padding, but none of them can place the buffer elsewhere
+            for (auto user : input.get_users())
+                if (user != &node && (user->is_type<concatenation>() || user->can_be_optimized()))
+                    return;
+
+            //  Border output buffer
+            //  |__out_lpad__|__lt__|___input data___|__rb__|__out_upad__|
+            //
+            //  The same buffer seen by the producer
+            //  |__________lower padd_______|___data___|_______upper padd_________|
+            input.set_output_padding(padding(lower_border.sizes(), upper_border.sizes()));
+            node.can_be_optimized(true);
+            p.add_eliminated_copy_bytes(data_bytes(border_layout));
+        });
+
         program_helpers::do_for_types<reshape>(*node, [&p](reshape_node& node)
         {
             node.get_output_layout();
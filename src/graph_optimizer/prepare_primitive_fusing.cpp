@@ -26,9 +26,13 @@
 #include "activation_inst.h"
 #include "batch_norm_inst.h"
 #include "batch_norm_grad_inst.h"
+#include "convolution_inst.h"
 #include "crop_inst.h"
 #include "eltwise_inst.h"
+#include "embed_inst.h"
+#include "fully_connected_inst.h"
 #include "fused_conv_bn_scale_inst.h"
+#include "index_select_inst.h"
 #include "lrn_inst.h"
 #include "mutable_data_inst.h"
 #include "mvn_inst.h"
@@ -197,6 +201,160 @@ void prepare_primitive_fusing::fuse_conv_bn_scale(program_impl &p, program_node*
     });
 }
 
+// convolution or fully connected node which can absorb a post-operation (its output is consumed only by that operation)
+static bool supports_post_ops(program_node& node)
+{
+    if (node.is_output() || node.is_constant() || node.get_users().size() != 1 || node.can_be_optimized())
+        return false;
+
+    const auto data_type = node.get_output_layout().data_type;
+    if (data_type != data_types::f32 && data_type != data_types::f16)
+        return false;
+
+    if (node.is_type<convolution>())
+    {
+        const auto& prim = node.as<convolution>().get_primitive();
+        return prim->split() == 1 && prim->weights_quantization_factors.size() == 0;
+    }
+
+    if (node.is_type<fully_connected>())
+        return node.as<fully_connected>().get_primitive()->weights_quantization_factors.empty();
+
+    return false;
+}
+
+// additional input of fused operation has to have the output data type, a layout fused kernels can index
+// and each of its dimensions equal to the output one or broadcasted (of size 1)
+static bool is_post_op_input_supported(const program_node& input, const layout& output_layout)
+{
+    const auto& input_layout = input.get_output_layout();
+    if (input_layout.data_type != output_layout.data_type)
+        return false;
+
+    if (input_layout.format != format::bfyx && input_layout.format != format::yxfb &&
+        input_layout.format != format::byxf && input_layout.format != format::bf8_xy16)
+        return false;
+
+    const auto input_sizes = input_layout.size.sizes(format::bfyx);
+    const auto output_sizes = output_layout.size.sizes(format::bfyx);
+    for (size_t i = 0; i < input_sizes.size(); i++)
+    {
+        if (input_sizes[i] != 1 && input_sizes[i] != output_sizes[i])
+            return false;
+    }
+    return true;
+}
+
+// collects additional inputs of post-operation user of node, returns false if user cannot be fused into node
+static bool get_post_op_inputs(program_node& node, program_node& user, std::vector<program_node*>& inputs)
+{
+    if (user.is_type<activation>())
+    {
+        // activation with additional parameters input is not supported
+        return user.get_dependencies().size() == 1;
+    }
+    else if (user.is_type<scale>())
+    {
+        auto& scale_user = user.as<scale>();
+        if (&scale_user.input() != &node)
+            return false;
+
+        inputs.push_back(&scale_user.scale_in());
+        if (scale_user.bias_term())
+            inputs.push_back(&scale_user.bias());
+    }
+    else if (user.is_type<eltwise>())
+    {
+        auto& eltwise_user = user.as<eltwise>();
+        const auto& prim = eltwise_user.get_primitive();
+        if (eltwise_user.inputs_count() != 2 || eltwise_user.output_calibration_term() ||
+            prim->output_quantization_factor != 1.0f || !prim->coefficients.empty() || !prim->stride.empty())
+            return false;
+
+        const size_t node_idx = &eltwise_user.input(0) == &node ? 0 : 1;
+        switch (prim->mode)
+        {
+        case eltwise_mode::sum:
+        case eltwise_mode::prod:
+        case eltwise_mode::max:
+        case eltwise_mode::min:
+            break;
+        case eltwise_mode::sub:
+        case eltwise_mode::div:
+            // fused operation computes output <op> input - node has to be the first operand
+            if (node_idx != 0)
+                return false;
+            break;
+        default:
+            return false;
+        }
+
+        inputs.push_back(&eltwise_user.input(1 - node_idx));
+    }
+    else
+    {
+        return false;
+    }
+
+    for (auto input : inputs)
+    {
+        if (input == &node || !is_post_op_input_supported(*input, node.get_output_layout()))
+            return false;
+    }
+    return true;
+}
+
+void prepare_primitive_fusing::fuse_post_ops(program_impl &p, program_node& node)
+{
+    while (supports_post_ops(node))
+    {
+        auto& user = *node.get_users().front();
+
+        std::vector<program_node*> inputs;
+        if (!get_post_op_inputs(node, user, inputs))
+            return;
+
+        const auto& node_layout = node.get_output_layout();
+        const auto& user_layout = user.get_output_layout();
+        if (user_layout.data_type != node_layout.data_type || user_layout.format != node_layout.format ||
+            user_layout.size != node_layout.size)
+            return;
+
+        //additional inputs of fused primitive become the last dependencies of the node
+        const size_t dep_start_idx = node.get_dependencies().size();
+        for (auto input : inputs)
+            p.add_connection(*input, node);
+        for (auto input : inputs)
+            p.remove_connection(*input, user);
+        node.add_fused_primitive({ user.get_primitive(), dep_start_idx, inputs.size() });
+
+        //activation of the fused primitive is applied as the next fused operation
+        cldnn_activation_func activation_func = user.get_fused_activation_func();
+        cldnn_activation_additional_params activation_params = user.get_fused_activation_params();
+        if (user.is_type<eltwise>() && user.as<eltwise>().get_primitive()->with_activation)
+        {
+            const float negative_slope = user.as<eltwise>().get_primitive()->activation_negative_slope;
+            activation_func = negative_slope != 0.0f ? activation_relu_negative_slope : activation_relu;
+            activation_params = { negative_slope, 0.0f };
+        }
+        if (activation_func != activation_none)
+        {
+            auto fused_activation = std::make_shared<activation>(user.id() + "_fused_activation", node.id(), activation_func, activation_params);
+            node.add_fused_primitive({ fused_activation, node.get_dependencies().size(), 0 });
+        }
+
+        //node takes place of the fused primitive in processing order
+        auto new_processing_num = user.processing_num;      //ToDo: avoid direct modifications of processing_num
+        p.processing_order.erase(p.processing_order.get_processing_iterator(node));
+        p.processing_order.insert(p.processing_order.get_processing_iterator(user), &node);
+        node.processing_num = new_processing_num;           //ToDo: avoid direct modifications of processing_num
+
+        node.set_output_padding(user_layout.data_padding);
+
+        p.extract_and_remove(user);
+    }
+}
+
 void prepare_primitive_fusing::run(program_impl &p)
 {
     bool is_debug = p.options.get<build_option_type::debug>()->enabled();
@@ -286,6 +444,49 @@ void prepare_primitive_fusing::run(program_impl &p)
             p.extract_and_remove(node);
         });
     }
+
+    //This loop tries fusing fp16 to fp32 reorders into preceding row gathers (embed, index_select), which convert on store
+    itr = p.processing_order.begin();
+    while (itr != p.processing_order.end())
+    {
+        auto node_itr = itr++;
+        auto& node = (*node_itr);
+
+        program_helpers::do_for_types<reorder>(*node, [&p, is_debug](reorder_node& node)
+        {
+            auto& input = node.input();
+            auto input_layout = input.get_output_layout();
+            auto output_layout = node.get_output_layout();
+
+            //Restrictions:
+            // - only type conversion, no padding, mean subtract or format change
+            // - primitives input cannot be output and has to be used only by this reorder
+            if (node.has_padded_dependency() || node.get_dependencies().size() != 1 || node.has_mean() ||
+                !node.get_primitive()->subtract_per_feature.empty() || output_layout.data_padding ||
+                input_layout.format != output_layout.format || input.get_users().size() != 1 ||
+                (input.is_output() && !is_debug) || input.can_be_optimized())
+                return;
+
+            if ((!input.is_type<embed>() && !input.is_type<index_select>()) ||
+                input_layout.data_type != data_types::f16 || output_layout.data_type != data_types::f32)
+                return;
+
+            input.set_output_layout(output_layout, false);
+            p.extract_and_remove(node);
+        });
+    }
+    //This loop tries fusing chains of activation, scale and eltwise primitives into preceding convolution or fully connected
+    std::list<program_node*> post_ops_nodes;
+    for (auto node : p.processing_order)
+    {
+        if (node->is_type<convolution>() || node->is_type<fully_connected>())
+            post_ops_nodes.push_back(node);
+    }
+    for (auto node : post_ops_nodes)
+    {
+        fuse_post_ops(p, *node);
+    }
+
     //This loop tries fusing eltwise (sum) with deconvolution
     itr = p.processing_order.begin();
     while (itr != p.processing_order.end())
@@ -32,6 +32,8 @@ void propagate_constants::run(program_impl &p)
         prop.visit_node(*node);
 
     auto&& to_replace = prop.calculate();
+    if (auto updater = p.get_data_updater())
+        updater->add_recipe(prop.get_const_nodes(), to_replace);
 
     //remove all nodes which are no longer relevant, i.e. nodes which:
     // 1. are constants, and
@@ -0,0 +1,216 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "activation_inst.h"
+#include "data_inst.h"
+#include "eltwise_inst.h"
+#include "permute_inst.h"
+#include "prior_box_inst.h"
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+
+#include "pass_manager.h"
+#include "program_node.h"
+#include "program_impl.h"
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <tuple>
+
+using namespace cldnn;
+
+//ToDo remove friendship relation from program_node and program_impl
+
+/*
+    Common subexpression elimination.
+
+    Nodes are visited in processing order and bucketed by primitive type, dependencies (node identities, so duplicates
+    which are already merged make their users equal as well) and, for data, hash of the memory content. A node equal
+    to a node visited before is removed and its users are connected to the one visited before.
+
+    Equality checks output layout, fused activation and all parameters of the primitive descriptor. Only primitives
+    which have no side effects and no internal state are merged.
+
+    Content of data is hashed on the host only if there is another data node of the same type and size, and only up to
+    max_hashed_data_bytes, so that build time isn't spent reading each (big) constant.
+*/
+namespace
+{
+    using bucket_key = std::tuple<primitive_type_id, std::vector<program_node*>, size_t>;
+    using data_key = std::pair<data_types, size_t>;
+
+    const size_t max_hashed_data_bytes = 16 * 1024 * 1024;
+
+    bool is_supported(const program_node& node)
+    {
+        return node.is_type<data>() || node.is_type<reorder>() || node.is_type<reshape>() ||
+            node.is_type<prior_box>() || node.is_type<permute>() || node.is_type<activation>() ||
+            node.is_type<eltwise>();
+    }
+
+    data_key get_data_key(const program_node& node)
+    {
+        const auto& layout = node.get_output_layout();
+        return data_key(layout.data_type, layout.bytes_count());
+    }
+
+    // FNV-1a
+    size_t hash_content(memory_impl& mem, size_t size)
+    {
+        mem_lock<unsigned char> lock{ mem };
+        uint64_t hash = 14695981039346656037ull;
+        for (size_t i = 0; i < size; i++)
+        {
+            hash ^= lock.data()[i];
+            hash *= 1099511628211ull;
+        }
+        return static_cast<size_t>(hash);
+    }
+
+    bool equal_content(memory_impl& lhs, memory_impl& rhs, size_t size)
+    {
+        mem_lock<unsigned char> lhs_lock{ lhs };
+        mem_lock<unsigned char> rhs_lock{ rhs };
+        return std::memcmp(lhs_lock.data(), rhs_lock.data(), size) == 0;
+    }
+
+    bool equal_parameters(const program_node& lhs, const program_node& rhs)
+    {
+        if (lhs.is_type<data>())
+        {
+            return equal_content(lhs.as<data>().get_attached_memory(), rhs.as<data>().get_attached_memory(),
+                lhs.get_output_layout().bytes_count());
+        }
+        if (lhs.is_type<reorder>())
+        {
+            auto l = lhs.as<reorder>().get_primitive();
+            auto r = rhs.as<reorder>().get_primitive();
+            return l->output_format == r->output_format && l->output_data_type == r->output_data_type &&
+                l->subtract_per_feature == r->subtract_per_feature && l->mean_mode == r->mean_mode;
+        }
+        if (lhs.is_type<reshape>())
+        {
+            return lhs.as<reshape>().get_primitive()->output_shape == rhs.as<reshape>().get_primitive()->output_shape;
+        }
+        if (lhs.is_type<prior_box>())
+        {
+            auto l = lhs.as<prior_box>().get_primitive();
+            auto r = rhs.as<prior_box>().get_primitive();
+            return l->img_size == r->img_size && l->min_sizes == r->min_sizes && l->max_sizes == r->max_sizes &&
+                l->aspect_ratios == r->aspect_ratios && l->flip == r->flip && l->clip == r->clip &&
+                l->variance == r->variance && l->step_width == r->step_width && l->step_height == r->step_height &&
+                l->offset == r->offset && l->scale_all_sizes == r->scale_all_sizes;
+        }
+        if (lhs.is_type<permute>())
+        {
+            return lhs.as<permute>().get_primitive()->permute_order == rhs.as<permute>().get_primitive()->permute_order;
+        }
+        if (lhs.is_type<activation>())
+        {
+            auto l = lhs.as<activation>().get_primitive();
+            auto r = rhs.as<activation>().get_primitive();
+            return l->activation_func == r->activation_func && l->additional_params.a == r->additional_params.a &&
+                l->additional_params.b == r->additional_params.b;
+        }
+        if (lhs.is_type<eltwise>())
+        {
+            auto l = lhs.as<eltwise>().get_primitive();
+            auto r = rhs.as<eltwise>().get_primitive();
+            return l->mode == r->mode && l->coefficients == r->coefficients && l->with_activation == r->with_activation &&
+                l->activation_negative_slope == r->activation_negative_slope &&
+                l->output_quantization_factor == r->output_quantization_factor && l->stride == r->stride;
+        }
+        return false;
+    }
+
+    bool are_equivalent(const program_node& lhs, const program_node& rhs)
+    {
+        return lhs.get_output_layout() == rhs.get_output_layout() &&
+            lhs.get_fused_activation_func() == rhs.get_fused_activation_func() &&
+            lhs.get_fused_activation_params().a == rhs.get_fused_activation_params().a &&
+            lhs.get_fused_activation_params().b == rhs.get_fused_activation_params().b &&
+            equal_parameters(lhs, rhs);
+    }
+}
+
+void remove_duplicate_primitives::run(program_impl &p)
+{
+    std::map<bucket_key, std::vector<program_node*>> buckets;
+    //content of each data primitive can be replaced independently in a built network
+    const bool merge_data = p.get_data_updater() == nullptr;
+
+    // number of data nodes of each type and size, only these which have a possible duplicate are hashed
+    std::map<data_key, size_t> data_count;
+    if (merge_data)
+    {
+        for (auto node : p.processing_order)
+        {
+            if (node->is_type<data>() && !node->is_output())
+                data_count[get_data_key(*node)]++;
+        }
+    }
+
+    auto itr = p.processing_order.begin(); //note we need to use iterators since currently processed element can be removed
+    while (itr != p.processing_order.end())
+    {
+        auto& node = (*itr++); //post-inc to avoid invalidation due to possible erase
+        if (node->is_output() || !is_supported(*node) || (node->is_type<data>() && !merge_data))
+            continue;
+
+        size_t content_hash = 0;
+        if (node->is_type<data>())
+        {
+            const auto key = get_data_key(*node);
+            if (data_count[key] < 2 || key.second > max_hashed_data_bytes)
+                continue;
+            content_hash = hash_content(node->as<data>().get_attached_memory(), key.second);
+        }
+
+        auto& bucket = buckets[bucket_key(node->type(), node->get_dependencies(), content_hash)];
+        auto equivalent = std::find_if(bucket.begin(), bucket.end(), [&](program_node* other) { return are_equivalent(*other, *node); });
+        if (equivalent == bucket.end())
+        {
+            bucket.push_back(node);
+            continue;
+        }
+
+        merge(p, *node, **equivalent);
+    }
+}
+
+void remove_duplicate_primitives::merge(program_impl &p, program_node& duplicate, program_node& node)
+{
+    for (auto user : duplicate.users)
+    {
+        for (auto& dep : user->dependencies)
+        {
+            if (dep == &duplicate)
+            {
+                dep = &node;
+                if (std::find(node.users.begin(), node.users.end(), user) == node.users.end())
+                    node.users.push_back(user);
+            }
+        }
+    }
+    duplicate.users.clear();
+
+    p.add_removed_duplicate(duplicate.get_output_layout().bytes_count());
+    p.remove_all_connections(duplicate);
+    p.remove_if_dangling(duplicate);
+}
@@ -39,9 +39,8 @@ void reorder_inputs::run(program_impl &p) {
     run(p, _lo);
 }
 
-void reorder_inputs::run(program_impl &p, layout_optimizer& lo)
+void reorder_inputs::set_optimization_attributes(program_impl &p, layout_optimizer& lo)
 {
-    //first pass to set layout optimization_attributes for topology
     for (auto& nm : p.nodes_map)
     {
         auto& prim = *nm.second;
@@ -57,6 +56,12 @@ void reorder_inputs::run(program_impl &p, layout_optimizer& lo)
             prim.type() == cldnn::upsampling::type_id() || prim.type() == cldnn::reorg_yolo::type_id())
             lo.set_optimization_attribute(layout_optimizer::optimization_attributes_type::bfyx_only_layer, 1);
     }
+}
+
+void reorder_inputs::run(program_impl &p, layout_optimizer& lo)
+{
+    //first pass to set layout optimization_attributes for topology
+    set_optimization_attributes(p, lo);
 
     const auto reorder_input = [&p, &lo](typed_program_node<convolution>& conv_node)
     {
@@ -219,7 +224,9 @@ void reorder_inputs::run(program_impl &p, layout_optimizer& lo)
             }
         }
 
-        if (new_input && (new_input->output_format == format::bf8_xy16 || new_input->output_format == format::byxf))
+        //output is reordered back unless global layout assignment decided that users accept convolution's format
+        if (new_input && (new_input->output_format == format::bf8_xy16 || new_input->output_format == format::byxf) &&
+            !lo.keeps_output_format(conv_node.id()))
         {
             auto conv1x1_output = std::make_shared<reorder>("_conv1x1_reorder_back_" + conv_node.id(), conv_node.id(), input_layout.format, input_layout.data_type);
             auto& back_node = p.get_or_create(conv1x1_output);
@@ -0,0 +1,277 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "pass_manager.h"
+#include "program_node.h"
+#include "layout_optimizer.h"
+#include "program_impl.h"
+#include "eltwise_inst.h"
+#include "pooling_inst.h"
+#include "activation_inst.h"
+
+#include <algorithm>
+#include <map>
+
+using namespace cldnn;
+
+/*
+    Layouts of convolutions are chosen for the whole graph instead of per convolution.
+
+    Every convolution is a variable with candidate formats given by layout_optimizer: the one it prefers for the layer
+    alone and the generic ones which every f16/f32 convolution supports. Eltwise, pooling and activation
+    take the format of their first input. Other primitives keep their format.
+
+    Cost of an assignment is the estimated time of convolutions and reorders, both in multiply-accumulate units:
+    - convolution costs its MACs count, formats other than the preferred one are non_preferred_penalty times slower,
+    - reorder costs reorder_cost_per_byte for each byte of the reordered tensor. byxf and bf8_xy16 convolutions
+      reorder the output back to the input format unless all users accept the format (see keeps_format).
+
+    The search starts from per-layer choices and changes one convolution, or a convolution together with
+    the convolution using its output, at a time as long as the cost of the whole graph decreases.
+*/
+namespace
+{
+    const float non_preferred_penalty = 1.5f;
+    const float reorder_cost_per_byte = 16.0f;
+    const size_t max_sweeps = 8;
+
+    enum class node_kind
+    {
+        fixed,          // keeps its format
+        convolution,    // format is chosen
+        pass_through    // takes format of its first input
+    };
+
+    bool is_pass_through(const program_node& node)
+    {
+        return node.is_type<eltwise>() || node.is_type<pooling>() || node.is_type<activation>();
+    }
+
+    bool is_data_input(const program_node& node)
+    {
+        return node.is_type<data>() || node.is_constant();
+    }
+
+    struct layout_graph
+    {
+        std::vector<program_node*> nodes;                       // in processing order
+        std::map<const program_node*, node_kind> kinds;
+        std::map<const program_node*, std::vector<format>> candidates;
+        std::map<const program_node*, format::type> preferred;
+
+        node_kind kind(const program_node* node) const
+        {
+            auto itr = kinds.find(node);
+            return itr == kinds.end() ? node_kind::fixed : itr->second;
+        }
+
+        // users of the convolution output in format fmt accept it without reorder
+        bool keeps_format(const program_node& node, format fmt) const
+        {
+            if (node.is_output())
+                return false;
+
+            for (auto user : node.get_users())
+            {
+                if (kind(user) == node_kind::convolution && &user->get_dependency(0) == &node)
+                    continue;
+
+                if (fmt == format::byxf && kind(user) == node_kind::pass_through && keeps_format(*user, fmt))
+                    continue;
+
+                return false;
+            }
+            return true;
+        }
+
+        float reorder_cost(const program_node& node) const
+        {
+            return reorder_cost_per_byte * static_cast<float>(node.get_output_layout().bytes_count());
+        }
+
+        float convolution_cost(const program_node& node, format fmt) const
+        {
+            const auto& output_layout = node.get_output_layout();
+            const auto& weights_size = node.as<convolution>().weights(0).get_output_layout().size;
+            const float macs = static_cast<float>(output_layout.count()) *
+                weights_size.feature[0] * weights_size.spatial[0] * weights_size.spatial[1];
+            return preferred.at(&node) == fmt ? macs : macs * non_preferred_penalty;
+        }
+
+        // estimated time of convolutions and reorders for given formats of convolutions
+        float cost(const std::map<const program_node*, format::type>& assignment) const
+        {
+            std::map<const program_node*, format::type> output_formats;
+            auto output_format = [&](const program_node& node)
+            {
+                auto itr = output_formats.find(&node);
+                return itr == output_formats.end() ? node.get_output_layout().format.value : itr->second;
+            };
+
+            float total = 0.0f;
+            for (auto node : nodes)
+            {
+                switch (kind(node))
+                {
+                case node_kind::convolution:
+                {
+                    auto& input = node->get_dependency(0);
+                    const auto input_format = output_format(input);
+                    const auto fmt = assignment.at(node);
+                    total += convolution_cost(*node, fmt);
+                    if (input_format == fmt || is_data_input(input))
+                    {
+                        output_formats[node] = fmt;
+                        break;
+                    }
+
+                    total += reorder_cost(input);
+                    if ((fmt == format::byxf || fmt == format::bf8_xy16) && !keeps_format(*node, fmt))
+                    {
+                        total += reorder_cost(*node);
+                        output_formats[node] = input_format;
+                    }
+                    else
+                    {
+                        output_formats[node] = fmt;
+                    }
+                    break;
+                }
+                case node_kind::pass_through:
+                {
+                    const auto fmt = output_format(node->get_dependency(0));
+                    output_formats[node] = fmt;
+                    for (size_t i = 1; i < node->get_dependencies().size(); i++)
+                    {
+                        auto& dep = node->get_dependency(i);
+                        if (!is_data_input(dep) && output_format(dep) != fmt)
+                            total += reorder_cost(dep);
+                    }
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+            return total;
+        }
+    };
+}
+
+select_global_layouts::select_global_layouts(layout_optimizer& lo_ref) : _lo(lo_ref) {}
+
+void select_global_layouts::run(program_impl &p)
+{
+    run(p, _lo);
+}
+
+void select_global_layouts::run(program_impl &p, layout_optimizer& lo)
+{
+    layout_graph graph;
+    std::map<const program_node*, format::type> assignment;
+
+    //per-layer choice depends on optimization attributes of the whole topology
+    reorder_inputs::set_optimization_attributes(p, lo);
+
+    for (auto node : p.get_processing_order())
+    {
+        graph.nodes.push_back(node);
+
+        if (is_pass_through(*node))
+        {
+            graph.kinds[node] = node_kind::pass_through;
+            continue;
+        }
+
+        if (!node->is_type<convolution>())
+            continue;
+
+        const auto candidates = lo.get_convolution_input_formats(node->as<convolution>());
+        if (candidates.empty())
+            continue;
+
+        graph.kinds[node] = node_kind::convolution;
+        graph.candidates[node] = candidates;
+        graph.preferred[node] = candidates.front();
+        assignment[node] = candidates.front();
+    }
+
+    if (assignment.empty())
+        return;
+
+    float best_cost = graph.cost(assignment);
+    auto try_assignment = [&](const std::map<const program_node*, format::type>& candidate)
+    {
+        const float candidate_cost = graph.cost(candidate);
+        if (candidate_cost >= best_cost)
+            return false;
+
+        best_cost = candidate_cost;
+        assignment = candidate;
+        return true;
+    };
+
+    for (size_t sweep = 0; sweep < max_sweeps; sweep++)
+    {
+        bool improved = false;
+        for (auto node : graph.nodes)
+        {
+            if (graph.kind(node) != node_kind::convolution)
+                continue;
+
+            for (auto fmt : graph.candidates.at(node))
+            {
+                if (fmt == assignment.at(node))
+                    continue;
+
+                auto candidate = assignment;
+                candidate[node] = fmt;
+                improved |= try_assignment(candidate);
+            }
+
+            //format of two subsequent convolutions changed together - removes reorder between them
+            for (auto user : node->get_users())
+            {
+                if (graph.kind(user) != node_kind::convolution || &user->get_dependency(0) != node)
+                    continue;
+
+                for (auto fmt : graph.candidates.at(node))
+                {
+                    const auto& user_candidates = graph.candidates.at(user);
+                    if (std::find(user_candidates.begin(), user_candidates.end(), fmt) == user_candidates.end() ||
+                        (fmt == assignment.at(node) && fmt == assignment.at(user)))
+                        continue;
+
+                    auto candidate = assignment;
+                    candidate[node] = fmt;
+                    candidate[user] = fmt;
+                    improved |= try_assignment(candidate);
+                }
+            }
+        }
+        if (!improved)
+            break;
+    }
+
+    for (auto& assigned : assignment)
+    {
+        auto& node = *assigned.first;
+        const bool keep_output_format = graph.keeps_format(node, assigned.second);
+        lo.set_assigned_format(node.id(), assigned.second, keep_output_format);
+    }
+}
@@ -0,0 +1,678 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "host_evaluator.h"
+#include "engine_impl.h"
+#include "api_impl.h"
+#include "error_handler.h"
+
+#include "concatenation_inst.h"
+#include "crop_inst.h"
+#include "eltwise_inst.h"
+#include "generic_layer_inst.h"
+#include "permute_inst.h"
+#include "reorder_inst.h"
+#include "reshape_inst.h"
+#include "scale_inst.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef OPENMP_FOUND
+#include <omp.h>
+#endif
+
+using namespace cldnn;
+
+/*
+    All primitives are computed on dense float tensors in logical b, f, y, x order. Inputs are unpacked from their
+    buffers (any plain format, with padding) and results are packed into the buffer of the output layout (any plain
+    format or os_iyx_osv16). Loops over the innermost dimension are linear, so they are vectorized by compiler,
+    outer loops are parallelized with OpenMP.
+*/
+namespace
+{
+    using values = std::vector<float>;
+
+    struct dims
+    {
+        explicit dims(const tensor& size)
+            : b(size.batch[0]), f(size.feature[0]), y(size.spatial[1]), x(size.spatial[0])
+        {}
+
+        int count() const { return b * f * y * x; }
+        int index(int bi, int fi, int yi, int xi) const { return ((bi * f + fi) * y + yi) * x + xi; }
+
+        int b, f, y, x;
+    };
+
+    bool is_plain_format(format fmt)
+    {
+        return fmt == format::bfyx || fmt == format::yxfb || fmt == format::byxf || fmt == format::fyxb;
+    }
+
+    bool is_input_layout_supported(const layout& l)
+    {
+        return is_plain_format(l.format) &&
+            (l.data_type == data_types::f32 || l.data_type == data_types::f16 ||
+             l.data_type == data_types::i8 || l.data_type == data_types::u8);
+    }
+
+    bool is_output_layout_supported(const layout& l)
+    {
+        if (l.data_type != data_types::f32 && l.data_type != data_types::f16)
+            return false;
+        return is_plain_format(l.format) || (l.format == format::os_iyx_osv16 && !l.data_padding);
+    }
+
+    //offset of element within buffer of given layout
+    class buffer_indexer
+    {
+    public:
+        explicit buffer_indexer(const layout& l)
+            : _blocked(l.format == format::os_iyx_osv16)
+        {
+            if (_blocked)
+            {
+                //o % 16 + 16 * (x + X * (y + Y * (i + I * (o / 16))))
+                _pitches = { 16 * l.size.feature[0] * l.size.spatial[1] * l.size.spatial[0],
+                             16 * l.size.spatial[1] * l.size.spatial[0],
+                             16 * l.size.spatial[0],
+                             16 };
+                _offset = 0;
+            }
+            else
+            {
+                auto pitches = l.get_pitches();
+                _pitches = { pitches.batch[0], pitches.feature[0], pitches.spatial[1], pitches.spatial[0] };
+                _offset = l.get_linear_offset();
+            }
+        }
+
+        size_t operator()(int b, int f, int y, int x) const
+        {
+            if (_blocked)
+                return static_cast<size_t>(b % 16 + (b / 16) * _pitches[0] + f * _pitches[1] + y * _pitches[2] + x * _pitches[3]);
+            return _offset + static_cast<size_t>(b * _pitches[0] + f * _pitches[1] + y * _pitches[2] + x * _pitches[3]);
+        }
+
+        // true if x is the innermost dimension and values of whole line are stored contiguously
+        bool contiguous_x() const { return !_blocked && _pitches[3] == 1; }
+
+    private:
+        bool _blocked;
+        std::vector<tensor::value_type> _pitches;
+        size_t _offset;
+    };
+
+    template <class T>
+    struct converter
+    {
+        static float load(T value) { return static_cast<float>(value); }
+        static T store(float value) { return static_cast<T>(value); }
+    };
+
+    //f16 values are stored as uint16_t (there is no other 16-bit data type)
+    template <>
+    struct converter<uint16_t>
+    {
+        static float load(uint16_t value) { return half_to_float(value); }
+        static uint16_t store(float value) { return float_to_half(value); }
+    };
+
+    template <class T>
+    values unpack_impl(memory_impl& mem, const layout& l)
+    {
+        const dims d(l.size);
+        values result(d.count());
+        mem_lock<T> lock{ mem };
+        const T* src = lock.data();
+
+        if (std::is_same<T, float>::value && l.format == format::bfyx && !l.data_padding)
+        {
+            std::memcpy(result.data(), src, result.size() * sizeof(float));
+            return result;
+        }
+
+        const buffer_indexer index(l);
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < d.b * d.f; bf++)
+        {
+            const int b = bf / d.f;
+            const int f = bf % d.f;
+            for (int y = 0; y < d.y; y++)
+            {
+                float* dst = result.data() + d.index(b, f, y, 0);
+                if (index.contiguous_x())
+                {
+                    const T* line = src + index(b, f, y, 0);
+                    for (int x = 0; x < d.x; x++)
+                        dst[x] = converter<T>::load(line[x]);
+                }
+                else
+                {
+                    for (int x = 0; x < d.x; x++)
+                        dst[x] = converter<T>::load(src[index(b, f, y, x)]);
+                }
+            }
+        }
+        return result;
+    }
+
+    template <class T>
+    void pack_impl(const values& input, memory_impl& mem, const layout& l)
+    {
+        const dims d(l.size);
+        mem_lock<T> lock{ mem };
+        T* dst = lock.data();
+
+        //padding and blocks remainders are filled with zeros
+        std::memset(dst, 0, mem.size());
+
+        const buffer_indexer index(l);
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < d.b * d.f; bf++)
+        {
+            const int b = bf / d.f;
+            const int f = bf % d.f;
+            for (int y = 0; y < d.y; y++)
+            {
+                const float* src = input.data() + d.index(b, f, y, 0);
+                if (index.contiguous_x())
+                {
+                    T* line = dst + index(b, f, y, 0);
+                    for (int x = 0; x < d.x; x++)
+                        line[x] = converter<T>::store(src[x]);
+                }
+                else
+                {
+                    for (int x = 0; x < d.x; x++)
+                        dst[index(b, f, y, x)] = converter<T>::store(src[x]);
+                }
+            }
+        }
+    }
+
+    values unpack(memory_impl& mem, const layout& l)
+    {
+        switch (l.data_type)
+        {
+        case data_types::f32: return unpack_impl<float>(mem, l);
+        case data_types::f16: return unpack_impl<uint16_t>(mem, l);
+        case data_types::i8: return unpack_impl<int8_t>(mem, l);
+        case data_types::u8: return unpack_impl<uint8_t>(mem, l);
+        default:
+            throw std::invalid_argument("Host evaluation: unsupported input data type");
+        }
+    }
+
+    memory_impl::ptr pack(engine_impl& engine, const values& input, const layout& l)
+    {
+        auto mem = engine.allocate_memory(l);
+        switch (l.data_type)
+        {
+        case data_types::f32: pack_impl<float>(input, *mem, l); break;
+        case data_types::f16: pack_impl<uint16_t>(input, *mem, l); break;
+        default:
+            throw std::invalid_argument("Host evaluation: unsupported output data type");
+        }
+        return mem;
+    }
+
+    void apply_per_feature(values& data, const dims& d, const std::vector<float>& per_feature, cldnn_reorder_mean_mode mode)
+    {
+        if (mode == mean_none)
+            return;
+
+        const int plane = d.y * d.x;
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < d.b * d.f; bf++)
+        {
+            const float value = per_feature[bf % d.f];
+            float* plane_data = data.data() + bf * plane;
+            for (int i = 0; i < plane; i++)
+            {
+                switch (mode)
+                {
+                case mean_subtract: plane_data[i] -= value; break;
+                case mean_mul: plane_data[i] *= value; break;
+                case mean_div: plane_data[i] /= value; break;
+                default: break;
+                }
+            }
+        }
+    }
+
+    bool is_eltwise_mode_supported(eltwise_mode mode)
+    {
+        return mode == eltwise_mode::sum || mode == eltwise_mode::sub || mode == eltwise_mode::max ||
+            mode == eltwise_mode::prod || mode == eltwise_mode::div || mode == eltwise_mode::min ||
+            mode == eltwise_mode::pow;
+    }
+
+    float eltwise_op(eltwise_mode mode, float lhs, float rhs)
+    {
+        switch (mode)
+        {
+        case eltwise_mode::sum: return lhs + rhs;
+        case eltwise_mode::sub: return lhs - rhs;
+        case eltwise_mode::max: return std::max(lhs, rhs);
+        case eltwise_mode::prod: return lhs * rhs;
+        case eltwise_mode::div: return lhs / rhs;
+        case eltwise_mode::min: return std::min(lhs, rhs);
+        case eltwise_mode::pow: return std::pow(lhs, rhs);
+        default: return lhs;
+        }
+    }
+
+    //in format order, for each output dimension - input dimension it is read from (permute_order[q] indexes format order)
+    std::vector<int> permuted_logical_dims(format fmt, const std::vector<uint16_t>& permute_order)
+    {
+        //position of b, f, y, x (logical order) within format order
+        const auto& order = format::traits(fmt).order;
+        auto logical = [](char c) { return c == 'b' ? 0 : c == 'f' ? 1 : c == 'y' ? 2 : 3; };
+
+        std::vector<int> source(4);
+        for (size_t q = 0; q < 4; q++)
+            source[logical(order[q])] = logical(order[permute_order[q]]);
+        return source;
+    }
+
+    //weights reorders (the same as reorder_weights kernel) - offset of element in buffer of weights tensor
+    class weights_indexer
+    {
+    public:
+        explicit weights_indexer(const kernel_selector::WeightsTensor& t)
+            : _offset(t.GetFirstElementOffset())
+            , _x_pitch(t.X().pitch)
+            , _y_pitch(t.Y().pitch)
+            , _ifm_pitch(t.IFM().pitch)
+            , _ofm_pitch(t.OFM().pitch)
+        {
+            switch (t.GetLayout())
+            {
+            case kernel_selector::WeightsLayout::os_iyx_osv16:
+            case kernel_selector::WeightsLayout::os_i_osv16:
+            case kernel_selector::WeightsLayout::os_i_osv16__ai8:
+                _slice = 16;
+                break;
+            case kernel_selector::WeightsLayout::os_i_osv8__ai8:
+                _slice = 8;
+                break;
+            default:
+                _slice = 1;
+                break;
+            }
+        }
+
+        size_t operator()(size_t o, size_t i, size_t y, size_t x) const
+        {
+            return _offset + o % _slice + _slice * (x * _x_pitch + y * _y_pitch + i * _ifm_pitch + (o / _slice) * _ofm_pitch);
+        }
+
+    private:
+        size_t _offset, _x_pitch, _y_pitch, _ifm_pitch, _ofm_pitch, _slice;
+    };
+
+    bool is_host_weights_layout(kernel_selector::WeightsLayout l)
+    {
+        using wl = kernel_selector::WeightsLayout;
+        return l == wl::oi || l == wl::io || l == wl::oiyx || l == wl::oyxi || l == wl::iyxo || l == wl::yxio ||
+            l == wl::os_iyx_osv16 || l == wl::os_i_osv16 || l == wl::os_i_osv8__ai8 || l == wl::os_i_osv16__ai8;
+    }
+
+    bool is_host_weights_type(kernel_selector::WeightsType t)
+    {
+        return t == kernel_selector::WeightsType::F32 || t == kernel_selector::WeightsType::F16;
+    }
+
+    bool is_host_weights_reorder(const kernel_selector::weights_reorder_params& params)
+    {
+        const auto& in = params.input;
+        const auto& out = params.output;
+        return !params.toImageType && !in.GetDims().empty() && !out.GetDims().empty() &&
+            is_host_weights_layout(in.GetLayout()) && is_host_weights_layout(out.GetLayout()) &&
+            is_host_weights_type(in.GetDType()) && is_host_weights_type(out.GetDType());
+    }
+
+    template <class In, class Out>
+    void reorder_weights_impl(const kernel_selector::WeightsTensor& in, const kernel_selector::WeightsTensor& out, const In* src, Out* dst)
+    {
+        const weights_indexer in_index(in);
+        const weights_indexer out_index(out);
+        const size_t in_y = in.Y().v;
+        const size_t in_x = in.X().v;
+        const size_t out_ifm = out.IFM().v;
+        const size_t out_y = out.Y().v;
+        const size_t out_x = out.X().v;
+        //2D weights of fully connected are flattened (i, y, x) of 4D weights
+        const bool flatten = in.GetDims().size() == 4 && out.GetDims().size() == 2;
+        const bool unflatten = in.GetDims().size() == 2 && out.GetDims().size() == 4;
+
+        const int ofm = static_cast<int>(out.OFM().v);
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int o = 0; o < ofm; o++)
+        {
+            for (size_t i = 0; i < out_ifm; i++)
+            {
+                for (size_t y = 0; y < out_y; y++)
+                {
+                    for (size_t x = 0; x < out_x; x++)
+                    {
+                        size_t src_idx;
+                        if (flatten)
+                            src_idx = in_index(o, i / (in_y * in_x), (i / in_x) % in_y, i % in_x);
+                        else if (unflatten)
+                            src_idx = in_index(o, (i * out_y + y) * out_x + x, 0, 0);
+                        else
+                            src_idx = in_index(o, i, y, x);
+                        dst[out_index(o, i, y, x)] = converter<Out>::store(converter<In>::load(src[src_idx]));
+                    }
+                }
+            }
+        }
+    }
+
+    template <class In>
+    void reorder_weights_to(const kernel_selector::weights_reorder_params& params, const In* src, memory_impl& output)
+    {
+        mem_lock<uint8_t> dst{ output };
+        //alignment of blocked layouts is filled with zeros
+        std::memset(dst.data(), 0, output.size());
+        if (params.output.GetDType() == kernel_selector::WeightsType::F32)
+            reorder_weights_impl(params.input, params.output, src, reinterpret_cast<float*>(dst.data()));
+        else
+            reorder_weights_impl(params.input, params.output, src, reinterpret_cast<uint16_t*>(dst.data()));
+    }
+
+    void reorder_weights(const kernel_selector::weights_reorder_params& params, memory_impl& input, memory_impl& output)
+    {
+        mem_lock<uint8_t> src{ input };
+        if (params.input.GetDType() == kernel_selector::WeightsType::F32)
+            reorder_weights_to(params, reinterpret_cast<const float*>(src.data()), output);
+        else
+            reorder_weights_to(params, reinterpret_cast<const uint16_t*>(src.data()), output);
+    }
+}
+
+host_evaluator::host_evaluator(engine_impl& engine, bool weights_reorders)
+    : _engine(engine)
+    , _weights_reorders(weights_reorders)
+{
+}
+
+bool host_evaluator::can_evaluate(const program_node& node) const
+{
+    if (node.get_fused_activation_func() != activation_none)
+        return false;
+
+    const auto& output_layout = node.get_output_layout();
+    const auto& deps = node.get_dependencies();
+
+    if (node.is_type<generic_layer>())
+    {
+        const auto& params = node.as<generic_layer>().get_primitive()->generic_params;
+        if (params.engine == kernel_selector::generic_kernel_params::Engine::CPU)
+            return params.cpuKernel != nullptr;
+        return _weights_reorders && params.engine == kernel_selector::generic_kernel_params::Engine::GPU &&
+            is_host_weights_reorder(params);
+    }
+
+    if (!is_output_layout_supported(output_layout))
+        return false;
+    for (auto dep : deps)
+    {
+        if (!is_input_layout_supported(dep->get_output_layout()))
+            return false;
+    }
+
+    if (node.is_type<reorder>())
+    {
+        return !node.as<reorder>().has_mean();
+    }
+    if (node.is_type<reshape>())
+    {
+        const auto& input_layout = deps.at(0)->get_output_layout();
+        return input_layout.format == output_layout.format && input_layout.data_type == output_layout.data_type &&
+            (output_layout.format == format::bfyx || (!input_layout.data_padding && !output_layout.data_padding));
+    }
+    if (node.is_type<eltwise>())
+    {
+        const auto& prim = node.as<eltwise>().get_primitive();
+        if (!is_eltwise_mode_supported(prim->mode) || !prim->stride.empty() ||
+            !prim->output_calibration_factors.empty() || prim->output_quantization_factor != 1.0f)
+            return false;
+        return std::all_of(deps.begin(), deps.end(),
+            [&](const program_node* dep) { return dep->get_output_layout().size == output_layout.size; });
+    }
+    if (node.is_type<scale>())
+    {
+        const auto& scale_size = node.as<scale>().scale_in().get_output_layout().size;
+        for (size_t i = 0; i < output_layout.size.raw.size(); i++)
+        {
+            if (scale_size.raw[i] != 1 && scale_size.raw[i] != output_layout.size.raw[i])
+                return false;
+        }
+        return !node.as<scale>().bias_term() || node.as<scale>().bias().get_output_layout().size == scale_size;
+    }
+    if (node.is_type<permute>())
+    {
+        return is_plain_format(output_layout.format) && deps.at(0)->get_output_layout().format == output_layout.format;
+    }
+    return node.is_type<crop>() || node.is_type<concatenation>();
+}
+
+memory_impl::ptr host_evaluator::evaluate(const program_node& node, const std::vector<memory_impl*>& inputs)
+{
+    const auto& output_layout = node.get_output_layout();
+    const dims out_dims(output_layout.size);
+    const auto& deps = node.get_dependencies();
+
+    auto input_values = [&](size_t idx) { return unpack(*inputs.at(idx), deps.at(idx)->get_output_layout()); };
+
+    if (node.is_type<generic_layer>())
+    {
+        const auto& params = node.as<generic_layer>().get_primitive()->generic_params;
+        auto output = _engine.allocate_memory(output_layout);
+        if (params.engine == kernel_selector::generic_kernel_params::Engine::GPU)
+        {
+            reorder_weights(params, *inputs.at(0), *output);
+            return output;
+        }
+
+        mem_lock<uint8_t> src{ *inputs.at(0) };
+        mem_lock<uint8_t> dst{ output };
+        params.cpuKernel->Execute(src.data(), src.size(), dst.data(), dst.size());
+        return output;
+    }
+
+    if (node.is_type<reshape>() && output_layout.format != format::bfyx)
+    {
+        //layouts without padding - buffer is reinterpreted
+        auto output = _engine.allocate_memory(output_layout);
+        mem_lock<uint8_t> src{ *inputs.at(0) };
+        mem_lock<uint8_t> dst{ output };
+        std::memcpy(dst.data(), src.data(), output_layout.bytes_count());
+        return output;
+    }
+
+    values result;
+    if (node.is_type<reorder>() || node.is_type<reshape>())
+    {
+        result = input_values(0);
+        if (node.is_type<reorder>())
+        {
+            const auto& prim = node.as<reorder>().get_primitive();
+            if (!prim->subtract_per_feature.empty())
+                apply_per_feature(result, out_dims, prim->subtract_per_feature, prim->mean_mode);
+        }
+    }
+    else if (node.is_type<eltwise>())
+    {
+        const auto& prim = node.as<eltwise>().get_primitive();
+        const bool with_coefficients = prim->mode == eltwise_mode::sum && !prim->coefficients.empty();
+        result = input_values(0);
+        if (with_coefficients)
+            std::transform(result.begin(), result.end(), result.begin(), [&](float v) { return v * prim->coefficients[0]; });
+
+        for (size_t i = 1; i < inputs.size(); i++)
+        {
+            const auto operand = input_values(i);
+            const float coefficient = with_coefficients ? prim->coefficients[i] : 1.0f;
+            const int count = out_dims.count();
+#ifdef OPENMP_FOUND
+            #pragma omp parallel for
+#endif
+            for (int idx = 0; idx < count; idx++)
+                result[idx] = eltwise_op(prim->mode, result[idx], coefficient * operand[idx]);
+        }
+
+        if (prim->with_activation)
+        {
+            const float slope = prim->activation_negative_slope;
+            std::transform(result.begin(), result.end(), result.begin(), [&](float v) { return v > 0.0f ? v : v * slope; });
+        }
+    }
+    else if (node.is_type<scale>())
+    {
+        const auto& scale_node = node.as<scale>();
+        result = input_values(0);
+        const auto scales = input_values(1);
+        const auto biases = scale_node.bias_term() ? input_values(2) : values();
+        const dims s(scale_node.scale_in().get_output_layout().size);
+
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < out_dims.b * out_dims.f; bf++)
+        {
+            const int b = bf / out_dims.f;
+            const int f = bf % out_dims.f;
+            for (int y = 0; y < out_dims.y; y++)
+            {
+                for (int x = 0; x < out_dims.x; x++)
+                {
+                    const int s_idx = s.index(s.b == 1 ? 0 : b, s.f == 1 ? 0 : f, s.y == 1 ? 0 : y, s.x == 1 ? 0 : x);
+                    float& value = result[out_dims.index(b, f, y, x)];
+                    value = value * scales[s_idx] + (biases.empty() ? 0.0f : biases[s_idx]);
+                }
+            }
+        }
+    }
+    else if (node.is_type<crop>())
+    {
+        const auto input = input_values(0);
+        const dims in_dims(deps.at(0)->get_output_layout().size);
+        const dims offsets(node.as<crop>().get_primitive()->offsets);
+        result.resize(out_dims.count());
+
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < out_dims.b * out_dims.f; bf++)
+        {
+            const int b = bf / out_dims.f;
+            const int f = bf % out_dims.f;
+            for (int y = 0; y < out_dims.y; y++)
+            {
+                const float* src = input.data() + in_dims.index(b + offsets.b, f + offsets.f, y + offsets.y, offsets.x);
+                std::copy(src, src + out_dims.x, result.data() + out_dims.index(b, f, y, 0));
+            }
+        }
+    }
+    else if (node.is_type<concatenation>())
+    {
+        const auto axis = node.as<concatenation>().get_primitive()->axis;
+        result.resize(out_dims.count());
+
+        //each input is copied as [outer][axis * inner] block into output [outer][output axis * inner]
+        auto split = [axis](const dims& d, int& outer, int& inner, int& axis_size)
+        {
+            const int sizes[] = { d.b, d.f, d.y, d.x };
+            const int axis_idx = axis == concatenation::along_b ? 0 : axis == concatenation::along_f ? 1 : axis == concatenation::along_y ? 2 : 3;
+            outer = 1;
+            inner = 1;
+            for (int i = 0; i < axis_idx; i++)
+                outer *= sizes[i];
+            for (int i = axis_idx + 1; i < 4; i++)
+                inner *= sizes[i];
+            axis_size = sizes[axis_idx];
+        };
+
+        int outer, inner, out_axis_size;
+        split(out_dims, outer, inner, out_axis_size);
+        int axis_offset = 0;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            const auto input = input_values(i);
+            int in_outer, in_inner, in_axis_size;
+            split(dims(deps.at(i)->get_output_layout().size), in_outer, in_inner, in_axis_size);
+
+            const int block = in_axis_size * inner;
+#ifdef OPENMP_FOUND
+            #pragma omp parallel for
+#endif
+            for (int o = 0; o < outer; o++)
+            {
+                std::copy(input.data() + o * block, input.data() + (o + 1) * block,
+                    result.data() + (o * out_axis_size + axis_offset) * inner);
+            }
+            axis_offset += in_axis_size;
+        }
+    }
+    else if (node.is_type<permute>())
+    {
+        const auto input = input_values(0);
+        const dims in_dims(deps.at(0)->get_output_layout().size);
+        const auto source = permuted_logical_dims(output_layout.format, node.as<permute>().get_primitive()->permute_order);
+        const int in_strides[] = { in_dims.f * in_dims.y * in_dims.x, in_dims.y * in_dims.x, in_dims.x, 1 };
+        const int strides[] = { in_strides[source[0]], in_strides[source[1]], in_strides[source[2]], in_strides[source[3]] };
+        result.resize(out_dims.count());
+
+#ifdef OPENMP_FOUND
+        #pragma omp parallel for
+#endif
+        for (int bf = 0; bf < out_dims.b * out_dims.f; bf++)
+        {
+            const int b = bf / out_dims.f;
+            const int f = bf % out_dims.f;
+            for (int y = 0; y < out_dims.y; y++)
+            {
+                float* dst = result.data() + out_dims.index(b, f, y, 0);
+                const float* src = input.data() + b * strides[0] + f * strides[1] + y * strides[2];
+                for (int x = 0; x < out_dims.x; x++)
+                    dst[x] = src[x * strides[3]];
+            }
+        }
+    }
+    else
+    {
+        CLDNN_ERROR_MESSAGE(node.id(), "Host evaluation is not supported for this primitive type");
+    }
+
+    return pack(_engine, result, output_layout);
+}
@@ -47,6 +47,11 @@ public:
     static layout calc_output_layout(border_node const& node);
     static std::string to_string(border_node const& node);
     typed_primitive_inst(network_impl& network, border_node const& node);
+
+private:
+    void on_execute() override;
+
+    void reuse_input();
 };
 
 using border_inst = typed_primitive_inst<border>;
@@ -19,6 +19,9 @@
 
 #include "program_impl.h"
 #include "data_inst.h"
+#include "host_evaluator.h"
+
+#include <map>
 
 namespace cldnn
 {
@@ -32,14 +35,20 @@ public:
 
     std::list<std::pair<primitive_id, memory_impl::ptr>> calculate();
 
+    // constant nodes (other than data) in processing order
+    const std::vector<program_node*>& get_const_nodes() const { return const_nodes; }
+
 private:
     program_impl::ptr prog;
     topology_impl tpl;
-    std::list<typed_program_node<data>*> const_inputs;
+    std::list<std::pair<primitive_id, memory_impl::ptr>> const_inputs;
     std::vector<primitive_id> const_outputs;
-    bool has_non_trivial_constants = false;
+    std::vector<program_node*> const_nodes;
+    std::map<program_node*, memory_impl::ptr> host_results;
 
-    void handle_constant(program_node& node);
+    bool is_host_available(program_node& node) const;
+    memory_impl::ptr get_host_memory(program_node& node) const;
+    bool evaluate_on_host(host_evaluator& evaluator, program_node& node);
     void add_constant(program_node& node);
     void add_deps_to_tpl(const std::vector<program_node*>& node);
     bool is_already_in_tpl(const primitive_id& id);
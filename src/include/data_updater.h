@@ -0,0 +1,85 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "api/CPP/primitive.hpp"
+#include "memory_impl.h"
+
+#include <list>
+#include <map>
+#include <set>
+#include <vector>
+
+namespace cldnn
+{
+
+struct program_node;
+
+// Records build-time computations on constants (in order of execution), so content of user data primitives
+// can be replaced in a built program without rebuilding it (see build_option::updatable_data).
+// Steps operate on memory objects which are attached to data nodes of the program:
+//  - slices - data copied into a bigger buffer at given offset (i.e. concatenated weights of fused convolutions),
+//  - recipes - constant subgraphs folded by constants propagation (including weights reorders), which are replayed
+//    by building an internal program from their primitive descriptors on top of current input data.
+class data_updater
+{
+public:
+    data_updater(engine_impl& engine, bool host_weights_reorder);
+
+    // user data primitive which content can be replaced
+    void add_source(const primitive_id& id, memory_impl& mem);
+    void add_slice(memory_impl& src, memory_impl& dst, size_t dst_offset);
+    // const_nodes - folded constant nodes in processing order, results - memory which replaces some of them
+    void add_recipe(const std::vector<program_node*>& const_nodes, const std::list<std::pair<primitive_id, memory_impl::ptr>>& results);
+
+    // copies content of 'mem' into data primitive 'id' and replays all dependent steps,
+    // returns memory objects which content has changed
+    std::set<memory_impl*> update(const primitive_id& id, memory_impl& mem);
+
+private:
+    struct slice
+    {
+        memory_impl::ptr src;
+        memory_impl::ptr dst;
+        size_t dst_offset;
+    };
+
+    struct recipe
+    {
+        std::vector<std::pair<primitive_id, memory_impl::ptr>> inputs;
+        std::vector<std::shared_ptr<primitive>> descs;
+        std::vector<std::pair<primitive_id, memory_impl::ptr>> outputs;
+        // fused activations are not part of primitive descriptors, so such subgraphs cannot be replayed
+        bool replayable;
+    };
+
+    enum class step_type { slice, recipe };
+
+    engine_impl& _engine;
+    bool _host_weights_reorder;
+    std::map<primitive_id, memory_impl::ptr> _sources;
+    std::vector<slice> _slices;
+    std::vector<recipe> _recipes;
+    // steps in order of recording, index to either _slices or _recipes
+    std::vector<std::pair<step_type, size_t>> _steps;
+
+    void replay(const slice& s);
+    void replay(const recipe& r);
+};
+
+}
@@ -23,6 +23,7 @@
 #include "implementation_map.h"
 #include "memory_pool.h"
 #include "gpu/engine_info.h"
+#include "gpu/kernels_build_info.h"
 
 #include <memory>
 #include <set>
@@ -52,7 +53,7 @@ public:
     engine_types type() const { return engine_types::ocl; }
 
     refcounted_obj_ptr<memory_impl> allocate_memory(layout layout);
-    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, std::set<primitive_id>, bool reusable = true);
+    refcounted_obj_ptr<memory_impl> allocate_memory(layout layout, primitive_id, uint32_t, uint32_t, const std::vector<uint32_t>&, bool reusable = true);
     refcounted_obj_ptr<memory_impl> reinterpret_buffer(const memory_impl& memory, layout new_layout);
     bool is_the_same_buffer(const memory_impl& mem1, const memory_impl& mem2);
 
@@ -97,12 +98,14 @@ public:
     void set_mem_pool(bool flag) { _configuration.enable_memory_pool = flag; }
     std::shared_ptr<gpu_toolkit> get_context() const { return _context; }
     gpu::engine_info_internal get_engine_info() const;
+    std::vector<gpu::program_build_info> get_kernels_build_stats() const;
     memory_pool& get_memory_pool() { return _memory_pool; }
 
     uint64_t get_max_used_device_memory() const { return _memory_pool.get_max_peak_device_memory_used(); }
     uint64_t get_used_device_memory() const { return _memory_pool.get_temp_memory_used(); }
 
     void dump_memory_pool(const program_impl& program, std::string path, std::string dependencies) { _memory_pool.dump_memory_pool(program, path, dependencies); }
+    void dump_memory_pool_report(const program_impl& program, uint32_t network_id, std::string path) { _memory_pool.dump_memory_pool_report(program, network_id, path); }
     bool use_memory_pool() const;
 
 private:
@@ -0,0 +1,48 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+#pragma once
+
+#include "program_node.h"
+#include "memory_impl.h"
+
+#include <vector>
+
+namespace cldnn
+{
+
+// Host reference implementations of primitives which commonly appear in constant subgraphs
+// (reorder, reshape, eltwise, scale, crop, concatenation, permute and weights reorders).
+// Used by constants propagation to avoid building and executing an internal network on the device.
+class host_evaluator
+{
+public:
+    // weights_reorders - evaluate GPU weights reorders (generic_layer) on host as well
+    host_evaluator(engine_impl& engine, bool weights_reorders);
+
+    // true if node can be evaluated on host, given that all its inputs are available
+    bool can_evaluate(const program_node& node) const;
+
+    // inputs are memory objects of node dependencies (in order), each one with layout of its dependency
+    memory_impl::ptr evaluate(const program_node& node, const std::vector<memory_impl*>& inputs);
+
+private:
+    engine_impl& _engine;
+    bool _weights_reorders;
+};
+
+}
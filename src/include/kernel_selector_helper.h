@@ -28,6 +28,7 @@ using namespace cldnn;
 namespace cldnn
 {
     enum class data_types : size_t;
+    enum class eltwise_mode : int32_t;
     enum class tuning_mode;
     struct format;
     struct layout;
@@ -99,6 +100,7 @@ kernel_selector::data_tensor convert_data_tensor(const layout& l, uint32_t split
 kernel_selector::weights_tensor convert_weights_tensor(const layout& l);
 kernel_selector::activation_function get_kernel_selector_activation_param(cldnn_activation_func activation_func);
 kernel_selector::activation_function get_kernel_selector_activation_grad_param(cldnn_activation_grad_func activation_grad_func);
+kernel_selector::eltwise_mode convert_to_eltwise_mode(eltwise_mode mode);
 
 template <typename T = std::uint32_t>
 kernel_selector::dim_tensor<T> convert_dim_vector(const tensor& t)
@@ -144,6 +146,7 @@ inline void convert_new_activation_func(const p_type primitive, kernel_selector:
 }
 
 void set_params(const program_node& node, kernel_selector::params& params);
+void convert_fused_primitives(const program_node& node, kernel_selector::base_params& params);
 
 template <typename params_t, typename arg_t>
 inline params_t get_default_params(const arg_t& arg, uint32_t split = 1)
@@ -161,6 +164,7 @@ inline params_t get_default_params(const arg_t& arg, uint32_t split = 1)
     params.layerID = arg.id();
 
     convert_fused_activation_func_params(arg, params.activation);
+    convert_fused_primitives(arg, params);
 
     return params;
 }
@@ -214,3 +218,23 @@ inline optional_params_t get_default_learning_optional_params(const program_impl
 {
 	return get_default_weights_bias_optional_params<optional_params_t>(program);
 }
+
+void append_fused_ops_kernel(kernel_selector::kernel_data& kd, const kernel_selector::base_params& params, const program_impl& program);
+
+// Selects the best kernel of a layer with fused primitives. When none of the kernels supports the fused operations,
+// the kernel is selected without them and an additional kernel applies them in place to its output.
+template <typename selector_t, typename params_t, typename optional_params_t>
+inline kernel_selector::KernelsData get_best_kernels_with_fused_ops(const selector_t& selector, const params_t& params, const optional_params_t& optional_params, const program_impl& program)
+{
+    auto best_kernels = selector.GetBestKernels(params, optional_params);
+    if (!best_kernels.empty() || params.fusedOps.empty())
+        return best_kernels;
+
+    params_t unfused_params = params;
+    unfused_params.fusedOps.clear();
+    best_kernels = selector.GetBestKernels(unfused_params, optional_params);
+    if (!best_kernels.empty())
+        append_fused_ops_kernel(best_kernels[0], params, program);
+
+    return best_kernels;
+}
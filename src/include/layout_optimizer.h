@@ -104,7 +104,16 @@ private:
     std::map<cache_key, std::shared_ptr<reorder>> _cached_reorders;
     std::map<cache_key, std::shared_ptr<generic_layer>> _cached_generic_layers;
 
-    layout get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout);
+    struct format_assignment
+    {
+        cldnn::format fmt;
+        bool keep_output_format;
+    };
+
+    //formats chosen by global layout assignment, they take precedence over per-layer choice
+    std::map<primitive_id, format_assignment> _assigned_formats;
+
+    layout get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout, bool use_assigned_format = true);
     layout get_expected_layout(layout const& current_layout, data_type type, deconvolution_node const& node, layout const& output_or_weights_layout);
     layout get_expected_layout(layout const& current_layout, data_type type, fully_connected_node const& node, layout const& output_or_weights_layout);
     layout get_expected_layout(layout const& current_layout, data_type type, detection_output_node const& node, layout const& output_or_weights_layout);
@@ -176,5 +185,15 @@ public:
         data_type type);
 
     void set_optimization_attribute(optimization_attributes_type attribute, int32_t val);
+
+    //returns input formats supported by the convolution, the first one is the format the convolution would choose on its own
+    //(regardless of formats assigned to the graph), empty if the format cannot be changed
+    std::vector<cldnn::format> get_convolution_input_formats(convolution_node const& node);
+
+    //assigns input format of the convolution, if keep_output_format is set the output is not reordered back
+    //to the format of convolution's input (users of the convolution accept the assigned format)
+    void set_assigned_format(primitive_id const& id, cldnn::format fmt, bool keep_output_format);
+    bool has_assigned_format(primitive_id const& id) const;
+    bool keeps_output_format(primitive_id const& id) const;
 };
 }
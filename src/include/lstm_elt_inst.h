@@ -31,7 +31,10 @@ public:
 
     program_node& input() const { return get_dependency(0); }
     program_node& cell() const { return get_dependency(1); }
+    program_node& hidden() const { return get_dependency(cell_term() ? 2 : 1); }
+    program_node& recurrent() const { return get_dependency(cell_term() ? 3 : 2); }
     bool cell_term() const { return !get_primitive()->cell.empty(); }
+    bool hidden_term() const { return !get_primitive()->hidden.empty(); }
     int32_t offset_order() const { return get_primitive()->offset_order; }
     float clip() const {
         float clip_val = get_primitive()->clip;
@@ -58,7 +61,10 @@ public:
     typed_primitive_inst(network_impl& network, lstm_elt_node const& node);
 
     memory_impl& cell_memory() const { return dep_memory(1); }
+    memory_impl& hidden_memory() const { return dep_memory(cell_term() ? 2 : 1); }
+    memory_impl& recurrent_memory() const { return dep_memory(cell_term() ? 3 : 2); }
     bool cell_term() const { return !argument.cell.empty(); }
+    bool hidden_term() const { return !argument.hidden.empty(); }
     int32_t offset_order() const { return argument.offset_order; }
     float clip() const {
         float clip_val = argument.clip;
@@ -39,10 +39,12 @@ using memory_set = std::set<memory_user, memory_user_comparer>;
 struct memory_user
 {
     primitive_id _id;
+    uint32_t _node_idx;     // processing number of the user's node, memory dependencies refer to nodes by it
     uint32_t _network_id;
 
-    memory_user(primitive_id id, uint32_t network_id) :
+    memory_user(primitive_id id, uint32_t node_idx, uint32_t network_id) :
         _id(id) ,
+        _node_idx(node_idx) ,
         _network_id(network_id) 
     {}
 
@@ -59,7 +61,7 @@ struct memory_user_comparer
     {
         if (l_mu._network_id != r_mu._network_id)
             return l_mu._network_id < r_mu._network_id;
-        return l_mu._id < r_mu._id;
+        return l_mu._node_idx < r_mu._node_idx;
     }
 };
 
@@ -89,6 +91,48 @@ struct padded_pool_comparer
     }
 };
 
+// Occupancy/fragmentation statistics of memory pool for a single network.
+// Steps are positions in program's processing order.
+struct memory_pool_report
+{
+    struct step_info
+    {
+        primitive_id _id;
+        uint64_t _live_bytes;       // sum of sizes of tensors which are alive at this step, including network inputs and outputs
+        uint64_t _occupied_bytes;   // sum of sizes of pool records which hold at least one alive tensor
+    };
+
+    struct user_info
+    {
+        primitive_id _id;
+        uint64_t _bytes;            // size of user's (possibly reinterpreted) layout
+        uint32_t _first_step;
+        uint32_t _last_step;
+    };
+
+    struct record_info
+    {
+        std::string _pool;          // "non_padded", "padded" or "across_networks"
+        uint64_t _bytes;            // size of allocation
+        std::vector<user_info> _users;
+
+        uint64_t max_used_bytes() const;
+        uint64_t slack_bytes() const { return _bytes - max_used_bytes(); }
+    };
+
+    uint32_t _network_id = 0;
+    std::vector<step_info> _steps;
+    std::vector<record_info> _records;
+
+    uint64_t allocated_bytes() const;
+    uint64_t slack_bytes() const;
+    uint64_t lower_bound_bytes() const; // max over steps of live tensor bytes
+
+    void dump_json(std::ostream& out) const;
+    void dump_steps_csv(std::ostream& out) const;
+    void dump_records_csv(std::ostream& out) const;
+};
+
     // memory_pool class implements memory manager that handles 4 memory pools
     // - non padded buffers - 
     //     1 user requests for buffer with no padding. 
@@ -112,7 +156,7 @@ class memory_pool
     memory_pool();
     
     refcounted_obj_ptr<memory_impl> alloc_memory(const layout& layout);
-    static bool has_conflict(const memory_set&, const std::set<primitive_id>&, uint32_t);
+    static bool has_conflict(const memory_set&, const std::vector<uint32_t>&, uint32_t);
 
     std::multimap<uint64_t, memory_record> _non_padded_pool;
     std::map<layout,std::list<memory_record>, padded_pool_comparer> _padded_pool;
@@ -123,14 +167,16 @@ class memory_pool
 public:
     memory_pool(engine_impl& engine);
     ~memory_pool();
-    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t network_id,  const std::set<primitive_id>& restrictions, bool reusable = true); // get from pool or create memory allocation
+    refcounted_obj_ptr<memory_impl> get_memory(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id,  const std::vector<uint32_t>& restrictions, bool reusable = true); // get from pool or create memory allocation
     refcounted_obj_ptr<memory_impl> get_memory(const layout& layout);
-    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>&);
-    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions);
-    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id);
+    refcounted_obj_ptr<memory_impl> get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>&);
+    refcounted_obj_ptr<memory_impl> get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>& restrictions);
+    refcounted_obj_ptr<memory_impl> get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id);
     void clear_pool();
     void color_graph(const program_impl&);
     void dump_memory_pool(const program_impl&, std::string, std::string);
+    memory_pool_report get_memory_pool_report(const program_impl&, uint32_t network_id) const;
+    void dump_memory_pool_report(const program_impl&, uint32_t network_id, std::string path) const;
 
     uint64_t get_temp_memory_used() const { return _temp_memory_used; };
     uint64_t get_max_peak_device_memory_used() const { return _max_peak_memory_used; };
@@ -45,6 +45,7 @@ public:
 
     void reset_execution(bool wait = true);
     void set_input_data(const primitive_id& id, memory_impl& data);
+    void update_data(const primitive_id& id, memory_impl& data);
 
     void set_learning_rate(const float lr);
     float get_learning_rate();
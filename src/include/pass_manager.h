@@ -28,6 +28,14 @@ namespace cldnn
         virtual void run(program_impl &p) = 0;
     };
 
+    class remove_duplicate_primitives : base_pass
+    {
+    public:
+        virtual void run(program_impl &p) override;
+    private:
+        void merge(program_impl &p, program_node& duplicate, program_node& node);
+    };
+
     class trim_to_outputs : base_pass
     {
     public:
@@ -67,6 +75,15 @@ namespace cldnn
     private:
         void fuse_skip_layers(program_impl &p, program_node* node);
         void fuse_conv_bn_scale(program_impl &p, program_node* node);
+        void fuse_post_ops(program_impl &p, program_node& node);
+    };
+
+    class fuse_sibling_convolutions : base_pass
+    {
+    public:
+        virtual void run(program_impl &p) override;
+    private:
+        void fuse_siblings(program_impl &p, const std::vector<convolution_node*>& siblings);
     };
 
     class prepare_depthwise_sep_opt : base_pass
@@ -123,6 +140,17 @@ namespace cldnn
         reorder_inputs(layout_optimizer& lo_ref);
         virtual void run(program_impl &p) override;
         virtual void run(program_impl &p, layout_optimizer& lo);
+        static void set_optimization_attributes(program_impl &p, layout_optimizer& lo);
+    private:
+        layout_optimizer& _lo;
+    };
+
+    class select_global_layouts : base_pass
+    {
+    public:
+        select_global_layouts(layout_optimizer& lo_ref);
+        virtual void run(program_impl &p) override;
+        virtual void run(program_impl &p, layout_optimizer& lo);
     private:
         layout_optimizer& _lo;
     };
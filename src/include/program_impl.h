@@ -22,8 +22,10 @@
 
 #include "refcounted_obj.h"
 #include "engine_impl.h"
+#include "data_updater.h"
 
 #include <list>
+#include <memory>
 
 namespace cldnn
 {
@@ -44,6 +46,8 @@ struct program_impl : public refcounted_obj<program_impl>
     friend class trim_to_outputs;   // to be removed when possible
     friend class prepare_buffer_fusing; // to be removed when possible
     friend class prepare_primitive_fusing; // to be removed when possible
+    friend class fuse_sibling_convolutions; // to be removed when possible
+    friend class remove_duplicate_primitives; // to be removed when possible
     friend class propagate_constants; // to be removed when possible
     friend class reorder_inputs;  // to be removed when possible
     friend class post_optimize_weights; // to be removed when possible
@@ -108,10 +112,19 @@ public:
     const nodes_ordering& get_processing_order() const;
     nodes_ordering& get_processing_order();
     const std::list<primitive_id>& get_optimized_out() const { return optimized_out; }
+    // bytes of data which is not copied thanks to in-place (buffer fusing) optimizations
+    size_t get_eliminated_copy_bytes() const { return eliminated_copy_bytes; }
+    void add_eliminated_copy_bytes(size_t bytes) { eliminated_copy_bytes += bytes; }
+    // nodes removed as duplicates of other nodes and bytes of their outputs (or constants)
+    size_t get_removed_duplicates() const { return removed_duplicates; }
+    size_t get_removed_duplicate_bytes() const { return removed_duplicate_bytes; }
+    void add_removed_duplicate(size_t bytes) { removed_duplicates++; removed_duplicate_bytes += bytes; }
+    // records build-time computations on data, null unless build_option::updatable_data is enabled
+    data_updater* get_data_updater() const { return updater.get(); }
     bool has_node(const primitive_id& prim) const { return nodes_map.count(prim) > 0; }
     program_node& get_node(primitive_id const& id);
     program_node const& get_node(primitive_id const& id) const;
-    void dump_memory_pool() const;
+    void dump_memory_pool(uint32_t network_id) const;
 
     //returns already existing program_node for given primitive 'prim' (lookup in 'nodes_map')
     //if it was previously created, otherwise creates and then returns program_node
@@ -137,6 +150,10 @@ private:
 
     std::map<primitive_id, std::shared_ptr<program_node>> nodes_map;
     std::list<primitive_id> optimized_out;
+    size_t eliminated_copy_bytes = 0;
+    size_t removed_duplicates = 0;
+    size_t removed_duplicate_bytes = 0;
+    std::unique_ptr<data_updater> updater;
 
     /*
     ** High-level functions, in order of usage
@@ -178,6 +195,7 @@ private:
     void basic_memory_dependencies();
     void skipped_branch_memory_dependencies();
     void oooq_memory_dependencies();
+    void add_memory_dependency(program_node* node, program_node* dep);
     std::string get_memory_dependencies_string() const;
 
     /*
@@ -54,10 +54,13 @@ struct program_node
 {
     friend struct program_impl;
     friend class constants_propagator;
+    friend class data_updater; // to be removed when possible
     friend class add_required_reorders; //to be removed
     friend class trim_to_outputs;      //to be removed
     friend class prepare_buffer_fusing; // to be removed when possible
     friend class prepare_primitive_fusing; // to be removed when possible
+    friend class fuse_sibling_convolutions; // to be removed when possible
+    friend class remove_duplicate_primitives; // to be removed when possible
     friend class propagate_constants; // to be removed
     friend class reorder_inputs;  // to be removed
     friend class post_optimize_weights; // to be removed when possible - requires an access to selected_impl
@@ -105,9 +108,9 @@ public:
     void remove_dependency(size_t idx);
     void remove_dependency(program_node& node);
 
-    std::set<primitive_id> get_memory_dependencies() const;
-    void add_memory_dependency(primitive_id);
-    void add_memory_dependency(std::vector<primitive_id>);
+    //processing numbers of nodes which can't share output buffer with this node (sorted)
+    const std::vector<uint32_t>& get_memory_dependencies() const;
+    void add_memory_dependency(const program_node& node);
 
     template<class PType>
     bool have_user_with_type() const
@@ -196,6 +199,25 @@ public:
         return fused_activation.additional_params;
     }
 
+    // primitive (activation, scale or eltwise) fused into this node - applied to its output after fused activation
+    struct fused_primitive_desc
+    {
+        std::shared_ptr<const primitive> desc;
+        size_t dep_start_idx;   // index of the first additional input of the fused primitive in dependencies
+        size_t deps_count;      // number of additional inputs (output of this node is the implicit first one)
+    };
+
+    void add_fused_primitive(const fused_primitive_desc& fused) { fused_prims.push_back(fused); }
+    const std::vector<fused_primitive_desc>& get_fused_primitives() const { return fused_prims; }
+    bool has_fused_primitives() const { return !fused_prims.empty(); }
+    size_t get_fused_inputs_count() const
+    {
+        size_t count = 0;
+        for (const auto& fused : fused_prims)
+            count += fused.deps_count;
+        return count;
+    }
+
     bool can_be_optimized() const { return optimized; }
     void can_be_optimized(bool opt) { optimized = opt; }
 
@@ -268,8 +290,8 @@ protected:
 #endif
     uint32_t processing_num = 0;
 
-    // list of primitives that can reuse same memory buffers due to execution order conflicts
-    std::set<primitive_id> memory_dependencies;
+    // processing numbers of primitives that can't reuse same memory buffers due to execution order conflicts
+    std::vector<uint32_t> memory_dependencies;
 
     bool constant = false;
     bool constant_frontier = false;
@@ -291,6 +313,7 @@ protected:
     };
 
     fused_activation_params fused_activation;
+    std::vector<fused_primitive_desc> fused_prims;
 
     void invalidate_users() const;
 };
@@ -115,7 +115,7 @@ namespace cldnn
             auto& indices = node.indices();
             auto indices_layout = indices.get_output_layout();
 
-            CLDNN_ERROR_DATA_TYPES_MISMATCH(node_id, "indicies data_type", indices_layout.data_type, "i32 data_type ", data_types::i32, "");
+            CLDNN_ERROR_BOOL(node_id, "indicies data_type is not i32 or i64", indices_layout.data_type != data_types::i32 && indices_layout.data_type != data_types::i64, "");
             CLDNN_ERROR_NOT_EQUAL(node_id, "indicies batch_size", indices_layout.size.batch[0], "expected size", 1, "");
             CLDNN_ERROR_NOT_EQUAL(node_id, "indicies feature_size", indices_layout.size.feature[0], "expected size", 1, "");
             CLDNN_ERROR_NOT_EQUAL(node_id, "indicies y_size", indices_layout.size.spatial[1], "expected size", 1, "");
@@ -19,8 +19,15 @@
 
 #include "program_node.h"
 #include "program_impl.h"
+#include "error_handler.h"
 
 #include "training_params.h"
+#include "fused_ops/fused_ops_kernel_selector.h"
+#include "fused_ops/fused_ops_kernel_ref.h"
+
+#include "api/CPP/activation.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/scale.hpp"
 
 kernel_selector::data_type to_data_type(data_types dt)
 {
@@ -351,6 +358,23 @@ kernel_selector::activation_function get_kernel_selector_activation_grad_param(c
     }
 }
 
+kernel_selector::eltwise_mode convert_to_eltwise_mode(eltwise_mode mode)
+{
+    switch (mode)
+    {
+    case eltwise_mode::sum:  return kernel_selector::eltwise_mode::ADD;
+    case eltwise_mode::sub:  return kernel_selector::eltwise_mode::SUB;
+    case eltwise_mode::max:  return kernel_selector::eltwise_mode::MAX;
+    case eltwise_mode::prod: return kernel_selector::eltwise_mode::MUL;
+    case eltwise_mode::div: return kernel_selector::eltwise_mode::DIV;
+    case eltwise_mode::min: return kernel_selector::eltwise_mode::MIN;
+    case eltwise_mode::pow: return kernel_selector::eltwise_mode::POW;
+    case eltwise_mode::mod: return kernel_selector::eltwise_mode::MODULU;
+    default:
+        return kernel_selector::eltwise_mode::ADD;
+    }
+}
+
 void set_params(const program_node& node, kernel_selector::params& params)
 {
     const auto& context = node.get_program().get_engine().get_context();
@@ -373,6 +397,59 @@ void set_params(const program_node& node, kernel_selector::params& params)
     params.engineInfo.hostVersion = to_host_version(cldnn::get_version());
 }
 
+void convert_fused_primitives(const program_node& node, kernel_selector::base_params& params)
+{
+    for (const auto& fused : node.get_fused_primitives())
+    {
+        kernel_selector::fused_operation_desc op;
+
+        for (size_t i = 0; i < fused.deps_count; i++)
+        {
+            op.tensors.push_back(convert_data_tensor(node.get_dependency(fused.dep_start_idx + i).get_output_layout()));
+        }
+
+        if (fused.desc->type == activation::type_id())
+        {
+            op.type = kernel_selector::FusedOpType::ACTIVATION;
+            convert_new_activation_func(std::static_pointer_cast<const activation>(fused.desc), op.activation);
+        }
+        else if (fused.desc->type == scale::type_id())
+        {
+            op.type = kernel_selector::FusedOpType::SCALE;
+        }
+        else if (fused.desc->type == eltwise::type_id())
+        {
+            op.type = kernel_selector::FusedOpType::ELTWISE;
+            op.mode = convert_to_eltwise_mode(std::static_pointer_cast<const eltwise>(fused.desc)->mode);
+        }
+        else
+        {
+            CLDNN_ERROR_MESSAGE(node.id(), "Unsupported type of fused primitive " + fused.desc->id);
+        }
+
+        params.fusedOps.push_back(op);
+    }
+}
+
+void append_fused_ops_kernel(kernel_selector::kernel_data& kd, const kernel_selector::base_params& params, const program_impl& program)
+{
+    kernel_selector::fused_ops_params fused_ops_params;
+    fused_ops_params.engineInfo = params.engineInfo;
+    fused_ops_params.layerID = params.layerID;
+    fused_ops_params.inputs = { params.output };
+    fused_ops_params.output = params.output;
+    fused_ops_params.fusedOps = params.fusedOps;
+
+    auto fused_ops_optional_params = get_default_optional_params<kernel_selector::fused_ops_optional_params>(program);
+
+    auto& kernel_selector = kernel_selector::fused_ops_kernel_selector::Instance();
+    auto best_kernels = kernel_selector.GetBestKernels(fused_ops_params, fused_ops_optional_params);
+
+    CLDNN_ERROR_BOOL(params.layerID, "Best_kernel.empty()", best_kernels.empty(), "Cannot find a kernel applying fused primitives");
+
+    kd.kernels.push_back(best_kernels[0].kernels[0]);
+}
+
 void set_learning_params(const program_node& node, kernel_selector::training_params& params, bool use_momentum)
 {
     const auto learning_params = node.get_program().get_options().template get<build_option_type::learning_config>()->params;
@@ -398,4 +475,6 @@ void set_optional_params(const program_impl& program, kernel_selector::optional_
     const auto& tuning_config = program.get_options().get<build_option_type::tuning_config>();
     params.tuningParams.mode = to_tuning_mode(tuning_config->config.mode);
     params.tuningParams.cacheFilePath = tuning_config->config.cache_file_path;
+    params.tuningParams.exhaustiveSearch = tuning_config->config.exhaustive_search;
+    params.tuningParams.layerTimeBudgetMs = tuning_config->config.layer_time_budget_ms;
 }
\ No newline at end of file
@@ -168,7 +168,7 @@ bool layout_optimizer::deps_depth_in_same_format(program_node const& node, const
     return same_format;
 }
 
-layout layout_optimizer::get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout)
+layout layout_optimizer::get_expected_layout(layout const& current_layout, data_type type, convolution_node const& node, layout const& output_or_weights_layout, bool use_assigned_format)
 {
     auto prim = node.get_primitive();
     auto expected_tensor = current_layout.size;
@@ -189,7 +189,12 @@ layout layout_optimizer::get_expected_layout(layout const& current_layout, data_
 
     case data_type::input: //convolution input
 
-        if (current_layout.data_type == data_types::f16 &&
+        if (use_assigned_format && has_assigned_format(node.id()))
+        {
+            expected_format = _assigned_formats.at(node.id()).fmt;
+            expected_tensor = expected_format == cldnn::format::bf8_xy16 ? current_layout.size.transform(expected_format, 1) : current_layout.size;
+        }
+        else if (current_layout.data_type == data_types::f16 &&
             layout_optimizer::convolution_byxf_opt(current_layout, output_or_weights_layout, prim) &&
             (users_for_convolution_byxf_opt(node, 2) || deps_depth_in_same_format(node, cldnn::format::byxf, 2)) &&
             //TODO: remove this condition when yxfb optimizations will be disabled
@@ -467,3 +472,43 @@ void layout_optimizer::set_optimization_attribute(optimization_attributes_type a
         throw std::out_of_range("unsupported layout optimization attribute");
     }
 }
+
+std::vector<cldnn::format> layout_optimizer::get_convolution_input_formats(convolution_node const& node)
+{
+    auto prim = node.get_primitive();
+    auto input_layout = node.input().get_output_layout();
+    if (input_layout.data_type != data_types::f16 && input_layout.data_type != data_types::f32)
+        return {};
+
+    auto preferred = get_expected_layout(input_layout, data_type::input, node, node.weights(0).get_output_layout(), false).format;
+    if (preferred == cldnn::format::winograd_2x3_s1_data)
+        return {};
+
+    std::vector<cldnn::format> formats = { preferred };
+    //these convolutions are supported only in bfyx
+    if (node.get_transposed() || (_output_size_handling_enabled && prim->with_output_size))
+        return formats;
+
+    if (preferred != cldnn::format::bfyx)
+        formats.push_back(cldnn::format::bfyx);
+    if (preferred != cldnn::format::yxfb && !_optimization_attributes.bfyx_only_layer)
+        formats.push_back(cldnn::format::yxfb);
+    return formats;
+}
+
+void layout_optimizer::set_assigned_format(primitive_id const& id, cldnn::format fmt, bool keep_output_format)
+{
+    _assigned_formats.erase(id);
+    _assigned_formats.emplace(id, format_assignment{ fmt, keep_output_format });
+}
+
+bool layout_optimizer::has_assigned_format(primitive_id const& id) const
+{
+    return _assigned_formats.count(id) != 0;
+}
+
+bool layout_optimizer::keeps_output_format(primitive_id const& id) const
+{
+    auto assigned = _assigned_formats.find(id);
+    return assigned != _assigned_formats.end() && assigned->second.keep_output_format;
+}
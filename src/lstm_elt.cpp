@@ -35,6 +35,7 @@ layout lstm_elt_inst::calc_output_layout(lstm_elt_node const& node)
 
     // tempGEMM{bfyx} = [b: batch, f: direction, x: 1,         y: 4 * hidden_size ] input
     // cell{bfyx}     = [b: batch, f: direction, x: 1,         y: hidden_size ] optional
+    // hidden{bfyx}   = [b: batch, f: direction, x: 1,         y: hidden_size ] optional, with recurrent
     // output{bfyx}   = [b: batch, f: 2,         x: direction, y: hidden_size ] output
     // The output of the lstm_elt node is the concatenation of the intermediate [hidden, cell] tensors.
     // A crop/split node is needed to extract each individual tensors
@@ -48,11 +49,15 @@ std::string lstm_elt_inst::to_string(lstm_elt_node const& node)
     auto desc      = node.get_primitive();
     auto node_info = node.desc_to_json();
     auto cell_id   = desc->cell;
+    auto hidden_id = desc->hidden != "" ? desc->hidden : "no hidden";
 
     std::stringstream primitive_description;
 
     json_composite lstm_elt_info;
     lstm_elt_info.add("cell id", cell_id);
+    lstm_elt_info.add("hidden id", hidden_id);
+    if (node.hidden_term())
+        lstm_elt_info.add("recurrent id", desc->recurrent);
     node_info->add("lstm elt info", lstm_elt_info);
     node_info->dump(primitive_description);
 
@@ -64,5 +69,6 @@ lstm_elt_inst::typed_primitive_inst(network_impl& network, lstm_elt_node const&
 {
     auto input_size = node.input().get_output_layout();
     CLDNN_ERROR_NOT_PROPER_FORMAT(node.id(), "input format", input_size.format.value, "expected format", format::bfyx, format::fyxb);
+    CLDNN_ERROR_BOOL(node.id(), "Hidden without recurrent", node.hidden_term() && node.get_primitive()->recurrent.empty(), "Recurrent data is required to use hidden values.");
 }
 }
@@ -41,7 +41,14 @@ layout lstm_gemm_inst::calc_output_layout(lstm_gemm_node const& node)
     //   biases{bfyx}    = [b: 1,     f:1 ,          x: direction,       y:  4 * hidden_size ]
     //   hidden{bfyx}    = [b: batch, f:  direction, x: 1 ,              y: hidden_size ] optional
     //   tempGEMM{bfyx}  = [b: batch, f: direction,  x: 4*hidden_size,   y: 1] output
-    auto result = layout(input_layout.data_type, input_layout.format, tensor(input_layout.size.batch[0], weights_layout.size.feature[0], weights_layout.size.spatial[1], 1));
+    // Without hidden, the whole input sequence is multiplied at once by weights of a single direction:
+    //   weights{bfyx}   = [b: 1,     f: 1,          x: 4 * hidden_size, y: input_size ]
+    //   tempGEMM{bfyx}  = [b: batch, f: sequence,   x: 4*hidden_size,   y: 1] output
+    const bool sequence_input = input_layout.size.feature[0] > 1 && !node.hidden_term();
+    CLDNN_ERROR_BOOL(node.id(), "Sequence input with multiple directions", sequence_input && weights_layout.size.feature[0] > 1,
+        "Input sequence can be multiplied only by weights of a single direction.");
+    auto output_features = sequence_input ? input_layout.size.feature[0] : weights_layout.size.feature[0];
+    auto result = layout(input_layout.data_type, input_layout.format, tensor(input_layout.size.batch[0], output_features, weights_layout.size.spatial[1], 1));
     return result;
 }
 
@@ -72,5 +79,6 @@ lstm_gemm_inst::typed_primitive_inst(network_impl& network, lstm_gemm_node const
 {
     auto input_layout = node.input().get_output_layout();
     CLDNN_ERROR_NOT_PROPER_FORMAT(node.id(), "input format", input_layout.format.value, "expected format", format::bfyx, format::fyxb);
+    CLDNN_ERROR_BOOL(node.id(), "Sequence input with hidden", input_layout.size.feature[0] > 1 && node.hidden_term(), "Hidden values can be used only for a single time step.");
 }
 }
@@ -18,6 +18,9 @@
 
 #include <algorithm> 
 #include <fstream>
+#include <unordered_map>
+#include <functional>
+#include <cstdio>
 
 #include "memory_pool.h"
 #include "engine_impl.h"
@@ -25,6 +28,7 @@
 #include "program_impl.h"
 
 #include "program_node.h"
+#include "input_layout_inst.h"
 
 #include "gpu/memory_gpu.h"
 namespace cldnn
@@ -74,30 +78,32 @@ namespace cldnn
     memory_pool::~memory_pool()
     { }
 
-    bool memory_pool::has_conflict(const memory_set& a, const std::set<primitive_id>& b, uint32_t b_network_id)
-    {   
-        std::set<primitive_id> a_same_network;
-        for (auto const& mem_usr : a)
+    bool memory_pool::has_conflict(const memory_set& a, const std::vector<uint32_t>& b, uint32_t b_network_id)
+    {
+        // users are sorted by network id first, so users from b_network_id make a contiguous range sorted by processing number;
+        // it's merged with sorted b without building temporary sets (it's called for each candidate memory record)
+        auto a_itr = a.lower_bound(memory_user(primitive_id(), 0, b_network_id));
+        auto b_itr = b.begin();
+        while (a_itr != a.end() && a_itr->_network_id == b_network_id && b_itr != b.end())
         {
-            if (mem_usr._network_id == b_network_id)
-            {
-                a_same_network.insert(mem_usr._id);
-            }
+            if (a_itr->_node_idx == *b_itr)
+                return true;
+            if (a_itr->_node_idx < *b_itr)
+                ++a_itr;
+            else
+                ++b_itr;
         }
-        std::vector<primitive_id> intersection;
-        intersection.reserve(std::min(a_same_network.size(), b.size()));
-        set_intersection(a_same_network.begin(), a_same_network.end(), b.begin(), b.end(), std::back_inserter(intersection));
-        return !intersection.empty();
+        return false;
     }
 
-    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    memory_impl::ptr memory_pool::get_from_non_padded_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>& restrictions)
     {
         auto it = _non_padded_pool.lower_bound(layout.bytes_count());
         while (it != _non_padded_pool.end())
         {
             if (!has_conflict(it->second._users, restrictions, network_id))
             {
-                it->second._users.insert(memory_user( id, network_id ));
+                it->second._users.insert(memory_user(id, node_idx, network_id));
                 auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
                 return ret_mem;
             }
@@ -107,14 +113,14 @@ namespace cldnn
         // didn't find anything for you? create new resource
         auto mem = alloc_memory(layout);
         {
-            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ {id, network_id } }, mem, network_id));
+            _non_padded_pool.emplace(layout.bytes_count(), memory_record({ { id, node_idx, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
         return mem;
     }
 
-    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions)
+    memory_impl::ptr memory_pool::get_from_padded_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>& restrictions)
     {
         auto first_level_cache = _padded_pool.find(layout);
         
@@ -126,19 +132,19 @@ namespace cldnn
                     layout.size.batch[0] <= rec_list._memory->get_layout().size.batch[0] &&
                     !has_conflict(rec_list._users, restrictions, network_id))
                 {
-                    rec_list._users.insert({ id, network_id });
+                    rec_list._users.insert({ id, node_idx, network_id });
                     auto ret_mem = _engine->reinterpret_buffer(*(rec_list._memory), layout);
                     return ret_mem;
                 }
             }
             auto mem = alloc_memory(layout);
-            first_level_cache->second.emplace_back(memory_record({ { id, network_id } }, mem, network_id));
+            first_level_cache->second.emplace_back(memory_record({ { id, node_idx, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
             return mem;            
         }
         auto mem = alloc_memory(layout);
-        std::list<memory_record> list = { memory_record({ { id, network_id } },mem, network_id) };
+        std::list<memory_record> list = { memory_record({ { id, node_idx, network_id } },mem, network_id) };
         _padded_pool.emplace(layout, std::move(list));
         // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
         _engine->release();
@@ -148,7 +154,7 @@ namespace cldnn
     /*
         This is not reusable within one network or it's internal micronetworks. But we can use this memory records between networks.
     */
-    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t network_id)
+    memory_impl::ptr memory_pool::get_from_across_networks_pool(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id)
     {
         auto it = _no_reusable_pool.lower_bound(layout.bytes_count());
 
@@ -158,7 +164,7 @@ namespace cldnn
             {
                 if (!has_conflict(it->second._users, {}, network_id))
                 {
-                    it->second._users.insert(memory_user(id, network_id));
+                    it->second._users.insert(memory_user(id, node_idx, network_id));
                     auto ret_mem = _engine->reinterpret_buffer(*it->second._memory, layout);
                     return ret_mem;
                 }
@@ -167,7 +173,7 @@ namespace cldnn
         }
         auto mem = alloc_memory(layout);
         {
-            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, network_id } }, mem, network_id));
+            _no_reusable_pool.emplace(layout.bytes_count(), memory_record({ { id, node_idx, network_id } }, mem, network_id));
             // we don't want to store any resources with no parents so memory pool has to store weak pointer of _engine. 
             _engine->release();
         }
@@ -179,17 +185,17 @@ namespace cldnn
         return alloc_memory(layout);
     }
 
-    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t network_id, const std::set<primitive_id>& restrictions, bool reusable_across_network)
+    memory_impl::ptr memory_pool::get_memory(const layout& layout, const primitive_id& id, uint32_t node_idx, uint32_t network_id, const std::vector<uint32_t>& restrictions, bool reusable_across_network)
     {
         if (reusable_across_network) //reusable within the same network
         {
             if (!layout.format.is_image() && layout.data_padding == padding{ { 0,0,0,0 }, 0 }) // non-padded buffers
             {
-                return get_from_non_padded_pool(layout, id, network_id, restrictions);
+                return get_from_non_padded_pool(layout, id, node_idx, network_id, restrictions);
             }
             else if (!layout.format.is_image()) // padded buffers
             {
-                return get_from_padded_pool(layout, id, network_id, restrictions);
+                return get_from_padded_pool(layout, id, node_idx, network_id, restrictions);
             }
             else  // images
             {
@@ -199,7 +205,7 @@ namespace cldnn
         }
         else
         {
-            return get_from_across_networks_pool(layout, id, network_id);
+            return get_from_across_networks_pool(layout, id, node_idx, network_id);
         }
     }
 
@@ -249,6 +255,243 @@ namespace cldnn
         color_graph(program);
     }
 
+    namespace
+    {
+        std::string json_escape(const std::string& str)
+        {
+            std::string res;
+            for (char c : str)
+            {
+                if (c == '"' || c == '\\')
+                {
+                    res += '\\';
+                    res += c;
+                }
+                else if (static_cast<unsigned char>(c) < 0x20)
+                {
+                    char code[7];
+                    snprintf(code, sizeof(code), "\\u%04x", static_cast<unsigned>(c));
+                    res += code;
+                }
+                else
+                {
+                    res += c;
+                }
+            }
+            return res;
+        }
+
+        // quotes the field and doubles embedded quotes (RFC 4180)
+        std::string csv_escape(const std::string& str)
+        {
+            std::string res = "\"";
+            for (char c : str)
+            {
+                if (c == '"')
+                    res += '"';
+                res += c;
+            }
+            return res + "\"";
+        }
+    }
+
+    uint64_t memory_pool_report::record_info::max_used_bytes() const
+    {
+        uint64_t used = 0;
+        for (const auto& usr : _users)
+            used = std::max(used, usr._bytes);
+        return std::min(used, _bytes);
+    }
+
+    uint64_t memory_pool_report::allocated_bytes() const
+    {
+        uint64_t total = 0;
+        for (const auto& rec : _records)
+            total += rec._bytes;
+        return total;
+    }
+
+    uint64_t memory_pool_report::slack_bytes() const
+    {
+        uint64_t total = 0;
+        for (const auto& rec : _records)
+            total += rec.slack_bytes();
+        return total;
+    }
+
+    uint64_t memory_pool_report::lower_bound_bytes() const
+    {
+        uint64_t bound = 0;
+        for (const auto& step : _steps)
+            bound = std::max(bound, step._live_bytes);
+        return bound;
+    }
+
+    void memory_pool_report::dump_json(std::ostream& out) const
+    {
+        out << "{\n";
+        out << "  \"network_id\": " << _network_id << ",\n";
+        out << "  \"allocated_bytes\": " << allocated_bytes() << ",\n";
+        out << "  \"slack_bytes\": " << slack_bytes() << ",\n";
+        out << "  \"lower_bound_bytes\": " << lower_bound_bytes() << ",\n";
+        out << "  \"steps\": [";
+        const char* delim = "\n";
+        for (size_t i = 0; i < _steps.size(); i++)
+        {
+            out << delim << "    { \"step\": " << i << ", \"id\": \"" << json_escape(_steps[i]._id)
+                << "\", \"live_bytes\": " << _steps[i]._live_bytes
+                << ", \"occupied_bytes\": " << _steps[i]._occupied_bytes << " }";
+            delim = ",\n";
+        }
+        out << "\n  ],\n";
+        out << "  \"records\": [";
+        delim = "\n";
+        for (const auto& rec : _records)
+        {
+            out << delim << "    { \"pool\": \"" << rec._pool << "\", \"bytes\": " << rec._bytes
+                << ", \"max_used_bytes\": " << rec.max_used_bytes()
+                << ", \"slack_bytes\": " << rec.slack_bytes() << ", \"users\": [";
+            const char* usr_delim = "";
+            for (const auto& usr : rec._users)
+            {
+                out << usr_delim << "{ \"id\": \"" << json_escape(usr._id) << "\", \"bytes\": " << usr._bytes
+                    << ", \"utilization\": " << (rec._bytes ? static_cast<double>(usr._bytes) / rec._bytes : 0.0)
+                    << ", \"first_step\": " << usr._first_step << ", \"last_step\": " << usr._last_step << " }";
+                usr_delim = ", ";
+            }
+            out << "] }";
+            delim = ",\n";
+        }
+        out << "\n  ]\n";
+        out << "}\n";
+    }
+
+    void memory_pool_report::dump_steps_csv(std::ostream& out) const
+    {
+        out << "step,id,live_bytes,occupied_bytes\n";
+        for (size_t i = 0; i < _steps.size(); i++)
+            out << i << "," << csv_escape(_steps[i]._id) << "," << _steps[i]._live_bytes << "," << _steps[i]._occupied_bytes << "\n";
+    }
+
+    void memory_pool_report::dump_records_csv(std::ostream& out) const
+    {
+        out << "record,pool,record_bytes,user,user_bytes,utilization,first_step,last_step\n";
+        for (size_t i = 0; i < _records.size(); i++)
+        {
+            const auto& rec = _records[i];
+            for (const auto& usr : rec._users)
+            {
+                out << i << "," << rec._pool << "," << rec._bytes << "," << csv_escape(usr._id) << "," << usr._bytes << ","
+                    << (rec._bytes ? static_cast<double>(usr._bytes) / rec._bytes : 0.0) << ","
+                    << usr._first_step << "," << usr._last_step << "\n";
+            }
+        }
+    }
+
+    memory_pool_report memory_pool::get_memory_pool_report(const program_impl& program, uint32_t network_id) const
+    {
+        memory_pool_report report;
+        report._network_id = network_id;
+
+        // position of each node in processing order
+        std::unordered_map<const program_node*, uint32_t> steps;
+        for (auto node : program.get_processing_order())
+        {
+            steps.emplace(node, static_cast<uint32_t>(report._steps.size()));
+            report._steps.push_back({ node->id(), 0, 0 });
+        }
+        if (report._steps.empty())
+            return report;
+
+        const uint32_t last_step = static_cast<uint32_t>(report._steps.size() - 1);
+
+        // Tensor has to be kept alive until its last consumer is executed. Optimized out users (in-place crops, concatenations,
+        // reshapes) share the buffer, so their consumers extend the lifetime as well. Network outputs live until the end.
+        std::function<uint32_t(const program_node&)> get_last_use = [&](const program_node& node) -> uint32_t
+        {
+            if (node.is_output())
+                return last_step;
+            uint32_t last_use = steps.count(&node) ? steps.at(&node) : 0;
+            for (auto usr : node.get_users())
+            {
+                if (usr->can_be_optimized())
+                    last_use = std::max(last_use, get_last_use(*usr));
+                else if (steps.count(usr))
+                    last_use = std::max(last_use, steps.at(usr));
+            }
+            return last_use;
+        };
+
+        auto add_record = [&](const memory_record& record, const char* pool)
+        {
+            memory_pool_report::record_info rec_info{ pool, record._memory->size(), {} };
+            for (const auto& usr : record._users)
+            {
+                if (usr._network_id != network_id || !program.has_node(usr._id))
+                    continue;
+                const auto& node = program.get_node(usr._id);
+                if (!steps.count(&node))
+                    continue;
+                rec_info._users.push_back({ usr._id, node.get_output_layout().bytes_count(), steps.at(&node), get_last_use(node) });
+            }
+            if (!rec_info._users.empty())
+                report._records.push_back(std::move(rec_info));
+        };
+
+        for (const auto& record : _non_padded_pool)
+            add_record(record.second, "non_padded");
+        for (const auto& list : _padded_pool)
+            for (const auto& record : list.second)
+                add_record(record, "padded");
+        for (const auto& record : _no_reusable_pool)
+            add_record(record.second, "across_networks");
+
+        // network inputs and outputs are allocated outside of the pool, but they are alive as well
+        for (auto node : program.get_processing_order())
+        {
+            if (node->can_be_optimized() || !(node->is_type<input_layout>() || node->is_output()))
+                continue;
+            const auto bytes = node->get_output_layout().bytes_count();
+            for (uint32_t step = steps.at(node); step <= get_last_use(*node); step++)
+                report._steps[step]._live_bytes += bytes;
+        }
+
+        for (const auto& rec : report._records)
+        {
+            std::vector<bool> occupied(report._steps.size(), false);
+            for (const auto& usr : rec._users)
+            {
+                for (uint32_t step = usr._first_step; step <= usr._last_step; step++)
+                {
+                    report._steps[step]._live_bytes += usr._bytes;
+                    occupied[step] = true;
+                }
+            }
+            for (size_t step = 0; step < occupied.size(); step++)
+            {
+                if (occupied[step])
+                    report._steps[step]._occupied_bytes += rec._bytes;
+            }
+        }
+
+        return report;
+    }
+
+    void memory_pool::dump_memory_pool_report(const program_impl& program, uint32_t network_id, std::string path) const
+    {
+        auto report = get_memory_pool_report(program, network_id);
+        const auto prefix = path + "cldnn_memory_pool_" + std::to_string(network_id);
+
+        std::ofstream json(prefix + ".json");
+        report.dump_json(json);
+
+        std::ofstream steps_csv(prefix + "_steps.csv");
+        report.dump_steps_csv(steps_csv);
+
+        std::ofstream records_csv(prefix + "_records.csv");
+        report.dump_records_csv(records_csv);
+    }
+
     void memory_pool::color_graph(const program_impl& program)
     {
         uint32_t color = 0;
@@ -26,6 +26,7 @@
 #include "error_handler.h"
 #include "primitive_inst.h"
 #include "input_layout_inst.h"
+#include "data_inst.h"
 #include "condition_inst.h"
 #include "kernel_selector_helper.h"
 #include <algorithm>
@@ -52,7 +53,7 @@ network_impl::network_impl(const program_impl& program, bool is_internal)
     build_insts_deps();
     build_exec_order();
 
-    _program->dump_memory_pool();
+    _program->dump_memory_pool(net_id);
 }
 
 network_impl::network_impl(engine_impl& engine, const topology_impl& topo, const build_options& options, bool is_internal)
@@ -100,6 +101,32 @@ void network_impl::set_input_data(const primitive_id& id, memory_impl& data)
     input->set_data(data);
 }
 
+void network_impl::update_data(const primitive_id& id, memory_impl& data)
+{
+    auto updater = _program->get_data_updater();
+    if (updater == nullptr)
+        CLDNN_ERROR_MESSAGE(id, "network has to be built with updatable_data option to update data primitives");
+
+    //Wait for previous execution completion
+    reset_execution(true);
+    auto changed = updater->update(id, data);
+
+    //data instances use memory attached to data nodes, unless it was allocated by other engine and had to be copied
+    for (auto const& prim : _primitives)
+    {
+        if (prim.second->type() != data::type_id())
+            continue;
+        auto& attached = std::static_pointer_cast<data_inst>(prim.second)->node.get_attached_memory();
+        auto& output = prim.second->output_memory();
+        if (&attached == &output || changed.count(&attached) == 0)
+            continue;
+
+        mem_lock<char> src{ attached };
+        mem_lock<char> dst{ output };
+        std::copy(src.begin(), src.end(), dst.begin());
+    }
+}
+
 void cldnn::network_impl::check_names()
 {
     for (auto const& prim : _primitives)
@@ -116,7 +116,7 @@ memory_impl::ptr primitive_inst::allocate_output()
         (_node.can_be_optimized() ||
         _node.is_type<generic_layer>()))
     {
-        return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), false);
+        return get_network().get_engine().allocate_memory(layout, _node.id(), _node.get_processing_num(), get_network_id(), _node.get_memory_dependencies(), false);
     }
     else if (_network.is_internal() ||
         _node.is_type<data>() ||
@@ -131,7 +131,7 @@ memory_impl::ptr primitive_inst::allocate_output()
     {
         return get_network().get_engine().allocate_memory(layout);
     }
-    return get_network().get_engine().allocate_memory(layout, _node.id(), get_network_id(), _node.get_memory_dependencies(), true);
+    return get_network().get_engine().allocate_memory(layout, _node.id(), _node.get_processing_num(), get_network_id(), _node.get_memory_dependencies(), true);
 }
 
 std::vector<std::shared_ptr<primitive_inst>> primitive_inst::build_exec_deps(std::vector<std::shared_ptr<primitive_inst>> const& deps)
@@ -60,6 +60,7 @@
 #include <iostream>
 #include <sstream>
 #include <iomanip>
+#include <set>
 
 
 program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topology, build_options const& options, bool is_internal)
@@ -75,6 +76,9 @@ program_impl::program_impl(engine_impl& engine_ref, topology_impl const& topolog
         throw std::invalid_argument("Engine must be created with profiling enabled in tune_and_cache mode!");
     }
 
+    if (options.get<build_option_type::updatable_data>()->enabled())
+        updater.reset(new data_updater(*engine, options.get<build_option_type::host_weights_reorder>()->enabled()));
+
     init_graph(topology);
     pre_optimize_graph();
     compile_graph();
@@ -203,6 +207,8 @@ void program_impl::init_graph(topology_impl const& topology)
     {
         auto& n = get_or_create(prim.second);
         inputs.push_back(&n);
+        if (updater && n.is_type<data>())
+            updater->add_source(n.id(), n.as<data>().get_attached_memory());
     }
     replace_nodes_pre();
 
@@ -263,6 +269,13 @@ void program_impl::pre_optimize_graph()
             node->get_output_layout();
     }
 
+    if (options.get<build_option_type::optimize_data>()->enabled())
+    {
+        // duplicated constants and subgraphs (i.e. repeated reorders of the same input) are stored and computed once
+        remove_duplicate_primitives remove_duplicate_primitives_pass;
+        remove_duplicate_primitives_pass.run(*this);
+    }
+
     // shrinking eltwise if users are conv 1x1 with stride > 1 optimization
     eltwise_shrinking eltwise_shrinking_pass;
     eltwise_shrinking_pass.run(*this);
@@ -276,7 +289,20 @@ void program_impl::pre_optimize_graph()
         prepare_primitive_fusing prepare_primitive_fusing_pass;
         prepare_primitive_fusing_pass.run(*this);
 
+        // siblings reading the same input are merged into one convolution with crops of its output
+        if (options.get<build_option_type::fuse_sibling_convolutions>()->enabled())
+        {
+            fuse_sibling_convolutions fuse_sibling_convolutions_pass;
+            fuse_sibling_convolutions_pass.run(*this);
+        }
+
         layout_optimizer lo(output_size_handling_enabled);
+        if (options.get<build_option_type::global_layout_assignment>()->enabled())
+        {
+            select_global_layouts select_global_layouts_pass(lo);
+            select_global_layouts_pass.run(*this);
+        }
+
         reorder_inputs reorder_inputs_pass(lo);
         reorder_inputs_pass.run(*this);
 
@@ -714,9 +740,39 @@ void program_impl::replace_nodes_post()
     }
 }
 
+// returns tensor which consecutive time steps (along feature) are inputs of lstm node, if there is one
+static program_node* get_lstm_sequence_input(program_node& node, size_t sequence_len)
+{
+    if (sequence_len < 2 || node.get_dependencies().size() != sequence_len)
+        return nullptr;
+
+    program_node* sequence_input = nullptr;
+    for (size_t i = 0; i < sequence_len; ++i)
+    {
+        auto& step = node.get_dependency(i);
+        if (!step.is_type<crop>())
+            return nullptr;
+
+        auto& step_input = step.as<crop>().input();
+        if (sequence_input != nullptr && sequence_input != &step_input)
+            return nullptr;
+        sequence_input = &step_input;
+
+        auto input_size = sequence_input->get_output_layout().size;
+        auto crop_prim = step.as<crop>().get_primitive();
+        if (input_size.feature[0] != static_cast<tensor::value_type>(sequence_len) ||
+            crop_prim->offsets != tensor(0, static_cast<tensor::value_type>(i), 0, 0) ||
+            crop_prim->reference_input != tensor(input_size.batch[0], 1, input_size.spatial[0], input_size.spatial[1]))
+            return nullptr;
+    }
+    return sequence_input;
+}
+
 void program_impl::handle_lstm()
 {
     bool has_lstm_children;
+    //crops of lstm inputs which may be no longer used if input GEMM is computed for the whole sequence
+    std::set<primitive_id> sequence_steps;
     auto itr = nodes_map.begin(); //note we need to use iterators since currently processed element can be removed
     while (itr != nodes_map.end())
     {
@@ -781,10 +837,58 @@ void program_impl::handle_lstm()
             std::vector<program_node*> hidden_list(directions * sequence_len);
             std::map<size_t, std::pair<primitive_id, program_node*>> output_map;
 
+            //if time steps are parts of one tensor, input GEMM is computed for the whole sequence at once
+            //and only the recurrent GEMM is left for each time step, fused with element-wise operations
+            program_node* sequence_input = nullptr;
+            if (options.get<build_option_type::lstm_sequence_fusion>()->enabled())
+                sequence_input = get_lstm_sequence_input(*node, sequence_len);
+            if (sequence_input)
+            {
+                for (auto step : node->get_dependencies())
+                    sequence_steps.insert(step->id());
+            }
+            auto gates_size = tensor(input_size.batch[0], 1, recurrent_size.spatial[1], 1);
+
             //lstm expanding
             for (size_t dir = 0; dir < directions; ++dir) {
                 auto hidden_id = initial_hidden_id;
                 auto cell_id = initial_cell_id;
+
+                program_node* sequence_gemm = nullptr;
+                if (sequence_input)
+                {
+                    //output of the sequence GEMM has no direction dimension, so it gets weights and bias of its direction only
+                    //(crops of constants are folded during the build)
+                    primitive_id sequence_weights_id = weights_id;
+                    primitive_id sequence_bias_id = bias_id;
+                    if (directions > 1)
+                    {
+                        auto weights_size = nodes_map.at(weights_id)->get_output_layout().size;
+                        sequence_weights_id = node->id() + ":weights" + get_id_string(dir);
+                        auto weights_crop_prim = std::make_shared<crop>(sequence_weights_id, weights_id,
+                            tensor(1, 1, weights_size.spatial[0], weights_size.spatial[1]), tensor(0, static_cast<tensor::value_type>(dir), 0, 0));
+                        add_connection(*nodes_map.at(weights_id), get_or_create(weights_crop_prim));
+
+                        if (bias_term)
+                        {
+                            auto bias_size = nodes_map.at(bias_id)->get_output_layout().size;
+                            sequence_bias_id = node->id() + ":bias" + get_id_string(dir);
+                            auto bias_crop_prim = std::make_shared<crop>(sequence_bias_id, bias_id,
+                                tensor(1, 1, bias_size.spatial[0], 1), tensor(0, 0, 0, static_cast<tensor::value_type>(dir)));
+                            add_connection(*nodes_map.at(bias_id), get_or_create(bias_crop_prim));
+                        }
+                    }
+
+                    primitive_id sequence_gemm_id = node->id() + ":lstm_gemm_seq" + get_id_string(dir);
+                    auto sequence_gemm_prim = std::make_shared<lstm_gemm>(sequence_gemm_id, sequence_input->get_org_primitive_id(), sequence_weights_id, recurrent_id, sequence_bias_id, "", 0);
+                    sequence_gemm = &get_or_create(sequence_gemm_prim);
+                    add_connection(*sequence_input, *sequence_gemm);
+                    add_connection(*nodes_map.at(sequence_weights_id), *sequence_gemm);
+                    add_connection(*nodes_map.at(recurrent_id), *sequence_gemm);
+                    if (bias_term)
+                        add_connection(*nodes_map.at(sequence_bias_id), *sequence_gemm);
+                }
+
                 for (size_t i = 0; i < sequence_len; ++i) {
                     size_t idx = i + dir * sequence_len;
                     primitive_id lstm_gemm_id = node->id() + ":lstm_gemm" + get_id_string(idx);
@@ -805,38 +909,73 @@ void program_impl::handle_lstm()
                             }
                         }
                     }
-                    primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_org_primitive_id();
-
-                    auto lstm_gemm_node = std::make_shared<lstm_gemm>(lstm_gemm_id, lstm_gemm_input_id, weights_id, recurrent_id, bias_id, hidden_id, (uint32_t)dir);
-                    auto &n1 = get_or_create(lstm_gemm_node);
-
-                    auto lstm_elt_node = std::make_shared<lstm_elt>(lstm_elt_id, lstm_gemm_id, cell_id, lstm_prim->clip, lstm_prim->input_forget,
-                        lstm_prim->activations, lstm_prim->activation_params, lstm_prim->offset_order, (uint32_t)dir);
-                    auto &n2 = get_or_create(lstm_elt_node);
-                    //adding lstm_elt as user
-                    add_connection(n1, n2);
-                    //adding dependecy to lstm_gemm node
-                    //input
-                    add_connection(node->get_dependency(input_idx), n1);
-                    //adding weights and initial values to lstm_gemm
-                    add_connection(*nodes_map.at(weights_id), n1);
-                    add_connection(*nodes_map.at(recurrent_id), n1);
-                    if (bias_term)
-                        add_connection(*nodes_map.at(bias_id), n1);
-
-                    //adding cell and hiddens as dependencies
-                    if (i > 0)
+                    program_node* elt_node = nullptr;
+                    if (sequence_gemm)
                     {
-                        add_connection(*cell_list[size_t(i - 1) * directions + dir], n2);
-                        add_connection(*hidden_list[size_t(i - 1) * directions + dir], n1);
+                        primitive_id gates_id = node->id() + ":gates" + get_id_string(idx);
+                        auto gates_prim = std::make_shared<crop>(gates_id, sequence_gemm->id(), gates_size, tensor(0, static_cast<tensor::value_type>(input_idx), 0, 0));
+                        auto &gates_node = get_or_create(gates_prim);
+                        add_connection(*sequence_gemm, gates_node);
+
+                        bool has_hidden = i > 0 || initial_hidden_term;
+                        auto lstm_elt_node = std::make_shared<lstm_elt>(lstm_elt_id, gates_id, cell_id, lstm_prim->clip, lstm_prim->input_forget,
+                            lstm_prim->activations, lstm_prim->activation_params, lstm_prim->offset_order, (uint32_t)dir,
+                            padding(), has_hidden ? hidden_id : "", has_hidden ? recurrent_id : "");
+                        elt_node = &get_or_create(lstm_elt_node);
+                        add_connection(gates_node, *elt_node);
+
+                        //adding cell, hidden and recurrent as dependencies, in order of lstm_elt dependencies
+                        if (i > 0)
+                        {
+                            add_connection(*cell_list[size_t(i - 1) * directions + dir], *elt_node);
+                            add_connection(*hidden_list[size_t(i - 1) * directions + dir], *elt_node);
+                        }
+                        else
+                        {
+                            if (initial_cell_term)
+                                add_connection(*nodes_map.at(cell_id), *elt_node);
+                            if (initial_hidden_term)
+                                add_connection(*nodes_map.at(hidden_id), *elt_node);
+                        }
+                        if (has_hidden)
+                            add_connection(*nodes_map.at(recurrent_id), *elt_node);
                     }
-                    //if initial values are present
                     else
                     {
-                        if (initial_hidden_term)
-                            add_connection(*nodes_map.at(hidden_id), n1);
-                        if (initial_cell_term)
-                            add_connection(*nodes_map.at(cell_id), n2);
+                        primitive_id lstm_gemm_input_id = node->get_dependency(input_idx).get_org_primitive_id();
+
+                        auto lstm_gemm_node = std::make_shared<lstm_gemm>(lstm_gemm_id, lstm_gemm_input_id, weights_id, recurrent_id, bias_id, hidden_id, (uint32_t)dir);
+                        auto &n1 = get_or_create(lstm_gemm_node);
+
+                        auto lstm_elt_node = std::make_shared<lstm_elt>(lstm_elt_id, lstm_gemm_id, cell_id, lstm_prim->clip, lstm_prim->input_forget,
+                            lstm_prim->activations, lstm_prim->activation_params, lstm_prim->offset_order, (uint32_t)dir);
+                        auto &n2 = get_or_create(lstm_elt_node);
+                        elt_node = &n2;
+                        //adding lstm_elt as user
+                        add_connection(n1, n2);
+                        //adding dependecy to lstm_gemm node
+                        //input
+                        add_connection(node->get_dependency(input_idx), n1);
+                        //adding weights and initial values to lstm_gemm
+                        add_connection(*nodes_map.at(weights_id), n1);
+                        add_connection(*nodes_map.at(recurrent_id), n1);
+                        if (bias_term)
+                            add_connection(*nodes_map.at(bias_id), n1);
+
+                        //adding cell and hiddens as dependencies
+                        if (i > 0)
+                        {
+                            add_connection(*cell_list[size_t(i - 1) * directions + dir], n2);
+                            add_connection(*hidden_list[size_t(i - 1) * directions + dir], n1);
+                        }
+                        //if initial values are present
+                        else
+                        {
+                            if (initial_hidden_term)
+                                add_connection(*nodes_map.at(hidden_id), n1);
+                            if (initial_cell_term)
+                                add_connection(*nodes_map.at(cell_id), n2);
+                        }
                     }
 
                     //lstm_hidden
@@ -845,7 +984,7 @@ void program_impl::handle_lstm()
                         auto crop_hidden = std::make_shared<crop>(hidden_id, lstm_elt_id, hidden_size, tensor{ 0,0,0,0 });
                         auto &n3 = get_or_create(crop_hidden);
                         //adding eltwise as dependency to hidden
-                        add_connection(n2, n3);
+                        add_connection(*elt_node, n3);
 
                         //if parent is lstm adding hiddens as dependency
                         if (has_lstm_children)
@@ -868,7 +1007,7 @@ void program_impl::handle_lstm()
                         cell_id = crop_id + ":cell";
                         auto crop_cell = std::make_shared<crop>(cell_id, lstm_elt_id, hidden_size, tensor{ 0,1,0,0 });
                         auto &n4 = get_or_create(crop_cell);
-                        add_connection(n2, n4);
+                        add_connection(*elt_node, n4);
                         cell_list[i * directions + dir] = &n4;
                         if (i == sequence_len - 1)
                         {
@@ -920,6 +1059,19 @@ void program_impl::handle_lstm()
         }
     }
 
+    //time steps of lstm inputs which are not used anymore are removed, unless requested as outputs
+    auto const& requested_outputs = options.get<build_option_type::outputs>()->outputs;
+    for (auto const& step_id : sequence_steps)
+    {
+        auto step = nodes_map.find(step_id);
+        if (step == nodes_map.end() || !step->second->get_users().empty() ||
+            std::find(requested_outputs.begin(), requested_outputs.end(), step_id) != requested_outputs.end())
+            continue;
+
+        remove_all_connections(*step->second);
+        optimized_out.push_back(step_id);
+        nodes_map.erase(step);
+    }
 }
 
 void program_impl::set_outputs()
@@ -1054,12 +1206,12 @@ void program_impl::mark_data_flow()
     }
 }
 
-void add_memory_dependency(program_node* node, program_node* dep)
+void program_impl::add_memory_dependency(program_node* node, program_node* dep)
 {
     if (node->can_be_optimized() ||
         !dep->can_be_optimized())
     {
-        node->add_memory_dependency(dep->id());
+        node->add_memory_dependency(*dep);
     }
     else
     {
@@ -1078,7 +1230,7 @@ void add_memory_dependency(program_node* node, program_node* dep)
 void program_impl::basic_memory_dependencies()
 {
     auto itr = processing_order.begin();
-    std::vector<primitive_id> past_outputs;
+    std::vector<program_node*> past_outputs;
     while (itr != processing_order.end())
     {
         auto& node = *itr;
@@ -1097,44 +1249,38 @@ void program_impl::basic_memory_dependencies()
 
         // Note we iterate over processing order, it means if primitve has processing num greater than any of outputs, this output
         // has to land on the primitve restriction list. Otherwise memory reuse can corrupt final results.
-        node->add_memory_dependency(past_outputs);
+        for (auto output : past_outputs)
+            node->add_memory_dependency(*output);
         // if current node is an output add it to the outputs list after restriction.
         if (node->is_output())
-            past_outputs.push_back(node->id());
+            past_outputs.push_back(node);
     }
 }
 
 void program_impl::skipped_branch_memory_dependencies()
 {
-    auto itr = processing_order.begin();
     // Primitive A can't use primitive B buffer if B->processing_num < A->processing_num and any of B users processing_num > A->processing_num
     // Otherwise it could override data that has to be used in the future.
-    // TODO: improve algorithm to to O(n*log(n))
-    while (itr != processing_order.end())
+    // Nodes processed so far are kept with processing num of their last user, as long as it's greater than the current one
+    // (i.e. they're still alive), so each node is compared only with the alive ones.
+    std::vector<std::pair<program_node*, uint32_t>> alive;
+    for (auto node : processing_order)
     {
-        auto& node = *itr;
-        itr++;
-        auto itr2 = processing_order.begin();
-        if (itr2 == itr)
-            continue;
-        while (itr2 != processing_order.end())
+        const auto processing_num = node->get_processing_num();
+        alive.erase(std::remove_if(alive.begin(), alive.end(),
+            [processing_num](const std::pair<program_node*, uint32_t>& entry) { return entry.second <= processing_num; }), alive.end());
+
+        for (auto& entry : alive)
         {
-            auto& node2 = *itr2;
-            itr2++;
-            if (node2->get_processing_num() < node->get_processing_num())
-            {
-                // if at least one user will be processed after 'node', node2 has to be added to forbiden list
-                for (auto usr : node2->get_users())
-                {
-                    if (usr->get_processing_num() > node->get_processing_num())
-                    {
-                        add_memory_dependency(node, node2);
-                        add_memory_dependency(node2, node);
-                        break;
-                    }
-                }
-            }
+            add_memory_dependency(node, entry.first);
+            add_memory_dependency(entry.first, node);
         }
+
+        uint32_t last_use = 0;
+        for (auto usr : node->get_users())
+            last_use = std::max(last_use, usr->get_processing_num());
+        if (last_use > processing_num)
+            alive.emplace_back(node, last_use);
     }
 }
 
@@ -1202,9 +1348,19 @@ void program_impl::prepare_memory_dependencies()
     if (!get_engine().configuration().enable_memory_pool)
         return;
 
+    // dependencies are kept as processing numbers of nodes (they don't change after this point) in a sorted list per node,
+    // so memory taken is proportional to the number of restrictions and the memory pool compares integers, not primitive ids
     basic_memory_dependencies();
     skipped_branch_memory_dependencies();
     oooq_memory_dependencies();
+
+    for (auto node : processing_order)
+    {
+        auto& dependencies = node->memory_dependencies;
+        std::sort(dependencies.begin(), dependencies.end());
+        dependencies.erase(std::unique(dependencies.begin(), dependencies.end()), dependencies.end());
+        dependencies.shrink_to_fit();
+    }
 }
 
 std::string program_impl::get_memory_dependencies_string() const
@@ -1217,7 +1373,7 @@ std::string program_impl::get_memory_dependencies_string() const
         itr++;
         mem_dep = mem_dep.append("primitive: ").append(node->id()).append(" restricted list: ");
         for (auto it : node->get_memory_dependencies())
-            mem_dep == mem_dep.append(it).append(", ");
+            mem_dep == mem_dep.append(std::to_string(it)).append(", ");
         mem_dep = mem_dep.append("\n");
     }
     return mem_dep;
@@ -1787,7 +1943,7 @@ bool program_impl::extract_and_remove(program_node& node)
     return true;
 }
 
-void program_impl::dump_memory_pool() const
+void program_impl::dump_memory_pool(uint32_t network_id) const
 {
     if (!get_engine().configuration().enable_memory_pool)
         return;
@@ -1800,6 +1956,7 @@ void program_impl::dump_memory_pool() const
     path += "cldnn_memory_pool.log";
     auto dep = get_memory_dependencies_string();
     get_engine().dump_memory_pool(*this, path, dep);
+    get_engine().dump_memory_pool_report(*this, network_id, get_dir_path(options));
     dump_program("14_memory_pool", true);
 }
 
@@ -26,6 +26,7 @@ namespace cldnn
     void program_helpers::merge_buffers(engine_impl::ptr engine, program_node &node, layout target_layout, size_t begin_offset, size_t end_offset)
     {
         memory_impl::ptr data_to_allocate = engine->allocate_memory(target_layout);
+        auto updater = node.get_program().get_data_updater();
 
         for (size_t i = begin_offset; i < end_offset; i++)
         {
@@ -33,6 +34,8 @@ namespace cldnn
             mem_lock<char> src{ weights.get_attached_memory() };
             mem_lock<char> dst{ data_to_allocate };
             std::copy(src.begin(), src.end(), dst.begin() + (i - begin_offset)*src.size());
+            if (updater)
+                updater->add_slice(weights.get_attached_memory(), *data_to_allocate, (i - begin_offset)*src.size());
         }
 
         for (size_t i = 0; i < end_offset - begin_offset - 1; i++)
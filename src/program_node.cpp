@@ -70,19 +70,15 @@ void program_node::remove_dependency(size_t idx)
     dependencies.erase(dependencies.begin() + idx);
 }
 
-std::set<primitive_id> program_node::get_memory_dependencies() const
+const std::vector<uint32_t>& program_node::get_memory_dependencies() const
 {
     return memory_dependencies;
 }
 
-void program_node::add_memory_dependency(primitive_id prim)
+//duplicates are removed and the list is sorted by program_impl::prepare_memory_dependencies when all dependencies are known
+void program_node::add_memory_dependency(const program_node& node)
 {
-    memory_dependencies.insert(prim);
-}
-
-void program_node::add_memory_dependency(std::vector<primitive_id> prim_list)
-{
-    memory_dependencies.insert(prim_list.begin(),prim_list.end());
+    memory_dependencies.push_back(node.get_processing_num());
 }
 
 //Function used by serialization. Not working yet, in progress.
@@ -174,6 +170,16 @@ std::unique_ptr<json_composite> program_node::desc_to_json() const
     node_info->add("in data flow", bool_to_str(data_flow));
     node_info->add("output", bool_to_str(output));
 
+    std::vector<std::string> fused_ids;
+    for (const auto& fused : fused_prims)
+    {
+        fused_ids.push_back(fused.desc->id);
+    }
+    if (!fused_ids.empty())
+    {
+        node_info->add("fused primitives", fused_ids);
+    }
+
 
     std::vector<std::string> deps_ptrs;
     {
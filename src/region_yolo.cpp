@@ -31,7 +31,12 @@ namespace cldnn
         auto input_layout = node.input().get_output_layout();
         auto desc = node.get_primitive();
 
-        if (desc->do_softmax)
+        if (desc->max_boxes > 0)
+        {
+            // rows of [image_id, label, confidence, xmin, ymin, xmax, ymax], as in detection_output
+            return cldnn::layout(input_layout.data_type, format::bfyx, tensor(1, 1, 7, desc->max_boxes));
+        }
+        else if (desc->do_softmax)
         {
             return cldnn::layout(input_layout.data_type, input_layout.format,
                                  tensor(input_layout.size.batch[0],
@@ -67,6 +72,12 @@ namespace cldnn
         region_yolo_info.add("num", num);
         region_yolo_info.add("do_softmax", do_softmax);
         region_yolo_info.add("mask_size", mask_size);
+        if (desc->max_boxes > 0)
+        {
+            region_yolo_info.add("anchors", desc->anchors);
+            region_yolo_info.add("confidence_threshold", desc->confidence_threshold);
+            region_yolo_info.add("max_boxes", desc->max_boxes);
+        }
 
 
         node_info->add("region yolo info", region_yolo_info);
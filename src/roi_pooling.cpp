@@ -56,7 +56,7 @@ layout roi_pooling_inst::calc_output_layout(roi_pooling_node const& node)
 std::string roi_pooling_inst::to_string(roi_pooling_node const& node)
 {
     auto desc      = node.get_primitive();
-    auto mode      = desc->mode == pooling_mode::max ? "max" : desc->mode == pooling_mode::bilinear ? "bilinear" : "average";
+    auto mode      = desc->mode == pooling_mode::max ? "max" : desc->mode == pooling_mode::bilinear ? "bilinear" : desc->mode == pooling_mode::roi_align ? "roi_align" : "average";
     auto node_info = node.desc_to_json();
 
     std::stringstream primitive_description;
@@ -67,6 +67,7 @@ std::string roi_pooling_inst::to_string(roi_pooling_node const& node)
     roi_info.add("pooled_h", desc->pooled_height);
     roi_info.add("spatial_scale", desc->spatial_scale);
     roi_info.add("group_sz", desc->group_sz);
+    roi_info.add("sampling_ratio", desc->sampling_ratio);
 
     node_info->add("roi info", roi_info);
     node_info->dump(primitive_description);
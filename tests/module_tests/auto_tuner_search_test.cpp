@@ -0,0 +1,214 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include "auto_tuner_search.h"
+#include "auto_tuner.h"
+
+#include <chrono>
+#include <thread>
+
+using namespace kernel_selector;
+
+namespace
+{
+    TuningCandidate make_candidate(int index, size_t global, size_t local, bool seed = false)
+    {
+        TuningCandidate candidate;
+        candidate.kernelData.kernels.resize(1);
+        candidate.kernelData.kernels[0].workGroups.global = { global, 1, 1 };
+        candidate.kernelData.kernels[0].workGroups.local = { local, 1, 1 };
+        candidate.kernelData.autoTuneIndex = index;
+        candidate.implementationName = "impl";
+        candidate.seed = seed;
+        return candidate;
+    }
+
+    // run time of the candidate is a function of its tune index, number of executions is recorded
+    struct fake_runner
+    {
+        std::vector<TuningCandidate>& candidates;
+        std::function<uint64_t(int)> run_time;
+        size_t runs = 0;
+
+        std::vector<uint64_t> operator()(const std::vector<size_t>& indices, uint32_t runs_per_kernel)
+        {
+            std::vector<uint64_t> res;
+            for (auto i : indices)
+                res.push_back(run_time(candidates[i].kernelData.autoTuneIndex));
+            runs += indices.size() * runs_per_kernel;
+            return res;
+        }
+    };
+}
+
+TEST(auto_tuner_search, occupancy)
+{
+    // 4 work-groups on 8 compute units
+    EXPECT_FLOAT_EQ(AutoTuneSearch::EstimateOccupancy(make_candidate(0, 64, 16).kernelData, 8), 0.5f);
+    // 3 full waves
+    EXPECT_FLOAT_EQ(AutoTuneSearch::EstimateOccupancy(make_candidate(0, 384, 16).kernelData, 8), 1.0f);
+    // 9 work-groups - second wave uses single compute unit
+    EXPECT_FLOAT_EQ(AutoTuneSearch::EstimateOccupancy(make_candidate(0, 144, 16).kernelData, 8), 9.0f / 16.0f);
+    // partial work-group is still a work-group
+    EXPECT_FLOAT_EQ(AutoTuneSearch::EstimateOccupancy(make_candidate(0, 120, 16).kernelData, 8), 1.0f);
+}
+
+TEST(auto_tuner_search, exhaustive_measures_everything)
+{
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 40; i++)
+        candidates.push_back(make_candidate(i, i % 2 ? 16 : 1024, 16));
+
+    fake_runner runner{ candidates, [](int i) { return static_cast<uint64_t>(100 + (i * 7) % 40); } };
+    TuningSearchStats stats;
+    AutoTuneSearch search(true, 0, 8);
+    const int best = search.Run(candidates, std::ref(runner), stats);
+
+    ASSERT_GE(best, 0);
+    EXPECT_EQ(candidates[best].kernelData.runTime, (uint64_t)100);
+    EXPECT_EQ(stats.candidates, (size_t)40);
+    EXPECT_EQ(stats.pruned, (size_t)0);
+    EXPECT_EQ(stats.kernelRuns, (size_t)40 * AutoTuneSearch::exhaustiveRuns);
+    EXPECT_EQ(runner.runs, stats.kernelRuns);
+    EXPECT_EQ(stats.bestRunTime, (uint64_t)100);
+}
+
+TEST(auto_tuner_search, prunes_low_occupancy_configs)
+{
+    // odd configs launch a single work-group, seed is kept anyway
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 40; i++)
+        candidates.push_back(make_candidate(i, i % 2 ? 16 : 1024, 16, i == 39));
+
+    fake_runner runner{ candidates, [](int i) { return static_cast<uint64_t>(1000 - i); } };
+    TuningSearchStats stats;
+    AutoTuneSearch search(false, 0, 8);
+    const int best = search.Run(candidates, std::ref(runner), stats);
+
+    EXPECT_EQ(stats.pruned, (size_t)19);
+    EXPECT_EQ(candidates.size(), (size_t)21);
+    ASSERT_GE(best, 0);
+    // seed is the fastest one
+    EXPECT_EQ(candidates[best].kernelData.autoTuneIndex, 39);
+}
+
+TEST(auto_tuner_search, successive_halving_finds_fastest_with_fewer_runs)
+{
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 1000; i++)
+        candidates.push_back(make_candidate(i, 1024, 16));
+
+    fake_runner runner{ candidates, [](int i) { return static_cast<uint64_t>(1000 + (i * 337) % 1000); } };
+    TuningSearchStats stats;
+    AutoTuneSearch search(false, 0, 8);
+    const int best = search.Run(candidates, std::ref(runner), stats);
+
+    ASSERT_GE(best, 0);
+    EXPECT_EQ(candidates[best].kernelData.runTime, (uint64_t)1000);
+    EXPECT_GT(stats.rounds, (size_t)1);
+    EXPECT_LT(stats.kernelRuns, (size_t)1000 * AutoTuneSearch::exhaustiveRuns);
+    EXPECT_FALSE(stats.budgetExceeded);
+}
+
+TEST(auto_tuner_search, seed_terminates_search_early)
+{
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 100; i++)
+        candidates.push_back(make_candidate(i, 1024, 16, i == 50));
+
+    // seed is nearly the fastest one, all others but a few are much slower
+    auto run_time = [](int i) { return static_cast<uint64_t>(i == 50 ? 110 : i < 3 ? 100 + i : 1000 + i); };
+    fake_runner seeded_runner{ candidates, run_time };
+    TuningSearchStats seeded_stats;
+    const int best = AutoTuneSearch(false, 0, 8).Run(candidates, std::ref(seeded_runner), seeded_stats);
+    ASSERT_GE(best, 0);
+    EXPECT_EQ(candidates[best].kernelData.autoTuneIndex, 0);
+
+    for (auto& c : candidates)
+        c.seed = false;
+    fake_runner runner{ candidates, run_time };
+    TuningSearchStats stats;
+    AutoTuneSearch(false, 0, 8).Run(candidates, std::ref(runner), stats);
+    EXPECT_LT(seeded_stats.rounds, stats.rounds);
+}
+
+TEST(auto_tuner_search, time_budget)
+{
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 100; i++)
+        candidates.push_back(make_candidate(i, 1024, 16, i == 10));
+
+    fake_runner runner{ candidates, [](int i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return static_cast<uint64_t>(1000 - i);
+    } };
+    TuningSearchStats stats;
+    const int best = AutoTuneSearch(false, 1, 8).Run(candidates, std::ref(runner), stats);
+
+    // budget is exceeded while seed is measured - the seed is returned
+    EXPECT_TRUE(stats.budgetExceeded);
+    EXPECT_EQ(stats.rounds, (size_t)1);
+    ASSERT_GE(best, 0);
+    EXPECT_EQ(candidates[best].kernelData.autoTuneIndex, 10);
+}
+
+TEST(auto_tuner_search, time_budget_within_round)
+{
+    // no seed - the budget is exceeded in the middle of the first round of a large search space
+    std::vector<TuningCandidate> candidates;
+    for (int i = 0; i < 100; i++)
+        candidates.push_back(make_candidate(i, 1024, 16));
+
+    fake_runner runner{ candidates, [](int i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return static_cast<uint64_t>(1000 - i);
+    } };
+    TuningSearchStats stats;
+    const int best = AutoTuneSearch(false, 5, 8).Run(candidates, std::ref(runner), stats);
+
+    // the first batch takes longer than the budget - search stops after it with the fastest one measured
+    EXPECT_TRUE(stats.budgetExceeded);
+    EXPECT_EQ(stats.rounds, (size_t)1);
+    EXPECT_EQ(stats.kernelRuns, AutoTuneSearch::measureBatchSize);
+    ASSERT_GE(best, 0);
+    EXPECT_EQ(candidates[best].kernelData.autoTuneIndex, (int)AutoTuneSearch::measureBatchSize - 1);
+
+    // exhaustive search respects the budget too
+    fake_runner exhaustive_runner{ candidates, runner.run_time };
+    TuningSearchStats exhaustive_stats;
+    AutoTuneSearch(true, 5, 8).Run(candidates, std::ref(exhaustive_runner), exhaustive_stats);
+    EXPECT_TRUE(exhaustive_stats.budgetExceeded);
+    EXPECT_EQ(exhaustive_stats.kernelRuns, AutoTuneSearch::measureBatchSize * AutoTuneSearch::exhaustiveRuns);
+}
+
+TEST(auto_tuner_search, nearest_tuned_shape)
+{
+    AutoTuner tuner;
+    EXPECT_EQ(std::get<0>(tuner.FindNearestTunedShape(KernelType::CONVOLUTION, { 1, 64, 56, 56 })), "");
+
+    tuner.StoreTunedShape(KernelType::CONVOLUTION, { 1, 64, 56, 56 }, "conv_a", 3);
+    tuner.StoreTunedShape(KernelType::CONVOLUTION, { 1, 256, 14, 14 }, "conv_b", 7);
+    tuner.StoreTunedShape(KernelType::FULLY_CONNECTED, { 1, 64, 28, 28 }, "fc", 1);
+
+    EXPECT_EQ(tuner.FindNearestTunedShape(KernelType::CONVOLUTION, { 1, 64, 28, 28 }), std::make_tuple(std::string("conv_a"), 3));
+    EXPECT_EQ(tuner.FindNearestTunedShape(KernelType::CONVOLUTION, { 1, 512, 14, 14 }), std::make_tuple(std::string("conv_b"), 7));
+    EXPECT_EQ(tuner.FindNearestTunedShape(KernelType::FULLY_CONNECTED, { 1, 512, 14, 14 }), std::make_tuple(std::string("fc"), 1));
+    // shapes of different rank are not comparable
+    EXPECT_EQ(std::get<0>(tuner.FindNearestTunedShape(KernelType::CONVOLUTION, { 1, 64, 56 })), "");
+}
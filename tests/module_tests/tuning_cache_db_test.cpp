@@ -0,0 +1,232 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+#include <gtest/gtest.h>
+#include "tuning_cache_db.h"
+#include "auto_tuner.h"
+#include "auto_tuner_offline.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <vector>
+
+using namespace kernel_selector;
+
+namespace
+{
+    // Serializes tuning data in the layout described in kernel_selector/core/cache/tuning_cache_db_gen.py.
+    struct db_builder
+    {
+        std::map<uint32_t, std::map<uint64_t, std::pair<uint32_t, int32_t>>> sections;
+        std::vector<std::string> names;
+
+        std::vector<uint8_t> bytes;
+
+        template <class T>
+        void put(T value)
+        {
+            const auto ptr = reinterpret_cast<const uint8_t*>(&value);
+            bytes.insert(bytes.end(), ptr, ptr + sizeof(T));
+        }
+
+        size_t header_size() const { return 24; }
+        size_t entries_offset() const { return header_size() + sections.size() * 16; }
+
+        std::vector<uint8_t>& build()
+        {
+            bytes.clear();
+            bytes.insert(bytes.end(), { 'C', 'L', 'D', 'N', 'N', 'T', 'D', 'B' });
+            put<uint32_t>(1);
+            put<uint32_t>(static_cast<uint32_t>(sections.size()));
+            put<uint32_t>(static_cast<uint32_t>(names.size()));
+            put<uint32_t>(0);
+
+            uint32_t first = 0;
+            for (const auto& s : sections)
+            {
+                put<uint32_t>(s.first);
+                put<uint32_t>(first);
+                put<uint32_t>(static_cast<uint32_t>(s.second.size()));
+                put<uint32_t>(0);
+                first += static_cast<uint32_t>(s.second.size());
+            }
+            for (const auto& s : sections)
+            {
+                for (const auto& e : s.second)
+                {
+                    put<uint64_t>(e.first);
+                    put<uint32_t>(e.second.first);
+                    put<int32_t>(e.second.second);
+                }
+            }
+            uint32_t offset = 0;
+            for (const auto& n : names)
+            {
+                put<uint32_t>(offset);
+                put<uint32_t>(static_cast<uint32_t>(n.size()));
+                offset += static_cast<uint32_t>(n.size());
+            }
+            for (const auto& n : names)
+                bytes.insert(bytes.end(), n.begin(), n.end());
+            return bytes;
+        }
+    };
+
+    db_builder make_test_db()
+    {
+        db_builder db;
+        db.names = { "convolution_gpu_bfyx_gemm_like", "convolution_gpu_bfyx_os_iyx_osv16" };
+        db.sections[24] = { { 5, { 0, 1 } }, { 17, { 1, 203 } }, { 0xFFFFFFFFFFFFFFF0ull, { 0, -1 } } };
+        db.sections[72] = { { 17, { 0, 2 } } };
+        return db;
+    }
+
+    // keeps the data 8-byte aligned as required by tuning_cache_db
+    struct aligned_copy
+    {
+        std::vector<uint64_t> storage;
+        size_t size;
+        explicit aligned_copy(const std::vector<uint8_t>& bytes) : storage((bytes.size() + 7) / 8), size(bytes.size())
+        {
+            std::memcpy(storage.data(), bytes.data(), bytes.size());
+        }
+        const void* data() const { return storage.data(); }
+    };
+}
+
+TEST(tuning_cache_db, lookup_hit_and_miss)
+{
+    auto db_data = make_test_db();
+    aligned_copy data(db_data.build());
+    tuning_cache_db db(data.data(), data.size);
+
+    EXPECT_TRUE(db.has_section(24));
+    EXPECT_TRUE(db.has_section(72));
+    EXPECT_FALSE(db.has_section(48));
+
+    EXPECT_EQ(db.find(24, 17), std::make_tuple(std::string("convolution_gpu_bfyx_os_iyx_osv16"), 203));
+    EXPECT_EQ(db.find(24, 0xFFFFFFFFFFFFFFF0ull), std::make_tuple(std::string("convolution_gpu_bfyx_gemm_like"), -1));
+    EXPECT_EQ(db.find(72, 17), std::make_tuple(std::string("convolution_gpu_bfyx_gemm_like"), 2));
+
+    EXPECT_EQ(std::get<0>(db.find(24, 6)), "");
+    EXPECT_EQ(std::get<0>(db.find(72, 5)), "");
+    EXPECT_EQ(std::get<0>(db.find(48, 17)), "");
+}
+
+TEST(tuning_cache_db, rejects_bad_signature_and_version)
+{
+    auto db_data = make_test_db();
+    auto bytes = db_data.build();
+
+    auto bad_magic = bytes;
+    bad_magic[0] = 'X';
+    aligned_copy bad_magic_data(bad_magic);
+    EXPECT_THROW(tuning_cache_db(bad_magic_data.data(), bad_magic_data.size), std::runtime_error);
+
+    auto bad_version = bytes;
+    bad_version[8] = 2;
+    aligned_copy bad_version_data(bad_version);
+    EXPECT_THROW(tuning_cache_db(bad_version_data.data(), bad_version_data.size), std::runtime_error);
+
+    aligned_copy too_short(std::vector<uint8_t>(bytes.begin(), bytes.begin() + 10));
+    EXPECT_THROW(tuning_cache_db(too_short.data(), too_short.size), std::runtime_error);
+}
+
+TEST(tuning_cache_db, rejects_truncated_tables)
+{
+    auto db_data = make_test_db();
+    auto bytes = db_data.build();
+
+    // cut inside sections table, entries table and names blob
+    for (size_t size : { db_data.header_size() + 8, db_data.entries_offset() + 20, bytes.size() - 1 })
+    {
+        aligned_copy truncated(std::vector<uint8_t>(bytes.begin(), bytes.begin() + size));
+        EXPECT_THROW(tuning_cache_db(truncated.data(), truncated.size), std::runtime_error) << "size: " << size;
+    }
+}
+
+TEST(tuning_cache_db, rejects_bad_name_id)
+{
+    auto db_data = make_test_db();
+    db_data.sections[72][17] = { 2, 0 };
+    aligned_copy data(db_data.build());
+    EXPECT_THROW(tuning_cache_db(data.data(), data.size), std::runtime_error);
+}
+
+TEST(tuning_cache_db, rejects_unsorted_data)
+{
+    auto db_data = make_test_db();
+    auto bytes = db_data.build();
+
+    // swap hashes of first two entries of section 24
+    auto unsorted_entries = bytes;
+    const auto first = db_data.entries_offset();
+    std::swap_ranges(unsorted_entries.begin() + first, unsorted_entries.begin() + first + 8, unsorted_entries.begin() + first + 16);
+    aligned_copy unsorted_entries_data(unsorted_entries);
+    EXPECT_THROW(tuning_cache_db(unsorted_entries_data.data(), unsorted_entries_data.size), std::runtime_error);
+
+    // swap compute units of both sections
+    auto unsorted_sections = bytes;
+    std::swap_ranges(unsorted_sections.begin() + 24, unsorted_sections.begin() + 28, unsorted_sections.begin() + 40);
+    aligned_copy unsorted_sections_data(unsorted_sections);
+    EXPECT_THROW(tuning_cache_db(unsorted_sections_data.data(), unsorted_sections_data.size), std::runtime_error);
+}
+
+TEST(tuning_cache_db, offline_cache_sections)
+{
+    auto offline = auto_tuner_offline::get_instance();
+
+    // entry which differs between 18 and 24 compute units sections
+    const std::string hash = "13403161389559730";
+    EXPECT_EQ(offline->find(18, hash), std::make_tuple(std::string("convolution_gpu_bfyx_os_iyx_osv16"), 704));
+    EXPECT_EQ(offline->find(24, hash), std::make_tuple(std::string("convolution_gpu_bfyx_gemm_like"), 2));
+    // 12 compute units is an alias of 18
+    EXPECT_EQ(offline->find(12, hash), std::make_tuple(std::string("convolution_gpu_bfyx_os_iyx_osv16"), 704));
+    // not tuned configuration falls back to 24
+    EXPECT_EQ(offline->find(99, hash), std::make_tuple(std::string("convolution_gpu_bfyx_gemm_like"), 2));
+
+    EXPECT_EQ(std::get<0>(offline->find(24, "1")), "");
+}
+
+TEST(tuning_cache_db, binary_database_in_online_mode)
+{
+    const std::string path = "tuning_cache_db_test.db";
+    {
+        auto db_data = make_test_db();
+        const auto& bytes = db_data.build();
+        std::ofstream file(path, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+    }
+
+    {
+        AutoTuner tuner;
+        EXPECT_EQ(tuner.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, path, 24, "driver", "host", "17"),
+            std::make_tuple(std::string("convolution_gpu_bfyx_os_iyx_osv16"), 203));
+        EXPECT_EQ(std::get<0>(tuner.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, path, 24, "driver", "host", "18")), "");
+    }
+    {
+        AutoTuner tuner;
+        EXPECT_THROW(tuner.LoadKernelOnline(TuningMode::TUNING_USE_CACHE, path, 48, "driver", "host", "17"), std::runtime_error);
+    }
+    {
+        AutoTuner tuner;
+        EXPECT_THROW(tuner.LoadKernelOnline(TuningMode::TUNING_TUNE_AND_CACHE, path, 24, "driver", "host", "17"), std::runtime_error);
+    }
+
+    std::remove(path.c_str());
+}
@@ -23,10 +23,22 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <random>
+
 using namespace cldnn;
 using namespace std;
 using namespace tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 
 
 
@@ -425,4 +437,119 @@ TEST(arg_max_gpu_min_axis_batch, base) {
     {
         EXPECT_EQ(out_buffer[i], i % 2 == 0 ? 0 : 1);
     }
-}
\ No newline at end of file
+}
+
+// Values are drawn from a small integer range, so there are plenty of ties: among equal values the lower index
+// has to come first.
+template<typename data_t>
+void arg_max_min_top_k_random_test(const tensor& in_size, arg_max_min::out_type out_type, uint32_t top_k, arg_max_min::axis_name axis)
+{
+    engine engine;
+
+    memory input = memory::allocate(engine, { type_to_data_type<data_t>::value, format::bfyx, in_size });
+
+    const int batch_num = in_size.batch[0], feature_num = in_size.feature[0];
+    const int y_size = in_size.spatial[1], x_size = in_size.spatial[0];
+
+    std::mt19937 rng(1);
+    std::uniform_int_distribution<int> dist(-50, 50);
+    std::vector<data_t> input_vec(input.count());
+    for (auto& v : input_vec)
+        v = static_cast<data_t>(static_cast<float>(dist(rng)));
+    set_values(input, input_vec);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(arg_max_min("arg_max", "input", out_type, top_k, axis));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto output = network.execute().at("arg_max").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    // reduced sets in output order: (b) for xyf, (b, y, x) for feature axis
+    const bool feature_axis = axis == arg_max_min::feature;
+    const int values_num = feature_axis ? feature_num : feature_num * y_size * x_size;
+    const int value_pitch = feature_axis ? y_size * x_size : 1;
+    const int sets_num = batch_num * feature_num * y_size * x_size / values_num;
+
+    for (int set = 0; set < sets_num; ++set)
+    {
+        const int offset = feature_axis ? (set / (y_size * x_size)) * feature_num * y_size * x_size + set % (y_size * x_size)
+                                        : set * values_num;
+
+        std::vector<int> order(values_num);
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), [&](int a, int b) {
+            const float val_a = static_cast<float>(input_vec[offset + a * value_pitch]);
+            const float val_b = static_cast<float>(input_vec[offset + b * value_pitch]);
+            return out_type == arg_max_min::max ? val_a > val_b : val_a < val_b;
+        });
+
+        for (uint32_t k = 0; k < top_k; ++k)
+        {
+            ASSERT_EQ(output_ptr[set * top_k + k], static_cast<float>(order[k])) << "set=" << set << " k=" << k;
+        }
+    }
+}
+
+TEST(arg_max_gpu_top_k, random_xyf_k200) {
+    arg_max_min_top_k_random_test<float>({ 2, 10, 10, 10 }, arg_max_min::max, 200, arg_max_min::xyf);
+}
+
+TEST(arg_max_gpu_top_k, random_xyf_min_k64) {
+    arg_max_min_top_k_random_test<float>({ 3, 7, 11, 13 }, arg_max_min::min, 64, arg_max_min::xyf);
+}
+
+TEST(arg_max_gpu_top_k, random_xyf_merge_chunks_k500) {
+    // more values than fit the local memory - the best pairs are merged with the following chunks
+    arg_max_min_top_k_random_test<float>({ 2, 100, 30, 20 }, arg_max_min::max, 500, arg_max_min::xyf);
+}
+
+TEST(arg_max_gpu_top_k, random_feature_axis_k32) {
+    arg_max_min_top_k_random_test<float>({ 2, 3000, 3, 2 }, arg_max_min::max, 32, arg_max_min::feature);
+}
+
+TEST(arg_max_gpu_top_k, random_xyf_k100_f16) {
+    arg_max_min_top_k_random_test<FLOAT16>({ 2, 8, 25, 20 }, arg_max_min::max, 100, arg_max_min::xyf);
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=arg_max_gpu_top_k.DISABLED_time_report
+TEST(arg_max_gpu_top_k, DISABLED_time_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        tensor in_size;
+        uint32_t top_k;
+    };
+    const std::vector<report_case> cases = {
+        { { 1, 1000, 1, 1 },    1 },
+        { { 1, 1000, 1, 1 },    16 },
+        { { 1, 1000, 1, 1 },    200 },
+        { { 8, 21000, 1, 1 },   16 },
+        { { 8, 21000, 1, 1 },   200 },
+        { { 1, 100000, 1, 1 },  200 },
+        { { 1, 100000, 1, 1 },  1000 },
+    };
+
+    std::cout << std::setw(10) << "batch" << std::setw(10) << "values" << std::setw(10) << "K" << std::setw(10) << "ms" << std::endl;
+    for (const auto& c : cases) {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, c.in_size });
+        set_random_values<float>(input);
+        topology topology(
+            input_layout("input", input.get_layout()),
+            arg_max_min("arg_max", "input", arg_max_min::max, c.top_k));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        network.execute().at("arg_max").get_event().wait();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("arg_max").get_event().wait();
+        const auto ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        std::cout << std::setw(10) << c.in_size.batch[0] << std::setw(10) << c.in_size.count() / c.in_size.batch[0]
+                  << std::setw(10) << c.top_k << std::fixed << std::setprecision(3) << std::setw(10) << ms << std::endl;
+    }
+}
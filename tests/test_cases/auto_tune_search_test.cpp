@@ -0,0 +1,133 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// On-line tuning benchmark: pruned search vs exhaustive search.
+//
+// Each convolution of the benchmark set is tuned from scratch (empty tuning file) in both modes. Reported are
+// the tuning time (network build time) and the execution time of the tuned network. Tests are disabled by default:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=*auto_tune_search*
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/data.hpp>
+
+#include "test_utils/test_utils.h"
+
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    struct conv_case
+    {
+        std::string name;
+        tensor input_size;
+        tensor weights_size;
+        tensor stride;
+    };
+
+    struct tuning_result
+    {
+        double tuning_ms;
+        double execution_us;
+    };
+
+    tuning_result tune_and_run(const engine& engine, const conv_case& test_case, bool exhaustive)
+    {
+        const std::string cache_file = "auto_tune_search_" + test_case.name + (exhaustive ? "_exhaustive" : "_pruned") + ".txt";
+        std::remove(cache_file.c_str());
+
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, test_case.input_size });
+        auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, test_case.weights_size });
+        auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, test_case.weights_size.batch[0], 1 } });
+        tests::set_random_values<float>(input);
+        tests::set_random_values<float>(weights);
+        tests::set_random_values<float>(biases);
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            data("weights", weights),
+            data("biases", biases),
+            convolution("conv", "input", { "weights" }, { "biases" }, test_case.stride));
+
+        tuning_config_options tuning_config;
+        tuning_config.mode = tuning_mode::tuning_tune_and_cache;
+        tuning_config.cache_file_path = cache_file;
+        tuning_config.exhaustive_search = exhaustive;
+
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        options.set_option(build_option::tuning_config(tuning_config));
+
+        using clock = std::chrono::high_resolution_clock;
+        auto build_start = clock::now();
+        network network(engine, topology, options);
+        const auto tuning_time = clock::now() - build_start;
+
+        network.set_input_data("input", input);
+        network.execute().at("conv").get_memory().pointer<float>();
+
+        const int iterations = 20;
+        auto execution_start = clock::now();
+        for (int i = 0; i < iterations; i++)
+            network.execute().at("conv").get_event().wait();
+        const auto execution_time = clock::now() - execution_start;
+
+        std::remove(cache_file.c_str());
+        return { std::chrono::duration<double, std::milli>(tuning_time).count(),
+                 std::chrono::duration<double, std::micro>(execution_time).count() / iterations };
+    }
+}
+
+TEST(auto_tune_search, DISABLED_pruned_vs_exhaustive)
+{
+    // kernel runner measures kernels with profiling events
+    engine engine(engine_configuration(true));
+
+    const std::vector<conv_case> benchmark_set = {
+        { "3x3_64_56x56",   { 1, 64, 56, 56 },  { 64, 64, 3, 3 },   { 1, 1, 1, 1 } },
+        { "1x1_256_28x28",  { 1, 256, 28, 28 }, { 128, 256, 1, 1 }, { 1, 1, 1, 1 } },
+        { "3x3_256_14x14",  { 1, 256, 14, 14 }, { 256, 256, 3, 3 }, { 1, 1, 1, 1 } },
+        { "7x7_3_224x224",  { 1, 3, 224, 224 }, { 64, 3, 7, 7 },    { 1, 1, 2, 2 } },
+    };
+
+    std::cout << std::setw(16) << "layer"
+              << std::setw(18) << "exhaustive ms" << std::setw(18) << "exhaustive us"
+              << std::setw(14) << "pruned ms" << std::setw(14) << "pruned us"
+              << std::setw(16) << "tuning speedup" << std::setw(14) << "exec ratio" << std::endl;
+    for (const auto& test_case : benchmark_set)
+    {
+        const auto exhaustive = tune_and_run(engine, test_case, true);
+        const auto pruned = tune_and_run(engine, test_case, false);
+        std::cout << std::setw(16) << test_case.name << std::fixed << std::setprecision(1)
+                  << std::setw(18) << exhaustive.tuning_ms << std::setw(18) << exhaustive.execution_us
+                  << std::setw(14) << pruned.tuning_ms << std::setw(14) << pruned.execution_us
+                  << std::setw(16) << exhaustive.tuning_ms / pruned.tuning_ms
+                  << std::setw(14) << std::setprecision(3) << pruned.execution_us / exhaustive.execution_us << std::endl;
+    }
+}
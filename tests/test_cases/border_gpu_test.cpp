@@ -18,14 +18,19 @@
 #include <api/CPP/engine.hpp>
 #include <api/CPP/input_layout.hpp>
 #include <api/CPP/memory.hpp>
+#include <api/CPP/activation.hpp>
 #include <api/CPP/border.hpp>
+#include <api/CPP/crop.hpp>
 #include <api/CPP/topology.hpp>
 #include <api/CPP/network.hpp>
 
 #include "test_utils/test_utils.h"
 #include "test_utils/uniform_quantized_real_distribution.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <iomanip>
+#include <sstream>
 
 
 using namespace cldnn;
@@ -700,3 +705,240 @@ TEST(border_gpu, basic_bfyx_2x1x2x3_1x2x3x4_border_edge) {
         }
     }
 }
+
+// Host reference of border for bfyx buffers: returns input offset of output element or -1 for constant border.
+static int border_ref_input_offset(const tensor& in_size, const tensor& lt, border_type type, int b, int f, int y, int x)
+{
+    const int out_c[4] = { b, f, y, x };
+    const int lt_c[4] = { lt.batch[0], lt.feature[0], lt.spatial[1], lt.spatial[0] };
+    const int in_c[4] = { in_size.batch[0], in_size.feature[0], in_size.spatial[1], in_size.spatial[0] };
+
+    int offset = 0;
+    for (int d = 0; d < 4; ++d)
+    {
+        const int in_l = in_c[d] + lt_c[d];
+        int c = out_c[d] - lt_c[d];
+        if (out_c[d] < lt_c[d] || out_c[d] >= in_l)
+        {
+            switch (type)
+            {
+            case border_type::constant:   return -1;
+            case border_type::edge:       c = out_c[d] < lt_c[d] ? 0 : in_c[d] - 1; break;
+            case border_type::mirror:     c = out_c[d] < lt_c[d] ? lt_c[d] - 1 - out_c[d] : in_c[d] + in_l - 1 - out_c[d]; break;
+            case border_type::mirror_101: c = out_c[d] < lt_c[d] ? lt_c[d] - out_c[d] : in_c[d] + in_l - 2 - out_c[d]; break;
+            default: break;
+            }
+        }
+        offset = offset * in_c[d] + c;
+    }
+    return offset;
+}
+
+static void border_bfyx_random_test(const tensor& in_size, const tensor& lt, const tensor& rb, border_type type, float border_value = 0.0f)
+{
+    engine engine;
+    const auto out_size = in_size.add(lt).add(rb);
+    auto input = memory::allocate(engine, {data_types::f32, format::bfyx, in_size});
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout())
+    );
+    topology.add(
+        border("output", "input", lt, rb, type, border_value)
+    );
+
+    std::vector<float> input_data = generate_rnd_real_input<float>(in_size.batch[0], in_size.feature[0], in_size.spatial[1], in_size.spatial[0], -8.0f, 8.0f);
+    set_values(input, input_data);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (auto b = 0; b < out_size.batch[0]; ++b) {
+        for (auto f = 0; f < out_size.feature[0]; ++f) {
+            for (auto y = 0; y < out_size.spatial[1]; ++y) {
+                for (auto x = 0; x < out_size.spatial[0]; ++x) {
+                    auto output_off = ((b * out_size.feature[0] + f) * out_size.spatial[1] + y) * out_size.spatial[0] + x; // BFYX
+                    auto input_off = border_ref_input_offset(in_size, lt, type, b, f, y, x);
+
+                    ASSERT_EQ(output_ptr[output_off], input_off < 0 ? border_value : input_data[input_off])
+                        << "b=" << b << " f=" << f << " y=" << y << " x=" << x;
+                }
+            }
+        }
+    }
+}
+
+TEST(border_gpu, bfyx_wide_rows_border_constant_non_zero) {
+    border_bfyx_random_test({2, 3, 37, 5}, {1, 0, 3, 2}, {0, 2, 5, 1}, border_type::constant, 2.5f);
+}
+
+TEST(border_gpu, bfyx_wide_rows_border_edge) {
+    border_bfyx_random_test({2, 3, 29, 4}, {1, 1, 9, 2}, {1, 0, 6, 3}, border_type::edge);
+}
+
+TEST(border_gpu, bfyx_wide_rows_border_mirror) {
+    border_bfyx_random_test({1, 4, 40, 6}, {0, 2, 8, 3}, {1, 1, 11, 2}, border_type::mirror);
+}
+
+TEST(border_gpu, bfyx_wide_rows_border_mirror_101) {
+    border_bfyx_random_test({2, 2, 19, 7}, {1, 1, 4, 3}, {0, 1, 7, 6}, border_type::mirror_101);
+}
+
+// Zero constant x/y border after a primitive which writes through the padded layout is optimized out: the producer
+// writes into the interior of the border buffer and its zero padding forms the border.
+static void border_in_place_test(const tensor& lt, const tensor& rb, float border_value, bool expect_optimized)
+{
+    const tensor in_size(2, 3, 13, 5);
+    const auto out_size = in_size.add(lt).add(rb);
+
+    engine engine;
+    auto input = memory::allocate(engine, {data_types::f32, format::bfyx, in_size});
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout()),
+        activation("relu", "input", activation_relu),
+        border("border", "relu", lt, rb, border_type::constant, border_value),
+        activation("output", "border", activation_linear, {1.0f, 0.0f})
+    );
+
+    std::vector<float> input_data = generate_rnd_real_input<float>(in_size.batch[0], in_size.feature[0], in_size.spatial[1], in_size.spatial[0], -8.0f, 8.0f);
+    set_values(input, input_data);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    const size_t border_bytes = out_size.count() * sizeof(float);
+    if (expect_optimized)
+        EXPECT_GE(network.get_eliminated_copy_bytes(), border_bytes);
+    else
+        EXPECT_LT(network.get_eliminated_copy_bytes(), border_bytes);
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (auto b = 0; b < out_size.batch[0]; ++b) {
+        for (auto f = 0; f < out_size.feature[0]; ++f) {
+            for (auto y = 0; y < out_size.spatial[1]; ++y) {
+                for (auto x = 0; x < out_size.spatial[0]; ++x) {
+                    auto output_off = ((b * out_size.feature[0] + f) * out_size.spatial[1] + y) * out_size.spatial[0] + x; // BFYX
+                    auto input_off = border_ref_input_offset(in_size, lt, border_type::constant, b, f, y, x);
+                    auto expected = input_off < 0 ? border_value : std::max(input_data[input_off], 0.0f);
+
+                    ASSERT_EQ(output_ptr[output_off], expected) << "b=" << b << " f=" << f << " y=" << y << " x=" << x;
+                }
+            }
+        }
+    }
+}
+
+TEST(border_gpu, bfyx_zero_constant_border_in_place) {
+    border_in_place_test({0, 0, 2, 3}, {0, 0, 4, 1}, 0.0f, true);
+}
+
+TEST(border_gpu, bfyx_non_zero_constant_border_not_in_place) {
+    border_in_place_test({0, 0, 2, 3}, {0, 0, 4, 1}, 1.0f, false);
+}
+
+TEST(border_gpu, bfyx_zero_constant_batch_feature_border_not_in_place) {
+    border_in_place_test({0, 1, 2, 3}, {1, 0, 4, 1}, 0.0f, false);
+}
+
+// Feature border of a producer which gets a buffer from the padded pool: the buffer was used before by a tensor with
+// more features and the same padding, so padding of the smaller layout overlaps its data. Border has to stay zero.
+TEST(border_gpu, bfyx_zero_constant_feature_border_after_reused_buffer) {
+    const tensor big_size(1, 8, 4, 4);
+    const tensor small_size(1, 4, 4, 4);
+    const tensor f_border(0, 1, 0, 0);
+    const auto out_size = small_size.add(f_border).add(f_border);
+
+    engine engine;
+    auto input = memory::allocate(engine, {data_types::f32, format::bfyx, big_size});
+
+    // big -> relu -> in-place crop of first 4 features -> small -> border
+    // big is dead when small is allocated, so small can get its padded buffer
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout()),
+        activation("big", "input", activation_relu, {0.f, 0.f}, padding(f_border.sizes(), f_border.sizes())),
+        activation("relu", "big", activation_relu),
+        crop("crop", "relu", small_size, {0, 0, 0, 0}),
+        activation("small", "crop", activation_relu),
+        border("border", "small", f_border, f_border, border_type::constant, 0.0f),
+        activation("output", "border", activation_linear, {1.0f, 0.0f})
+    );
+
+    std::vector<float> input_data = generate_rnd_real_input<float>(big_size.batch[0], big_size.feature[0], big_size.spatial[1], big_size.spatial[0], 1.0f, 8.0f);
+    set_values(input, input_data);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    for (auto f = 0; f < out_size.feature[0]; ++f) {
+        for (auto y = 0; y < out_size.spatial[1]; ++y) {
+            for (auto x = 0; x < out_size.spatial[0]; ++x) {
+                auto output_off = (f * out_size.spatial[1] + y) * out_size.spatial[0] + x;
+                auto input_off = ((f - 1) * big_size.spatial[1] + y) * big_size.spatial[0] + x;
+                auto expected = (f == 0 || f == out_size.feature[0] - 1) ? 0.0f : input_data[input_off];
+
+                ASSERT_EQ(output_ptr[output_off], expected) << "f=" << f << " y=" << y << " x=" << x;
+            }
+        }
+    }
+}
+
+// Times relu -> border -> relu chain: zero border is written in place by the producer, other ones run the border kernel.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=border_gpu.DISABLED_time_report
+TEST(border_gpu, DISABLED_time_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        std::string name;
+        border_type type;
+        float value;
+    };
+    const std::vector<report_case> cases = {
+        { "constant 0",     border_type::constant,      0.0f },
+        { "constant 1",     border_type::constant,      1.0f },
+        { "edge",           border_type::edge,          0.0f },
+        { "mirror",         border_type::mirror,        0.0f },
+        { "mirror_101",     border_type::mirror_101,    0.0f },
+    };
+    const tensor in_size(8, 64, 56, 56);
+    const tensor lt(0, 0, 3, 3);
+    const tensor rb(0, 0, 3, 3);
+
+    std::cout << std::setw(20) << "border" << std::setw(20) << "input" << std::setw(10) << "ms" << std::endl;
+    for (const auto& c : cases) {
+        auto input = memory::allocate(engine, {data_types::f32, format::bfyx, in_size});
+        topology topology(
+            input_layout("input", input.get_layout()),
+            activation("relu", "input", activation_relu),
+            border("border", "relu", lt, rb, c.type, c.value),
+            activation("output", "border", activation_relu));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        network.execute();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("output").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        std::stringstream size_str;
+        size_str << in_size.batch[0] << "x" << in_size.feature[0] << "x" << in_size.spatial[1] << "x" << in_size.spatial[0];
+        std::cout << std::setw(20) << c.name << std::setw(20) << size_str.str() << std::fixed << std::setprecision(3)
+                  << std::setw(10) << seconds * 1e3 << std::endl;
+    }
+}
@@ -25,12 +25,20 @@
 #include "test_utils/test_utils.h"
 #include "test_utils/uniform_quantized_real_distribution.hpp"
 
+#include <chrono>
 #include <cstddef>
+#include <iomanip>
+#include <sstream>
 
 
 using namespace cldnn;
 using namespace ::tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 
 template<typename T>
 static std::vector<T> generate_rnd_real_input(
@@ -466,3 +474,111 @@ TEST(broadcast_gpu, basic_error_on_nondiv_bc_size) {
     EXPECT_ANY_THROW(network(engine, topology));
 }
 
+// Checks bfyx broadcast with random data against the reference computed on host; sizes are chosen to cover
+// whole and partial vectors of the output rows.
+template<typename T>
+static void broadcast_bfyx_random_test(const tensor& in_size, const tensor& out_size)
+{
+    engine engine;
+    if (type_to_data_type<T>::value == data_types::f16 && !engine.get_info().supports_fp16)
+        return;
+
+    const auto in_b = in_size.batch[0], in_f = in_size.feature[0], in_y = in_size.spatial[1], in_x = in_size.spatial[0];
+    const auto out_b = out_size.batch[0], out_f = out_size.feature[0], out_y = out_size.spatial[1], out_x = out_size.spatial[0];
+
+    memory input = memory::allocate(engine, {type_to_data_type<T>::value, format::bfyx, in_size});
+
+    topology topology;
+    topology.add(
+        input_layout("input", input.get_layout())
+    );
+    topology.add(
+        broadcast("output", "input", out_size)
+    );
+
+    std::vector<float> rnd_data = generate_rnd_real_input<float>(in_b, in_f, in_y, in_x, -8.0f, 8.0f);
+    std::vector<T> input_data(rnd_data.begin(), rnd_data.end());
+    set_values(input, input_data);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto outputs = network.execute();
+
+    auto output = outputs.at("output").get_memory();
+    auto output_ptr = output.pointer<T>();
+
+    for (auto b = 0; b < out_b; ++b) {
+        for (auto f = 0; f < out_f; ++f) {
+            for (auto y = 0; y < out_y; ++y) {
+                for (auto x = 0; x < out_x; ++x) {
+                    auto output_off = ((b * out_f + f) * out_y + y) * out_x + x; // BFYX
+                    auto input_off  = (((b % in_b) * in_f + f % in_f) * in_y + y % in_y) * in_x + x % in_x; // BFYX
+
+                    ASSERT_EQ(static_cast<float>(output_ptr[output_off]), static_cast<float>(input_data[input_off]))
+                        << "b=" << b << " f=" << f << " y=" << y << " x=" << x;
+                }
+            }
+        }
+    }
+}
+
+TEST(broadcast_gpu, bfyx_single_x_splat_to_odd_row) {
+    broadcast_bfyx_random_test<float>({2, 3, 1, 4}, {2, 3, 21, 4});
+}
+
+TEST(broadcast_gpu, bfyx_row_copy_with_tail) {
+    broadcast_bfyx_random_test<float>({1, 2, 13, 3}, {4, 6, 13, 9});
+}
+
+TEST(broadcast_gpu, bfyx_row_repeat_along_x) {
+    broadcast_bfyx_random_test<float>({2, 2, 3, 2}, {2, 2, 27, 4});
+}
+
+TEST(broadcast_gpu, bfyx_row_repeat_along_x_f16) {
+    broadcast_bfyx_random_test<FLOAT16>({1, 3, 5, 2}, {2, 3, 45, 2});
+}
+
+TEST(broadcast_gpu, bfyx_single_x_splat_f16) {
+    broadcast_bfyx_random_test<FLOAT16>({1, 16, 1, 1}, {2, 16, 64, 8});
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=broadcast_gpu.DISABLED_bandwidth_report
+TEST(broadcast_gpu, DISABLED_bandwidth_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        std::string name;
+        tensor in_size;
+        tensor out_size;
+    };
+    const std::vector<report_case> cases = {
+        { "per-channel bias",   {1, 256, 1, 1},     {8, 256, 56, 56} },
+        { "row",                {1, 1, 56, 1},      {8, 256, 56, 56} },
+        { "batch",              {1, 256, 56, 56},   {8, 256, 56, 56} },
+        { "x repeat",           {8, 64, 7, 56},     {8, 64, 56, 56} },
+    };
+
+    std::cout << std::setw(20) << "broadcast" << std::setw(20) << "output" << std::setw(10) << "GB/s" << std::endl;
+    for (const auto& c : cases) {
+        auto input = memory::allocate(engine, {data_types::f32, format::bfyx, c.in_size});
+        topology topology(
+            input_layout("input", input.get_layout()),
+            broadcast("output", "input", c.out_size));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto output = network.execute().at("output").get_memory();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("output").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        const double bandwidth = (input.get_layout().bytes_count() + output.get_layout().bytes_count()) / seconds * 1e-9;
+
+        std::stringstream size_str;
+        size_str << c.out_size.batch[0] << "x" << c.out_size.feature[0] << "x" << c.out_size.spatial[1] << "x" << c.out_size.spatial[0];
+        std::cout << std::setw(20) << c.name << std::setw(20) << size_str.str() << std::fixed << std::setprecision(1)
+                  << std::setw(10) << bandwidth << std::endl;
+    }
+}
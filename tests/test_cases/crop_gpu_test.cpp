@@ -19,10 +19,13 @@
 #include "api/CPP/memory.hpp"
 #include <api/CPP/input_layout.hpp>
 #include "api/CPP/crop.hpp"
+#include "api/CPP/concatenation.hpp"
+#include "api/CPP/pooling.hpp"
 #include <api/CPP/topology.hpp>
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
+#include "float16.h"
 
 using namespace cldnn;
 using namespace tests;
@@ -407,3 +410,112 @@ TEST(crop_gpu, basic_in1x4x1x1_split_w_relu) {
         EXPECT_EQ(output_ptr_2[i], out2[i]);
 }
 
+
+TEST(crop_gpu, in_place_crop_spatial_of_padded_input) {
+    //  INPUT(1x2x4x2)--RELU--CONCAT(along x)--CROP(1x2x3x2,offset(0x0x4x0))--POOLING(1x1)
+    //  INPUT2(1x2x4x2)--RELU_/
+    //
+    //  Crop along x is done in place in the buffer of in-place concatenation, so its padding includes
+    //  padding of its (concatenation input) input.
+    engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled,  throttle_mode_types::disabled, false /*mem_pool*/ };
+    engine engine{ cfg };
+
+    auto input1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 2 } });
+    auto input2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 4, 2 } });
+    set_values(input1, { 1.f, -2.f, 3.f, -4.f, 5.f, -6.f, 7.f, -8.f,
+                         9.f, -10.f, 11.f, -12.f, 13.f, -14.f, 15.f, -16.f });
+    set_values(input2, { -17.f, 18.f, -19.f, 20.f, -21.f, 22.f, -23.f, 24.f,
+                         -25.f, 26.f, -27.f, 28.f, -29.f, 30.f, -31.f, 32.f });
+
+    topology topology;
+    topology.add(input_layout("input1", input1.get_layout()));
+    topology.add(input_layout("input2", input2.get_layout()));
+    topology.add(activation("relu1", "input1", activation_relu));
+    topology.add(activation("relu2", "input2", activation_relu));
+    topology.add(concatenation("concat", { "relu1", "relu2" }, concatenation::along_x));
+    topology.add(crop("crop", "concat", { 1, 2, 3, 2 }, { 0, 0, 4, 0 }));
+    topology.add(pooling("out", "crop", pooling_mode::max, { 1, 1, 1, 1 }, { 1, 1, 1, 1 }));
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    bo.set_option(build_option::outputs({ "relu2", "crop", "out" }));
+    bo.set_option(build_option::debug(true)); //required to have optimized crop and concatenation despite the fact that they are specified as outputs
+
+    network network(engine, topology, bo);
+    network.set_input_data("input1", input1);
+    network.set_input_data("input2", input2);
+    auto outputs = network.execute();
+
+    // check if crop has been executed in place
+    EXPECT_TRUE(outputs.at("crop").get_memory().is_the_same_buffer(outputs.at("relu2").get_memory()));
+
+    std::vector<float> expected = { 0.f, 18.f, 0.f, 0.f, 22.f, 0.f,
+                                    0.f, 26.f, 0.f, 0.f, 30.f, 0.f };
+    auto output = outputs.at("out").get_memory();
+    auto output_ptr = output.pointer<float>();
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_EQ(output_ptr[i], expected[i]);
+}
+
+namespace
+{
+    // crop of in-place concatenation along x is done in place as well, outputs are compared with the unoptimized network
+    template <typename T>
+    void test_in_place_crop_of_concatenation(data_types dt, format fmt)
+    {
+        engine_configuration cfg{ false, false, false, std::string(), std::string(), true /*oooq*/, std::string(),std::string(), priority_mode_types::disabled,  throttle_mode_types::disabled, false /*mem_pool*/ };
+        engine engine{ cfg };
+        if (dt == data_types::f16 && !engine.get_info().supports_fp16)
+        {
+            std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+            EXPECT_EQ(1, 1);
+            return;
+        }
+
+        auto input1 = memory::allocate(engine, { dt, fmt, { 2, 3, 4, 2 } });
+        auto input2 = memory::allocate(engine, { dt, fmt, { 2, 3, 4, 2 } });
+        tests::set_random_values<T>(input1, true);
+        tests::set_random_values<T>(input2, true);
+
+        topology topology;
+        topology.add(input_layout("input1", input1.get_layout()));
+        topology.add(input_layout("input2", input2.get_layout()));
+        topology.add(activation("relu1", "input1", activation_relu));
+        topology.add(activation("relu2", "input2", activation_relu));
+        topology.add(concatenation("concat", { "relu1", "relu2" }, concatenation::along_x));
+        topology.add(crop("crop", "concat", { 2, 3, 3, 2 }, { 0, 0, 4, 0 }));
+        topology.add(pooling("out", "crop", pooling_mode::max, { 1, 1, 1, 1 }, { 1, 1, 1, 1 }));
+
+        std::vector<T> results[2];
+        for (int optimize = 0; optimize < 2; optimize++)
+        {
+            build_options bo;
+            bo.set_option(build_option::optimize_data(optimize != 0));
+            bo.set_option(build_option::outputs({ "relu2", "crop", "out" }));
+            bo.set_option(build_option::debug(true)); //required to have optimized crop and concatenation despite the fact that they are specified as outputs
+
+            network network(engine, topology, bo);
+            network.set_input_data("input1", input1);
+            network.set_input_data("input2", input2);
+            auto outputs = network.execute();
+
+            if (optimize != 0)
+                EXPECT_TRUE(outputs.at("crop").get_memory().is_the_same_buffer(outputs.at("relu2").get_memory()));
+
+            auto output_ptr = outputs.at("out").get_memory().pointer<T>();
+            results[optimize].assign(output_ptr.begin(), output_ptr.end());
+        }
+
+        ASSERT_EQ(results[0].size(), results[1].size());
+        for (size_t i = 0; i < results[0].size(); i++)
+            EXPECT_EQ(static_cast<float>(results[0][i]), static_cast<float>(results[1][i])) << "i = " << i;
+    }
+}
+
+TEST(crop_gpu, in_place_crop_spatial_of_padded_input_yxfb) {
+    test_in_place_crop_of_concatenation<float>(data_types::f32, format::yxfb);
+}
+
+TEST(crop_gpu, in_place_crop_spatial_of_padded_input_fp16) {
+    test_in_place_crop_of_concatenation<FLOAT16>(data_types::f16, format::bfyx);
+}
@@ -27,11 +27,18 @@
 #include "test_utils/test_utils.h"
 #include "test_utils/float16.h"
 #include "api/CPP/reorder.hpp"
+#include <chrono>
+#include <iomanip>
 
 
 using namespace cldnn;
 using namespace tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 TEST(deconvolution_f32_fw_gpu, basic_wsiz2x2_in2x2x1x1_nopad) {
     //  Filter : 2x2
     //  Input  : 2x2
@@ -1152,4 +1159,165 @@ TEST(deconvolution_f32_fw_gpu, basic_wsiz2x2_in1x6x1x1_bfyx_stride2_pad1_split2_
     {
         EXPECT_FLOAT_EQ(expected_output_vec[i], output_ptr[i]);
     }
-}
\ No newline at end of file
+}
+
+// Compares bfyx deconvolution with optimized data against a scatter-style reference computed on the host;
+// strided cases select the stride phase kernel.
+template <typename T>
+void deconvolution_random_test(int batch, int ifm, int ofm, int in_x, int in_y, int filter, int stride, int pad, int split = 1)
+{
+    engine engine;
+
+    const int out_x = stride * (in_x - 1) + filter - 2 * pad;
+    const int out_y = stride * (in_y - 1) + filter - 2 * pad;
+    const int split_ifm = ifm / split;
+    const int split_ofm = ofm / split;
+
+    auto input = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { batch, ifm, in_x, in_y } });
+    auto input_data = generate_random_1d<float>(input.get_layout().count(), -2, 2);
+    set_values(input, std::vector<T>(input_data.begin(), input_data.end()));
+
+    topology topology(input_layout("input", input.get_layout()));
+
+    std::vector<std::vector<float>> weights_data(split);
+    std::vector<std::vector<float>> biases_data(split);
+    std::vector<primitive_id> weights_ids;
+    std::vector<primitive_id> biases_ids;
+    for (int s = 0; s < split; ++s)
+    {
+        memory weights = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { split_ofm, split_ifm, filter, filter } });
+        memory biases = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { 1, 1, split_ofm, 1 } });
+        weights_data[s] = generate_random_1d<float>(weights.get_layout().count(), -1, 1);
+        biases_data[s] = generate_random_1d<float>(biases.get_layout().count(), -1, 1);
+        set_values(weights, std::vector<T>(weights_data[s].begin(), weights_data[s].end()));
+        set_values(biases, std::vector<T>(biases_data[s].begin(), biases_data[s].end()));
+
+        weights_ids.push_back("weights" + std::to_string(s));
+        biases_ids.push_back("biases" + std::to_string(s));
+        topology.add(data(weights_ids.back(), weights), data(biases_ids.back(), biases));
+    }
+    topology.add(deconvolution("deconv", "input", weights_ids, biases_ids, { 1, 1, stride, stride }, { 0, 0, -pad, -pad }));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    auto output = outputs.at("deconv").get_memory();
+    ASSERT_EQ(output.get_layout().size, tensor(batch, ofm, out_x, out_y));
+    auto output_ptr = output.pointer<T>();
+
+    std::vector<float> expected(output.get_layout().count(), 0.f);
+    for (int b = 0; b < batch; ++b)
+    for (int s = 0; s < split; ++s)
+    for (int o = 0; o < split_ofm; ++o)
+    {
+        float* out_plane = &expected[((b * ofm) + s * split_ofm + o) * out_y * out_x];
+        for (int i = 0; i < split_ifm; ++i)
+        for (int iy = 0; iy < in_y; ++iy)
+        for (int ix = 0; ix < in_x; ++ix)
+        for (int ky = 0; ky < filter; ++ky)
+        for (int kx = 0; kx < filter; ++kx)
+        {
+            const int y = iy * stride - pad + ky;
+            const int x = ix * stride - pad + kx;
+            if (y < 0 || y >= out_y || x < 0 || x >= out_x)
+                continue;
+            const float in_val = input_data[(((b * ifm) + s * split_ifm + i) * in_y + iy) * in_x + ix];
+            out_plane[y * out_x + x] += in_val * weights_data[s][((o * split_ifm + i) * filter + ky) * filter + kx];
+        }
+        for (int i = 0; i < out_y * out_x; ++i)
+            out_plane[i] += biases_data[s][o];
+    }
+
+    const bool fp16 = type_to_data_type<T>::value == data_types::f16;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        const float tolerance = fp16 ? 0.02f * std::abs(expected[i]) + 0.05f : 1e-4f * std::abs(expected[i]) + 1e-4f;
+        ASSERT_NEAR(expected[i], static_cast<float>(output_ptr[i]), tolerance) << "at index " << i;
+    }
+}
+
+TEST(deconvolution_f32_fw_gpu, random_bfyx_stride2_pad1_filter4)
+{
+    deconvolution_random_test<float>(2, 5, 16, 7, 5, 4, 2, 1);
+}
+
+TEST(deconvolution_f32_fw_gpu, random_bfyx_stride3_filter3_odd_ofm)
+{
+    deconvolution_random_test<float>(1, 4, 3, 9, 6, 3, 3, 0);
+}
+
+TEST(deconvolution_f32_fw_gpu, random_bfyx_stride2_filter3_pad1_split2)
+{
+    deconvolution_random_test<float>(1, 6, 8, 11, 4, 3, 2, 1, 2);
+}
+
+TEST(deconvolution_f32_fw_gpu, random_bfyx_stride1_filter3_pad1)
+{
+    deconvolution_random_test<float>(1, 8, 12, 13, 9, 3, 1, 1);
+}
+
+TEST(deconvolution_f16_fw_gpu, random_bfyx_stride2_pad1_filter4)
+{
+    deconvolution_random_test<FLOAT16>(2, 8, 16, 10, 6, 4, 2, 1);
+}
+
+// FCN / decoder style upsampling layers: 2x and 8x learned upsampling.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=deconvolution_f32_fw_gpu.DISABLED_upsampling_report
+TEST(deconvolution_f32_fw_gpu, DISABLED_upsampling_report)
+{
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        int ifm;
+        int ofm;
+        int in_size;
+        int filter;
+        int stride;
+        int pad;
+    };
+    const std::vector<report_case> cases = {
+        { 21,   21, 16,  4,  2, 1 },
+        { 21,   21, 64,  16, 8, 4 },
+        { 256,  128, 32, 4,  2, 1 },
+        { 128,  64, 64,  4,  2, 1 },
+        { 64,   3,  128, 4,  2, 1 },
+    };
+
+    std::cout << std::setw(6) << "ifm" << std::setw(6) << "ofm" << std::setw(6) << "in" << std::setw(8) << "filter"
+              << std::setw(8) << "stride" << std::setw(12) << "time [ms]" << std::setw(10) << "GFLOP/s" << std::endl;
+    for (const auto& c : cases) {
+        const int out_size = c.stride * (c.in_size - 1) + c.filter - 2 * c.pad;
+
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, c.ifm, c.in_size, c.in_size } });
+        auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { c.ofm, c.ifm, c.filter, c.filter } });
+        set_random_values<float>(input);
+        set_random_values<float>(weights);
+
+        topology topo(
+            input_layout("input", input.get_layout()),
+            data("weights", weights),
+            deconvolution("deconv", "input", { "weights" }, { 1, 1, c.stride, c.stride }, { 0, 0, -c.pad, -c.pad }));
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        network net(engine, topo, options);
+        net.set_input_data("input", input);
+        net.execute().at("deconv").get_event().wait();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            net.execute().at("deconv").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        // useful work only: each output is reached by (filter / stride)^2 taps
+        const double taps = static_cast<double>(c.filter) * c.filter / (c.stride * c.stride);
+        const double flops = 2.0 * out_size * out_size * c.ofm * c.ifm * taps;
+
+        std::cout << std::setw(6) << c.ifm << std::setw(6) << c.ofm << std::setw(6) << c.in_size << std::setw(8) << c.filter
+                  << std::setw(8) << c.stride << std::fixed << std::setprecision(3) << std::setw(12) << seconds * 1e3
+                  << std::setprecision(2) << std::setw(10) << flops / seconds * 1e-9 << std::endl;
+    }
+}
@@ -24,10 +24,17 @@
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
 #include <api/CPP/data.hpp>
+#include <api/CPP/reorder.hpp>
 #include "test_utils/test_utils.h"
+#include "float16.h"
 
 
+#include <algorithm>
+#include <chrono>
 #include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
 
 using namespace cldnn;
 using namespace tests;
@@ -164,3 +171,162 @@ TEST(embed_gpu, b2seq2num3) {
 
 }
 
+TEST(embed_gpu, random_b2seq7num100_vocab50) {
+    // embedding width not divisible by the vector size of the kernel
+    engine engine;
+    const int batch = 2;
+    const int sequence_length = 7;
+    const int num_output_size = 100;
+    const int vocab_size = 50;
+    auto input_prim = memory::allocate(engine, { data_types::f32,format::bfyx,{ batch, 1, sequence_length, 1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f32,format::bfyx,{ num_output_size, 1, vocab_size, 1 } });
+    auto bias_prim = memory::allocate(engine, { data_types::f32,format::bfyx,{ 1, 1, 1, num_output_size } });
+
+    std::vector<float> input_vec(batch * sequence_length);
+    for (size_t i = 0; i < input_vec.size(); ++i)
+        input_vec[i] = static_cast<float>((i * 17 + 3) % vocab_size);
+    auto weights_vec = generate_random_1d<float>(num_output_size * vocab_size, -10, 10);
+    auto bias_vec = generate_random_1d<float>(num_output_size, -10, 10);
+    set_values(input_prim, input_vec);
+    set_values(weights_prim, weights_vec);
+    set_values(bias_prim, bias_vec);
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        data("bias", bias_prim),
+        embed("embed_prim", "input", "weights", "bias"));
+
+    network network(engine, topology);
+    network.set_input_data("input", input_prim);
+
+    auto output_prim = network.execute().at("embed_prim").get_memory();
+    auto output_ptr = output_prim.pointer<float>();
+    for (int i = 0; i < batch * sequence_length; i++) {
+        const int row = static_cast<int>(input_vec[i]);
+        for (int y = 0; y < num_output_size; y++) {
+            EXPECT_EQ(output_ptr[i * num_output_size + y], weights_vec[row * num_output_size + y] + bias_vec[y]);
+        }
+    }
+}
+
+TEST(embed_gpu, fp16_table_fp32_output_b2seq5num37_vocab60) {
+    // fp16 table converted to fp32 by the embed kernel, the reorder to fp32 is fused into embed
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    const int batch = 2;
+    const int sequence_length = 5;
+    const int num_output_size = 37;
+    const int vocab_size = 60;
+    auto input_prim = memory::allocate(engine, { data_types::f16,format::bfyx,{ batch, 1, sequence_length, 1 } });
+    auto weights_prim = memory::allocate(engine, { data_types::f16,format::bfyx,{ num_output_size, 1, vocab_size, 1 } });
+    auto bias_prim = memory::allocate(engine, { data_types::f16,format::bfyx,{ 1, 1, 1, num_output_size } });
+
+    std::vector<FLOAT16> input_vec(batch * sequence_length, FLOAT16(0.f));
+    for (size_t i = 0; i < input_vec.size(); ++i)
+        input_vec[i] = FLOAT16(static_cast<float>((i * 13 + 5) % vocab_size));
+    auto weights_vec = generate_random_1d<float>(num_output_size * vocab_size, -10, 10);
+    auto bias_vec = generate_random_1d<float>(num_output_size, -10, 10);
+    set_values(input_prim, input_vec);
+    set_values(weights_prim, std::vector<FLOAT16>(weights_vec.begin(), weights_vec.end()));
+    set_values(bias_prim, std::vector<FLOAT16>(bias_vec.begin(), bias_vec.end()));
+
+    topology topology(
+        input_layout("input", input_prim.get_layout()),
+        data("weights", weights_prim),
+        data("bias", bias_prim),
+        embed("embed_prim", "input", "weights", "bias"),
+        reorder("output", "embed_prim", format::bfyx, data_types::f32));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, topology, options);
+    network.set_input_data("input", input_prim);
+
+    auto ids = network.get_all_primitive_ids();
+    EXPECT_EQ(std::find(ids.begin(), ids.end(), "embed_prim"), ids.end());
+
+    auto output_prim = network.execute().at("output").get_memory();
+    EXPECT_EQ(output_prim.get_layout().data_type, data_types::f32);
+    auto output_ptr = output_prim.pointer<float>();
+    for (int i = 0; i < batch * sequence_length; i++) {
+        const int row = static_cast<int>(static_cast<float>(input_vec[i]));
+        for (int y = 0; y < num_output_size; y++) {
+            // values and the sum are exact in fp16: multiples of 1/8 below 32
+            EXPECT_EQ(output_ptr[i * num_output_size + y], weights_vec[row * num_output_size + y] + bias_vec[y]);
+        }
+    }
+}
+
+// Embedding lookup throughput for fp32 tables and fp16 tables with fp32 output.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=embed_gpu.DISABLED_rows_report
+TEST(embed_gpu, DISABLED_rows_report) {
+    engine engine;
+    const int iterations = 20;
+    const int lookups = 4096;
+
+    struct report_case {
+        int vocab;
+        int width;
+    };
+    const std::vector<report_case> cases = {
+        { 1000,     16 },
+        { 1000,     64 },
+        { 100000,   16 },
+        { 100000,   64 },
+        { 100000,   256 },
+        { 1000000,  64 },
+    };
+    std::vector<data_types> table_types = { data_types::f32 };
+    if (engine.get_info().supports_fp16)
+        table_types.push_back(data_types::f16);
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+
+    std::mt19937 rng(1);
+    std::cout << std::setw(8) << "table" << std::setw(10) << "vocab" << std::setw(10) << "width" << std::setw(15) << "Mrows/s" << std::setw(10) << "GB/s" << std::endl;
+    for (auto table_type : table_types) {
+        for (const auto& c : cases) {
+            // indices are stored in the table type, so fp16 lookups are limited to the exactly representable range
+            const int vocab = table_type == data_types::f16 ? std::min(c.vocab, 2048) : c.vocab;
+            auto input = memory::allocate(engine, { table_type, format::bfyx, { 1, 1, lookups, 1 } });
+            auto table = memory::allocate(engine, { table_type, format::bfyx, { c.width, 1, vocab, 1 } });
+
+            std::uniform_int_distribution<int> dist(0, vocab - 1);
+            std::vector<float> indices_data(lookups);
+            for (auto& i : indices_data)
+                i = static_cast<float>(dist(rng));
+            if (table_type == data_types::f16)
+                set_values(input, std::vector<FLOAT16>(indices_data.begin(), indices_data.end()));
+            else
+                set_values(input, indices_data);
+
+            topology topo(
+                input_layout("input", input.get_layout()),
+                data("table", table),
+                embed("embed", "input", "table"),
+                reorder("output", "embed", format::bfyx, data_types::f32));
+            network net(engine, topo, options);
+            net.set_input_data("input", input);
+            net.execute().at("output").get_event().wait();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; ++i)
+                net.execute().at("output").get_event().wait();
+            const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+            const double rows_per_second = lookups / seconds;
+            const double bandwidth = (data_type_traits::size_of(table_type) + sizeof(float)) * lookups * c.width / seconds * 1e-9;
+
+            std::cout << std::setw(8) << (table_type == data_types::f16 ? "f16" : "f32") << std::setw(10) << vocab << std::setw(10) << c.width
+                      << std::fixed << std::setprecision(2) << std::setw(15) << rows_per_second * 1e-6 << std::setw(10) << bandwidth << std::endl;
+        }
+    }
+}
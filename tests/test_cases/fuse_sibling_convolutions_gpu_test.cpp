@@ -0,0 +1,215 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/reorder.hpp>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+#include "float16.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    void add_convolution(const engine& engine, topology& topology, const primitive_id& id, const primitive_id& input,
+        int32_t ifm, int32_t ofm, int32_t kernel_size, bool bias_term, data_types dt = data_types::f32)
+    {
+        auto set_values = [dt](const memory& mem)
+        {
+            if (dt == data_types::f16)
+                tests::set_random_values<FLOAT16>(mem);
+            else
+                tests::set_random_values<float>(mem);
+        };
+
+        auto weights = memory::allocate(engine, { dt, format::bfyx, { ofm, ifm, kernel_size, kernel_size } });
+        set_values(weights);
+        topology.add(data(id + "_weights", weights));
+
+        const tensor input_offset = { 0, 0, -(kernel_size / 2), -(kernel_size / 2) };
+        if (!bias_term)
+        {
+            topology.add(convolution(id, input, { id + "_weights" }, { 1, 1, 1, 1 }, input_offset, { 1, 1, 1, 1 }, true));
+            return;
+        }
+
+        auto biases = memory::allocate(engine, { dt, format::bfyx, { 1, 1, ofm, 1 } });
+        set_values(biases);
+        topology.add(data(id + "_biases", biases));
+        topology.add(convolution(id, input, { id + "_weights" }, { id + "_biases" }, { 1, 1, 1, 1 }, input_offset, { 1, 1, 1, 1 }, true));
+    }
+
+    // 1x1 convolutions of the input and 3x3 convolutions of the middle one are siblings, none of them feeds the concatenation directly
+    topology inception_like_topology(const engine& engine, const layout& input_layout, data_types dt)
+    {
+        topology topology(cldnn::input_layout("input", input_layout));
+        add_convolution(engine, topology, "conv1x1_a", "input", 16, 8, 1, true, dt);
+        add_convolution(engine, topology, "conv1x1_b", "input", 16, 16, 1, true, dt);
+        add_convolution(engine, topology, "conv1x1_c", "input", 16, 24, 1, true, dt);
+        add_convolution(engine, topology, "conv3x3_a", "conv1x1_b", 16, 8, 3, true, dt);
+        add_convolution(engine, topology, "conv3x3_b", "conv1x1_b", 16, 8, 3, true, dt);
+        topology.add(pooling("pool_a", "conv1x1_a", pooling_mode::max, { 1, 1, 3, 3 }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }));
+        topology.add(eltwise("sum", "conv3x3_a", "conv3x3_b", eltwise_mode::sum));
+        topology.add(pooling("pool_c", "conv1x1_c", pooling_mode::max, { 1, 1, 3, 3 }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }));
+        topology.add(concatenation("concat", { "pool_a", "sum", "pool_c" }, concatenation::along_f));
+        return topology;
+    }
+
+    // executes topology with siblings fused and without graph optimizations, returns outputs of both runs
+    std::pair<std::vector<float>, std::vector<float>> run_fused_and_unfused(const engine& engine, const topology& topology,
+        const memory& input, const primitive_id& output_id, size_t expected_fused_count)
+    {
+        return run_optimized_and_reference(engine, topology, input, output_id, [&](network& network, bool optimized)
+        {
+            auto ids = network.get_all_primitive_ids();
+            auto fused_count = std::count_if(ids.begin(), ids.end(), [](const primitive_id& id)
+            {
+                return id.find("_cldnn_siblings_fused_") == 0 && id.find("_weights") == std::string::npos &&
+                    id.find("_bias") == std::string::npos;
+            });
+            EXPECT_EQ(optimized ? expected_fused_count : 0, static_cast<size_t>(fused_count));
+        }, build_options(build_option::fuse_sibling_convolutions(true)));
+    }
+
+    void compare_with_unfused(const engine& engine, const topology& topology, const memory& input, const primitive_id& output_id,
+        size_t expected_fused_count)
+    {
+        auto results = run_fused_and_unfused(engine, topology, input, output_id, expected_fused_count);
+
+        ASSERT_EQ(results.first.size(), results.second.size());
+        for (size_t i = 0; i < results.first.size(); i++)
+        {
+            EXPECT_NEAR(results.second[i], results.first[i], 1e-3f) << "i = " << i;
+        }
+    }
+}
+
+TEST(fuse_sibling_convolutions_gpu, inception_like_1x1_and_3x3_siblings)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 12, 12 } });
+    tests::set_random_values<float>(input);
+
+    compare_with_unfused(engine, inception_like_topology(engine, input.get_layout(), data_types::f32), input, "concat", 2);
+}
+
+TEST(fuse_sibling_convolutions_gpu, inception_like_1x1_and_3x3_siblings_fp16)
+{
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    auto input = memory::allocate(engine, { data_types::f16, format::bfyx, { 2, 16, 12, 12 } });
+    tests::set_random_values<FLOAT16>(input);
+
+    auto topology = inception_like_topology(engine, input.get_layout(), data_types::f16);
+    topology.add(reorder("output", "concat", format::bfyx, data_types::f32));
+    auto results = run_fused_and_unfused(engine, topology, input, "output", 2);
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        // accumulation order of the merged convolution may differ
+        EXPECT_NEAR(results.second[i], results.first[i], 1e-2f * std::max(1.f, std::fabs(results.second[i]))) << "i = " << i;
+    }
+}
+
+TEST(fuse_sibling_convolutions_gpu, siblings_without_bias)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 8, 6, 6 } });
+    tests::set_random_values<float>(input);
+
+    topology topology(input_layout("input", input.get_layout()));
+    add_convolution(engine, topology, "conv_a", "input", 8, 4, 3, false);
+    add_convolution(engine, topology, "conv_b", "input", 8, 12, 3, false);
+    topology.add(pooling("pool_a", "conv_a", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    topology.add(pooling("pool_b", "conv_b", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    topology.add(concatenation("concat", { "pool_b", "pool_a" }, concatenation::along_f));
+
+    compare_with_unfused(engine, topology, input, "concat", 1);
+}
+
+TEST(fuse_sibling_convolutions_gpu, siblings_consumed_by_concatenation_not_fused)
+{
+    // crops of the merged output would be copied into the concatenation, while the convolutions write there directly
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 8, 6, 6 } });
+    tests::set_random_values<float>(input);
+
+    topology topology(input_layout("input", input.get_layout()));
+    add_convolution(engine, topology, "conv_a", "input", 8, 4, 3, false);
+    add_convolution(engine, topology, "conv_b", "input", 8, 12, 3, false);
+    topology.add(concatenation("concat", { "conv_b", "conv_a" }, concatenation::along_f));
+
+    compare_with_unfused(engine, topology, input, "concat", 0);
+}
+
+TEST(fuse_sibling_convolutions_gpu, different_kernel_sizes_not_fused)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 8, 6, 6 } });
+    tests::set_random_values<float>(input);
+
+    topology topology(input_layout("input", input.get_layout()));
+    add_convolution(engine, topology, "conv_a", "input", 8, 4, 1, true);
+    add_convolution(engine, topology, "conv_b", "input", 8, 4, 3, true);
+    topology.add(pooling("pool_a", "conv_a", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    topology.add(pooling("pool_b", "conv_b", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    topology.add(concatenation("concat", { "pool_a", "pool_b" }, concatenation::along_f));
+
+    compare_with_unfused(engine, topology, input, "concat", 0);
+}
+
+TEST(fuse_sibling_convolutions_gpu, disabled_by_default)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 12, 12 } });
+    tests::set_random_values<float>(input);
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network network(engine, inception_like_topology(engine, input.get_layout(), data_types::f32), options);
+    auto ids = network.get_all_primitive_ids();
+    EXPECT_TRUE(std::none_of(ids.begin(), ids.end(), [](const primitive_id& id) { return id.find("_cldnn_siblings_fused_") == 0; }));
+}
@@ -0,0 +1,315 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/fully_connected.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/scale.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/reorder.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+#include "float16.h"
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    // executes topology with and without graph optimizations, returns outputs of both runs
+    // primitives listed in fused_ids have to be executed only when optimizations are disabled
+    std::pair<std::vector<float>, std::vector<float>> run_fused_and_reference(const engine& engine, const topology& topology,
+        const memory& input, const primitive_id& output_id, const std::vector<primitive_id>& fused_ids)
+    {
+        return run_optimized_and_reference(engine, topology, input, output_id, [&](network& network, bool optimized)
+        {
+            auto executed = network.get_executed_primitive_ids();
+            for (const auto& id : fused_ids)
+            {
+                const bool is_executed = std::find(executed.begin(), executed.end(), id) != executed.end();
+                EXPECT_EQ(is_executed, !optimized) << "primitive: " << id << ", optimize_data: " << optimized;
+            }
+        });
+    }
+
+    // operations no kernel of the layer can take are applied by fused_ops_ref, built into the same program
+    size_t fused_ops_ref_kernels_built(const engine& engine)
+    {
+        size_t kernels = 0;
+        for (const auto& program : engine.get_kernels_build_stats())
+            for (const auto& entry_point : program.entry_points)
+                if (entry_point.compare(0, std::string("fused_ops_ref").size(), "fused_ops_ref") == 0)
+                    kernels++;
+        return kernels;
+    }
+
+    bool skip_without_fp16(const engine& engine)
+    {
+        if (engine.get_info().supports_fp16)
+            return false;
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return true;
+    }
+}
+
+TEST(fused_post_ops_gpu, convolution_eltwise_sum_relu)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 8, 8 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 32, 16, 3, 3 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 32, 1 } });
+    auto residual = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 32, 8, 8 } });
+    tests::set_random_values<float>(input);
+    tests::set_random_values<float>(weights);
+    tests::set_random_values<float>(biases);
+    tests::set_random_values<float>(residual);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("residual", residual),
+        convolution("conv", "input", { "weights" }, { "biases" }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }),
+        eltwise("sum", "conv", "residual", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu));
+
+    // "conv" absorbs "sum" and "relu" and takes over the id of the network output
+    auto results = run_fused_and_reference(engine, topology, input, "relu", { "conv", "sum" });
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-4f) << "i = " << i;
+    }
+}
+
+TEST(fused_post_ops_gpu, fully_connected_scale)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 8, 1, 32, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 16, 1, 32, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 16, 1 } });
+    auto scale_input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 1, 1 } });
+    auto scale_bias = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 16, 1, 1 } });
+    tests::set_random_values<float>(input);
+    tests::set_random_values<float>(weights);
+    tests::set_random_values<float>(biases);
+    tests::set_random_values<float>(scale_input);
+    tests::set_random_values<float>(scale_bias);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("scale_input", scale_input),
+        data("scale_bias", scale_bias),
+        fully_connected("fc", "input", "weights", "biases"),
+        scale("scale", "fc", "scale_input", "scale_bias"));
+
+    auto results = run_fused_and_reference(engine, topology, input, "scale", { "fc" });
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-4f) << "i = " << i;
+    }
+}
+
+TEST(fused_post_ops_gpu, eltwise_sub_second_operand_not_fused)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 1, 4, 1 } });
+    auto other = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    set_values<float>(input, { 1.0f, 2.0f, 3.0f, 4.0f });
+    set_values<float>(weights, { 1.0f, 1.0f, 1.0f, 1.0f, 0.5f, 0.5f, 0.5f, 0.5f });
+    set_values<float>(other, { 20.0f, 10.0f });
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("other", other),
+        fully_connected("fc", "input", "weights", ""),
+        eltwise("sub", "other", "fc", eltwise_mode::sub));
+
+    auto results = run_fused_and_reference(engine, topology, input, "sub", {});
+
+    std::vector<float> expected = { 10.0f, 5.0f };
+    ASSERT_EQ(results.first.size(), expected.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_TRUE(are_equal(results.first[i], expected[i]));
+        EXPECT_TRUE(are_equal(results.second[i], expected[i]));
+    }
+}
+
+TEST(fused_post_ops_gpu, fully_connected_batch1_fused_ops_ref_fallback)
+{
+    // batch 1 fully connected kernels do not take fused operations, so the sum and relu run in fused_ops_ref
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 64, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 24, 1, 64, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 24, 1 } });
+    auto other = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 24, 1, 1 } });
+    tests::set_random_values<float>(input, true);
+    tests::set_random_values<float>(weights, true);
+    tests::set_random_values<float>(biases, true);
+    tests::set_random_values<float>(other, true);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("other", other),
+        fully_connected("fc", "input", "weights", "biases"),
+        eltwise("sum", "fc", "other", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu));
+
+    auto results = run_fused_and_reference(engine, topology, input, "relu", { "sum" });
+    EXPECT_GT(fused_ops_ref_kernels_built(engine), 0u);
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-4f) << "i = " << i;
+    }
+}
+
+TEST(fused_post_ops_gpu, fully_connected_batch8_eltwise_sum_relu)
+{
+    // batch 8 is computed by the vectorized fb/bs_f_bsv8 kernels which apply the operations to 8 batches at once
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 8, 1, 64, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 32, 1, 64, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 32, 1 } });
+    auto other = memory::allocate(engine, { data_types::f32, format::yxfb, { 8, 32, 1, 1 } });
+    tests::set_random_values<float>(input, true);
+    tests::set_random_values<float>(weights, true);
+    tests::set_random_values<float>(biases, true);
+    tests::set_random_values<float>(other, true);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("other", other),
+        fully_connected("fc", "input", "weights", "biases"),
+        eltwise("sum", "fc", "other", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu));
+
+    auto results = run_fused_and_reference(engine, topology, input, "relu", { "fc", "sum" });
+    EXPECT_EQ(fused_ops_ref_kernels_built(engine), 0u);
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-4f) << "i = " << i;
+    }
+}
+
+TEST(fused_post_ops_gpu, fully_connected_batch16_scale_relu_fp16)
+{
+    // batch 16 fp16 is computed by the vectorized bs_f_bsv16 kernel
+    engine engine;
+    if (skip_without_fp16(engine))
+        return;
+
+    auto input = memory::allocate(engine, { data_types::f16, format::bfyx, { 16, 1, 64, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f16, format::bfyx, { 32, 1, 64, 1 } });
+    auto biases = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 1, 32, 1 } });
+    auto scale_input = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 32, 1, 1 } });
+    auto scale_bias = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 32, 1, 1 } });
+    tests::set_random_values<FLOAT16>(input, true);
+    tests::set_random_values<FLOAT16>(weights, true);
+    tests::set_random_values<FLOAT16>(biases, true);
+    tests::set_random_values<FLOAT16>(scale_input, true);
+    tests::set_random_values<FLOAT16>(scale_bias, true);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("scale_input", scale_input),
+        data("scale_bias", scale_bias),
+        fully_connected("fc", "input", "weights", "biases"),
+        scale("scale", "fc", "scale_input", "scale_bias"),
+        activation("relu", "scale", activation_relu),
+        reorder("output", "relu", format::bfyx, data_types::f32));
+
+    auto results = run_fused_and_reference(engine, topology, input, "output", { "scale", "relu" });
+    EXPECT_EQ(fused_ops_ref_kernels_built(engine), 0u);
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        // fused operations are applied before the fp16 rounding of the fully connected output
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-2f * std::max(1.f, std::fabs(results.second[i]))) << "i = " << i;
+    }
+}
+
+TEST(fused_post_ops_gpu, convolution_eltwise_sum_relu_fp16)
+{
+    engine engine;
+    if (skip_without_fp16(engine))
+        return;
+
+    auto input = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 16, 8, 8 } });
+    auto weights = memory::allocate(engine, { data_types::f16, format::bfyx, { 32, 16, 3, 3 } });
+    auto biases = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 1, 32, 1 } });
+    auto residual = memory::allocate(engine, { data_types::f16, format::bfyx, { 1, 32, 8, 8 } });
+    tests::set_random_values<FLOAT16>(input, true);
+    tests::set_random_values<FLOAT16>(weights, true);
+    tests::set_random_values<FLOAT16>(biases, true);
+    tests::set_random_values<FLOAT16>(residual, true);
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        data("weights", weights),
+        data("biases", biases),
+        data("residual", residual),
+        convolution("conv", "input", { "weights" }, { "biases" }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }),
+        eltwise("sum", "conv", "residual", eltwise_mode::sum),
+        activation("relu", "sum", activation_relu),
+        reorder("output", "relu", format::bfyx, data_types::f32));
+
+    auto results = run_fused_and_reference(engine, topology, input, "output", { "sum", "relu" });
+
+    ASSERT_EQ(results.first.size(), results.second.size());
+    for (size_t i = 0; i < results.first.size(); i++)
+    {
+        EXPECT_NEAR(results.first[i], results.second[i], 1e-2f * std::max(1.f, std::fabs(results.second[i]))) << "i = " << i;
+    }
+}
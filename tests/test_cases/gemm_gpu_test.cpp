@@ -25,12 +25,24 @@
 #include "test_utils/test_utils.h"
 #include "test_utils/uniform_quantized_real_distribution.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
 
 
 using namespace cldnn;
 using namespace ::tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 TEST(gemm_gpu, basic_bfyx_t1) {
     engine engine;
     auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 1, 3, 4 } });
@@ -3250,3 +3262,219 @@ TEST(gemm_gpu, basic_smarcink2) {
     }
 }
 
+
+namespace {
+    struct gemm_test_case {
+        int batch;
+        int M;
+        int N;
+        int K;
+        bool transpose_input1;
+        bool transpose_input2;
+        bool bias;
+    };
+
+    std::ostream& operator<<(std::ostream& os, const gemm_test_case& c) {
+        return os << c.batch << "x" << c.M << "x" << c.N << "x" << c.K
+                  << (c.transpose_input1 ? " t1" : "") << (c.transpose_input2 ? " t2" : "") << (c.bias ? " bias" : "");
+    }
+
+    // inputs are bfyx {batch, 1, x, y}, rows of A are along K (along M when transposed), rows of B along N (along K when transposed)
+    tensor gemm_input1_size(const gemm_test_case& c) {
+        return c.transpose_input1 ? tensor(c.batch, 1, c.M, c.K) : tensor(c.batch, 1, c.K, c.M);
+    }
+
+    tensor gemm_input2_size(const gemm_test_case& c) {
+        return c.transpose_input2 ? tensor(c.batch, 1, c.K, c.N) : tensor(c.batch, 1, c.N, c.K);
+    }
+
+    const float gemm_alpha = 0.5f;
+    const float gemm_beta = 2.0f;
+
+    topology gemm_test_topology(const gemm_test_case& c, data_types dt) {
+        topology topology(
+            input_layout("input", { dt, format::bfyx, gemm_input1_size(c) }),
+            input_layout("input2", { dt, format::bfyx, gemm_input2_size(c) }));
+        if (c.bias) {
+            topology.add(input_layout("input3", { dt, format::bfyx, { c.batch, 1, c.N, c.M } }));
+            topology.add(gemm("output", "input", "input2", "input3", c.transpose_input1, c.transpose_input2, gemm_alpha, gemm_beta));
+        }
+        else {
+            topology.add(gemm("output", "input", "input2", c.transpose_input1, c.transpose_input2));
+        }
+        return topology;
+    }
+
+    template <typename T>
+    std::vector<float> gemm_reference(const gemm_test_case& c, const memory& input, const memory& input2, const memory& input3) {
+        auto a = input.pointer<T>();
+        auto b = input2.pointer<T>();
+        auto bias = input3.pointer<T>();
+        std::vector<float> output(c.batch * c.M * c.N);
+        for (int bi = 0; bi < c.batch; ++bi) {
+            for (int m = 0; m < c.M; ++m) {
+                for (int n = 0; n < c.N; ++n) {
+                    float acc = 0.f;
+                    for (int k = 0; k < c.K; ++k) {
+                        const float a_val = a[bi * c.M * c.K + (c.transpose_input1 ? k * c.M + m : m * c.K + k)];
+                        const float b_val = b[bi * c.K * c.N + (c.transpose_input2 ? n * c.K + k : k * c.N + n)];
+                        acc += a_val * b_val;
+                    }
+                    const int idx = (bi * c.M + m) * c.N + n;
+                    if (c.bias)
+                        output[idx] = gemm_alpha * acc + gemm_beta * static_cast<float>(bias[idx]);
+                    else
+                        output[idx] = acc;
+                }
+            }
+        }
+        return output;
+    }
+
+    template <typename T>
+    void gemm_random_test(const gemm_test_case& c, float tolerance) {
+        engine engine;
+        const auto dt = type_to_data_type<T>::value;
+        if (dt == data_types::f16 && !engine.get_info().supports_fp16) {
+            std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+            EXPECT_EQ(1, 1);
+            return;
+        }
+
+        auto input = memory::allocate(engine, { dt, format::bfyx, gemm_input1_size(c) });
+        auto input2 = memory::allocate(engine, { dt, format::bfyx, gemm_input2_size(c) });
+        auto input3 = memory::allocate(engine, { dt, format::bfyx, { c.batch, 1, c.N, c.M } });
+        set_random_values<T>(input, true, 5, 2);
+        set_random_values<T>(input2, true, 5, 2);
+        set_random_values<T>(input3, true, 5, 2);
+
+        network network(engine, gemm_test_topology(c, dt));
+        network.set_input_data("input", input);
+        network.set_input_data("input2", input2);
+        if (c.bias)
+            network.set_input_data("input3", input3);
+
+        auto output = network.execute().at("output").get_memory();
+        auto output_ptr = output.pointer<T>();
+        const auto expected = gemm_reference<T>(c, input, input2, input3);
+
+        ASSERT_EQ(output.get_layout().size, tensor(c.batch, 1, c.N, c.M));
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_NEAR(expected[i], static_cast<float>(output_ptr[i]), tolerance * std::max(1.f, std::abs(expected[i]))) << c << " i = " << i;
+        }
+    }
+}
+
+TEST(gemm_gpu, tiled_f32) {
+    const std::vector<gemm_test_case> cases = {
+        { 1, 64, 64, 64, false, false, false },
+        { 2, 100, 37, 129, false, false, false },
+        { 3, 17, 130, 45, true, false, false },
+        { 2, 65, 33, 72, false, true, false },
+        { 2, 48, 50, 19, true, true, false },
+        { 2, 70, 68, 33, false, false, true },
+        { 1, 5, 3, 300, true, true, true },
+    };
+    for (const auto& c : cases)
+        gemm_random_test<float>(c, 1e-4f);
+}
+
+TEST(gemm_gpu, tiled_f16) {
+    const std::vector<gemm_test_case> cases = {
+        { 1, 64, 64, 64, false, false, false },
+        { 2, 100, 37, 129, false, true, false },
+        { 2, 33, 96, 80, true, false, true },
+    };
+    for (const auto& c : cases)
+        gemm_random_test<FLOAT16>(c, 1e-2f);
+}
+
+namespace {
+    // Runs gemm with the given tuning config and returns achieved GFLOP/s.
+    double gemm_gflops(const engine& engine, const gemm_test_case& c, data_types dt, const tuning_config_options& tuning_config) {
+        auto input = memory::allocate(engine, { dt, format::bfyx, gemm_input1_size(c) });
+        auto input2 = memory::allocate(engine, { dt, format::bfyx, gemm_input2_size(c) });
+
+        build_options options;
+        options.set_option(build_option::tuning_config(tuning_config));
+        network network(engine, gemm_test_topology(c, dt), options);
+        network.set_input_data("input", input);
+        network.set_input_data("input2", input2);
+        network.execute().at("output").get_event().wait();
+
+        const int iterations = 20;
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("output").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        return 2.0 * c.batch * c.M * c.N * c.K / seconds * 1e-9;
+    }
+
+    // Copies tuning cache replacing selected kernels with the reference one, so the same shapes can be run with it.
+    void write_reference_cache(const std::string& tuned_file, const std::string& reference_file) {
+        std::ifstream in(tuned_file);
+        std::ofstream out(reference_file);
+        std::string line;
+        for (int header_lines = 0; header_lines < 3 && std::getline(in, line); ++header_lines)
+            out << line << "\n";
+        while (std::getline(in, line)) {
+            std::istringstream iss(line);
+            std::string hash;
+            if (iss >> hash)
+                out << hash << " gemm_ref -1\n";
+        }
+    }
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=gemm_gpu.DISABLED_gflops_report
+TEST(gemm_gpu, DISABLED_gflops_report) {
+    // kernel runner measures kernels with profiling events
+    engine engine(engine_configuration(true));
+
+    std::vector<gemm_test_case> cases;
+    for (int size : { 64, 128, 256, 512, 1024 })
+        cases.push_back({ 1, size, size, size, false, false, false });
+    cases.push_back({ 16, 128, 128, 64, false, true, false });    // attention scores
+    cases.push_back({ 16, 128, 64, 128, false, false, false });   // attention context
+    cases.push_back({ 64, 1, 256, 256, false, false, false });    // recommender dot products
+    cases.push_back({ 1, 512, 512, 512, true, false, false });
+    cases.push_back({ 1, 512, 512, 512, true, true, false });
+
+    std::vector<data_types> data_types_list = { data_types::f32 };
+    if (engine.get_info().supports_fp16)
+        data_types_list.push_back(data_types::f16);
+
+    std::cout << std::setw(32) << "case" << std::setw(6) << "type"
+              << std::setw(12) << "ref" << std::setw(12) << "tiled" << std::setw(12) << "tuned" << "  GFLOP/s" << std::endl;
+    for (auto dt : data_types_list) {
+        for (const auto& c : cases) {
+            std::stringstream name;
+            name << c;
+            // cache files are remembered by path for the whole process, so each case gets its own
+            const std::string suffix = std::to_string(&c - cases.data()) + "_" + std::to_string(static_cast<int>(dt)) + ".txt";
+            const std::string tuned_file = "gemm_gflops_report_tuned_" + suffix;
+            const std::string reference_file = "gemm_gflops_report_ref_" + suffix;
+            std::remove(tuned_file.c_str());
+
+            tuning_config_options tuning_config;
+            const double tiled = gemm_gflops(engine, c, dt, tuning_config);
+
+            tuning_config.mode = tuning_mode::tuning_tune_and_cache;
+            tuning_config.cache_file_path = tuned_file;
+            const double tuned = gemm_gflops(engine, c, dt, tuning_config);
+
+            write_reference_cache(tuned_file, reference_file);
+            tuning_config.mode = tuning_mode::tuning_use_cache;
+            tuning_config.cache_file_path = reference_file;
+            const double ref = gemm_gflops(engine, c, dt, tuning_config);
+
+            std::remove(tuned_file.c_str());
+            std::remove(reference_file.c_str());
+
+            std::cout << std::setw(32) << name.str() << std::setw(6) << (dt == data_types::f16 ? "f16" : "f32")
+                      << std::fixed << std::setprecision(1)
+                      << std::setw(12) << ref << std::setw(12) << tiled << std::setw(12) << tuned << std::endl;
+        }
+    }
+}
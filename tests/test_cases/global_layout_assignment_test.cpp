@@ -0,0 +1,196 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Global layout assignment: outputs have to match per-layer layout choice.
+// Reorders report (count and execution time of reorders, with and without global assignment) is disabled by default:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=*global_layout_assignment*report*
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/reorder.hpp>
+#include <api/CPP/data.hpp>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+
+#include <iomanip>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    struct reorders_stats
+    {
+        size_t count;
+        double execution_us;
+    };
+
+    // 1x1 and 3x3 convolutions with concatenation and eltwise
+    topology mixed_topology(const engine& engine, data_types dt, const tensor& input_size)
+    {
+        topology_builder builder(engine, dt);
+        builder.add(input_layout("input", { data_types::f32, format::bfyx, input_size }));
+        builder.add(reorder("input_reordered", "input", format::bfyx, dt));
+        auto stem = builder.add_convolution("stem", "input_reordered", input_size.feature[0], 64, 3);
+        auto branch_1x1 = builder.add_convolution("branch_1x1", stem, 64, 64, 1);
+        auto branch_3x3 = builder.add_convolution("branch_3x3", stem, 64, 64, 3);
+        auto concat = builder.add(concatenation("concat", { branch_1x1, branch_3x3 }, concatenation::along_f));
+        auto expand = builder.add_convolution("expand", concat, 128, 64, 1);
+        auto sum = builder.add(eltwise("sum", expand, stem, eltwise_mode::sum));
+        auto reduce = builder.add_convolution("reduce", sum, 64, 64, 1);
+        builder.add(reorder("output", reduce, format::bfyx, data_types::f32));
+        return builder.get();
+    }
+
+    network build_network(const engine& engine, const topology& topology, bool global_layout_assignment)
+    {
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        options.set_option(build_option::global_layout_assignment(global_layout_assignment));
+        return network(engine, topology, options);
+    }
+
+    bool is_reorder(network& network, const primitive_id& id)
+    {
+        return network.get_primitive_info(id).find("reorder info") != std::string::npos;
+    }
+
+    // optimized out reorders are not executed
+    size_t count_reorders(network& network)
+    {
+        size_t count = 0;
+        for (auto& id : network.get_executed_primitive_ids())
+        {
+            if (is_reorder(network, id))
+                count++;
+        }
+        return count;
+    }
+
+    reorders_stats measure_reorders(network& network, const memory& input)
+    {
+        const int iterations = 10;
+        network.set_input_data("input", input);
+        network.execute().at("output").get_memory().pointer<float>();
+
+        reorders_stats stats = { count_reorders(network), 0.0 };
+
+        for (int i = 0; i < iterations; i++)
+        {
+            network.execute().at("output").get_event().wait();
+            for (auto& executed : network.get_executed_primitives())
+            {
+                if (!is_reorder(network, executed.first))
+                    continue;
+                for (auto& interval : executed.second.get_profiling_info())
+                {
+                    if (interval.name == "executing")
+                        stats.execution_us += std::chrono::duration<double, std::micro>(interval.value->value()).count() / iterations;
+                }
+            }
+        }
+        return stats;
+    }
+
+    // global assignment has to give the same outputs as per-layer choice, with fewer (or, if fewer_reorders is false, not more) reorders
+    void compare_outputs(const engine& engine, const topology& topology, const tensor& input_size, float tolerance, bool fewer_reorders)
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, input_size });
+        tests::set_random_values<float>(input);
+
+        auto per_layer = build_network(engine, topology, false);
+        auto global = build_network(engine, topology, true);
+        tests::compare_outputs(per_layer, global, input, tolerance);
+
+        const auto per_layer_reorders = count_reorders(per_layer);
+        const auto global_reorders = count_reorders(global);
+        if (fewer_reorders)
+            EXPECT_LT(global_reorders, per_layer_reorders);
+        else
+            EXPECT_LE(global_reorders, per_layer_reorders);
+    }
+}
+
+TEST(global_layout_assignment, mixed_topology_fp32)
+{
+    engine engine;
+    const tensor input_size = { 1, 16, 14, 14 };
+    compare_outputs(engine, mixed_topology(engine, data_types::f32, input_size), input_size, 1e-3f, false);
+}
+
+TEST(global_layout_assignment, residual_topology_fp16)
+{
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    const tensor input_size = { 1, 16, 14, 14 };
+    compare_outputs(engine, residual_topology(engine, data_types::f16, input_size, 2), input_size, 1e-1f, true);
+}
+
+TEST(global_layout_assignment, DISABLED_reorders_report)
+{
+    // reorders are measured with profiling events
+    engine engine(engine_configuration(true));
+    const auto dt = engine.get_info().supports_fp16 ? data_types::f16 : data_types::f32;
+
+    struct report_case
+    {
+        std::string name;
+        topology net_topology;
+        tensor input_size;
+    };
+    const std::vector<report_case> cases = {
+        { "mixed_b1",     mixed_topology(engine, dt, { 1, 32, 56, 56 }),           { 1, 32, 56, 56 } },
+        { "mixed_b16",    mixed_topology(engine, dt, { 16, 32, 28, 28 }),          { 16, 32, 28, 28 } },
+        { "residual_b1",  residual_topology(engine, dt, { 1, 64, 56, 56 }, 3),     { 1, 64, 56, 56 } },
+        { "residual_b16", residual_topology(engine, dt, { 16, 64, 28, 28 }, 3),    { 16, 64, 28, 28 } },
+    };
+
+    std::cout << std::setw(14) << "topology"
+              << std::setw(18) << "per-layer count" << std::setw(16) << "per-layer us"
+              << std::setw(14) << "global count" << std::setw(14) << "global us" << std::endl;
+    for (const auto& report_case : cases)
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, report_case.input_size });
+        tests::set_random_values<float>(input);
+
+        auto per_layer = build_network(engine, report_case.net_topology, false);
+        auto global = build_network(engine, report_case.net_topology, true);
+        const auto per_layer_stats = measure_reorders(per_layer, input);
+        const auto global_stats = measure_reorders(global, input);
+
+        std::cout << std::setw(14) << report_case.name << std::fixed << std::setprecision(1)
+                  << std::setw(18) << per_layer_stats.count << std::setw(16) << per_layer_stats.execution_us
+                  << std::setw(14) << global_stats.count << std::setw(14) << global_stats.execution_us << std::endl;
+    }
+}
@@ -0,0 +1,142 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Host-side dispatch overhead benchmarks.
+//
+// Networks are built from long chains of trivial primitives on tiny tensors, so time spent in
+// network::execute() is dominated by host work (argument setup, event creation, lookups by primitive_id,
+// refcounting) rather than by kernels. Only the enqueue part is timed - waiting for results is done
+// outside of the measured region.
+//
+// Benchmarks run on CPU OpenCL runtime to get stable numbers, so they are disabled by default. To run them:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=*host_overhead*
+// The smoke variant runs a short chain on the default device, so the benchmark code itself is kept working.
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/activation.hpp>
+
+#include "test_utils/test_utils.h"
+
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    struct host_overhead_result
+    {
+        size_t primitives;
+        double ns_per_primitive;
+        double ns_per_execute;
+    };
+
+    engine_configuration cpu_configuration(bool memory_pool)
+    {
+        return engine_configuration(false, false, false, std::string(), std::string(), true, std::string(), std::string(),
+            priority_mode_types::disabled, throttle_mode_types::disabled, memory_pool, device_types::cpu);
+    }
+
+    host_overhead_result measure_activation_chain(const engine& engine, size_t chain_length, size_t iterations)
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+        set_values(input, { 1.0f, 2.0f, 3.0f, 4.0f });
+
+        topology topology(input_layout("input", input.get_layout()));
+        primitive_id prev = "input";
+        for (size_t i = 0; i < chain_length; i++)
+        {
+            primitive_id id = "relu" + std::to_string(i);
+            topology.add(activation(id, prev, activation_relu));
+            prev = id;
+        }
+
+        network network(engine, topology);
+        network.set_input_data("input", input);
+
+        // warm up - first execution may include lazy initialization in the runtime
+        network.execute().at(prev).get_memory().pointer<float>();
+
+        using clock = std::chrono::high_resolution_clock;
+        clock::duration host_time = clock::duration::zero();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            auto start = clock::now();
+            auto outputs = network.execute();
+            host_time += clock::now() - start;
+
+            auto output_ptr = outputs.at(prev).get_memory().pointer<float>();
+            EXPECT_FLOAT_EQ(output_ptr[3], 4.0f);
+        }
+
+        const double total_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(host_time).count());
+        const double ns_per_execute = total_ns / iterations;
+        return { chain_length, ns_per_execute / (chain_length + 1), ns_per_execute };
+    }
+
+    void print_results(const std::string& name, const std::vector<host_overhead_result>& results)
+    {
+        std::cout << name << std::endl;
+        std::cout << std::setw(12) << "primitives" << std::setw(20) << "ns/primitive" << std::setw(20) << "ns/execute" << std::endl;
+        for (const auto& res : results)
+        {
+            std::cout << std::setw(12) << res.primitives
+                      << std::setw(20) << std::fixed << std::setprecision(1) << res.ns_per_primitive
+                      << std::setw(20) << std::fixed << std::setprecision(1) << res.ns_per_execute << std::endl;
+        }
+    }
+}
+
+TEST(host_overhead, activation_chain_smoke)
+{
+    engine engine;
+
+    const auto result = measure_activation_chain(engine, 10, 2);
+    EXPECT_EQ(result.primitives, size_t(10));
+    EXPECT_GT(result.ns_per_execute, 0.0);
+    EXPECT_GT(result.ns_per_primitive, 0.0);
+}
+
+TEST(host_overhead, DISABLED_activation_chain)
+{
+    engine engine(cpu_configuration(true));
+
+    std::vector<host_overhead_result> results;
+    for (size_t chain_length : { 10, 100, 1000 })
+        results.push_back(measure_activation_chain(engine, chain_length, 20));
+
+    print_results("host_overhead.activation_chain (memory pool enabled)", results);
+}
+
+TEST(host_overhead, DISABLED_activation_chain_no_memory_pool)
+{
+    engine engine(cpu_configuration(false));
+
+    std::vector<host_overhead_result> results;
+    for (size_t chain_length : { 10, 100, 1000 })
+        results.push_back(measure_activation_chain(engine, chain_length, 20));
+
+    print_results("host_overhead.activation_chain (memory pool disabled)", results);
+}
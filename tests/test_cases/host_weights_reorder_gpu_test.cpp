@@ -0,0 +1,156 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Weights reordered on host have to give the same results as weights reordered by GPU kernels.
+// Load time report (network build time with and without host weights reorder) is disabled by default:
+//   tests --gtest_also_run_disabled_tests --gtest_filter=*host_weights_reorder*report*
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/pooling.hpp>
+#include <api/CPP/reorder.hpp>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    // conv/pool stages of given widths followed by fully connected layers
+    topology vgg_like_topology(const engine& engine, data_types dt, const tensor& input_size, const std::vector<int32_t>& widths, int32_t fc_size)
+    {
+        topology_builder builder(engine, dt);
+        builder.add(input_layout("input", { data_types::f32, format::bfyx, input_size }));
+        primitive_id last = builder.add(reorder("input_reordered", "input", format::bfyx, dt));
+        int32_t ifm = input_size.feature[0];
+        int32_t spatial = input_size.spatial[0];
+        for (size_t i = 0; i < widths.size(); i++)
+        {
+            const auto prefix = "stage" + std::to_string(i) + "_";
+            last = builder.add_convolution(prefix + "conv0", last, ifm, widths[i], 3);
+            last = builder.add_convolution(prefix + "conv1", last, widths[i], widths[i], 3);
+            last = builder.add(pooling(prefix + "pool", last, pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+            ifm = widths[i];
+            spatial /= 2;
+        }
+        last = builder.add_fully_connected("fc0", last, { input_size.batch[0], ifm, spatial, spatial }, fc_size);
+        last = builder.add_fully_connected("fc1", last, { input_size.batch[0], fc_size, 1, 1 }, fc_size);
+        builder.add(reorder("output", last, format::bfyx, data_types::f32));
+        return builder.get();
+    }
+
+    build_options make_options(bool host_weights_reorder)
+    {
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        options.set_option(build_option::host_weights_reorder(host_weights_reorder));
+        return options;
+    }
+
+    // weights reorders are compiled as separate kernels with entry points named after the reorder_weights* templates
+    size_t weights_reorder_kernels_built(const engine& engine)
+    {
+        size_t kernels = 0;
+        for (const auto& program : engine.get_kernels_build_stats())
+            for (const auto& entry_point : program.entry_points)
+                if (entry_point.compare(0, std::string("reorder_weights").size(), "reorder_weights") == 0)
+                    kernels++;
+        return kernels;
+    }
+
+    void compare_with_gpu_reorder(const engine& engine, const topology& topology, const tensor& input_size, float tolerance)
+    {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, input_size });
+        tests::set_random_values<float>(input, true);
+
+        // host reordered network is built first, so all weights reorder kernels built so far would belong to it
+        network host_reordered(engine, topology, make_options(true));
+        EXPECT_EQ(weights_reorder_kernels_built(engine), 0u);
+
+        network gpu_reordered(engine, topology, make_options(false));
+        tests::compare_outputs(gpu_reordered, host_reordered, input, tolerance);
+    }
+}
+
+TEST(host_weights_reorder, vgg_like_fp32)
+{
+    engine engine;
+    const tensor input_size = { 1, 3, 16, 16 };
+    compare_with_gpu_reorder(engine, vgg_like_topology(engine, data_types::f32, input_size, { 16, 32 }, 64), input_size, 1e-3f);
+}
+
+TEST(host_weights_reorder, vgg_like_batch8_fp32)
+{
+    engine engine;
+    const tensor input_size = { 8, 3, 16, 16 };
+    compare_with_gpu_reorder(engine, vgg_like_topology(engine, data_types::f32, input_size, { 16, 24 }, 40), input_size, 1e-3f);
+}
+
+TEST(host_weights_reorder, residual_fp16)
+{
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    const tensor input_size = { 1, 16, 14, 14 };
+    compare_with_gpu_reorder(engine, residual_topology(engine, data_types::f16, input_size, 2), input_size, 1e-1f);
+}
+
+TEST(host_weights_reorder, DISABLED_load_time_report)
+{
+    engine engine;
+    const auto dt = engine.get_info().supports_fp16 ? data_types::f16 : data_types::f32;
+
+    struct report_case
+    {
+        std::string name;
+        topology net_topology;
+    };
+    const std::vector<report_case> cases = {
+        { "vgg16_like",   vgg_like_topology(engine, dt, { 1, 3, 224, 224 }, { 64, 128, 256, 512, 512 }, 4096) },
+        { "resnet_like",  residual_topology(engine, dt, { 1, 64, 56, 56 }, 16) },
+    };
+
+    std::cout << std::setw(14) << "topology" << std::setw(16) << "gpu reorder ms" << std::setw(16) << "host reorder ms" << std::endl;
+    for (const auto& report_case : cases)
+    {
+        double build_ms[2];
+        for (int host = 0; host < 2; host++)
+        {
+            auto start = std::chrono::high_resolution_clock::now();
+            network network(engine, report_case.net_topology, make_options(host != 0));
+            build_ms[host] = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        }
+        std::cout << std::setw(14) << report_case.name << std::fixed << std::setprecision(1)
+                  << std::setw(16) << build_ms[0] << std::setw(16) << build_ms[1] << std::endl;
+    }
+}
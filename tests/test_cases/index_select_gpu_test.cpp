@@ -24,15 +24,25 @@
 #include <api/CPP/memory.hpp>
 #include <api/CPP/topology.hpp>
 #include <api/CPP/network.hpp>
+#include <api/CPP/reorder.hpp>
 
 #include "test_utils/test_utils.h"
 
 #include <vector>
 #include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
 
 using namespace cldnn;
 using namespace tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 std::vector<float> generate_reference_bfyx(const std::vector<float>& input, const std::vector<int32_t>& indices, index_select_axis_name axis, const size_t b_size, const size_t f_size,
     const size_t y_size, const size_t x_size)
 {
@@ -1235,3 +1245,163 @@ TEST(index_select_gpu, reverse_along_b_yxfb)
         EXPECT_EQ(output_ptr[i], out_data[i]);
     }
 }
+
+template<typename data_t, typename index_t>
+void index_select_rows_random_test(const tensor& in_size, index_select_axis_name axis, const std::vector<int32_t>& indices_data)
+{
+    engine engine;
+    const auto in_size_b = in_size.batch[0];
+    const auto in_size_f = in_size.feature[0];
+    const auto in_size_x = in_size.spatial[0];
+    const auto in_size_y = in_size.spatial[1];
+
+    memory input = memory::allocate(engine, { type_to_data_type<data_t>::value, format::bfyx, in_size });
+    memory indices = memory::allocate(engine, { type_to_data_type<index_t>::value, format::bfyx, { 1, 1, static_cast<int>(indices_data.size()), 1 } });
+
+    // reference works on the values as they are stored
+    auto input_data = generate_random_1d<float>(input.count(), -10, 10);
+    std::vector<data_t> input_typed(input_data.begin(), input_data.end());
+    for (size_t i = 0; i < input_data.size(); ++i)
+        input_data[i] = static_cast<float>(input_typed[i]);
+    set_values(input, input_typed);
+    set_values(indices, std::vector<index_t>(indices_data.begin(), indices_data.end()));
+
+    topology topo(
+        input_layout("input", input.get_layout()),
+        input_layout("indices", indices.get_layout()),
+        index_select("index_select", "input", "indices", axis));
+
+    network net(engine, topo);
+    net.set_input_data("input", input);
+    net.set_input_data("indices", indices);
+    auto output_mem = net.execute().at("index_select").get_memory();
+
+    auto ref = generate_reference_bfyx(input_data, indices_data, axis, in_size_b, in_size_f, in_size_y, in_size_x);
+
+    auto output_ptr = output_mem.pointer<data_t>();
+    ASSERT_EQ(output_ptr.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++)
+    {
+        ASSERT_EQ(static_cast<float>(output_ptr[i]), ref[i]) << "Index=" << i;
+    }
+}
+
+TEST(index_select_gpu, rows_along_b_i64_indices)
+{
+    index_select_rows_random_test<float, int64_t>({ 20, 3, 37, 5 }, index_select_axis_name::along_b, { 19, 0, 7, 7, 3, 12 });
+}
+
+TEST(index_select_gpu, rows_along_f_i64_indices)
+{
+    index_select_rows_random_test<float, int64_t>({ 2, 30, 64, 4 }, index_select_axis_name::along_f, { 29, 1, 1, 5, 0 });
+}
+
+TEST(index_select_gpu, rows_along_y_fp16)
+{
+    index_select_rows_random_test<FLOAT16, int32_t>({ 2, 3, 37, 10 }, index_select_axis_name::along_y, { 9, 2, 2, 0 });
+}
+
+TEST(index_select_gpu, rows_along_b_fp16_input_fp32_output)
+{
+    // fp16 table converted to fp32 by index_select, the reorder to fp32 is fused into it
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    const tensor in_size = { 20, 3, 37, 5 };
+    const std::vector<int32_t> indices_data = { 19, 0, 7, 7, 3, 12 };
+    memory input = memory::allocate(engine, { data_types::f16, format::bfyx, in_size });
+    memory indices = memory::allocate(engine, { data_types::i32, format::bfyx, { 1, 1, static_cast<int>(indices_data.size()), 1 } });
+
+    // values are multiples of 1/8 in [-10, 10], exact in fp16
+    auto input_data = generate_random_1d<float>(input.count(), -10, 10);
+    set_values(input, std::vector<FLOAT16>(input_data.begin(), input_data.end()));
+    set_values(indices, indices_data);
+
+    topology topo(
+        input_layout("input", input.get_layout()),
+        input_layout("indices", indices.get_layout()),
+        index_select("index_select", "input", "indices", index_select_axis_name::along_b),
+        reorder("output", "index_select", format::bfyx, data_types::f32));
+
+    build_options options;
+    options.set_option(build_option::optimize_data(true));
+    network net(engine, topo, options);
+    net.set_input_data("input", input);
+    net.set_input_data("indices", indices);
+
+    auto ids = net.get_all_primitive_ids();
+    EXPECT_EQ(std::find(ids.begin(), ids.end(), "index_select"), ids.end());
+
+    auto output_mem = net.execute().at("output").get_memory();
+    EXPECT_EQ(output_mem.get_layout().data_type, data_types::f32);
+
+    auto ref = generate_reference_bfyx(input_data, indices_data, index_select_axis_name::along_b,
+        in_size.batch[0], in_size.feature[0], in_size.spatial[1], in_size.spatial[0]);
+
+    auto output_ptr = output_mem.pointer<float>();
+    ASSERT_EQ(output_ptr.size(), ref.size());
+    for (size_t i = 0; i < ref.size(); i++)
+    {
+        ASSERT_EQ(output_ptr[i], ref[i]) << "Index=" << i;
+    }
+}
+
+// Embedding lookup: index_select along b of a vocab x width table.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=index_select_gpu.DISABLED_rows_report
+TEST(index_select_gpu, DISABLED_rows_report)
+{
+    engine engine;
+    const int iterations = 20;
+    const int lookups = 4096;
+
+    struct report_case {
+        int vocab;
+        int width;
+    };
+    const std::vector<report_case> cases = {
+        { 1000,     16 },
+        { 1000,     64 },
+        { 100000,   16 },
+        { 100000,   64 },
+        { 100000,   256 },
+        { 1000000,  64 },
+    };
+
+    std::mt19937 rng(1);
+    std::cout << std::setw(10) << "vocab" << std::setw(10) << "width" << std::setw(15) << "Mrows/s" << std::setw(10) << "GB/s" << std::endl;
+    for (const auto& c : cases) {
+        auto table = memory::allocate(engine, { data_types::f32, format::bfyx, { c.vocab, 1, c.width, 1 } });
+        auto indices = memory::allocate(engine, { data_types::i32, format::bfyx, { 1, 1, lookups, 1 } });
+
+        std::uniform_int_distribution<int32_t> dist(0, c.vocab - 1);
+        std::vector<int32_t> indices_data(lookups);
+        for (auto& i : indices_data)
+            i = dist(rng);
+        set_values(indices, indices_data);
+
+        topology topo(
+            input_layout("table", table.get_layout()),
+            input_layout("indices", indices.get_layout()),
+            index_select("index_select", "table", "indices", index_select_axis_name::along_b));
+        network net(engine, topo);
+        net.set_input_data("table", table);
+        net.set_input_data("indices", indices);
+        net.execute().at("index_select").get_event().wait();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            net.execute().at("index_select").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        const double rows_per_second = lookups / seconds;
+        const double bandwidth = 2.0 * lookups * c.width * sizeof(float) / seconds * 1e-9;
+
+        std::cout << std::setw(10) << c.vocab << std::setw(10) << c.width << std::fixed << std::setprecision(2)
+                  << std::setw(15) << rows_per_second * 1e-6 << std::setw(10) << bandwidth << std::endl;
+    }
+}
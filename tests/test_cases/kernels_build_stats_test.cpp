@@ -0,0 +1,64 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/activation.hpp>
+#include <api/CPP/pooling.hpp>
+
+#include "test_utils/test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+TEST(kernels_build_stats, network_build)
+{
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 4, 8, 8 } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(pooling("pool", "relu", pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.execute();
+
+    auto stats = engine.get_kernels_build_stats();
+    ASSERT_FALSE(stats.empty());
+
+    uint32_t kernels = 0;
+    for (const auto& program : stats)
+    {
+        EXPECT_TRUE(program.succeeded);
+        EXPECT_FALSE(program.bucket.empty());
+        EXPECT_GT(program.source_size, 0u);
+        EXPECT_GT(program.jit_defines, 0u);
+        EXPECT_EQ(program.entry_points.size(), program.kernels_count);
+        for (const auto& entry_point : program.entry_points)
+            EXPECT_FALSE(entry_point.empty());
+        kernels += program.kernels_count;
+    }
+    EXPECT_GE(kernels, 2u);
+}
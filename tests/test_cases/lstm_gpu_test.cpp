@@ -33,6 +33,8 @@
 
 #include <sstream>
 #include <iomanip>
+#include <chrono>
+#include <algorithm>
 
 
 using namespace cldnn;
@@ -305,6 +307,71 @@ void generic_lstm_elt_gpu_test(int sequence_len, int direction, int batch_size,
     }
 }
 
+// lstm_elt adding the recurrent term itself (hidden * recurrent^T), as in the fused LSTM sequence.
+// tempGEMM in fyxb is supported only by the reference kernel.
+void lstm_elt_recurrent_ref_test(int batch_size, int hidden_size, bool hasCell) {
+    int min_random = -2, max_random = 2;
+
+    VVVVF<float> ref_tempGEMM = generate_random_4d<float>(batch_size, 1, 1, 4 * hidden_size, min_random, max_random);
+    VVVVF<float> ref_cell = generate_random_4d<float>(batch_size, 1, 1, hidden_size, min_random, max_random);
+    VVVVF<float> ref_hidden = generate_random_4d<float>(batch_size, 1, 1, hidden_size, min_random, max_random);
+    VVVVF<float> ref_recurrent = generate_random_4d<float>(1, 1, 4 * hidden_size, hidden_size, min_random, max_random);
+    VF<float> ref_tempGEMM_vec = flatten_4d<float>(cldnn::format::fyxb, ref_tempGEMM);
+    VF<float> ref_cell_vec = flatten_4d<float>(cldnn::format::bfyx, ref_cell);
+    VF<float> ref_hidden_vec = flatten_4d<float>(cldnn::format::bfyx, ref_hidden);
+    VF<float> ref_recurrent_vec = flatten_4d<float>(cldnn::format::bfyx, ref_recurrent);
+
+    VVVVF<float> ref_gates = ref_tempGEMM;
+    for (int b = 0; b < batch_size; ++b) {
+        for (int y = 0; y < 4 * hidden_size; ++y) {
+            for (int x = 0; x < hidden_size; ++x) {
+                ref_gates[b][0][0][y] += ref_recurrent[0][0][y][x] * ref_hidden[b][0][0][x];
+            }
+        }
+    }
+    VVVVF<float> ref_output = lstm_elt_reference(ref_gates, ref_cell, hasCell);
+
+    engine engine;
+    memory tempGEMM = memory::allocate(engine, { data_types::f32, format::fyxb, { batch_size, 1, 4 * hidden_size, 1 } });
+    memory cell = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, 1 } });
+    memory hidden = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, 1 } });
+    memory recurrent = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, hidden_size, 4 * hidden_size } });
+    set_values(tempGEMM, ref_tempGEMM_vec);
+    set_values(cell, ref_cell_vec);
+    set_values(hidden, ref_hidden_vec);
+    set_values(recurrent, ref_recurrent_vec);
+
+    topology topology;
+    topology.add(input_layout("tempGEMM", tempGEMM.get_layout()));
+    topology.add(input_layout("hidden", hidden.get_layout()));
+    topology.add(data("recurrent", recurrent));
+    if (hasCell) {
+        topology.add(input_layout("cell", cell.get_layout()));
+    }
+    topology.add(lstm_elt("lstm_elt", "tempGEMM", hasCell ? "cell" : "", 0.f, false, {}, {}, cldnn_lstm_offset_order_iofz, 0,
+        padding(), "hidden", "recurrent"));
+
+    network network(engine, topology);
+    network.set_input_data("tempGEMM", tempGEMM);
+    network.set_input_data("hidden", hidden);
+    if (hasCell) {
+        network.set_input_data("cell", cell);
+    }
+
+    auto output = network.execute().at("lstm_elt").get_memory();
+    EXPECT_EQ(output.get_layout().format, format::fyxb);
+    auto output_ptr = output.pointer<float>();
+    for (int b = 0; b < batch_size; ++b) {
+        for (int j = 0; j < 2; ++j) {
+            for (int x = 0; x < hidden_size; ++x)
+            {
+                auto idx = (j * hidden_size + x) * batch_size + b;
+                EXPECT_NEAR(ref_output[b][j][0][x], output_ptr[idx], FERROR);
+            }
+        }
+    }
+}
+
 std::string get_string_id(size_t i) {
     std::stringstream ss;
     ss << std::setw(5) << std::setfill('0') << i;
@@ -1039,6 +1106,81 @@ void lstm_gpu_users_test() {
 }
 
 
+
+// -------------------------------------------------------
+// random data of a single lstm layer
+struct lstm_sequence_data {
+    lstm_sequence_data(const engine& engine, int sequence_len, int direction, int batch_size, int input_size, int hidden_size)
+        : input(memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, sequence_len, input_size, 1 } }))
+        , hidden(memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, direction } }))
+        , cell(memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, 1, hidden_size, direction } }))
+        , weights(memory::allocate(engine, { data_types::f32, format::bfyx, { 1, direction, input_size, 4 * hidden_size } }))
+        , recurrent(memory::allocate(engine, { data_types::f32, format::bfyx, { 1, direction, hidden_size, 4 * hidden_size } }))
+        , biases(memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 4 * hidden_size, direction } }))
+        , sequence_len(sequence_len) {
+        for (auto& mem : { input, hidden, cell, weights, recurrent, biases })
+            tests::set_random_values<float>(mem, true, 8, 4);
+    }
+
+    memory input, hidden, cell, weights, recurrent, biases;
+    int sequence_len;
+};
+
+// builds lstm layer over a split sequence input, with or without hoisting of the input GEMM
+network build_lstm_sequence_network(const engine& engine, const lstm_sequence_data& lstm_data, bool sequence_fusion) {
+    std::vector<std::pair<primitive_id, tensor>> input_ids_offsets;
+    std::vector<primitive_id> lstm_inputs;
+    for (int i = 0; i < lstm_data.sequence_len; ++i) {
+        input_ids_offsets.push_back({ get_string_id(i), { 0, i, 0, 0 } });
+        lstm_inputs.push_back("inputSplit:" + get_string_id(i));
+    }
+
+    topology topology;
+    topology.add(input_layout("input", lstm_data.input.get_layout()));
+    topology.add(input_layout("hidden", lstm_data.hidden.get_layout()));
+    topology.add(input_layout("cell", lstm_data.cell.get_layout()));
+    topology.add(split("inputSplit", "input", input_ids_offsets));
+    topology.add(data("weights", lstm_data.weights));
+    topology.add(data("recurrent", lstm_data.recurrent));
+    topology.add(data("biases", lstm_data.biases));
+    topology.add(lstm("lstm", lstm_inputs, "weights", "recurrent", "biases", "hidden", "cell"));
+
+    build_options options;
+    options.set_option(build_option::lstm_sequence_fusion(sequence_fusion));
+    network network(engine, topology, options);
+    network.set_input_data("input", lstm_data.input);
+    network.set_input_data("hidden", lstm_data.hidden);
+    network.set_input_data("cell", lstm_data.cell);
+    return network;
+}
+
+void lstm_sequence_fusion_test(int sequence_len, int direction, int batch_size, int input_size, int hidden_size) {
+    engine engine;
+    lstm_sequence_data lstm_data(engine, sequence_len, direction, batch_size, input_size, hidden_size);
+    auto fused = build_lstm_sequence_network(engine, lstm_data, true);
+    auto unrolled = build_lstm_sequence_network(engine, lstm_data, false);
+
+    auto fused_output = fused.execute().at("lstm").get_memory();
+    auto unrolled_output = unrolled.execute().at("lstm").get_memory();
+    ASSERT_EQ(fused_output.get_layout().size, unrolled_output.get_layout().size);
+
+    // input GEMM is computed once per direction and sliced into gates of each time step
+    auto executed = fused.get_executed_primitive_ids();
+    auto is_executed = [&](const primitive_id& id) { return std::find(executed.begin(), executed.end(), id) != executed.end(); };
+    for (int dir = 0; dir < direction; ++dir) {
+        EXPECT_TRUE(is_executed("lstm:lstm_gemm_seq" + get_string_id(dir))) << "direction = " << dir;
+        for (int i = 0; i < sequence_len; ++i) {
+            EXPECT_TRUE(is_executed("lstm:gates" + get_string_id(i + dir * sequence_len))) << "direction = " << dir << ", i = " << i;
+        }
+    }
+
+    auto fused_ptr = fused_output.pointer<float>();
+    auto unrolled_ptr = unrolled_output.pointer<float>();
+    for (size_t i = 0; i < fused_output.get_layout().count(); ++i) {
+        ASSERT_NEAR(unrolled_ptr[i], fused_ptr[i], 1e-3f) << "i = " << i;
+    }
+}
+
 TEST(lstm_gemm_gpu, generic_lstm_gemm_test_f32) {
     generic_lstm_gemm_gpu_test<float>(1, 1, 3, 6, 2, true, true);
 }
@@ -1055,6 +1197,24 @@ TEST(lstm_gemm_gpu, generic_lstm_gemm_no_hidden_bias_f32) {
     generic_lstm_gemm_gpu_test<float>(1, 1, 3, 6, 2, false, false);
 }
 
+TEST(lstm_gemm_gpu, sequence_input_with_bidirectional_weights_error) {
+    // output of a sequence GEMM has no direction dimension, so weights of two directions can't be used
+    const int batch_size = 2, sequence_len = 3, input_size = 5, hidden_size = 4, directions = 2;
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { batch_size, sequence_len, input_size, 1 } });
+    auto weights = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, directions, input_size, 4 * hidden_size } });
+    auto recurrent = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, directions, hidden_size, 4 * hidden_size } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("weights", weights));
+    topology.add(data("recurrent", recurrent));
+    topology.add(lstm_gemm("lstm_gemm", "input", "weights", "recurrent"));
+
+    EXPECT_ANY_THROW(network(engine, topology));
+}
+
 TEST(lstm_elt_gpu, generic_lstm_elt_test_clip_f32) {
     generic_lstm_elt_gpu_test<float>(1, 1, 4, 6, 3, true, 0.3f);
 }
@@ -1075,6 +1235,14 @@ TEST(lstm_elt_gpu, generic_lstm_elt_no_cell_f32) {
     generic_lstm_elt_gpu_test<float>(1, 1, 4, 6, 3, false);
 }
 
+TEST(lstm_elt_gpu, recurrent_term_ref_f32) {
+    lstm_elt_recurrent_ref_test(3, 5, true);
+}
+
+TEST(lstm_elt_gpu, recurrent_term_ref_no_cell_f32) {
+    lstm_elt_recurrent_ref_test(3, 5, false);
+}
+
 TEST(lstm_custom_gpu, generic_lstm_custom_f32) {
     generic_lstm_custom_gpu_test<float>(3, 1, 3, 3, 2, true, true, true);
 }
@@ -1252,6 +1420,47 @@ TEST(lstm_gpu, lstm_users_f32) {
     lstm_gpu_users_test<float>();
 }
 
+// input GEMM hoisted out of the time loop
+TEST(lstm_gpu, sequence_fusion_f32) {
+    lstm_sequence_fusion_test(7, 1, 3, 21, 18);
+}
+
+TEST(lstm_gpu, sequence_fusion_bi_f32) {
+    lstm_sequence_fusion_test(7, 2, 2, 9, 37);
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=lstm_gpu.DISABLED_sequence_fusion_latency_report
+TEST(lstm_gpu, DISABLED_sequence_fusion_latency_report) {
+    const int iterations = 20;
+    const int batch_size = 1;
+    const int input_size = 256;
+    engine engine;
+
+    std::cout << std::setw(8) << "seq" << std::setw(8) << "hidden" << std::setw(6) << "dir"
+              << std::setw(16) << "unrolled ms" << std::setw(16) << "fused ms" << std::endl;
+    for (int sequence_len : { 10, 50, 100 }) {
+        for (int hidden_size : { 128, 512 }) {
+            for (int direction : { 1, 2 }) {
+                lstm_sequence_data lstm_data(engine, sequence_len, direction, batch_size, input_size, hidden_size);
+                double latency_ms[2];
+                for (bool sequence_fusion : { false, true }) {
+                    auto network = build_lstm_sequence_network(engine, lstm_data, sequence_fusion);
+                    network.execute().at("lstm").get_event().wait();
+
+                    auto start = std::chrono::high_resolution_clock::now();
+                    for (int i = 0; i < iterations; ++i)
+                        network.execute().at("lstm").get_event().wait();
+                    auto end = std::chrono::high_resolution_clock::now();
+                    latency_ms[sequence_fusion] = std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+                }
+                std::cout << std::setw(8) << sequence_len << std::setw(8) << hidden_size << std::setw(6) << direction
+                          << std::fixed << std::setprecision(3)
+                          << std::setw(16) << latency_ms[0] << std::setw(16) << latency_ms[1] << std::endl;
+            }
+        }
+    }
+}
+
 // TODO: Add tests for the following:
 // integration testing using multi-layer and chained LSTMs
 // LSTMs single input
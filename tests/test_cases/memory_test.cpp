@@ -26,9 +26,17 @@
 #include <api/CPP/pooling.hpp>
 #include <api/CPP/concatenation.hpp>
 #include <api/CPP/data.hpp>
+#include <api/CPP/eltwise.hpp>
 
 #include "test_utils/test_utils.h"
 
+#include <chrono>
+#include <experimental/filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+
 using namespace cldnn;
 using namespace tests;
 
@@ -453,4 +461,169 @@ TEST(memory_pool, shared_dep_two_output) {
     network network(engine, topo, bo);
     auto outputs = network.execute();
     EXPECT_EQ(engine.get_max_used_device_memory_size(), (uint64_t)256);
-}
\ No newline at end of file
+}
+
+namespace
+{
+    // reads csv written by memory pool report, fields are returned without quotes
+    std::vector<std::vector<std::string>> read_report_csv(const std::string& path)
+    {
+        std::vector<std::vector<std::string>> rows;
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line); // header
+        while (std::getline(file, line))
+        {
+            std::vector<std::string> row;
+            std::string field;
+            std::istringstream line_stream(line);
+            while (std::getline(line_stream, field, ','))
+            {
+                field.erase(std::remove(field.begin(), field.end(), '"'), field.end());
+                row.push_back(field);
+            }
+            rows.push_back(row);
+        }
+        return rows;
+    }
+}
+
+TEST(memory_pool, occupancy_report_reused_buffer) {
+    // input(256B) -> relu(256B) -> relu1(256B) -> pool1(64B) -> pool2(64B) -> pool3(64B)
+    // pool1 and pool2 have to reuse buffers allocated for relu and relu1.
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(4, 4), feature(4), batch(1)) } });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(activation("relu", "input", activation_relu));
+    topology.add(activation("relu1", "relu", activation_relu));
+    topology.add(pooling("pool1", "relu1", pooling_mode::max, { 1,1,2,2 }, { 1,1,2,2 }));
+    topology.add(pooling("pool2", "pool1", pooling_mode::max, { 1,1,1,1 }, { 1,1,1,1 }));
+    topology.add(pooling("pool3", "pool2", pooling_mode::max, { 1,1,1,1 }, { 1,1,1,1 }));
+
+    // graph and memory pool dumps go to a private directory which is removed when the test is done
+    namespace fs = std::experimental::filesystem;
+    const auto dump_dir = fs::temp_directory_path() / ("cldnn_memory_pool_report_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    fs::create_directories(dump_dir);
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    bo.set_option(build_option::graph_dumps_dir(dump_dir.string()));
+
+    network network(engine, topology, bo);
+
+    const auto prefix = (dump_dir / ("cldnn_memory_pool_" + std::to_string(network.get_id()))).string();
+    auto steps = read_report_csv(prefix + "_steps.csv");
+    auto records = read_report_csv(prefix + "_records.csv");
+    std::ifstream json_file(prefix + ".json");
+    const std::string json((std::istreambuf_iterator<char>(json_file)), std::istreambuf_iterator<char>());
+    json_file.close();
+    fs::remove_all(dump_dir);
+
+    // live bytes over processing order - input and output are not allocated from the pool, but are counted as live
+    std::map<std::string, uint64_t> live_bytes;
+    for (const auto& step : steps)
+    {
+        ASSERT_EQ(step.size(), (size_t)4);
+        live_bytes[step[1]] = std::stoull(step[2]);
+    }
+    ASSERT_EQ(steps.size(), (size_t)6);
+    EXPECT_EQ(live_bytes["input"], (uint64_t)256);
+    EXPECT_EQ(live_bytes["relu"], (uint64_t)512);
+    EXPECT_EQ(live_bytes["relu1"], (uint64_t)512);
+    EXPECT_EQ(live_bytes["pool1"], (uint64_t)320);
+    EXPECT_EQ(live_bytes["pool2"], (uint64_t)128);
+    EXPECT_EQ(live_bytes["pool3"], (uint64_t)128);
+
+    // two 256B buffers, each one shared by a 256B and a 64B tensor: reuse doesn't introduce slack,
+    // but pooling outputs use only quarter of the buffer
+    std::map<std::string, uint64_t> record_bytes;
+    std::map<std::string, uint64_t> max_used_bytes;
+    for (const auto& rec : records)
+    {
+        ASSERT_EQ(rec.size(), (size_t)8);
+        record_bytes[rec[0]] = std::stoull(rec[2]);
+        max_used_bytes[rec[0]] = std::max(max_used_bytes[rec[0]], (uint64_t)std::stoull(rec[4]));
+        if (rec[3] == "pool1" || rec[3] == "pool2")
+        {
+            EXPECT_DOUBLE_EQ(std::stod(rec[5]), 0.25);
+        }
+    }
+    EXPECT_EQ(records.size(), (size_t)4);
+    ASSERT_EQ(record_bytes.size(), (size_t)2);
+    for (const auto& rec : record_bytes)
+    {
+        EXPECT_EQ(rec.second, (uint64_t)256);
+        EXPECT_EQ(rec.second - max_used_bytes[rec.first], (uint64_t)0);
+    }
+
+    EXPECT_NE(json.find("\"allocated_bytes\": 512,"), std::string::npos);
+    EXPECT_NE(json.find("\"slack_bytes\": 0,"), std::string::npos);
+    EXPECT_NE(json.find("\"lower_bound_bytes\": 512,"), std::string::npos);
+}
+
+namespace
+{
+    // chain of 'length' relu -> sum blocks, each sum adds output of the previous block and the network input,
+    // so input is alive through the whole network
+    topology skip_connections_chain(const layout& input_layout_desc, int length)
+    {
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        primitive_id last = "input";
+        for (int i = 0; i < length; i++)
+        {
+            const auto relu_id = "relu" + std::to_string(i);
+            const auto sum_id = "sum" + std::to_string(i);
+            topology.add(activation(relu_id, last, activation_relu));
+            topology.add(eltwise(sum_id, relu_id, "input", eltwise_mode::sum));
+            last = sum_id;
+        }
+        return topology;
+    }
+}
+
+TEST(memory_pool, skip_connections_chain) {
+    // input is added to each block output, so it can't be overwritten by any of them
+    engine engine;
+    const int length = 50;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ tensor(spatial(2, 2), feature(1), batch(1)) } });
+    set_values(input, { 1.f, 2.f, 3.f, 4.f });
+
+    build_options bo;
+    bo.set_option(build_option::optimize_data(true));
+    network network(engine, skip_connections_chain(input.get_layout(), length), bo);
+    network.set_input_data("input", input);
+    auto output = network.execute().at("sum" + std::to_string(length - 1)).get_memory();
+    auto output_ptr = output.pointer<float>();
+
+    std::vector<float> expected = { 1.f, 2.f, 3.f, 4.f };
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_FLOAT_EQ(expected[i] * (length + 1), output_ptr[i]) << "i = " << i;
+    }
+}
+
+// Network build time for synthetic graphs up to 10k nodes (memory dependencies and pool assignment dominate it
+// for large graphs):
+//   tests --gtest_also_run_disabled_tests --gtest_filter=*memory_pool*large_graph_build_report*
+TEST(memory_pool, DISABLED_large_graph_build_report) {
+    engine engine;
+    const layout input_layout_desc = { data_types::f32, format::bfyx,{ tensor(spatial(8, 8), feature(16), batch(1)) } };
+
+    std::cout << std::setw(8) << "nodes" << std::setw(12) << "build ms" << std::endl;
+    for (int length : { 500, 1000, 2500, 5000 })
+    {
+        auto topology = skip_connections_chain(input_layout_desc, length);
+        build_options bo;
+        bo.set_option(build_option::optimize_data(true));
+
+        auto start = std::chrono::high_resolution_clock::now();
+        network network(engine, topology, bo);
+        const auto build_ms = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+        std::cout << std::setw(8) << 2 * length + 1 << std::fixed << std::setprecision(1) << std::setw(12) << build_ms << std::endl;
+    }
+}
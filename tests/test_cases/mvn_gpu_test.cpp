@@ -355,4 +355,60 @@ TEST(mvn_gpu_test, mvn_test_within_channels_bfyx_normalize_variance_fp16)
 
     auto output = outputs.begin()->second.get_memory();
     mvn_compute_mean_within_channels_bfyx<FLOAT16>(output, true);
-}
\ No newline at end of file
+}
+
+TEST(mvn_gpu_test, mvn_test_across_channels_bfyx_large_normalize_variance)
+{
+    //mvn accross channels fp32 test, whole 1x32x128x128 input is reduced by one work-group
+    using namespace cldnn;
+    using namespace tests;
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx,{ 1, 32, 128, 128 } });
+
+    tests::set_random_values<float>(input, true, 8, 100);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(mvn("mvn", "input", true, true));
+
+    network network(engine, topology);
+
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "mvn");
+
+    auto output = outputs.begin()->second.get_memory();
+    mvn_compute_mean_accross_channels_bfyx<float>(output, true);
+}
+
+TEST(mvn_gpu_test, mvn_test_within_channels_bfyx_large_normalize_variance_fp16)
+{
+    //mvn within channels fp16 test with 256x256 spatial planes
+    using namespace cldnn;
+    using namespace tests;
+
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f16, format::bfyx,{ 2, 3, 256, 256 } });
+
+    tests::set_random_values<FLOAT16>(input, true, 8, 100);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(mvn("mvn", "input", false, true));
+
+    network network(engine, topology);
+
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+    EXPECT_EQ(outputs.size(), size_t(1));
+    EXPECT_EQ(outputs.begin()->first, "mvn");
+
+    auto output = outputs.begin()->second.get_memory();
+    mvn_compute_mean_within_channels_bfyx<FLOAT16>(output, true);
+}
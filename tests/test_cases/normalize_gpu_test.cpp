@@ -0,0 +1,116 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/normalize.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include "test_utils/test_utils.h"
+#include "float16.h"
+
+#include <cmath>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace
+{
+    // across spatial L2 normalization: one norm per batch over the whole f*y*x volume, then per-feature scale
+    std::vector<float> normalize_across_spatial_ref(const std::vector<float>& input, const std::vector<float>& scale,
+        const tensor& size, float epsilon)
+    {
+        const size_t batch = size.batch[0];
+        const size_t volume = input.size() / batch;
+        const size_t spatial = size.spatial[0] * size.spatial[1];
+        const float threshold = 0.0001f;
+
+        std::vector<float> output(input.size());
+        for (size_t b = 0; b < batch; b++)
+        {
+            float norm = epsilon;
+            for (size_t i = 0; i < volume; i++)
+                norm += input[b * volume + i] * input[b * volume + i];
+            norm = norm <= threshold ? 0.f : 1.f / std::sqrt(norm);
+
+            for (size_t i = 0; i < volume; i++)
+                output[b * volume + i] = norm * input[b * volume + i] * scale[i / spatial];
+        }
+        return output;
+    }
+
+    template <typename T>
+    void test_normalize_across_spatial(const engine& engine, data_types dt, const tensor& size, float tolerance)
+    {
+        const float epsilon = 1e-10f;
+        const auto input_values = generate_random_1d<float>(size.count(), -4, 4);
+        const auto scale_values = generate_random_1d<float>(size.feature[0], 1, 4);
+        const std::vector<T> input_data(input_values.begin(), input_values.end());
+        const std::vector<T> scale_data(scale_values.begin(), scale_values.end());
+
+        auto input = memory::allocate(engine, { dt, format::bfyx, size });
+        auto scale = memory::allocate(engine, { dt, format::bfyx, { 1, 1, size.feature[0], 1 } });
+        set_values(input, input_data);
+        set_values(scale, scale_data);
+
+        topology topology;
+        topology.add(input_layout("input", input.get_layout()));
+        topology.add(data("scale", scale));
+        topology.add(normalize("normalize", "input", "scale", true, epsilon));
+
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto outputs = network.execute();
+        EXPECT_EQ(outputs.size(), size_t(1));
+        EXPECT_EQ(outputs.begin()->first, "normalize");
+
+        // reference is computed on the values as stored on the device
+        const auto reference = normalize_across_spatial_ref(std::vector<float>(input_data.begin(), input_data.end()),
+            std::vector<float>(scale_data.begin(), scale_data.end()), size, epsilon);
+
+        auto output_ptr = outputs.at("normalize").get_memory().pointer<T>();
+        ASSERT_EQ(output_ptr.size(), reference.size());
+        for (size_t i = 0; i < reference.size(); i++)
+            ASSERT_NEAR(reference[i], static_cast<float>(output_ptr[i]), tolerance) << "at index " << i;
+    }
+}
+
+TEST(normalize_gpu, across_spatial_bfyx_batch2_fp32)
+{
+    // f*y*x = 4096 is reduced by one work-group per batch
+    engine engine;
+    test_normalize_across_spatial<float>(engine, data_types::f32, { 2, 16, 16, 16 }, 1e-4f);
+}
+
+TEST(normalize_gpu, across_spatial_bfyx_batch3_fp16)
+{
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    // f*y*x = 960, odd spatial sizes leave a partial last stride of the work-group
+    test_normalize_across_spatial<FLOAT16>(engine, data_types::f16, { 3, 8, 12, 10 }, 1e-2f);
+}
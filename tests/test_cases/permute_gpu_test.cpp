@@ -26,14 +26,22 @@
 #include "test_utils/test_utils.h"
 #include <api/CPP/data.hpp>
 
+#include <chrono>
 #include <cmath>
 #include <gmock/gmock.h>
+#include <iomanip>
 #include <limits>
+#include <sstream>
 
 using namespace cldnn;
 using namespace tests;
 using namespace testing;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 TEST(permute_gpu_f32, basic_bfyx_permute_0_1_3_2)
 {
     //  Input               : bfyx:2x2x3x2
@@ -338,4 +346,144 @@ TEST(permute_gpu_i32, basic_bfyx_permute_0_1_3_2) {
 
 TEST(permute_gpu_i64, basic_bfyx_permute_0_1_3_2) {
     permute_test_with_reorder<data_types::i64>();
-}
\ No newline at end of file
+}
+namespace {
+    // expected output computed on host: output dimension i takes coordinate of input dimension order[i],
+    // dimensions are in the order of the format
+    template <typename T>
+    std::vector<T> permute_reference(const std::vector<T>& input, const std::vector<tensor::value_type>& sizes, const std::vector<uint16_t>& order) {
+        std::vector<tensor::value_type> out_sizes(4);
+        for (size_t i = 0; i < 4; ++i)
+            out_sizes[i] = sizes[order[i]];
+
+        std::vector<T> output(input.size());
+        size_t out_linear = 0;
+        std::vector<tensor::value_type> out_idx(4), in_idx(4);
+        for (out_idx[0] = 0; out_idx[0] < out_sizes[0]; ++out_idx[0])
+        for (out_idx[1] = 0; out_idx[1] < out_sizes[1]; ++out_idx[1])
+        for (out_idx[2] = 0; out_idx[2] < out_sizes[2]; ++out_idx[2])
+        for (out_idx[3] = 0; out_idx[3] < out_sizes[3]; ++out_idx[3]) {
+            for (size_t i = 0; i < 4; ++i)
+                in_idx[order[i]] = out_idx[i];
+            const size_t in_linear = ((in_idx[0] * sizes[1] + in_idx[1]) * sizes[2] + in_idx[2]) * sizes[3] + in_idx[3];
+            output[out_linear++] = input[in_linear];
+        }
+        return output;
+    }
+
+    template <typename T>
+    void permute_random_test(format fmt, const tensor& size, const std::vector<uint16_t>& order) {
+        engine engine;
+        const auto dt = type_to_data_type<T>::value;
+        if (dt == data_types::f16 && !engine.get_info().supports_fp16) {
+            std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+            EXPECT_EQ(1, 1);
+            return;
+        }
+
+        auto input = memory::allocate(engine, { dt, fmt, size });
+        set_random_values<T>(input, true);
+        std::vector<T> input_data;
+        {
+            auto input_ptr = input.template pointer<T>();
+            input_data.assign(input_ptr.begin(), input_ptr.end());
+        }
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            permute("permute", "input", order));
+
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto output = network.execute().at("permute").get_memory();
+
+        const auto expected = permute_reference(input_data, size.sizes(fmt), order);
+        auto output_ptr = output.pointer<T>();
+        ASSERT_EQ(expected.size(), output_ptr.size());
+        for (size_t i = 0; i < expected.size(); ++i) {
+            ASSERT_EQ(static_cast<float>(expected[i]), static_cast<float>(output_ptr[i])) << "i = " << i;
+        }
+    }
+}
+
+// tiled transposes, innermost dimension changes
+TEST(permute_gpu_f32, tiled_bfyx_permute_0_2_3_1) {
+    permute_random_test<float>(format::bfyx, { 2, 35, 33, 17 }, { 0, 2, 3, 1 });
+}
+
+TEST(permute_gpu_f32, tiled_bfyx_permute_0_3_1_2) {
+    permute_random_test<float>(format::bfyx, { 2, 64, 7, 9 }, { 0, 3, 1, 2 });
+}
+
+TEST(permute_gpu_f32, tiled_bfyx_permute_0_1_3_2) {
+    permute_random_test<float>(format::bfyx, { 3, 5, 40, 70 }, { 0, 1, 3, 2 });
+}
+
+TEST(permute_gpu_f32, tiled_byxf_permute_3_2_0_1) {
+    permute_random_test<float>(format::byxf, { 2, 48, 5, 33 }, { 3, 2, 0, 1 });
+}
+
+TEST(permute_gpu_f16, tiled_bfyx_permute_0_2_3_1) {
+    permute_random_test<FLOAT16>(format::bfyx, { 1, 96, 14, 14 }, { 0, 2, 3, 1 });
+}
+
+// innermost dimension is kept, rows are copied with vector loads
+TEST(permute_gpu_f32, vectorized_bfyx_permute_0_2_1_3) {
+    permute_random_test<float>(format::bfyx, { 2, 12, 5, 16 }, { 0, 2, 1, 3 });
+}
+
+TEST(permute_gpu_f32, vectorized_bfyx_permute_1_0_2_3_odd_row) {
+    permute_random_test<float>(format::bfyx, { 3, 4, 6, 7 }, { 1, 0, 2, 3 });
+}
+
+TEST(permute_gpu_f16, vectorized_yxfb_permute_1_0_2_3) {
+    permute_random_test<FLOAT16>(format::yxfb, { 8, 3, 4, 5 }, { 1, 0, 2, 3 });
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=permute_gpu_f32.DISABLED_bandwidth_report
+TEST(permute_gpu_f32, DISABLED_bandwidth_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        std::string name;
+        tensor size;
+        std::vector<uint16_t> order;
+    };
+    std::vector<report_case> cases;
+    for (const auto& size : { tensor(1, 64, 112, 112), tensor(8, 256, 28, 28), tensor(32, 116, 14, 14) }) {
+        cases.push_back({ "copy",           size, { 0, 1, 2, 3 } });
+        cases.push_back({ "nchw->nhwc",     size, { 0, 2, 3, 1 } });
+        cases.push_back({ "nhwc->nchw",     size, { 0, 3, 1, 2 } });
+        cases.push_back({ "hw transpose",   size, { 0, 1, 3, 2 } });
+        cases.push_back({ "shuffle",        size, { 0, 2, 1, 3 } });
+    }
+
+    std::cout << std::setw(16) << "permute" << std::setw(20) << "input"
+              << std::setw(10) << "GB/s" << std::setw(12) << "% of copy" << std::endl;
+    double copy_bandwidth = 0.0;
+    for (const auto& c : cases) {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, c.size });
+        topology topology(
+            input_layout("input", input.get_layout()),
+            permute("permute", "input", c.order));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        network.execute().at("permute").get_event().wait();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("permute").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        // every element is read and written once
+        const double bandwidth = 2.0 * input.get_layout().bytes_count() / seconds * 1e-9;
+        if (c.name == "copy")
+            copy_bandwidth = bandwidth;
+
+        std::stringstream size;
+        size << c.size.batch[0] << "x" << c.size.feature[0] << "x" << c.size.spatial[1] << "x" << c.size.spatial[0];
+        std::cout << std::setw(16) << c.name << std::setw(20) << size.str() << std::fixed << std::setprecision(1)
+                  << std::setw(10) << bandwidth << std::setw(12) << 100.0 * bandwidth / copy_bandwidth << std::endl;
+    }
+}
@@ -0,0 +1,201 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/reorder.hpp>
+#include <api/CPP/eltwise.hpp>
+#include <api/CPP/crop.hpp>
+#include <api/CPP/concatenation.hpp>
+#include <api/CPP/permute.hpp>
+#include <api/CPP/scale.hpp>
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+using namespace cldnn;
+using namespace tests;
+
+/*
+    Constant subgraphs are folded on host during network build, results are added to a non-constant input.
+    Build time report (folding on host vs building and executing the constant subgraph as a network, which is what
+    folding used to do) is disabled by default:
+        tests --gtest_also_run_disabled_tests --gtest_filter=*propagate_constants*report*
+*/
+namespace
+{
+    bool has_primitive(const network& network, const primitive_id& id)
+    {
+        auto ids = network.get_all_primitive_ids();
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+
+    // constants folded on host are not compiled, only kernels of the remaining primitives are built
+    uint32_t kernels_built(const engine& engine)
+    {
+        uint32_t kernels = 0;
+        for (const auto& program : engine.get_kernels_build_stats())
+            kernels += program.kernels_count;
+        return kernels;
+    }
+}
+
+TEST(propagate_constants, reorder_and_eltwise_folded) {
+    //  input -----------------------------> sum
+    //  a (yxfb) -> reorder (bfyx) -> prod -/
+    //  b (bfyx) --------------------/
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto a = memory::allocate(engine, { data_types::f32, format::yxfb, { 1, 2, 2, 2 } });
+    auto b = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    set_values(input, { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f });
+    // yxfb: f0 and f1 of each position are interleaved
+    set_values(a, { 1.f, 5.f, 2.f, 6.f, 3.f, 7.f, 4.f, 8.f });
+    set_values(b, { 2.f, 2.f, 2.f, 2.f, -1.f, -1.f, -1.f, -1.f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("a", a));
+    topology.add(data("b", b));
+    topology.add(reorder("a_bfyx", "a", format::bfyx, data_types::f32));
+    topology.add(eltwise("prod", "a_bfyx", "b", eltwise_mode::prod));
+    topology.add(eltwise("sum", "input", "prod", eltwise_mode::sum));
+
+    network network(engine, topology);
+    EXPECT_TRUE(has_primitive(network, "_cldnn_const_prop_prod"));
+    EXPECT_FALSE(has_primitive(network, "a_bfyx"));
+
+    std::vector<float> expected = { 3.f, 6.f, 9.f, 12.f, 0.f, 0.f, 0.f, 0.f };
+    auto actual = execute(network, input, "sum");
+    EXPECT_EQ(kernels_built(engine), 1u);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], actual[i]) << "i = " << i;
+}
+
+TEST(propagate_constants, crop_concat_permute_scale_folded) {
+    //  input ----------------------------------------------------------> sum
+    //  c1 -> crop -> concat (along f) -> permute (swap x and y) -> scale -/
+    //  c2 ---------/                                 per_feature -/
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto c1 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 3, 2 } });
+    auto c2 = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 1, 2, 2 } });
+    auto per_feature = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 1, 1 } });
+    set_values(input, { 100.f, 100.f, 100.f, 100.f, 100.f, 100.f, 100.f, 100.f });
+    set_values(c1, { 0.f, 1.f, 2.f, 3.f, 4.f, 5.f });
+    set_values(c2, { 10.f, 20.f, 30.f, 40.f });
+    set_values(per_feature, { 1.f, 2.f });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(data("c1", c1));
+    topology.add(data("c2", c2));
+    topology.add(data("per_feature", per_feature));
+    topology.add(crop("crop", "c1", { 1, 1, 2, 2 }, { 0, 0, 1, 0 }));
+    topology.add(concatenation("concat", { "crop", "c2" }, concatenation::along_f));
+    topology.add(permute("permute", "concat", { 0, 1, 3, 2 }));
+    topology.add(scale("scale", "permute", "per_feature"));
+    topology.add(eltwise("sum", "input", "scale", eltwise_mode::sum));
+
+    network network(engine, topology);
+    EXPECT_TRUE(has_primitive(network, "_cldnn_const_prop_scale"));
+    EXPECT_FALSE(has_primitive(network, "concat"));
+
+    std::vector<float> expected = { 101.f, 104.f, 102.f, 105.f, 120.f, 160.f, 140.f, 180.f };
+    auto actual = execute(network, input, "sum");
+    EXPECT_EQ(kernels_built(engine), 1u);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], actual[i]) << "i = " << i;
+}
+
+TEST(propagate_constants, DISABLED_build_time_report) {
+    //  input ---------------------------------------------------------------> sum
+    //  w (yxfb) -> reorder (bfyx) -> prod -> concat (along f) -> permute -/
+    //  factors ---------------------/        /
+    //  extra ---------------------------------
+    const int iterations = 5;
+    const tensor part_size = { 64, 256, 3, 3 };
+    const tensor output_size = { 128, 256, 3, 3 };
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, output_size });
+    auto w = memory::allocate(engine, { data_types::f32, format::yxfb, part_size });
+    auto factors = memory::allocate(engine, { data_types::f32, format::bfyx, part_size });
+    auto extra = memory::allocate(engine, { data_types::f32, format::bfyx, part_size });
+    tests::set_random_values<float>(input);
+    tests::set_random_values<float>(w);
+    tests::set_random_values<float>(factors);
+    tests::set_random_values<float>(extra);
+
+    auto constant_subgraph = [&](topology& topology)
+    {
+        topology.add(reorder("w_bfyx", "w", format::bfyx, data_types::f32));
+        topology.add(eltwise("prod", "w_bfyx", "factors", eltwise_mode::prod));
+        topology.add(concatenation("concat", { "prod", "extra" }, concatenation::along_b));
+        topology.add(permute("permute", "concat", { 0, 1, 3, 2 }));
+    };
+
+    topology folded;
+    folded.add(input_layout("input", input.get_layout()));
+    folded.add(data("w", w), data("factors", factors), data("extra", extra));
+    constant_subgraph(folded);
+    folded.add(eltwise("sum", "input", "permute", eltwise_mode::sum));
+
+    // the constant subgraph as a network with its data as inputs
+    topology subgraph;
+    subgraph.add(input_layout("w", w.get_layout()), input_layout("factors", factors.get_layout()), input_layout("extra", extra.get_layout()));
+    constant_subgraph(subgraph);
+
+    double host_ms = 0.0;
+    double network_ms = 0.0;
+    for (int i = 0; i < iterations; i++)
+    {
+        auto start = std::chrono::high_resolution_clock::now();
+        {
+            network network(engine, folded);
+        }
+        host_ms += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        start = std::chrono::high_resolution_clock::now();
+        {
+            network network(engine, subgraph);
+            network.set_input_data("w", w);
+            network.set_input_data("factors", factors);
+            network.set_input_data("extra", extra);
+            network.execute().at("permute").get_memory().pointer<float>();
+        }
+        network_ms += std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+    }
+
+    std::cout << std::fixed << std::setprecision(1)
+              << "build with constants folded on host: " << host_ms << " ms" << std::endl
+              << "constant subgraph as internal network: " << network_ms << " ms (added to build without host folding)" << std::endl;
+}
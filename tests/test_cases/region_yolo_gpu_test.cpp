@@ -0,0 +1,276 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <api/CPP/engine.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/region_yolo.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/float16.h"
+
+#include <vector>
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+using namespace cldnn;
+
+using namespace cldnn;
+using namespace tests;
+
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
+namespace
+{
+    // [image_id, label, confidence, xmin, ymin, xmax, ymax]
+    using detection = std::array<float, 7>;
+
+    float logistic(float x)
+    {
+        return 1.f / (1.f + std::exp(-x));
+    }
+
+    // Host version of region_yolo_gpu_detect.cl, detections in the order of (image, anchor, cell, class).
+    std::vector<detection> region_yolo_detect_reference(const std::vector<float>& data, int batch, int height, int width,
+                                                        int classes, bool do_softmax, const std::vector<float>& anchors, float threshold)
+    {
+        const int num = static_cast<int>(anchors.size() / 2);
+        const int entries = classes + 5;
+        auto at = [&](int b, int n, int entry, int y, int x)
+        {
+            return data[((static_cast<size_t>(b) * num * entries + n * entries + entry) * height + y) * width + x];
+        };
+
+        std::vector<detection> result;
+        for (int b = 0; b < batch; ++b)
+        for (int n = 0; n < num; ++n)
+        for (int y = 0; y < height; ++y)
+        for (int x = 0; x < width; ++x)
+        {
+            const float objectness = logistic(at(b, n, 4, y, x));
+            const float center_x = (x + logistic(at(b, n, 0, y, x))) / width;
+            const float center_y = (y + logistic(at(b, n, 1, y, x))) / height;
+            const float half_w = std::exp(at(b, n, 2, y, x)) * anchors[2 * n] / width / 2;
+            const float half_h = std::exp(at(b, n, 3, y, x)) * anchors[2 * n + 1] / height / 2;
+
+            float max_score = -FLT_MAX, exp_sum = 0.f;
+            for (int c = 0; c < classes; ++c)
+                max_score = std::max(max_score, at(b, n, 5 + c, y, x));
+            for (int c = 0; c < classes; ++c)
+                exp_sum += std::exp(at(b, n, 5 + c, y, x) - max_score);
+
+            for (int c = 0; c < classes; ++c)
+            {
+                const float score = at(b, n, 5 + c, y, x);
+                const float prob = objectness * (do_softmax ? std::exp(score - max_score) / exp_sum : logistic(score));
+                if (prob > threshold)
+                {
+                    result.push_back({ { static_cast<float>(b), static_cast<float>(c), prob,
+                                         center_x - half_w, center_y - half_h, center_x + half_w, center_y + half_h } });
+                }
+            }
+        }
+        return result;
+    }
+
+    bool detection_less(const detection& a, const detection& b)
+    {
+        return std::lexicographical_compare(a.begin(), a.end(), b.begin(), b.end());
+    }
+
+    template <typename T>
+    std::vector<detection> read_detections(const memory& output)
+    {
+        auto ptr = output.pointer<T>();
+        const size_t rows = output.get_layout().size.spatial[1];
+
+        std::vector<detection> result;
+        for (size_t r = 0; r < rows; ++r)
+        {
+            detection d;
+            for (size_t i = 0; i < d.size(); ++i)
+                d[i] = static_cast<float>(ptr[r * d.size() + i]);
+            if (d[0] == -1.f)
+                continue;
+            result.push_back(d);
+        }
+        return result;
+    }
+
+    // Detections too close to the threshold may fall on either side of it with a different rounding.
+    std::vector<detection> drop_borderline(std::vector<detection> detections, float threshold, float tolerance)
+    {
+        detections.erase(std::remove_if(detections.begin(), detections.end(),
+                                        [&](const detection& d) { return std::abs(d[2] - threshold) <= tolerance; }),
+                         detections.end());
+        std::sort(detections.begin(), detections.end(), detection_less);
+        return detections;
+    }
+}
+
+template <typename T>
+void region_yolo_detect_test(int batch, int height, int width, int classes, int num, int mask_size, bool do_softmax,
+                             const std::vector<float>& anchors, float threshold, int max_boxes)
+{
+    engine engine;
+
+    const int used_anchors = static_cast<int>(anchors.size() / 2);
+    auto input = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { batch, used_anchors * (classes + 5), width, height } });
+
+    auto input_data = generate_random_1d<float>(input.get_layout().count(), -6, 6);
+    set_values(input, std::vector<T>(input_data.begin(), input_data.end()));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        region_yolo("region_yolo", "input", 4, classes, num, mask_size, do_softmax, anchors, threshold, max_boxes));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto output = network.execute().at("region_yolo").get_memory();
+    ASSERT_EQ(output.get_layout().size, tensor(1, 1, 7, max_boxes));
+
+    const bool fp16 = type_to_data_type<T>::value == data_types::f16;
+    const float tolerance = fp16 ? 0.01f : 1e-4f;
+
+    const auto reference = region_yolo_detect_reference(input_data, batch, height, width, classes, do_softmax, anchors, threshold);
+    const auto detections = read_detections<T>(output);
+    ASSERT_GT(reference.size(), 0u);
+
+    if (reference.size() > static_cast<size_t>(max_boxes))
+    {
+        // overflow: every row is used, by some of the detections
+        ASSERT_EQ(detections.size(), static_cast<size_t>(max_boxes));
+        for (const auto& d : detections)
+        {
+            auto match = std::find_if(reference.begin(), reference.end(), [&](const detection& e)
+            {
+                for (size_t i = 0; i < e.size(); ++i)
+                    if (std::abs(e[i] - d[i]) > tolerance * (1.f + std::abs(e[i]))) return false;
+                return true;
+            });
+            ASSERT_NE(match, reference.end());
+        }
+        return;
+    }
+
+    const auto expected = drop_borderline(reference, threshold, tolerance);
+    const auto actual = drop_borderline(detections, threshold, tolerance);
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t r = 0; r < expected.size(); ++r)
+    for (size_t i = 0; i < expected[r].size(); ++i)
+    {
+        ASSERT_NEAR(expected[r][i], actual[r][i], tolerance * (1.f + std::abs(expected[r][i]))) << "at row " << r << ", element " << i;
+    }
+}
+
+// YOLOv2 VOC: 5 anchors, 20 classes with softmax
+static const std::vector<float> yolo_v2_anchors = { 1.08f, 1.19f, 3.42f, 4.41f, 6.63f, 11.38f, 9.42f, 5.11f, 16.62f, 10.52f };
+
+// YOLOv3 COCO, 13x13 layer (mask 6,7,8): pixel anchors divided by the stride of 32
+static const std::vector<float> yolo_v3_anchors = { 116.f / 32, 90.f / 32, 156.f / 32, 198.f / 32, 373.f / 32, 326.f / 32 };
+
+TEST(region_yolo_gpu, detect_softmax_f32)
+{
+    region_yolo_detect_test<float>(2, 13, 13, 20, 5, 0, true, yolo_v2_anchors, 0.3f, 2000);
+}
+
+TEST(region_yolo_gpu, detect_logistic_f32)
+{
+    region_yolo_detect_test<float>(1, 13, 13, 80, 9, 3, false, yolo_v3_anchors, 0.97f, 4096);
+}
+
+TEST(region_yolo_gpu, detect_softmax_f16)
+{
+    region_yolo_detect_test<FLOAT16>(1, 13, 13, 20, 5, 0, true, yolo_v2_anchors, 0.3f, 2000);
+}
+
+TEST(region_yolo_gpu, detect_overflow_f32)
+{
+    region_yolo_detect_test<float>(1, 13, 13, 20, 5, 0, true, yolo_v2_anchors, 0.1f, 16);
+}
+
+// Device time and readback of the regular output followed by host decoding, against the detection mode.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=region_yolo_gpu.DISABLED_detect_report
+TEST(region_yolo_gpu, DISABLED_detect_report)
+{
+    engine engine;
+    const int iterations = 50, classes = 20, size = 13;
+    const float threshold = 0.3f;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 5 * (classes + 5), size, size } });
+    set_random_values<float>(input);
+
+    std::cout << std::setw(10) << "mode" << std::setw(14) << "time [ms]" << std::setw(16) << "readback [B]" << std::setw(8) << "boxes" << std::endl;
+    for (bool detect : { false, true })
+    {
+        topology topo(input_layout("input", input.get_layout()));
+        if (detect)
+            topo.add(region_yolo("region_yolo", "input", 4, classes, 5, 0, true, yolo_v2_anchors, threshold, 256));
+        else
+            topo.add(region_yolo("region_yolo", "input", 4, classes, 5, 0, true));
+
+        network net(engine, topo);
+        net.set_input_data("input", input);
+
+        size_t readback = 0, boxes = 0;
+        auto run = [&]()
+        {
+            auto output = net.execute().at("region_yolo").get_memory();
+            readback = output.get_layout().bytes_count();
+            if (detect)
+            {
+                boxes = read_detections<float>(output).size();
+            }
+            else
+            {
+                // the application thresholds the activated objectness and class probabilities
+                auto ptr = output.pointer<float>();
+                boxes = 0;
+                for (int n = 0; n < 5; ++n)
+                for (int loc = 0; loc < size * size; ++loc)
+                {
+                    const float objectness = ptr[(n * (classes + 5) + 4) * size * size + loc];
+                    for (int c = 0; c < classes; ++c)
+                        boxes += objectness * ptr[(n * (classes + 5) + 5 + c) * size * size + loc] > threshold;
+                }
+            }
+        };
+        run();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            run();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        std::cout << std::setw(10) << (detect ? "detect" : "regular") << std::fixed << std::setprecision(3)
+                  << std::setw(14) << seconds * 1e3 << std::setw(16) << readback << std::setw(8) << boxes << std::endl;
+    }
+}
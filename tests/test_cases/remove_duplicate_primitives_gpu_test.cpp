@@ -0,0 +1,117 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/reorder.hpp>
+#include <api/CPP/eltwise.hpp>
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+/*
+    This set of tests has been designed to check the correctness of remove_duplicate_primitives optimization pass
+
+    Network structure:  input -> reorder1 -> sum1 (+ const1) -> prod (output)
+                            \                                 /
+                             --> reorder2 -> sum2 (+ const2) -
+*/
+namespace
+{
+    topology duplicated_branches_topology(const memory& input, const memory& const1, const memory& const2)
+    {
+        topology topology;
+        topology.add(input_layout("input", input.get_layout()));
+        topology.add(data("const1", const1));
+        topology.add(data("const2", const2));
+        topology.add(reorder("reorder1", "input", format::yxfb, data_types::f32));
+        topology.add(reorder("reorder2", "input", format::yxfb, data_types::f32));
+        topology.add(eltwise("sum1", "reorder1", "const1", eltwise_mode::sum));
+        topology.add(eltwise("sum2", "reorder2", "const2", eltwise_mode::sum));
+        topology.add(eltwise("prod", "sum1", "sum2", eltwise_mode::prod));
+        return topology;
+    }
+}
+
+TEST(remove_duplicate_primitives, equal_constants_and_reorders_merged) {
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 2, 2, 2, 2 } });
+    auto const1 = memory::allocate(engine, { data_types::f32, format::yxfb, { 2, 2, 2, 2 } });
+    auto const2 = memory::allocate(engine, { data_types::f32, format::yxfb, { 2, 2, 2, 2 } });
+    tests::set_random_values<float>(input);
+    tests::set_random_values<float>(const1);
+    {
+        auto src = const1.pointer<float>();
+        auto dst = const2.pointer<float>();
+        std::copy(src.begin(), src.end(), dst.begin());
+    }
+    auto topology = duplicated_branches_topology(input, const1, const2);
+
+    build_options reference_opt;
+    reference_opt.set_option(build_option::optimize_data(false));
+    network reference(engine, topology, reference_opt);
+    EXPECT_EQ(reference.get_removed_duplicates(), (size_t)0);
+
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+    network network(engine, topology, build_opt);
+
+    // reorder2 and const2 are removed, then sum2 has the same inputs as sum1 and is removed too, so prod uses sum1 twice
+    EXPECT_EQ(network.get_removed_duplicates(), (size_t)3);
+    EXPECT_EQ(network.get_removed_duplicate_bytes(), const2.get_layout().bytes_count() + 2 * input.get_layout().bytes_count());
+
+    auto expected = execute(reference, input, "prod");
+    auto actual = execute(network, input, "prod");
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], actual[i]) << "i = " << i;
+}
+
+TEST(remove_duplicate_primitives, different_constants_not_merged) {
+    engine engine;
+
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, 2, 2, 2 } });
+    auto const1 = memory::allocate(engine, { data_types::f32, format::yxfb, { 1, 2, 2, 2 } });
+    auto const2 = memory::allocate(engine, { data_types::f32, format::yxfb, { 1, 2, 2, 2 } });
+    set_values(input, { 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f });
+    set_values(const1, { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f });
+    set_values(const2, { 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 1.f, 2.f });
+    auto topology = duplicated_branches_topology(input, const1, const2);
+
+    build_options build_opt;
+    build_opt.set_option(build_option::optimize_data(true));
+    network network(engine, topology, build_opt);
+
+    // only reorder2 is removed
+    EXPECT_EQ(network.get_removed_duplicates(), (size_t)1);
+
+    // yxfb: f0 and f1 of each position are interleaved
+    std::vector<float> expected = { 4.f, 36.f, 9.f, 49.f, 16.f, 64.f, 25.f, 90.f };
+    auto actual = execute(network, input, "prod");
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        EXPECT_FLOAT_EQ(expected[i], actual[i]) << "i = " << i;
+}
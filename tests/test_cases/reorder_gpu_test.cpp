@@ -26,14 +26,23 @@
 #include "test_utils/test_utils.h"
 #include <api/CPP/data.hpp>
 
+#include <chrono>
 #include <cmath>
 #include <gmock/gmock.h>
+#include <iomanip>
 #include <limits>
+#include <random>
+#include <sstream>
 
 using namespace cldnn;
 using namespace tests;
 using namespace testing;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 TEST(reorder_gpu_f32, basic)
 {
     //  Input               : yxfb:2x2x2x2
@@ -1239,6 +1248,179 @@ TEST(reorder_gpu_i64, basic)
         EXPECT_EQ(*(a_ptr++), val);
 }
 
+namespace {
+    // offset of logical element (b, f, y, x) in unpadded buffer of layout l; blocked layouts are not covered
+    // by layout::get_linear_offset
+    size_t reorder_test_offset(const layout& l, int b, int f, int y, int x) {
+        const auto& size = l.size;
+        if (l.format == format::byxf_af32) {
+            const int f_aligned = align_to(size.feature[0], 32);
+            return (static_cast<size_t>(b * size.spatial[1] + y) * size.spatial[0] + x) * f_aligned + f;
+        }
+        if (l.format == format::fs_bs_yx_bsv4_fsv32) {
+            const int b_blocks = align_to(size.batch[0], 4) / 4;
+            const size_t block = (static_cast<size_t>(f / 32) * b_blocks + b / 4) * size.spatial[1] + y;
+            return (block * size.spatial[0] + x) * 128 + (b % 4) * 32 + f % 32;
+        }
+        return l.get_linear_offset(tensor(b, f, x, y));
+    }
+
+    template <typename InT, typename OutT>
+    void reorder_random_test(format in_fmt, format out_fmt, const tensor& size, bool subtract_mean) {
+        engine engine;
+        const auto in_dt = type_to_data_type<InT>::value;
+        const auto out_dt = type_to_data_type<OutT>::value;
+        if ((in_dt == data_types::f16 || out_dt == data_types::f16) && !engine.get_info().supports_fp16) {
+            std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+            EXPECT_EQ(1, 1);
+            return;
+        }
+
+        const int batch = size.batch[0], features = size.feature[0], size_y = size.spatial[1], size_x = size.spatial[0];
+
+        // small integers (or multiples of 1/8) are exact in every tested type, so results are compared exactly
+        std::mt19937 rnd(1);
+        std::uniform_int_distribution<int> dist(-60, 60);
+        const bool integer_input = in_dt == data_types::i8;
+        std::vector<float> values(batch * features * size_y * size_x);
+        for (auto& v : values)
+            v = integer_input ? static_cast<float>(dist(rnd)) : dist(rnd) / 8.f;
+
+        std::vector<float> mean;
+        if (subtract_mean) {
+            for (int f = 0; f < features; ++f)
+                mean.push_back(static_cast<float>(f % 5 - 2));
+        }
+
+        memory input = memory::allocate(engine, { in_dt, in_fmt, size });
+        {
+            auto ptr = input.pointer<InT>();
+            size_t i = 0;
+            for (int b = 0; b < batch; ++b)
+                for (int f = 0; f < features; ++f)
+                    for (int y = 0; y < size_y; ++y)
+                        for (int x = 0; x < size_x; ++x)
+                            ptr[reorder_test_offset(input.get_layout(), b, f, y, x)] = static_cast<InT>(values[i++]);
+        }
+
+        topology topology(
+            input_layout("input", input.get_layout()),
+            reorder("reorder", "input", out_fmt, out_dt, mean));
+
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto output = network.execute().at("reorder").get_memory();
+        ASSERT_EQ(output.get_layout().format, out_fmt);
+
+        auto out_ptr = output.pointer<OutT>();
+        size_t i = 0;
+        for (int b = 0; b < batch; ++b)
+            for (int f = 0; f < features; ++f)
+                for (int y = 0; y < size_y; ++y)
+                    for (int x = 0; x < size_x; ++x) {
+                        const float expected = values[i++] - (subtract_mean ? mean[f] : 0.f);
+                        const float actual = static_cast<float>(out_ptr[reorder_test_offset(output.get_layout(), b, f, y, x)]);
+                        ASSERT_EQ(expected, actual) << "b=" << b << " f=" << f << " y=" << y << " x=" << x;
+                    }
+    }
+}
+
+TEST(reorder_gpu_opt, tiled_bfyx_to_byxf_f32) {
+    reorder_random_test<float, float>(format::bfyx, format::byxf, { 3, 37, 19, 11 }, false);
+}
+
+TEST(reorder_gpu_opt, tiled_byxf_to_bfyx_f32_to_f16) {
+    reorder_random_test<float, FLOAT16>(format::byxf, format::bfyx, { 2, 70, 9, 5 }, true);
+}
+
+TEST(reorder_gpu_opt, tiled_bfyx_to_yxfb_mean) {
+    reorder_random_test<float, float>(format::bfyx, format::yxfb, { 16, 5, 13, 7 }, true);
+}
+
+TEST(reorder_gpu_opt, tiled_yxfb_to_bfyx_f16_to_f32) {
+    reorder_random_test<FLOAT16, float>(format::yxfb, format::bfyx, { 33, 3, 6, 5 }, false);
+}
+
+TEST(reorder_gpu_opt, tiled_bfyx_to_byxf_af32_i8) {
+    reorder_random_test<int8_t, int8_t>(format::bfyx, format::byxf_af32, { 2, 40, 7, 9 }, false);
+}
+
+TEST(reorder_gpu_opt, tiled_byxf_af32_to_bfyx_i8_to_f32) {
+    reorder_random_test<int8_t, float>(format::byxf_af32, format::bfyx, { 1, 64, 5, 11 }, true);
+}
+
+TEST(reorder_gpu_opt, tiled_bfyx_to_fs_bs_yx_bsv4_fsv32_i8) {
+    reorder_random_test<int8_t, int8_t>(format::bfyx, format::fs_bs_yx_bsv4_fsv32, { 8, 64, 6, 7 }, false);
+}
+
+TEST(reorder_gpu_opt, tiled_fs_bs_yx_bsv4_fsv32_to_bfyx_i8) {
+    reorder_random_test<int8_t, int8_t>(format::fs_bs_yx_bsv4_fsv32, format::bfyx, { 4, 32, 9, 3 }, false);
+}
+
+TEST(reorder_gpu_opt, vectorized_f32_to_f16) {
+    reorder_random_test<float, FLOAT16>(format::bfyx, format::bfyx, { 3, 7, 5, 11 }, false);
+}
+
+TEST(reorder_gpu_opt, vectorized_f16_to_f32_mean) {
+    reorder_random_test<FLOAT16, float>(format::bfyx, format::bfyx, { 2, 6, 8, 8 }, true);
+}
+
+TEST(reorder_gpu_opt, vectorized_byxf_mean) {
+    reorder_random_test<float, FLOAT16>(format::byxf, format::byxf, { 2, 13, 4, 5 }, true);
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=reorder_gpu_opt.DISABLED_bandwidth_report
+TEST(reorder_gpu_opt, DISABLED_bandwidth_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        std::string name;
+        layout input;
+        format out_fmt;
+        data_types out_dt;
+    };
+    const tensor size(8, 64, 56, 56);
+    const std::vector<report_case> cases = {
+        { "f32 bfyx->byxf",     { data_types::f32, format::bfyx, size },        format::byxf,                   data_types::f32 },
+        { "f32 byxf->bfyx",     { data_types::f32, format::byxf, size },        format::bfyx,                   data_types::f32 },
+        { "f32 bfyx->yxfb",     { data_types::f32, format::bfyx, size },        format::yxfb,                   data_types::f32 },
+        { "f32 yxfb->bfyx",     { data_types::f32, format::yxfb, size },        format::bfyx,                   data_types::f32 },
+        { "f32->f16 bfyx",      { data_types::f32, format::bfyx, size },        format::bfyx,                   data_types::f16 },
+        { "f16->f32 bfyx",      { data_types::f16, format::bfyx, size },        format::bfyx,                   data_types::f32 },
+        { "i8 bfyx->af32",      { data_types::i8, format::bfyx, size },         format::byxf_af32,              data_types::i8 },
+        { "i8 af32->bfyx",      { data_types::i8, format::byxf_af32, size },    format::bfyx,                   data_types::i8 },
+        { "i8 bfyx->fsv32",     { data_types::i8, format::bfyx, size },         format::fs_bs_yx_bsv4_fsv32,    data_types::i8 },
+        { "i8 fsv32->bfyx",     { data_types::i8, format::fs_bs_yx_bsv4_fsv32, size }, format::bfyx,            data_types::i8 },
+    };
+
+    std::cout << std::setw(20) << "reorder" << std::setw(20) << "input" << std::setw(10) << "GB/s" << std::endl;
+    for (const auto& c : cases) {
+        if ((c.input.data_type == data_types::f16 || c.out_dt == data_types::f16) && !engine.get_info().supports_fp16)
+            continue;
+
+        auto input = memory::allocate(engine, c.input);
+        topology topology(
+            input_layout("input", c.input),
+            reorder("reorder", "input", c.out_fmt, c.out_dt));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto output = network.execute().at("reorder").get_memory();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("reorder").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        const double bandwidth = (input.get_layout().bytes_count() + output.get_layout().bytes_count()) / seconds * 1e-9;
+
+        std::stringstream size_str;
+        size_str << size.batch[0] << "x" << size.feature[0] << "x" << size.spatial[1] << "x" << size.spatial[0];
+        std::cout << std::setw(20) << c.name << std::setw(20) << size_str.str() << std::fixed << std::setprecision(1)
+                  << std::setw(10) << bandwidth << std::endl;
+    }
+}
+
 using namespace cldnn;
 
 class reorder_test : public tests::generic_test
@@ -0,0 +1,260 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+
+#include <api/CPP/engine.hpp>
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/roi_pooling.hpp>
+#include <api/CPP/memory.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+
+#include "test_utils/test_utils.h"
+#include "test_utils/float16.h"
+
+#include <vector>
+#include <algorithm>
+#include <chrono>
+#include <cfloat>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+
+using namespace cldnn;
+using namespace tests;
+
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
+namespace
+{
+    // Host version of roi_pooling_ref.cl for plain (group_sz == 0) max/average pooling and roi_align.
+    std::vector<float> roi_pooling_reference(const std::vector<float>& data, int channels, int height, int width,
+                                             const std::vector<float>& rois, pooling_mode mode, int pooled_w, int pooled_h,
+                                             float spatial_scale, int sampling_ratio)
+    {
+        const int num_rois = static_cast<int>(rois.size() / 5);
+        std::vector<float> out(static_cast<size_t>(num_rois) * channels * pooled_h * pooled_w);
+
+        auto at = [&](int c, int y, int x) { return data[(static_cast<size_t>(c) * height + y) * width + x]; };
+
+        for (int r = 0; r < num_rois; ++r)
+        {
+            const float* roi = &rois[r * 5];
+            for (int c = 0; c < channels; ++c)
+            for (int py = 0; py < pooled_h; ++py)
+            for (int px = 0; px < pooled_w; ++px)
+            {
+                float res = 0.f;
+                if (mode == pooling_mode::roi_align)
+                {
+                    const float roi_x = roi[1] * spatial_scale;
+                    const float roi_y = roi[2] * spatial_scale;
+                    const float roi_w = std::max(roi[3] * spatial_scale - roi_x, 1.f);
+                    const float roi_h = std::max(roi[4] * spatial_scale - roi_y, 1.f);
+                    const float bin_w = roi_w / pooled_w;
+                    const float bin_h = roi_h / pooled_h;
+                    const int grid_w = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(bin_w));
+                    const int grid_h = sampling_ratio > 0 ? sampling_ratio : static_cast<int>(std::ceil(bin_h));
+
+                    for (int iy = 0; iy < grid_h; ++iy)
+                    for (int ix = 0; ix < grid_w; ++ix)
+                    {
+                        float y = roi_y + py * bin_h + (iy + .5f) * bin_h / grid_h;
+                        float x = roi_x + px * bin_w + (ix + .5f) * bin_w / grid_w;
+                        if (y < -1.f || y > height || x < -1.f || x > width)
+                            continue;
+                        y = std::max(y, 0.f);
+                        x = std::max(x, 0.f);
+                        int y_low = static_cast<int>(y), x_low = static_cast<int>(x);
+                        int y_high = y_low + 1, x_high = x_low + 1;
+                        if (y_low >= height - 1) { y_low = y_high = height - 1; y = static_cast<float>(y_low); }
+                        if (x_low >= width - 1) { x_low = x_high = width - 1; x = static_cast<float>(x_low); }
+                        const float ly = y - y_low, lx = x - x_low;
+                        const float top = at(c, y_low, x_low) + (at(c, y_low, x_high) - at(c, y_low, x_low)) * lx;
+                        const float bottom = at(c, y_high, x_low) + (at(c, y_high, x_high) - at(c, y_high, x_low)) * lx;
+                        res += top + (bottom - top) * ly;
+                    }
+                    res /= grid_h * grid_w;
+                }
+                else
+                {
+                    const int roi_x = static_cast<int>(std::round(roi[1] * spatial_scale));
+                    const int roi_y = static_cast<int>(std::round(roi[2] * spatial_scale));
+                    const int roi_w = std::max(static_cast<int>(std::round(roi[3] * spatial_scale)) - roi_x, 0) + 1;
+                    const int roi_h = std::max(static_cast<int>(std::round(roi[4] * spatial_scale)) - roi_y, 0) + 1;
+
+                    const int x_begin = std::min(std::max(roi_x + (px * roi_w) / pooled_w, 0), width);
+                    const int y_begin = std::min(std::max(roi_y + (py * roi_h) / pooled_h, 0), height);
+                    const int x_after = std::min(std::max(roi_x + ((px + 1) * roi_w + pooled_w - 1) / pooled_w, 0), width);
+                    const int y_after = std::min(std::max(roi_y + ((py + 1) * roi_h + pooled_h - 1) / pooled_h, 0), height);
+
+                    const bool empty = x_begin >= x_after || y_begin >= y_after;
+                    res = mode == pooling_mode::max && !empty ? -FLT_MAX : 0.f;
+                    for (int y = y_begin; y < y_after; ++y)
+                    for (int x = x_begin; x < x_after; ++x)
+                        res = mode == pooling_mode::max ? std::max(res, at(c, y, x)) : res + at(c, y, x);
+                    if (mode != pooling_mode::max && !empty)
+                        res /= static_cast<float>((y_after - y_begin) * (x_after - x_begin));
+                }
+                out[((static_cast<size_t>(r) * channels + c) * pooled_h + py) * pooled_w + px] = res;
+            }
+        }
+        return out;
+    }
+
+    // ROIs in image coordinates (feature map / spatial_scale), on a quarter-pixel grid so they are exact in fp16.
+    std::vector<float> generate_rois(int num_rois, float image_w, float image_h, std::mt19937& rng)
+    {
+        std::uniform_real_distribution<float> start_x(-8.f, image_w), start_y(-8.f, image_h);
+        std::uniform_real_distribution<float> size(0.f, 0.6f);
+        auto quantize = [](float v) { return std::round(v * 4.f) / 4.f; };
+
+        std::vector<float> rois;
+        for (int r = 0; r < num_rois; ++r)
+        {
+            const float x0 = quantize(start_x(rng));
+            const float y0 = quantize(start_y(rng));
+            rois.insert(rois.end(), { 0.f, x0, y0, quantize(x0 + size(rng) * image_w), quantize(y0 + size(rng) * image_h) });
+        }
+        return rois;
+    }
+}
+
+template <typename T>
+void roi_pooling_random_test(pooling_mode mode, int channels, int height, int width, int num_rois, int pooled, float spatial_scale, int sampling_ratio = 0)
+{
+    engine engine;
+    std::mt19937 rng(7);
+
+    auto input = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { 1, channels, width, height } });
+    auto rois = memory::allocate(engine, { type_to_data_type<T>::value, format::bfyx, { num_rois, 1, 5, 1 } });
+
+    auto input_data = generate_random_1d<float>(input.get_layout().count(), -4, 4);
+    auto rois_data = generate_rois(num_rois, width / spatial_scale, height / spatial_scale, rng);
+    set_values(input, std::vector<T>(input_data.begin(), input_data.end()));
+    set_values(rois, std::vector<T>(rois_data.begin(), rois_data.end()));
+
+    topology topology(
+        input_layout("input", input.get_layout()),
+        input_layout("rois", rois.get_layout()),
+        roi_pooling("roi_pooling", "input", "rois", mode, pooled, pooled, spatial_scale, 0, padding(), sampling_ratio));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    network.set_input_data("rois", rois);
+
+    auto output = network.execute().at("roi_pooling").get_memory();
+    ASSERT_EQ(output.get_layout().size, tensor(num_rois, channels, pooled, pooled));
+    auto output_ptr = output.pointer<T>();
+
+    const auto expected = roi_pooling_reference(input_data, channels, height, width, rois_data, mode, pooled, pooled, spatial_scale, sampling_ratio);
+    const bool fp16 = type_to_data_type<T>::value == data_types::f16;
+    for (size_t i = 0; i < expected.size(); ++i)
+    {
+        const float tolerance = fp16 ? 0.01f * std::abs(expected[i]) + 0.01f : 1e-5f * std::abs(expected[i]) + 1e-5f;
+        ASSERT_NEAR(expected[i], static_cast<float>(output_ptr[i]), tolerance) << "at index " << i;
+    }
+}
+
+TEST(roi_pooling_gpu, max_random_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::max, 16, 24, 32, 40, 7, 0.25f);
+}
+
+TEST(roi_pooling_gpu, average_random_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::average, 8, 19, 23, 30, 6, 0.5f);
+}
+
+TEST(roi_pooling_gpu, max_random_f16)
+{
+    roi_pooling_random_test<FLOAT16>(pooling_mode::max, 16, 24, 32, 40, 7, 0.25f);
+}
+
+// ROIs up to 0.6 of a 100x120 map exceed the local window and are pooled from global memory
+TEST(roi_pooling_gpu, max_random_large_rois_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::max, 4, 100, 120, 20, 7, 1.f);
+}
+
+TEST(roi_pooling_gpu, roi_align_random_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::roi_align, 16, 24, 32, 40, 7, 0.25f, 2);
+}
+
+TEST(roi_pooling_gpu, roi_align_adaptive_sampling_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::roi_align, 8, 38, 50, 30, 7, 0.0625f);
+}
+
+TEST(roi_pooling_gpu, roi_align_random_large_rois_f32)
+{
+    roi_pooling_random_test<float>(pooling_mode::roi_align, 4, 100, 120, 20, 14, 1.f, 2);
+}
+
+TEST(roi_pooling_gpu, roi_align_random_f16)
+{
+    roi_pooling_random_test<FLOAT16>(pooling_mode::roi_align, 16, 24, 32, 40, 7, 0.25f, 2);
+}
+
+// Faster R-CNN (VGG16 conv5: 512 x 38 x 50, stride 16) with 7x7 bins.
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=roi_pooling_gpu.DISABLED_rois_report
+TEST(roi_pooling_gpu, DISABLED_rois_report)
+{
+    engine engine;
+    const int iterations = 20;
+    const int channels = 512, height = 38, width = 50, pooled = 7;
+    const float spatial_scale = 0.0625f;
+
+    std::mt19937 rng(1);
+    auto input = memory::allocate(engine, { data_types::f32, format::bfyx, { 1, channels, width, height } });
+    set_random_values<float>(input);
+
+    std::cout << std::setw(12) << "mode" << std::setw(8) << "rois" << std::setw(12) << "time [ms]" << std::setw(15) << "us per ROI" << std::endl;
+    for (auto mode : { pooling_mode::max, pooling_mode::roi_align })
+    {
+        for (int num_rois : { 100, 300, 600, 1000 })
+        {
+            auto rois = memory::allocate(engine, { data_types::f32, format::bfyx, { num_rois, 1, 5, 1 } });
+            set_values(rois, generate_rois(num_rois, width / spatial_scale, height / spatial_scale, rng));
+
+            topology topo(
+                input_layout("input", input.get_layout()),
+                input_layout("rois", rois.get_layout()),
+                roi_pooling("roi_pooling", "input", "rois", mode, pooled, pooled, spatial_scale, 0, padding(), 2));
+            network net(engine, topo);
+            net.set_input_data("input", input);
+            net.set_input_data("rois", rois);
+            net.execute().at("roi_pooling").get_event().wait();
+
+            auto start = std::chrono::high_resolution_clock::now();
+            for (int i = 0; i < iterations; ++i)
+                net.execute().at("roi_pooling").get_event().wait();
+            const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+            std::cout << std::setw(12) << (mode == pooling_mode::max ? "max" : "roi_align") << std::setw(8) << num_rois
+                      << std::fixed << std::setprecision(3) << std::setw(12) << seconds * 1e3
+                      << std::setprecision(2) << std::setw(15) << seconds * 1e6 / num_rois << std::endl;
+        }
+    }
+}
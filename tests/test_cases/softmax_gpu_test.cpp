@@ -23,10 +23,18 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
 using namespace cldnn;
 using namespace std;
 using namespace tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
 
 class softmax_gpu_xb_f32_test_fixture: public ::testing::Test {
 public:
@@ -521,6 +529,73 @@ TEST(softmax_gpu_yxfb_f32, normalize_f) {
     }
 }
 
+template<typename data_t>
+void softmax_large_axis_test(const tensor& in_size, softmax::dimension_t dimension, float err_margin)
+{
+    engine engine;
+
+    memory input = memory::allocate(engine, { type_to_data_type<data_t>::value, format::bfyx, in_size });
+    set_random_values<data_t>(input, true, 8, 10);
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(softmax("softmax", "input", dimension));
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+    auto output = network.execute().at("softmax").get_memory();
+
+    const int batch_num = in_size.batch[0], feature_num = in_size.feature[0];
+    const int y_size = in_size.spatial[1], x_size = in_size.spatial[0];
+    const int class_num = dimension == softmax::normalize_x ? x_size : dimension == softmax::normalize_y ? y_size : feature_num;
+    const int class_pitch = dimension == softmax::normalize_x ? 1 : dimension == softmax::normalize_y ? x_size : x_size * y_size;
+
+    auto input_ptr = input.pointer<data_t>();
+    auto output_ptr = output.pointer<data_t>();
+
+    // every element which is the first one of its class vector starts a reference softmax
+    for (int i = 0; i < batch_num * feature_num * y_size * x_size; ++i)
+    {
+        if ((i / class_pitch) % class_num != 0)
+            continue;
+
+        float max_value = -std::numeric_limits<float>::max();
+        for (int c = 0; c < class_num; ++c)
+            max_value = std::max(max_value, static_cast<float>(input_ptr[i + c * class_pitch]));
+
+        float sum = 0.f;
+        for (int c = 0; c < class_num; ++c)
+            sum += std::exp(static_cast<float>(input_ptr[i + c * class_pitch]) - max_value);
+
+        for (int c = 0; c < class_num; ++c)
+        {
+            const float expected = std::exp(static_cast<float>(input_ptr[i + c * class_pitch]) - max_value) / sum;
+            ASSERT_NEAR(static_cast<float>(output_ptr[i + c * class_pitch]), expected, expected * err_margin + 1e-6f)
+                << "Index=" << i + c * class_pitch;
+        }
+    }
+}
+
+TEST(softmax_gpu_bfyx_f32, large_axis_x) {
+    softmax_large_axis_test<float>({ 2, 3, 5000, 2 }, softmax::normalize_x, 1e-3f);
+}
+
+TEST(softmax_gpu_bfyx_f32, large_axis_f) {
+    softmax_large_axis_test<float>({ 2, 4096, 3, 2 }, softmax::normalize_f, 1e-3f);
+}
+
+TEST(softmax_gpu_bfyx_f16, large_axis_x) {
+    engine engine;
+    if (!engine.get_info().supports_fp16)
+    {
+        std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+        EXPECT_EQ(1, 1);
+        return;
+    }
+
+    softmax_large_axis_test<FLOAT16>({ 1, 2, 3000, 1 }, softmax::normalize_x, 1e-2f);
+}
+
 
 //////////////////////////////////////////////////////////////////////////////
 //                                                                          //
@@ -20,10 +20,14 @@
 #include "api/CPP/memory.hpp"
 #include <api/CPP/input_layout.hpp>
 #include "api/CPP/concatenation.hpp"
+#include "api/CPP/activation.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/pooling.hpp"
 #include <api/CPP/topology.hpp>
 #include <api/CPP/network.hpp>
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
+#include "float16.h"
 
 using namespace cldnn;
 using namespace tests;
@@ -246,4 +250,94 @@ TEST(spatial_concatenate_f32_gpu, test04) {
             EXPECT_FLOAT_EQ(value, expected_output[idx++]);
         }
     }
-}
\ No newline at end of file
+}
+
+namespace
+{
+    // outputs of "concat" and "sum" with and without in-place concatenation
+    template <typename T>
+    void test_in_place_concat_with_shared_input(concatenation::concatenation_axis axis, data_types dt = data_types::f32,
+        format fmt = format::bfyx)
+    {
+        engine eng;
+        if (dt == data_types::f16 && !eng.get_info().supports_fp16)
+        {
+            std::cout << "[ SKIPPED ] The test is skipped (cl_khr_fp16 is not supported)." << std::endl;
+            EXPECT_EQ(1, 1);
+            return;
+        }
+
+        memory input1 = memory::allocate(eng, layout{ dt, fmt, { 2, 3, 4, 3 } });
+        memory input2 = memory::allocate(eng, layout{ dt, fmt, { 2, 3, 4, 3 } });
+        tests::set_random_values<T>(input1, true);
+        tests::set_random_values<T>(input2, true);
+
+        // relu1 is used by concatenation and eltwise
+        topology tpl;
+        tpl.add(input_layout("input1", input1.get_layout()));
+        tpl.add(input_layout("input2", input2.get_layout()));
+        tpl.add(activation("relu1", "input1", activation_relu));
+        tpl.add(activation("relu2", "input2", activation_relu));
+        tpl.add(eltwise("sum", "relu1", "relu2", eltwise_mode::sum));
+        tpl.add(concatenation("concat", { "relu1", "relu2" }, axis));
+        tpl.add(pooling("out", "concat", pooling_mode::max, { 1, 1, 1, 1 }, { 1, 1, 1, 1 }));
+
+        std::vector<T> results[2][2];
+        for (int optimize = 0; optimize < 2; optimize++)
+        {
+            build_options bo;
+            bo.set_option(build_option::optimize_data(optimize != 0));
+            bo.set_option(build_option::outputs({ "sum", "out" }));
+            network net(eng, tpl, bo);
+            net.set_input_data("input1", input1);
+            net.set_input_data("input2", input2);
+            auto outputs = net.execute();
+
+            auto out_ptr = outputs.at("out").get_memory().pointer<T>();
+            results[optimize][0].assign(out_ptr.begin(), out_ptr.end());
+            auto sum_ptr = outputs.at("sum").get_memory().pointer<T>();
+            results[optimize][1].assign(sum_ptr.begin(), sum_ptr.end());
+
+            if (optimize != 0)
+            {
+                // both inputs are written directly to the concatenation buffer
+                EXPECT_EQ(input1.get_layout().bytes_count() + input2.get_layout().bytes_count(), net.get_eliminated_copy_bytes());
+            }
+        }
+
+        for (size_t output = 0; output < 2; output++)
+        {
+            ASSERT_EQ(results[0][output].size(), results[1][output].size());
+            for (size_t i = 0; i < results[0][output].size(); i++)
+                EXPECT_FLOAT_EQ(static_cast<float>(results[0][output][i]), static_cast<float>(results[1][output][i])) << "output = " << output << ", i = " << i;
+        }
+    }
+}
+
+TEST(spatial_concatenate_f32_gpu, in_place_along_x_shared_input) {
+    test_in_place_concat_with_shared_input<float>(concatenation::along_x);
+}
+
+TEST(spatial_concatenate_f32_gpu, in_place_along_y_shared_input) {
+    test_in_place_concat_with_shared_input<float>(concatenation::along_y);
+}
+
+TEST(spatial_concatenate_f32_gpu, in_place_along_b_shared_input) {
+    test_in_place_concat_with_shared_input<float>(concatenation::along_b);
+}
+
+TEST(spatial_concatenate_f32_gpu, in_place_along_x_shared_input_yxfb) {
+    test_in_place_concat_with_shared_input<float>(concatenation::along_x, data_types::f32, format::yxfb);
+}
+
+TEST(spatial_concatenate_f32_gpu, in_place_along_b_shared_input_yxfb) {
+    test_in_place_concat_with_shared_input<float>(concatenation::along_b, data_types::f32, format::yxfb);
+}
+
+TEST(spatial_concatenate_f16_gpu, in_place_along_x_shared_input) {
+    test_in_place_concat_with_shared_input<FLOAT16>(concatenation::along_x, data_types::f16);
+}
+
+TEST(spatial_concatenate_f16_gpu, in_place_along_y_shared_input_yxfb) {
+    test_in_place_concat_with_shared_input<FLOAT16>(concatenation::along_y, data_types::f16, format::yxfb);
+}
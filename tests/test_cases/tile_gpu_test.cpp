@@ -24,11 +24,19 @@
 #include <api/CPP/engine.hpp>
 #include "test_utils/test_utils.h"
 
+#include <chrono>
+#include <iomanip>
 #include <iostream>
+#include <sstream>
 
 using namespace cldnn;
 using namespace tests;
 
+namespace cldnn
+{
+    template<> struct type_to_data_type<FLOAT16> { static const data_types value = data_types::f16; };
+}
+
 template<typename data_t>
 void tile_ref(const memory& input, memory& output, tile::tile_axis axis, int num_tiles)
 {
@@ -223,3 +231,112 @@ TEST(tile_gpu, basic_in1x2x2x2_axis_x_dense) {
         EXPECT_EQ(output_ptr[i], output_ref_ptr[i]) << "Index=" << i;
     }
 }
+
+template<typename data_t>
+static void tile_random_test(const tensor& in_size, tile::tile_axis axis, int num_tiles)
+{
+    engine engine;
+    if (type_to_data_type<data_t>::value == data_types::f16 && !engine.get_info().supports_fp16)
+        return;
+
+    tensor out_size = in_size;
+    switch (axis)
+    {
+        case tile::along_b: out_size.batch[0] *= num_tiles; break;
+        case tile::along_f: out_size.feature[0] *= num_tiles; break;
+        case tile::along_y: out_size.spatial[1] *= num_tiles; break;
+        case tile::along_x: out_size.spatial[0] *= num_tiles; break;
+        default: break;
+    }
+
+    memory input = memory::allocate(engine, { type_to_data_type<data_t>::value, format::bfyx, in_size });
+    memory output_ref = memory::allocate(engine, { type_to_data_type<data_t>::value, format::bfyx, out_size });
+
+    topology topology;
+    topology.add(input_layout("input", input.get_layout()));
+    topology.add(tile("tile", "input", axis, num_tiles));
+
+    set_random_values<data_t>(input, true);
+    tile_ref<data_t>(input, output_ref, axis, num_tiles);
+
+    network network(engine, topology);
+    network.set_input_data("input", input);
+
+    auto outputs = network.execute();
+
+    auto output = outputs.at("tile").get_memory();
+    auto output_ptr = output.pointer<data_t>();
+    auto output_ref_ptr = output_ref.pointer<data_t>();
+
+    ASSERT_EQ(output.count(), output_ref.count());
+    for (unsigned int i = 0; i < output_ref.count(); ++i) {
+        ASSERT_EQ(static_cast<float>(output_ptr[i]), static_cast<float>(output_ref_ptr[i])) << "Index=" << i;
+    }
+}
+
+TEST(tile_gpu, random_in2x3x5x3_axis_x_odd_row) {
+    tile_random_test<float>({ 2, 3, 5, 3 }, tile::along_x, 3);
+}
+
+TEST(tile_gpu, random_in1x4x1x6_axis_x_splat) {
+    tile_random_test<float>({ 1, 4, 1, 6 }, tile::along_x, 19);
+}
+
+TEST(tile_gpu, random_in2x3x17x2_axis_y) {
+    tile_random_test<float>({ 2, 3, 17, 2 }, tile::along_y, 4);
+}
+
+TEST(tile_gpu, random_in2x3x9x4_axis_f) {
+    tile_random_test<float>({ 2, 3, 9, 4 }, tile::along_f, 2);
+}
+
+TEST(tile_gpu, random_in1x3x8x4_axis_b) {
+    tile_random_test<float>({ 1, 3, 8, 4 }, tile::along_b, 3);
+}
+
+TEST(tile_gpu, random_in2x3x12x3_axis_x_f16) {
+    tile_random_test<FLOAT16>({ 2, 3, 12, 3 }, tile::along_x, 5);
+}
+
+// Run with: tests --gtest_also_run_disabled_tests --gtest_filter=tile_gpu.DISABLED_bandwidth_report
+TEST(tile_gpu, DISABLED_bandwidth_report) {
+    engine engine;
+    const int iterations = 20;
+
+    struct report_case {
+        std::string name;
+        tensor in_size;
+        tile::tile_axis axis;
+        int tiles;
+    };
+    const std::vector<report_case> cases = {
+        { "along b",    { 1, 256, 56, 56 },   tile::along_b, 8 },
+        { "along f",    { 8, 32, 56, 56 },    tile::along_f, 8 },
+        { "along y",    { 8, 256, 56, 7 },    tile::along_y, 8 },
+        { "along x",    { 8, 256, 7, 56 },    tile::along_x, 8 },
+        { "along x 1",  { 8, 256, 1, 56 },    tile::along_x, 56 },
+    };
+
+    std::cout << std::setw(20) << "tile" << std::setw(20) << "input" << std::setw(10) << "GB/s" << std::endl;
+    for (const auto& c : cases) {
+        auto input = memory::allocate(engine, { data_types::f32, format::bfyx, c.in_size });
+        topology topology(
+            input_layout("input", input.get_layout()),
+            tile("tile", "input", c.axis, c.tiles));
+        network network(engine, topology);
+        network.set_input_data("input", input);
+        auto output = network.execute().at("tile").get_memory();
+
+        auto start = std::chrono::high_resolution_clock::now();
+        for (int i = 0; i < iterations; ++i)
+            network.execute().at("tile").get_event().wait();
+        const auto seconds = std::chrono::duration<double>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+
+        const double bandwidth = (input.get_layout().bytes_count() + output.get_layout().bytes_count()) / seconds * 1e-9;
+
+        std::stringstream size_str;
+        size_str << c.in_size.batch[0] << "x" << c.in_size.feature[0] << "x" << c.in_size.spatial[1] << "x" << c.in_size.spatial[0];
+        std::cout << std::setw(20) << c.name << std::setw(20) << size_str.str() << std::fixed << std::setprecision(1)
+                  << std::setw(10) << bandwidth << std::endl;
+    }
+}
@@ -0,0 +1,159 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+///////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <gtest/gtest.h>
+#include "api/CPP/memory.hpp"
+#include <api/CPP/input_layout.hpp>
+#include <api/CPP/topology.hpp>
+#include <api/CPP/network.hpp>
+#include <api/CPP/engine.hpp>
+#include <api/CPP/data.hpp>
+#include <api/CPP/convolution.hpp>
+#include <api/CPP/fully_connected.hpp>
+#include <api/CPP/eltwise.hpp>
+#include "test_utils/test_utils.h"
+#include "test_utils/network_test_utils.h"
+
+using namespace cldnn;
+using namespace tests;
+
+/*
+    Data of a built network is replaced with network::update_data, results have to match a network built with new data.
+*/
+namespace
+{
+    build_options updatable_options(bool host_weights_reorder = true)
+    {
+        build_options options;
+        options.set_option(build_option::optimize_data(true));
+        options.set_option(build_option::updatable_data(true));
+        options.set_option(build_option::host_weights_reorder(host_weights_reorder));
+        return options;
+    }
+
+    memory random_memory(const engine& engine, const layout& layout)
+    {
+        auto mem = memory::allocate(engine, layout);
+        tests::set_random_values<float>(mem, true);
+        return mem;
+    }
+
+    // input -> conv -> fc -> output
+    topology conv_fc_topology(const layout& input_layout_desc, const memory& conv_weights, const memory& conv_bias, const memory& fc_weights)
+    {
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        topology.add(data("conv_weights", conv_weights), data("conv_bias", conv_bias), data("fc_weights", fc_weights));
+        topology.add(convolution("conv", "input", { "conv_weights" }, { "conv_bias" }, { 1, 1, 1, 1 }, { 0, 0, -1, -1 }));
+        topology.add(fully_connected("output", "conv", "fc_weights"));
+        return topology;
+    }
+
+    //  input -> conv1 -> sum
+    //       \-> conv2 -/
+    topology siblings_topology(const layout& input_layout_desc, const memory& weights1, const memory& weights2)
+    {
+        topology topology;
+        topology.add(input_layout("input", input_layout_desc));
+        topology.add(data("weights1", weights1), data("weights2", weights2));
+        topology.add(convolution("conv1", "input", { "weights1" }));
+        topology.add(convolution("conv2", "input", { "weights2" }));
+        topology.add(eltwise("output", "conv1", "conv2", eltwise_mode::sum));
+        return topology;
+    }
+
+    void compare(const std::vector<float>& expected, const std::vector<float>& actual)
+    {
+        ASSERT_EQ(expected.size(), actual.size());
+        for (size_t i = 0; i < expected.size(); i++)
+            EXPECT_NEAR(expected[i], actual[i], 1e-4f) << "i = " << i;
+    }
+
+    void update_conv_fc_weights(bool host_weights_reorder)
+    {
+        engine engine;
+        const layout input_layout_desc = { data_types::f32, format::bfyx, { 1, 16, 8, 8 } };
+        const layout conv_weights_layout = { data_types::f32, format::bfyx, { 32, 16, 3, 3 } };
+        const layout conv_bias_layout = { data_types::f32, format::bfyx, { 1, 1, 32, 1 } };
+        const layout fc_weights_layout = { data_types::f32, format::bfyx, { 10, 32, 8, 8 } };
+
+        auto input = random_memory(engine, input_layout_desc);
+        auto conv_bias = random_memory(engine, conv_bias_layout);
+        auto fc_weights = random_memory(engine, fc_weights_layout);
+        network network(engine, conv_fc_topology(input_layout_desc, random_memory(engine, conv_weights_layout), conv_bias, fc_weights),
+            updatable_options(host_weights_reorder));
+        execute(network, input);
+
+        auto new_conv_weights = random_memory(engine, conv_weights_layout);
+        auto new_fc_weights = random_memory(engine, fc_weights_layout);
+        network.update_data("conv_weights", new_conv_weights);
+        network.update_data("fc_weights", new_fc_weights);
+
+        ::network reference(engine, conv_fc_topology(input_layout_desc, new_conv_weights, conv_bias, new_fc_weights), updatable_options(host_weights_reorder));
+        compare(execute(reference, input), execute(network, input));
+    }
+}
+
+TEST(update_data, conv_fc_weights_host_reorder) {
+    update_conv_fc_weights(true);
+}
+
+TEST(update_data, conv_fc_weights_gpu_reorder) {
+    update_conv_fc_weights(false);
+}
+
+TEST(update_data, fused_sibling_convolutions) {
+    engine engine;
+    const layout input_layout_desc = { data_types::f32, format::bfyx, { 1, 8, 4, 4 } };
+    const layout weights_layout = { data_types::f32, format::bfyx, { 16, 8, 1, 1 } };
+
+    auto input = random_memory(engine, input_layout_desc);
+    auto weights1 = random_memory(engine, weights_layout);
+    auto weights2 = random_memory(engine, weights_layout);
+    {
+        //identical weights are not merged when data is updatable
+        auto src = weights1.pointer<float>();
+        auto dst = weights2.pointer<float>();
+        std::copy(src.begin(), src.end(), dst.begin());
+    }
+    network network(engine, siblings_topology(input_layout_desc, weights1, weights2), updatable_options());
+    EXPECT_EQ(network.get_removed_duplicates(), (size_t)0);
+
+    auto new_weights2 = random_memory(engine, weights_layout);
+    network.update_data("weights2", new_weights2);
+
+    ::network reference(engine, siblings_topology(input_layout_desc, weights1, new_weights2), updatable_options());
+    compare(execute(reference, input), execute(network, input));
+}
+
+TEST(update_data, errors) {
+    engine engine;
+    const layout input_layout_desc = { data_types::f32, format::bfyx, { 1, 8, 4, 4 } };
+    const layout weights_layout = { data_types::f32, format::bfyx, { 16, 8, 1, 1 } };
+    auto weights1 = random_memory(engine, weights_layout);
+    auto weights2 = random_memory(engine, weights_layout);
+
+    network network(engine, siblings_topology(input_layout_desc, weights1, weights2), updatable_options());
+    EXPECT_ANY_THROW(network.update_data("weights1", random_memory(engine, { data_types::f32, format::bfyx, { 8, 8, 1, 1 } })));
+    EXPECT_ANY_THROW(network.update_data("conv1", random_memory(engine, weights_layout)));
+
+    build_options not_updatable;
+    not_updatable.set_option(build_option::optimize_data(true));
+    ::network not_updatable_network(engine, siblings_topology(input_layout_desc, weights1, weights2), not_updatable);
+    EXPECT_ANY_THROW(not_updatable_network.update_data("weights1", random_memory(engine, weights_layout)));
+}
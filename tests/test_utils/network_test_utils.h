@@ -0,0 +1,152 @@
+/*
+// Copyright (c) 2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//      http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+*/
+
+// helpers for tests which run whole topologies and compare outputs of differently built networks
+
+#pragma once
+
+#include "test_utils.h"
+#include "api/CPP/engine.hpp"
+#include "api/CPP/topology.hpp"
+#include "api/CPP/network.hpp"
+#include "api/CPP/input_layout.hpp"
+#include "api/CPP/data.hpp"
+#include "api/CPP/convolution.hpp"
+#include "api/CPP/fully_connected.hpp"
+#include "api/CPP/eltwise.hpp"
+#include "api/CPP/pooling.hpp"
+#include "api/CPP/reorder.hpp"
+
+#include <functional>
+#include <utility>
+
+namespace tests {
+
+// sets "input" of the network, executes it and returns values of output_id (f32)
+inline std::vector<float> execute(cldnn::network& network, const cldnn::memory& input, const cldnn::primitive_id& output_id = "output")
+{
+    network.set_input_data("input", input);
+    auto output = network.execute().at(output_id).get_memory();
+    auto output_ptr = output.pointer<float>();
+    return std::vector<float>(output_ptr.begin(), output_ptr.end());
+}
+
+// executes both networks with the same input and compares their "output" values
+inline void compare_outputs(cldnn::network& expected_network, cldnn::network& actual_network, const cldnn::memory& input, float tolerance)
+{
+    auto expected = execute(expected_network, input);
+    auto actual = execute(actual_network, input);
+
+    ASSERT_EQ(expected.size(), actual.size());
+    for (size_t i = 0; i < expected.size(); i++)
+    {
+        EXPECT_NEAR(expected[i], actual[i], tolerance) << "i = " << i;
+    }
+}
+
+// executes topology built with graph optimizations (optimize_data and given options) and without them, with the same "input";
+// check is called for both networks after execution. Returns f32 values of output_id: { optimized, reference }
+inline std::pair<std::vector<float>, std::vector<float>> run_optimized_and_reference(const cldnn::engine& engine,
+    const cldnn::topology& topology, const cldnn::memory& input, const cldnn::primitive_id& output_id,
+    const std::function<void(cldnn::network& network, bool optimized)>& check = nullptr,
+    const cldnn::build_options& options = cldnn::build_options())
+{
+    std::vector<float> results[2];
+    for (int optimize = 0; optimize < 2; optimize++)
+    {
+        cldnn::build_options build_options = optimize != 0 ? options : cldnn::build_options();
+        build_options.set_option(cldnn::build_option::optimize_data(optimize != 0));
+        cldnn::network network(engine, topology, build_options);
+        results[optimize] = execute(network, input, output_id);
+        if (check)
+            check(network, optimize != 0);
+    }
+    return { results[1], results[0] };
+}
+
+// builds topologies of convolutions and fully connected layers with random weights of given data type
+class topology_builder
+{
+public:
+    topology_builder(const cldnn::engine& engine, cldnn::data_types dt) : _engine(engine), _dt(dt) {}
+
+    cldnn::primitive_id add_convolution(const cldnn::primitive_id& id, const cldnn::primitive_id& input, int32_t ifm, int32_t ofm, int32_t kernel_size)
+    {
+        auto weights = cldnn::memory::allocate(_engine, { _dt, cldnn::format::bfyx, { ofm, ifm, kernel_size, kernel_size } });
+        auto biases = cldnn::memory::allocate(_engine, { _dt, cldnn::format::bfyx, { 1, 1, ofm, 1 } });
+        fill(weights);
+        fill(biases);
+        _topology.add(cldnn::data(id + "_weights", weights), cldnn::data(id + "_biases", biases));
+        _topology.add(cldnn::convolution(id, input, { id + "_weights" }, { id + "_biases" }, { 1, 1, 1, 1 },
+            { 0, 0, -(kernel_size / 2), -(kernel_size / 2) }, { 1, 1, 1, 1 }, true));
+        return id;
+    }
+
+    cldnn::primitive_id add_fully_connected(const cldnn::primitive_id& id, const cldnn::primitive_id& input, const cldnn::tensor& input_size, int32_t ofm)
+    {
+        auto weights = cldnn::memory::allocate(_engine, { _dt, cldnn::format::bfyx, { ofm, input_size.feature[0], input_size.spatial[0], input_size.spatial[1] } });
+        auto biases = cldnn::memory::allocate(_engine, { _dt, cldnn::format::bfyx, { 1, 1, ofm, 1 } });
+        fill(weights);
+        fill(biases);
+        _topology.add(cldnn::data(id + "_weights", weights), cldnn::data(id + "_biases", biases));
+        _topology.add(cldnn::fully_connected(id, input, id + "_weights", id + "_biases"));
+        return id;
+    }
+
+    template <class PType>
+    cldnn::primitive_id add(const PType& prim)
+    {
+        _topology.add(prim);
+        return prim.id;
+    }
+
+    const cldnn::topology& get() const { return _topology; }
+
+private:
+    void fill(const cldnn::memory& mem)
+    {
+        if (_dt == cldnn::data_types::f16)
+            set_random_values<FLOAT16>(mem, true);
+        else
+            set_random_values<float>(mem, true);
+    }
+
+    const cldnn::engine& _engine;
+    cldnn::data_types _dt;
+    cldnn::topology _topology;
+};
+
+// bottleneck residual blocks, f32 "input" and "output"
+inline cldnn::topology residual_topology(const cldnn::engine& engine, cldnn::data_types dt, const cldnn::tensor& input_size, int blocks)
+{
+    topology_builder builder(engine, dt);
+    builder.add(cldnn::input_layout("input", { cldnn::data_types::f32, cldnn::format::bfyx, input_size }));
+    builder.add(cldnn::reorder("input_reordered", "input", cldnn::format::bfyx, dt));
+    cldnn::primitive_id block_input = builder.add_convolution("stem", "input_reordered", input_size.feature[0], 256, 3);
+    for (int i = 0; i < blocks; i++)
+    {
+        const auto prefix = "block" + std::to_string(i) + "_";
+        auto reduce = builder.add_convolution(prefix + "reduce", block_input, 256, 64, 1);
+        auto conv = builder.add_convolution(prefix + "conv", reduce, 64, 64, 3);
+        auto expand = builder.add_convolution(prefix + "expand", conv, 64, 256, 1);
+        block_input = builder.add(cldnn::eltwise(prefix + "sum", expand, block_input, cldnn::eltwise_mode::sum, true));
+    }
+    builder.add(cldnn::pooling("pool", block_input, cldnn::pooling_mode::max, { 1, 1, 2, 2 }, { 1, 1, 2, 2 }));
+    builder.add(cldnn::reorder("output", "pool", cldnn::format::bfyx, cldnn::data_types::f32));
+    return builder.get();
+}
+
+}